@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "RawInput.h"
+#include "Container/Set.h"
 #include "Delegates/DelegateCombination.h"
 #include "HAL/PlatformType.h"
 #include "InputCore/InputCoreTypes.h"
@@ -116,8 +116,8 @@ void ControlEditorPanel::CreateMenuButton(ImVec2 ButtonSize, ImFont* IconFont)
 
         if (ImGui::MenuItem("Load World"))
         {
-            char const* lFilterPatterns[1] = { "*.scene" };
-            const char* FileName = tinyfd_openFileDialog("Open Scene File", "", 1, lFilterPatterns, "Scene(.scene) file", 0);
+            char const* lFilterPatterns[2] = { "*.scene", "*.scenebin" };
+            const char* FileName = tinyfd_openFileDialog("Open Scene File", "", 2, lFilterPatterns, "Scene(.scene, .scenebin) file", 0);
 
             if (FileName == nullptr)
             {
@@ -136,8 +136,8 @@ void ControlEditorPanel::CreateMenuButton(ImVec2 ButtonSize, ImFont* IconFont)
 
         if (ImGui::MenuItem("Save World"))
         {
-            char const* lFilterPatterns[1] = { "*.scene" };
-            const char* FileName = tinyfd_saveFileDialog("Save Scene File", "", 1, lFilterPatterns, "Scene(.scene) file");
+            char const* lFilterPatterns[2] = { "*.scene", "*.scenebin" };
+            const char* FileName = tinyfd_saveFileDialog("Save Scene File", "", 2, lFilterPatterns, "Scene(.scene, .scenebin) file");
 
             if (FileName == nullptr)
             {
@@ -14,9 +14,9 @@
 #include "UObject/ObjectFactory.h"
 #include "Engine/Engine.h"
 #include "Components/HeightFogComponent.h"
-#include "Components/ProjectileMovementComponent.h"
 
 #include "Engine/AssetManager.h"
+#include "UObject/UObjectHash.h"
 #include "UObject/UObjectIterator.h"
 
 void PropertyEditorPanel::Render()
@@ -102,7 +102,6 @@ void PropertyEditorPanel::Render()
         }
     }
 
-    // TODO: 추후에 RTTI를 이용해서 프로퍼티 출력하기
     if (PickedActor)
         if (ULightComponent* lightObj = PickedActor->GetComponentByClass<ULightComponent>())
         {
@@ -213,42 +212,27 @@ void PropertyEditorPanel::Render()
         //    ImGui::PopStyleColor();
         //}
 
+    // UPROPERTY로 등록된 값은 컴포넌트마다 타입에 맞는 위젯으로 출력합니다.
     if (PickedActor)
-        if (UProjectileMovementComponent* ProjectileComp = (PickedActor->GetComponentByClass<UProjectileMovementComponent>()))
+    {
+        for (UActorComponent* Component : PickedActor->GetComponents())
         {
-            ImGui::PushStyleColor(ImGuiCol_Header, ImVec4(0.1f, 0.1f, 0.1f, 1.0f));
-
-            if (ImGui::TreeNodeEx("Projectile Movement Component", ImGuiTreeNodeFlags_Framed | ImGuiTreeNodeFlags_DefaultOpen))
+            if (Component->GetClass()->GetAllProperties().IsEmpty())
             {
-                float InitialSpeed = ProjectileComp->GetInitialSpeed();
-                if (ImGui::InputFloat("InitialSpeed", &InitialSpeed, 0.f, 10000.0f, "%.1f"))
-                    ProjectileComp->SetInitialSpeed(InitialSpeed);
-
-                float MaxSpeed = ProjectileComp->GetMaxSpeed();
-                if (ImGui::InputFloat("MaxSpeed", &MaxSpeed, 0.f, 10000.0f, "%.1f"))
-                    ProjectileComp->SetMaxSpeed(MaxSpeed);
-
-                float Gravity = ProjectileComp->GetGravity();
-                if (ImGui::InputFloat("Gravity", &Gravity, 0.f, 10000.f, "%.1f"))
-                    ProjectileComp->SetGravity(Gravity); 
-                
-                float ProjectileLifetime = ProjectileComp->GetLifetime();
-                if (ImGui::InputFloat("Lifetime", &ProjectileLifetime, 0.f, 10000.f, "%.1f"))
-                    ProjectileComp->SetLifetime(ProjectileLifetime);
-
-                FVector currentVelocity = ProjectileComp->GetVelocity();
-
-                float velocity[3] = { currentVelocity.X, currentVelocity.Y, currentVelocity.Z };
+                continue;
+            }
 
-                if (ImGui::InputFloat3("Velocity", velocity, "%.1f")) {
-                    ProjectileComp->SetVelocity(FVector(velocity[0], velocity[1], velocity[2]));
-                }
-                
+            ImGui::PushID(Component);
+            ImGui::PushStyleColor(ImGuiCol_Header, ImVec4(0.1f, 0.1f, 0.1f, 1.0f));
+            if (ImGui::TreeNodeEx(*Component->GetName(), ImGuiTreeNodeFlags_Framed))
+            {
+                RenderReflectedProperties(Component);
                 ImGui::TreePop();
             }
-
             ImGui::PopStyleColor();
+            ImGui::PopID();
         }
+    }
     // TODO: 추후에 RTTI를 이용해서 프로퍼티 출력하기
     if (PickedActor)
         if (UTextComponent* textOBj = Cast<UTextComponent>(PickedActor->GetRootComponent()))
@@ -445,6 +429,90 @@ void PropertyEditorPanel::HSVToRGB(float h, float s, float v, float& r, float& g
     r += m;  g += m;  b += m;
 }
 
+void PropertyEditorPanel::RenderReflectedProperties(UObject* Object)
+{
+    // EPropertyType의 Int8 ~ Double은 ImGuiDataType_S8 ~ ImGuiDataType_Double과 같은 순서입니다.
+    static_assert(
+        static_cast<int>(EPropertyType::Double) - static_cast<int>(EPropertyType::Int8)
+        == ImGuiDataType_Double - ImGuiDataType_S8
+    );
+
+    for (const FProperty* Property : Object->GetClass()->GetAllProperties())
+    {
+        void* Value = Property->ContainerPtrToValuePtr(Object);
+        bool bChanged = false;
+
+        switch (Property->Type)
+        {
+        case EPropertyType::Bool:
+            bChanged = ImGui::Checkbox(Property->Name, static_cast<bool*>(Value));
+            break;
+
+        case EPropertyType::Int8:
+        case EPropertyType::UInt8:
+        case EPropertyType::Int16:
+        case EPropertyType::UInt16:
+        case EPropertyType::Int32:
+        case EPropertyType::UInt32:
+        case EPropertyType::Int64:
+        case EPropertyType::UInt64:
+        case EPropertyType::Float:
+        case EPropertyType::Double:
+        {
+            const ImGuiDataType DataType = ImGuiDataType_S8 + (static_cast<int>(Property->Type) - static_cast<int>(EPropertyType::Int8));
+            bChanged = ImGui::DragScalar(Property->Name, DataType, Value, 0.1f);
+            break;
+        }
+
+        case EPropertyType::Vector2D:
+            bChanged = ImGui::DragFloat2(Property->Name, static_cast<float*>(Value), 0.1f);
+            break;
+
+        case EPropertyType::Vector:
+        case EPropertyType::Rotator:
+            bChanged = ImGui::DragFloat3(Property->Name, static_cast<float*>(Value), 0.1f);
+            break;
+
+        case EPropertyType::Vector4:
+            bChanged = ImGui::DragFloat4(Property->Name, static_cast<float*>(Value), 0.1f);
+            break;
+
+        case EPropertyType::LinearColor:
+            bChanged = ImGui::ColorEdit4(Property->Name, static_cast<float*>(Value), ImGuiColorEditFlags_Float);
+            break;
+
+        case EPropertyType::String:
+        case EPropertyType::WideString:
+        {
+            FString Text;
+            Property->ExportText(Value, Text);
+
+            char Buffer[256];
+            strncpy_s(Buffer, *Text, _TRUNCATE);
+            if (ImGui::InputText(Property->Name, Buffer, sizeof(Buffer), ImGuiInputTextFlags_EnterReturnsTrue))
+            {
+                bChanged = Property->ImportText(FString(Buffer), Value);
+            }
+            break;
+        }
+
+        default:
+        {
+            // Object 참조와 배열은 읽기 전용으로 보여줍니다.
+            FString Text;
+            Property->ExportText(Value, Text);
+            ImGui::LabelText(Property->Name, "%s", *Text);
+            break;
+        }
+        }
+
+        if (bChanged)
+        {
+            Object->PostEditChangeProperty(Property);
+        }
+    }
+}
+
 void PropertyEditorPanel::RenderForStaticMesh(UStaticMeshComponent* StaticMeshComp) const
 {
     if (StaticMeshComp->GetStaticMesh() == nullptr)
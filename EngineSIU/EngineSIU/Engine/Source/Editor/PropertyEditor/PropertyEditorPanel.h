@@ -37,6 +37,9 @@ private:
     void RGBToHSV(float r, float g, float b, float& h, float& s, float& v) const;
     void HSVToRGB(float h, float s, float v, float& r, float& g, float& b) const;
 
+    /** UPROPERTY로 등록된 Object의 Property를 타입에 맞는 위젯으로 그리고, 값이 바뀌면 PostEditChangeProperty를 호출합니다. */
+    static void RenderReflectedProperties(UObject* Object);
+
     /* Static Mesh Settings */
     void RenderForStaticMesh(UStaticMeshComponent* StaticMeshComp) const;
     
@@ -0,0 +1,642 @@
+#include "SceneData.h"
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include "Async/JobSystem.h"
+#include "Serialization/MemoryArchive.h"
+
+#include "JSON/json.hpp"
+
+using namespace NS_SceneManagerData;
+using json = nlohmann::json;
+
+
+#pragma region nlohmann::json function overload
+[[maybe_unused]]
+static void to_json(json& Json, const FString& S)
+{
+    Json = S.GetContainerPrivate();
+}
+
+[[maybe_unused]]
+static void from_json(const json& Json, FString& S)
+{
+    if (Json.is_string())
+    {
+        Json.get_to(S.GetContainerPrivate());
+    }
+}
+
+
+template <typename ElementType, typename AllocatorType>
+[[maybe_unused]]
+static void to_json(json& Json, const TArray<ElementType, AllocatorType>& Array)
+{
+    Json = Array.GetContainerPrivate();
+}
+
+template <typename ElementType, typename AllocatorType>
+[[maybe_unused]]
+static void from_json(const json& Json, TArray<ElementType, AllocatorType>& Array)
+{
+    Json.get_to(Array.GetContainerPrivate());
+}
+
+
+// TMap의 내부 컨테이너가 TFlatHashMap일 수도 있으므로, 이전과 같은 JSON이 나오도록 std::unordered_map을 거칩니다.
+template <typename KeyType, typename ValueType, typename Allocator>
+using TJsonMapType = std::unordered_map<KeyType, ValueType, std::hash<KeyType>, std::equal_to<KeyType>, Allocator>;
+
+template <typename KeyType, typename ValueType, typename Allocator>
+[[maybe_unused]]
+static void to_json(json& Json, const TMap<KeyType, ValueType, Allocator>& Map)
+{
+    TJsonMapType<KeyType, ValueType, Allocator> JsonMap;
+    JsonMap.reserve(Map.Num());
+    for (const auto& [Key, Value] : Map)
+    {
+        JsonMap.emplace(Key, Value);
+    }
+    Json = JsonMap;
+}
+
+template <typename KeyType, typename ValueType, typename Allocator>
+[[maybe_unused]]
+static void from_json(const json& Json, TMap<KeyType, ValueType, Allocator>& Map)
+{
+    TJsonMapType<KeyType, ValueType, Allocator> JsonMap;
+    Json.get_to(JsonMap);
+
+    Map.Empty(JsonMap.size());
+    for (auto& [Key, Value] : JsonMap)
+    {
+        Map.Emplace(Key, std::move(Value));
+    }
+}
+#pragma endregion
+
+
+namespace NS_SceneManagerData
+{
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(FComponentSaveData, ComponentID, ComponentClass, Properties)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(FActorSaveData, ActorID, ActorClass, ActorLabel, RootComponentID, Components)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(FSceneData, Version, NextUUID, Actors)
+}
+
+namespace
+{
+    /** 바이너리 Scene 파일의 Header. 필드 순서대로 FArchive에 씁니다. */
+    struct FBinarySceneHeader
+    {
+        static constexpr uint32 ExpectedMagic = FSceneDataSerializer::BinarySceneMagic;
+        /** 2부터 배치 테이블에 Property 타입이 들어가고, 숫자와 벡터 값은 바이너리로 저장됩니다. */
+        static constexpr uint32 CurrentFormatVersion = 2;
+        static constexpr uint32 MinFormatVersion = 1;
+
+        uint32 Magic = ExpectedMagic;
+        uint32 FormatVersion = CurrentFormatVersion;
+        int32 SceneVersion = 0;
+        int32 NextUUID = 0;
+        int32 NumStrings = 0;
+        int32 NumLayouts = 0;
+        int32 NumActors = 0;
+        int64 StringTableOffset = 0;
+        int64 LayoutTableOffset = 0;
+        int64 ActorIndexOffset = 0;
+
+        void Serialize(FArchive& Ar)
+        {
+            Ar << Magic << FormatVersion << SceneVersion << NextUUID << NumStrings << NumLayouts << NumActors;
+            Ar << StringTableOffset << LayoutTableOffset << ActorIndexOffset;
+        }
+    };
+
+    /**
+     * 같은 클래스이고 Property 이름, 타입 목록도 같은 컴포넌트들이 공유하는 배치.
+     * 컴포넌트 블록에는 PropertyNameIndices 순서대로 값만 들어 있습니다.
+     * 타입이 0인 값은 문자열로, 그 밖의 값은 IScenePropertyCodec이 알려 준 크기만큼의 바이너리로 저장됩니다.
+     */
+    struct FComponentLayout
+    {
+        uint32 ClassIndex = 0;
+        TArray<uint32> PropertyNameIndices;
+        TArray<uint8> PropertyTypes;
+    };
+
+    /** IScenePropertyCodec의 값 하나를 담을 수 있는 버퍼 */
+    struct FPropertyValueBuffer
+    {
+        alignas(16) uint8 Bytes[IScenePropertyCodec::MaxValueSize];
+    };
+
+    /** 저장하기 전에 바이너리로 바꿔 둔 Property 값 */
+    struct FEncodedProperty
+    {
+        uint32 NameIndex = 0;
+        uint8 Type = 0;
+        const FString* Value = nullptr;
+        FPropertyValueBuffer Buffer;
+    };
+
+    /** Actor 인덱스의 한 항목. Offset은 파일 처음부터의 위치입니다. */
+    struct FActorChunk
+    {
+        int64 Offset = 0;
+        int64 Size = 0;
+    };
+
+    /** 저장하는 동안 문자열과 컴포넌트 배치에 인덱스를 매깁니다. */
+    struct FBinarySceneWriteContext
+    {
+        TArray<FString> Strings;
+        TMap<FString, uint32> StringIndices;
+        TArray<FComponentLayout> Layouts;
+
+        uint32 AddString(const FString& String)
+        {
+            if (const uint32* Found = StringIndices.Find(String))
+            {
+                return *Found;
+            }
+            const uint32 Index = static_cast<uint32>(Strings.Add(String));
+            StringIndices.Add(String, Index);
+            return Index;
+        }
+
+        uint32 AddLayout(uint32 ClassIndex, const TArray<uint32>& PropertyNameIndices, const TArray<uint8>& PropertyTypes)
+        {
+            // 한 Scene의 배치 수는 컴포넌트 클래스 수 정도라서 그냥 훑습니다.
+            for (int32 Index = 0; Index < Layouts.Num(); ++Index)
+            {
+                const FComponentLayout& Layout = Layouts[Index];
+                if (Layout.ClassIndex == ClassIndex
+                    && Layout.PropertyNameIndices.GetContainerPrivate() == PropertyNameIndices.GetContainerPrivate()
+                    && Layout.PropertyTypes.GetContainerPrivate() == PropertyTypes.GetContainerPrivate())
+                {
+                    return static_cast<uint32>(Index);
+                }
+            }
+            return static_cast<uint32>(Layouts.Add(FComponentLayout{ClassIndex, PropertyNameIndices, PropertyTypes}));
+        }
+    };
+
+    /** 여러 스레드가 Actor 블록을 읽을 때 함께 읽기만 하는 데이터 */
+    struct FBinarySceneReadContext
+    {
+        const uint8* Data = nullptr;
+        const IScenePropertyCodec* Codec = nullptr;
+        TArray<FString> Strings;
+        TArray<FComponentLayout> Layouts;
+        TArray<FActorChunk> Chunks;
+        FActorSaveData* OutActors = nullptr;
+    };
+
+    void SetError(FString* OutError, const FString& Error)
+    {
+        if (OutError)
+        {
+            *OutError = Error;
+        }
+    }
+
+    void WriteString(FArchive& Ar, const FString& String)
+    {
+        // 저장할 때는 String을 바꾸지 않습니다.
+        Ar << const_cast<FString&>(String);
+    }
+
+    /** 길이가 남은 데이터보다 길면 메모리를 잡기 전에 실패합니다. */
+    void ReadString(FMemoryReaderView& Ar, FString& OutString)
+    {
+        int32 Length = 0;
+        Ar << Length;
+        if (Length < 0 || static_cast<int64>(Length) * static_cast<int64>(sizeof(TCHAR)) > Ar.TotalSize() - static_cast<FArchive&>(Ar).Tell())
+        {
+            throw std::runtime_error("Invalid string length.");
+        }
+        OutString.Resize(Length);
+        Ar.Serialize(GetData(OutString), Length * sizeof(TCHAR));
+    }
+
+    uint32 ReadIndex(FArchive& Ar, int32 Limit)
+    {
+        uint32 Index = 0;
+        Ar << Index;
+        if (Index >= static_cast<uint32>(Limit))
+        {
+            throw std::runtime_error("Index out of range.");
+        }
+        return Index;
+    }
+
+    /**
+     * Value를 ComponentClass의 같은 이름 Property 타입으로 바꿔 OutProperty.Buffer에 씁니다.
+     * 바이너리에서 다시 만든 문자열이 Value와 똑같을 때만 타입을 정하고, 아니면 0으로 남겨 문자열로 저장하게 합니다.
+     */
+    void EncodePropertyValue(const IScenePropertyCodec& Codec, const FString& ComponentClass, const FString& Name, FEncodedProperty& OutProperty)
+    {
+        OutProperty.Type = 0;
+
+        const uint8 Type = Codec.FindPropertyType(ComponentClass, Name);
+        const int32 ValueSize = Type != 0 ? Codec.GetValueSize(Type) : 0;
+        if (ValueSize <= 0 || ValueSize > IScenePropertyCodec::MaxValueSize)
+        {
+            return;
+        }
+
+        std::memset(OutProperty.Buffer.Bytes, 0, sizeof(OutProperty.Buffer.Bytes));
+        if (!Codec.ImportText(Type, *OutProperty.Value, OutProperty.Buffer.Bytes))
+        {
+            return;
+        }
+
+        FString RoundTripText;
+        Codec.ExportText(Type, OutProperty.Buffer.Bytes, RoundTripText);
+        if (RoundTripText == *OutProperty.Value)
+        {
+            OutProperty.Type = Type;
+        }
+    }
+
+    void WriteActor(FArchive& Ar, FBinarySceneWriteContext& Context, const IScenePropertyCodec& Codec, const FActorSaveData& ActorData)
+    {
+        uint32 ActorIDIndex = Context.AddString(ActorData.ActorID);
+        uint32 ActorClassIndex = Context.AddString(ActorData.ActorClass);
+        uint32 ActorLabelIndex = Context.AddString(ActorData.ActorLabel);
+        uint32 RootComponentIndex = Context.AddString(ActorData.RootComponentID);
+        int32 NumComponents = ActorData.Components.Num();
+        Ar << ActorIDIndex << ActorClassIndex << ActorLabelIndex << RootComponentIndex << NumComponents;
+
+        TArray<FEncodedProperty> SortedProperties;
+        TArray<uint32> PropertyNameIndices;
+        TArray<uint8> PropertyTypes;
+        for (const FComponentSaveData& ComponentData : ActorData.Components)
+        {
+            // TMap의 순회 순서는 정해져 있지 않으므로, 이름의 인덱스 순으로 정렬해서 배치를 만듭니다.
+            SortedProperties.Empty();
+            for (const auto& [Name, Value] : ComponentData.Properties)
+            {
+                FEncodedProperty& Encoded = SortedProperties[SortedProperties.Add(FEncodedProperty{Context.AddString(Name), 0, &Value})];
+                EncodePropertyValue(Codec, ComponentData.ComponentClass, Name, Encoded);
+            }
+            SortedProperties.Sort([](const FEncodedProperty& A, const FEncodedProperty& B)
+            {
+                return A.NameIndex < B.NameIndex;
+            });
+
+            PropertyNameIndices.Empty();
+            PropertyTypes.Empty();
+            for (const FEncodedProperty& Encoded : SortedProperties)
+            {
+                PropertyNameIndices.Add(Encoded.NameIndex);
+                PropertyTypes.Add(Encoded.Type);
+            }
+
+            uint32 ComponentIDIndex = Context.AddString(ComponentData.ComponentID);
+            uint32 LayoutIndex = Context.AddLayout(Context.AddString(ComponentData.ComponentClass), PropertyNameIndices, PropertyTypes);
+            Ar << ComponentIDIndex << LayoutIndex;
+
+            for (FEncodedProperty& Encoded : SortedProperties)
+            {
+                if (Encoded.Type == 0)
+                {
+                    WriteString(Ar, *Encoded.Value);
+                }
+                else
+                {
+                    Ar.Serialize(Encoded.Buffer.Bytes, Codec.GetValueSize(Encoded.Type));
+                }
+            }
+        }
+    }
+
+    /** Actor 블록 하나를 읽습니다. Worker Thread에서 호출되므로 로그를 남기지 않습니다. */
+    bool ReadActor(const FBinarySceneReadContext& Context, int32 ActorIndex)
+    {
+        const FActorChunk& Chunk = Context.Chunks[ActorIndex];
+        FActorSaveData& ActorData = Context.OutActors[ActorIndex];
+        const int32 NumStrings = Context.Strings.Num();
+
+        try
+        {
+            FMemoryReaderView Ar(Context.Data + Chunk.Offset, Chunk.Size);
+            ActorData.ActorID = Context.Strings[ReadIndex(Ar, NumStrings)];
+            ActorData.ActorClass = Context.Strings[ReadIndex(Ar, NumStrings)];
+            ActorData.ActorLabel = Context.Strings[ReadIndex(Ar, NumStrings)];
+            ActorData.RootComponentID = Context.Strings[ReadIndex(Ar, NumStrings)];
+
+            int32 NumComponents = 0;
+            Ar << NumComponents;
+            if (NumComponents < 0 || NumComponents > Chunk.Size / 8)
+            {
+                return false;
+            }
+
+            ActorData.Components.SetNum(NumComponents);
+            for (FComponentSaveData& ComponentData : ActorData.Components)
+            {
+                ComponentData.ComponentID = Context.Strings[ReadIndex(Ar, NumStrings)];
+                const FComponentLayout& Layout = Context.Layouts[ReadIndex(Ar, Context.Layouts.Num())];
+                ComponentData.ComponentClass = Context.Strings[Layout.ClassIndex];
+
+                ComponentData.Properties.Reserve(Layout.PropertyNameIndices.Num());
+                for (int32 PropertyIndex = 0; PropertyIndex < Layout.PropertyNameIndices.Num(); ++PropertyIndex)
+                {
+                    FString Value;
+                    if (const uint8 Type = Layout.PropertyTypes[PropertyIndex]; Type != 0)
+                    {
+                        // 타입마다의 크기는 배치 테이블을 읽을 때 확인했습니다.
+                        FPropertyValueBuffer Buffer;
+                        Ar.Serialize(Buffer.Bytes, Context.Codec->GetValueSize(Type));
+                        if (!Context.Codec->IsValidValue(Type, Buffer.Bytes))
+                        {
+                            return false;
+                        }
+                        Context.Codec->ExportText(Type, Buffer.Bytes, Value);
+                    }
+                    else
+                    {
+                        ReadString(Ar, Value);
+                    }
+                    ComponentData.Properties.Emplace(Context.Strings[Layout.PropertyNameIndices[PropertyIndex]], std::move(Value));
+                }
+            }
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+        return true;
+    }
+
+    /** Context의 모든 Actor 블록을 Worker Thread와 메인 스레드가 나눠 읽습니다. */
+    bool ReadActorsInParallel(const FBinarySceneReadContext& Context)
+    {
+        constexpr int32 MinActorsPerChunk = 64;
+
+        std::atomic<bool> bFailed = false;
+        FJobSystem::Get().ParallelFor(Context.Chunks.Num(), MinActorsPerChunk, [&Context, &bFailed](int32 Begin, int32 End, int32)
+        {
+            for (int32 Index = Begin; Index < End; ++Index)
+            {
+                if (!ReadActor(Context, Index))
+                {
+                    bFailed = true;
+                }
+            }
+        });
+        return !bFailed.load();
+    }
+
+    bool AreComponentsEqual(const FComponentSaveData& A, const FComponentSaveData& B)
+    {
+        if (A.ComponentID != B.ComponentID || A.ComponentClass != B.ComponentClass || A.Properties.Num() != B.Properties.Num())
+        {
+            return false;
+        }
+        for (const auto& [Name, Value] : A.Properties)
+        {
+            const FString* OtherValue = B.Properties.Find(Name);
+            if (!OtherValue || *OtherValue != Value)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+
+void FSceneDataSerializer::SerializeToBinary(const FSceneData& InSceneData, const IScenePropertyCodec& Codec, TArray<uint8>& OutData)
+{
+    FBinarySceneWriteContext Context;
+    FBinarySceneHeader Header;
+    Header.SceneVersion = InSceneData.Version;
+    Header.NextUUID = InSceneData.NextUUID;
+    Header.NumActors = InSceneData.Actors.Num();
+
+    // Actor 블록을 먼저 써야 문자열 테이블과 배치 테이블이 다 모입니다.
+    TArray<uint8> ActorData;
+    TArray<FActorChunk> Chunks;
+    Chunks.Reserve(InSceneData.Actors.Num());
+    {
+        FMemoryWriter Writer(ActorData);
+        for (const FActorSaveData& Actor : InSceneData.Actors)
+        {
+            const int64 Begin = ActorData.Num();
+            WriteActor(Writer, Context, Codec, Actor);
+            Chunks.Add({Begin, ActorData.Num() - Begin});
+        }
+    }
+
+    TArray<uint8> StringTableData;
+    {
+        FMemoryWriter Writer(StringTableData);
+        for (const FString& String : Context.Strings)
+        {
+            WriteString(Writer, String);
+        }
+    }
+
+    TArray<uint8> LayoutTableData;
+    {
+        FMemoryWriter Writer(LayoutTableData);
+        for (FComponentLayout& Layout : Context.Layouts)
+        {
+            int32 NumProperties = Layout.PropertyNameIndices.Num();
+            Writer << Layout.ClassIndex << NumProperties;
+            for (int32 PropertyIndex = 0; PropertyIndex < NumProperties; ++PropertyIndex)
+            {
+                uint8 Type = static_cast<uint8>(Layout.PropertyTypes[PropertyIndex]);
+                Writer << Layout.PropertyNameIndices[PropertyIndex] << Type;
+            }
+        }
+    }
+
+    Header.NumStrings = Context.Strings.Num();
+    Header.NumLayouts = Context.Layouts.Num();
+
+    // Header는 값과 상관없이 크기가 같으므로, 한 번 써 보고 그 크기로 각 영역의 위치를 정합니다.
+    int64 HeaderSize = 0;
+    {
+        TArray<uint8> HeaderData;
+        FMemoryWriter Writer(HeaderData);
+        FBinarySceneHeader HeaderCopy = Header;
+        HeaderCopy.Serialize(Writer);
+        HeaderSize = HeaderData.Num();
+    }
+    const int64 ActorIndexSize = static_cast<int64>(Chunks.Num()) * 2 * sizeof(int64);
+
+    Header.StringTableOffset = HeaderSize;
+    Header.LayoutTableOffset = Header.StringTableOffset + StringTableData.Num();
+    Header.ActorIndexOffset = Header.LayoutTableOffset + LayoutTableData.Num();
+    const int64 ActorDataOffset = Header.ActorIndexOffset + ActorIndexSize;
+
+    OutData.Empty();
+    OutData.Reserve(static_cast<int32>(ActorDataOffset + ActorData.Num()));
+
+    FMemoryWriter Writer(OutData);
+    Header.Serialize(Writer);
+    Writer.Serialize(StringTableData.GetData(), StringTableData.Num());
+    Writer.Serialize(LayoutTableData.GetData(), LayoutTableData.Num());
+    for (FActorChunk& Chunk : Chunks)
+    {
+        int64 Offset = ActorDataOffset + Chunk.Offset;
+        Writer << Offset << Chunk.Size;
+    }
+    Writer.Serialize(ActorData.GetData(), ActorData.Num());
+}
+
+bool FSceneDataSerializer::DeserializeFromBinary(const void* Data, int64 Size, const IScenePropertyCodec& Codec, FSceneData& OutSceneData, FString* OutError)
+{
+    FBinarySceneReadContext Context;
+    Context.Data = static_cast<const uint8*>(Data);
+    Context.Codec = &Codec;
+
+    FBinarySceneHeader Header;
+    try
+    {
+        FMemoryReaderView Reader(Data, Size);
+        Header.Serialize(Reader);
+        if (Header.Magic != FBinarySceneHeader::ExpectedMagic || Header.FormatVersion < FBinarySceneHeader::MinFormatVersion
+            || Header.FormatVersion > FBinarySceneHeader::CurrentFormatVersion)
+        {
+            SetError(OutError, FString::Printf(TEXT("Unsupported binary scene format (version %u)"), Header.FormatVersion));
+            return false;
+        }
+
+        // 개수가 터무니없으면 배열을 잡기 전에 실패하도록, 원소 하나의 최소 크기로 파일 크기와 비교합니다.
+        if (Header.NumStrings < 0 || Header.NumStrings > Size / 4
+            || Header.NumLayouts < 0 || Header.NumLayouts > Size / 8
+            || Header.NumActors < 0 || Header.NumActors > Size / 16)
+        {
+            throw std::runtime_error("Invalid table size.");
+        }
+
+        Reader.Seek(Header.StringTableOffset);
+        Context.Strings.SetNum(Header.NumStrings);
+        for (FString& String : Context.Strings)
+        {
+            ReadString(Reader, String);
+        }
+
+        Reader.Seek(Header.LayoutTableOffset);
+        Context.Layouts.SetNum(Header.NumLayouts);
+        for (FComponentLayout& Layout : Context.Layouts)
+        {
+            Layout.ClassIndex = ReadIndex(Reader, Header.NumStrings);
+
+            int32 NumProperties = 0;
+            Reader << NumProperties;
+            if (NumProperties < 0 || NumProperties > Size / 4)
+            {
+                throw std::runtime_error("Invalid layout size.");
+            }
+            Layout.PropertyNameIndices.SetNum(NumProperties);
+            Layout.PropertyTypes.SetNum(NumProperties);
+            for (int32 PropertyIndex = 0; PropertyIndex < NumProperties; ++PropertyIndex)
+            {
+                Layout.PropertyNameIndices[PropertyIndex] = ReadIndex(Reader, Header.NumStrings);
+
+                // 버전 1은 모든 값이 문자열입니다.
+                uint8 Type = 0;
+                if (Header.FormatVersion >= 2)
+                {
+                    Reader << Type;
+                }
+                const int32 ValueSize = Type != 0 ? Codec.GetValueSize(Type) : 0;
+                if (Type != 0 && (ValueSize <= 0 || ValueSize > IScenePropertyCodec::MaxValueSize))
+                {
+                    throw std::runtime_error("Invalid property type.");
+                }
+                Layout.PropertyTypes[PropertyIndex] = Type;
+            }
+        }
+
+        Reader.Seek(Header.ActorIndexOffset);
+        Context.Chunks.SetNum(Header.NumActors);
+        for (FActorChunk& Chunk : Context.Chunks)
+        {
+            Reader << Chunk.Offset << Chunk.Size;
+            if (Chunk.Offset < 0 || Chunk.Size < 0 || Chunk.Offset > Size - Chunk.Size)
+            {
+                throw std::runtime_error("Invalid actor chunk.");
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SetError(OutError, FString::Printf(TEXT("Error reading binary scene: %s"), e.what()));
+        return false;
+    }
+
+    OutSceneData.Version = Header.SceneVersion;
+    OutSceneData.NextUUID = Header.NextUUID;
+    OutSceneData.Actors.Empty();
+    OutSceneData.Actors.SetNum(Header.NumActors);
+    Context.OutActors = OutSceneData.Actors.GetData();
+
+    if (!ReadActorsInParallel(Context))
+    {
+        SetError(OutError, TEXT("Error reading binary scene: corrupted actor data"));
+        return false;
+    }
+    return true;
+}
+
+bool FSceneDataSerializer::JsonToSceneData(const FString& InJsonString, FSceneData& OutSceneData, FString* OutError)
+{
+    try
+    {
+        const json Json = json::parse(InJsonString.GetContainerPrivate()); // JSON 파일 읽기
+        OutSceneData = Json;
+    }
+    catch (const std::exception& e)
+    {
+        SetError(OutError, FString::Printf(TEXT("Error parsing JSON: %s"), e.what()));
+        return false;
+    }
+    return true;
+}
+
+bool FSceneDataSerializer::SceneDataToJson(const FSceneData& InSceneData, FString& OutJsonString, FString* OutError)
+{
+    try
+    {
+        const json Json = InSceneData;
+        OutJsonString = Json.dump(4); // JSON 데이터를 문자열로 변솬 (4는 들여쓰기 공백 수)
+    }
+    catch (const std::exception& e)
+    {
+        SetError(OutError, FString::Printf(TEXT("Error parsing JSON: %s"), e.what()));
+        return false;
+    }
+    return true;
+}
+
+bool FSceneDataSerializer::AreSceneDataEqual(const FSceneData& A, const FSceneData& B)
+{
+    if (A.Version != B.Version || A.NextUUID != B.NextUUID || A.Actors.Num() != B.Actors.Num())
+    {
+        return false;
+    }
+    for (int32 ActorIndex = 0; ActorIndex < A.Actors.Num(); ++ActorIndex)
+    {
+        const FActorSaveData& ActorA = A.Actors[ActorIndex];
+        const FActorSaveData& ActorB = B.Actors[ActorIndex];
+        if (ActorA.ActorID != ActorB.ActorID || ActorA.ActorClass != ActorB.ActorClass || ActorA.ActorLabel != ActorB.ActorLabel
+            || ActorA.RootComponentID != ActorB.RootComponentID || ActorA.Components.Num() != ActorB.Components.Num())
+        {
+            return false;
+        }
+        for (int32 ComponentIndex = 0; ComponentIndex < ActorA.Components.Num(); ++ComponentIndex)
+        {
+            if (!AreComponentsEqual(ActorA.Components[ComponentIndex], ActorB.Components[ComponentIndex]))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
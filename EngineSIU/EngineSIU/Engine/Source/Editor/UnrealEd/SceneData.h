@@ -0,0 +1,112 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+
+namespace NS_SceneManagerData
+{
+// 컴포넌트 하나의 저장 정보를 담는 구조체
+struct FComponentSaveData
+{
+    FString ComponentID;    // 컴포넌트의 고유 ID (액터 내에서 유일해야 함, FName)
+    FString ComponentClass; // 컴포넌트 클래스 이름 (예: "UStaticMeshComponent", "UPointLightComponent")
+
+    TMap<FString, FString> Properties;
+};
+
+// 액터 하나의 저장 정보를 담는 구조체
+struct FActorSaveData
+{
+    FString ActorID;    // 액터의 고유 ID FName
+    FString ActorClass; // 액터의 클래스 이름 (예: "AStaticMeshActor", "APointLight")
+    FString ActorLabel; // 에디터에서 보이는 이름 (선택적)
+    // FTransform ActorTransform; // 액터 자체의 트랜스폼 (보통 루트 컴포넌트가 결정) - 필요 여부 검토
+
+    FString RootComponentID;               // 이 액터의 루트 컴포넌트 ID (아래 Components 리스트 내 ID 참조)
+    TArray<FComponentSaveData> Components; // 이 액터가 소유한 컴포넌트 목록
+};
+
+struct FSceneData
+{
+    int32 Version = 0;
+    int32 NextUUID = 0;
+    //TMap<int32, UObject*> Primitives;
+
+    TArray<FActorSaveData> Actors; // 씬에 있는 모든 액터 정보
+    //TMap<int32, UObject*> Cameras;
+};
+
+//TODO : 레벨 데이타 구현
+}
+
+
+/**
+ * 바이너리 Scene 형식이 컴포넌트 Property 값을 문자열 대신 바이너리로 저장할 때 쓰는 타입 정보.
+ * 타입 번호는 파일에 그대로 저장되고, 0은 문자열로 저장한 값입니다. 에디터는 EPropertyType 값을 씁니다.
+ */
+class IScenePropertyCodec
+{
+public:
+    virtual ~IScenePropertyCodec() = default;
+
+    /** ComponentClass의 PropertyName 값을 바이너리로 저장할 수 있으면 그 타입 번호를, 아니면 0을 반환합니다. */
+    virtual uint8 FindPropertyType(const FString& ComponentClass, const FString& PropertyName) const = 0;
+
+    /** Type 값 하나의 바이트 수. 모르는 타입이면 0입니다. 최대 MaxValueSize입니다. */
+    virtual int32 GetValueSize(uint8 Type) const = 0;
+
+    /** Text를 Type 값으로 바꿔 OutValue에 씁니다. */
+    virtual bool ImportText(uint8 Type, const FString& Text, void* OutValue) const = 0;
+
+    /** ImportText로 만든 값을 다시 문자열로 바꿉니다. */
+    virtual void ExportText(uint8 Type, const void* Value, FString& OutText) const = 0;
+
+    /** 값이 올바른지 확인합니다. 손상된 파일에서 읽은 bool처럼 ExportText에 넘기면 안 되는 값을 거릅니다. */
+    virtual bool IsValidValue(uint8 Type, const void* Value) const { return true; }
+
+    static constexpr int32 MaxValueSize = 32;
+};
+
+
+/**
+ * FSceneData를 Json 또는 바이너리로 저장하고 읽습니다.
+ * UObject 없이 동작하며, 실패하면 OutError에 이유를 적고 false를 반환합니다. (로그는 호출한 쪽에서 남깁니다)
+ */
+class FSceneDataSerializer
+{
+public:
+    /** 바이너리 Scene 파일의 처음 4바이트 */
+    static constexpr uint32 BinarySceneMagic = 0x4E435342; // "BSCN"
+
+    static bool SceneDataToJson(const NS_SceneManagerData::FSceneData& InSceneData, FString& OutJsonString, FString* OutError = nullptr);
+
+    /**
+     * JSON 문자열을 역직렬화하여 FSceneData를 생성합니다.
+     *
+     * @param InJsonString 역직렬화할 JSON 문자열
+     * @param OutSceneData 역직렬화된 FSceneData 객체
+     * @return 성공 여부
+     */
+    static bool JsonToSceneData(const FString& InJsonString, NS_SceneManagerData::FSceneData& OutSceneData, FString* OutError = nullptr);
+
+    /**
+     * FSceneData를 바이너리 형식으로 직렬화합니다.
+     *
+     * 파일은 Header, 문자열 테이블, 컴포넌트 Property 배치 테이블, Actor 인덱스, Actor 블록 순서로 되어 있습니다.
+     * 클래스, 컴포넌트 이름과 Property 이름은 문자열 테이블의 인덱스로만 저장하고,
+     * 컴포넌트의 Property 값은 배치 테이블에 적힌 순서대로 이름 없이 나열합니다.
+     * Codec이 타입을 아는 값 중 다시 문자열로 바꿨을 때 원래와 똑같은 값만 바이너리로 저장합니다.
+     */
+    static void SerializeToBinary(const NS_SceneManagerData::FSceneData& InSceneData, const IScenePropertyCodec& Codec, TArray<uint8>& OutData);
+
+    /**
+     * SerializeToBinary로 만든 데이터를 FSceneData로 역직렬화합니다.
+     * Actor 인덱스를 이용해 Actor 블록들을 여러 스레드에서 나눠 읽습니다.
+     */
+    static bool DeserializeFromBinary(const void* Data, int64 Size, const IScenePropertyCodec& Codec, NS_SceneManagerData::FSceneData& OutSceneData, FString* OutError = nullptr);
+
+    /** Actor와 컴포넌트의 순서, 모든 문자열이 같은지 비교합니다. Property는 순서와 상관없이 비교합니다. */
+    static bool AreSceneDataEqual(const NS_SceneManagerData::FSceneData& A, const NS_SceneManagerData::FSceneData& B);
+};
@@ -1,108 +1,70 @@
 #include "SceneManager.h"
 #include <fstream>
 #include "EditorViewportClient.h"
+#include "SceneData.h"
 #include "Engine/FLoaderOBJ.h"
 #include "Engine/StaticMeshActor.h"
+#include "HAL/PlatformFile.h"
+#include "HAL/PlatformTime.h"
 #include "UObject/Casts.h"
+#include "UObject/Class.h"
 #include "UObject/Object.h"
 #include "UObject/ObjectFactory.h"
 #include "UObject/ObjectGlobals.h"
+#include "UObject/Property.h"
 
-#include "JSON/json.hpp"
 #include "World/World.h"
 
 using namespace NS_SceneManagerData;
-using json = nlohmann::json;
 
 
-#pragma region nlohmann::json function overload
-[[maybe_unused]]
-static void to_json(json& Json, const FString& S)
+namespace
 {
-    Json = S.GetContainerPrivate();
-}
-
-[[maybe_unused]]
-static void from_json(const json& Json, FString& S)
-{
-    if (Json.is_string())
+    /** UClass에 등록된 Property로 컴포넌트 값을 바이너리로 바꿉니다. 타입 번호는 EPropertyType 값입니다. */
+    class FClassPropertyCodec : public IScenePropertyCodec
     {
-        Json.get_to(S.GetContainerPrivate());
-    }
-}
-
+    public:
+        virtual uint8 FindPropertyType(const FString& ComponentClass, const FString& PropertyName) const override
+        {
+            const UClass* Class = UClass::FindClass(FName(ComponentClass));
+            const FProperty* Property = Class ? Class->FindPropertyByName(PropertyName) : nullptr;
+            return Property && FProperty::GetPlainOldDataProperty(Property->Type) ? static_cast<uint8>(Property->Type) : 0;
+        }
 
-template <typename ElementType, typename AllocatorType>
-[[maybe_unused]]
-static void to_json(json& Json, const TArray<ElementType, AllocatorType>& Array)
-{
-    Json = Array.GetContainerPrivate();
-}
+        virtual int32 GetValueSize(uint8 Type) const override
+        {
+            const FProperty* ValueProperty = GetValueProperty(Type);
+            return ValueProperty ? static_cast<int32>(ValueProperty->Size) : 0;
+        }
 
-template <typename ElementType, typename AllocatorType>
-[[maybe_unused]]
-static void from_json(const json& Json, TArray<ElementType, AllocatorType>& Array)
-{
-    Json.get_to(Array.GetContainerPrivate());
-}
+        virtual bool ImportText(uint8 Type, const FString& Text, void* OutValue) const override
+        {
+            const FProperty* ValueProperty = GetValueProperty(Type);
+            return ValueProperty && ValueProperty->ImportText(Text, OutValue);
+        }
 
+        virtual void ExportText(uint8 Type, const void* Value, FString& OutText) const override
+        {
+            if (const FProperty* ValueProperty = GetValueProperty(Type))
+            {
+                ValueProperty->ExportText(Value, OutText);
+            }
+        }
 
-template <typename KeyType, typename ValueType, typename Allocator>
-[[maybe_unused]]
-static void to_json(json& Json, const TMap<KeyType, ValueType, Allocator>& Map)
-{
-    Json = Map.GetContainerPrivate();
-}
+        virtual bool IsValidValue(uint8 Type, const void* Value) const override
+        {
+            return static_cast<EPropertyType>(Type) != EPropertyType::Bool || *static_cast<const uint8*>(Value) <= 1;
+        }
 
-template <typename KeyType, typename ValueType, typename Allocator>
-[[maybe_unused]]
-static void from_json(const json& Json, TMap<KeyType, ValueType, Allocator>& Map)
-{
-    Json.get_to(Map.GetContainerPrivate());
+    private:
+        static const FProperty* GetValueProperty(uint8 Type)
+        {
+            return FProperty::GetPlainOldDataProperty(static_cast<EPropertyType>(Type));
+        }
+    };
+    static_assert(sizeof(FLinearColor) <= IScenePropertyCodec::MaxValueSize && sizeof(FVector4) <= IScenePropertyCodec::MaxValueSize);
 }
-#pragma endregion
-
-namespace NS_SceneManagerData
-{
-// 컴포넌트 하나의 저장 정보를 담는 구조체
-struct FComponentSaveData
-{
-    FString ComponentID;    // 컴포넌트의 고유 ID (액터 내에서 유일해야 함, FName) 
-    FString ComponentClass; // 컴포넌트 클래스 이름 (예: "UStaticMeshComponent", "UPointLightComponent")
-
-    TMap<FString, FString> Properties;
-
-    NLOHMANN_DEFINE_TYPE_INTRUSIVE(FComponentSaveData, ComponentID, ComponentClass, Properties)
-};
-
-// 액터 하나의 저장 정보를 담는 구조체
-struct FActorSaveData
-{
-    FString ActorID;    // 액터의 고유 ID FName
-    FString ActorClass; // 액터의 클래스 이름 (예: "AStaticMeshActor", "APointLight")
-    FString ActorLabel; // 에디터에서 보이는 이름 (선택적)
-    // FTransform ActorTransform; // 액터 자체의 트랜스폼 (보통 루트 컴포넌트가 결정) - 필요 여부 검토
-
-    FString RootComponentID;               // 이 액터의 루트 컴포넌트 ID (아래 Components 리스트 내 ID 참조)
-    TArray<FComponentSaveData> Components; // 이 액터가 소유한 컴포넌트 목록
-
-    NLOHMANN_DEFINE_TYPE_INTRUSIVE(FActorSaveData, ActorID, ActorClass, ActorLabel, RootComponentID, Components)
-};
-
-struct FSceneData
-{
-    int32 Version = 0;
-    int32 NextUUID = 0;
-    //TMap<int32, UObject*> Primitives;
 
-    TArray<FActorSaveData> Actors; // 씬에 있는 모든 액터 정보
-    //TMap<int32, UObject*> Cameras;
-
-    NLOHMANN_DEFINE_TYPE_INTRUSIVE(FSceneData, Version, NextUUID, Actors)
-};
-
-//TODO : 레벨 데이타 구현
-}
 
 
 void SceneManager::LoadSceneFromJsonFile(const std::filesystem::path& FilePath, UWorld& OutWorld)
@@ -124,9 +86,11 @@ void SceneManager::LoadSceneFromJsonFile(const std::filesystem::path& FilePath,
     JsonFile.close();
 
     FSceneData SceneData;
-    bool Result = JsonToSceneData(JsonString,SceneData);
+    FString Error;
+    bool Result = FSceneDataSerializer::JsonToSceneData(JsonString, SceneData, &Error);
     if (!Result)
     {
+        UE_LOG(LogLevel::Error, "%s", *Error);
         UE_LOG(LogLevel::Error, "Failed to parse scene data from file: %s", FilePath.c_str());
         return ;
     }
@@ -146,41 +110,82 @@ bool SceneManager::SaveSceneToJsonFile(const std::filesystem::path& FilePath, co
     }
 
     FString JsonData;
-    SceneDataToJson(SceneData, JsonData);
+    FSceneDataSerializer::SceneDataToJson(SceneData, JsonData);
     outFile << JsonData.GetContainerPrivate();
     outFile.close();
 
     return true;
 }
 
-bool SceneManager::JsonToSceneData(const FString& InJsonString, FSceneData& OutSceneData)
+bool SceneManager::LoadSceneFromBinaryFile(const std::filesystem::path& FilePath, UWorld& OutWorld)
 {
-    try
+    FMappedFile File;
+    if (!File.Open(FilePath.wstring()))
     {
-        const json Json = json::parse(InJsonString.GetContainerPrivate()); // JSON 파일 읽기
-        OutSceneData = Json;
+        UE_LOG(LogLevel::Error, "Failed to open file for reading: %s", FilePath.string().c_str());
+        return false;
     }
-    catch (const std::exception& e)
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    FSceneData SceneData;
+    FString Error;
+    if (!FSceneDataSerializer::DeserializeFromBinary(File.GetData(), static_cast<int64>(File.GetSize()), FClassPropertyCodec(), SceneData, &Error))
     {
-        UE_LOG(LogLevel::Error, "Error parsing JSON: %s", e.what());
+        UE_LOG(LogLevel::Error, "%s", *Error);
+        UE_LOG(LogLevel::Error, "Failed to parse scene data from file: %s", FilePath.string().c_str());
         return false;
     }
-    return true;
+    File.Close();
+
+    const double ReadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    UE_LOG(LogLevel::Display, "Read %d actors from binary scene in %.2f ms", SceneData.Actors.Num(), ReadMs);
+
+    return LoadWorldFromData(SceneData, &OutWorld);
 }
 
-bool SceneManager::SceneDataToJson(const FSceneData& InSceneData, FString& OutJsonString)
+bool SceneManager::SaveSceneToBinaryFile(const std::filesystem::path& FilePath, const UWorld& InWorld)
 {
-    try
+    const FSceneData SceneData = WorldToSceneData(InWorld);
+
+    TArray<uint8> Data;
+    FSceneDataSerializer::SerializeToBinary(SceneData, FClassPropertyCodec(), Data);
+
+    std::ofstream OutFile(FilePath, std::ios::binary);
+    if (!OutFile)
     {
-        const json Json = InSceneData;
-        OutJsonString = Json.dump(4); // JSON 데이터를 문자열로 변솬 (4는 들여쓰기 공백 수)
+        UE_LOG(LogLevel::Error, "Failed to open file for writing: %s", FilePath.string().c_str());
+        return false;
     }
-    catch (const std::exception& e)
+    OutFile.write(reinterpret_cast<const char*>(Data.GetData()), Data.Num());
+    return OutFile.good();
+}
+
+void SceneManager::LoadSceneFromFile(const std::filesystem::path& FilePath, UWorld& OutWorld)
+{
+    uint32 Magic = 0;
     {
-        UE_LOG(LogLevel::Error, "Error parsing JSON: %s", e.what());
-        return false;
+        std::ifstream File(FilePath, std::ios::binary);
+        File.read(reinterpret_cast<char*>(&Magic), sizeof(Magic));
     }
-    return true;
+
+    if (Magic == FSceneDataSerializer::BinarySceneMagic)
+    {
+        LoadSceneFromBinaryFile(FilePath, OutWorld);
+    }
+    else
+    {
+        LoadSceneFromJsonFile(FilePath, OutWorld);
+    }
+}
+
+bool SceneManager::SaveSceneToFile(const std::filesystem::path& FilePath, const UWorld& InWorld)
+{
+    if (FilePath.extension() == BinarySceneExtension)
+    {
+        return SaveSceneToBinaryFile(FilePath, InWorld);
+    }
+    return SaveSceneToJsonFile(FilePath, InWorld);
 }
 
 FSceneData SceneManager::WorldToSceneData(const UWorld& InWorld)
@@ -2,6 +2,9 @@
 #include <filesystem>
 #include <string>
 
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
 class FString;
 class UWorld;
 
@@ -30,18 +33,25 @@ public:
      */
     static bool SaveSceneToJsonFile(const std::filesystem::path& FilePath, const UWorld& InWorld);
 
-private:
     /**
-     * JSON 문자열을 역직렬화하여 FSceneData를 생성합니다.
-     *
-     * @param InJsonString 역직렬화할 JSON 문자열
-     * @param OutSceneData 역직렬화된 FSceneData 객체
-     * @return 성공 여부
+     * 바이너리 형식으로 저장된 World파일을 불러옵니다.
+     * Actor들은 Worker Thread에서 나눠 읽은 뒤, 메인 스레드에서 Spawn하고 부착합니다.
+     * @return 성공적으로 불러왔는지 여부
      */
-    static bool JsonToSceneData(const FString& InJsonString, NS_SceneManagerData::FSceneData& OutSceneData);
+    static bool LoadSceneFromBinaryFile(const std::filesystem::path& FilePath, UWorld& OutWorld);
+
+    /** World를 바이너리 형식으로 저장합니다. */
+    static bool SaveSceneToBinaryFile(const std::filesystem::path& FilePath, const UWorld& InWorld);
+
+    /** 파일 앞부분을 보고 바이너리 또는 Json 형식으로 World를 불러옵니다. */
+    static void LoadSceneFromFile(const std::filesystem::path& FilePath, UWorld& OutWorld);
 
-    static bool SceneDataToJson(const NS_SceneManagerData::FSceneData& InSceneData, FString& OutJsonString);
+    /** 확장자가 BinarySceneExtension이면 바이너리, 아니면 Json 형식으로 저장합니다. */
+    static bool SaveSceneToFile(const std::filesystem::path& FilePath, const UWorld& InWorld);
 
+    static constexpr const char* BinarySceneExtension = ".scenebin";
+
+private:
     /**
      * World를 FSceneData로 직렬화합니다.
      *
@@ -52,14 +62,4 @@ private:
 
     
     static bool LoadWorldFromData(const NS_SceneManagerData::FSceneData& sceneData, UWorld* targetWorld);
-
-private:
-    // TODO: IFileManager::Get().CreateFileReader() & Writer() 만들면 여기에 추가
-    // static void DeserializeFromBinary(const void* Data, int64 Size, NS_SceneManagerData::FSceneData& OutSceneData);
-    // or 중간 구조체 사용 안할경우
-    // static UWorld* DeserializeFromBinary(const void* Data, int64 Size);
-
-    // static TArray<uint8> SerializeToBinary(const NS_SceneManagerData::FSceneData& SceneData);
-    // or 중간 구조체 사용 안할경우
-    // static TArray<uint8> SerializeToBinary(UWorld* World);
-};
+};
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "JobSystem.h"
+#include "Stats/Stats.h"
+
+#include "Math/MathUtility.h"
+
+FJobSystem& FJobSystem::Get()
+{
+    static FJobSystem Instance;
+    return Instance;
+}
+
+FJobSystem::FJobSystem()
+{
+    // 메인 스레드 몫으로 코어 하나를 남겨둡니다.
+    const int32 NumWorkers = FMath::Max(static_cast<int32>(std::thread::hardware_concurrency()) - 1, 1);
+    for (int32 i = 0; i < NumWorkers; i++)
+    {
+        Workers.Emplace(&FJobSystem::WorkerMain, this);
+    }
+}
+
+FJobSystem::~FJobSystem()
+{
+    Shutdown();
+}
+
+void FJobSystem::Shutdown()
+{
+    {
+        std::lock_guard Lock(JobMutex);
+        bShuttingDown = true;
+    }
+    JobCondition.notify_all();
+
+    for (std::thread& Worker : Workers)
+    {
+        if (Worker.joinable())
+        {
+            Worker.join();
+        }
+    }
+    Workers.Empty();
+}
+
+void FJobSystem::Dispatch(FJob Job)
+{
+    {
+        std::lock_guard Lock(JobMutex);
+        PendingJobs.Add(std::move(Job));
+    }
+    JobCondition.notify_one();
+}
+
+void FJobSystem::EnqueueMainThread(FJob Task)
+{
+    {
+        std::lock_guard Lock(MainThreadMutex);
+        MainThreadTasks.Add(std::move(Task));
+    }
+    MainThreadCondition.notify_one();
+}
+
+int32 FJobSystem::ProcessMainThreadTasks()
+{
+    TArray<FJob> Tasks;
+    {
+        std::lock_guard Lock(MainThreadMutex);
+        Tasks = std::move(MainThreadTasks);
+        MainThreadTasks.Empty();
+    }
+
+    for (FJob& Task : Tasks)
+    {
+        Task();
+    }
+    return Tasks.Num();
+}
+
+void FJobSystem::WaitForMainThreadTasks()
+{
+    std::unique_lock Lock(MainThreadMutex);
+    MainThreadCondition.wait(Lock, [this] { return !MainThreadTasks.IsEmpty(); });
+}
+
+void FJobSystem::WorkerMain()
+{
+    while (true)
+    {
+        FJob Job;
+        {
+            std::unique_lock Lock(JobMutex);
+            JobCondition.wait(Lock, [this] { return bShuttingDown || NextJob < PendingJobs.Num(); });
+            if (bShuttingDown)
+            {
+                return;
+            }
+
+            // 들어온 순서대로 꺼내고, 큐가 비면 한 번에 정리합니다.
+            Job = std::move(PendingJobs[NextJob++]);
+            if (NextJob == PendingJobs.Num())
+            {
+                PendingJobs.Empty();
+                NextJob = 0;
+            }
+        }
+
+        QUICK_SCOPE_CYCLE_COUNTER(JobSystem_Job);
+        Job();
+    }
+}
@@ -0,0 +1,138 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Math/MathUtility.h"
+
+/**
+ * Worker Thread Pool과 메인 스레드 완료 큐.
+ * 파일 읽기, 파싱처럼 엔진 상태를 건드리지 않는 작업은 Dispatch로 Worker에서 실행하고,
+ * UObject 생성이나 GPU 리소스 등록처럼 메인 스레드에서만 해야 하는 작업은 EnqueueMainThread로 넘깁니다.
+ */
+class FJobSystem
+{
+public:
+    using FJob = std::function<void()>;
+
+    static FJobSystem& Get();
+
+    FJobSystem(const FJobSystem&) = delete;
+    FJobSystem& operator=(const FJobSystem&) = delete;
+
+    /** Worker Thread를 모두 종료합니다. 남아 있는 Job은 실행하지 않습니다. */
+    void Shutdown();
+
+    int32 GetNumWorkers() const { return Workers.Num(); }
+
+    /** ParallelFor에 참여할 수 있는 최대 스레드 수 (Worker + 호출한 스레드) */
+    int32 GetMaxConcurrency() const { return Workers.Num() + 1; }
+
+    /** Job을 Worker Thread에서 실행합니다. */
+    void Dispatch(FJob Job);
+
+    /**
+     * [0, Num)을 MinBatchSize 이상의 묶음으로 나눠서, 호출한 스레드와 Worker Thread가 남은 묶음을 하나씩 가져가 실행합니다.
+     * 모든 묶음이 끝나야 반환합니다. 호출한 스레드도 묶음을 실행하므로 Worker Thread의 Job 안에서 호출해도 멈추지 않습니다.
+     *
+     * @param Body void(int32 Begin, int32 End, int32 ThreadIndex), ThreadIndex는 호출한 스레드가 0이고 Worker는 1부터 MaxConcurrency - 1까지입니다.
+     * @param MaxConcurrency 참여할 최대 스레드 수, 0 이하이면 GetMaxConcurrency()
+     */
+    template <typename FuncType>
+    void ParallelFor(int32 Num, int32 MinBatchSize, FuncType&& Body, int32 MaxConcurrency = 0);
+
+    /** 메인 스레드에서 실행할 작업을 추가합니다. 어느 스레드에서나 호출할 수 있습니다. */
+    void EnqueueMainThread(FJob Task);
+
+    /**
+     * 메인 스레드 큐에 쌓인 작업을 실행합니다. 메인 스레드에서만 호출합니다.
+     * @return 실행한 작업의 수
+     */
+    int32 ProcessMainThreadTasks();
+
+    /** 메인 스레드 큐에 작업이 들어올 때까지 기다립니다. */
+    void WaitForMainThreadTasks();
+
+private:
+    FJobSystem();
+    ~FJobSystem();
+
+    void WorkerMain();
+
+private:
+    TArray<std::thread> Workers;
+
+    std::mutex JobMutex;
+    std::condition_variable JobCondition;
+    TArray<FJob> PendingJobs;
+    int32 NextJob = 0;
+    bool bShuttingDown = false;
+
+    std::mutex MainThreadMutex;
+    std::condition_variable MainThreadCondition;
+    TArray<FJob> MainThreadTasks;
+};
+
+template <typename FuncType>
+void FJobSystem::ParallelFor(int32 Num, int32 MinBatchSize, FuncType&& Body, int32 MaxConcurrency)
+{
+    if (Num <= 0)
+    {
+        return;
+    }
+
+    const int32 NumThreads = MaxConcurrency > 0 ? FMath::Min(MaxConcurrency, GetMaxConcurrency()) : GetMaxConcurrency();
+
+    // 스레드마다 여러 묶음이 돌아가도록 잘게 나눠서, 먼저 끝난 스레드가 남은 묶음을 가져가게 합니다.
+    const int32 BatchSize = FMath::Max(FMath::Max(MinBatchSize, 1), Num / (NumThreads * 8));
+    const int32 NumBatches = (Num + BatchSize - 1) / BatchSize;
+    if (NumThreads <= 1 || NumBatches <= 1)
+    {
+        Body(0, Num, 0);
+        return;
+    }
+
+    struct FParallelForState
+    {
+        std::atomic<int32> NextBatch = 0;
+        std::atomic<int32> NextThreadIndex = 1;
+
+        /** 묶음을 가져가려고 하거나 실행 중인 Worker 수 */
+        std::atomic<int32> NumActiveWorkers = 0;
+    };
+    const std::shared_ptr<FParallelForState> State = std::make_shared<FParallelForState>();
+
+    auto RunBatches = [&State = *State, &Body, Num, BatchSize, NumBatches](int32 ThreadIndex)
+    {
+        for (int32 Batch = State.NextBatch.fetch_add(1); Batch < NumBatches; Batch = State.NextBatch.fetch_add(1))
+        {
+            const int32 Begin = Batch * BatchSize;
+            Body(Begin, FMath::Min(Begin + BatchSize, Num), ThreadIndex);
+        }
+    };
+
+    const int32 NumHelpers = FMath::Min(NumThreads - 1, NumBatches - 1);
+    for (int32 Helper = 0; Helper < NumHelpers; ++Helper)
+    {
+        Dispatch([State, RunBatches]
+        {
+            // 늦게 시작한 Worker는 묶음을 가져가지 못하고 끝나므로, 호출한 스레드가 먼저 반환해도 Body를 건드리지 않습니다.
+            State->NumActiveWorkers.fetch_add(1);
+            RunBatches(State->NextThreadIndex.fetch_add(1));
+            State->NumActiveWorkers.fetch_sub(1);
+        });
+    }
+
+    RunBatches(0);
+
+    // 모든 묶음을 가져갔으므로, 아직 실행 중인 Worker만 기다리면 됩니다.
+    while (State->NumActiveWorkers.load() > 0)
+    {
+        std::this_thread::yield();
+    }
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include <algorithm>
+#include <cassert>
 #include <utility>
 #include <vector>
 
@@ -64,6 +65,10 @@ public:
 	template <typename... Args>
     SizeType Emplace(Args&&... Item);
 
+	/** Source의 모든 요소를 뒤에 추가합니다. */
+    void Append(const TArray& Source);
+    void Append(TArray&& Source);
+
     /** Array가 비어있는지 확인합니다. */
     bool IsEmpty() const;
 
@@ -79,6 +84,12 @@ public:
 	/** 특정 위치에 있는 요소를 제거합니다. */
     void RemoveAt(SizeType Index);
 
+	/** 특정 위치에 있는 요소를 마지막 요소와 바꾼 뒤 제거합니다. 순서는 유지되지 않습니다. */
+    void RemoveAtSwap(SizeType Index);
+
+	/** 마지막 요소를 제거하고 반환합니다. */
+    T Pop();
+
 	/** Predicate에 부합하는 모든 요소를 제거합니다. */
     template <typename Predicate>
         requires std::is_invocable_r_v<bool, Predicate, const T&>
@@ -144,6 +155,23 @@ void TArray<T, Allocator>::operator+(const TArray& OtherArray)
 	ContainerPrivate.insert(end(), OtherArray.begin(), OtherArray.end());
 }
 
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::Append(const TArray& Source)
+{
+    ContainerPrivate.insert(ContainerPrivate.end(), Source.ContainerPrivate.begin(), Source.ContainerPrivate.end());
+}
+
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::Append(TArray&& Source)
+{
+    ContainerPrivate.insert(
+        ContainerPrivate.end(),
+        std::make_move_iterator(Source.ContainerPrivate.begin()),
+        std::make_move_iterator(Source.ContainerPrivate.end())
+    );
+    Source.ContainerPrivate.clear();
+}
+
 template <typename T, typename Allocator>
 TArray<T, Allocator>::TArray()
     : ContainerPrivate()
@@ -265,6 +293,28 @@ void TArray<T, Allocator>::RemoveAt(SizeType Index)
     }
 }
 
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::RemoveAtSwap(SizeType Index)
+{
+    if (Index >= 0 && static_cast<SizeType>(Index) < ContainerPrivate.size())
+    {
+        if (static_cast<SizeType>(Index) != ContainerPrivate.size() - 1)
+        {
+            ContainerPrivate[Index] = std::move(ContainerPrivate.back());
+        }
+        ContainerPrivate.pop_back();
+    }
+}
+
+template <typename T, typename Allocator>
+T TArray<T, Allocator>::Pop()
+{
+    assert(!ContainerPrivate.empty());
+    T Result = std::move(ContainerPrivate.back());
+    ContainerPrivate.pop_back();
+    return Result;
+}
+
 template <typename T, typename Allocator>
 template <typename Predicate>
     requires std::is_invocable_r_v<bool, Predicate, const T&>
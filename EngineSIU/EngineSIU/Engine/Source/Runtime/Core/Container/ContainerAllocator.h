@@ -91,5 +91,12 @@ constexpr void TContainerAllocator<T, IndexSize>::deallocate(T* p, size_type n)
     FPlatformMemory::Free<EAT_Container>(p, AllocSize);
 }
 
+/** 상태가 없으므로 모든 Allocator가 같습니다. (libstdc++는 컨테이너를 복사하거나 교환할 때 비교합니다) */
+template <typename T, typename U, int IndexSize>
+constexpr bool operator==(const TContainerAllocator<T, IndexSize>&, const TContainerAllocator<U, IndexSize>&) noexcept
+{
+    return true;
+}
+
 template <typename T> using FDefaultAllocator = TContainerAllocator<T, 32>;
 template <typename T> using FDefaultAllocator64 = TContainerAllocator<T, 64>;
@@ -0,0 +1,788 @@
+﻿#pragma once
+#include <bit>
+#include <cstring>
+#include <emmintrin.h>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "ContainerAllocator.h"
+
+
+/**
+ * 1이면 TMap/TSet이 TFlatHashMap/TFlatHashSet을, 0이면 std::unordered_map/unordered_set을 사용합니다.
+ * 프로젝트 설정의 전처리기 정의에서 USE_FLAT_HASH_CONTAINERS=0을 주면 이전 구현으로 돌아갑니다.
+ */
+#ifndef USE_FLAT_HASH_CONTAINERS
+    #define USE_FLAT_HASH_CONTAINERS 1
+#endif
+
+
+namespace FlatHash
+{
+    /**
+     * 슬롯마다 하나씩 있는 제어 바이트.
+     * 최상위 비트가 0이면 채워진 슬롯이고, 나머지 7비트에 해시의 하위 7비트(H2)가 들어갑니다.
+     */
+    enum ECtrl : int8
+    {
+        Empty = -128,   // 0b10000000
+        Deleted = -2,   // 0b11111110
+    };
+
+    /** 한 번에 비교하는 제어 바이트 수 (SSE2 레지스터 하나) */
+    inline constexpr uint32 GroupWidth = 16;
+
+    /** 그룹을 어디서 읽어도 배열 밖으로 나가지 않도록, 앞쪽 GroupWidth - 1개의 제어 바이트를 배열 끝에 복사해 둡니다. */
+    inline constexpr uint32 NumClonedBytes = GroupWidth - 1;
+
+    /** 채워진 슬롯이 7/8을 넘으면 테이블을 키웁니다. */
+    constexpr uint32 CapacityToGrowth(uint32 Capacity)
+    {
+        return Capacity - Capacity / 8;
+    }
+
+    /** Hasher의 결과를 섞어서, 하위 비트만 다른 포인터 같은 값도 H1과 H2에 고르게 퍼지게 합니다. */
+    FORCEINLINE uint64 MixHash(size_t Hash)
+    {
+        const uint64 Mixed = static_cast<uint64>(Hash) * 0x9E3779B97F4A7C15ull;
+        return Mixed ^ (Mixed >> 32);
+    }
+
+    /** 슬롯 위치를 정하는 해시 */
+    FORCEINLINE uint64 H1(uint64 Hash) { return Hash >> 7; }
+
+    /** 제어 바이트에 저장하는 해시 */
+    FORCEINLINE int8 H2(uint64 Hash) { return static_cast<int8>(Hash & 0x7F); }
+
+    /** 제어 바이트 16개를 한 번에 비교합니다. 각 함수는 조건에 맞는 바이트의 비트를 세운 마스크를 반환합니다. */
+    struct FGroup
+    {
+        explicit FGroup(const int8* Ctrl)
+            : Bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Ctrl)))
+        {
+        }
+
+        FORCEINLINE uint32 Match(int8 Hash) const
+        {
+            return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(Hash), Bytes)));
+        }
+
+        FORCEINLINE uint32 MatchEmpty() const
+        {
+            return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(Empty), Bytes)));
+        }
+
+        /** Empty와 Deleted는 최상위 비트가 1입니다. */
+        FORCEINLINE uint32 MatchEmptyOrDeleted() const
+        {
+            return static_cast<uint32>(_mm_movemask_epi8(Bytes));
+        }
+
+        FORCEINLINE uint32 MatchFull() const
+        {
+            return ~static_cast<uint32>(_mm_movemask_epi8(Bytes)) & 0xFFFF;
+        }
+
+        __m128i Bytes;
+    };
+
+    /** 비어있는 테이블이 가리키는 제어 바이트. 할당 없이도 검색이 바로 끝나도록 모두 Empty입니다. */
+    alignas(16) inline constexpr int8 EmptyGroup[GroupWidth] = {
+        Empty, Empty, Empty, Empty, Empty, Empty, Empty, Empty,
+        Empty, Empty, Empty, Empty, Empty, Empty, Empty, Empty,
+    };
+
+    template <typename T>
+    struct TSetPolicy
+    {
+        using KeyType = T;
+        using ElementType = T;
+
+        static const KeyType& GetKey(const ElementType& Element) { return Element; }
+
+        static void Relocate(ElementType* Dest, ElementType* Src)
+        {
+            ::new (Dest) ElementType(std::move(*Src));
+            Src->~ElementType();
+        }
+    };
+
+    template <typename K, typename V>
+    struct TMapPolicy
+    {
+        using KeyType = K;
+        using ElementType = std::pair<const K, V>;
+
+        static const KeyType& GetKey(const ElementType& Element) { return Element.first; }
+
+        /** 옮긴 뒤 바로 소멸시키므로, const인 Key도 복사하지 않고 이동합니다. */
+        static void Relocate(ElementType* Dest, ElementType* Src)
+        {
+            ::new (Dest) ElementType(std::move(const_cast<K&>(Src->first)), std::move(Src->second));
+            Src->~ElementType();
+        }
+    };
+}
+
+
+/**
+ * 개방 주소법 해시 테이블 (Swiss table).
+ *
+ * 요소는 노드 없이 슬롯 배열에 바로 저장하고, 슬롯마다 1바이트의 제어 바이트에 해시 7비트를 둡니다.
+ * 검색할 때는 제어 바이트 16개를 SSE2로 한 번에 비교해서 H2가 같은 슬롯의 Key만 비교합니다.
+ *
+ * std::unordered_map/unordered_set과 같은 이름의 함수를 제공해서 TMap/TSet이 내부 컨테이너 타입만 바꿔 쓸 수 있습니다.
+ * 다만 std::unordered_map과 달리 삽입으로 테이블이 커지면 요소의 주소가 바뀌므로, Find로 얻은 포인터를 들고 있는 동안 삽입하면 안 됩니다.
+ * 제거는 요소를 옮기지 않으므로 순회 중에 현재 요소를 지워도 됩니다.
+ */
+template <typename Policy, typename Hasher, typename KeyEqual, typename Allocator>
+class TFlatHashTable
+{
+public:
+    using key_type = typename Policy::KeyType;
+    using value_type = typename Policy::ElementType;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using hasher = Hasher;
+    using key_equal = KeyEqual;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+private:
+    using KeyType = key_type;
+    using ElementType = value_type;
+
+    /** 요소 하나를 담는 초기화되지 않은 공간 */
+    struct alignas(ElementType) FSlot
+    {
+        uint8 Bytes[sizeof(ElementType)];
+    };
+
+    using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<FSlot>;
+
+    template <bool bConst>
+    class TIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename Policy::ElementType;
+        using difference_type = ptrdiff_t;
+        using pointer = std::conditional_t<bConst, const value_type*, value_type*>;
+        using reference = std::conditional_t<bConst, const value_type&, value_type&>;
+
+        TIterator() = default;
+
+        /** iterator에서 const_iterator로 변환 */
+        template <bool bOtherConst>
+            requires (bConst && !bOtherConst)
+        TIterator(const TIterator<bOtherConst>& Other)
+            : Ctrl(Other.Ctrl), Slots(Other.Slots), Index(Other.Index), Capacity(Other.Capacity)
+        {
+        }
+
+        reference operator*() const { return *GetElement(); }
+        pointer operator->() const { return GetElement(); }
+
+        TIterator& operator++()
+        {
+            ++Index;
+            SkipEmptySlots();
+            return *this;
+        }
+
+        TIterator operator++(int)
+        {
+            TIterator Temp = *this;
+            ++*this;
+            return Temp;
+        }
+
+        bool operator==(const TIterator& Other) const { return Index == Other.Index; }
+        bool operator!=(const TIterator& Other) const { return Index != Other.Index; }
+
+        /** 슬롯 배열에서의 위치. 테이블이 다시 만들어지기 전까지 유지됩니다. */
+        uint32 GetIndex() const { return Index; }
+
+    private:
+        friend class TFlatHashTable;
+
+        TIterator(const int8* InCtrl, FSlot* InSlots, uint32 InIndex, uint32 InCapacity)
+            : Ctrl(InCtrl), Slots(InSlots), Index(InIndex), Capacity(InCapacity)
+        {
+        }
+
+        pointer GetElement() const
+        {
+            return reinterpret_cast<pointer>(&Slots[Index]);
+        }
+
+        void SkipEmptySlots()
+        {
+            while (Index < Capacity)
+            {
+                // 복사해 둔 제어 바이트 때문에 Capacity를 넘는 위치가 나올 수 있으며, 그때는 끝입니다.
+                if (const uint32 FullMask = FlatHash::FGroup(Ctrl + Index).MatchFull())
+                {
+                    Index += static_cast<uint32>(std::countr_zero(FullMask));
+                    if (Index >= Capacity)
+                    {
+                        Index = Capacity;
+                    }
+                    return;
+                }
+                Index += FlatHash::GroupWidth;
+            }
+            Index = Capacity;
+        }
+
+        const int8* Ctrl = nullptr;
+        FSlot* Slots = nullptr;
+        uint32 Index = 0;
+        uint32 Capacity = 0;
+
+        template <bool>
+        friend class TIterator;
+    };
+
+public:
+    using iterator = TIterator<false>;
+    using const_iterator = TIterator<true>;
+
+    TFlatHashTable() = default;
+
+    TFlatHashTable(const TFlatHashTable& Other)
+    {
+        CopyFrom(Other);
+    }
+
+    TFlatHashTable(TFlatHashTable&& Other) noexcept
+    {
+        StealFrom(Other);
+    }
+
+    TFlatHashTable& operator=(const TFlatHashTable& Other)
+    {
+        if (this != &Other)
+        {
+            DestroyAndFree();
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+
+    TFlatHashTable& operator=(TFlatHashTable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            DestroyAndFree();
+            StealFrom(Other);
+        }
+        return *this;
+    }
+
+    ~TFlatHashTable()
+    {
+        DestroyAndFree();
+    }
+
+    iterator begin() noexcept
+    {
+        iterator It(Ctrl, Slots, 0, Capacity);
+        It.SkipEmptySlots();
+        return It;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        const_iterator It(Ctrl, Slots, 0, Capacity);
+        It.SkipEmptySlots();
+        return It;
+    }
+
+    iterator end() noexcept { return iterator(Ctrl, Slots, Capacity, Capacity); }
+    const_iterator end() const noexcept { return const_iterator(Ctrl, Slots, Capacity, Capacity); }
+
+    size_type size() const noexcept { return Size; }
+    bool empty() const noexcept { return Size == 0; }
+
+    /** 슬롯 수. 항상 0이거나 GroupWidth 이상의 2의 거듭제곱입니다. */
+    size_type capacity() const noexcept { return Capacity; }
+
+    iterator find(const KeyType& Key)
+    {
+        const uint32 Index = FindIndex(Key);
+        return Index != InvalidIndex ? iterator(Ctrl, Slots, Index, Capacity) : end();
+    }
+
+    const_iterator find(const KeyType& Key) const
+    {
+        const uint32 Index = FindIndex(Key);
+        return Index != InvalidIndex ? const_iterator(Ctrl, Slots, Index, Capacity) : end();
+    }
+
+    bool contains(const KeyType& Key) const
+    {
+        return FindIndex(Key) != InvalidIndex;
+    }
+
+    /** Key가 없을 때만 Args로 요소를 만들어 넣습니다. */
+    template <typename... ArgsType>
+    std::pair<iterator, bool> emplace_key(const KeyType& Key, ArgsType&&... Args)
+    {
+        const uint64 Hash = FlatHash::MixHash(Hasher{}(Key));
+        const uint32 Found = FindIndex(Key, Hash);
+        if (Found != InvalidIndex)
+        {
+            return { iterator(Ctrl, Slots, Found, Capacity), false };
+        }
+
+        uint32 Index = FindFirstNonFull(Hash);
+        if (NeedsGrowthToInsert(Index))
+        {
+            // Key와 Args가 이 테이블의 요소를 가리킬 수 있는데 (Map[Map.begin()->second] 등), Resize는 요소를 옮깁니다.
+            // 그래서 키우기 전에 요소를 먼저 만들어 두고, 새 슬롯으로 옮깁니다.
+            FSlot Pending;
+            ElementType* Element = ::new (&Pending) ElementType(std::forward<ArgsType>(Args)...);
+            RehashAndGrowIfNecessary();
+            Index = CommitInsert(FindFirstNonFull(Hash), Hash);
+            Policy::Relocate(GetElement(Index), Element);
+            return { iterator(Ctrl, Slots, Index, Capacity), true };
+        }
+
+        Index = CommitInsert(Index, Hash);
+        ::new (&Slots[Index]) ElementType(std::forward<ArgsType>(Args)...);
+        return { iterator(Ctrl, Slots, Index, Capacity), true };
+    }
+
+    size_type erase(const KeyType& Key)
+    {
+        const uint32 Index = FindIndex(Key);
+        if (Index == InvalidIndex)
+        {
+            return 0;
+        }
+        EraseAt(Index);
+        return 1;
+    }
+
+    iterator erase(const_iterator Position)
+    {
+        EraseAt(Position.Index);
+        iterator Next(Ctrl, Slots, Position.Index + 1, Capacity);
+        Next.SkipEmptySlots();
+        return Next;
+    }
+
+    /** 요소를 모두 소멸시키지만, std::unordered_map처럼 할당한 슬롯은 남겨 둡니다. */
+    void clear() noexcept
+    {
+        if (Capacity == 0)
+        {
+            return;
+        }
+        DestroyElements();
+        ResetCtrl();
+    }
+
+    /** Count개를 더 키우지 않고 넣을 수 있도록 슬롯을 확보합니다. */
+    void reserve(size_type Count)
+    {
+        if (Count > Size + GrowthLeft)
+        {
+            Resize(CapacityForCount(Count));
+        }
+    }
+
+protected:
+    static constexpr uint32 InvalidIndex = ~0u;
+
+    uint32 FindIndex(const KeyType& Key) const
+    {
+        return FindIndex(Key, FlatHash::MixHash(Hasher{}(Key)));
+    }
+
+    uint32 FindIndex(const KeyType& Key, uint64 Hash) const
+    {
+        if (Capacity == 0)
+        {
+            return InvalidIndex;
+        }
+
+        const int8 Hash2 = FlatHash::H2(Hash);
+        const uint32 Mask = Capacity - 1;
+        uint32 Position = static_cast<uint32>(FlatHash::H1(Hash)) & Mask;
+        uint32 Step = 0;
+        while (true)
+        {
+            const FlatHash::FGroup Group(Ctrl + Position);
+            for (uint32 Matches = Group.Match(Hash2); Matches; Matches &= Matches - 1)
+            {
+                const uint32 Index = (Position + std::countr_zero(Matches)) & Mask;
+                if (KeyEqual{}(Policy::GetKey(*GetElement(Index)), Key))
+                {
+                    return Index;
+                }
+            }
+
+            // 빈 슬롯이 있는 그룹까지 왔다면, Key가 있었다면 이미 지나친 곳에 들어갔을 것입니다.
+            if (Group.MatchEmpty())
+            {
+                return InvalidIndex;
+            }
+
+            // 그룹 단위 삼각수 탐사. 슬롯 수가 2의 거듭제곱이므로 모든 그룹을 한 번씩 지납니다.
+            Step += FlatHash::GroupWidth;
+            Position = (Position + Step) & Mask;
+        }
+    }
+
+private:
+    ElementType* GetElement(uint32 Index) const
+    {
+        return reinterpret_cast<ElementType*>(&Slots[Index]);
+    }
+
+    /** FindFirstNonFull로 찾은 Index에 넣으려면 먼저 테이블을 키워야 하는지 확인합니다. */
+    bool NeedsGrowthToInsert(uint32 Index) const
+    {
+        // Deleted 자리를 다시 쓰는 것은 탐사 길이를 늘리지 않으므로 GrowthLeft를 쓰지 않습니다.
+        return GrowthLeft == 0 && Ctrl[Index] != FlatHash::Deleted;
+    }
+
+    /** FindFirstNonFull로 찾은 빈 슬롯의 제어 바이트를 채우고 위치를 반환합니다. 요소는 호출한 쪽에서 만듭니다. */
+    uint32 CommitInsert(uint32 Index, uint64 Hash)
+    {
+        if (Ctrl[Index] == FlatHash::Empty)
+        {
+            --GrowthLeft;
+        }
+        SetCtrl(Index, FlatHash::H2(Hash));
+        ++Size;
+        return Index;
+    }
+
+    uint32 FindFirstNonFull(uint64 Hash) const
+    {
+        if (Capacity == 0)
+        {
+            return 0;
+        }
+
+        const uint32 Mask = Capacity - 1;
+        uint32 Position = static_cast<uint32>(FlatHash::H1(Hash)) & Mask;
+        uint32 Step = 0;
+        while (true)
+        {
+            if (const uint32 Candidates = FlatHash::FGroup(Ctrl + Position).MatchEmptyOrDeleted())
+            {
+                return (Position + std::countr_zero(Candidates)) & Mask;
+            }
+            Step += FlatHash::GroupWidth;
+            Position = (Position + Step) & Mask;
+        }
+    }
+
+    void RehashAndGrowIfNecessary()
+    {
+        // Deleted가 많아서 찬 것이라면 같은 크기로 다시 만들어 Deleted만 치웁니다.
+        if (Capacity > FlatHash::GroupWidth && Size * 32ull <= Capacity * 25ull)
+        {
+            Resize(Capacity);
+        }
+        else
+        {
+            Resize(Capacity == 0 ? FlatHash::GroupWidth : Capacity * 2);
+        }
+    }
+
+    static uint32 CapacityForCount(size_type Count)
+    {
+        uint32 NewCapacity = FlatHash::GroupWidth;
+        while (FlatHash::CapacityToGrowth(NewCapacity) < Count)
+        {
+            NewCapacity *= 2;
+        }
+        return NewCapacity;
+    }
+
+    void EraseAt(uint32 Index)
+    {
+        GetElement(Index)->~ElementType();
+        --Size;
+
+        // 이 슬롯을 지나는 탐사가 있을 수 없다면 (앞뒤로 빈 슬롯 사이의 거리가 그룹 하나보다 짧으면) Empty로 되돌립니다.
+        const uint32 IndexBefore = (Index - FlatHash::GroupWidth) & (Capacity - 1);
+        const uint32 EmptyAfter = FlatHash::FGroup(Ctrl + Index).MatchEmpty();
+        const uint32 EmptyBefore = FlatHash::FGroup(Ctrl + IndexBefore).MatchEmpty();
+        const bool bWasNeverFull = EmptyBefore && EmptyAfter &&
+            static_cast<uint32>(std::countr_zero(EmptyAfter)) + static_cast<uint32>(std::countl_zero(EmptyBefore << 16)) < FlatHash::GroupWidth;
+
+        if (bWasNeverFull)
+        {
+            SetCtrl(Index, FlatHash::Empty);
+            ++GrowthLeft;
+        }
+        else
+        {
+            SetCtrl(Index, FlatHash::Deleted);
+        }
+    }
+
+    void SetCtrl(uint32 Index, int8 Value)
+    {
+        Ctrl[Index] = Value;
+        if (Index < FlatHash::NumClonedBytes)
+        {
+            Ctrl[Capacity + Index] = Value;
+        }
+    }
+
+    void ResetCtrl()
+    {
+        // 빈 테이블의 Ctrl은 공용 EmptyGroup이라 덮어쓰면 안 됩니다.
+        if (Capacity > 0)
+        {
+            std::memset(Ctrl, FlatHash::Empty, GetNumCtrlBytes(Capacity));
+        }
+        Size = 0;
+        GrowthLeft = FlatHash::CapacityToGrowth(Capacity);
+    }
+
+    /** 끝에 복사해 둔 바이트를 포함한 제어 바이트 수 */
+    static size_t GetNumCtrlBytes(uint32 InCapacity)
+    {
+        return static_cast<size_t>(InCapacity) + FlatHash::NumClonedBytes;
+    }
+
+    /** 슬롯과 제어 바이트를 한 번에 할당할 때 필요한 FSlot 수 */
+    static size_t GetAllocationSlots(uint32 InCapacity)
+    {
+        return InCapacity + (GetNumCtrlBytes(InCapacity) + sizeof(FSlot) - 1) / sizeof(FSlot);
+    }
+
+    void Resize(uint32 NewCapacity)
+    {
+        int8* OldCtrl = Ctrl;
+        FSlot* OldSlots = Slots;
+        const uint32 OldCapacity = Capacity;
+        const uint32 OldSize = Size;
+
+        SlotAllocator Alloc;
+        Slots = Alloc.allocate(static_cast<typename std::allocator_traits<SlotAllocator>::size_type>(GetAllocationSlots(NewCapacity)));
+        Ctrl = reinterpret_cast<int8*>(Slots + NewCapacity);
+        Capacity = NewCapacity;
+        ResetCtrl();
+
+        for (uint32 Index = 0; Index < OldCapacity; ++Index)
+        {
+            if (OldCtrl[Index] >= 0)
+            {
+                ElementType* OldElement = reinterpret_cast<ElementType*>(&OldSlots[Index]);
+                const uint64 Hash = FlatHash::MixHash(Hasher{}(Policy::GetKey(*OldElement)));
+                const uint32 NewIndex = FindFirstNonFull(Hash);
+                SetCtrl(NewIndex, FlatHash::H2(Hash));
+                Policy::Relocate(GetElement(NewIndex), OldElement);
+            }
+        }
+
+        Size = OldSize;
+        GrowthLeft = FlatHash::CapacityToGrowth(Capacity) - OldSize;
+
+        if (OldCapacity > 0)
+        {
+            Alloc.deallocate(OldSlots, static_cast<typename std::allocator_traits<SlotAllocator>::size_type>(GetAllocationSlots(OldCapacity)));
+        }
+    }
+
+    void DestroyElements()
+    {
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+            for (uint32 Index = 0; Index < Capacity; ++Index)
+            {
+                if (Ctrl[Index] >= 0)
+                {
+                    GetElement(Index)->~ElementType();
+                }
+            }
+        }
+    }
+
+    void DestroyAndFree()
+    {
+        if (Capacity == 0)
+        {
+            return;
+        }
+
+        DestroyElements();
+        SlotAllocator Alloc;
+        Alloc.deallocate(Slots, static_cast<typename std::allocator_traits<SlotAllocator>::size_type>(GetAllocationSlots(Capacity)));
+
+        Ctrl = const_cast<int8*>(FlatHash::EmptyGroup);
+        Slots = nullptr;
+        Capacity = 0;
+        Size = 0;
+        GrowthLeft = 0;
+    }
+
+    void CopyFrom(const TFlatHashTable& Other)
+    {
+        if (Other.Size == 0)
+        {
+            return;
+        }
+
+        // 같은 크기로 만든 뒤 제어 바이트를 그대로 복사하면 해시를 다시 계산하지 않아도 됩니다.
+        SlotAllocator Alloc;
+        Slots = Alloc.allocate(static_cast<typename std::allocator_traits<SlotAllocator>::size_type>(GetAllocationSlots(Other.Capacity)));
+        Ctrl = reinterpret_cast<int8*>(Slots + Other.Capacity);
+        Capacity = Other.Capacity;
+        std::memcpy(Ctrl, Other.Ctrl, GetNumCtrlBytes(Capacity));
+
+        for (uint32 Index = 0; Index < Capacity; ++Index)
+        {
+            if (Ctrl[Index] >= 0)
+            {
+                ::new (&Slots[Index]) ElementType(*Other.GetElement(Index));
+            }
+        }
+        Size = Other.Size;
+        GrowthLeft = Other.GrowthLeft;
+    }
+
+    void StealFrom(TFlatHashTable& Other)
+    {
+        Ctrl = Other.Ctrl;
+        Slots = Other.Slots;
+        Capacity = Other.Capacity;
+        Size = Other.Size;
+        GrowthLeft = Other.GrowthLeft;
+
+        Other.Ctrl = const_cast<int8*>(FlatHash::EmptyGroup);
+        Other.Slots = nullptr;
+        Other.Capacity = 0;
+        Other.Size = 0;
+        Other.GrowthLeft = 0;
+    }
+
+private:
+    /** Capacity가 0이면 EmptyGroup을 가리키며, 이때는 쓰지 않습니다. */
+    int8* Ctrl = const_cast<int8*>(FlatHash::EmptyGroup);
+    FSlot* Slots = nullptr;
+
+    uint32 Capacity = 0;
+    uint32 Size = 0;
+
+    /** 테이블을 키우기 전까지 Empty 슬롯에 더 넣을 수 있는 수 */
+    uint32 GrowthLeft = 0;
+};
+
+
+/** std::unordered_set을 대신하는 TFlatHashTable */
+template <typename T, typename Hasher = std::hash<T>, typename KeyEqual = std::equal_to<T>, typename Allocator = FDefaultAllocator<T>>
+class TFlatHashSet : public TFlatHashTable<FlatHash::TSetPolicy<T>, Hasher, KeyEqual, Allocator>
+{
+    using Super = TFlatHashTable<FlatHash::TSetPolicy<T>, Hasher, KeyEqual, Allocator>;
+
+public:
+    using typename Super::iterator;
+
+    template <typename ArgsType>
+    std::pair<iterator, bool> emplace(ArgsType&& Args)
+    {
+        if constexpr (std::is_same_v<std::remove_cvref_t<ArgsType>, T>)
+        {
+            return this->emplace_key(Args, std::forward<ArgsType>(Args));
+        }
+        else
+        {
+            T Element(std::forward<ArgsType>(Args));
+            return this->emplace_key(Element, std::move(Element));
+        }
+    }
+
+    std::pair<iterator, bool> insert(const T& Element) { return emplace(Element); }
+    std::pair<iterator, bool> insert(T&& Element) { return emplace(std::move(Element)); }
+};
+
+
+/** std::unordered_map을 대신하는 TFlatHashTable */
+template <typename K, typename V, typename Hasher = std::hash<K>, typename KeyEqual = std::equal_to<K>, typename Allocator = FDefaultAllocator<std::pair<const K, V>>>
+class TFlatHashMap : public TFlatHashTable<FlatHash::TMapPolicy<K, V>, Hasher, KeyEqual, Allocator>
+{
+    using Super = TFlatHashTable<FlatHash::TMapPolicy<K, V>, Hasher, KeyEqual, Allocator>;
+
+public:
+    using typename Super::iterator;
+    using mapped_type = V;
+
+    template <typename KeyArgType, typename... ValueArgsType>
+    std::pair<iterator, bool> try_emplace(KeyArgType&& Key, ValueArgsType&&... ValueArgs)
+    {
+        if constexpr (std::is_same_v<std::remove_cvref_t<KeyArgType>, K>)
+        {
+            return this->emplace_key(
+                Key, std::piecewise_construct,
+                std::forward_as_tuple(std::forward<KeyArgType>(Key)),
+                std::forward_as_tuple(std::forward<ValueArgsType>(ValueArgs)...)
+            );
+        }
+        else
+        {
+            K KeyElement(std::forward<KeyArgType>(Key));
+            return this->emplace_key(
+                KeyElement, std::piecewise_construct,
+                std::forward_as_tuple(std::move(KeyElement)),
+                std::forward_as_tuple(std::forward<ValueArgsType>(ValueArgs)...)
+            );
+        }
+    }
+
+    template <typename KeyArgType, typename ValueArgType>
+    std::pair<iterator, bool> emplace(KeyArgType&& Key, ValueArgType&& Value)
+    {
+        return try_emplace(std::forward<KeyArgType>(Key), std::forward<ValueArgType>(Value));
+    }
+
+    template <typename ValueArgType>
+    std::pair<iterator, bool> insert_or_assign(const K& Key, ValueArgType&& Value)
+    {
+        auto Result = try_emplace(Key, std::forward<ValueArgType>(Value));
+        if (!Result.second)
+        {
+            Result.first->second = std::forward<ValueArgType>(Value);
+        }
+        return Result;
+    }
+
+    V& operator[](const K& Key)
+    {
+        return try_emplace(Key).first->second;
+    }
+
+    V& at(const K& Key)
+    {
+        const auto It = this->find(Key);
+        if (It == this->end())
+        {
+            throw std::out_of_range("TFlatHashMap::at");
+        }
+        return It->second;
+    }
+
+    const V& at(const K& Key) const
+    {
+        const auto It = this->find(Key);
+        if (It == this->end())
+        {
+            throw std::out_of_range("TFlatHashMap::at");
+        }
+        return It->second;
+    }
+};
@@ -2,6 +2,7 @@
 #include <unordered_map>
 
 #include "ContainerAllocator.h"
+#include "FlatHashTable.h"
 #include "Pair.h"
 #include "Serialization/Archive.h"
 
@@ -11,7 +12,11 @@ class TMap
 {
 public:
     using PairType = TPair<const KeyType, ValueType>;
+#if USE_FLAT_HASH_CONTAINERS
+    using MapType = TFlatHashMap<KeyType, ValueType, std::hash<KeyType>, std::equal_to<KeyType>, Allocator>;
+#else
     using MapType = std::unordered_map<KeyType, ValueType, std::hash<KeyType>, std::equal_to<KeyType>, Allocator>;
+#endif
     using SizeType = typename MapType::size_type;
 
 private:
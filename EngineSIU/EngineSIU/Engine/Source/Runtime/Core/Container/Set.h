@@ -3,13 +3,18 @@
 
 #include "Array.h"
 #include "ContainerAllocator.h"
+#include "FlatHashTable.h"
 
 
 template <typename T, typename Hasher = std::hash<T>, typename Allocator = FDefaultAllocator<T>>
 class TSet
 {
 private:
+#if USE_FLAT_HASH_CONTAINERS
+    using SetType = TFlatHashSet<T, Hasher, std::equal_to<>, Allocator>;
+#else
     using SetType = std::unordered_set<T, Hasher, std::equal_to<>, Allocator>;
+#endif
     using ElementType = T;
 
     SetType ContainerPrivate;
@@ -45,12 +50,19 @@ public:
     int32 Emplace(ArgsType&& Args) 
     { 
         auto iter = ContainerPrivate.emplace(std::forward<ArgsType>(Args));
+#if USE_FLAT_HASH_CONTAINERS
+        return static_cast<int32>(iter.first.GetIndex());
+#else
     	return std::distance(ContainerPrivate.begin(), iter.first);
+#endif
     }
 
     // Num (개수)
     SizeType Num() const { return static_cast<SizeType>(ContainerPrivate.size()); }
 
+    // 용량 관련
+    void Reserve(SizeType Number) { ContainerPrivate.reserve(Number); }
+
     // Find
     Iterator Find(const T& Item) { return ContainerPrivate.find(Item); }
     ConstIterator Find(const T& Item) const { return ContainerPrivate.find(Item); }
@@ -1,6 +1,7 @@
 #include "String.h"
 #include <algorithm>
 #include <cctype>
+#include <cstdarg>
 #include <vector>
 
 #include "CoreMiscDefines.h"
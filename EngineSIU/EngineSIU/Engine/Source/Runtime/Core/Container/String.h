@@ -345,7 +345,8 @@ struct std::hash<FString>
 {
 	size_t operator()(const FString& Key) const noexcept
 	{
-		return hash<FString::BaseStringType>()(Key.PrivateString);
+		// Allocator가 다른 basic_string의 hash는 표준에 없으므로 string_view로 계산합니다.
+		return hash<std::basic_string_view<FString::ElementType>>()(Key.PrivateString);
 	}
 };
 
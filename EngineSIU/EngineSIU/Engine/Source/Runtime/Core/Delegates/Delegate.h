@@ -1,6 +1,17 @@
 ﻿#pragma once
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
 #include <functional>
-#include "Core/Container/Map.h"
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+class UObject;
 
 #define FUNC_DECLARE_DELEGATE(DelegateName, ReturnType, ...) \
 	using DelegateName = TDelegate<ReturnType(__VA_ARGS__)>;
@@ -50,6 +61,12 @@ public:
 	{
 		return HandleId != Other.HandleId;
 	}
+
+	/** 나중에 만든 Handle일수록 큽니다. */
+	bool operator<(const FDelegateHandle& Other) const
+	{
+		return HandleId < Other.HandleId;
+	}
 };
 
 template <>
@@ -61,39 +78,233 @@ struct std::hash<FDelegateHandle>
     }
 };
 
+namespace DelegatePrivate
+{
+	/** 이 크기 이하의 호출 대상은 힙 할당 없이 Delegate 안에 저장됩니다. 객체 포인터와 멤버 함수 포인터가 함께 들어가는 크기입니다. */
+	constexpr size_t InlineSize = 4 * sizeof(void*);
+	constexpr size_t InlineAlignment = alignof(std::max_align_t);
+
+	template <typename FunctorType>
+	constexpr bool IsStoredInline =
+		sizeof(FunctorType) <= InlineSize
+		&& alignof(FunctorType) <= InlineAlignment
+		&& std::is_nothrow_move_constructible_v<FunctorType>;
+
+	/** memcpy로 옮기고 그냥 버려도 되는 호출 대상. 이런 대상은 FFunctorOps 없이 저장됩니다. */
+	template <typename FunctorType>
+	constexpr bool IsTriviallyStored = IsStoredInline<FunctorType> && std::is_trivially_copyable_v<FunctorType>;
+
+	/**
+	 * 저장된 호출 대상을 복사, 이동, 소멸하는 함수들.
+	 * Copy가 nullptr이면 복사할 수 없는 호출 대상이고, Move가 nullptr이면 memcpy로 옮깁니다.
+	 */
+	struct FFunctorOps
+	{
+		void (*Copy)(void* Dest, const void* Src);
+		void (*Move)(void* Dest, void* Src);
+		void (*Destroy)(void* Storage);
+	};
+
+	template <typename FunctorType>
+	struct TInlineFunctorOps
+	{
+		static void Copy(void* Dest, const void* Src)
+		{
+			new (Dest) FunctorType(*static_cast<const FunctorType*>(Src));
+		}
+
+		static void Move(void* Dest, void* Src)
+		{
+			FunctorType* SrcFunctor = static_cast<FunctorType*>(Src);
+			new (Dest) FunctorType(std::move(*SrcFunctor));
+			SrcFunctor->~FunctorType();
+		}
+
+		static void Destroy(void* Storage)
+		{
+			static_cast<FunctorType*>(Storage)->~FunctorType();
+		}
+	};
+
+	/** 복사할 수 없는 호출 대상이면 nullptr */
+	template <typename OpsType, typename FunctorType>
+	constexpr void (*GetCopyOp())(void*, const void*)
+	{
+		if constexpr (std::is_copy_constructible_v<FunctorType>)
+		{
+			return &OpsType::Copy;
+		}
+		else
+		{
+			return nullptr;
+		}
+	}
+
+	template <typename FunctorType>
+	inline constexpr FFunctorOps InlineFunctorOps = {
+		GetCopyOp<TInlineFunctorOps<FunctorType>, FunctorType>(),
+		&TInlineFunctorOps<FunctorType>::Move,
+		&TInlineFunctorOps<FunctorType>::Destroy
+	};
+
+	/** Storage에 힙에 만든 호출 대상의 포인터만 저장합니다. */
+	template <typename FunctorType>
+	struct THeapFunctorOps
+	{
+		static FunctorType* Get(const void* Storage)
+		{
+			return *static_cast<FunctorType* const*>(Storage);
+		}
+
+		static void Copy(void* Dest, const void* Src)
+		{
+			*static_cast<FunctorType**>(Dest) = new FunctorType(*Get(Src));
+		}
+
+		static void Destroy(void* Storage)
+		{
+			delete Get(Storage);
+		}
+	};
+
+	template <typename FunctorType>
+	inline constexpr FFunctorOps HeapFunctorOps = {
+		GetCopyOp<THeapFunctorOps<FunctorType>, FunctorType>(),
+		nullptr,
+		&THeapFunctorOps<FunctorType>::Destroy
+	};
+
+	/** 객체 포인터와 멤버 함수 포인터. 복사가 자명해서 힙 할당도 FFunctorOps도 필요 없습니다. */
+	template <typename UserClass, typename MethodType>
+	struct TMemberFunctionCaller
+	{
+		UserClass* Object;
+		MethodType Method;
+
+		template <typename... ArgTypes>
+		decltype(auto) operator()(ArgTypes&&... Args) const
+		{
+			return (Object->*Method)(std::forward<ArgTypes>(Args)...);
+		}
+	};
+
+	template <typename ReturnType, typename CallableType, typename... ArgTypes>
+	FORCEINLINE ReturnType InvokeAs(CallableType& Callable, ArgTypes&&... Args)
+	{
+		if constexpr (std::is_void_v<ReturnType>)
+		{
+			std::invoke(Callable, std::forward<ArgTypes>(Args)...);
+		}
+		else
+		{
+			return std::invoke(Callable, std::forward<ArgTypes>(Args)...);
+		}
+	}
+}
+
 template <typename Signature>
 class TDelegate;
 
+/**
+ * 함수 하나를 묶어 두었다가 호출하는 Delegate.
+ *
+ * 호출 대상은 작으면 Delegate 안의 버퍼에, 크면 힙에 저장합니다.
+ * 포인터 몇 개를 캡처하는 람다와 BindRaw/BindUObject/BindStatic은 항상 버퍼에 들어가므로 할당이 없고,
+ * 호출은 함수 포인터 하나를 거쳐 바로 대상에 도달합니다.
+ */
 template <typename ReturnType, typename... ParamTypes>
 class TDelegate<ReturnType(ParamTypes...)>
 {
-    // TODO: std::function 사용 안하고 직접 TFunction 구현하기
-	using FuncType = std::function<ReturnType(ParamTypes...)>;
-	FuncType Func;
+	using FInvoker = ReturnType (*)(void* Storage, ParamTypes&&... Params);
 
 public:
+	TDelegate() = default;
+
+	TDelegate(const TDelegate& Other)
+	{
+		CopyFrom(Other);
+	}
+
+	TDelegate(TDelegate&& Other) noexcept
+	{
+		MoveFrom(Other);
+	}
+
+	TDelegate& operator=(const TDelegate& Other)
+	{
+		if (this != &Other)
+		{
+			UnBind();
+			CopyFrom(Other);
+		}
+		return *this;
+	}
+
+	TDelegate& operator=(TDelegate&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			UnBind();
+			MoveFrom(Other);
+		}
+		return *this;
+	}
+
+	~TDelegate()
+	{
+		UnBind();
+	}
+
 	template <typename FunctorType>
 	void BindLambda(FunctorType&& InFunctor)
 	{
-	    Func = [Func = std::forward<FunctorType>(InFunctor)](ParamTypes... Params)
-	    {
-	        return Func(std::forward<ParamTypes>(Params)...);
-	    };
+		UnBind();
+		Emplace<std::decay_t<FunctorType>>(std::forward<FunctorType>(InFunctor));
+	}
+
+	/** 멤버 함수를 묶습니다. InObject의 수명은 호출하는 쪽에서 보장해야 합니다. */
+	template <typename UserClass, typename MethodType>
+	void BindRaw(UserClass* InObject, MethodType InMethod)
+	{
+		static_assert(std::is_member_function_pointer_v<MethodType>, "BindRaw에는 멤버 함수 포인터를 넘겨야 합니다.");
+		BindLambda(DelegatePrivate::TMemberFunctionCaller<UserClass, MethodType>{InObject, InMethod});
+	}
+
+	/**
+	 * UObject의 멤버 함수를 묶습니다.
+	 * 이 엔진에는 아직 약한 참조가 없으므로, BindRaw와 마찬가지로 객체를 지우기 전에 UnBind해야 합니다.
+	 */
+	template <typename UserClass, typename MethodType>
+	void BindUObject(UserClass* InObject, MethodType InMethod)
+	{
+		static_assert(std::is_base_of_v<UObject, UserClass>, "BindUObject에는 UObject를 넘겨야 합니다.");
+		BindRaw(InObject, InMethod);
+	}
+
+	void BindStatic(ReturnType (*InFunction)(ParamTypes...))
+	{
+		BindLambda(InFunction);
 	}
 
 	void UnBind()
 	{
-		Func = nullptr;
+		if (Ops)
+		{
+			Ops->Destroy(Storage);
+			Ops = nullptr;
+		}
+		Invoker = nullptr;
 	}
 
 	bool IsBound() const
 	{
-	    return static_cast<bool>(Func);
+	    return Invoker != nullptr;
 	}
 
 	ReturnType Execute(ParamTypes... InArgs) const
 	{
-		return Func(std::forward<ParamTypes>(InArgs)...);
+		assert(IsBound());
+		return Invoker(Storage, std::forward<ParamTypes>(InArgs)...);
 	}
 
 	bool ExecuteIfBound(ParamTypes... InArgs) const
@@ -105,50 +316,284 @@ public:
 		}
 		return false;
 	}
+
+private:
+	template <typename FunctorType, typename... ArgTypes>
+	void Emplace(ArgTypes&&... Args)
+	{
+		if constexpr (DelegatePrivate::IsStoredInline<FunctorType>)
+		{
+			new (Storage) FunctorType(std::forward<ArgTypes>(Args)...);
+			Invoker = [](void* InStorage, ParamTypes&&... Params) -> ReturnType
+			{
+				return DelegatePrivate::InvokeAs<ReturnType>(*static_cast<FunctorType*>(InStorage), std::forward<ParamTypes>(Params)...);
+			};
+			if constexpr (!DelegatePrivate::IsTriviallyStored<FunctorType>)
+			{
+				Ops = &DelegatePrivate::InlineFunctorOps<FunctorType>;
+			}
+		}
+		else
+		{
+			*reinterpret_cast<FunctorType**>(Storage) = new FunctorType(std::forward<ArgTypes>(Args)...);
+			Invoker = [](void* InStorage, ParamTypes&&... Params) -> ReturnType
+			{
+				return DelegatePrivate::InvokeAs<ReturnType>(*DelegatePrivate::THeapFunctorOps<FunctorType>::Get(InStorage), std::forward<ParamTypes>(Params)...);
+			};
+			Ops = &DelegatePrivate::HeapFunctorOps<FunctorType>;
+		}
+	}
+
+	/** this는 비어 있어야 합니다. */
+	void CopyFrom(const TDelegate& Other)
+	{
+		if (Other.Ops)
+		{
+			assert(Other.Ops->Copy && "복사할 수 없는 호출 대상이 묶인 Delegate입니다.");
+			Other.Ops->Copy(Storage, Other.Storage);
+		}
+		else
+		{
+			std::memcpy(Storage, Other.Storage, sizeof(Storage));
+		}
+		Invoker = Other.Invoker;
+		Ops = Other.Ops;
+	}
+
+	/** this는 비어 있어야 하며, Other는 비워집니다. */
+	void MoveFrom(TDelegate& Other) noexcept
+	{
+		if (Other.Ops && Other.Ops->Move)
+		{
+			Other.Ops->Move(Storage, Other.Storage);
+		}
+		else
+		{
+			std::memcpy(Storage, Other.Storage, sizeof(Storage));
+		}
+		Invoker = Other.Invoker;
+		Ops = Other.Ops;
+		Other.Invoker = nullptr;
+		Other.Ops = nullptr;
+	}
+
+private:
+	/** Execute가 const이므로, mutable 람다도 호출할 수 있도록 mutable로 둡니다. */
+	alignas(DelegatePrivate::InlineAlignment) mutable unsigned char Storage[DelegatePrivate::InlineSize];
+
+	FInvoker Invoker = nullptr;
+
+	/** nullptr이면 Storage를 memcpy로 옮기고 그냥 버려도 됩니다. */
+	const DelegatePrivate::FFunctorOps* Ops = nullptr;
 };
 
 template <typename Signature>
 class TMulticastDelegate;
 
+/**
+ * 여러 함수를 묶어 두었다가 한꺼번에 호출하는 Delegate.
+ *
+ * 묶인 함수들은 추가한 순서대로 배열에 연속해서 저장되고, 그 순서대로 호출됩니다.
+ * Handle은 추가한 순서대로 커지므로 배열이 Handle 순으로 정렬되어 있어, Remove는 이진 탐색으로 찾습니다.
+ *
+ * Broadcast 중에 추가한 함수는 다음 Broadcast부터 호출되고, 제거한 함수는 아직 호출되지 않았다면 호출되지 않습니다.
+ * 실행 중인 함수의 메모리가 옮겨지거나 해제되지 않도록, 배열은 가장 바깥 Broadcast가 끝날 때 정리합니다.
+ */
 template <typename ReturnType, typename... ParamTypes>
 class TMulticastDelegate<ReturnType(ParamTypes...)>
 {
-    // TODO: std::function 사용 안하고 직접 TFunction 구현하기
-	using FuncType = std::function<ReturnType(ParamTypes...)>;
-	TMap<FDelegateHandle, FuncType> DelegateHandles;
+	using DelegateType = TDelegate<ReturnType(ParamTypes...)>;
+
+	struct FEntry
+	{
+		FDelegateHandle Handle;
+		DelegateType Delegate;
+		bool bRemoved = false;
+	};
 
 public:
 	template <typename FunctorType>
 	FDelegateHandle AddLambda(FunctorType&& InFunctor)
 	{
-		FDelegateHandle DelegateHandle = FDelegateHandle::CreateHandle();
+		FEntry& Entry = AddEntry();
+		Entry.Delegate.BindLambda(std::forward<FunctorType>(InFunctor));
+		return Entry.Handle;
+	}
+
+	template <typename UserClass, typename MethodType>
+	FDelegateHandle AddRaw(UserClass* InObject, MethodType InMethod)
+	{
+		FEntry& Entry = AddEntry();
+		Entry.Delegate.BindRaw(InObject, InMethod);
+		return Entry.Handle;
+	}
+
+	/** 객체를 지우기 전에 Remove해야 합니다. TDelegate::BindUObject 참고 */
+	template <typename UserClass, typename MethodType>
+	FDelegateHandle AddUObject(UserClass* InObject, MethodType InMethod)
+	{
+		FEntry& Entry = AddEntry();
+		Entry.Delegate.BindUObject(InObject, InMethod);
+		return Entry.Handle;
+	}
+
+	FDelegateHandle AddStatic(ReturnType (*InFunction)(ParamTypes...))
+	{
+		FEntry& Entry = AddEntry();
+		Entry.Delegate.BindStatic(InFunction);
+		return Entry.Handle;
+	}
 
-        DelegateHandles.Add(
-            DelegateHandle,
-            [Func = std::forward<FunctorType>(InFunctor)](ParamTypes... Params) mutable
-            {
-                Func(std::forward<ParamTypes>(Params)...);
-            }
-        );
-		return DelegateHandle;
+	FDelegateHandle Add(DelegateType InDelegate)
+	{
+		FEntry& Entry = AddEntry();
+		Entry.Delegate = std::move(InDelegate);
+		return Entry.Handle;
 	}
 
 	bool Remove(FDelegateHandle Handle)
 	{
-		if (Handle.IsValid())
+		if (!Handle.IsValid())
 		{
-			DelegateHandles.Remove(Handle);
-			return true;
+			return false;
+		}
+
+		TArray<FEntry>* List = &Entries;
+		int32 Index = FindEntry(Entries, Handle);
+		if (Index == -1)
+		{
+			List = &PendingEntries;
+			Index = FindEntry(PendingEntries, Handle);
+		}
+		if (Index == -1 || (*List)[Index].bRemoved)
+		{
+			return false;
+		}
+
+		if (BroadcastDepth > 0)
+		{
+			// 지금 실행 중인 함수일 수도 있으므로 Broadcast가 끝난 뒤에 지웁니다.
+			(*List)[Index].bRemoved = true;
+			bHasRemovedEntries = true;
+		}
+		else
+		{
+			List->RemoveAt(Index);
+		}
+		return true;
+	}
+
+	void Clear()
+	{
+		if (BroadcastDepth > 0)
+		{
+			for (FEntry& Entry : Entries)
+			{
+				Entry.bRemoved = true;
+			}
+			for (FEntry& Entry : PendingEntries)
+			{
+				Entry.bRemoved = true;
+			}
+			bHasRemovedEntries = true;
+		}
+		else
+		{
+			Entries.Empty();
+			PendingEntries.Empty();
+		}
+	}
+
+	bool IsBound() const
+	{
+		for (const FEntry& Entry : Entries)
+		{
+			if (!Entry.bRemoved)
+			{
+				return true;
+			}
+		}
+		for (const FEntry& Entry : PendingEntries)
+		{
+			if (!Entry.bRemoved)
+			{
+				return true;
+			}
 		}
 		return false;
 	}
 
 	void Broadcast(ParamTypes... Params) const
 	{
-		auto CopyDelegates = DelegateHandles;
-		for (const auto& [Handle, Delegate] : CopyDelegates)
+		++BroadcastDepth;
+
+		// Broadcast 중에는 Entries가 커지지 않으므로 원소의 주소가 바뀌지 않습니다.
+		const int32 NumEntries = Entries.Num();
+		for (int32 Index = 0; Index < NumEntries; ++Index)
 		{
-			Delegate(std::forward<ParamTypes>(Params)...);  // NOLINT(bugprone-use-after-move)
+			const FEntry& Entry = Entries[Index];
+			if (!Entry.bRemoved)
+			{
+				Entry.Delegate.Execute(Params...);
+			}
 		}
+
+		if (--BroadcastDepth == 0)
+		{
+			FlushPendingChanges();
+		}
+	}
+
+private:
+	FEntry& AddEntry()
+	{
+		TArray<FEntry>& List = BroadcastDepth > 0 ? PendingEntries : Entries;
+		const int32 Index = List.Add(FEntry{FDelegateHandle::CreateHandle()});
+		return List[Index];
 	}
+
+	static int32 FindEntry(const TArray<FEntry>& List, FDelegateHandle Handle)
+	{
+		int32 Low = 0;
+		int32 High = List.Num();
+		while (Low < High)
+		{
+			const int32 Mid = (Low + High) / 2;
+			if (List[Mid].Handle < Handle)
+			{
+				Low = Mid + 1;
+			}
+			else
+			{
+				High = Mid;
+			}
+		}
+		return Low < List.Num() && List[Low].Handle == Handle ? Low : -1;
+	}
+
+	void FlushPendingChanges() const
+	{
+		if (bHasRemovedEntries)
+		{
+			Entries.RemoveAll([](const FEntry& Entry) { return Entry.bRemoved; });
+			PendingEntries.RemoveAll([](const FEntry& Entry) { return Entry.bRemoved; });
+			bHasRemovedEntries = false;
+		}
+
+		// 나중에 만든 Handle이므로 뒤에 붙여도 정렬이 유지됩니다.
+		if (PendingEntries.Num() > 0)
+		{
+			Entries.Append(std::move(PendingEntries));
+		}
+	}
+
+private:
+	// Broadcast는 const이지만, 그 안에서 호출된 함수가 추가/제거할 수 있으므로 mutable로 둡니다.
+	mutable TArray<FEntry> Entries;
+
+	/** Broadcast 중에 추가된 함수들 */
+	mutable TArray<FEntry> PendingEntries;
+
+	mutable int32 BroadcastDepth = 0;
+	mutable bool bHasRemovedEntries = false;
 };
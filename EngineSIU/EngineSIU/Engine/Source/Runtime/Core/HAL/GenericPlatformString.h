@@ -0,0 +1,102 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <cwchar>
+
+
+/**
+ * Windows가 아닌 빌드(헤드리스 테스트 등)에서 FString이 쓰는 Win32 문자열 변환 함수 대신 사용합니다.
+ * CodePage는 CP_UTF8만 지원하며, wchar_t는 UTF-32로 취급합니다.
+ * Win32와 같이 cchWideChar / cbMultiByte가 -1이면 널 문자까지 변환하고, 출력 버퍼가 nullptr이면 필요한 길이만 반환합니다.
+ */
+#define CP_UTF8 65001
+
+inline int WideCharToMultiByte(
+    unsigned int /*CodePage*/, unsigned long /*Flags*/, const wchar_t* WideStr, int WideLength,
+    char* OutStr, int OutSize, const char* /*DefaultChar*/, int* /*UsedDefaultChar*/
+)
+{
+    const int Length = WideLength < 0 ? static_cast<int>(std::wcslen(WideStr)) + 1 : WideLength;
+
+    int Written = 0;
+    for (int Index = 0; Index < Length; ++Index)
+    {
+        const uint32_t Code = static_cast<uint32_t>(WideStr[Index]);
+
+        char Encoded[4];
+        int EncodedSize;
+        if (Code < 0x80)
+        {
+            Encoded[0] = static_cast<char>(Code);
+            EncodedSize = 1;
+        }
+        else if (Code < 0x800)
+        {
+            Encoded[0] = static_cast<char>(0xC0 | (Code >> 6));
+            Encoded[1] = static_cast<char>(0x80 | (Code & 0x3F));
+            EncodedSize = 2;
+        }
+        else if (Code < 0x10000)
+        {
+            Encoded[0] = static_cast<char>(0xE0 | (Code >> 12));
+            Encoded[1] = static_cast<char>(0x80 | ((Code >> 6) & 0x3F));
+            Encoded[2] = static_cast<char>(0x80 | (Code & 0x3F));
+            EncodedSize = 3;
+        }
+        else
+        {
+            Encoded[0] = static_cast<char>(0xF0 | (Code >> 18));
+            Encoded[1] = static_cast<char>(0x80 | ((Code >> 12) & 0x3F));
+            Encoded[2] = static_cast<char>(0x80 | ((Code >> 6) & 0x3F));
+            Encoded[3] = static_cast<char>(0x80 | (Code & 0x3F));
+            EncodedSize = 4;
+        }
+
+        if (OutStr)
+        {
+            if (Written + EncodedSize > OutSize)
+            {
+                return 0;
+            }
+            std::memcpy(OutStr + Written, Encoded, EncodedSize);
+        }
+        Written += EncodedSize;
+    }
+    return Written;
+}
+
+inline int MultiByteToWideChar(
+    unsigned int /*CodePage*/, unsigned long /*Flags*/, const char* NarrowStr, int NarrowLength,
+    wchar_t* OutStr, int OutSize
+)
+{
+    const unsigned char* Bytes = reinterpret_cast<const unsigned char*>(NarrowStr);
+    const int Length = NarrowLength < 0 ? static_cast<int>(std::strlen(NarrowStr)) + 1 : NarrowLength;
+
+    int Written = 0;
+    for (int Index = 0; Index < Length;)
+    {
+        uint32_t Code = Bytes[Index];
+        int Trailing = 0;
+        if (Code >= 0xF0)      { Code &= 0x07; Trailing = 3; }
+        else if (Code >= 0xE0) { Code &= 0x0F; Trailing = 2; }
+        else if (Code >= 0xC0) { Code &= 0x1F; Trailing = 1; }
+
+        ++Index;
+        for (; Trailing > 0 && Index < Length; --Trailing, ++Index)
+        {
+            Code = (Code << 6) | (Bytes[Index] & 0x3F);
+        }
+
+        if (OutStr)
+        {
+            if (Written >= OutSize)
+            {
+                return 0;
+            }
+            OutStr[Written] = static_cast<wchar_t>(Code);
+        }
+        ++Written;
+    }
+    return Written;
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <chrono>
+#include "HAL/PlatformType.h"
+
+
+/**
+ * std::chrono::steady_clock 기반의 시간 기능. Windows가 아닌 빌드(헤드리스 테스트 등)에서 FPlatformTime으로 사용합니다.
+ * 1 Cycle = 1 나노초입니다.
+ */
+struct FGenericPlatformTime
+{
+    static void InitTiming() {}
+
+    static float GetSecondsPerCycle() { return 1e-9f; }
+
+    static uint64 GetFrequency() { return 1000000000ull; }
+
+    static double ToMilliseconds(uint64 CycleDiff)
+    {
+        return static_cast<double>(CycleDiff) * 1e-6;
+    }
+
+    static uint64 Cycles64()
+    {
+        return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count());
+    }
+};
@@ -0,0 +1,78 @@
+#include "PlatformFile.h"
+
+FMappedFile::~FMappedFile()
+{
+    Close();
+}
+
+bool FMappedFile::Open(const FWString& FilePath)
+{
+    Close();
+
+    FileHandle = CreateFileW(FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (FileHandle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER FileSize;
+    if (!GetFileSizeEx(FileHandle, &FileSize))
+    {
+        Close();
+        return false;
+    }
+
+    Size = static_cast<uint64>(FileSize.QuadPart);
+
+    FILETIME WriteTime;
+    if (GetFileTime(FileHandle, nullptr, nullptr, &WriteTime))
+    {
+        LastWriteTime = (static_cast<uint64>(WriteTime.dwHighDateTime) << 32) | WriteTime.dwLowDateTime;
+    }
+
+    if (Size == 0)
+    {
+        // 크기가 0인 파일은 매핑할 수 없으므로 열린 상태로만 둡니다.
+        return true;
+    }
+
+    MappingHandle = CreateFileMappingW(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (MappingHandle == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    Data = static_cast<const char*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (Data == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void FMappedFile::Close()
+{
+    if (Data)
+    {
+        UnmapViewOfFile(Data);
+        Data = nullptr;
+    }
+
+    if (MappingHandle)
+    {
+        CloseHandle(MappingHandle);
+        MappingHandle = nullptr;
+    }
+
+    if (FileHandle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(FileHandle);
+        FileHandle = INVALID_HANDLE_VALUE;
+    }
+
+    Size = 0;
+    LastWriteTime = 0;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "Core/HAL/PlatformType.h"
+
+/**
+ * 읽기 전용으로 메모리 매핑한 파일.
+ * 파일 전체를 한 번에 복사하지 않고 OS 페이지 캐시를 그대로 읽습니다.
+ */
+class FMappedFile
+{
+public:
+    FMappedFile() = default;
+    ~FMappedFile();
+
+    FMappedFile(const FMappedFile&) = delete;
+    FMappedFile& operator=(const FMappedFile&) = delete;
+
+    /** 파일을 엽니다. 이미 열려 있던 파일은 닫습니다. */
+    bool Open(const FWString& FilePath);
+
+    void Close();
+
+    bool IsOpen() const { return FileHandle != INVALID_HANDLE_VALUE; }
+
+    /** 매핑된 파일의 시작 주소, 빈 파일이면 nullptr */
+    const char* GetData() const { return Data; }
+
+    uint64 GetSize() const { return Size; }
+
+    /** 마지막으로 수정된 시각 (FILETIME, 100ns 단위) */
+    uint64 GetLastWriteTime() const { return LastWriteTime; }
+
+private:
+    HANDLE FileHandle = INVALID_HANDLE_VALUE;
+    HANDLE MappingHandle = nullptr;
+    const char* Data = nullptr;
+    uint64 Size = 0;
+    uint64 LastWriteTime = 0;
+};
@@ -1,5 +1,7 @@
 #pragma once
 #include <atomic>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 
 #include "Core/HAL/PlatformType.h"
@@ -123,7 +125,12 @@ void* FPlatformMemory::Malloc(size_t Size)
 template <EAllocationType AllocType>
 void* FPlatformMemory::AlignedMalloc(size_t Size, size_t Alignment)
 {
+#if defined(_WIN32)
     void* Ptr = _aligned_malloc(Size, Alignment);
+#else
+    // aligned_alloc은 크기가 Alignment의 배수여야 합니다.
+    void* Ptr = std::aligned_alloc(Alignment, (Size + Alignment - 1) / Alignment * Alignment);
+#endif
     if (Ptr)
     {
         IncrementStats<AllocType>(Size);
@@ -147,7 +154,11 @@ void FPlatformMemory::AlignedFree(void* Address, size_t Size)
     if (Address)
     {
         DecrementStats<AllocType>(Size);
+#if defined(_WIN32)
         _aligned_free(Address);
+#else
+        std::free(Address);
+#endif
     }
 }
 
@@ -0,0 +1,8 @@
+#pragma once
+
+#if defined(_WIN32)
+#include "WindowsPlatformTime.h"
+#else
+#include "HAL/GenericPlatformTime.h"
+typedef FGenericPlatformTime FPlatformTime;
+#endif
@@ -2,6 +2,7 @@
 #include <cstdint>
 
 //~ Windows.h
+#if defined(_WIN32)
 #define _TCHAR_DEFINED  // TCHAR 재정의 에러 때문
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
@@ -12,14 +13,23 @@
 #ifdef TEXT             // Windows.h의 TEXT를 삭제
     #undef TEXT
 #endif
+#else
+// 헤드리스 테스트 빌드(Linux)에서는 Windows.h 대신 필요한 부분만 따로 구현합니다.
+#include "HAL/GenericPlatformString.h"
+#endif
 //~ Windows.h
 
 
+#if defined(_MSC_VER)
 // inline을 강제하는 매크로
 #define FORCEINLINE __forceinline
 
 // inline을 하지않는 매크로
 #define FORCENOINLINE __declspec(noinline)
+#else
+#define FORCEINLINE inline __attribute__((always_inline))
+#define FORCENOINLINE __attribute__((noinline))
+#endif
 
 
 #define USE_WIDECHAR 0
@@ -22,9 +22,7 @@ struct FRotator
         : Pitch(InPitch), Yaw(InYaw), Roll(InRoll)
     {}
 
-    FRotator(const FRotator& Other)
-        : Pitch(Other.Pitch), Yaw(Other.Yaw), Roll(Other.Roll)
-    {}
+    FRotator(const FRotator& Other) = default;
 
     FRotator(const FVector& InVector);
     FRotator(const FQuat& InQuat);
@@ -118,3 +118,42 @@ public:
 private:
     const TArray<uint8>& Data;
 };
+
+/** FMemoryReader와 같지만, TArray가 아닌 메모리 매핑한 파일 같은 외부 버퍼를 복사하지 않고 읽습니다. */
+class FMemoryReaderView : public FMemoryArchive
+{
+public:
+    FMemoryReaderView(const void* InData, int64 InSize)
+        : Data(static_cast<const uint8*>(InData))
+        , Size(InSize)
+    {
+        bIsSaving = false;
+        bIsLoading = true;
+    }
+
+    virtual void LoadData(void* OutData, uint64 Length) override
+    {
+        if (Length > static_cast<uint64>(Size - Offset))
+        {
+            throw std::runtime_error("Attempted to read beyond the end of the buffer.");
+        }
+
+        FPlatformMemory::Memcpy(OutData, Data + Offset, Length);
+        Offset += Length;
+    }
+
+    virtual void Seek(int64 InPos) override
+    {
+        if (InPos < 0 || InPos > Size)
+        {
+            throw std::runtime_error("Attempted to seek beyond the end of the buffer.");
+        }
+        Offset = InPos;
+    }
+
+    int64 TotalSize() const { return Size; }
+
+private:
+    const uint8* Data;
+    int64 Size;
+};
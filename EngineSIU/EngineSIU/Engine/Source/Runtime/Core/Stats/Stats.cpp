@@ -1,11 +1,132 @@
 ﻿#include "Stats.h"
-#include "WindowsPlatformTime.h"
+#include <memory>
+#include <mutex>
+#include "Container/Map.h"
+#include "HAL/PlatformTime.h"
+
+
+namespace
+{
+    struct FStatRegistryData
+    {
+        std::mutex Mutex;
+        TArray<FName> Names;
+        TMap<FName, uint32> Indices;
+    };
+
+    FStatRegistryData& GetStatRegistryData()
+    {
+        static FStatRegistryData Data;
+        return Data;
+    }
+
+    struct FThreadStatsList
+    {
+        std::mutex Mutex;
+        TArray<std::unique_ptr<FThreadStats>> ThreadStats;
+    };
+
+    FThreadStatsList& GetThreadStatsList()
+    {
+        static FThreadStatsList List;
+        return List;
+    }
+}
+
+
+TStatId::TStatId(FName Name)
+    : Name(Name)
+    , StatIndex(FStatRegistry::Register(Name))
+{
+}
+
+uint32 FStatRegistry::Register(FName Name)
+{
+    FStatRegistryData& Data = GetStatRegistryData();
+    std::lock_guard Lock(Data.Mutex);
+
+    if (const uint32* Found = Data.Indices.Find(Name))
+    {
+        return *Found;
+    }
+
+    const uint32 NewIndex = static_cast<uint32>(Data.Names.Add(Name));
+    Data.Indices.Add(Name, NewIndex);
+    return NewIndex;
+}
+
+FName FStatRegistry::GetStatName(uint32 StatIndex)
+{
+    FStatRegistryData& Data = GetStatRegistryData();
+    std::lock_guard Lock(Data.Mutex);
+    return StatIndex < static_cast<uint32>(Data.Names.Num()) ? Data.Names[StatIndex] : FName(NAME_None);
+}
+
+uint32 FStatRegistry::Num()
+{
+    FStatRegistryData& Data = GetStatRegistryData();
+    std::lock_guard Lock(Data.Mutex);
+    return static_cast<uint32>(Data.Names.Num());
+}
+
+
+FThreadStats::FThreadStats(uint32 InThreadIndex)
+    : ThreadIndex(InThreadIndex)
+{
+}
+
+FThreadStats& FThreadStats::Get()
+{
+    thread_local FThreadStats* ThreadStats = nullptr;
+    if (ThreadStats == nullptr)
+    {
+        FThreadStatsList& List = GetThreadStatsList();
+        std::lock_guard Lock(List.Mutex);
+
+        // 스레드가 끝나도 Consumer가 남은 이벤트를 읽을 수 있도록 목록이 소유합니다.
+        const uint32 ThreadIndex = static_cast<uint32>(List.ThreadStats.Num());
+        ThreadStats = new FThreadStats(ThreadIndex);
+        List.ThreadStats.Emplace(ThreadStats);
+    }
+    return *ThreadStats;
+}
+
+void FThreadStats::GetAllThreadStats(TArray<FThreadStats*>& OutThreadStats)
+{
+    FThreadStatsList& List = GetThreadStatsList();
+    std::lock_guard Lock(List.Mutex);
+
+    OutThreadStats.Empty();
+    for (const std::unique_ptr<FThreadStats>& ThreadStats : List.ThreadStats)
+    {
+        OutThreadStats.Add(ThreadStats.get());
+    }
+}
+
+uint32 FThreadStats::Drain(TArray<FStatEvent>& OutEvents)
+{
+    const uint32 CurrentTail = Tail.load(std::memory_order_relaxed);
+    const uint32 CurrentHead = Head.load(std::memory_order_acquire);
+    const uint32 Count = CurrentHead - CurrentTail;
+
+    for (uint32 i = 0; i < Count; ++i)
+    {
+        OutEvents.Add(Events[(CurrentTail + i) & (Capacity - 1)]);
+    }
+
+    Tail.store(CurrentHead, std::memory_order_release);
+    return Count;
+}
 
 
 FScopeCycleCounter::FScopeCycleCounter(TStatId StatId)
     : StartCycles(FPlatformTime::Cycles64())
     , UsedStatId(StatId)
 {
+    if (UsedStatId.IsValidStat())
+    {
+        FThreadStats::Get().AddEvent(UsedStatId.StatIndex, EStatEventType::Begin, StartCycles);
+    }
 }
 
 FScopeCycleCounter::~FScopeCycleCounter()
@@ -18,8 +139,11 @@ uint64 FScopeCycleCounter::Finish()
     const uint64 EndCycles = FPlatformTime::Cycles64();
     const uint64 CycleDiff = EndCycles - StartCycles;
 
-    // FThreadStats::AddMessage(UsedStatId, EStatOperation::Add, CycleDiff);
+    if (!bFinished && UsedStatId.IsValidStat())
+    {
+        FThreadStats::Get().AddEvent(UsedStatId.StatIndex, EStatEventType::End, EndCycles);
+    }
+    bFinished = true;
 
     return CycleDiff;
 }
-
@@ -1,4 +1,6 @@
 ﻿#pragma once
+#include <atomic>
+#include "Container/Array.h"
 #include "Container/String.h"
 #include "HAL/PlatformType.h"
 #include "UObject/NameTypes.h"
@@ -8,21 +10,29 @@ struct TStatId
 {
     FName Name;
 
+    /** FStatRegistry에 등록된 번호. 기본 생성된 TStatId는 InvalidIndex이며 기록되지 않습니다. */
+    uint32 StatIndex;
+
+    static constexpr uint32 InvalidIndex = ~0u;
+
     TStatId()
         : Name(NAME_None)
+        , StatIndex(InvalidIndex)
     {
     }
 
-    TStatId(FName Name)
-        : Name(Name)
-    {
-    }
+    TStatId(FName Name);
 
     FName GetName() const
     {
         return Name;
     }
 
+    bool IsValidStat() const
+    {
+        return StatIndex != InvalidIndex;
+    }
+
     bool operator==(const TStatId& Other) const
     {
         return Name == Other.Name;
@@ -35,6 +45,83 @@ struct TStatId
 };
 
 
+/** Stat 이름과 번호의 대응. 같은 이름은 항상 같은 번호를 받습니다. */
+struct FStatRegistry
+{
+    static uint32 Register(FName Name);
+
+    static FName GetStatName(uint32 StatIndex);
+
+    static uint32 Num();
+};
+
+
+enum class EStatEventType : uint32
+{
+    Begin,
+    End,
+};
+
+struct FStatEvent
+{
+    uint64 Cycles;
+    uint32 StatIndex;
+    EStatEventType Type;
+};
+
+
+/**
+ * 스레드 하나가 기록하는 Begin/End 이벤트의 Ring Buffer.
+ * 기록하는 스레드(Producer)와 FStatsThreadState::AdvanceFrame을 호출하는 스레드(Consumer)가 하나씩인 Lock-free 큐입니다.
+ * 가득 차면 새 이벤트를 버리고 NumDropped를 늘립니다.
+ */
+class FThreadStats
+{
+public:
+    static constexpr uint32 Capacity = 1u << 15;
+
+    /** 호출한 스레드의 FThreadStats. 처음 호출할 때 만들어서 등록하고, 프로그램이 끝날 때까지 유지합니다. */
+    static FThreadStats& Get();
+
+    /** 지금까지 등록된 모든 스레드의 FThreadStats */
+    static void GetAllThreadStats(TArray<FThreadStats*>& OutThreadStats);
+
+    void AddEvent(uint32 StatIndex, EStatEventType Type, uint64 Cycles)
+    {
+        const uint32 CurrentHead = Head.load(std::memory_order_relaxed);
+        if (CurrentHead - Tail.load(std::memory_order_acquire) >= Capacity)
+        {
+            NumDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        FStatEvent& Event = Events[CurrentHead & (Capacity - 1)];
+        Event.Cycles = Cycles;
+        Event.StatIndex = StatIndex;
+        Event.Type = Type;
+        Head.store(CurrentHead + 1, std::memory_order_release);
+    }
+
+    /** 쌓인 이벤트를 기록 순서대로 OutEvents 뒤에 붙이고 비웁니다. Consumer 스레드에서만 호출합니다. */
+    uint32 Drain(TArray<FStatEvent>& OutEvents);
+
+    /** 등록된 순서대로 0부터 붙는 번호 */
+    uint32 GetThreadIndex() const { return ThreadIndex; }
+
+    uint64 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+private:
+    explicit FThreadStats(uint32 InThreadIndex);
+
+    alignas(64) std::atomic<uint32> Head = 0;
+    alignas(64) std::atomic<uint32> Tail = 0;
+    std::atomic<uint64> NumDropped = 0;
+    uint32 ThreadIndex;
+
+    FStatEvent Events[Capacity];
+};
+
+
 class FScopeCycleCounter
 {
 public:
@@ -52,8 +139,9 @@ public:
 private:
     uint64 StartCycles;
 
-    [[maybe_unused]]
     TStatId UsedStatId;
+
+    bool bFinished = false;
 };
 
 #define QUICK_SCOPE_CYCLE_COUNTER(Stat) \
@@ -0,0 +1,352 @@
+#include "StatsData.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include "HAL/PlatformTime.h"
+#include "Math/MathUtility.h"
+
+
+FStatsThreadState& FStatsThreadState::Get()
+{
+    static FStatsThreadState Instance;
+    return Instance;
+}
+
+void FStatsThreadState::AdvanceFrame()
+{
+    MainThreadIndex = FThreadStats::Get().GetThreadIndex();
+
+    FThreadStats::GetAllThreadStats(ThreadStatsScratch);
+    const int32 NumThreads = ThreadStatsScratch.Num();
+
+    const uint32 NumStats = FStatRegistry::Num();
+    FrameCycles.Init(0, static_cast<int32>(NumStats));
+    FrameCallCounts.Init(0, static_cast<int32>(NumStats));
+
+    if (ThreadStates.Num() < NumThreads)
+    {
+        ThreadStates.SetNum(NumThreads);
+    }
+    LastFrameTrees.SetNum(NumThreads);
+
+    for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+    {
+        FThreadStats* ThreadStats = ThreadStatsScratch[ThreadIndex];
+        FThreadState& State = ThreadStates[ThreadIndex];
+        FStatThreadTree& Tree = LastFrameTrees[ThreadIndex];
+
+        State.ThreadIndex = ThreadStats->GetThreadIndex();
+        Tree.ThreadIndex = State.ThreadIndex;
+        Tree.Nodes.Empty();
+        Tree.Nodes.Add(FStatCallNode());
+
+        // 이전 프레임에서 끝나지 않은 Scope를 새 Tree에 다시 연결합니다.
+        int32 ParentIndex = 0;
+        for (FOpenScope& Scope : State.OpenScopes)
+        {
+            Scope.NodeIndex = FindOrAddChild(Tree, ParentIndex, Scope.StatIndex);
+            ParentIndex = Scope.NodeIndex;
+        }
+
+        EventScratch.Empty();
+        ThreadStats->Drain(EventScratch);
+        ProcessEvents(State, Tree, EventScratch);
+    }
+
+    // 아직 열려 있는 Scope는 프레임 경계까지의 시간만 이번 프레임에 더합니다.
+    const uint64 FrameEndCycles = FPlatformTime::Cycles64();
+    for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+    {
+        FThreadState& State = ThreadStates[ThreadIndex];
+        FStatThreadTree& Tree = LastFrameTrees[ThreadIndex];
+
+        for (int32 ScopeIndex = 0; ScopeIndex < State.OpenScopes.Num(); ++ScopeIndex)
+        {
+            FOpenScope& Scope = State.OpenScopes[ScopeIndex];
+            const uint64 Elapsed = FrameEndCycles > Scope.StartCycles ? FrameEndCycles - Scope.StartCycles : 0;
+            Tree.Nodes[Scope.NodeIndex].InclusiveCycles += Elapsed;
+
+            bool bOutermost = true;
+            for (int32 OuterIndex = 0; OuterIndex < ScopeIndex; ++OuterIndex)
+            {
+                bOutermost &= State.OpenScopes[OuterIndex].StatIndex != Scope.StatIndex;
+            }
+            if (bOutermost)
+            {
+                FrameCycles[Scope.StatIndex] += Elapsed;
+            }
+
+            Scope.StartCycles = FMath::Max(Scope.StartCycles, FrameEndCycles);
+        }
+    }
+
+    if (Histories.Num() < FrameCycles.Num())
+    {
+        Histories.SetNum(FrameCycles.Num());
+    }
+
+    const uint32 HistorySlot = static_cast<uint32>(NumFrames % HistoryFrames);
+    for (int32 StatIndex = 0; StatIndex < FrameCycles.Num(); ++StatIndex)
+    {
+        Histories[StatIndex].Cycles[HistorySlot] = FrameCycles[StatIndex];
+        Histories[StatIndex].CallCounts[HistorySlot] = FrameCallCounts[StatIndex];
+    }
+    ++NumFrames;
+}
+
+void FStatsThreadState::EnsureStatCapacity(FThreadState& State, uint32 StatIndex)
+{
+    // AdvanceFrame 시작 이후에 등록된 Stat도 받아들입니다.
+    const int32 Required = static_cast<int32>(StatIndex) + 1;
+    if (State.OpenDepth.Num() < Required)
+    {
+        State.OpenDepth.SetNum(Required);
+    }
+    if (FrameCycles.Num() < Required)
+    {
+        FrameCycles.SetNum(Required);
+        FrameCallCounts.SetNum(Required);
+    }
+}
+
+void FStatsThreadState::ProcessEvents(FThreadState& State, FStatThreadTree& Tree, const TArray<FStatEvent>& Events)
+{
+    for (const FStatEvent& Event : Events)
+    {
+        EnsureStatCapacity(State, Event.StatIndex);
+
+        if (Event.Type == EStatEventType::Begin)
+        {
+            const int32 ParentIndex = State.OpenScopes.Num() > 0 ? State.OpenScopes[State.OpenScopes.Num() - 1].NodeIndex : 0;
+
+            FOpenScope Scope;
+            Scope.StatIndex = Event.StatIndex;
+            Scope.StartCycles = Event.Cycles;
+            Scope.BeginCycles = Event.Cycles;
+            Scope.NodeIndex = FindOrAddChild(Tree, ParentIndex, Event.StatIndex);
+            State.OpenScopes.Add(Scope);
+            ++State.OpenDepth[Event.StatIndex];
+            continue;
+        }
+
+        // End 이벤트와 짝이 맞는 Scope를 찾습니다. Ring Buffer가 넘쳐 Begin이 버려졌다면 무시합니다.
+        int32 MatchIndex = State.OpenScopes.Num() - 1;
+        while (MatchIndex >= 0 && State.OpenScopes[MatchIndex].StatIndex != Event.StatIndex)
+        {
+            --MatchIndex;
+        }
+        if (MatchIndex == INDEX_NONE)
+        {
+            continue;
+        }
+
+        // End가 버려진 안쪽 Scope는 바깥 Scope와 같은 시각에 닫습니다.
+        while (State.OpenScopes.Num() > MatchIndex)
+        {
+            EndScope(State, Tree, Event.Cycles);
+        }
+    }
+}
+
+int32 FStatsThreadState::FindOrAddChild(FStatThreadTree& Tree, int32 ParentIndex, uint32 StatIndex)
+{
+    int32 LastChild = INDEX_NONE;
+    for (int32 Child = Tree.Nodes[ParentIndex].FirstChild; Child != INDEX_NONE; Child = Tree.Nodes[Child].NextSibling)
+    {
+        if (Tree.Nodes[Child].StatIndex == StatIndex)
+        {
+            return Child;
+        }
+        LastChild = Child;
+    }
+
+    FStatCallNode Node;
+    Node.StatIndex = StatIndex;
+    Node.Parent = ParentIndex;
+    Node.Depth = Tree.Nodes[ParentIndex].Depth + 1;
+    const int32 NewIndex = Tree.Nodes.Add(Node);
+
+    // 처음 호출된 순서대로 보이도록 마지막 형제 뒤에 붙입니다.
+    if (LastChild == INDEX_NONE)
+    {
+        Tree.Nodes[ParentIndex].FirstChild = NewIndex;
+    }
+    else
+    {
+        Tree.Nodes[LastChild].NextSibling = NewIndex;
+    }
+    return NewIndex;
+}
+
+void FStatsThreadState::EndScope(FThreadState& State, FStatThreadTree& Tree, uint64 EndCycles)
+{
+    const FOpenScope Scope = State.OpenScopes.Pop();
+    const uint64 Elapsed = EndCycles > Scope.StartCycles ? EndCycles - Scope.StartCycles : 0;
+
+    FStatCallNode& Node = Tree.Nodes[Scope.NodeIndex];
+    Node.InclusiveCycles += Elapsed;
+    ++Node.CallCount;
+
+    ++FrameCallCounts[Scope.StatIndex];
+    if (--State.OpenDepth[Scope.StatIndex] == 0)
+    {
+        FrameCycles[Scope.StatIndex] += Elapsed;
+    }
+
+    if (bCapturingTrace && TraceEvents.Num() < MaxTraceEvents && Scope.BeginCycles >= TraceStartCycles)
+    {
+        TraceEvents.Add({ Scope.StatIndex, State.ThreadIndex, Scope.BeginCycles, EndCycles });
+    }
+}
+
+void FStatsThreadState::GetSummaries(TArray<FStatSummary>& OutSummaries) const
+{
+    OutSummaries.Empty();
+    if (NumFrames == 0)
+    {
+        return;
+    }
+
+    const uint32 NumHistory = static_cast<uint32>(FMath::Min<uint64>(NumFrames, HistoryFrames));
+    const uint32 LastSlot = static_cast<uint32>((NumFrames - 1) % HistoryFrames);
+
+    for (int32 StatIndex = 0; StatIndex < Histories.Num(); ++StatIndex)
+    {
+        const FStatHistory& History = Histories[StatIndex];
+
+        uint32 NumHitFrames = 0;
+        uint64 MinCycles = ~0ull;
+        uint64 MaxCycles = 0;
+        uint64 TotalCycles = 0;
+        for (uint32 Slot = 0; Slot < NumHistory; ++Slot)
+        {
+            if (History.CallCounts[Slot] == 0 && History.Cycles[Slot] == 0)
+            {
+                continue;
+            }
+            ++NumHitFrames;
+            MinCycles = FMath::Min(MinCycles, History.Cycles[Slot]);
+            MaxCycles = FMath::Max(MaxCycles, History.Cycles[Slot]);
+            TotalCycles += History.Cycles[Slot];
+        }
+
+        if (NumHitFrames == 0)
+        {
+            continue;
+        }
+
+        FStatSummary Summary;
+        Summary.StatIndex = static_cast<uint32>(StatIndex);
+        Summary.Name = FStatRegistry::GetStatName(Summary.StatIndex);
+        Summary.LastCallCount = History.CallCounts[LastSlot];
+        Summary.LastMs = FPlatformTime::ToMilliseconds(History.Cycles[LastSlot]);
+        Summary.MinMs = FPlatformTime::ToMilliseconds(MinCycles);
+        Summary.MaxMs = FPlatformTime::ToMilliseconds(MaxCycles);
+        Summary.AvgMs = FPlatformTime::ToMilliseconds(TotalCycles) / NumHitFrames;
+        OutSummaries.Add(Summary);
+    }
+
+    OutSummaries.Sort([](const FStatSummary& A, const FStatSummary& B)
+    {
+        return A.AvgMs > B.AvgMs;
+    });
+}
+
+uint64 FStatsThreadState::GetNumDroppedEvents() const
+{
+    TArray<FThreadStats*> AllThreadStats;
+    FThreadStats::GetAllThreadStats(AllThreadStats);
+
+    uint64 NumDropped = 0;
+    for (const FThreadStats* ThreadStats : AllThreadStats)
+    {
+        NumDropped += ThreadStats->GetNumDropped();
+    }
+    return NumDropped;
+}
+
+void FStatsThreadState::StartTraceCapture()
+{
+    TraceEvents.Empty();
+    TraceStartCycles = FPlatformTime::Cycles64();
+    bCapturingTrace = true;
+}
+
+bool FStatsThreadState::StopTraceCapture(const FString& FilePath)
+{
+    bCapturingTrace = false;
+
+    const std::filesystem::path Path(FilePath.ToWideString());
+    std::error_code ErrorCode;
+    if (Path.has_parent_path())
+    {
+        std::filesystem::create_directories(Path.parent_path(), ErrorCode);
+    }
+
+    std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+    if (!File.is_open())
+    {
+        return false;
+    }
+
+    const std::string Json = ExportTraceJson();
+    File.write(Json.data(), static_cast<std::streamsize>(Json.size()));
+    return File.good();
+}
+
+std::string FStatsThreadState::ExportTraceJson() const
+{
+    std::string Json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    char Buffer[256];
+    bool bFirst = true;
+
+    auto AppendEvent = [&Json, &bFirst](const char* Event)
+    {
+        if (!bFirst)
+        {
+            Json += ",\n";
+        }
+        Json += Event;
+        bFirst = false;
+    };
+
+    // 스레드 이름
+    uint32 NumThreads = 0;
+    for (const FTraceEvent& Event : TraceEvents)
+    {
+        NumThreads = FMath::Max(NumThreads, Event.ThreadIndex + 1);
+    }
+    for (uint32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+    {
+        const bool bMainThread = ThreadIndex == MainThreadIndex;
+        snprintf(Buffer, sizeof(Buffer),
+            R"({"name":"thread_name","ph":"M","pid":1,"tid":%u,"args":{"name":"%s %u"}})",
+            ThreadIndex, bMainThread ? "MainThread" : "Thread", ThreadIndex
+        );
+        AppendEvent(Buffer);
+    }
+
+    // Stat 이름은 식별자이므로 따로 이스케이프하지 않습니다.
+    TArray<std::string> StatNames;
+    for (uint32 StatIndex = 0, NumStats = FStatRegistry::Num(); StatIndex < NumStats; ++StatIndex)
+    {
+        StatNames.Add(std::string(*FStatRegistry::GetStatName(StatIndex).ToString()));
+    }
+
+    for (const FTraceEvent& Event : TraceEvents)
+    {
+        const double StartUs = FPlatformTime::ToMilliseconds(Event.StartCycles - TraceStartCycles) * 1000.0;
+        const double DurationUs = FPlatformTime::ToMilliseconds(Event.EndCycles - Event.StartCycles) * 1000.0;
+        const char* Name = Event.StatIndex < static_cast<uint32>(StatNames.Num()) ? StatNames[Event.StatIndex].c_str() : "Unknown";
+
+        snprintf(Buffer, sizeof(Buffer),
+            R"({"name":"%s","cat":"stat","ph":"X","pid":1,"tid":%u,"ts":%.3f,"dur":%.3f})",
+            Name, Event.ThreadIndex, StartUs, DurationUs
+        );
+        AppendEvent(Buffer);
+    }
+
+    Json += "]}\n";
+    return Json;
+}
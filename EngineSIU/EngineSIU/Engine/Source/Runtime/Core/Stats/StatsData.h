@@ -0,0 +1,147 @@
+#pragma once
+#include <string>
+#include "CoreMiscDefines.h"
+#include "Stats.h"
+
+
+/**
+ * 한 프레임 동안 한 스레드에서 호출된 Stat의 Call Tree 노드.
+ * 같은 부모 아래에서 같은 Stat이 여러 번 호출되면 하나의 노드로 합쳐집니다.
+ */
+struct FStatCallNode
+{
+    uint32 StatIndex = TStatId::InvalidIndex;
+    int32 Parent = INDEX_NONE;
+    int32 FirstChild = INDEX_NONE;
+    int32 NextSibling = INDEX_NONE;
+    uint32 Depth = 0;
+
+    uint64 InclusiveCycles = 0;
+    uint32 CallCount = 0;
+};
+
+/** 스레드 하나의 Call Tree. Nodes[0]은 이름이 없는 루트입니다. */
+struct FStatThreadTree
+{
+    uint32 ThreadIndex = 0;
+    TArray<FStatCallNode> Nodes;
+};
+
+/** 최근 프레임들에 대한 Stat 하나의 요약 (밀리초) */
+struct FStatSummary
+{
+    uint32 StatIndex = TStatId::InvalidIndex;
+    FName Name;
+
+    /** 마지막 프레임의 호출 횟수와 시간 (모든 스레드 합계) */
+    uint32 LastCallCount = 0;
+    double LastMs = 0.0;
+
+    /** 기록된 프레임 중 이 Stat이 호출된 프레임 기준 */
+    double MinMs = 0.0;
+    double AvgMs = 0.0;
+    double MaxMs = 0.0;
+};
+
+
+/**
+ * 모든 스레드의 FThreadStats를 프레임마다 모아 Call Tree와 Stat별 통계를 만듭니다.
+ * AdvanceFrame과 조회 함수는 같은 스레드(메인 스레드)에서만 호출합니다.
+ */
+class FStatsThreadState
+{
+public:
+    /** Min/Avg/Max를 계산할 프레임 수 */
+    static constexpr uint32 HistoryFrames = 120;
+
+    /** Trace 캡처가 무한히 커지지 않도록 두는 이벤트 개수 상한 */
+    static constexpr int32 MaxTraceEvents = 1 << 20;
+
+    static FStatsThreadState& Get();
+
+    /** 모든 스레드의 이벤트를 읽어 이번 프레임을 마감합니다. 끝나지 않은 Scope는 다음 프레임으로 이어집니다. */
+    void AdvanceFrame();
+
+    /** 마지막으로 마감한 프레임의 스레드별 Call Tree */
+    const TArray<FStatThreadTree>& GetLastFrameTrees() const { return LastFrameTrees; }
+
+    /** AdvanceFrame을 호출하는 스레드의 번호. Call Tree 표시에서 메인 스레드를 고를 때 사용합니다. */
+    uint32 GetMainThreadIndex() const { return MainThreadIndex; }
+
+    /** 기록된 모든 Stat의 요약을 AvgMs 내림차순으로 채웁니다. */
+    void GetSummaries(TArray<FStatSummary>& OutSummaries) const;
+
+    uint64 GetNumFrames() const { return NumFrames; }
+
+    /** Ring Buffer가 가득 차서 버려진 이벤트의 총 개수 */
+    uint64 GetNumDroppedEvents() const;
+
+    void StartTraceCapture();
+
+    /** 캡처를 멈추고 chrome://tracing, Perfetto에서 열 수 있는 JSON으로 저장합니다. */
+    bool StopTraceCapture(const FString& FilePath);
+
+    bool IsCapturingTrace() const { return bCapturingTrace; }
+
+    /** 캡처한 이벤트를 Chrome Trace Event JSON 문자열로 만듭니다. */
+    std::string ExportTraceJson() const;
+
+private:
+    struct FOpenScope
+    {
+        uint32 StatIndex;
+        /** 이번 프레임에 더할 시간의 시작점. 프레임을 넘기면 프레임 경계로 옮겨집니다. */
+        uint64 StartCycles;
+        /** Trace에 기록할 실제 시작 시각 */
+        uint64 BeginCycles;
+        int32 NodeIndex;
+    };
+
+    /** 프레임을 넘어 유지되는 스레드별 상태 */
+    struct FThreadState
+    {
+        uint32 ThreadIndex = 0;
+        TArray<FOpenScope> OpenScopes;
+        /** Stat별로 열려 있는 Scope 수. 재귀 호출의 시간을 두 번 더하지 않기 위해 사용합니다. */
+        TArray<uint32> OpenDepth;
+    };
+
+    struct FTraceEvent
+    {
+        uint32 StatIndex;
+        uint32 ThreadIndex;
+        uint64 StartCycles;
+        uint64 EndCycles;
+    };
+
+    struct FStatHistory
+    {
+        uint64 Cycles[HistoryFrames] = {};
+        uint32 CallCounts[HistoryFrames] = {};
+    };
+
+    void EnsureStatCapacity(FThreadState& State, uint32 StatIndex);
+    void ProcessEvents(FThreadState& State, FStatThreadTree& Tree, const TArray<FStatEvent>& Events);
+    int32 FindOrAddChild(FStatThreadTree& Tree, int32 ParentIndex, uint32 StatIndex);
+    void EndScope(FThreadState& State, FStatThreadTree& Tree, uint64 EndCycles);
+
+private:
+    TArray<FThreadState> ThreadStates;
+    TArray<FStatThreadTree> LastFrameTrees;
+
+    /** 이번 프레임의 Stat별 시간과 호출 횟수 (모든 스레드 합계) */
+    TArray<uint64> FrameCycles;
+    TArray<uint32> FrameCallCounts;
+
+    TArray<FStatHistory> Histories;
+    uint64 NumFrames = 0;
+
+    uint32 MainThreadIndex = 0;
+
+    TArray<FStatEvent> EventScratch;
+    TArray<FThreadStats*> ThreadStatsScratch;
+
+    bool bCapturingTrace = false;
+    uint64 TraceStartCycles = 0;
+    TArray<FTraceEvent> TraceEvents;
+};
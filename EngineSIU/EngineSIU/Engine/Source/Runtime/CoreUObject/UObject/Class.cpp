@@ -1,5 +1,6 @@
 #include "Class.h"
 #include <cassert>
+#include <cstring>
 
 #include "EngineStatics.h"
 #include "UObjectArray.h"
@@ -19,22 +20,58 @@ UClass::UClass(
     , SuperClass(InSuperClass)
 {
     NamePrivate = InClassName;
+
+    // StaticClass()는 부모의 StaticClass()를 먼저 부르므로, 부모는 항상 이미 트리에 들어 있습니다.
+    if (SuperClass)
+    {
+        SuperClass->ChildClasses.Add(this);
+    }
+    else
+    {
+        GetRootClasses().Add(this);
+    }
+    RebuildClassTree();
+}
+
+UClass::~UClass()
+{
+    for (const FProperty* Prop : Properties)
+    {
+        delete Prop;
+    }
 }
 
-bool UClass::IsChildOf(const UClass* SomeBase) const
+TArray<UClass*>& UClass::GetClassTree()
 {
-    assert(this);
-    if (!SomeBase) return false;
+    static TArray<UClass*> ClassTree;
+    return ClassTree;
+}
+
+TArray<UClass*>& UClass::GetRootClasses()
+{
+    static TArray<UClass*> RootClasses;
+    return RootClasses;
+}
 
-    // Super의 Super를 반복하면서 
-    for (const UClass* TempClass = this; TempClass; TempClass=TempClass->GetSuperClass())
+void UClass::RebuildClassTree()
+{
+    // 클래스는 모두 정적 초기화 중에 (ClassRegistrar) 만들어지므로, 다른 스레드가 IsChildOf를 부르는 동안 다시 매겨지지 않습니다.
+    TArray<UClass*>& ClassTree = GetClassTree();
+    ClassTree.Empty();
+    for (UClass* RootClass : GetRootClasses())
     {
-        if (TempClass == SomeBase)
-        {
-            return true;
-        }
+        RootClass->AssignClassTreeIndex(ClassTree);
+    }
+}
+
+void UClass::AssignClassTreeIndex(TArray<UClass*>& ClassTree)
+{
+    ClassTreeIndex = static_cast<uint32>(ClassTree.Add(this));
+    for (UClass* ChildClass : ChildClasses)
+    {
+        ChildClass->AssignClassTreeIndex(ClassTree);
     }
-    return false;
+    NumDerivedClasses = static_cast<uint32>(ClassTree.Num()) - ClassTreeIndex - 1;
 }
 
 UObject* UClass::GetDefaultObject() const
@@ -46,24 +83,152 @@ UObject* UClass::GetDefaultObject() const
     return ClassDefaultObject;
 }
 
-void UClass::RegisterProperty(const FProperty& Prop)
+void UClass::RegisterProperty(FProperty* Prop)
 {
     Properties.Add(Prop);
+
+    // 자식 클래스의 캐시에도 이 Property가 들어가야 하므로, 클래스 트리에서 이 클래스 아래를 모두 무효화합니다.
+    const TArray<UClass*>& ClassTree = GetClassTree();
+    for (uint32 Index = ClassTreeIndex; Index <= ClassTreeIndex + NumDerivedClasses; ++Index)
+    {
+        ClassTree[Index]->PropertyCache.bValid = false;
+    }
 }
 
-void UClass::SerializeBin(FArchive& Ar, void* Data)
+const UClass::FPropertyCache& UClass::GetPropertyCache() const
 {
-    // 상속받은 클래스의 프로퍼티들도 직렬화
+    // Property는 정적 초기화 중에 등록되므로, 그 뒤에 처음 호출될 때 한 번만 만들어집니다.
+    if (PropertyCache.bValid)
+    {
+        return PropertyCache;
+    }
+
+    FPropertyCache& Cache = PropertyCache;
+    Cache.AllProperties.Empty();
+    Cache.CopyRanges.Empty();
+    Cache.CopyProperties.Empty();
+    Cache.ReferenceProperties.Empty();
+
     if (SuperClass)
     {
-        SuperClass->SerializeBin(Ar, Data);
+        Cache.AllProperties = SuperClass->GetAllProperties();
+    }
+    Cache.AllProperties.Append(Properties);
+
+    TArray<FProperty*> PlainProperties;
+    for (FProperty* Prop : Cache.AllProperties)
+    {
+        if (Prop->HasAnyFlags(CPF_DuplicateTransient))
+        {
+            continue;
+        }
+        if (Prop->HasAnyFlags(CPF_ObjectReference))
+        {
+            Cache.ReferenceProperties.Add(Prop);
+            continue;
+        }
+        if (Prop->HasAnyFlags(CPF_IsPlainOldData))
+        {
+            PlainProperties.Add(Prop);
+        }
+        else
+        {
+            Cache.CopyProperties.Add(Prop);
+        }
     }
 
-    // 이 클래스의 프로퍼티들 직렬화
-    for (const FProperty& Prop : Properties)
+    // 메모리에서 바로 이어지는 Property끼리 구간을 합칩니다. 사이에 패딩이나 Property가 아닌 멤버가 있으면 나눕니다.
+    PlainProperties.Sort([](const FProperty* A, const FProperty* B) { return A->Offset < B->Offset; });
+    for (const FProperty* Prop : PlainProperties)
+    {
+        if (Cache.CopyRanges.Num() > 0)
+        {
+            FCopyRange& Last = Cache.CopyRanges[Cache.CopyRanges.Num() - 1];
+            if (Last.Offset + Last.Size == Prop->Offset)
+            {
+                Last.Size += Prop->Size;
+                continue;
+            }
+        }
+        Cache.CopyRanges.Add({Prop->Offset, Prop->Size});
+    }
+
+    Cache.bValid = true;
+    return Cache;
+}
+
+const TArray<FProperty*>& UClass::GetAllProperties() const
+{
+    return GetPropertyCache().AllProperties;
+}
+
+FProperty* UClass::FindPropertyByName(const FString& Name) const
+{
+    for (FProperty* Prop : GetAllProperties())
+    {
+        if (Name == Prop->Name)
+        {
+            return Prop;
+        }
+    }
+    return nullptr;
+}
+
+void UClass::SerializeBin(FArchive& Ar, void* Data) const
+{
+    for (const FProperty* Prop : GetAllProperties())
+    {
+        Prop->SerializeItem(Ar, Prop->ContainerPtrToValuePtr(Data));
+    }
+}
+
+void UClass::ExportProperties(const void* Data, TMap<FString, FString>& OutProperties) const
+{
+    FString Text;
+    for (const FProperty* Prop : GetAllProperties())
+    {
+        if (Prop->HasAnyFlags(CPF_ObjectReference))
+        {
+            continue;
+        }
+        Prop->ExportText(Prop->ContainerPtrToValuePtr(Data), Text);
+        OutProperties.Add(Prop->Name, Text);
+    }
+}
+
+void UClass::ImportProperties(const TMap<FString, FString>& InProperties, void* Data) const
+{
+    for (const FProperty* Prop : GetAllProperties())
+    {
+        if (Prop->HasAnyFlags(CPF_ObjectReference))
+        {
+            continue;
+        }
+        if (const FString* Text = InProperties.Find(Prop->Name))
+        {
+            Prop->ImportText(*Text, Prop->ContainerPtrToValuePtr(Data));
+        }
+    }
+}
+
+void UClass::CopyProperties(void* Dest, const void* Src) const
+{
+    const FPropertyCache& Cache = GetPropertyCache();
+    for (const FCopyRange& Range : Cache.CopyRanges)
+    {
+        std::memcpy(static_cast<uint8*>(Dest) + Range.Offset, static_cast<const uint8*>(Src) + Range.Offset, Range.Size);
+    }
+    for (const FProperty* Prop : Cache.CopyProperties)
+    {
+        Prop->CopyValue(Prop->ContainerPtrToValuePtr(Dest), Prop->ContainerPtrToValuePtr(Src));
+    }
+}
+
+void UClass::CopyObjectReferences(void* Dest, const void* Src, const TMap<UObject*, UObject*>& ObjectMap) const
+{
+    for (const FProperty* Prop : GetPropertyCache().ReferenceProperties)
     {
-        void* PropData = static_cast<uint8*>(Data) + Prop.Offset;
-        Ar.Serialize(PropData, Prop.Size);
+        Prop->CopyValueRemapped(Prop->ContainerPtrToValuePtr(Dest), Prop->ContainerPtrToValuePtr(Src), ObjectMap);
     }
 }
 
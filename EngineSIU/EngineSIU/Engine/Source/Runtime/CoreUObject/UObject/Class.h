@@ -27,6 +27,8 @@ public:
     UClass(UClass&&) = delete;
     UClass& operator=(UClass&&) = delete;
 
+    virtual ~UClass() override;
+
     static TMap<FName, UClass*>& GetClassMap()
     {
         static TMap<FName, UClass*> ClassMap;
@@ -43,8 +45,12 @@ public:
     uint32 GetClassSize() const { return ClassSize; }
     uint32 GetClassAlignment() const { return ClassAlignment; }
 
-    /** SomeBase의 자식 클래스인지 확인합니다. */
-    bool IsChildOf(const UClass* SomeBase) const;
+    /** SomeBase의 자식 클래스인지 확인합니다. 클래스 트리 구간을 비교하므로 상속 깊이와 관계없이 상수 시간입니다. */
+    FORCEINLINE bool IsChildOf(const UClass* SomeBase) const
+    {
+        // ClassTreeIndex가 SomeBase보다 작으면 뺄셈이 감싸져 NumDerivedClasses보다 커집니다.
+        return SomeBase && ClassTreeIndex - SomeBase->ClassTreeIndex <= SomeBase->NumDerivedClasses;
+    }
 
     template <typename T>
         requires std::derived_from<T, UObject>
@@ -59,24 +65,79 @@ public:
 
     UObject* GetDefaultObject() const;
 
+    /**
+     * 모든 UClass를 클래스 트리의 전위 순서로 담은 목록입니다.
+     * 어떤 클래스의 파생 클래스들은 [GetClassTreeIndex() + 1, GetClassTreeIndex() + GetNumDerivedClasses()]에 모여 있습니다.
+     */
+    static const TArray<UClass*>& GetClassesInTreeOrder() { return GetClassTree(); }
+
+    uint32 GetClassTreeIndex() const { return ClassTreeIndex; }
+
+    /** 직접, 간접적으로 이 클래스를 상속한 클래스의 수 */
+    uint32 GetNumDerivedClasses() const { return NumDerivedClasses; }
+
+    /**
+     * 정확히 이 클래스인 살아있는 Object 목록입니다. 파생 클래스의 Object는 들어있지 않습니다.
+     * 제거할 때 마지막 요소를 그 자리로 옮기므로 순서는 유지되지 않습니다.
+     */
+    const TArray<UObject*>& GetClassObjects() const { return ClassObjects; }
+
     template <typename T>
         requires std::derived_from<T, UObject>
     T* GetDefaultObject() const;
 
-    const TArray<FProperty>& GetProperties() const { return Properties; }
+    /** 이 클래스에서 선언한 Property 목록. 부모 클래스의 Property는 들어있지 않습니다. */
+    const TArray<FProperty*>& GetProperties() const { return Properties; }
+
+    /** 부모 클래스의 Property부터 차례로 모은 전체 Property 목록 */
+    const TArray<FProperty*>& GetAllProperties() const;
+
+    /** 이 클래스와 부모 클래스에서 이름이 Name인 Property를 찾습니다. */
+    FProperty* FindPropertyByName(const FString& Name) const;
 
     /**
-     * UClass에 Property를 추가합니다
+     * UClass에 Property를 추가합니다. UClass가 Property의 소유권을 가집니다.
      * @param Prop 추가할 Property
      */
-    void RegisterProperty(const FProperty& Prop);
+    void RegisterProperty(FProperty* Prop);
+
+    /** 전체 Property를 선언 순서대로 바이너리로 읽거나 씁니다. */
+    void SerializeBin(FArchive& Ar, void* Data) const;
+
+    /** 다른 Object를 가리키지 않는 Property를 이름, 문자열 쌍으로 씁니다. */
+    void ExportProperties(const void* Data, TMap<FString, FString>& OutProperties) const;
+
+    /** ExportProperties로 만든 맵에서 값을 읽습니다. 맵에 없거나 형식이 맞지 않는 Property는 그대로 둡니다. */
+    void ImportProperties(const TMap<FString, FString>& InProperties, void* Data) const;
+
+    /**
+     * Src의 Property 값을 Dest로 복사합니다. 두 Object는 이 클래스이거나 자식 클래스여야 합니다.
+     * 다른 Object를 가리키는 Property와 CPF_DuplicateTransient인 Property는 복사하지 않습니다.
+     * 붙어 있는 Plain Old Data Property들은 memcpy 한 번으로 복사합니다.
+     */
+    void CopyProperties(void* Dest, const void* Src) const;
 
-    /** 바이너리 직렬화 함수 */
-    void SerializeBin(FArchive& Ar, void* Data);
+    /**
+     * Src에서 다른 Object를 가리키는 Property만 Dest로 복사합니다. ObjectMap에 있는 Object는 짝이 되는 Object로 바꿉니다.
+     * CPF_DuplicateTransient인 Property는 복사하지 않습니다.
+     */
+    void CopyObjectReferences(void* Dest, const void* Src, const TMap<UObject*, UObject*>& ObjectMap) const;
 
 protected:
     virtual UObject* CreateDefaultObject();
 
+private:
+    friend void AddToClassMap(UObject* Object);
+    friend void AddToClassMap(const TArray<UObject*>& Objects);
+    friend void RemoveFromClassMap(UObject* Object);
+
+    static TArray<UClass*>& GetClassTree();
+    static TArray<UClass*>& GetRootClasses();
+
+    /** 새 클래스가 등록될 때마다 전체 클래스 트리의 전위 순서를 다시 매깁니다. */
+    static void RebuildClassTree();
+    void AssignClassTreeIndex(TArray<UClass*>& ClassTree);
+
 
 public:
     ClassConstructorType ClassCTOR;
@@ -88,7 +149,35 @@ private:
     UClass* SuperClass = nullptr;
     UObject* ClassDefaultObject = nullptr;
 
-    TArray<FProperty> Properties;
+    /** 이 클래스를 바로 상속한 클래스들 */
+    TArray<UClass*> ChildClasses;
+
+    uint32 ClassTreeIndex = 0;
+    uint32 NumDerivedClasses = 0;
+
+    TArray<UObject*> ClassObjects;
+
+    TArray<FProperty*> Properties;
+
+    /** memcpy 한 번으로 복사할 Object 안의 구간 */
+    struct FCopyRange
+    {
+        int64 Offset;
+        int64 Size;
+    };
+
+    /** 부모 클래스까지 포함한 Property 정보. 처음 쓸 때 만들고, 이 클래스나 부모에 Property가 추가되면 다시 만듭니다. */
+    struct FPropertyCache
+    {
+        TArray<FProperty*> AllProperties;
+        TArray<FCopyRange> CopyRanges;
+        TArray<FProperty*> CopyProperties;
+        TArray<FProperty*> ReferenceProperties;
+        bool bValid = false;
+    };
+    mutable FPropertyCache PropertyCache;
+
+    const FPropertyCache& GetPropertyCache() const;
 };
 
 template <typename T>
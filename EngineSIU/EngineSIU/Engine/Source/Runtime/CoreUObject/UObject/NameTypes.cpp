@@ -2,9 +2,10 @@
 
 #include <assert.h>
 #include <atomic>
-#include <cwchar>
+#include <cstddef>
+#include <cstring>
 #include <mutex>
-#include "Core/Container/Map.h"
+#include "Core/Container/Array.h"
 #include "Core/Container/String.h"
 
 
@@ -14,375 +15,415 @@ enum ENameCase : uint8
 	CaseSensitive // 대소문자 구분
 };
 
-/** ANSICAHR나 WIDECHAR를 담는 인터페이스 비슷한 클래스 */
-struct FNameStringView
-{
-	FNameStringView() : Data(nullptr), Len(0), bIsWide(false) {}
-	FNameStringView(const ANSICHAR* Str, uint32 InLen) : Ansi(Str), Len(InLen), bIsWide(false) {}
-	FNameStringView(const WIDECHAR* Str, uint32 InLen) : Wide(Str), Len(InLen), bIsWide(true) {}
-	FNameStringView(const void* InData, uint32 InLen, bool bInIsWide) : Data(InData), Len(InLen), bIsWide(bInIsWide) {}
-
-	union
-	{
-		const void* Data;
-		const ANSICHAR* Ansi;
-		const WIDECHAR* Wide;
-	};
-
-	uint32 Len;
-	bool bIsWide;
+/**
+ * FNameEntryId는 Name Arena 안의 위치입니다.
+ * 상위 비트는 Block 번호, 하위 NameBlockOffsetBits 비트는 Block 안의 위치를 NameEntryStride 단위로 나타냅니다.
+ */
+static constexpr uint32 NameBlockOffsetBits = 16;
+static constexpr uint32 NameBlockOffsets = 1u << NameBlockOffsetBits;
+static constexpr uint32 MaxNameBlocks = 1u << 13;
 
-	bool IsAnsi() const { return !bIsWide; }
-};
-
-
-/** FName의 Hash값을 담는 클래스, FNameEntry에서 사용 */
+/** FName의 Entry 위치, 0은 "None" */
 struct FNameEntryId
 {
-	uint32 Value = 0;  // 비교 문자열이 있는 해시
-
-	bool IsNone() const { return !Value; }
+	uint32 Value = 0;
 
-	bool operator==(const FNameEntryId& Other) const
-	{
-		return Value == Other.Value;
-	}
-
-	bool operator!=(const FNameEntryId& Other) const
-	{
-		return !(*this == Other);
-	}
-
-	explicit operator bool() const noexcept
-	{
-		return Value != 0;
-	}
+	uint32 GetBlock() const { return Value >> NameBlockOffsetBits; }
+	uint32 GetOffset() const { return Value & (NameBlockOffsets - 1); }
 };
 
 /** Entry에 담기는 Name의 정보 */
 struct FNameEntryHeader
 {
-	uint16 IsWide : 1; // wchar인지 여부
-	uint16 Len : 15;   // FName의 길이 0 ~ 32767
+	uint16 Len; // Null 문자를 제외한 길이
 };
 
-
+/**
+ * Name Arena에 저장되는 가변 길이 Entry.
+ * 실제로는 AnsiName의 Len + 1 바이트만 할당되므로 값으로 복사하면 안 됩니다.
+ */
 struct FNameEntry
 {
-	FNameEntryId ComparisonId; // 비교 문자열이 있는 해시
-	FNameEntryHeader Header;   // Name의 정보
-
-	union
-	{
-		ANSICHAR AnsiName[NAME_SIZE];
-		WIDECHAR WideName[NAME_SIZE];
-	};
+	FNameEntryId ComparisonId; // 대소문자를 무시했을 때 같은 이름 중 처음 등록된 Entry
+	FNameEntryHeader Header;
+	ANSICHAR AnsiName[NAME_SIZE];
 
-	void StoreName(const ANSICHAR* InName, uint32 Len)
-	{
-		memcpy(AnsiName, InName, sizeof(ANSICHAR) * Len);
-		AnsiName[Len] = '\0';
-	}
+	std::string_view GetView() const { return {AnsiName, Header.Len}; }
 
-	void StoreName(const WIDECHAR* InName, uint32 Len)
-	{
-		memcpy(WideName, InName, sizeof(WIDECHAR) * Len);
-		WideName[Len] = '\0';
-	}
+	static uint32 GetAllocationSize(uint32 Len);
 };
 
+static constexpr uint32 NameEntryStride = alignof(FNameEntry);
+static constexpr uint32 NameBlockSizeBytes = NameEntryStride * NameBlockOffsets;
+static_assert(NameEntryStride == 4, "EngineSIU.natvis의 FName 표시식도 함께 수정해야 합니다.");
+
+uint32 FNameEntry::GetAllocationSize(uint32 Len)
+{
+	const uint32 Bytes = static_cast<uint32>(offsetof(FNameEntry, AnsiName)) + Len + 1;
+	return (Bytes + NameEntryStride - 1) & ~(NameEntryStride - 1);
+}
+
+/** .natvis에서 FName을 문자열로 보여줄 때 사용하는 Block 테이블 */
+uint8** GNameBlocksDebug = nullptr;
+
 namespace
 {
-template <typename CharType>
-uint32 HashString(const CharType* Str)
+ANSICHAR ToLowerAscii(ANSICHAR Char)
 {
-	// djb2 문자열 해싱 알고리즘
-	uint32 Hash = 5381;
-	while (*Str)
+	return (Char >= 'A' && Char <= 'Z') ? static_cast<ANSICHAR>(Char - 'A' + 'a') : Char;
+}
+
+template <ENameCase Sensitivity>
+uint32 HashName(std::string_view Name)
+{
+	// FNV-1a에 Murmur3의 finalizer를 더해서 상위 비트(Shard 선택)도 고르게 섞습니다.
+	uint32 Hash = 2166136261u;
+	for (const ANSICHAR Char : Name)
 	{
-		Hash = ((Hash << 5) + Hash) + *Str;
-		++Str;
+		const ANSICHAR Folded = Sensitivity == IgnoreCase ? ToLowerAscii(Char) : Char;
+		Hash = (Hash ^ static_cast<uint8>(Folded)) * 16777619u;
 	}
+	Hash ^= Hash >> 16;
+	Hash *= 0x85ebca6bu;
+	Hash ^= Hash >> 13;
+	Hash *= 0xc2b2ae35u;
+	Hash ^= Hash >> 16;
 	return Hash;
 }
 
-template <typename CharType>
-uint32 HashStringLower(const CharType* Str, uint32 InLen)
+template <ENameCase Sensitivity>
+bool EqualsName(std::string_view A, std::string_view B)
 {
-	CharType LowerStr[NAME_SIZE];
-	if constexpr (std::is_same_v<CharType, wchar_t>)
+	if (A.size() != B.size())
 	{
-		for (uint32 i = 0; i < InLen; i++)
-		{
-			LowerStr[i] = towlower(Str[i]);
-		}
-		LowerStr[InLen] = '\0';
+		return false;
+	}
+	if constexpr (Sensitivity == CaseSensitive)
+	{
+		return std::memcmp(A.data(), B.data(), A.size()) == 0;
 	}
 	else
 	{
-		for (uint32 i = 0; i < InLen; ++i)
+		for (size_t i = 0; i < A.size(); ++i)
 		{
-			LowerStr[i] = static_cast<CharType>(tolower(Str[i]));
+			if (ToLowerAscii(A[i]) != ToLowerAscii(B[i]))
+			{
+				return false;
+			}
 		}
-		LowerStr[InLen] = '\0';
+		return true;
 	}
-	return HashString(LowerStr);
-}
-
-template <ENameCase Sensitivity>
-uint32 HashName(FNameStringView InName);
-
-template <>
-uint32 HashName<IgnoreCase>(FNameStringView InName)
-{
-	return InName.IsAnsi() ? HashStringLower(InName.Ansi, InName.Len) : HashStringLower(InName.Wide, InName.Len);
 }
-
-template <>
-uint32 HashName<CaseSensitive>(FNameStringView InName)
-{
-	return InName.IsAnsi() ? HashString(InName.Ansi) : HashString(InName.Wide);
 }
-}
-
-template <ENameCase Sensitivity>
-struct FNameValue
-{
-	explicit FNameValue(FNameStringView InName)
-		: Name(InName)
-		, Hash(HashName<Sensitivity>(InName))
-	{}
-
-	FNameStringView Name;
-	uint32 Hash;
-	FNameEntryId ComparisonId = {};
-};
 
-using FNameComparisonValue = FNameValue<IgnoreCase>;
-using FNameDisplayValue = FNameValue<CaseSensitive>;
 
-/** Open Addressing을 이용한 커스텀 Hash Set 이었는데, Hash 충돌 문제로 사용 못함 */
-#pragma region Deprecated Pool Shard
-#if 0  // NOLINT(readability-avoid-unconditional-preprocessor-if)
-template <ENameCase Sensitivity>
-class FNamePoolShard
+/**
+ * Name Entry를 저장하는 추가 전용 Arena.
+ * 한 번 저장된 Entry는 움직이지 않으므로 FNameEntryId로 언제든 잠금 없이 읽을 수 있습니다.
+ */
+class FNameEntryAllocator
 {
-	template <typename T>
-	using Vec = std::vector<T, FDefaultAllocator<T>>;
-
-	// 요소 상태를 나타내는 enum
-	enum class ESlotState : uint8
+public:
+	FNameEntryAllocator()
 	{
-		Empty,    // 비어있는 슬롯
-		Occupied, // 사용 중인 슬롯
-		Deleted   // 삭제된 슬롯
-	};
+		GNameBlocksDebug = Blocks;
+	}
 
-	// 슬롯 구조체
-	struct FSlot
+	~FNameEntryAllocator()
 	{
-		FNameEntry Value;   // 저장된 값
-		ESlotState State;    // 슬롯의 상태
-
-		FSlot()
-			: Value()
-			, State(ESlotState::Empty)
+		for (uint32 Block = 0; Block <= CurrentBlock; ++Block)
 		{
+			std::free(Blocks[Block]);
 		}
+	}
 
-		bool Used() const
-		{
-			return State == ESlotState::Occupied;
-		}
+	/** Entry를 만들고 ComparisonId가 비어 있으면 자기 자신으로 채웁니다. */
+	FNameEntryId Create(std::string_view Name, FNameEntryId ComparisonId, bool bUseOwnComparisonId)
+	{
+		const uint32 Bytes = FNameEntry::GetAllocationSize(static_cast<uint32>(Name.size()));
 
-		void SetValue(const FNameEntry& InValue)
+		FNameEntryId Id;
+		uint8* Memory;
 		{
-			Value = InValue;
-			State = ESlotState::Occupied;
+			std::lock_guard Lock(Mutex);
+
+			if (Blocks[CurrentBlock] == nullptr || CurrentByteCursor + Bytes > NameBlockSizeBytes)
+			{
+				if (Blocks[CurrentBlock] != nullptr)
+				{
+					++CurrentBlock;
+					assert(CurrentBlock < MaxNameBlocks);
+				}
+				Blocks[CurrentBlock] = static_cast<uint8*>(std::malloc(NameBlockSizeBytes));
+				CurrentByteCursor = 0;
+			}
+
+			Id.Value = (CurrentBlock << NameBlockOffsetBits) | (CurrentByteCursor / NameEntryStride);
+			Memory = Blocks[CurrentBlock] + CurrentByteCursor;
+			CurrentByteCursor += Bytes;
+			UsedBytes += Bytes;
+			++NumEntries;
 		}
-	};
+
+		// Entry의 내용은 Hash Index에 release로 등록되기 전까지 다른 스레드에서 읽히지 않습니다.
+		FNameEntry* Entry = reinterpret_cast<FNameEntry*>(Memory);
+		Entry->ComparisonId = bUseOwnComparisonId ? Id : ComparisonId;
+		Entry->Header.Len = static_cast<uint16>(Name.size());
+		std::memcpy(Entry->AnsiName, Name.data(), Name.size());
+		Entry->AnsiName[Name.size()] = '\0';
+		return Id;
+	}
+
+	const FNameEntry& Resolve(FNameEntryId Id) const
+	{
+		return *reinterpret_cast<const FNameEntry*>(Blocks[Id.GetBlock()] + Id.GetOffset() * NameEntryStride);
+	}
+
+	void GetStats(FNamePoolStats& OutStats)
+	{
+		std::lock_guard Lock(Mutex);
+		OutStats.NumEntries = NumEntries;
+		OutStats.EntryBytes = UsedBytes;
+		OutStats.ArenaBytes = static_cast<uint64>(CurrentBlock + 1) * NameBlockSizeBytes;
+	}
 
 private:
-	mutable Vec<FSlot> Slots;
-	std::atomic<uint32> ElementCount; // 총 요소 개수
-	float MaxLoadFactorValue;        // 최대 부하 계수
+	std::mutex Mutex;
+	uint8* Blocks[MaxNameBlocks] = {};
+	uint32 CurrentBlock = 0;
+	uint32 CurrentByteCursor = 0;
+	uint32 NumEntries = 0;
+	uint64 UsedBytes = 0;
+};
+
 
-	mutable std::mutex Mutex;
+/**
+ * Hash에서 FNameEntryId를 찾는 Open Addressing Hash Index의 Shard 하나.
+ *
+ * 조회는 잠금 없이 Slot을 읽고, Hash가 같으면 Arena의 문자열 전체를 비교해서 충돌을 구분합니다.
+ * 추가와 확장은 Shard의 Mutex 안에서만 일어나며, 확장 전 테이블은 조회 중인 스레드를 위해 해제하지 않습니다.
+ */
+template <ENameCase Sensitivity>
+class FNamePoolShard
+{
+	/** 상위 32비트는 Hash, 하위 32비트는 FNameEntryId + 1. 0이면 빈 Slot */
+	using FSlot = std::atomic<uint64>;
 
-	// 해시 테이블 리사이징 및 리해싱
-	void Rehash(uint32 NewCapacity)
+	struct FTable
 	{
-		Vec<FSlot> OldSlots = std::move(Slots);
-		Slots.clear();
-		Slots.resize(NewCapacity);
+		uint32 Capacity;
+		FSlot* Slots;
+	};
 
-		ElementCount = 0;
-		for (const auto& Slot : OldSlots)
+public:
+	static constexpr uint32 InitialCapacity = 256;
+
+	FNamePoolShard()
+	{
+		Table.store(CreateTable(InitialCapacity), std::memory_order_relaxed);
+	}
+
+	~FNamePoolShard()
+	{
+		for (FTable* Old : Tables)
 		{
-			if (Slot.State == ESlotState::Occupied)
-			{
-				Slots[Slot.Value.ComparisonId.Value & Slots.size()] = Slot;
-			}
+			delete[] Old->Slots;
+			delete Old;
 		}
 	}
 
-public:
-	FNamePoolShard(int32 InitCapacity = 1024, float InMaxLoadFactor = 0.75f)
-		: Slots(InitCapacity)
-		, ElementCount(0)
-		, MaxLoadFactorValue(InMaxLoadFactor)
+	/** 잠금 없이 찾습니다. 확장 직후라면 새로 추가된 이름을 놓칠 수 있으므로, 못 찾으면 FindLocked로 다시 확인합니다. */
+	bool Find(std::string_view Name, uint32 Hash, const FNameEntryAllocator& Entries, FNameEntryId& OutId) const
 	{
+		return FindInTable(*Table.load(std::memory_order_acquire), Name, Hash, Entries, OutId);
 	}
 
-	FSlot& Probe(uint32 InHash) const
+	std::mutex& GetMutex() { return Mutex; }
+
+	/** GetMutex()를 잠근 상태에서 호출합니다. */
+	bool FindLocked(std::string_view Name, uint32 Hash, const FNameEntryAllocator& Entries, FNameEntryId& OutId) const
 	{
-		return Slots[InHash & Slots.size()-1];
+		return FindInTable(*Table.load(std::memory_order_relaxed), Name, Hash, Entries, OutId);
 	}
 
-	FNameEntryId Find(const FNameValue<Sensitivity>& Value) const
+	/** GetMutex()를 잠근 상태에서 호출합니다. */
+	void InsertLocked(uint32 Hash, FNameEntryId Id)
 	{
-		FNameEntryId Result;
+		FTable* Current = Table.load(std::memory_order_relaxed);
+		if ((NumUsed + 1) * 2 > Current->Capacity)
 		{
-			std::lock_guard _(Mutex);
-
-			const FSlot& Slot = Probe(Value.Hash);
-			Result = Slot.Value.ComparisonId;
+			Current = Grow(*Current);
 		}
-		return Result;
+
+		InsertSlot(*Current, (static_cast<uint64>(Hash) << 32) | (Id.Value + 1));
+		++NumUsed;
 	}
 
-	FNameEntryId Insert(const FNameValue<Sensitivity>& Value)
+	uint64 GetAllocatedBytes()
 	{
-		// 부하 계수 확인 및 필요시 리해싱
-		if (ElementCount >= Slots.size() * MaxLoadFactorValue)
+		std::lock_guard Lock(Mutex);
+		uint64 Bytes = 0;
+		for (const FTable* Old : Tables)
 		{
-			Rehash(Slots.size() * 2);
+			Bytes += static_cast<uint64>(Old->Capacity) * sizeof(FSlot);
 		}
+		return Bytes;
+	}
 
-		std::lock_guard _(Mutex);
-		FSlot& Slot = Probe(Value.Hash);
+private:
+	FTable* CreateTable(uint32 Capacity)
+	{
+		FTable* NewTable = new FTable{Capacity, new FSlot[Capacity]};
+		for (uint32 i = 0; i < Capacity; ++i)
+		{
+			NewTable->Slots[i].store(0, std::memory_order_relaxed);
+		}
+		Tables.Add(NewTable);
+		return NewTable;
+	}
 
-		if (Slot.Used())
+	FTable* Grow(const FTable& Old)
+	{
+		FTable* NewTable = CreateTable(Old.Capacity * 2);
+		for (uint32 i = 0; i < Old.Capacity; ++i)
 		{
-			return Slot.Value.ComparisonId;
+			if (const uint64 Slot = Old.Slots[i].load(std::memory_order_relaxed))
+			{
+				InsertSlot(*NewTable, Slot);
+			}
 		}
+		Table.store(NewTable, std::memory_order_release);
+		return NewTable;
+	}
 
-		// 요소 삽입
-		FNameEntry Entry;
-		Entry.ComparisonId = Value.ComparisonId;
-		Entry.Header = {
-			.IsWide = Value.Name.bIsWide,
-			.Len = static_cast<uint16>(Value.Name.Len)
-		};
-		if (Value.Name.bIsWide)
+	static void InsertSlot(FTable& InTable, uint64 Slot)
+	{
+		const uint32 Mask = InTable.Capacity - 1;
+		for (uint32 Index = static_cast<uint32>(Slot >> 32) & Mask; ; Index = (Index + 1) & Mask)
 		{
-			Entry.StoreName(Value.Name.Wide, Value.Name.Len);
+			if (InTable.Slots[Index].load(std::memory_order_relaxed) == 0)
+			{
+				InTable.Slots[Index].store(Slot, std::memory_order_release);
+				return;
+			}
 		}
-		else
+	}
+
+	static bool FindInTable(const FTable& InTable, std::string_view Name, uint32 Hash, const FNameEntryAllocator& Entries, FNameEntryId& OutId)
+	{
+		const uint32 Mask = InTable.Capacity - 1;
+		for (uint32 Index = Hash & Mask; ; Index = (Index + 1) & Mask)
 		{
-			Entry.StoreName(Value.Name.Ansi, Value.Name.Len);
+			const uint64 Slot = InTable.Slots[Index].load(std::memory_order_acquire);
+			if (Slot == 0)
+			{
+				return false;
+			}
+
+			if (static_cast<uint32>(Slot >> 32) == Hash)
+			{
+				const FNameEntryId Id{static_cast<uint32>(Slot) - 1};
+				if (EqualsName<Sensitivity>(Entries.Resolve(Id).GetView(), Name))
+				{
+					OutId = Id;
+					return true;
+				}
+			}
 		}
-		Slot.SetValue(Entry);
-		ElementCount.fetch_add(1, std::memory_order_relaxed);
-		return {Value.Hash};
 	}
+
+private:
+	std::atomic<FTable*> Table;
+	std::mutex Mutex;
+	uint32 NumUsed = 0;
+
+	/** 현재 테이블과 확장 전 테이블 전부 */
+	TArray<FTable*> Tables;
 };
-#endif
-#pragma endregion Deprecated Pool Shard
 
-struct FNamePool
+
+class FNamePool
 {
 public:
-    static FNamePool& Get()
-    {
-        static FNamePool Instance;
-        return Instance;
-    }
+	/** Shard는 Hash의 상위 비트로 고릅니다. */
+	static constexpr uint32 ShardBits = 4;
+	static constexpr uint32 NumShards = 1u << ShardBits;
 
-private:
-	// FNamePoolShard<CaseSensitive> DisplayPool;
-	// FNamePoolShard<IgnoreCase> ComparisonPool;
-
-	TMap<uint32, FNameEntry> DisplayPool;
-	TMap<uint32, FNameEntry> ComparisonPool;
+	static FNamePool& Get()
+	{
+		static FNamePool Instance;
+		return Instance;
+	}
 
-private:
-	template <ENameCase Sensitivity>
-	FNameEntry MakeEntry(const FNameValue<Sensitivity>& Value) const
+	FNamePool()
 	{
-		FNameEntry Result;
-		Result.ComparisonId = Value.ComparisonId;
-		Result.Header = {
-			.IsWide = Value.Name.bIsWide,
-			.Len = static_cast<uint16>(Value.Name.Len)
-		};
-		if (Value.Name.bIsWide)
-		{
-			Result.StoreName(Value.Name.Wide, Value.Name.Len);
-		}
-		else
-		{
-			Result.StoreName(Value.Name.Ansi, Value.Name.Len);
-		}
-		return Result;
+		// "None"을 0번 Entry로 등록해서 NAME_None과 같아지게 합니다.
+		Store("None");
 	}
 
-public:
-	/** Hash로 원본 문자열을 가져옵니다. */
-	FNameEntry Resolve(uint32 Hash) const
+	const FNameEntry& Resolve(FNameEntryId Id) const
 	{
-		return *DisplayPool.Find(Hash);
+		return Entries.Resolve(Id);
 	}
 
-	/**
-	 * 문자열을 찾거나, 없으면 Hash화 해서 저장합니다.
-	 *
-	 * @return DisplayName의 Hash
-	 */
-	FNameEntryId FindOrStoreString(const FNameStringView& Name)
+	/** 문자열의 Entry를 찾거나, 없으면 Arena에 저장합니다. */
+	FNameEntryId Store(std::string_view Name)
 	{
-		// DisplayPool에 같은 문자열이 있다면, 문자열의 Hash 반환
-		FNameDisplayValue DisplayValue{Name};
-		if (DisplayPool.Find(DisplayValue.Hash))
+		const uint32 DisplayHash = HashName<CaseSensitive>(Name);
+		FNamePoolShard<CaseSensitive>& DisplayShard = DisplayShards[DisplayHash >> (32 - ShardBits)];
+
+		FNameEntryId DisplayId;
+		if (DisplayShard.Find(Name, DisplayHash, Entries, DisplayId))
 		{
-			return {DisplayValue.Hash};
+			return DisplayId;
 		}
 
-		const FNameComparisonValue ComparisonValue{Name};
-		if (!ComparisonPool.Find(ComparisonValue.Hash))
+		std::lock_guard DisplayLock(DisplayShard.GetMutex());
+		if (DisplayShard.FindLocked(Name, DisplayHash, Entries, DisplayId))
 		{
-			const FNameEntry Entry = MakeEntry(ComparisonValue);
-			ComparisonPool.Add(ComparisonValue.Hash, Entry);
+			return DisplayId;
 		}
 
-		DisplayValue.ComparisonId = {ComparisonValue.Hash};
-		DisplayPool.Add(DisplayValue.Hash, MakeEntry(DisplayValue));
-		return {DisplayValue.Hash};
+		// 대소문자만 다른 이름이 이미 있다면 그 Entry를 비교용 Id로 사용합니다.
+		const uint32 ComparisonHash = HashName<IgnoreCase>(Name);
+		FNamePoolShard<IgnoreCase>& ComparisonShard = ComparisonShards[ComparisonHash >> (32 - ShardBits)];
+		{
+			std::lock_guard ComparisonLock(ComparisonShard.GetMutex());
+
+			FNameEntryId ComparisonId;
+			const bool bNewComparison = !ComparisonShard.FindLocked(Name, ComparisonHash, Entries, ComparisonId);
+			DisplayId = Entries.Create(Name, ComparisonId, bNewComparison);
+			if (bNewComparison)
+			{
+				ComparisonShard.InsertLocked(ComparisonHash, DisplayId);
+			}
+		}
+
+		DisplayShard.InsertLocked(DisplayHash, DisplayId);
+		return DisplayId;
 	}
-};
 
-struct FNameHelper
-{
-	template <typename CharType>
-	static FName MakeFName(const CharType* Str)
+	FNamePoolStats GetStats()
 	{
-		if constexpr (std::is_same_v<CharType, char>)
+		FNamePoolStats Stats;
+		Entries.GetStats(Stats);
+		for (uint32 i = 0; i < NumShards; ++i)
 		{
-			return MakeFName(Str, static_cast<uint32>(strlen(Str)));
-		}
-		else if constexpr (std::is_same_v<CharType, wchar_t>)
-		{
-			return MakeFName(Str, static_cast<uint32>(wcslen(Str)));
-		}
-		else
-		{
-			//static_assert(false, "Invalid Character type");
-			return {};
+			Stats.IndexBytes += DisplayShards[i].GetAllocatedBytes();
+			Stats.IndexBytes += ComparisonShards[i].GetAllocatedBytes();
 		}
+		return Stats;
 	}
 
-	template <typename CharType>
-	static FName MakeFName(const CharType* Char, uint32 Len)
+private:
+	FNameEntryAllocator Entries;
+	FNamePoolShard<CaseSensitive> DisplayShards[NumShards];
+	FNamePoolShard<IgnoreCase> ComparisonShards[NumShards];
+};
+
+struct FNameHelper
+{
+	static FName MakeFName(const ANSICHAR* Char, uint32 Len)
 	{
 		// 문자열의 길이가 NAME_SIZE를 초과하면 None 반환
 		if (Len >= NAME_SIZE)
@@ -391,36 +432,23 @@ struct FNameHelper
 			return {};
 		}
 
-		const FNameEntryId DisplayId = FNamePool::Get().FindOrStoreString({Char, Len});
+		FNamePool& Pool = FNamePool::Get();
+		const FNameEntryId DisplayId = Pool.Store({Char, Len});
 
 		FName Result;
 		Result.DisplayIndex = DisplayId.Value;
-		Result.ComparisonIndex = ResolveComparisonId(DisplayId).Value;
+		Result.ComparisonIndex = Pool.Resolve(DisplayId).ComparisonId.Value;
 		return Result;
 	}
-
-	static FNameEntryId ResolveComparisonId(FNameEntryId DisplayId)
-	{
-		if (DisplayId.IsNone())
-		{
-			return {};
-		}
-		return FNamePool::Get().Resolve(DisplayId.Value).ComparisonId;
-	}
 };
 
-#if defined(_DEBUG)
-// .natvis에서 사용하는 디버그용 변수
-namespace { [[maybe_unused]] const FNamePool& GDebugNamePool = FNamePool::Get(); }
-#endif
-
 FName::FName(const WIDECHAR* Name)
-	: FName(FNameHelper::MakeFName(Name))
+	: FName(FString(Name))
 {
 }
 
 FName::FName(const ANSICHAR* Name)
-	: FName(FNameHelper::MakeFName(Name))
+	: FName(FNameHelper::MakeFName(Name, static_cast<uint32>(strlen(Name))))
 {
 }
 
@@ -429,19 +457,19 @@ FName::FName(const FString& Name)
 {
 }
 
+std::string_view FName::ToStringView() const
+{
+	return FNamePool::Get().Resolve({DisplayIndex}).GetView();
+}
+
 FString FName::ToString() const
 {
-	if (DisplayIndex == 0 && ComparisonIndex == 0)
-	{
-		return {TEXT("None")};
-	}
+	return FString(std::string(ToStringView()));
+}
 
-	// TODO: WIDECHAR에 대응 해야함
-	FNameEntry Entry = FNamePool::Get().Resolve(DisplayIndex);
-	return {
-		// Entry.Header.IsWide ? Entry.WideName : Entry.AnsiName
-		Entry.AnsiName
-	};
+FNamePoolStats FName::GetPoolStats()
+{
+	return FNamePool::Get().GetStats();
 }
 
 bool FName::operator==(const FName& Other) const
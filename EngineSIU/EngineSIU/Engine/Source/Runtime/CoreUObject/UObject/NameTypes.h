@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <string_view>
 #include "Core/HAL/PlatformType.h"
 
 class FString;
@@ -8,12 +9,27 @@ enum ENameNone : uint8 { NAME_None = 0 };
 /** Maximum size of name, including the null terminator. */
 enum : uint16 { NAME_SIZE = 256 };
 
+/** FName Pool의 메모리 사용량 */
+struct FNamePoolStats
+{
+    uint32 NumEntries = 0;
+
+    /** Arena에서 Entry가 실제로 차지하는 바이트 */
+    uint64 EntryBytes = 0;
+
+    /** Arena가 할당한 Block의 바이트 */
+    uint64 ArenaBytes = 0;
+
+    /** Hash Index 테이블의 바이트 (확장 전 테이블 포함) */
+    uint64 IndexBytes = 0;
+};
+
 class FName
 {
     friend struct FNameHelper;
 
-    uint32 DisplayIndex;    // 원본 문자열의 Hash
-    uint32 ComparisonIndex; // 비교시 사용되는 Hash
+    uint32 DisplayIndex;    // 원본 문자열 Entry의 위치
+    uint32 ComparisonIndex; // 대소문자를 무시한 비교에 사용하는 Entry의 위치
 
 public:
     FName() : DisplayIndex(NAME_None), ComparisonIndex(NAME_None) {}
@@ -23,6 +39,11 @@ public:
     FName(const FString& Name);
 
     FString ToString() const;
+
+    /** Name Pool에 저장된 문자열을 복사 없이 반환합니다. 문자열은 Null 문자로 끝나며 프로그램이 끝날 때까지 유효합니다. */
+    std::string_view ToStringView() const;
+
+    static FNamePoolStats GetPoolStats();
     uint32 GetDisplayIndex() const { return DisplayIndex; }
     uint32 GetComparisonIndex() const { return ComparisonIndex; }
 
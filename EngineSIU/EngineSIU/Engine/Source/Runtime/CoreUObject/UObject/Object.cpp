@@ -1,8 +1,7 @@
 #include "Object.h"
 
-#include "ObjectFactory.h"
 #include "Class.h"
-#include "Engine/Engine.h"
+#include "ObjectDuplication.h"
 
 
 UClass* UObject::StaticClass()
@@ -14,7 +13,7 @@ UClass* UObject::StaticClass()
         nullptr,
         []() -> UObject*
         {
-            void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(sizeof(UObject));
+            void* RawMemory = FUObjectAllocator::Get().Allocate(sizeof(UObject), alignof(UObject));
             ::new (RawMemory) UObject;
             return static_cast<UObject*>(RawMemory);
         }
@@ -32,13 +31,15 @@ UObject::UObject()
 
 UObject* UObject::Duplicate(UObject* InOuter)
 {
-    return FObjectFactory::ConstructObject(GetClass(), InOuter);
+    FObjectDuplicator Duplicator;
+    UObject* NewObject = Duplicator.DuplicateObject(this, InOuter);
+    Duplicator.Finish();
+    return NewObject;
 }
 
 void UObject::Serialize(FArchive& Ar)
 {
-    // TODO: Serialize 구현
-    // GetClass()->SerializeBin(Ar, this);
+    GetClass()->SerializeBin(Ar, this);
 }
 
 UWorld* UObject::GetWorld() const
@@ -1,11 +1,20 @@
 #pragma once
-#include "EngineLoop.h"
 #include "NameTypes.h"
+#include "UObjectAllocator.h"
+#include "Math/Vector4.h"
+
+#if defined(_WIN32)
+// 헤드리스 빌드(Tests/CMakeLists.txt)에는 창과 D3D 장치가 없으므로 EngineLoop를 가져오지 않습니다.
+#include "EngineLoop.h"
 
 extern FEngineLoop GEngineLoop;
+#endif
 
 class UClass;
 class UWorld;
+class FObjectDuplicator;
+class FArchive;
+struct FProperty;
 
 
 class UObject
@@ -24,11 +33,15 @@ public:
 
 private:
     friend class FObjectFactory;
+    friend class FObjectDuplicator;
     friend class FSceneMgr;
     friend class UClass;
+    friend void AddToClassMap(UObject* Object);
+    friend void AddToClassMap(const TArray<UObject*>& Objects);
+    friend void RemoveFromClassMap(UObject* Object);
 
     uint32 UUID;
-    uint32 InternalIndex; // Index of GUObjectArray
+    uint32 InternalIndex; // Index of ClassPrivate->GetClassObjects()
 
     FName NamePrivate;
     UClass* ClassPrivate = nullptr;
@@ -38,12 +51,32 @@ public:
     UObject();
     virtual ~UObject() = default;
 
+    /**
+     * 이 Object와 DuplicateFrom에서 함께 복제하는 하위 Object들을 FObjectDuplicator로 한 번에 복제합니다.
+     * 복제된 Object 사이의 참조는 새 Object로 바뀌고, 복제되지 않은 Object는 그대로 가리킵니다.
+     */
     virtual UObject* Duplicate(UObject* InOuter);
 
+    /**
+     * FObjectDuplicator가 Source의 UPROPERTY 값을 복사한 직후, 새 Object에서 호출됩니다.
+     * UPROPERTY가 아닌 값을 Source에서 가져오고, 함께 복제할 하위 Object를 Duplicator로 복제합니다.
+     * 이 시점의 Object 참조 UPROPERTY는 아직 채워지지 않았습니다.
+     */
+    virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) {}
+
+    /** 같은 FObjectDuplicator로 복제한 모든 Object의 참조가 새 Object로 바뀐 뒤에 호출됩니다. */
+    virtual void PostDuplicate() {}
+
     UObject* GetOuter() const { return OuterPrivate; }
     virtual UWorld* GetWorld() const;
     virtual void Serialize(FArchive& Ar);
 
+    /**
+     * 에디터에서 UPROPERTY 값을 바꾼 뒤에 호출됩니다.
+     * @param PropertyThatChanged 바뀐 Property
+     */
+    virtual void PostEditChangeProperty(const FProperty* PropertyThatChanged) {}
+
     FName GetFName() const { return NamePrivate; }
     FString GetName() const { return NamePrivate.ToString(); }
 
@@ -64,30 +97,21 @@ public:
     }
 
 public:
+    // 소멸자가 virtual이므로 delete는 동적 타입의 크기를 넘겨 줍니다. 할당 통계는 FUObjectAllocator::GetStats로 확인합니다.
     void* operator new(size_t size)
     {
-        UE_LOG(LogLevel::Display, "UObject Created : %d", size);
-
-        void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(size);
-        UE_LOG(
-            LogLevel::Display,
-            "TotalAllocationBytes : %d, TotalAllocationCount : %d",
-            FPlatformMemory::GetAllocationBytes<EAT_Object>(),
-            FPlatformMemory::GetAllocationCount<EAT_Object>()
-        );
-        return RawMemory;
+        return FUObjectAllocator::Get().Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
     }
 
     void operator delete(void* ptr, size_t size)
     {
-        UE_LOG(LogLevel::Display, "UObject Deleted : %d", size);
-        FPlatformMemory::Free<EAT_Object>(ptr, size);
+        FUObjectAllocator::Get().Free(ptr, size);
     }
 
     FVector4 EncodeUUID() const {
         FVector4 result;
 
-        result.X = UUID % 0xFF;
+        result.X = UUID & 0xFF;
         result.Y = UUID >> 8 & 0xFF;
         result.Z = UUID >> 16 & 0xFF;
         result.W = UUID >> 24 & 0xFF;
@@ -0,0 +1,105 @@
+#include "ObjectDuplication.h"
+
+#include <cassert>
+#include "Class.h"
+#include "EngineStatics.h"
+#include "Object.h"
+#include "UObjectArray.h"
+
+
+FObjectDuplicator::FObjectDuplicator(int32 ExpectedNumObjects)
+{
+    Reserve(ExpectedNumObjects);
+}
+
+FObjectDuplicator::~FObjectDuplicator()
+{
+    // Finish를 부르지 않으면 새 Object들이 등록되지 않은 채로 남습니다.
+    assert(DuplicationOrder.IsEmpty());
+}
+
+void FObjectDuplicator::Reserve(int32 NumObjects)
+{
+    if (NumObjects <= 0)
+    {
+        return;
+    }
+
+    DuplicatedObjects.Reserve(DuplicatedObjects.Num() + NumObjects);
+    DuplicationOrder.Reserve(DuplicationOrder.Num() + NumObjects);
+    NewObjects.Reserve(NewObjects.Num() + NumObjects);
+}
+
+UObject* FObjectDuplicator::DuplicateObject(const UObject* Source, UObject* InOuter)
+{
+    if (Source == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (UObject** Found = DuplicatedObjects.Find(const_cast<UObject*>(Source)))
+    {
+        return *Found;
+    }
+
+    UClass* Class = Source->GetClass();
+    UObject* NewObject = Class->ClassCTOR();
+    NewObject->ClassPrivate = Class;
+    NewObject->UUID = UEngineStatics::GenUUID();
+    NewObject->OuterPrivate = InOuter;
+
+    // 다른 Outer 아래에서는 원본의 이름을 그대로 쓰고, 같은 Outer 아래에 복제할 때만 겹치지 않게 새 이름을 붙입니다.
+    if (InOuter != Source->OuterPrivate)
+    {
+        NewObject->NamePrivate = Source->NamePrivate;
+    }
+    else
+    {
+        NewObject->NamePrivate = Class->GetName() + "_" + std::to_string(NewObject->UUID);
+    }
+    NewObjects.Add(NewObject);
+
+    CopyObject(Source, NewObject);
+    return NewObject;
+}
+
+void FObjectDuplicator::DuplicateInto(const UObject* Source, UObject* Dest)
+{
+    assert(Source->GetClass() == Dest->GetClass());
+    assert(!DuplicatedObjects.Contains(const_cast<UObject*>(Source)));
+
+    CopyObject(Source, Dest);
+}
+
+void FObjectDuplicator::CopyObject(const UObject* Source, UObject* Dest)
+{
+    DuplicatedObjects.Add(const_cast<UObject*>(Source), Dest);
+    DuplicationOrder.Add({Source, Dest});
+
+    Source->GetClass()->CopyProperties(Dest, Source);
+
+    // 하위 Object를 복제하면서 DuplicationOrder가 늘어날 수 있으므로, 참조를 들고 있지 않습니다.
+    Dest->DuplicateFrom(Source, *this);
+}
+
+void FObjectDuplicator::Finish()
+{
+    // 모든 복제본이 만들어진 뒤에 참조를 채워야, 아직 복제되지 않았던 Object를 가리키는 참조도 새 Object로 바뀝니다.
+    for (const FDuplicatedObject& Duplicated : DuplicationOrder)
+    {
+        Duplicated.Dest->GetClass()->CopyObjectReferences(Duplicated.Dest, Duplicated.Source, DuplicatedObjects);
+    }
+
+    GUObjectArray.AddObjects(NewObjects);
+
+    // PostDuplicate에서 다시 Duplicate를 부를 수 있으므로, 목록을 비운 뒤에 호출합니다.
+    TArray<FDuplicatedObject> Duplicated = std::move(DuplicationOrder);
+    DuplicationOrder.Empty();
+    DuplicatedObjects.Empty();
+    NewObjects.Empty();
+
+    for (const FDuplicatedObject& Object : Duplicated)
+    {
+        Object.Dest->PostDuplicate();
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <concepts>
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "HAL/PlatformType.h"
+
+class UObject;
+
+
+/**
+ * 여러 UObject를 한 번에 복제합니다. PIE World처럼 Object 그래프 전체를 복제할 때 사용합니다.
+ *
+ * DuplicateObject는 Object를 만들고 UPROPERTY 값을 복사한 뒤 UObject::DuplicateFrom을 호출합니다.
+ * 다른 Outer 아래에 복제한 Object는 원본의 FName을 그대로 쓰고, GUObjectArray 등록은 Finish에서 한 번에 처리합니다.
+ * Object 참조 UPROPERTY는 Finish에서 원본 -> 복제본 표를 통해 채워지므로,
+ * 복제된 Object끼리의 참조는 새 Object를, 복제되지 않은 Object(Asset 등)에 대한 참조는 원래 Object를 가리킵니다.
+ *
+ * @note GUObjectArray와 마찬가지로 메인 스레드에서만 사용합니다.
+ */
+class FObjectDuplicator
+{
+public:
+    /** @param ExpectedNumObjects 복제할 Object 수를 미리 알면 표와 목록을 그만큼 미리 할당합니다. */
+    explicit FObjectDuplicator(int32 ExpectedNumObjects = 0);
+    ~FObjectDuplicator();
+
+    FObjectDuplicator(const FObjectDuplicator&) = delete;
+    FObjectDuplicator& operator=(const FObjectDuplicator&) = delete;
+
+    /** NumObjects개의 Object를 더 복제할 수 있도록 표와 목록을 늘립니다. */
+    void Reserve(int32 NumObjects);
+
+    /**
+     * Source와 같은 클래스의 Object를 InOuter 아래에 만들고, Source의 값을 복사합니다.
+     * 이미 복제한 Object면 그 복제본을 반환합니다.
+     */
+    UObject* DuplicateObject(const UObject* Source, UObject* InOuter);
+
+    template <typename T>
+        requires std::derived_from<T, UObject>
+    T* DuplicateObject(const T* Source, UObject* InOuter)
+    {
+        return static_cast<T*>(DuplicateObject(static_cast<const UObject*>(Source), InOuter));
+    }
+
+    /**
+     * 이미 만들어진 Dest를 Source의 복제본으로 사용합니다. Actor 생성자가 만든 기본 컴포넌트를 재사용할 때 씁니다.
+     * Dest는 Source와 같은 클래스여야 하고, GUObjectArray에 이미 등록되어 있어야 합니다.
+     */
+    void DuplicateInto(const UObject* Source, UObject* Dest);
+
+    /**
+     * 복제된 Object들의 참조를 채우고, 새로 만든 Object들을 GUObjectArray에 한 번에 등록한 뒤,
+     * 복제한 순서대로 UObject::PostDuplicate를 호출합니다.
+     */
+    void Finish();
+
+private:
+    void CopyObject(const UObject* Source, UObject* Dest);
+
+private:
+    struct FDuplicatedObject
+    {
+        const UObject* Source;
+        UObject* Dest;
+    };
+
+    /** 원본 -> 복제본 표 */
+    TMap<UObject*, UObject*> DuplicatedObjects;
+
+    /** 복제한 순서대로 모은 원본, 복제본 쌍 */
+    TArray<FDuplicatedObject> DuplicationOrder;
+
+    /** DuplicateObject로 새로 만들어 아직 GUObjectArray에 등록되지 않은 Object들 */
+    TArray<UObject*> NewObjects;
+};
@@ -4,7 +4,11 @@
 #include "Class.h"
 #include "Define.h"
 #include "UObjectArray.h"
+
+#if defined(_WIN32)
+// 이 헤더를 통해 UE_LOG를 쓰는 파일이 많아 남겨 둡니다. 헤드리스 빌드(Tests/CMakeLists.txt)에는 Console이 없습니다.
 #include "UserInterface/Console.h"
+#endif
 
 class FObjectFactory
 {
@@ -25,8 +29,6 @@ public:
         Obj->OuterPrivate = InOuter;
 
         GUObjectArray.AddObject(Obj);
-
-        UE_LOG(LogLevel::Display, "Created New Object : %s", *Name);
         return Obj;
     }
 
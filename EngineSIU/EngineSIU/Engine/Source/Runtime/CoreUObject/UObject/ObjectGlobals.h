@@ -2,7 +2,7 @@
 #include "Object.h"      // UObject
 #include "NameTypes.h"   // FName, NAME_None
 #include "Container/Array.h" // TArray
-#include "UObjectHash.h"   // GetObjectsOfClass 함수 선언
+#include "UObjectIterator.h" // TObjectRange
 #include <cassert>         // assert
 
 /**
@@ -42,15 +42,10 @@ T* FindObject(UObject* Outer, const TCHAR* Name, bool bExactClass = false)
         return nullptr;
     }
 
-    // 2. 클래스 기반 후보 필터링 (FUObjectHashTables 활용)
-    TArray<UObject*> CandidateObjects;
-    // GetObjectsOfClass는 파생 클래스 포함 여부를 bIncludeDerivedClasses로 받으므로, bExactClass의 반대 값을 사용
-    // 여기서는 함수 시그니처가 const를 받는다고 가정하고 진행.
-    const UClass* ConstClassToFind = ClassToFind;
-    GetObjectsOfClass(ConstClassToFind, CandidateObjects, !bExactClass);
-
+    // 2. 클래스 기반 후보 순회 (클래스별 Object 목록을 복사 없이 순회)
+    // TObjectRange는 파생 클래스 포함 여부를 bIncludeDerivedClasses로 받으므로, bExactClass의 반대 값을 사용
     // 3. 후보 객체 순회하며 Outer 및 Name 확인
-    for (UObject* Candidate : CandidateObjects)
+    for (T* Candidate : TObjectRange<T>(!bExactClass))
     {
         // 후보 객체가 null이 아니고 (안전을 위해 확인),
         // Outer가 일치하고,
@@ -59,9 +54,8 @@ T* FindObject(UObject* Outer, const TCHAR* Name, bool bExactClass = false)
             Candidate->GetOuter() == Outer &&
             Candidate->GetFName() == NameToFind)
         {
-            // 찾았다! static_cast는 클래스 호환성이 GetObjectsOfClass에서
-            // 이미 어느 정도 보장되었으므로 안전하게 사용 가능.
-            return static_cast<T*>(Candidate);
+            // 찾았다! TObjectRange는 T와 그 파생 클래스의 Object만 순회하므로 바로 반환 가능.
+            return Candidate;
         }
     }
 
@@ -95,19 +89,15 @@ T* FindObject(UObject* Outer, FName NameToFind, bool bExactClass = false)
         return nullptr;
     }
 
-    // 2. 클래스 기반 후보 필터링
-    TArray<UObject*> CandidateObjects;
-    const UClass* ConstClassToFind = ClassToFind;
-    GetObjectsOfClass(ConstClassToFind, CandidateObjects, !bExactClass);
-
+    // 2. 클래스 기반 후보 순회
     // 3. 후보 객체 순회하며 Outer 및 Name 확인
-    for (UObject* Candidate : CandidateObjects)
+    for (T* Candidate : TObjectRange<T>(!bExactClass))
     {
         if (Candidate != nullptr &&
             Candidate->GetOuter() == Outer &&
             Candidate->GetFName() == NameToFind)
         {
-            return static_cast<T*>(Candidate);
+            return Candidate;
         }
     }
 
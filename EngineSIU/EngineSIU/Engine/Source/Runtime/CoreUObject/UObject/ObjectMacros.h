@@ -36,7 +36,7 @@ public: \
             static_cast<uint32>(alignof(TClass)), \
             TSuperClass::StaticClass(), \
             []() -> UObject* { \
-                void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(sizeof(TClass)); \
+                void* RawMemory = FUObjectAllocator::Get().Allocate(sizeof(TClass), alignof(TClass)); \
                 ::new (RawMemory) TClass; \
                 return static_cast<UObject*>(RawMemory); \
             } \
@@ -63,6 +63,7 @@ public: \
 
 /**
  * UClass에 Property를 등록합니다.
+ * 멤버 변수의 타입에 맞는 FProperty가 만들어지며, Scene 저장, Duplicate, 에디터에서 이 정보를 사용합니다.
  * @param Type 선언할 타입
  * @param VarName 변수 이름
  * @param ... 기본값
@@ -74,6 +75,22 @@ public: \
  * ```
  */
 #define UPROPERTY(Type, VarName, ...) \
+    UPROPERTY_WITH_FLAGS(CPF_None, Type, VarName, __VA_ARGS__)
+
+/**
+ * EPropertyFlags를 지정해서 UClass에 Property를 등록합니다.
+ * @param Flags EPropertyFlags
+ * @param Type 선언할 타입
+ * @param VarName 변수 이름
+ * @param ... 기본값
+ *
+ * Example Code
+ * ```
+ * UPROPERTY_WITH_FLAGS
+ * (CPF_DuplicateTransient, FString, Label)
+ * ```
+ */
+#define UPROPERTY_WITH_FLAGS(Flags, Type, VarName, ...) \
     Type VarName FIRST_ARG(__VA_ARGS__); \
     inline static struct VarName##_PropRegistrar \
     { \
@@ -81,7 +98,7 @@ public: \
         { \
             constexpr int64 Offset = offsetof(ThisClass, VarName); \
             ThisClass::StaticClass()->RegisterProperty( \
-                { #VarName, sizeof(Type), Offset } \
+                CreateProperty<Type>(#VarName, Offset, Flags) \
             ); \
         } \
     } VarName##_PropRegistrar_{};
@@ -1,2 +1,163 @@
 ﻿#include "Property.h"
+#include <cstdlib>
+#include <cwchar>
 
+
+namespace
+{
+    /** Property가 아닌 곳에서 값 하나를 다룰 때 쓰는 Property. Offset이 0입니다. */
+    template <typename T>
+    const FProperty* GetStandaloneProperty()
+    {
+        static const std::unique_ptr<FProperty> Property(CreateProperty<T>("Value", 0, CPF_None));
+        return Property.get();
+    }
+
+    /** strtoll, strtod 등을 TCHAR 종류에 맞게 부릅니다. */
+    long long StringToInteger(const char* Begin, char** End) { return std::strtoll(Begin, End, 10); }
+    long long StringToInteger(const wchar_t* Begin, wchar_t** End) { return std::wcstoll(Begin, End, 10); }
+
+    unsigned long long StringToUnsignedInteger(const char* Begin, char** End) { return std::strtoull(Begin, End, 10); }
+    unsigned long long StringToUnsignedInteger(const wchar_t* Begin, wchar_t** End) { return std::wcstoull(Begin, End, 10); }
+
+    double StringToDouble(const char* Begin, char** End) { return std::strtod(Begin, End); }
+    double StringToDouble(const wchar_t* Begin, wchar_t** End) { return std::wcstod(Begin, End); }
+
+    /** 숫자 뒤에 공백 말고 다른 문자가 남았으면 잘못된 문자열입니다. */
+    bool IsTrailingSpace(const TCHAR* Cursor)
+    {
+        while (*Cursor == TEXT(' ') || *Cursor == TEXT('\t') || *Cursor == TEXT('\r') || *Cursor == TEXT('\n'))
+        {
+            ++Cursor;
+        }
+        return *Cursor == TEXT('\0');
+    }
+
+    template <typename NumberType, typename ParsedType>
+    bool ParseNumber(const FString& Text, NumberType& OutValue, ParsedType(*Parse)(const TCHAR*, TCHAR**))
+    {
+        const TCHAR* Begin = *Text;
+        TCHAR* End = nullptr;
+        const NumberType Value = static_cast<NumberType>(Parse(Begin, &End));
+        if (End == Begin || !IsTrailingSpace(End))
+        {
+            return false;
+        }
+        OutValue = Value;
+        return true;
+    }
+}
+
+const FProperty* FProperty::GetPlainOldDataProperty(EPropertyType InType)
+{
+    switch (InType)
+    {
+    case EPropertyType::Bool:        return GetStandaloneProperty<bool>();
+    case EPropertyType::Int8:        return GetStandaloneProperty<int8>();
+    case EPropertyType::UInt8:       return GetStandaloneProperty<uint8>();
+    case EPropertyType::Int16:       return GetStandaloneProperty<int16>();
+    case EPropertyType::UInt16:      return GetStandaloneProperty<uint16>();
+    case EPropertyType::Int32:       return GetStandaloneProperty<int32>();
+    case EPropertyType::UInt32:      return GetStandaloneProperty<uint32>();
+    case EPropertyType::Int64:       return GetStandaloneProperty<int64>();
+    case EPropertyType::UInt64:      return GetStandaloneProperty<uint64>();
+    case EPropertyType::Float:       return GetStandaloneProperty<float>();
+    case EPropertyType::Double:      return GetStandaloneProperty<double>();
+    case EPropertyType::Vector2D:    return GetStandaloneProperty<FVector2D>();
+    case EPropertyType::Vector:      return GetStandaloneProperty<FVector>();
+    case EPropertyType::Vector4:     return GetStandaloneProperty<FVector4>();
+    case EPropertyType::Rotator:     return GetStandaloneProperty<FRotator>();
+    case EPropertyType::LinearColor: return GetStandaloneProperty<FLinearColor>();
+    default:                         return nullptr;
+    }
+}
+
+void PropertyPrivate::AppendQuotedElement(FString& OutText, const FString& Element)
+{
+    auto& Out = OutText.GetContainerPrivate();
+    Out.reserve(Out.size() + Element.Len() + 2);
+    Out.push_back(TEXT('"'));
+    for (const TCHAR Char : Element.GetContainerPrivate())
+    {
+        if (Char == TEXT('"') || Char == TEXT('\\'))
+        {
+            Out.push_back(TEXT('\\'));
+        }
+        Out.push_back(Char);
+    }
+    Out.push_back(TEXT('"'));
+}
+
+bool PropertyPrivate::SplitArrayText(const FString& Text, TArray<FString>& OutElements)
+{
+    const auto& In = Text.GetContainerPrivate();
+    const size_t Length = In.size();
+    if (Length < 2 || In.front() != TEXT('(') || In.back() != TEXT(')'))
+    {
+        return false;
+    }
+
+    OutElements.Empty();
+    size_t Cursor = 1;
+    const size_t End = Length - 1;
+    if (Cursor == End)
+    {
+        return true;
+    }
+
+    while (true)
+    {
+        if (In[Cursor] != TEXT('"'))
+        {
+            return false;
+        }
+        ++Cursor;
+
+        FString Element;
+        auto& Out = Element.GetContainerPrivate();
+        while (Cursor < End && In[Cursor] != TEXT('"'))
+        {
+            if (In[Cursor] == TEXT('\\'))
+            {
+                ++Cursor;
+                if (Cursor >= End)
+                {
+                    return false;
+                }
+            }
+            Out.push_back(In[Cursor]);
+            ++Cursor;
+        }
+        if (Cursor >= End)
+        {
+            return false;
+        }
+        ++Cursor; // 닫는 따옴표
+        OutElements.Add(std::move(Element));
+
+        if (Cursor == End)
+        {
+            return true;
+        }
+        if (In[Cursor] != TEXT(','))
+        {
+            return false;
+        }
+        ++Cursor;
+    }
+}
+
+bool PropertyPrivate::ParseInteger(const FString& Text, int64& OutValue)
+{
+    return ParseNumber(Text, OutValue, StringToInteger);
+}
+
+bool PropertyPrivate::ParseUnsignedInteger(const FString& Text, uint64& OutValue)
+{
+    return ParseNumber(Text, OutValue, StringToUnsignedInteger);
+}
+
+bool PropertyPrivate::ParseFloat(const FString& Text, double& OutValue)
+{
+    return ParseNumber(Text, OutValue, StringToDouble);
+}
@@ -1,38 +1,597 @@
 ﻿#pragma once
+#include <concepts>
+#include <cstring>
+#include <memory>
+#include <type_traits>
 #include "Object.h"
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+#include "Math/Color.h"
+#include "Math/Rotator.h"
+#include "Math/Vector.h"
+#include "Math/Vector4.h"
+#include "Serialization/Archive.h"
 
 
+/** FProperty의 성질을 나타내는 플래그 */
+enum EPropertyFlags : uint32
+{
+    CPF_None = 0,
+
+    /** 생성자, 소멸자 없이 memcpy로 복사할 수 있는 값 */
+    CPF_IsPlainOldData = 1 << 0,
+
+    /** 다른 UObject를 가리키는 포인터, 또는 그 배열. 텍스트로 저장하거나 Duplicate할 때 값을 옮기지 않습니다. */
+    CPF_ObjectReference = 1 << 1,
+
+    /** Duplicate로 복제할 때 복사하지 않습니다. */
+    CPF_DuplicateTransient = 1 << 2,
+};
+
+/**
+ * Property 값의 타입.
+ * 바이너리 Scene 파일에 그대로 기록되므로, 새 타입은 맨 뒤에 추가해야 합니다.
+ */
+enum class EPropertyType : uint8
+{
+    Unknown,
+    Bool,
+    Int8,
+    UInt8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Int64,
+    UInt64,
+    Float,
+    Double,
+    Vector2D,
+    Vector,
+    Vector4,
+    Rotator,
+    LinearColor,
+    String,
+    WideString,
+    Object,
+    Array,
+};
+
+
+/**
+ * UPROPERTY로 등록한 멤버 변수 하나의 정보.
+ * 값을 다루는 함수들은 Object가 아니라 값의 주소를 받으므로, ContainerPtrToValuePtr로 먼저 주소를 구합니다.
+ */
 struct FProperty
 {
-    FProperty(const char* InName, int32 InSize, int32 InOffset)
+    FProperty(const char* InName, EPropertyType InType, int64 InSize, int64 InOffset, uint32 InFlags)
         : Name(InName)
+        , Type(InType)
         , Size(InSize)
         , Offset(InOffset)
+        , Flags(InFlags)
     {}
 
     virtual ~FProperty() = default;
 
+    FProperty(const FProperty&) = delete;
+    FProperty& operator=(const FProperty&) = delete;
+    FProperty(FProperty&&) = delete;
+    FProperty& operator=(FProperty&&) = delete;
+
     const char* Name;
+    EPropertyType Type;
     int64 Size;
     int64 Offset;
+    uint32 Flags;
+
+    bool HasAnyFlags(uint32 InFlags) const { return (Flags & InFlags) != 0; }
+
+    void* ContainerPtrToValuePtr(void* Container) const { return static_cast<uint8*>(Container) + Offset; }
+    const void* ContainerPtrToValuePtr(const void* Container) const { return static_cast<const uint8*>(Container) + Offset; }
+
+    /** 값을 바이너리로 읽거나 씁니다. */
+    virtual void SerializeItem(FArchive& Ar, void* Value) const = 0;
+
+    /** 값을 Scene 파일과 에디터에서 쓰는 문자열로 바꿉니다. */
+    virtual void ExportText(const void* Value, FString& OutText) const = 0;
+
+    /** ExportText로 만든 문자열을 읽어 값에 씁니다. 형식이 맞지 않으면 false를 반환합니다. */
+    virtual bool ImportText(const FString& Text, void* Value) const = 0;
+
+    /** Src의 값을 Dest에 복사합니다. */
+    virtual void CopyValue(void* Dest, const void* Src) const = 0;
+
+    /**
+     * Src의 값을 Dest에 복사하면서, 가리키는 UObject가 ObjectMap에 있으면 짝이 되는 Object로 바꿉니다.
+     * ObjectMap에 없는 Object는 그대로 가리킵니다. 다른 Object를 가리키지 않는 Property는 CopyValue와 같습니다.
+     */
+    virtual void CopyValueRemapped(void* Dest, const void* Src, const TMap<UObject*, UObject*>& ObjectMap) const
+    {
+        CopyValue(Dest, Src);
+    }
+
+    /** 두 값이 같은지 비교합니다. */
+    virtual bool Identical(const void* A, const void* B) const = 0;
+
+    /**
+     * 바이너리 표현이 크기만으로 정해지는 타입(bool, 숫자, 벡터 등)의 Property를 반환합니다.
+     * Offset이 0이므로 값의 주소를 그대로 넘기면 됩니다. 그 밖의 타입이면 nullptr을 반환합니다.
+     */
+    static const FProperty* GetPlainOldDataProperty(EPropertyType InType);
+};
+
+
+namespace PropertyPrivate
+{
+    /** 배열 원소 하나를 따옴표로 감싸고, 안쪽의 따옴표와 역슬래시를 이스케이프해서 붙입니다. */
+    void AppendQuotedElement(FString& OutText, const FString& Element);
+
+    /** ("A","B") 형식의 문자열을 원소별로 나눕니다. */
+    bool SplitArrayText(const FString& Text, TArray<FString>& OutElements);
+
+    /** 문자열을 정수, 실수로 읽습니다. 문자열 전체가 숫자가 아니면 false를 반환합니다. */
+    bool ParseInteger(const FString& Text, int64& OutValue);
+    bool ParseUnsignedInteger(const FString& Text, uint64& OutValue);
+    bool ParseFloat(const FString& Text, double& OutValue);
+
+    template <typename T>
+    struct TIsTArray : std::false_type {};
+
+    template <typename T, typename Allocator>
+    struct TIsTArray<TArray<T, Allocator>> : std::true_type {};
+
+    /** ToString, InitFromString으로 텍스트를 주고받는 수학 구조체의 타입 */
+    template <typename T> constexpr EPropertyType StructPropertyType = EPropertyType::Unknown;
+    template <> inline constexpr EPropertyType StructPropertyType<FVector2D> = EPropertyType::Vector2D;
+    template <> inline constexpr EPropertyType StructPropertyType<FVector> = EPropertyType::Vector;
+    template <> inline constexpr EPropertyType StructPropertyType<FVector4> = EPropertyType::Vector4;
+    template <> inline constexpr EPropertyType StructPropertyType<FRotator> = EPropertyType::Rotator;
+    template <> inline constexpr EPropertyType StructPropertyType<FLinearColor> = EPropertyType::LinearColor;
+
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    constexpr EPropertyType GetNumericPropertyType()
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            return sizeof(T) == sizeof(float) ? EPropertyType::Float : EPropertyType::Double;
+        }
+        else if constexpr (sizeof(T) == 1)
+        {
+            return std::is_signed_v<T> ? EPropertyType::Int8 : EPropertyType::UInt8;
+        }
+        else if constexpr (sizeof(T) == 2)
+        {
+            return std::is_signed_v<T> ? EPropertyType::Int16 : EPropertyType::UInt16;
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            return std::is_signed_v<T> ? EPropertyType::Int32 : EPropertyType::UInt32;
+        }
+        else
+        {
+            return std::is_signed_v<T> ? EPropertyType::Int64 : EPropertyType::UInt64;
+        }
+    }
+}
+
+
+/** 값의 C++ 타입을 아는 Property의 공통 부분 */
+template <typename T>
+struct TPropertyBase : public FProperty
+{
+    using ValueType = T;
+
+    TPropertyBase(const char* InName, EPropertyType InType, int64 InOffset, uint32 InFlags)
+        : FProperty(InName, InType, sizeof(T), InOffset, InFlags | (std::is_trivially_copyable_v<T> ? CPF_IsPlainOldData : CPF_None))
+    {}
+
+    static T& GetValue(void* Value) { return *static_cast<T*>(Value); }
+    static const T& GetValue(const void* Value) { return *static_cast<const T*>(Value); }
+
+    virtual void CopyValue(void* Dest, const void* Src) const override
+    {
+        GetValue(Dest) = GetValue(Src);
+    }
+
+    virtual bool Identical(const void* A, const void* B) const override
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            return std::memcmp(A, B, sizeof(T)) == 0;
+        }
+        else if constexpr (std::equality_comparable<T>)
+        {
+            return GetValue(A) == GetValue(B);
+        }
+        else
+        {
+            // TArray처럼 ==가 없는 타입은 파생 Property에서 원소별로 비교합니다.
+            return false;
+        }
+    }
 };
 
 
-// struct FNumericProperty : public FProperty
-// {
-//     FNumericProperty(const char* InName, int32 InSize, int32 InOffset)
-//         : FProperty(InName, InSize, InOffset)
-//     {}
-// };
-//
-// struct FInt8Property : public FNumericProperty
-// {
-//     FInt8Property(const char* InName, int32 InSize, int32 InOffset)
-//         : FNumericProperty(InName, InSize, InOffset)
-//     {}
-//
-//     virtual void Serialize(void* Data) const override
-//     {
-//         
-//     }
-// };
\ No newline at end of file
+struct FBoolProperty : public TPropertyBase<bool>
+{
+    FBoolProperty(const char* InName, int64 InOffset, uint32 InFlags)
+        : TPropertyBase(InName, EPropertyType::Bool, InOffset, InFlags)
+    {}
+
+    virtual void SerializeItem(FArchive& Ar, void* Value) const override
+    {
+        Ar << GetValue(Value);
+    }
+
+    virtual void ExportText(const void* Value, FString& OutText) const override
+    {
+        OutText = GetValue(Value) ? TEXT("true") : TEXT("false");
+    }
+
+    virtual bool ImportText(const FString& Text, void* Value) const override
+    {
+        GetValue(Value) = Text.ToBool();
+        return true;
+    }
+};
+
+
+/** 정수, 실수 Property. 실수는 이전 Scene 파일과 같도록 %f 형식으로 씁니다. */
+template <typename T>
+    requires std::is_arithmetic_v<T>
+struct TNumericProperty : public TPropertyBase<T>
+{
+    using Super = TPropertyBase<T>;
+
+    TNumericProperty(const char* InName, int64 InOffset, uint32 InFlags)
+        : Super(InName, PropertyPrivate::GetNumericPropertyType<T>(), InOffset, InFlags)
+    {}
+
+    virtual void SerializeItem(FArchive& Ar, void* Value) const override
+    {
+        Ar << Super::GetValue(Value);
+    }
+
+    virtual void ExportText(const void* Value, FString& OutText) const override
+    {
+        const T& Number = Super::GetValue(Value);
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            OutText = FString::Printf(TEXT("%f"), static_cast<double>(Number));
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            OutText = FString::Printf(TEXT("%lld"), static_cast<long long>(Number));
+        }
+        else
+        {
+            OutText = FString::Printf(TEXT("%llu"), static_cast<unsigned long long>(Number));
+        }
+    }
+
+    virtual bool ImportText(const FString& Text, void* Value) const override
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            double Number = 0.0;
+            if (!PropertyPrivate::ParseFloat(Text, Number))
+            {
+                return false;
+            }
+            Super::GetValue(Value) = static_cast<T>(Number);
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            int64 Number = 0;
+            if (!PropertyPrivate::ParseInteger(Text, Number))
+            {
+                return false;
+            }
+            Super::GetValue(Value) = static_cast<T>(Number);
+        }
+        else
+        {
+            uint64 Number = 0;
+            if (!PropertyPrivate::ParseUnsignedInteger(Text, Number))
+            {
+                return false;
+            }
+            Super::GetValue(Value) = static_cast<T>(Number);
+        }
+        return true;
+    }
+};
+
+
+/** FVector, FRotator처럼 ToString, InitFromString을 가진 수학 구조체 Property */
+template <typename T>
+    requires std::is_trivially_copyable_v<T> && (PropertyPrivate::StructPropertyType<T> != EPropertyType::Unknown)
+struct TStructProperty : public TPropertyBase<T>
+{
+    using Super = TPropertyBase<T>;
+
+    TStructProperty(const char* InName, int64 InOffset, uint32 InFlags)
+        : Super(InName, PropertyPrivate::StructPropertyType<T>, InOffset, InFlags)
+    {}
+
+    virtual void SerializeItem(FArchive& Ar, void* Value) const override
+    {
+        Ar.Serialize(Value, sizeof(T));
+    }
+
+    virtual void ExportText(const void* Value, FString& OutText) const override
+    {
+        OutText = Super::GetValue(Value).ToString();
+    }
+
+    virtual bool ImportText(const FString& Text, void* Value) const override
+    {
+        // InitFromString은 실패해도 값을 바꾸므로 임시 값에 먼저 읽습니다.
+        T Parsed = Super::GetValue(Value);
+        if (!Parsed.InitFromString(Text))
+        {
+            return false;
+        }
+        Super::GetValue(Value) = Parsed;
+        return true;
+    }
+};
+
+
+struct FStrProperty : public TPropertyBase<FString>
+{
+    FStrProperty(const char* InName, int64 InOffset, uint32 InFlags)
+        : TPropertyBase(InName, EPropertyType::String, InOffset, InFlags)
+    {}
+
+    virtual void SerializeItem(FArchive& Ar, void* Value) const override
+    {
+        Ar << GetValue(Value);
+    }
+
+    virtual void ExportText(const void* Value, FString& OutText) const override
+    {
+        OutText = GetValue(Value);
+    }
+
+    virtual bool ImportText(const FString& Text, void* Value) const override
+    {
+        GetValue(Value) = Text;
+        return true;
+    }
+};
+
+
+/** FWString Property. 저장할 때는 FString으로 바꿔서 씁니다. */
+struct FWideStrProperty : public TPropertyBase<FWString>
+{
+    FWideStrProperty(const char* InName, int64 InOffset, uint32 InFlags)
+        : TPropertyBase(InName, EPropertyType::WideString, InOffset, InFlags)
+    {}
+
+    virtual void SerializeItem(FArchive& Ar, void* Value) const override
+    {
+        FString String = Ar.IsSaving() ? FString(GetValue(Value)) : FString();
+        Ar << String;
+        if (Ar.IsLoading())
+        {
+            GetValue(Value) = String.ToWideString();
+        }
+    }
+
+    virtual void ExportText(const void* Value, FString& OutText) const override
+    {
+        OutText = FString(GetValue(Value));
+    }
+
+    virtual bool ImportText(const FString& Text, void* Value) const override
+    {
+        GetValue(Value) = Text.ToWideString();
+        return true;
+    }
+};
+
+
+/**
+ * UObject 포인터 Property.
+ * UPROPERTY를 선언하는 곳에서 T가 전방 선언만 되어 있을 수 있으므로, UObject*로 다룹니다.
+ * 텍스트로는 이름만 쓰고, 다시 읽을 때는 None만 받습니다. 실제 참조는 소유자가 다시 연결합니다.
+ */
+template <typename T>
+struct TObjectProperty : public TPropertyBase<T*>
+{
+    using Super = TPropertyBase<T*>;
+
+    TObjectProperty(const char* InName, int64 InOffset, uint32 InFlags)
+        : Super(InName, EPropertyType::Object, InOffset, InFlags | CPF_ObjectReference)
+    {}
+
+    static UObject*& GetObject(void* Value) { return *static_cast<UObject**>(Value); }
+    static UObject* GetObject(const void* Value) { return *static_cast<UObject* const*>(Value); }
+
+    virtual void SerializeItem(FArchive& Ar, void* Value) const override
+    {
+        Ar << GetObject(Value);
+    }
+
+    virtual void ExportText(const void* Value, FString& OutText) const override
+    {
+        const UObject* Object = GetObject(Value);
+        OutText = Object ? Object->GetName() : FString(TEXT("None"));
+    }
+
+    virtual bool ImportText(const FString& Text, void* Value) const override
+    {
+        if (Text == TEXT("None"))
+        {
+            GetObject(Value) = nullptr;
+            return true;
+        }
+        return false;
+    }
+
+    virtual void CopyValueRemapped(void* Dest, const void* Src, const TMap<UObject*, UObject*>& ObjectMap) const override
+    {
+        UObject* Object = GetObject(Src);
+        if (UObject* const* Replacement = ObjectMap.Find(Object))
+        {
+            Object = *Replacement;
+        }
+        GetObject(Dest) = Object;
+    }
+};
+
+
+template <typename T>
+FProperty* CreateProperty(const char* InName, int64 InOffset, uint32 InFlags);
+
+
+/** TArray Property. 원소는 Inner Property로 다룹니다. */
+template <typename T>
+struct TArrayProperty : public TPropertyBase<TArray<T>>
+{
+    using Super = TPropertyBase<TArray<T>>;
+
+    TArrayProperty(const char* InName, int64 InOffset, uint32 InFlags)
+        : Super(InName, EPropertyType::Array, InOffset, InFlags)
+        , Inner(CreateProperty<T>(InName, 0, CPF_None))
+    {
+        this->Flags |= Inner->Flags & CPF_ObjectReference;
+    }
+
+    /** 원소 하나를 다루는 Property. Offset은 0입니다. */
+    std::unique_ptr<FProperty> Inner;
+
+    virtual void SerializeItem(FArchive& Ar, void* Value) const override
+    {
+        TArray<T>& Array = Super::GetValue(Value);
+        int32 Num = Array.Num();
+        Ar << Num;
+        if (Ar.IsLoading())
+        {
+            Array.SetNum(Num > 0 ? Num : 0);
+        }
+        for (T& Element : Array)
+        {
+            Inner->SerializeItem(Ar, &Element);
+        }
+    }
+
+    virtual void ExportText(const void* Value, FString& OutText) const override
+    {
+        OutText = TEXT("(");
+        FString ElementText;
+        bool bFirst = true;
+        for (const T& Element : Super::GetValue(Value))
+        {
+            if (!bFirst)
+            {
+                OutText += TEXT(",");
+            }
+            bFirst = false;
+
+            Inner->ExportText(&Element, ElementText);
+            PropertyPrivate::AppendQuotedElement(OutText, ElementText);
+        }
+        OutText += TEXT(")");
+    }
+
+    virtual bool ImportText(const FString& Text, void* Value) const override
+    {
+        TArray<FString> Elements;
+        if (!PropertyPrivate::SplitArrayText(Text, Elements))
+        {
+            return false;
+        }
+
+        TArray<T> Parsed;
+        Parsed.SetNum(Elements.Num());
+        for (int32 Index = 0; Index < Elements.Num(); ++Index)
+        {
+            if (!Inner->ImportText(Elements[Index], &Parsed[Index]))
+            {
+                return false;
+            }
+        }
+        Super::GetValue(Value) = std::move(Parsed);
+        return true;
+    }
+
+    virtual void CopyValueRemapped(void* Dest, const void* Src, const TMap<UObject*, UObject*>& ObjectMap) const override
+    {
+        const TArray<T>& SrcArray = Super::GetValue(Src);
+        TArray<T>& DestArray = Super::GetValue(Dest);
+        DestArray.SetNum(SrcArray.Num());
+        for (int32 Index = 0; Index < SrcArray.Num(); ++Index)
+        {
+            Inner->CopyValueRemapped(&DestArray[Index], &SrcArray[Index], ObjectMap);
+        }
+    }
+
+    virtual bool Identical(const void* A, const void* B) const override
+    {
+        const TArray<T>& ArrayA = Super::GetValue(A);
+        const TArray<T>& ArrayB = Super::GetValue(B);
+        if (ArrayA.Num() != ArrayB.Num())
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < ArrayA.Num(); ++Index)
+        {
+            if (!Inner->Identical(&ArrayA[Index], &ArrayB[Index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+
+/**
+ * 멤버 변수의 타입에 맞는 Property를 만듭니다. UPROPERTY 매크로에서 호출합니다.
+ * @param InName 변수 이름, Scene 파일의 Key로 쓰입니다.
+ * @param InOffset Object 시작 주소로부터의 위치
+ * @param InFlags EPropertyFlags
+ */
+template <typename T>
+FProperty* CreateProperty(const char* InName, int64 InOffset, uint32 InFlags)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return new FBoolProperty(InName, InOffset, InFlags);
+    }
+    else if constexpr (std::is_arithmetic_v<T>)
+    {
+        return new TNumericProperty<T>(InName, InOffset, InFlags);
+    }
+    else if constexpr (std::is_same_v<T, FString>)
+    {
+        return new FStrProperty(InName, InOffset, InFlags);
+    }
+    else if constexpr (std::is_same_v<T, FWString>)
+    {
+        return new FWideStrProperty(InName, InOffset, InFlags);
+    }
+    else if constexpr (std::is_pointer_v<T>)
+    {
+        return new TObjectProperty<std::remove_pointer_t<T>>(InName, InOffset, InFlags);
+    }
+    else if constexpr (PropertyPrivate::TIsTArray<T>::value)
+    {
+        return new TArrayProperty<typename T::ElementType>(InName, InOffset, InFlags);
+    }
+    else if constexpr (PropertyPrivate::StructPropertyType<T> != EPropertyType::Unknown)
+    {
+        return new TStructProperty<T>(InName, InOffset, InFlags);
+    }
+    else
+    {
+        static_assert(!sizeof(T), "UPROPERTY에서 지원하지 않는 타입입니다.");
+        return nullptr;
+    }
+}
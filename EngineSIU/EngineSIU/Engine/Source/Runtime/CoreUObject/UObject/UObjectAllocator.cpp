@@ -0,0 +1,107 @@
+#include "UObjectAllocator.h"
+
+#include <cassert>
+#include "HAL/PlatformMemory.h"
+
+
+FUObjectAllocator& FUObjectAllocator::Get()
+{
+    static FUObjectAllocator Instance;
+    return Instance;
+}
+
+FUObjectAllocator::~FUObjectAllocator()
+{
+    for (void* Slab : Slabs)
+    {
+        FPlatformMemory::AlignedFree<EAT_Object>(Slab, SlabSize);
+    }
+    Slabs.Empty();
+}
+
+void* FUObjectAllocator::Allocate(size_t Size, size_t Alignment)
+{
+    assert(IsInOwnerThread() && "UObject는 메인 스레드에서만 생성합니다. Worker에서는 FJobSystem::EnqueueMainThread로 넘기세요.");
+    assert(Alignment <= MaxAlignment);
+
+    ++Stats.TotalAllocations;
+
+    if (Size > MaxPooledSize)
+    {
+        void* Ptr = FPlatformMemory::AlignedMalloc<EAT_Object>(GetLargeAllocationSize(Size), MaxAlignment);
+        if (Ptr)
+        {
+            ++Stats.NumLargeObjects;
+            ++Stats.NumLiveObjects;
+            Stats.LiveBytes += Size;
+        }
+        return Ptr;
+    }
+
+    const size_t PoolIndex = GetPoolIndex(Size);
+    const size_t SlotSize = GetSlotSize(PoolIndex);
+    FPool& Pool = Pools[PoolIndex];
+
+    void* Ptr;
+    if (Pool.FreeList)
+    {
+        Ptr = Pool.FreeList;
+        Pool.FreeList = Pool.FreeList->Next;
+    }
+    else
+    {
+        if (Pool.Cursor == nullptr || Pool.Cursor + SlotSize > Pool.End)
+        {
+            AllocateSlab(Pool);
+        }
+        Ptr = Pool.Cursor;
+        Pool.Cursor += SlotSize;
+    }
+
+    ++Stats.NumLiveObjects;
+    Stats.LiveBytes += SlotSize;
+    return Ptr;
+}
+
+void FUObjectAllocator::Free(void* Ptr, size_t Size)
+{
+    if (Ptr == nullptr)
+    {
+        return;
+    }
+
+    assert(IsInOwnerThread() && "UObject는 메인 스레드에서만 해제합니다.");
+
+    ++Stats.TotalFrees;
+    --Stats.NumLiveObjects;
+
+    if (Size > MaxPooledSize)
+    {
+        --Stats.NumLargeObjects;
+        Stats.LiveBytes -= Size;
+        FPlatformMemory::AlignedFree<EAT_Object>(Ptr, GetLargeAllocationSize(Size));
+        return;
+    }
+
+    const size_t PoolIndex = GetPoolIndex(Size);
+    Stats.LiveBytes -= GetSlotSize(PoolIndex);
+
+    FPool& Pool = Pools[PoolIndex];
+    FFreeSlot* Slot = static_cast<FFreeSlot*>(Ptr);
+    Slot->Next = Pool.FreeList;
+    Pool.FreeList = Slot;
+}
+
+void FUObjectAllocator::AllocateSlab(FPool& Pool)
+{
+    // 남은 자투리는 Slot 하나보다 작으므로 버립니다.
+    uint8* Slab = static_cast<uint8*>(FPlatformMemory::AlignedMalloc<EAT_Object>(SlabSize, MaxAlignment));
+    assert(Slab);
+
+    Slabs.Add(Slab);
+    Pool.Cursor = Slab;
+    Pool.End = Slab + SlabSize;
+
+    ++Stats.NumSlabs;
+    Stats.SlabBytes += SlabSize;
+}
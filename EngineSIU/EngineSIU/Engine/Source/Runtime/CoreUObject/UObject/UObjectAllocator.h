@@ -0,0 +1,92 @@
+#pragma once
+#include <thread>
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+
+/** FUObjectAllocator의 할당 통계 */
+struct FUObjectAllocatorStats
+{
+    /** 현재 살아 있는 UObject 수와 Slot 크기 기준 바이트 */
+    uint64 NumLiveObjects = 0;
+    uint64 LiveBytes = 0;
+
+    /** Pool이 OS에서 받아 둔 Slab의 수와 바이트. Pool 밖에서 할당된 큰 UObject는 포함하지 않습니다. */
+    uint32 NumSlabs = 0;
+    uint64 SlabBytes = 0;
+
+    /** MaxPooledSize보다 커서 Pool을 거치지 않고 할당된 UObject 수 */
+    uint64 NumLargeObjects = 0;
+
+    uint64 TotalAllocations = 0;
+    uint64 TotalFrees = 0;
+};
+
+
+/**
+ * UObject 전용 Size-Class Pool Allocator.
+ *
+ * 크기를 SizeClassGranularity 단위로 올림해서 같은 크기의 클래스끼리 하나의 Pool을 공유합니다.
+ * 각 Pool은 Slab을 잘라 Slot으로 나눠 주고, 해제된 Slot은 Free List에 넣어 다음 할당에 재사용합니다.
+ * FUObjectArray::ProcessPendingDestroyObjects에서 지워진 오브젝트의 메모리가 이 경로로 돌아옵니다.
+ *
+ * @note GUObjectArray와 마찬가지로 메인 스레드에서만 사용합니다. 잠금이 없으므로, Debug 빌드에서는 처음 사용한 스레드가 아닌 곳에서 할당하거나 해제하면 assert로 멈춥니다.
+ */
+class FUObjectAllocator
+{
+public:
+    static constexpr size_t SizeClassGranularity = 16;
+    static constexpr size_t MaxPooledSize = 2048;
+    static constexpr size_t SlabSize = 64 * 1024;
+
+    /** Slot과 큰 UObject가 보장하는 정렬. 이보다 큰 정렬이 필요한 UObject는 지원하지 않습니다. */
+    static constexpr size_t MaxAlignment = 16;
+
+    static FUObjectAllocator& Get();
+
+    void* Allocate(size_t Size, size_t Alignment);
+
+    /** @param Size Allocate에 넘긴 크기. UObject::operator delete가 받는 동적 타입의 크기와 같습니다. */
+    void Free(void* Ptr, size_t Size);
+
+    const FUObjectAllocatorStats& GetStats() const { return Stats; }
+
+private:
+    FUObjectAllocator() = default;
+    ~FUObjectAllocator();
+
+    FUObjectAllocator(const FUObjectAllocator&) = delete;
+    FUObjectAllocator& operator=(const FUObjectAllocator&) = delete;
+
+    struct FFreeSlot
+    {
+        FFreeSlot* Next;
+    };
+
+    struct FPool
+    {
+        FFreeSlot* FreeList = nullptr;
+
+        /** 마지막 Slab에서 아직 나눠 주지 않은 영역 */
+        uint8* Cursor = nullptr;
+        uint8* End = nullptr;
+    };
+
+    static constexpr size_t NumPools = MaxPooledSize / SizeClassGranularity;
+
+    static size_t GetPoolIndex(size_t Size) { return (Size + SizeClassGranularity - 1) / SizeClassGranularity - 1; }
+    static size_t GetSlotSize(size_t PoolIndex) { return (PoolIndex + 1) * SizeClassGranularity; }
+    static size_t GetLargeAllocationSize(size_t Size) { return (Size + MaxAlignment - 1) & ~(MaxAlignment - 1); }
+
+    void AllocateSlab(FPool& Pool);
+
+    bool IsInOwnerThread() const { return std::this_thread::get_id() == OwnerThreadId; }
+
+private:
+    /** Get()을 처음 호출한 스레드. 엔진 초기화 순서상 메인 스레드입니다. */
+    std::thread::id OwnerThreadId = std::this_thread::get_id();
+
+    FPool Pools[NumPools];
+    TArray<void*> Slabs;
+    FUObjectAllocatorStats Stats;
+};
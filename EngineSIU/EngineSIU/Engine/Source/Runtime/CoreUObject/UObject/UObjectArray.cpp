@@ -9,6 +9,16 @@ void FUObjectArray::AddObject(UObject* Object)
     AddToClassMap(Object);
 }
 
+void FUObjectArray::AddObjects(const TArray<UObject*>& Objects)
+{
+    ObjObjects.Reserve(ObjObjects.Num() + Objects.Num());
+    for (UObject* Object : Objects)
+    {
+        ObjObjects.Add(Object);
+    }
+    AddToClassMap(Objects);
+}
+
 void FUObjectArray::MarkRemoveObject(UObject* Object)
 {
     ObjObjects.Remove(Object);
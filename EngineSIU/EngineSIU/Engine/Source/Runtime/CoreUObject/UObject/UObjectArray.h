@@ -10,6 +10,9 @@ class FUObjectArray
 {
 public:
     void AddObject(UObject* Object);
+
+    /** 여러 Object를 한 번에 등록합니다. 테이블과 클래스별 목록을 한 번씩만 늘립니다. */
+    void AddObjects(const TArray<UObject*>& Objects);
     void MarkRemoveObject(UObject* Object);
 
     void ProcessPendingDestroyObjects();
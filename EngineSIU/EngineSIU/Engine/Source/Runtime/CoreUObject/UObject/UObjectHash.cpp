@@ -2,118 +2,76 @@
 #include <cassert>
 #include "Object.h"
 #include "Class.h"
+#include "CoreMiscDefines.h"
 #include "Container/Map.h"
-#include "Container/Set.h"
 
-/**
- * 모든 UObject의 정보를 담고 있는 HashTable
- */
-struct FUObjectHashTables
-{
-    static FUObjectHashTables& Get()
-    {
-        static FUObjectHashTables Singleton;
-        return Singleton;
-    }
-
-    TMap<UClass*, TSet<UClass*>> ClassToChildListMap;
-    TMap<UClass*, TSet<UObject*>> ClassToObjectListMap;
-};
 
-/** Helper function that returns all the children of the specified class recursively */
-template <typename ClassType, typename ArrayAllocator>
-static void RecursivelyPopulateDerivedClasses(FUObjectHashTables& ThreadHash, const UClass* ParentClass, TArray<ClassType, ArrayAllocator>& OutAllDerivedClass)
+void AddToClassMap(UObject* Object)
 {
-    // Start search with the parent class at virtual index Num-1, then continue searching from index Num as things are added
-    int32 SearchIndex = OutAllDerivedClass.Num() - 1;
-    const UClass* SearchClass = ParentClass;
-
-    while (true)
-    {
-        if (TSet<UClass*>* ChildSet = ThreadHash.ClassToChildListMap.Find(const_cast<UClass*>(SearchClass)))
-        {
-            OutAllDerivedClass.Reserve(OutAllDerivedClass.Num() + ChildSet->Num());
-            for (UClass* ChildClass : *ChildSet)
-            {
-                OutAllDerivedClass.Add(ChildClass);
-            }
-        }
-
-        // Now search at next index, if it has been filled in by code above
-        ++SearchIndex;
+    assert(Object->GetClass());
 
-        if (SearchIndex < OutAllDerivedClass.Num())
-        {
-            SearchClass = OutAllDerivedClass[SearchIndex];			
-        }
-        else
-        {
-            return;
-        }
-    }
+    // Object는 정확한 클래스의 목록에만 들어가고, 파생 클래스까지의 검색은 클래스 트리 구간으로 처리합니다.
+    TArray<UObject*>& ClassObjects = Object->GetClass()->ClassObjects;
+    Object->InternalIndex = static_cast<uint32>(ClassObjects.Add(Object));
 }
 
-void AddToClassMap(UObject* Object)
+void AddToClassMap(const TArray<UObject*>& Objects)
 {
-    assert(Object->GetClass());
-    FUObjectHashTables& HashTable = FUObjectHashTables::Get();
-
-    UClass* Class = Object->GetClass();
-    HashTable.ClassToObjectListMap.FindOrAdd(Class).Add(Object);
+    TMap<UClass*, int32> NumObjectsPerClass;
+    for (const UObject* Object : Objects)
+    {
+        ++NumObjectsPerClass.FindOrAdd(Object->GetClass());
+    }
+    for (const auto& [Class, NumObjects] : NumObjectsPerClass)
+    {
+        Class->ClassObjects.Reserve(Class->ClassObjects.Num() + NumObjects);
+    }
 
-    for (UClass* SuperClass = Class->GetSuperClass(); SuperClass;)
+    for (UObject* Object : Objects)
     {
-        HashTable.ClassToChildListMap.FindOrAdd(SuperClass).Add(Class);
-    
-        Class = SuperClass;
-        SuperClass = SuperClass->GetSuperClass();
+        AddToClassMap(Object);
     }
 }
 
 void RemoveFromClassMap(UObject* Object)
 {
     assert(Object->GetClass());
-    FUObjectHashTables& HashTable = FUObjectHashTables::Get();
 
-    TSet<UObject*>& ObjectSet = HashTable.ClassToObjectListMap.FindOrAdd(Object->GetClass());
-    int32 NumRemoved = ObjectSet.Remove(Object);
-
-    if (NumRemoved == 0)
+    TArray<UObject*>& ClassObjects = Object->GetClass()->ClassObjects;
+    const uint32 Index = Object->InternalIndex;
+    if (Index >= static_cast<uint32>(ClassObjects.Num()) || ClassObjects[Index] != Object)
     {
-        HashTable.ClassToObjectListMap.Remove(Object->GetClass());
+        // 이미 제거된 Object
+        return;
     }
+
+    UObject* LastObject = ClassObjects[ClassObjects.Num() - 1];
+    LastObject->InternalIndex = Index;
+    ClassObjects.RemoveAtSwap(Index);
+    Object->InternalIndex = static_cast<uint32>(INDEX_NONE);
 }
 
 void GetChildOfClass(UClass* ClassToLookFor, TArray<UClass*>& Results)
 {
-    Results.Add(ClassToLookFor);
+    const TArray<UClass*>& ClassTree = UClass::GetClassesInTreeOrder();
+    const uint32 First = ClassToLookFor->GetClassTreeIndex();
+    const uint32 Last = First + ClassToLookFor->GetNumDerivedClasses();
 
-    FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-    RecursivelyPopulateDerivedClasses(ThreadHash, ClassToLookFor, Results);
+    Results.Reserve(Results.Num() + ClassToLookFor->GetNumDerivedClasses() + 1);
+    for (uint32 Index = First; Index <= Last; ++Index)
+    {
+        Results.Add(ClassTree[Index]);
+    }
 }
 
 void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results, bool bIncludeDerivedClasses)
 {
-    // Most classes searched for have around 10 subclasses, some have hundreds
-    TArray<const UClass*> ClassesToSearch;
-    ClassesToSearch.Add(ClassToLookFor);
-
-    FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-
-    if (bIncludeDerivedClasses)
-    {
-        RecursivelyPopulateDerivedClasses(ThreadHash, ClassToLookFor, ClassesToSearch);
-    }
-
+    const TArray<UClass*>& ClassTree = UClass::GetClassesInTreeOrder();
+    const uint32 First = ClassToLookFor->GetClassTreeIndex();
+    const uint32 Last = bIncludeDerivedClasses ? First + ClassToLookFor->GetNumDerivedClasses() : First;
 
-    for (const UClass* SearchClass : ClassesToSearch)
+    for (uint32 Index = First; Index <= Last; ++Index)
     {
-        if (TSet<UObject*>* List = ThreadHash.ClassToObjectListMap.Find(const_cast<UClass*>(SearchClass)))
-        {
-            for (const auto& Object : *List)
-            {
-                Results.Add(Object);
-            }
-        }
+        Results.Append(ClassTree[Index]->GetClassObjects());
     }
 }
@@ -9,19 +9,22 @@ class UClass;
  * @param ClassToLookFor 반환할 Object의 Class정보
  * @param Results ClassToLookFor와 일치하는 모든 Objects가 담길 목록
  * @param bIncludeDerivedClasses ClassToLookFor의 파생 클래스까지 찾을지 여부
+ * @note Results에 복사하므로, 순회만 할 때는 복사 없이 클래스별 목록을 도는 TObjectRange를 사용합니다.
  */
 void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results, bool bIncludeDerivedClasses);
 
-/** FUObjectHashTables에 Object의 정보를 저장합니다. */
+/** Object를 Object 클래스의 목록 끝에 추가합니다. */
 void AddToClassMap(UObject* Object);
 
-/** FUObjectHashTables에 저장된 Object정보를 제거합니다. */
+/** Objects를 각 클래스의 목록 끝에 추가합니다. 클래스마다 목록을 한 번만 늘립니다. */
+void AddToClassMap(const TArray<UObject*>& Objects);
+
+/** Object 클래스의 목록에서 Object를 제거합니다. 빈자리는 마지막 Object로 채웁니다. */
 void RemoveFromClassMap(UObject* Object);
 
 /**
  * ClassToLookFor와 일치하는 자식 UClass를 반환합니다.
  * @param ClassToLookFor 찾을 자식클래스의 부모 클래스
- * @param Results ClassToLookFor의 파생클래스가 담길 목록
- * TODO: GetClassMap 사용해서 Spawn 안 된 UClass도 찾기
+ * @param Results ClassToLookFor와 그 파생클래스가 담길 목록. Object가 없는 클래스도 포함됩니다.
  */
 void GetChildOfClass(UClass* ClassToLookFor, TArray<UClass*>& Results);
\ No newline at end of file
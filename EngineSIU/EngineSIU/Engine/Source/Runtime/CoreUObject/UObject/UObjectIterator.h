@@ -1,7 +1,10 @@
 ﻿#pragma once
+#include <cstdint>
 #include "Object.h"
-#include "UObjectHash.h"
+#include "Class.h"
+#include "CoreMiscDefines.h"
 #include "Container/Array.h"
+#include "Math/MathUtility.h"
 
 #undef GetObject // Windows.h 이름 겹침
 
@@ -9,6 +12,12 @@
 /**
  * 특정 타입의 UObject 인스턴스를 순회하기 위한 반복자 클래스입니다.
  * 
+ * 클래스 트리의 전위 순서에서 T와 파생 클래스는 연속된 구간이므로, 그 구간의 클래스별 Object 목록을 차례로 돕니다.
+ * 목록을 복사하지 않으므로 반복자를 만들 때 할당이 없습니다.
+ *
+ * 각 목록은 뒤에서부터 돌기 때문에, 순회 중에 현재 Object를 지워도 (빈자리에는 이미 지나온 Object가 옮겨짐) 다른 Object를 건너뛰지 않습니다.
+ * 순회 중에 새로 만든 Object는 순회하지 않을 수도 있습니다.
+ * 
  * @tparam T 순회할 UObject 타입 또는 그 파생 클래스
  */
 template <typename T>
@@ -23,15 +32,18 @@ public:
 
     /** Begin 생성자 */
     explicit TObjectIterator(bool bIncludeDerivedClasses = true)
-        : Index(-1)
     {
-        GetObjectsOfClass(T::StaticClass(), ObjectArray, bIncludeDerivedClasses);
+        const UClass* Class = T::StaticClass();
+        ClassIndex = Class->GetClassTreeIndex();
+        LastClassIndex = bIncludeDerivedClasses ? ClassIndex + Class->GetNumDerivedClasses() : ClassIndex;
         Advance();
     }
 
     /** End 생성자 */
     TObjectIterator(EEndTagType, const TObjectIterator& Begin)
-        : Index(Begin.ObjectArray.Num())
+        : ClassIndex(Begin.LastClassIndex + 1)
+        , LastClassIndex(Begin.LastClassIndex)
+        , ObjectIndex(INDEX_NONE)
     {
     }
 
@@ -50,31 +62,50 @@ public:
         return (T*)GetObject();
     }
 
-    FORCEINLINE bool operator==(const TObjectIterator& Rhs) const { return Index == Rhs.Index; }
-    FORCEINLINE bool operator!=(const TObjectIterator& Rhs) const { return Index != Rhs.Index; }
+    FORCEINLINE bool operator==(const TObjectIterator& Rhs) const { return ClassIndex == Rhs.ClassIndex && ObjectIndex == Rhs.ObjectIndex; }
+    FORCEINLINE bool operator!=(const TObjectIterator& Rhs) const { return !(*this == Rhs); }
 
 protected:
     UObject* GetObject() const 
     { 
-        return ObjectArray[Index];
+        return CurrentObjects->GetData()[ObjectIndex];
     }
 
     bool Advance()
     {
-        while(++Index < ObjectArray.Num())
+        const TArray<UClass*>& ClassTree = UClass::GetClassesInTreeOrder();
+        while (ClassIndex <= LastClassIndex)
         {
-            if (GetObject())
+            if (!CurrentObjects)
+            {
+                CurrentObjects = &ClassTree[ClassIndex]->GetClassObjects();
+            }
+
+            // 순회 중에 Object가 여러 개 지워졌으면 목록이 현재 위치보다 짧아졌을 수 있습니다.
+            ObjectIndex = FMath::Min(ObjectIndex, CurrentObjects->Num()) - 1;
+            if (ObjectIndex >= 0)
             {
                 return true;
             }
+
+            ++ClassIndex;
+            CurrentObjects = nullptr;
+            ObjectIndex = INT32_MAX;
         }
+        ObjectIndex = INDEX_NONE;
         return false;
     }
 
 protected:
-    /** Results from the GetObjectsOfClass query */
-    TArray<UObject*> ObjectArray;
-    int32 Index;
+    /** 지금 순회 중인 클래스와 마지막 클래스의 GetClassTreeIndex() */
+    uint32 ClassIndex;
+    uint32 LastClassIndex;
+
+    /** ClassIndex 클래스의 GetClassObjects(). UClass는 옮겨지지 않으므로 목록의 주소도 바뀌지 않습니다. */
+    const TArray<UObject*>* CurrentObjects = nullptr;
+
+    /** CurrentObjects에서의 위치 */
+    int32 ObjectIndex = INT32_MAX;
 };
 
 
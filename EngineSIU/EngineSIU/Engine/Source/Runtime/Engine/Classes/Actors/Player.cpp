@@ -6,6 +6,7 @@
 #include "BaseGizmos/GizmoCircleComponent.h"
 #include "BaseGizmos/TransformGizmo.h"
 #include "Camera/CameraComponent.h"
+#include "Components/BillboardComponent.h"
 #include "Components/Light/LightComponent.h"
 #include "LevelEditor/SLevelEditor.h"
 #include "Math/JungleMath.h"
@@ -36,15 +37,20 @@ void AEditorPlayer::Input()
             GetCursorPos(&mousePos);
             GetCursorPos(&m_LastMousePos);
 
-            uint32 UUID = FEngineLoop::GraphicDevice.GetPixelUUID(mousePos);
-            // TArray<UObject*> objectArr = GetWorld()->GetObjectArr();
-            for ( const USceneComponent* obj : TObjectRange<USceneComponent>())
+            ScreenToClient(GEngineLoop.AppWnd, &mousePos);
+
+            FOnPixelUUIDResolved OnUUIDResolved;
+            OnUUIDResolved.BindLambda([](uint32 UUID)
             {
-                if (obj->GetUUID() != UUID) continue;
+                // TArray<UObject*> objectArr = GetWorld()->GetObjectArr();
+                for ( const USceneComponent* obj : TObjectRange<USceneComponent>())
+                {
+                    if (obj->GetUUID() != UUID) continue;
 
-                UE_LOG(LogLevel::Display, *obj->GetName());
-            }
-            ScreenToClient(GEngineLoop.AppWnd, &mousePos);
+                    UE_LOG(LogLevel::Display, *obj->GetName());
+                }
+            });
+            FEngineLoop::GraphicDevice.RequestPixelUUID(mousePos, std::move(OnUUIDResolved));
 
             FVector pickPosition;
 
@@ -131,21 +137,34 @@ void AEditorPlayer::PickActor(const FVector& pickPosition)
 {
     if (!(ShowFlags::GetInstance().currentFlags & EEngineShowFlags::SF_Primitives)) return;
 
-    const UActorComponent* Possible = nullptr;
-    int maxIntersect = 0;
-    float minDistance = FLT_MAX;
-    for (const auto iter : TObjectRange<UPrimitiveComponent>())
+    UWorld* World = GEngine->ActiveWorld;
+    if (!World) return;
+
+    FPrimitiveSceneIndex& SceneIndex = World->GetPrimitiveSceneIndex();
+
+    // 월드 공간 Ray로 공간 인덱스에서 후보를 먼저 좁힌 뒤, 후보에 대해서만 정밀한 교차 검사를 합니다.
+    FVector WorldRayOrigin;
+    FVector WorldRayDirection;
+    MakeWorldPickRay(pickPosition, WorldRayOrigin, WorldRayDirection);
+
+    TArray<UPrimitiveComponent*> Candidates;
+    SceneIndex.QueryRay(WorldRayOrigin, WorldRayDirection, FLT_MAX, Candidates);
+
+    // Billboard는 Bounds 없이 화면 공간에서 피킹하므로 공간 쿼리 결과 대신 따로 후보에 넣습니다.
+    Candidates.RemoveAll([](const UPrimitiveComponent* Primitive) { return Primitive->IsA<UBillboardComponent>(); });
+    for (const EScenePrimitiveType Type : { EScenePrimitiveType::Billboard, EScenePrimitiveType::Text })
     {
-        UPrimitiveComponent* pObj;
-        if (iter->IsA<UPrimitiveComponent>() || iter->IsA<ULightComponent>())
-        {
-            pObj = static_cast<UPrimitiveComponent*>(iter);
-        }
-        else
+        for (UPrimitiveComponent* Primitive : SceneIndex.GetPrimitives(Type))
         {
-            continue;
+            Candidates.Add(Primitive);
         }
+    }
 
+    const UActorComponent* Possible = nullptr;
+    int maxIntersect = 0;
+    float minDistance = FLT_MAX;
+    for (UPrimitiveComponent* pObj : Candidates)
+    {
         if (pObj && !pObj->IsA<UGizmoBaseComponent>())
         {
             float Distance = 0.0f;
@@ -201,6 +220,23 @@ void AEditorPlayer::ScreenToViewSpace(int screenX, int screenY, const FMatrix& v
     }
 }
 
+void AEditorPlayer::MakeWorldPickRay(const FVector& pickPosition, FVector& OutRayOrigin, FVector& OutRayDirection)
+{
+    FEditorViewportClient* ActiveViewport = GEngineLoop.GetLevelEditor()->GetActiveViewportClient().get();
+    const FMatrix InverseView = FMatrix::Inverse(ActiveViewport->GetViewMatrix());
+
+    if (ActiveViewport->IsOrtho())
+    {
+        OutRayOrigin = InverseView.TransformPosition(pickPosition);
+        OutRayDirection = ActiveViewport->ViewTransformOrthographic.GetForwardVector().GetSafeNormal();
+    }
+    else
+    {
+        OutRayOrigin = InverseView.TransformPosition(FVector(0, 0, 0));
+        OutRayDirection = (InverseView.TransformPosition(pickPosition) - OutRayOrigin).GetSafeNormal();
+    }
+}
+
 int AEditorPlayer::RayIntersectsObject(const FVector& pickPosition, USceneComponent* obj, float& hitDistance, int& intersectCount)
 {
     FMatrix WorldMatrix = obj->GetWorldMatrix();
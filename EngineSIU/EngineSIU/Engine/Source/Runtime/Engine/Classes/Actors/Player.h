@@ -28,6 +28,8 @@ class AEditorPlayer : public AActor
 
 private:
     int RayIntersectsObject(const FVector& pickPosition, USceneComponent* obj, float& hitDistance, int& intersectCount);
+    /** ScreenToViewSpace()로 구한 pickPosition을 월드 공간 Ray로 변환합니다. */
+    void MakeWorldPickRay(const FVector& pickPosition, FVector& OutRayOrigin, FVector& OutRayDirection);
     void ScreenToViewSpace(int screenX, int screenY, const FMatrix& viewMatrix, const FMatrix& projectionMatrix, FVector& rayOrigin);
     void PickedObjControl();
     void ControlRotation(USceneComponent* pObj, UGizmoBaseComponent* Gizmo, int32 deltaX, int32 deltaY);
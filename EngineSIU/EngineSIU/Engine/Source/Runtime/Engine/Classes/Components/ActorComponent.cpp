@@ -3,67 +3,31 @@
 #include "GameFramework/Actor.h"
 
 
-UObject* UActorComponent::Duplicate(UObject* InOuter)
+void UActorComponent::PostDuplicate()
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::PostDuplicate();
 
-    NewComponent->OwnerPrivate = OwnerPrivate;
-    NewComponent->bIsActive = bIsActive;
-    NewComponent->bAutoActive = bAutoActive;
-
-    return NewComponent;
+    // Actor 생성자에서 만들어져 복제본으로 재사용된 컴포넌트는 이미 초기화되어 있습니다.
+    if (!bHasBeenInitialized)
+    {
+        InitializeComponent();
+    }
 }
 
 void UActorComponent::GetProperties(TMap<FString, FString>& OutProperties) const
 {
-    
-    TMap<FString, FString>& Properties = OutProperties;
-    
-    Properties.Add(TEXT("ComponentName"), *GetName());
-    Properties.Add(TEXT("ComponentClass"), *GetClass()->GetName());
-    
-    Properties.Add(TEXT("ComponentOwner"), *GetOwner()->GetName());
-    Properties.Add(TEXT("ComponentOwnerClass"), *GetOwner()->GetClass()->GetName());
-
-    
-    //Properties.Add(TEXT("bRegistered"), bRegistered ? TEXT("true") : TEXT("false"));
-    //Properties.Add(TEXT("bWantsInitializeComponent"), bWantsInitializeComponent ? TEXT("true") : TEXT("false"));
-    Properties.Add(TEXT("bIsActive"), bIsActive ? TEXT("true") : TEXT("false"));
-    Properties.Add(TEXT("bAutoActive"), bAutoActive ? TEXT("true") : TEXT("false"));
-    
+    OutProperties.Add(TEXT("ComponentName"), *GetName());
+    OutProperties.Add(TEXT("ComponentClass"), *GetClass()->GetName());
+
+    OutProperties.Add(TEXT("ComponentOwner"), *GetOwner()->GetName());
+    OutProperties.Add(TEXT("ComponentOwnerClass"), *GetOwner()->GetClass()->GetName());
+
+    GetClass()->ExportProperties(this, OutProperties);
 }
 
 void UActorComponent::SetProperties(const TMap<FString, FString>& Properties)
 {
-    // Super::ApplyProperties(Properties); // 만약 UObject 레벨에 있다면
-
-    const FString* TempStr = nullptr;
-
-    // --- 설정 값 복원 ---
-
-    TempStr = Properties.Find(TEXT("bAutoActive")); // bAutoActive 변수가 있다고 가정
-    if (TempStr)
-    {
-        // 이 플래그는 보통 BeginPlay나 InitializeComponent 등에서
-        // SetActive를 호출할지 여부를 결정하는 데 사용될 수 있습니다.
-        // 여기서는 플래그 값 자체만 복원합니다.
-        this->bAutoActive = TempStr->ToBool();
-    }
-
-
-    // --- 초기 상태 값 복원 (Setter 함수 사용 권장) ---
-
-    // bIsActive: 컴포넌트의 활성화 상태 설정
-    TempStr = Properties.Find(TEXT("bIsActive"));
-    if (TempStr)
-    {
-        // bool bShouldBeActive = TempStr->ToBool();
-        // SetActive(bShouldBeActive); // SetActive 함수 호출 (구현 필요)
-
-        // 임시로 직접 설정 (만약 SetActive 함수가 없다면)
-        this->bIsActive = TempStr->ToBool();
-        // 주의: 이 경우 SetActive에 포함될 수 있는 부가 로직이 누락될 수 있습니다.
-    }
+    GetClass()->ImportProperties(Properties, this);
 }
 
 void UActorComponent::InitializeComponent()
@@ -15,15 +15,15 @@ private:
 public:
     UActorComponent() = default;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void PostDuplicate() override;
 
     /**
-* 이 컴포넌트의 직렬화 가능한 속성들을 문자열 맵으로 반환합니다.
-* 하위 클래스는 이 함수를 재정의하여 자신만의 속성을 추가해야 합니다.
-*/
+     * 이 컴포넌트의 직렬화 가능한 속성들을 문자열 맵으로 반환합니다.
+     * UPROPERTY로 선언한 값은 UClass::ExportProperties가 채우므로, 하위 클래스는 UPROPERTY가 아닌 값만 추가하면 됩니다.
+     */
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const;
 
-    /** 저장된 Properties 맵에서 컴포넌트의 상태를 복원합니다. */
+    /** 저장된 Properties 맵에서 컴포넌트의 상태를 복원합니다. 하위 클래스는 값을 읽은 뒤 필요한 갱신만 추가합니다. */
     virtual void SetProperties(const TMap<FString, FString>& Properties);
 
 
@@ -80,9 +80,11 @@ private:
     uint8 bIsBeingDestroyed : 1 = false;
 
     /** Component가 현재 활성화 중인지 여부 */
-    uint8 bIsActive : 1 = true;
+    UPROPERTY
+    (bool, bIsActive, = true)
 
 public:
     /** Component가 초기화 되었을 때, 자동으로 활성화할지 여부 */
-    uint8 bAutoActive : 1 = true;
+    UPROPERTY
+    (bool, bAutoActive, = true)
 };
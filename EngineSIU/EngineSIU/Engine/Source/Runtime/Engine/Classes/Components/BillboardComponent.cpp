@@ -7,6 +7,7 @@
 #include "Math/MathUtility.h"
 #include "UnrealEd/EditorViewportClient.h"
 #include "EngineLoop.h"
+#include "UObject/Property.h"
 
 UBillboardComponent::UBillboardComponent()
 {
@@ -17,32 +18,21 @@ UBillboardComponent::~UBillboardComponent()
 {
 }
 
-UObject* UBillboardComponent::Duplicate(UObject* InOuter)
+void UBillboardComponent::DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator)
 {
-    // GPU 버퍼는 공유하지 않고, 상태 값만 복사하여 새로 초기화하도록 함
-    UBillboardComponent* NewComponent = Cast<UBillboardComponent>(Super::Duplicate(InOuter));
-    if (NewComponent)
-    {
-        NewComponent->finalIndexU = finalIndexU;
-        NewComponent->finalIndexV = finalIndexV;
-        NewComponent->Texture = FEngineLoop::ResourceManager.GetTexture(TexturePath.ToWideString());
-        NewComponent->TexturePath = TexturePath;
-        NewComponent->m_parent = m_parent;
-    }
-    return NewComponent;
-}
+    Super::DuplicateFrom(Source, Duplicator);
 
-void UBillboardComponent::GetProperties(TMap<FString, FString>& OutProperties) const
-{
-    Super::GetProperties(OutProperties);
-    OutProperties.Add(TEXT("FinalIndexU"), FString::Printf(TEXT("%f"), finalIndexU));
-    OutProperties.Add(TEXT("FinalIndexV"), FString::Printf(TEXT("%f"), finalIndexV));
-    OutProperties.Add(TEXT("BufferKey"), TexturePath);
+    // 같은 TexturePath의 Texture는 ResourceManager가 하나만 가지고 있으므로, 다시 찾지 않고 공유합니다.
+    const UBillboardComponent* SourceBillboard = static_cast<const UBillboardComponent*>(Source);
+    Texture = SourceBillboard->Texture;
+    m_parent = SourceBillboard->m_parent;
 }
 
 void UBillboardComponent::SetProperties(const TMap<FString, FString>& InProperties)
 {
     Super::SetProperties(InProperties);
+
+    // 이전 Scene 파일은 Property 이름 대신 아래 Key로 저장되어 있습니다.
     const FString* TempStr = nullptr;
     TempStr = InProperties.Find(TEXT("FinalIndexU"));
     if (TempStr)
@@ -58,7 +48,21 @@ void UBillboardComponent::SetProperties(const TMap<FString, FString>& InProperti
     if (TempStr)
     {
         TexturePath = *TempStr;
-        Texture = FEngineLoop::ResourceManager.GetTexture(TempStr->ToWideString());
+    }
+
+    if (TempStr || InProperties.Find(TEXT("TexturePath")))
+    {
+        Texture = FEngineLoop::ResourceManager.GetTexture(TexturePath.ToWideString());
+    }
+}
+
+void UBillboardComponent::PostEditChangeProperty(const FProperty* PropertyThatChanged)
+{
+    Super::PostEditChangeProperty(PropertyThatChanged);
+
+    if (PropertyThatChanged && std::strcmp(PropertyThatChanged->Name, "TexturePath") == 0)
+    {
+        Texture = FEngineLoop::ResourceManager.GetTexture(TexturePath.ToWideString());
     }
 }
 
@@ -100,8 +104,13 @@ void UBillboardComponent::SetUUIDParent(USceneComponent* _parent)
 
 FMatrix UBillboardComponent::CreateBillboardMatrix() const
 {
-    // 카메라 뷰 행렬을 가져와서 위치 정보를 제거한 후 전치하여 LookAt 행렬 생성
-    FMatrix CameraView = GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->GetViewMatrix();
+    return CreateBillboardMatrix(GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->GetViewMatrix());
+}
+
+FMatrix UBillboardComponent::CreateBillboardMatrix(const FMatrix& ViewMatrix) const
+{
+    // 카메라 뷰 행렬에서 위치 정보를 제거한 후 전치하여 LookAt 행렬 생성
+    FMatrix CameraView = ViewMatrix;
     CameraView.M[0][3] = CameraView.M[1][3] = CameraView.M[2][3] = 0.0f;
     CameraView.M[3][0] = CameraView.M[3][1] = CameraView.M[3][2] = 0.0f;
     CameraView.M[3][3] = 1.0f;
@@ -110,16 +119,21 @@ FMatrix UBillboardComponent::CreateBillboardMatrix() const
     CameraView.M[2][2] = -CameraView.M[2][2];
     FMatrix LookAtCamera = FMatrix::Transpose(CameraView);
 
-    FVector worldLocation = RelativeLocation;
-    if (m_parent)
-        worldLocation += m_parent->GetWorldLocation();
     FVector worldScale = RelativeScale3D;
     FMatrix S = FMatrix::CreateScaleMatrix(worldScale.X, worldScale.Y, worldScale.Z);
-    FMatrix T = FMatrix::CreateTranslationMatrix(worldLocation);
+    FMatrix T = FMatrix::CreateTranslationMatrix(GetBillboardLocation());
     // 최종 빌보드 행렬 = Scale * Rotation(LookAt) * Translation
     return S * LookAtCamera * T;
 }
 
+FVector UBillboardComponent::GetBillboardLocation() const
+{
+    FVector worldLocation = RelativeLocation;
+    if (m_parent)
+        worldLocation += m_parent->GetWorldLocation();
+    return worldLocation;
+}
+
 
 bool UBillboardComponent::CheckPickingOnNDC(const TArray<FVector>& quadVertices, float& hitDistance) const
 {
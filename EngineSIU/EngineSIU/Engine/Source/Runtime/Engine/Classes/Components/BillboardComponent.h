@@ -12,9 +12,9 @@ class UBillboardComponent : public UPrimitiveComponent
 public:
     UBillboardComponent();
     virtual ~UBillboardComponent();
-    virtual UObject* Duplicate(UObject* InOuter) override;
-    virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
+    virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) override;
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
+    virtual void PostEditChangeProperty(const FProperty* PropertyThatChanged) override;
     virtual void InitializeComponent() override;
     virtual void TickComponent(float DeltaTime) override;
     virtual int CheckRayIntersection(
@@ -25,16 +25,33 @@ public:
 
     virtual void SetTexture(const FWString& _fileName);
     void SetUUIDParent(USceneComponent* _parent);
+    /** 활성 Viewport의 카메라를 바라보는 월드 행렬 */
     FMatrix CreateBillboardMatrix() const;
+
+    /** ViewMatrix의 카메라를 바라보는 월드 행렬. 여러 Viewport를 그릴 때는 그리는 Viewport의 View를 넘깁니다. */
+    FMatrix CreateBillboardMatrix(const FMatrix& ViewMatrix) const;
+
+    /** 카메라를 바라보는 사각형 중심의 월드 위치 */
+    FVector GetBillboardLocation() const;
+
+    /** 공유 Quad의 UV를 Texture UV로 바꾸는 값. Texture UV = Quad UV * GetUVScale() + GetUVOffset() */
+    virtual FVector2D GetUVOffset() const { return FVector2D(finalIndexU, finalIndexV); }
+    virtual FVector2D GetUVScale() const { return FVector2D(1.0f, 1.0f); }
     FString GetTexturePath() const { return TexturePath; }
 
-    float finalIndexU = 0.0f;
-    float finalIndexV = 0.0f;
+    UPROPERTY
+    (float, finalIndexU, = 0.0f);
+
+    UPROPERTY
+    (float, finalIndexV, = 0.0f);
+
     std::shared_ptr<FTexture> Texture;
 
 protected:
     USceneComponent* m_parent = nullptr;
-    FString TexturePath = TEXT("default");
+
+    UPROPERTY
+    (FString, TexturePath, = TEXT("default"));
 
     // NDC 픽킹을 위한 내부 함수 : quadVertices는 월드 공간 정점 배열
     bool CheckPickingOnNDC(const TArray<FVector>& quadVertices, float& hitDistance) const;
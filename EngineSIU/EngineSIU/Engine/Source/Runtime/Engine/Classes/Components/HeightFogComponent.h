@@ -6,12 +6,23 @@ class UHeightFogComponent : public UPrimitiveComponent
 {
     DECLARE_CLASS(UHeightFogComponent, UPrimitiveComponent)
 private:
-    float FogDensity;
-    float FogHeightFalloff;
-    float StartDistance;
-    float FogCutoffDistance;
-    float FogMaxOpacity;
-    FLinearColor FogInscatteringColor;
+    UPROPERTY
+    (float, FogDensity);
+
+    UPROPERTY
+    (float, FogHeightFalloff);
+
+    UPROPERTY
+    (float, StartDistance);
+
+    UPROPERTY
+    (float, FogCutoffDistance);
+
+    UPROPERTY
+    (float, FogMaxOpacity);
+
+    UPROPERTY
+    (FLinearColor, FogInscatteringColor);
 
 public:
     UHeightFogComponent(float Density = 0.5f, float HeightFalloff = 0.05f, float StartDist = 15.0f, float CutoffDist = 0.0f, float MaxOpacity = 0.75f);
@@ -29,9 +40,4 @@ public:
     void SetFogCutoffDistance(float value);
     void SetFogMaxOpacity(float value);
     void SetFogColor(FLinearColor color);
-
-    virtual UObject* Duplicate(UObject* InOuter) override;
-    virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
-    
 };
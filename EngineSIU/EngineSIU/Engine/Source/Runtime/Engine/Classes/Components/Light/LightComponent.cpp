@@ -1,6 +1,5 @@
 #include "LightComponent.h"
 #include "Components/BillboardComponent.h"
-#include "UObject/Casts.h"
 
 ULightComponent::ULightComponent()
 {
@@ -14,23 +13,6 @@ ULightComponent::~ULightComponent()
   
 }
 
-UObject* ULightComponent::Duplicate(UObject* InOuter)
-{
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
-
-    // NewComponent->Light = Light;
-    NewComponent->DiffuseColor = DiffuseColor;
-    NewComponent->SpecularColor = SpecularColor;
-    NewComponent->Attenuation = Attenuation;
-    NewComponent->AttRadius = AttRadius;
-    NewComponent->Intensity = Intensity;
-    NewComponent->Falloff = Falloff;
-    //NewComponent-> Type = Type;
-    NewComponent-> Direction = Direction;
-    
-    return NewComponent;
-}
-
 void ULightComponent::SetDiffuseColor(FLinearColor NewColor)
 {
     DiffuseColor = FVector(NewColor.R, NewColor.G, NewColor.B);
@@ -10,7 +10,6 @@ class ULightComponent : public ULightComponentBase
 public:
     ULightComponent();
     virtual ~ULightComponent() override;
-    virtual UObject* Duplicate(UObject* InOuter) override;
 
     virtual void TickComponent(float DeltaTime) override;
     virtual int CheckRayIntersection(FVector& rayOrigin, FVector& rayDirection, float& pfNearHitDistance) override;
@@ -31,14 +30,27 @@ public:
 protected:
     FBoundingBox AABB;
     
-    FVector DiffuseColor;
-    FVector SpecularColor;
-    float Attenuation;
-    float AttRadius;
-    float Intensity;
-    float Falloff;
+    UPROPERTY
+    (FVector, DiffuseColor);
+
+    UPROPERTY
+    (FVector, SpecularColor);
+
+    UPROPERTY
+    (float, Attenuation);
+
+    UPROPERTY
+    (float, AttRadius);
+
+    UPROPERTY
+    (float, Intensity);
+
+    UPROPERTY
+    (float, Falloff);
+
     // ELightType Type;
-    FVector Direction;
+    UPROPERTY
+    (FVector, Direction);
 
 public:
     FBoundingBox GetBoundingBox() const {return AABB;}
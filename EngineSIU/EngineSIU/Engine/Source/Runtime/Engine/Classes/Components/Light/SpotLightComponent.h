@@ -25,7 +25,10 @@ public:
     void SetFalloff(float NewFalloff);
 
 private:
-    float InnerConeAngle;
-    float OuterConeAngle;
+    UPROPERTY
+    (float, InnerConeAngle);
+
+    UPROPERTY
+    (float, OuterConeAngle);
 };
 
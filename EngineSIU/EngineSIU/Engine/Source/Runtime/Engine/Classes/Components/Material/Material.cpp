@@ -2,11 +2,9 @@
 #include "UObject/Casts.h"
 
 
-UObject* UMaterial::Duplicate(UObject* InOuter)
+void UMaterial::DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator)
 {
-    ThisClass* NewMaterial = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::DuplicateFrom(Source, Duplicator);
 
-    NewMaterial->materialInfo = materialInfo;
-
-    return NewMaterial;
+    materialInfo = static_cast<const UMaterial*>(Source)->materialInfo;
 }
@@ -8,7 +8,7 @@ class UMaterial : public UObject {
 public:
     UMaterial() = default;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) override;
 
     FObjMaterialInfo& GetMaterialInfo() { return materialInfo; }
     void SetMaterialInfo(const FObjMaterialInfo& value) { materialInfo = value; }
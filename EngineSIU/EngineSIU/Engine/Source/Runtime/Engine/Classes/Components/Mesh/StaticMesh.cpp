@@ -47,14 +47,19 @@ void UStaticMesh::GetUsedMaterials(TArray<UMaterial*>& Out) const
 void UStaticMesh::SetData(OBJ::FStaticMeshRenderData* renderData)
 {
     staticMeshRenderData = renderData;
+    if (staticMeshRenderData->TriangleBVH.IsEmpty())
+    {
+        staticMeshRenderData->TriangleBVH.Build(*staticMeshRenderData);
+    }
 
-    uint32 verticeNum = staticMeshRenderData->Vertices.Num();
+    // Cook된 파일에서 읽은 메시는 매핑한 파일에서 바로 GPU 버퍼를 만듭니다.
+    uint32 verticeNum = staticMeshRenderData->GetNumVertices();
     if (verticeNum <= 0) return;
-    staticMeshRenderData->VertexBuffer = FEngineLoop::Renderer.CreateImmutableVertexBuffer(staticMeshRenderData->DisplayName, staticMeshRenderData->Vertices);
+    staticMeshRenderData->VertexBuffer = FEngineLoop::Renderer.CreateImmutableVertexBuffer(staticMeshRenderData->DisplayName, staticMeshRenderData->GetVertexData(), verticeNum);
 
-    uint32 indexNum = staticMeshRenderData->Indices.Num();
+    uint32 indexNum = staticMeshRenderData->GetNumIndices();
     if (indexNum > 0)
-        staticMeshRenderData->IndexBuffer = FEngineLoop::Renderer.CreateImmutableIndexBuffer(staticMeshRenderData->DisplayName, staticMeshRenderData->Indices);
+        staticMeshRenderData->IndexBuffer = FEngineLoop::Renderer.CreateImmutableIndexBuffer(staticMeshRenderData->DisplayName, staticMeshRenderData->GetIndexData(), indexNum);
 
     for (int materialIndex = 0; materialIndex < staticMeshRenderData->Materials.Num(); materialIndex++) {
         FStaticMaterial* newMaterialSlot = new FStaticMaterial();
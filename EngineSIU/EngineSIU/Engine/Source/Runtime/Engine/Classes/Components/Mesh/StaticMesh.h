@@ -19,6 +19,9 @@ public:
     void GetUsedMaterials(TArray<UMaterial*>& Out) const;
     OBJ::FStaticMeshRenderData* GetRenderData() const { return staticMeshRenderData; }
 
+    /** 피킹에 사용하는 삼각형 BVH (메시 로컬 공간) */
+    const FStaticMeshBVH& GetTriangleBVH() const { return staticMeshRenderData->TriangleBVH; }
+
     //ObjectName은 경로까지 포함
     FWString GetOjbectName() const
     {
@@ -0,0 +1,460 @@
+#include "StaticMeshBVH.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "Define.h"
+#include "Math/MathSSE.h"
+#include "Math/MathUtility.h"
+
+namespace
+{
+    /** SAH 빌드에 사용하는 Bin 수 */
+    constexpr int32 NumSAHBins = 16;
+
+    /** 노드 하나를 방문하는 비용 (Packet 하나를 테스트하는 비용 = 1) */
+    constexpr float TraversalCost = 1.0f;
+
+    /** UPrimitiveComponent::IntersectRayTriangle과 같은 값 */
+    constexpr float RayEpsilon = 1e-6f;
+
+    uint32 GetNumPackets(uint32 NumTriangles)
+    {
+        return (NumTriangles + 3) / 4;
+    }
+
+    float GetHalfSurfaceArea(const FVector& Min, const FVector& Max)
+    {
+        const FVector Size = Max - Min;
+        return Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X;
+    }
+
+    struct FSAHBin
+    {
+        FVector BoundsMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+        FVector BoundsMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        uint32 Count = 0;
+    };
+}
+
+void FStaticMeshBVH::Build(const OBJ::FStaticMeshRenderData& RenderData)
+{
+    Empty();
+
+    const FStaticMeshVertex* Vertices = RenderData.GetVertexData();
+    const UINT* Indices = RenderData.GetIndexData();
+
+    const bool bIndexed = RenderData.GetNumIndices() > 0;
+    const uint32 NumBuildTriangles = bIndexed ? RenderData.GetNumIndices() / 3 : RenderData.GetNumVertices() / 3;
+    if (NumBuildTriangles == 0)
+    {
+        return;
+    }
+
+    auto GetPosition = [&Vertices](uint32 VertexIndex)
+    {
+        const FStaticMeshVertex& Vertex = Vertices[VertexIndex];
+        return FVector(Vertex.X, Vertex.Y, Vertex.Z);
+    };
+
+    TArray<FBuildTriangle> Triangles;
+    Triangles.Reserve(NumBuildTriangles);
+    for (uint32 TriangleIndex = 0; TriangleIndex < NumBuildTriangles; ++TriangleIndex)
+    {
+        // 기존 CheckRayIntersection과 같은 순서(0, 2, 1)로 정점을 가져옵니다.
+        FBuildTriangle Triangle;
+        if (bIndexed)
+        {
+            Triangle.V0 = GetPosition(Indices[TriangleIndex * 3]);
+            Triangle.V1 = GetPosition(Indices[TriangleIndex * 3 + 2]);
+            Triangle.V2 = GetPosition(Indices[TriangleIndex * 3 + 1]);
+        }
+        else
+        {
+            Triangle.V0 = GetPosition(TriangleIndex * 3);
+            Triangle.V1 = GetPosition(TriangleIndex * 3 + 1);
+            Triangle.V2 = GetPosition(TriangleIndex * 3 + 2);
+        }
+        Triangle.BoundsMin = Triangle.V0.ComponentMin(Triangle.V1).ComponentMin(Triangle.V2);
+        Triangle.BoundsMax = Triangle.V0.ComponentMax(Triangle.V1).ComponentMax(Triangle.V2);
+        Triangle.Centroid = (Triangle.BoundsMin + Triangle.BoundsMax) * 0.5f;
+        Triangles.Add(Triangle);
+    }
+
+    NumTriangles = static_cast<int32>(NumBuildTriangles);
+    Nodes.Reserve(static_cast<int32>(NumBuildTriangles / 2 + 1));
+    Packets.Reserve(static_cast<int32>(GetNumPackets(NumBuildTriangles) * 2));
+
+    Nodes.Add(FNode());
+    BuildRecursive(0, Triangles, 0, NumBuildTriangles, 0);
+}
+
+void FStaticMeshBVH::Empty()
+{
+    Nodes.Empty();
+    Packets.Empty();
+    NumTriangles = 0;
+}
+
+bool FStaticMeshBVH::Assign(const FNode* InNodes, int32 NumNodes, const FTrianglePacket* InPackets, int32 NumPackets, int32 InNumTriangles)
+{
+    Empty();
+
+    if (NumNodes == 0)
+    {
+        return NumPackets == 0 && InNumTriangles == 0;
+    }
+    if (NumNodes < 0 || NumPackets <= 0 || InNumTriangles <= 0)
+    {
+        return false;
+    }
+
+    // Build는 부모 다음에 자식을 추가하므로, 앞에서부터 한 번 훑으면서 깊이를 전파할 수 있습니다.
+    // 루트가 아닌 노드는 정확히 한 번만 자식으로 참조되어야 트리입니다.
+    TArray<uint8> Depths;
+    Depths.Init(0, NumNodes);
+    TArray<uint8> bReferenced;
+    bReferenced.Init(0, NumNodes);
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        const FNode& Node = InNodes[NodeIndex];
+        if (NodeIndex > 0 && !bReferenced[NodeIndex])
+        {
+            return false;
+        }
+
+        if (Node.IsLeaf())
+        {
+            if (Node.LeftOrFirstPacket > static_cast<uint32>(NumPackets) || Node.NumPackets > static_cast<uint32>(NumPackets) - Node.LeftOrFirstPacket)
+            {
+                return false;
+            }
+            continue;
+        }
+
+        const uint32 LeftChild = Node.LeftOrFirstPacket;
+        if (LeftChild <= static_cast<uint32>(NodeIndex) || LeftChild + 1 >= static_cast<uint32>(NumNodes)
+            || bReferenced[LeftChild] || bReferenced[LeftChild + 1] || Depths[NodeIndex] >= MaxBuildDepth)
+        {
+            return false;
+        }
+        bReferenced[LeftChild] = bReferenced[LeftChild + 1] = 1;
+        Depths[LeftChild] = Depths[LeftChild + 1] = Depths[NodeIndex] + 1;
+    }
+
+    Nodes.SetNum(NumNodes);
+    memcpy(Nodes.GetData(), InNodes, NumNodes * sizeof(FNode));
+    Packets.SetNum(NumPackets);
+    if (NumPackets > 0)
+    {
+        memcpy(Packets.GetData(), InPackets, NumPackets * sizeof(FTrianglePacket));
+    }
+    NumTriangles = InNumTriangles;
+    return true;
+}
+
+void FStaticMeshBVH::BuildRecursive(uint32 NodeIndex, TArray<FBuildTriangle>& Triangles, uint32 First, uint32 Count, int32 Depth)
+{
+    FVector BoundsMin(FLT_MAX, FLT_MAX, FLT_MAX);
+    FVector BoundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (uint32 Index = First; Index < First + Count; ++Index)
+    {
+        BoundsMin = BoundsMin.ComponentMin(Triangles[Index].BoundsMin);
+        BoundsMax = BoundsMax.ComponentMax(Triangles[Index].BoundsMax);
+    }
+    Nodes[NodeIndex].BoundsMin = BoundsMin;
+    Nodes[NodeIndex].BoundsMax = BoundsMax;
+
+    if (Count <= 4 || Depth >= MaxBuildDepth)
+    {
+        MakeLeaf(Nodes[NodeIndex], Triangles, First, Count);
+        return;
+    }
+
+    int32 SplitAxis = 0;
+    float SplitPosition = 0.0f;
+    const bool bShouldSplit = FindBestSplit(Triangles, First, Count, Nodes[NodeIndex], SplitAxis, SplitPosition);
+    if (!bShouldSplit && Count <= MaxLeafTriangles)
+    {
+        MakeLeaf(Nodes[NodeIndex], Triangles, First, Count);
+        return;
+    }
+
+    FBuildTriangle* Begin = Triangles.GetData() + First;
+    FBuildTriangle* End = Begin + Count;
+    FBuildTriangle* Middle = End;
+    if (bShouldSplit)
+    {
+        Middle = std::partition(Begin, End, [SplitAxis, SplitPosition](const FBuildTriangle& Triangle)
+        {
+            return Triangle.Centroid[SplitAxis] < SplitPosition;
+        });
+    }
+
+    // 모든 Centroid가 한 점에 모여 있어서 나눌 수 없으면 개수로 반씩 나눕니다.
+    if (Middle == Begin || Middle == End)
+    {
+        const FVector Size = BoundsMax - BoundsMin;
+        const int32 LongestAxis = (Size.X > Size.Y && Size.X > Size.Z) ? 0 : (Size.Y > Size.Z ? 1 : 2);
+        Middle = Begin + Count / 2;
+        std::nth_element(Begin, Middle, End, [LongestAxis](const FBuildTriangle& A, const FBuildTriangle& B)
+        {
+            return A.Centroid[LongestAxis] < B.Centroid[LongestAxis];
+        });
+    }
+
+    const uint32 LeftCount = static_cast<uint32>(Middle - Begin);
+
+    // 두 자식은 항상 연속으로 배치합니다.
+    const uint32 LeftChild = static_cast<uint32>(Nodes.Num());
+    Nodes.Add(FNode());
+    Nodes.Add(FNode());
+    Nodes[NodeIndex].LeftOrFirstPacket = LeftChild;
+    Nodes[NodeIndex].NumPackets = 0;
+
+    BuildRecursive(LeftChild, Triangles, First, LeftCount, Depth + 1);
+    BuildRecursive(LeftChild + 1, Triangles, First + LeftCount, Count - LeftCount, Depth + 1);
+}
+
+bool FStaticMeshBVH::FindBestSplit(const TArray<FBuildTriangle>& Triangles, uint32 First, uint32 Count, const FNode& Node, int32& OutAxis, float& OutSplitPosition)
+{
+    FVector CentroidMin(FLT_MAX, FLT_MAX, FLT_MAX);
+    FVector CentroidMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (uint32 Index = First; Index < First + Count; ++Index)
+    {
+        CentroidMin = CentroidMin.ComponentMin(Triangles[Index].Centroid);
+        CentroidMax = CentroidMax.ComponentMax(Triangles[Index].Centroid);
+    }
+
+    const float NodeArea = GetHalfSurfaceArea(Node.BoundsMin, Node.BoundsMax);
+    const float LeafCost = static_cast<float>(GetNumPackets(Count));
+    float BestCost = FLT_MAX;
+
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        const float AxisMin = CentroidMin[Axis];
+        const float AxisMax = CentroidMax[Axis];
+        if (AxisMax - AxisMin <= SMALL_NUMBER)
+        {
+            continue;
+        }
+
+        FSAHBin Bins[NumSAHBins];
+        const float BinScale = NumSAHBins / (AxisMax - AxisMin);
+        for (uint32 Index = First; Index < First + Count; ++Index)
+        {
+            const FBuildTriangle& Triangle = Triangles[Index];
+            const int32 BinIndex = FMath::Min(static_cast<int32>((Triangle.Centroid[Axis] - AxisMin) * BinScale), NumSAHBins - 1);
+            FSAHBin& Bin = Bins[BinIndex];
+            Bin.BoundsMin = Bin.BoundsMin.ComponentMin(Triangle.BoundsMin);
+            Bin.BoundsMax = Bin.BoundsMax.ComponentMax(Triangle.BoundsMax);
+            Bin.Count++;
+        }
+
+        // 왼쪽에서부터 누적한 면적과 개수
+        float LeftArea[NumSAHBins - 1];
+        uint32 LeftCount[NumSAHBins - 1];
+        FVector AccumMin(FLT_MAX, FLT_MAX, FLT_MAX);
+        FVector AccumMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        uint32 AccumCount = 0;
+        for (int32 BinIndex = 0; BinIndex < NumSAHBins - 1; ++BinIndex)
+        {
+            AccumCount += Bins[BinIndex].Count;
+            if (Bins[BinIndex].Count > 0)
+            {
+                AccumMin = AccumMin.ComponentMin(Bins[BinIndex].BoundsMin);
+                AccumMax = AccumMax.ComponentMax(Bins[BinIndex].BoundsMax);
+            }
+            LeftCount[BinIndex] = AccumCount;
+            LeftArea[BinIndex] = AccumCount > 0 ? GetHalfSurfaceArea(AccumMin, AccumMax) : 0.0f;
+        }
+
+        // 오른쪽에서부터 누적하면서 비용을 계산합니다.
+        AccumMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+        AccumMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        AccumCount = 0;
+        for (int32 BinIndex = NumSAHBins - 1; BinIndex > 0; --BinIndex)
+        {
+            AccumCount += Bins[BinIndex].Count;
+            if (Bins[BinIndex].Count > 0)
+            {
+                AccumMin = AccumMin.ComponentMin(Bins[BinIndex].BoundsMin);
+                AccumMax = AccumMax.ComponentMax(Bins[BinIndex].BoundsMax);
+            }
+
+            const uint32 NumLeft = LeftCount[BinIndex - 1];
+            if (NumLeft == 0 || AccumCount == 0)
+            {
+                continue;
+            }
+
+            const float RightArea = GetHalfSurfaceArea(AccumMin, AccumMax);
+            const float Cost = TraversalCost + (LeftArea[BinIndex - 1] * GetNumPackets(NumLeft) + RightArea * GetNumPackets(AccumCount)) / FMath::Max(NodeArea, SMALL_NUMBER);
+            if (Cost < BestCost)
+            {
+                BestCost = Cost;
+                OutAxis = Axis;
+                OutSplitPosition = AxisMin + BinIndex / BinScale;
+            }
+        }
+    }
+
+    return BestCost < LeafCost;
+}
+
+void FStaticMeshBVH::MakeLeaf(FNode& Node, const TArray<FBuildTriangle>& Triangles, uint32 First, uint32 Count)
+{
+    Node.LeftOrFirstPacket = static_cast<uint32>(Packets.Num());
+    Node.NumPackets = GetNumPackets(Count);
+
+    for (uint32 PacketIndex = 0; PacketIndex < Node.NumPackets; ++PacketIndex)
+    {
+        FTrianglePacket Packet = {};
+        for (uint32 Lane = 0; Lane < 4; ++Lane)
+        {
+            const uint32 TriangleIndex = PacketIndex * 4 + Lane;
+            if (TriangleIndex >= Count)
+            {
+                // 남는 Lane은 크기가 0인 삼각형으로 채웁니다.
+                break;
+            }
+
+            const FBuildTriangle& Triangle = Triangles[First + TriangleIndex];
+            const FVector Edge1 = Triangle.V1 - Triangle.V0;
+            const FVector Edge2 = Triangle.V2 - Triangle.V0;
+            Packet.V0X[Lane] = Triangle.V0.X;
+            Packet.V0Y[Lane] = Triangle.V0.Y;
+            Packet.V0Z[Lane] = Triangle.V0.Z;
+            Packet.Edge1X[Lane] = Edge1.X;
+            Packet.Edge1Y[Lane] = Edge1.Y;
+            Packet.Edge1Z[Lane] = Edge1.Z;
+            Packet.Edge2X[Lane] = Edge2.X;
+            Packet.Edge2Y[Lane] = Edge2.Y;
+            Packet.Edge2Z[Lane] = Edge2.Z;
+        }
+        Packets.Add(Packet);
+    }
+}
+
+int32 FStaticMeshBVH::IntersectRay(const FVector& RayOrigin, const FVector& RayDirection, float& OutNearestDistance) const
+{
+    if (Nodes.IsEmpty())
+    {
+        return 0;
+    }
+
+    // 0으로 나누지 않도록 아주 작은 값으로 바꿔서 역수를 구합니다.
+    auto SafeInverse = [](float Value)
+    {
+        if (FMath::Abs(Value) < 1e-20f)
+        {
+            Value = Value < 0.0f ? -1e-20f : 1e-20f;
+        }
+        return 1.0f / Value;
+    };
+    const FVector InvDirection(SafeInverse(RayDirection.X), SafeInverse(RayDirection.Y), SafeInverse(RayDirection.Z));
+
+    const VectorRegister4Float OriginX = _mm_set1_ps(RayOrigin.X);
+    const VectorRegister4Float OriginY = _mm_set1_ps(RayOrigin.Y);
+    const VectorRegister4Float OriginZ = _mm_set1_ps(RayOrigin.Z);
+    const VectorRegister4Float DirX = _mm_set1_ps(RayDirection.X);
+    const VectorRegister4Float DirY = _mm_set1_ps(RayDirection.Y);
+    const VectorRegister4Float DirZ = _mm_set1_ps(RayDirection.Z);
+    const VectorRegister4Float Zero = _mm_setzero_ps();
+    const VectorRegister4Float One = _mm_set1_ps(1.0f);
+    const VectorRegister4Float Epsilon = _mm_set1_ps(RayEpsilon);
+    const VectorRegister4Float AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const VectorRegister4Float Infinity = _mm_set1_ps(FLT_MAX);
+
+    int32 NumHits = 0;
+    VectorRegister4Float NearestT = Infinity;
+
+    uint32 Stack[MaxBuildDepth + 2];
+    int32 StackSize = 0;
+    Stack[StackSize++] = 0;
+
+    while (StackSize > 0)
+    {
+        const FNode& Node = Nodes[Stack[--StackSize]];
+
+        // Slab 테스트, 경계에 걸친 교차를 놓치지 않도록 TMax를 조금 늘립니다.
+        const float TX1 = (Node.BoundsMin.X - RayOrigin.X) * InvDirection.X;
+        const float TX2 = (Node.BoundsMax.X - RayOrigin.X) * InvDirection.X;
+        const float TY1 = (Node.BoundsMin.Y - RayOrigin.Y) * InvDirection.Y;
+        const float TY2 = (Node.BoundsMax.Y - RayOrigin.Y) * InvDirection.Y;
+        const float TZ1 = (Node.BoundsMin.Z - RayOrigin.Z) * InvDirection.Z;
+        const float TZ2 = (Node.BoundsMax.Z - RayOrigin.Z) * InvDirection.Z;
+        const float TMin = FMath::Max(FMath::Max(FMath::Min(TX1, TX2), FMath::Min(TY1, TY2)), FMath::Min(TZ1, TZ2));
+        const float TMax = FMath::Min(FMath::Min(FMath::Max(TX1, TX2), FMath::Max(TY1, TY2)), FMath::Max(TZ1, TZ2));
+        if (TMax * 1.0000004f < FMath::Max(TMin, 0.0f))
+        {
+            continue;
+        }
+
+        if (!Node.IsLeaf())
+        {
+            Stack[StackSize++] = Node.LeftOrFirstPacket;
+            Stack[StackSize++] = Node.LeftOrFirstPacket + 1;
+            continue;
+        }
+
+        // Möller–Trumbore, 삼각형 4개를 한 번에 테스트합니다.
+        for (uint32 PacketIndex = Node.LeftOrFirstPacket; PacketIndex < Node.LeftOrFirstPacket + Node.NumPackets; ++PacketIndex)
+        {
+            const FTrianglePacket& Packet = Packets[PacketIndex];
+            const VectorRegister4Float Edge1X = _mm_loadu_ps(Packet.Edge1X);
+            const VectorRegister4Float Edge1Y = _mm_loadu_ps(Packet.Edge1Y);
+            const VectorRegister4Float Edge1Z = _mm_loadu_ps(Packet.Edge1Z);
+            const VectorRegister4Float Edge2X = _mm_loadu_ps(Packet.Edge2X);
+            const VectorRegister4Float Edge2Y = _mm_loadu_ps(Packet.Edge2Y);
+            const VectorRegister4Float Edge2Z = _mm_loadu_ps(Packet.Edge2Z);
+
+            // H = Direction x Edge2
+            const VectorRegister4Float HX = _mm_sub_ps(_mm_mul_ps(DirY, Edge2Z), _mm_mul_ps(DirZ, Edge2Y));
+            const VectorRegister4Float HY = _mm_sub_ps(_mm_mul_ps(DirZ, Edge2X), _mm_mul_ps(DirX, Edge2Z));
+            const VectorRegister4Float HZ = _mm_sub_ps(_mm_mul_ps(DirX, Edge2Y), _mm_mul_ps(DirY, Edge2X));
+
+            // A = Edge1 · H, 0에 가까우면 Ray와 삼각형이 평행합니다.
+            const VectorRegister4Float A = _mm_add_ps(_mm_add_ps(_mm_mul_ps(Edge1X, HX), _mm_mul_ps(Edge1Y, HY)), _mm_mul_ps(Edge1Z, HZ));
+            VectorRegister4Float HitMask = _mm_cmpge_ps(_mm_and_ps(A, AbsMask), Epsilon);
+            const VectorRegister4Float F = _mm_div_ps(One, A);
+
+            // S = Origin - V0
+            const VectorRegister4Float SX = _mm_sub_ps(OriginX, _mm_loadu_ps(Packet.V0X));
+            const VectorRegister4Float SY = _mm_sub_ps(OriginY, _mm_loadu_ps(Packet.V0Y));
+            const VectorRegister4Float SZ = _mm_sub_ps(OriginZ, _mm_loadu_ps(Packet.V0Z));
+
+            const VectorRegister4Float U = _mm_mul_ps(F, _mm_add_ps(_mm_add_ps(_mm_mul_ps(SX, HX), _mm_mul_ps(SY, HY)), _mm_mul_ps(SZ, HZ)));
+            HitMask = _mm_and_ps(HitMask, _mm_and_ps(_mm_cmpge_ps(U, Zero), _mm_cmple_ps(U, One)));
+
+            // Q = S x Edge1
+            const VectorRegister4Float QX = _mm_sub_ps(_mm_mul_ps(SY, Edge1Z), _mm_mul_ps(SZ, Edge1Y));
+            const VectorRegister4Float QY = _mm_sub_ps(_mm_mul_ps(SZ, Edge1X), _mm_mul_ps(SX, Edge1Z));
+            const VectorRegister4Float QZ = _mm_sub_ps(_mm_mul_ps(SX, Edge1Y), _mm_mul_ps(SY, Edge1X));
+
+            const VectorRegister4Float V = _mm_mul_ps(F, _mm_add_ps(_mm_add_ps(_mm_mul_ps(DirX, QX), _mm_mul_ps(DirY, QY)), _mm_mul_ps(DirZ, QZ)));
+            HitMask = _mm_and_ps(HitMask, _mm_and_ps(_mm_cmpge_ps(V, Zero), _mm_cmple_ps(_mm_add_ps(U, V), One)));
+
+            const VectorRegister4Float T = _mm_mul_ps(F, _mm_add_ps(_mm_add_ps(_mm_mul_ps(Edge2X, QX), _mm_mul_ps(Edge2Y, QY)), _mm_mul_ps(Edge2Z, QZ)));
+            HitMask = _mm_and_ps(HitMask, _mm_cmpgt_ps(T, Epsilon));
+
+            const int32 HitBits = _mm_movemask_ps(HitMask);
+            if (HitBits == 0)
+            {
+                continue;
+            }
+
+            NumHits += std::popcount(static_cast<uint32>(HitBits));
+            NearestT = _mm_min_ps(NearestT, _mm_or_ps(_mm_and_ps(HitMask, T), _mm_andnot_ps(HitMask, Infinity)));
+        }
+    }
+
+    if (NumHits > 0)
+    {
+        // 4개 Lane 중 최솟값
+        NearestT = _mm_min_ps(NearestT, _mm_shuffle_ps(NearestT, NearestT, SHUFFLEMASK(2, 3, 0, 1)));
+        NearestT = _mm_min_ps(NearestT, _mm_shuffle_ps(NearestT, NearestT, SHUFFLEMASK(1, 0, 3, 2)));
+        OutNearestDistance = _mm_cvtss_f32(NearestT);
+    }
+    return NumHits;
+}
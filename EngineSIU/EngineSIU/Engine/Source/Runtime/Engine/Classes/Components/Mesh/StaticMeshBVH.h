@@ -0,0 +1,93 @@
+#pragma once
+#include "Container/Array.h"
+#include "Math/Vector.h"
+
+namespace OBJ
+{
+    struct FStaticMeshRenderData;
+}
+
+/**
+ * StaticMesh의 삼각형에 대한 BVH.
+ * 메시를 로드할 때 한 번 SAH로 빌드하고, Ray와 교차하는 노드만 따라 내려가며 Leaf의 삼각형을 4개씩 SIMD로 테스트합니다.
+ */
+class FStaticMeshBVH
+{
+public:
+    /** Leaf 하나가 가질 수 있는 최대 삼각형 수 */
+    static constexpr int32 MaxLeafTriangles = 8;
+
+    /** 순회 스택 크기를 넘지 않도록 이 깊이에서는 무조건 Leaf를 만듭니다. */
+    static constexpr int32 MaxBuildDepth = 60;
+
+    struct FNode
+    {
+        FVector BoundsMin;
+
+        /** 내부 노드이면 왼쪽 자식 (오른쪽 자식은 +1), Leaf이면 첫 번째 Packet */
+        uint32 LeftOrFirstPacket = 0;
+
+        FVector BoundsMax;
+
+        /** Leaf의 Packet 수, 내부 노드이면 0 */
+        uint32 NumPackets = 0;
+
+        bool IsLeaf() const { return NumPackets > 0; }
+    };
+
+    /** 삼각형 4개를 SoA로 묶은 것. 빈 Lane은 Edge가 0이라서 항상 교차하지 않습니다. */
+    struct FTrianglePacket
+    {
+        float V0X[4], V0Y[4], V0Z[4];
+        float Edge1X[4], Edge1Y[4], Edge1Z[4];
+        float Edge2X[4], Edge2Y[4], Edge2Z[4];
+    };
+
+    /** RenderData의 Vertices / Indices로 BVH를 빌드합니다. */
+    void Build(const OBJ::FStaticMeshRenderData& RenderData);
+
+    void Empty();
+
+    /**
+     * Cook된 파일에 저장해 둔 노드와 Packet으로 BVH를 채웁니다.
+     * 자식 인덱스, Packet 범위, 깊이를 검사해서 올바른 트리가 아니면 비워두고 false를 반환합니다.
+     */
+    bool Assign(const FNode* InNodes, int32 NumNodes, const FTrianglePacket* InPackets, int32 NumPackets, int32 InNumTriangles);
+
+    bool IsEmpty() const { return Nodes.IsEmpty(); }
+
+    int32 GetNumNodes() const { return Nodes.Num(); }
+    int32 GetNumTriangles() const { return NumTriangles; }
+
+    const TArray<FNode>& GetNodes() const { return Nodes; }
+    const TArray<FTrianglePacket>& GetPackets() const { return Packets; }
+
+    /**
+     * 메시 로컬 공간의 Ray와 교차하는 삼각형을 찾습니다.
+     * @param OutNearestDistance 가장 가까운 교차 거리, 교차가 없으면 변경하지 않습니다.
+     * @return 교차한 삼각형의 수
+     */
+    int32 IntersectRay(const FVector& RayOrigin, const FVector& RayDirection, float& OutNearestDistance) const;
+
+private:
+    /** 빌드 중에만 사용하는 삼각형 정보 */
+    struct FBuildTriangle
+    {
+        FVector V0, V1, V2;
+        FVector BoundsMin;
+        FVector BoundsMax;
+        FVector Centroid;
+    };
+
+    void BuildRecursive(uint32 NodeIndex, TArray<FBuildTriangle>& Triangles, uint32 First, uint32 Count, int32 Depth);
+
+    /** SAH 비용이 가장 작은 분할 위치를 찾습니다. 분할하는 것이 Leaf보다 비싸면 false를 반환합니다. */
+    static bool FindBestSplit(const TArray<FBuildTriangle>& Triangles, uint32 First, uint32 Count, const FNode& Node, int32& OutAxis, float& OutSplitPosition);
+
+    void MakeLeaf(FNode& Node, const TArray<FBuildTriangle>& Triangles, uint32 First, uint32 Count);
+
+private:
+    TArray<FNode> Nodes;
+    TArray<FTrianglePacket> Packets;
+    int32 NumTriangles = 0;
+};
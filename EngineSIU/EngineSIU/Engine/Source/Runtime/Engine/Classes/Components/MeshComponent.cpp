@@ -4,23 +4,11 @@
 #include "UObject/Casts.h"
 
 
-UObject* UMeshComponent::Duplicate(UObject* InOuter)
+void UMeshComponent::DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::DuplicateFrom(Source, Duplicator);
 
-    NewComponent->OverrideMaterials = OverrideMaterials;
-
-    return NewComponent;
-}
-
-void UMeshComponent::GetProperties(TMap<FString, FString>& OutProperties) const
-{
-    Super::GetProperties(OutProperties);
-}
-
-void UMeshComponent::SetProperties(const TMap<FString, FString>& InProperties)
-{
-    Super::SetProperties(InProperties);
+    OverrideMaterials = static_cast<const UMeshComponent*>(Source)->OverrideMaterials;
 }
 
 UMaterial* UMeshComponent::GetMaterial(uint32 ElementIndex) const
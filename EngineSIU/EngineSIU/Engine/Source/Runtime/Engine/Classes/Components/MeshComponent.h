@@ -8,11 +8,8 @@ class UMeshComponent : public UPrimitiveComponent
 public:
     UMeshComponent() = default;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) override;
 
-    virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
-    
 #pragma region Material
     virtual uint32 GetNumMaterials() const { return 0; }
     virtual UMaterial* GetMaterial(uint32 ElementIndex) const;
@@ -1,20 +1,39 @@
 #include "PrimitiveComponent.h"
 
 #include "UObject/Casts.h"
+#include "World/World.h"
 
 
-UObject* UPrimitiveComponent::Duplicate(UObject* InOuter)
+void UPrimitiveComponent::DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::DuplicateFrom(Source, Duplicator);
 
-    NewComponent->AABB = AABB;
+    AABB = static_cast<const UPrimitiveComponent*>(Source)->AABB;
+}
+
+void UPrimitiveComponent::PostDuplicate()
+{
+    Super::PostDuplicate();
 
-    return NewComponent;
+    // Actor 생성자에서 만들어져 재사용된 컴포넌트는 World가 없을 때 초기화되었으므로, 여기서 등록합니다.
+    if (ScenePrimitiveIndex == INDEX_NONE)
+    {
+        if (FPrimitiveSceneIndex* SceneIndex = GetSceneIndex())
+        {
+            SceneIndex->AddPrimitive(this);
+        }
+    }
 }
 
 void UPrimitiveComponent::InitializeComponent()
 {
 	Super::InitializeComponent();
+
+    // Actor 생성자 안에서 추가된 컴포넌트는 아직 World가 없으므로, UWorld::SpawnActor에서 등록됩니다.
+    if (FPrimitiveSceneIndex* SceneIndex = GetSceneIndex())
+    {
+        SceneIndex->AddPrimitive(this);
+    }
 }
 
 void UPrimitiveComponent::TickComponent(float DeltaTime)
@@ -22,6 +41,44 @@ void UPrimitiveComponent::TickComponent(float DeltaTime)
 	Super::TickComponent(DeltaTime);
 }
 
+void UPrimitiveComponent::DestroyComponent()
+{
+    if (ScenePrimitiveIndex != INDEX_NONE)
+    {
+        if (FPrimitiveSceneIndex* SceneIndex = GetSceneIndex())
+        {
+            SceneIndex->RemovePrimitive(this);
+        }
+    }
+    Super::DestroyComponent();
+}
+
+void UPrimitiveComponent::MarkSceneBoundsDirty()
+{
+    if (ScenePrimitiveIndex != INDEX_NONE && !bSceneBoundsDirty)
+    {
+        if (FPrimitiveSceneIndex* SceneIndex = GetSceneIndex())
+        {
+            SceneIndex->MarkPrimitiveDirty(this);
+        }
+    }
+}
+
+void UPrimitiveComponent::OnTransformChanged()
+{
+    Super::OnTransformChanged();
+    MarkSceneBoundsDirty();
+}
+
+FPrimitiveSceneIndex* UPrimitiveComponent::GetSceneIndex() const
+{
+    if (UWorld* World = GetWorld())
+    {
+        return &World->GetPrimitiveSceneIndex();
+    }
+    return nullptr;
+}
+
 int UPrimitiveComponent::CheckRayIntersection(FVector& rayOrigin, FVector& rayDirection, float& pfNearHitDistance)
 {
     //if (!AABB.Intersect(rayOrigin, rayDirection, pfNearHitDistance)) return 0;
@@ -104,7 +161,6 @@ bool UPrimitiveComponent::IntersectRayTriangle(const FVector& rayOrigin, const F
 void UPrimitiveComponent::GetProperties(TMap<FString, FString>& OutProperties) const
 {
     Super::GetProperties(OutProperties);
-    OutProperties.Add(TEXT("m_Type"), m_Type);
     OutProperties.Add(TEXT("AABB_min"), AABB.min.ToString());
     OutProperties.Add(TEXT("AABB_max"), AABB.max.ToString());
 }
@@ -114,21 +170,13 @@ void UPrimitiveComponent::SetProperties(const TMap<FString, FString>& InProperti
 {
     Super::SetProperties(InProperties);
 
-    const FString* TempStr = nullptr;
-
-    // --- PrimitiveComponent 고유 속성 복원 ---
-
-    TempStr = InProperties.Find(TEXT("m_Type"));
-    if (TempStr)
-    {
-        this->m_Type = *TempStr; // m_Type이 FString이라고 가정
-        // 만약 m_Type이 enum이라면 문자열로부터 enum 값을 파싱하는 로직 필요
-    }
-
+    // FBoundingBox는 Property 타입이 아니므로 직접 복원합니다.
     const FString* AABBminStr = InProperties.Find(TEXT("AABB_min"));
     if (AABBminStr) AABB.min.InitFromString(*AABBminStr); 
 
     
     const FString* AABBmaxStr = InProperties.Find(TEXT("AABB_max"));
     if (AABBmaxStr) AABB.max.InitFromString(*AABBmaxStr); 
+
+    MarkSceneBoundsDirty();
 }
@@ -1,6 +1,9 @@
 #pragma once
 #include "Engine/Source/Runtime/Engine/Classes/Components/SceneComponent.h"
 
+class FPrimitiveSceneIndex;
+enum class EScenePrimitiveType : uint8;
+
 class UPrimitiveComponent : public USceneComponent
 {
     DECLARE_CLASS(UPrimitiveComponent, USceneComponent)
@@ -8,10 +11,12 @@ class UPrimitiveComponent : public USceneComponent
 public:
     UPrimitiveComponent() = default;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) override;
+    virtual void PostDuplicate() override;
 
     virtual void InitializeComponent() override;
     virtual void TickComponent(float DeltaTime) override;
+    virtual void DestroyComponent() override;
     virtual int CheckRayIntersection(FVector& rayOrigin, FVector& rayDirection, float& pfNearHitDistance) override;
     bool IntersectRayTriangle(
         const FVector& rayOrigin, const FVector& rayDirection,
@@ -26,7 +31,8 @@ public:
     FBoundingBox AABB;
 
 private:
-    FString m_Type;
+    UPROPERTY
+    (FString, m_Type);
 
 public:
     FString GetType() { return m_Type; }
@@ -37,5 +43,34 @@ public:
         //staticMesh = FEngineLoop::resourceMgr.GetMesh(m_Type);
     }
     FBoundingBox GetBoundingBox() const { return AABB; }
+
+    /** AABB가 바뀌었을 때 호출해서 World의 공간 인덱스를 갱신하도록 합니다. */
+    void MarkSceneBoundsDirty();
+
+    /** FPrimitiveSceneIndex에 등록될 때 정해진 종류 */
+    EScenePrimitiveType GetScenePrimitiveType() const { return ScenePrimitiveType; }
+
+protected:
+    virtual void OnTransformChanged() override;
+
+private:
+    friend class FPrimitiveSceneIndex;
+
+    /** 이 컴포넌트가 속한 World의 공간 인덱스 */
+    FPrimitiveSceneIndex* GetSceneIndex() const;
+
+    /** FPrimitiveSceneIndex의 트리 Proxy ID */
+    int32 SceneProxyId = INDEX_NONE;
+
+    /** FPrimitiveSceneIndex::Primitives에서의 위치 */
+    int32 ScenePrimitiveIndex = INDEX_NONE;
+
+    /** FPrimitiveSceneIndex::TypedPrimitives[ScenePrimitiveType]에서의 위치 */
+    int32 SceneTypedIndex = INDEX_NONE;
+
+    EScenePrimitiveType ScenePrimitiveType{};
+
+    /** 다음 쿼리 전에 Bounds를 갱신해야 하는지 여부 */
+    bool bSceneBoundsDirty = false;
 };
 
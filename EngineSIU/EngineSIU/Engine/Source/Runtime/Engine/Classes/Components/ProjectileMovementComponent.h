@@ -8,8 +8,6 @@ public:
     UProjectileMovementComponent();
     virtual ~UProjectileMovementComponent();
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
-
     void SetVelocity(FVector NewVelocity) { Velocity = NewVelocity; }
 
     FVector GetVelocity() const { return Velocity; }
@@ -35,18 +33,23 @@ public:
 
     virtual void TickComponent(float DeltaTime) override;
 
-    
-    void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    void SetProperties(const TMap<FString, FString>& InProperties) override;
-
 private:
-    float ProjectileLifetime; // 생명주기
-    float AccumulatedTime;
+    UPROPERTY
+    (float, ProjectileLifetime); // 생명주기
+
+    UPROPERTY
+    (float, AccumulatedTime);
+
+    UPROPERTY
+    (float, InitialSpeed);
+
+    UPROPERTY
+    (float, MaxSpeed);
 
-    float InitialSpeed;
-    float MaxSpeed;
+    UPROPERTY
+    (float, Gravity);
 
-    float Gravity;
-    FVector Velocity;
+    UPROPERTY
+    (FVector, Velocity);
 };
 
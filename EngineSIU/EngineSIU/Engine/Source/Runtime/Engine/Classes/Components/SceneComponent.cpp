@@ -1,6 +1,7 @@
 #include "Components/SceneComponent.h"
 #include "Math/Rotator.h"
 #include "Math/JungleMath.h"
+#include "World/World.h"
 #include "UObject/Casts.h"
 #include "UObject/ObjectFactory.h"
 
@@ -11,45 +12,24 @@ USceneComponent::USceneComponent()
 {
 }
 
-UObject* USceneComponent::Duplicate(UObject* InOuter)
+void USceneComponent::SetProperties(const TMap<FString, FString>& InProperties)
 {
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
-
-    NewComponent->RelativeLocation = RelativeLocation;
-    NewComponent->RelativeRotation = RelativeRotation;
-    NewComponent->RelativeScale3D = RelativeScale3D;
-
-    return NewComponent;
+    Super::SetProperties(InProperties);
+    OnTransformChanged();
 }
 
-void USceneComponent::GetProperties(TMap<FString, FString>& OutProperties) const
+void USceneComponent::PostEditChangeProperty(const FProperty* PropertyThatChanged)
 {
-    Super::GetProperties(OutProperties);
-    OutProperties.Add(TEXT("RelativeLocation"), *RelativeLocation.ToString());
-    OutProperties.Add(TEXT("RelativeRotation"), *RelativeRotation.ToString());
-    OutProperties.Add(TEXT("RelativeScale3D"), *RelativeScale3D.ToString());
-    
+    Super::PostEditChangeProperty(PropertyThatChanged);
+    OnTransformChanged();
 }
 
-void USceneComponent::SetProperties(const TMap<FString, FString>& InProperties)
+void USceneComponent::DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator)
 {
-    Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("RelativeLocation"));
-    if (TempStr)
-    {
-        RelativeLocation.InitFromString(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("RelativeRotation"));
-    if (TempStr)
-    {
-        RelativeRotation.InitFromString(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("RelativeScale3D"));
-    if (TempStr)
-    {
-        RelativeScale3D.InitFromString(*TempStr);
-    }
+    Super::DuplicateFrom(Source, Duplicator);
+
+    // 재사용된 기본 컴포넌트의 캐시는 생성자 시점의 부모 기준이므로, 처음 조회할 때 다시 계산하게 합니다.
+    bWorldTransformDirty = true;
 }
 
 void USceneComponent::InitializeComponent()
@@ -73,6 +53,14 @@ int USceneComponent::CheckRayIntersection(FVector& InRayOrigin, FVector& InRayDi
 
 void USceneComponent::DestroyComponent()
 {
+    if (bPendingTransformUpdate)
+    {
+        if (UWorld* World = GetWorld())
+        {
+            World->RemovePendingTransformUpdate(this);
+        }
+    }
+
     if (AttachParent)
     {
         AttachParent->AttachChildren.Remove(this);
@@ -106,18 +94,21 @@ FVector USceneComponent::GetUpVector()
 void USceneComponent::AddLocation(FVector InAddValue)
 {
 	RelativeLocation = RelativeLocation + InAddValue;
+	OnTransformChanged();
 
 }
 
 void USceneComponent::AddRotation(FVector InAddValue)
 {
 	RelativeRotation = RelativeRotation + InAddValue;
+	OnTransformChanged();
 
 }
 
 void USceneComponent::AddScale(FVector InAddValue)
 {
 	RelativeScale3D = RelativeScale3D + InAddValue;
+	OnTransformChanged();
 
 }
 
@@ -133,6 +124,7 @@ void USceneComponent::AttachToComponent(USceneComponent* InParent)
     if (InParent == nullptr)
     {
         AttachParent = nullptr;
+        OnTransformChanged();
         return;
     }
 
@@ -145,86 +137,83 @@ void USceneComponent::AttachToComponent(USceneComponent* InParent)
     {
         InParent->AttachChildren.Add(this);
     }
+
+    OnTransformChanged();
 }
 
 FVector USceneComponent::GetWorldLocation() const
 {
-    if (AttachParent)
-    {
-        return AttachParent->GetWorldLocation() + RelativeLocation;
-    }
-    return RelativeLocation;
+    ConditionalUpdateWorldTransform();
+    return WorldTransform.WorldLocation;
 }
 
 FRotator USceneComponent::GetWorldRotation() const
 {
-    if (AttachParent)
-    {
-        return AttachParent->GetWorldRotation().ToQuaternion() * RelativeRotation.ToQuaternion();
-    }
-    return RelativeRotation;
+    ConditionalUpdateWorldTransform();
+    return WorldTransform.WorldRotation;
 }
 
 FVector USceneComponent::GetWorldScale3D() const
 {
-    if (AttachParent)
-    {
-        return AttachParent->GetWorldScale3D() * RelativeScale3D;
-    }
-    return RelativeScale3D;
+    ConditionalUpdateWorldTransform();
+    return WorldTransform.WorldScale3D;
 }
 
 FMatrix USceneComponent::GetScaleMatrix() const
 {
-    FMatrix ScaleMat = FMatrix::GetScaleMatrix(RelativeScale3D);
-    if (AttachParent)
-    {
-        FMatrix ParentScaleMat = AttachParent->GetScaleMatrix();
-        ScaleMat = ScaleMat * ParentScaleMat;
-    }
-    return ScaleMat;
+    ConditionalUpdateWorldTransform();
+    return FMatrix::GetScaleMatrix(WorldTransform.WorldScale3D);
 }
 
 FMatrix USceneComponent::GetRotationMatrix() const
 {
-    FMatrix RotationMat = FMatrix::GetRotationMatrix(RelativeRotation);
-    if (AttachParent)
-    {
-        FMatrix ParentRotationMat = AttachParent->GetRotationMatrix();
-        RotationMat = RotationMat * ParentRotationMat;
-    }
-    return RotationMat;
+    ConditionalUpdateWorldTransform();
+    return WorldTransform.WorldRotationMatrix;
 }
 
 FMatrix USceneComponent::GetTranslationMatrix() const
 {
-    FMatrix TranslationMat = FMatrix::GetTranslationMatrix(RelativeLocation);
+    ConditionalUpdateWorldTransform();
+    return FMatrix::GetTranslationMatrix(WorldTransform.WorldLocation);
+}
+
+const FMatrix& USceneComponent::GetWorldMatrix() const
+{
+    ConditionalUpdateWorldTransform();
+    return WorldTransform.WorldMatrix;
+}
+
+void USceneComponent::UpdateWorldTransform() const
+{
+    WorldTransform.Update(AttachParent ? &AttachParent->WorldTransform : nullptr, RelativeLocation, RelativeRotation, RelativeScale3D);
+    bWorldTransformDirty = false;
+}
+
+void USceneComponent::ConditionalUpdateWorldTransform() const
+{
+    if (!bWorldTransformDirty)
+    {
+        return;
+    }
+
     if (AttachParent)
     {
-        FMatrix ParentTranslationMat = AttachParent->GetTranslationMatrix();
-        TranslationMat = TranslationMat * ParentTranslationMat;
+        AttachParent->ConditionalUpdateWorldTransform();
     }
-    return TranslationMat;
+    UpdateWorldTransform();
 }
 
-FMatrix USceneComponent::GetWorldMatrix() const
+void USceneComponent::UpdateWorldTransformSubtree()
 {
-    FMatrix ScaleMat = FMatrix::GetScaleMatrix(RelativeScale3D);
-    FMatrix RotationMat = FMatrix::GetRotationMatrix(RelativeRotation);
-    FMatrix TranslationMat = FMatrix::GetTranslationMatrix(RelativeLocation);
+    UpdateWorldTransform();
 
-    FMatrix RTMat = RotationMat * TranslationMat;
-    if (AttachParent)
+    for (USceneComponent* Child : AttachChildren)
     {
-        FMatrix ParentScaleMat = AttachParent->GetScaleMatrix();
-        FMatrix ParentRotationMat = AttachParent->GetRotationMatrix();
-        FMatrix ParentTranslationMat = AttachParent->GetTranslationMatrix();
-        
-        ScaleMat = ScaleMat * ParentScaleMat;
-        FMatrix ParentRTMat = ParentRotationMat * ParentTranslationMat;
-        RTMat = RTMat * ParentRTMat;
+        if (Child->bWorldTransformDirty)
+        {
+            Child->UpdateWorldTransformSubtree();
+        }
     }
-    return ScaleMat * RTMat;
 }
 
 void USceneComponent::SetupAttachment(USceneComponent* InParent)
@@ -242,5 +231,25 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent)
 
         // TODO: .AddUnique의 실행 위치를 RegisterComponent로 바꾸거나 해야할 듯
         InParent->AttachChildren.AddUnique(this);
+
+        OnTransformChanged();
+    }
+}
+
+void USceneComponent::OnTransformChanged()
+{
+    // 부모가 이미 Dirty라면 부모를 갱신할 때 함께 갱신되므로, Dirty 영역의 최상위 컴포넌트만 World에 등록합니다.
+    if (!bPendingTransformUpdate && (AttachParent == nullptr || !AttachParent->bWorldTransformDirty))
+    {
+        if (UWorld* World = GetWorld())
+        {
+            World->AddPendingTransformUpdate(this);
+        }
+    }
+    bWorldTransformDirty = true;
+
+    for (USceneComponent* Child : AttachChildren)
+    {
+        Child->OnTransformChanged();
     }
 }
@@ -1,20 +1,23 @@
 #pragma once
 #include "ActorComponent.h"
+#include "WorldTransformCache.h"
 #include "Math/Rotator.h"
 #include "UObject/ObjectMacros.h"
 
+class UWorld;
+
 class USceneComponent : public UActorComponent
 {
     DECLARE_CLASS(USceneComponent, UActorComponent)
 
+    friend class UWorld;
+
 public:
     USceneComponent();
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
-
-    
-    void GetProperties(TMap<FString, FString>& OutProperties) const override;
     void SetProperties(const TMap<FString, FString>& InProperties) override;
+    virtual void PostEditChangeProperty(const FProperty* PropertyThatChanged) override;
+    virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) override;
 
     virtual void InitializeComponent() override;
     virtual void TickComponent(float DeltaTime) override;
@@ -35,14 +38,15 @@ public:
     void AttachToComponent(USceneComponent* InParent);
 
 public:
-    void SetRelativeLocation(FVector InNewLocation) { RelativeLocation = InNewLocation; }
-    void SetRelativeRotation(FRotator InNewRotation) { RelativeRotation = InNewRotation; }
-    void SetRelativeScale3D(FVector NewScale) { RelativeScale3D = NewScale; }
+    void SetRelativeLocation(FVector InNewLocation) { RelativeLocation = InNewLocation; OnTransformChanged(); }
+    void SetRelativeRotation(FRotator InNewRotation) { RelativeRotation = InNewRotation; OnTransformChanged(); }
+    void SetRelativeScale3D(FVector NewScale) { RelativeScale3D = NewScale; OnTransformChanged(); }
     
     FVector GetRelativeLocation() const { return RelativeLocation; }
     FRotator GetRelativeRotation() const { return RelativeRotation; }
     FVector GetRelativeScale3D() const { return RelativeScale3D; }
 
+    /** 월드 Transform 조회 함수들은 캐시된 값을 반환하며, Dirty 상태라면 부모부터 다시 계산합니다. */
     FVector GetWorldLocation() const;
     FRotator GetWorldRotation() const;
     FVector GetWorldScale3D() const;
@@ -51,11 +55,15 @@ public:
     FMatrix GetRotationMatrix() const;
     FMatrix GetTranslationMatrix() const;
 
-    FMatrix GetWorldMatrix() const;
+    const FMatrix& GetWorldMatrix() const;
     
     void SetupAttachment(USceneComponent* InParent);
 
 protected:
+    /** 이 컴포넌트의 월드 Transform이 바뀌었을 때 호출됩니다. 자식 컴포넌트에도 전파됩니다. */
+    virtual void OnTransformChanged();
+
+
     /** 부모 컴포넌트로부터 상대적인 위치 */
     UPROPERTY
     (FVector, RelativeLocation);
@@ -74,4 +82,22 @@ protected:
 
     UPROPERTY
     (TArray<USceneComponent*>, AttachChildren);
+
+private:
+    /** 부모의 캐시가 최신이라고 가정하고 이 컴포넌트의 월드 Transform 캐시를 계산합니다. */
+    void UpdateWorldTransform() const;
+
+    /** Dirty 상태라면 Dirty인 조상부터 차례로 캐시를 갱신합니다. */
+    void ConditionalUpdateWorldTransform() const;
+
+    /** 이 컴포넌트와 Dirty인 자손들을 부모에서 자식 순서로 갱신합니다. 부모는 최신 상태여야 합니다. */
+    void UpdateWorldTransformSubtree();
+
+private:
+    /** 월드 Transform 캐시. Relative 값이나 부모가 바뀌면 OnTransformChanged에서 Dirty로 표시됩니다. */
+    mutable FWorldTransformCache WorldTransform;
+    mutable bool bWorldTransformDirty = true;
+
+    /** UWorld::UpdateComponentTransforms에서 갱신할 목록에 들어 있는지 여부 */
+    bool bPendingTransformUpdate = false;
 };
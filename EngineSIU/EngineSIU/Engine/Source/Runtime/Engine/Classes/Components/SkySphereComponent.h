@@ -9,9 +9,11 @@ class USkySphereComponent : public UStaticMeshComponent
 public:
     USkySphereComponent();
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
-
     virtual void TickComponent(float DeltaTime) override;
-    float UOffset = 0;
-    float VOffset = 0;
+
+    UPROPERTY
+    (float, UOffset, = 0);
+
+    UPROPERTY
+    (float, VOffset, = 0);
 };
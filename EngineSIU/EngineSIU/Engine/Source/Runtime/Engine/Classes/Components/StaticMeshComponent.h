@@ -9,7 +9,7 @@ class UStaticMeshComponent : public UMeshComponent
 public:
     UStaticMeshComponent() = default;
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) override;
 
     
     void GetProperties(TMap<FString, FString>& OutProperties) const override;
@@ -33,9 +33,12 @@ public:
         staticMesh = value;
         OverrideMaterials.SetNum(value->GetMaterials().Num());
         AABB = FBoundingBox(staticMesh->GetRenderData()->BoundingBoxMin, staticMesh->GetRenderData()->BoundingBoxMax);
+        MarkSceneBoundsDirty();
     }
 
 protected:
     UStaticMesh* staticMesh = nullptr;
-    int selectedSubMeshIndex = -1;
+
+    UPROPERTY
+    (int, selectedSubMeshIndex, = -1);
 };
@@ -11,69 +11,6 @@ UTextComponent::UTextComponent()
     SetType(StaticClass()->GetName());
 }
 
-UObject* UTextComponent::Duplicate(UObject* InOuter)
-{
-    ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
-
-    NewComponent->Text = Text;
-    NewComponent->QuadSize = QuadSize;
-    NewComponent->RowCount = RowCount;
-    NewComponent->ColumnCount = ColumnCount;
-    NewComponent->QuadWidth = QuadWidth;
-    NewComponent->QuadHeight = QuadHeight;
-
-    return NewComponent;
-}
-
-void UTextComponent::GetProperties(TMap<FString, FString>& OutProperties) const
-{
-    Super::GetProperties(OutProperties);
-    
-    OutProperties.Add(TEXT("Text"), FString(Text.c_str()));
-    OutProperties.Add(TEXT("RowCount"), FString::Printf(TEXT("%d"), RowCount));
-    OutProperties.Add(TEXT("ColumnCount"), FString::Printf(TEXT("%d"), ColumnCount));
-    OutProperties.Add(TEXT("QuadWidth"), FString::Printf(TEXT("%f"), QuadWidth));
-    OutProperties.Add(TEXT("QuadHeight"), FString::Printf(TEXT("%f"), QuadHeight));
-    OutProperties.Add(TEXT("QuadSize"), FString::Printf(TEXT("%i"), QuadSize));
-}
-
-void UTextComponent::SetProperties(const TMap<FString, FString>& InProperties)
-{
-    Super::SetProperties(InProperties);
-    const FString* TempStr = nullptr;
-    TempStr = InProperties.Find(TEXT("Text"));
-    if (TempStr)
-    {
-        Text = TempStr->ToWideString();
-    }
-    TempStr = InProperties.Find(TEXT("RowCount"));
-    if (TempStr)
-    {
-        RowCount = FString::ToInt(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("ColumnCount"));
-    if (TempStr)
-    {
-        ColumnCount = FString::ToInt(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("QuadWidth"));
-    if (TempStr)
-    {
-        QuadWidth = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("QuadHeight"));
-    if (TempStr)
-    {
-        QuadHeight = FString::ToFloat(*TempStr);
-    }
-    TempStr = InProperties.Find(TEXT("QuadSize"));
-    if (TempStr)
-    {
-        QuadSize = FString::ToFloat(*TempStr);
-    }
-    
-}
-
 void UTextComponent::InitializeComponent()
 {
     Super::InitializeComponent();
@@ -106,19 +43,20 @@ int UTextComponent::CheckRayIntersection(FVector& rayOrigin, FVector& rayDirecti
     if (!(ShowFlags::GetInstance().currentFlags & static_cast<uint64>(EEngineShowFlags::SF_BillboardText))) {
         return 0;
     }
-    //TODO: quadWidth 고정으로 font사이즈 변경시 문제 발생할 수 있음
-    const float quadWidth = 2.0f;
-    float totalTextWidth = quadWidth * Text.size();
+    // TextLayout::LayoutText가 글자를 놓는 위치와 같아야 합니다.
+    const float halfWidth = QuadWidth * 0.5f;
+    const float halfHeight = QuadHeight * 0.5f;
+    float totalTextWidth = QuadWidth * Text.size();
     float centerOffset = totalTextWidth / 2.0f;
 
     for (int i = 0; i < Text.size(); i++)
     {
-        float offsetX = quadWidth * i - centerOffset;
+        float offsetX = QuadWidth * i - centerOffset;
         TArray<FVector> LetterQuad;
-        LetterQuad.Add(FVector(-1.0f + offsetX, 1.0f, 0.0f));
-        LetterQuad.Add(FVector(1.0f + offsetX, 1.0f, 0.0f));
-        LetterQuad.Add(FVector(1.0f + offsetX, -1.0f, 0.0f));
-        LetterQuad.Add(FVector(-1.0f + offsetX, -1.0f, 0.0f));
+        LetterQuad.Add(FVector(-halfWidth + offsetX, halfHeight, 0.0f));
+        LetterQuad.Add(FVector(halfWidth + offsetX, halfHeight, 0.0f));
+        LetterQuad.Add(FVector(halfWidth + offsetX, -halfHeight, 0.0f));
+        LetterQuad.Add(FVector(-halfWidth + offsetX, -halfHeight, 0.0f));
 
         float hitDistance = 0.0f;
         if (CheckPickingOnNDC(LetterQuad, hitDistance))
@@ -12,12 +12,6 @@ class UTextComponent : public UBillboardComponent
 public:
     UTextComponent();
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
-    
-    void GetProperties(TMap<FString, FString>& OutProperties) const override;
-    
-    void SetProperties(const TMap<FString, FString>& InProperties) override;
-
     virtual void InitializeComponent() override;
     
     virtual void TickComponent(float DeltaTime) override;
@@ -26,7 +20,7 @@ public:
     
     void SetText(const FWString& text);
 
-    FWString GetText() { return Text; }
+    const FWString& GetText() const { return Text; }
     
     void SetRowColumnCount(int cellsPerRow, int cellsPerColumn);
 
@@ -36,20 +30,31 @@ public:
     float GetRowCount() { return RowCount; }
     float GetColumnCount() { return ColumnCount; }
 
+    float GetQuadWidth() const { return QuadWidth; }
+    float GetQuadHeight() const { return QuadHeight; }
+
 protected:
 
     // TODO: 씬저장에 FString로 저장되는 문제 있음
-    FWString Text;
+    UPROPERTY
+    (FWString, Text);
 
     //TArray<FVertexTexture> vertexTextureArr;
 
-    int QuadSize = 2;
+    UPROPERTY
+    (int, QuadSize, = 2);
+
+    UPROPERTY
+    (int, RowCount, = 0);
+
+    UPROPERTY
+    (int, ColumnCount, = 0);
 
-    int RowCount;
-    int ColumnCount;
+    UPROPERTY
+    (float, QuadWidth, = 2.0f);
 
-    float QuadWidth = 2.0f;
-    float QuadHeight = 2.0f;
+    UPROPERTY
+    (float, QuadHeight, = 2.0f);
 
 private:
     //FString TextAtlasBufferKey;
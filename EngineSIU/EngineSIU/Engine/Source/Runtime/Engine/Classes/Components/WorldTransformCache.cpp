@@ -0,0 +1,38 @@
+#include "WorldTransformCache.h"
+#include "Math/MathSSE.h"
+#include "Math/Quat.h"
+
+void FWorldTransformCache::Update(const FWorldTransformCache* Parent, const FVector& RelativeLocation, const FRotator& RelativeRotation, const FVector& RelativeScale3D)
+{
+    const FMatrix RotationMat = FMatrix::GetRotationMatrix(RelativeRotation);
+    const FMatrix TranslationMat = FMatrix::GetTranslationMatrix(RelativeLocation);
+
+    FMatrix RTMat;
+    SSE::VectorMatrixMultiply(&RTMat, &RotationMat, &TranslationMat);
+
+    if (Parent)
+    {
+        WorldScale3D = Parent->WorldScale3D * RelativeScale3D;
+        WorldLocation = Parent->WorldLocation + RelativeLocation;
+        WorldRotation = Parent->WorldRotation.ToQuaternion() * RelativeRotation.ToQuaternion();
+        SSE::VectorMatrixMultiply(&WorldRotationMatrix, &RotationMat, &Parent->WorldRotationMatrix);
+
+        // Scale, Rotation, Translation을 부모 방향으로 각각 누적한 값으로 합성합니다.
+        const FMatrix ParentTranslationMat = FMatrix::GetTranslationMatrix(Parent->WorldLocation);
+        FMatrix ParentRTMat;
+        SSE::VectorMatrixMultiply(&ParentRTMat, &Parent->WorldRotationMatrix, &ParentTranslationMat);
+
+        const FMatrix LocalRTMat = RTMat;
+        SSE::VectorMatrixMultiply(&RTMat, &LocalRTMat, &ParentRTMat);
+    }
+    else
+    {
+        WorldScale3D = RelativeScale3D;
+        WorldLocation = RelativeLocation;
+        WorldRotation = RelativeRotation;
+        WorldRotationMatrix = RotationMat;
+    }
+
+    const FMatrix ScaleMat = FMatrix::GetScaleMatrix(WorldScale3D);
+    SSE::VectorMatrixMultiply(&WorldMatrix, &ScaleMat, &RTMat);
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "Math/Matrix.h"
+#include "Math/Rotator.h"
+#include "Math/Vector.h"
+
+/**
+ * USceneComponent가 캐시하는 월드 Transform.
+ * 부모의 캐시와 자신의 Relative Transform만으로 계산하므로 UObject 없이 사용할 수 있습니다.
+ */
+struct FWorldTransformCache
+{
+    FMatrix WorldMatrix;
+    /** 자식의 월드 행렬 계산에 사용하는 부모 방향 회전 행렬의 누적 곱 */
+    FMatrix WorldRotationMatrix;
+    FVector WorldLocation;
+    FRotator WorldRotation;
+    FVector WorldScale3D;
+
+    /**
+     * Relative Transform을 부모의 캐시에 합성합니다.
+     * @param Parent 최신 상태의 부모 캐시. 부모가 없으면 nullptr
+     */
+    void Update(const FWorldTransformCache* Parent, const FVector& RelativeLocation, const FRotator& RelativeRotation, const FVector& RelativeScale3D);
+};
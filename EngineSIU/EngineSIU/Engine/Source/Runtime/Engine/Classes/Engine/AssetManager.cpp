@@ -1,9 +1,68 @@
 #include "AssetManager.h"
 #include "Engine.h"
 
+#include <chrono>
 #include <filesystem>
+#include "Async/JobSystem.h"
 #include "Engine/FLoaderOBJ.h"
 
+namespace
+{
+    /** Worker Thread에서 만든 Asset 하나의 로드 결과 */
+    struct FObjLoadResult
+    {
+        OBJ::FStaticMeshRenderData* RenderData = nullptr;
+        TArray<FTextureImage> Textures;
+
+        /** Worker Thread에서는 Console에 쓸 수 없으므로 모아 두었다가 메인 스레드에서 출력합니다. */
+        TArray<FString> Errors;
+        double CPUTimeMs = 0.0;
+    };
+
+    /** 메인 스레드 상태를 건드리지 않는 로드 과정: 파싱(또는 Cook된 파일), 용접, Tangent / Bounds 계산, Texture 디코딩 */
+    void LoadObjOffThread(const FString& ObjFile, FObjLoadResult& OutResult)
+    {
+        const auto StartTime = std::chrono::steady_clock::now();
+
+        OutResult.RenderData = FManagerOBJ::BuildStaticMeshRenderData(ObjFile, OutResult.Errors);
+        if (OutResult.RenderData)
+        {
+            TArray<FWString> TexturePaths;
+            FManagerOBJ::GetTexturePaths(*OutResult.RenderData, TexturePaths);
+            for (const FWString& TexturePath : TexturePaths)
+            {
+                FTextureImage Image;
+                if (SUCCEEDED(FResourceMgr::DecodeTextureFromFile(TexturePath.c_str(), Image)))
+                {
+                    OutResult.Textures.Add(std::move(Image));
+                }
+            }
+        }
+
+        OutResult.CPUTimeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - StartTime).count();
+    }
+
+    void CollectObjFiles(const std::string& BasePathName, TArray<FString>& OutObjFiles)
+    {
+        for (const auto& Entry : std::filesystem::recursive_directory_iterator(BasePathName))
+        {
+            if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+            {
+                OutObjFiles.Add(Entry.path().parent_path().string() + "/" + Entry.path().filename().string());
+            }
+        }
+    }
+}
+
+void FAssetWarmupReport::Log() const
+{
+    for (const FAssetLoadRecord& Asset : Assets)
+    {
+        UE_LOG(LogLevel::Display, "[Asset Warmup] %s: %.2f ms%s", *Asset.AssetPath, Asset.CPUTimeMs, Asset.bSucceeded ? "" : " (Failed)");
+    }
+    UE_LOG(LogLevel::Display, "[Asset Warmup] %d assets, %d workers, Wall %.2f ms, CPU %.2f ms", Assets.Num(), NumWorkers, WallTimeMs, TotalCPUTimeMs);
+}
+
 bool UAssetManager::IsInitialized()
 {
     return GEngine && GEngine->AssetManager;
@@ -45,7 +104,7 @@ void UAssetManager::LoadObjFiles()
     const std::string BasePathName = "Contents/";
 
     // Obj 파일 로드
-	
+    TArray<FString> ObjFiles;
     for (const auto& Entry : std::filesystem::recursive_directory_iterator(BasePathName))
     {
         if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
@@ -58,10 +117,91 @@ void UAssetManager::LoadObjFiles()
             
             AssetRegistry->PathNameToAssetInfo.Add(NewAssetInfo.AssetName, NewAssetInfo);
             
-            FString MeshName = NewAssetInfo.PackagePath.ToString() + "/" + NewAssetInfo.AssetName.ToString();
-            FManagerOBJ::CreateStaticMesh(MeshName);
-            // ObjFileNames.push_back(UGTLStringLibrary::StringToWString(Entry.path().string()));
-            // FObjManager::LoadObjStaticMeshAsset(UGTLStringLibrary::StringToWString(Entry.path().string()));
+            ObjFiles.Add(NewAssetInfo.PackagePath.ToString() + "/" + NewAssetInfo.AssetName.ToString());
         }
     }
+
+    // 파싱과 디코딩은 Worker Thread에서 하고, Texture와 UStaticMesh 등록은 메인 스레드에서 합니다.
+    WarmupReport = WarmupObjFiles(ObjFiles, [](const FString& ObjFile, FObjLoadResult& Result)
+    {
+        // 파싱이나 Material 로드에 실패한 Asset은 이유를 이미 출력했으므로 등록하지 않습니다.
+        if (Result.RenderData == nullptr)
+        {
+            UE_LOG(LogLevel::Error, "[Asset Warmup] Failed to load %s", *ObjFile);
+            return false;
+        }
+
+        for (const FTextureImage& Image : Result.Textures)
+        {
+            if (FEngineLoop::ResourceManager.GetTexture(Image.FilePath) == nullptr)
+            {
+                FEngineLoop::ResourceManager.CreateTextureFromImage(FEngineLoop::GraphicDevice.Device, Image);
+            }
+        }
+        return FManagerOBJ::PublishStaticMesh(ObjFile, Result.RenderData) != nullptr;
+    });
+    WarmupReport.Log();
+}
+
+FAssetWarmupReport UAssetManager::RunHeadlessWarmup(const std::string& BasePathName)
+{
+    TArray<FString> ObjFiles;
+    CollectObjFiles(BasePathName, ObjFiles);
+
+    return WarmupObjFiles(ObjFiles, [](const FString& ObjFile, FObjLoadResult& Result)
+    {
+        const bool bSucceeded = Result.RenderData != nullptr;
+        delete Result.RenderData;
+        return bSucceeded;
+    });
+}
+
+template <typename FOnLoaded>
+FAssetWarmupReport UAssetManager::WarmupObjFiles(const TArray<FString>& ObjFiles, FOnLoaded&& OnLoaded)
+{
+    FJobSystem& JobSystem = FJobSystem::Get();
+    const auto StartTime = std::chrono::steady_clock::now();
+
+    FAssetWarmupReport Report;
+    Report.NumWorkers = JobSystem.GetNumWorkers();
+    Report.Assets.SetNum(ObjFiles.Num());
+
+    int32 NumPending = ObjFiles.Num();
+    for (int32 i = 0; i < ObjFiles.Num(); i++)
+    {
+        JobSystem.Dispatch([&, i]()
+        {
+            auto Result = std::make_shared<FObjLoadResult>();
+            LoadObjOffThread(ObjFiles[i], *Result);
+
+            // 완료된 Asset은 메인 스레드 큐를 통해서만 등록합니다.
+            JobSystem.EnqueueMainThread([&, i, Result]()
+            {
+                FAssetLoadRecord& Record = Report.Assets[i];
+                Record.AssetPath = ObjFiles[i];
+                Record.CPUTimeMs = Result->CPUTimeMs;
+                for (const FString& Error : Result->Errors)
+                {
+                    UE_LOG(Result->RenderData ? LogLevel::Warning : LogLevel::Error, "%s", *Error);
+                }
+                Record.bSucceeded = OnLoaded(ObjFiles[i], *Result);
+                --NumPending;
+            });
+        });
+    }
+
+    while (NumPending > 0)
+    {
+        if (JobSystem.ProcessMainThreadTasks() == 0)
+        {
+            JobSystem.WaitForMainThreadTasks();
+        }
+    }
+
+    Report.WallTimeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - StartTime).count();
+    for (const FAssetLoadRecord& Asset : Report.Assets)
+    {
+        Report.TotalCPUTimeMs += Asset.CPUTimeMs;
+    }
+    return Report;
 }
@@ -18,6 +18,26 @@ struct FAssetInfo
     uint32 Size;          // Asset의 크기 (바이트 단위)
 };
 
+/** Asset 하나를 로드한 결과 */
+struct FAssetLoadRecord
+{
+    FString AssetPath;
+    double CPUTimeMs = 0.0; // Worker Thread에서 파싱, 디코딩에 걸린 시간
+    bool bSucceeded = false;
+};
+
+/** 시작할 때 Asset들을 미리 로드한 결과 */
+struct FAssetWarmupReport
+{
+    TArray<FAssetLoadRecord> Assets;
+    int32 NumWorkers = 0;
+    double WallTimeMs = 0.0;
+    double TotalCPUTimeMs = 0.0;
+
+    /** Asset별 시간과 전체 시간을 Console에 출력합니다. */
+    void Log() const;
+};
+
 struct FAssetRegistry
 {
     TMap<FName, FAssetInfo> PathNameToAssetInfo;
@@ -45,6 +65,21 @@ public:
 
     const TMap<FName, FAssetInfo>& GetAssetRegistry();
 
+    const FAssetWarmupReport& GetWarmupReport() const { return WarmupReport; }
+
+    /**
+     * BasePathName 아래의 모든 OBJ 파일과 Texture를 Worker Thread에서 읽기만 하고 결과를 버립니다.
+     * GPU 리소스와 UObject를 만들지 않으므로 Engine 없이 로딩 성능을 측정할 수 있습니다.
+     */
+    static FAssetWarmupReport RunHeadlessWarmup(const std::string& BasePathName);
+
 private:
     void LoadObjFiles();
+
+    /** OBJ 파일 목록을 Worker Thread에서 로드합니다. OnLoaded는 메인 스레드에서 Asset마다 호출됩니다. */
+    template <typename FOnLoaded>
+    static FAssetWarmupReport WarmupObjFiles(const TArray<FString>& ObjFiles, FOnLoaded&& OnLoaded);
+
+private:
+    FAssetWarmupReport WarmupReport;
 };
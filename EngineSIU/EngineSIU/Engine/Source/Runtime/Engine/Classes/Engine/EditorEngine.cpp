@@ -3,6 +3,7 @@
 #include "World/World.h"
 #include "Level.h"
 #include "GameFramework/Actor.h"
+#include "World/TickTaskManager.h"
 #include "Classes/Engine/AssetManager.h"
 
 namespace PrivateEditorSelection
@@ -49,18 +50,7 @@ void UEditorEngine::Tick(float DeltaTime)
                 // TODO: World에서 EditorPlayer 제거 후 Tick 호출 제거 필요.
                 World->Tick(DeltaTime);
                 EditorPlayer->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor && Actor->IsActorTickInEditor())
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
+                FTickTaskManager::Get().RunTickGroups(World, DeltaTime, true);
             }
         }
         else if (WorldContext->WorldType == EWorldType::PIE)
@@ -68,18 +58,7 @@ void UEditorEngine::Tick(float DeltaTime)
             if (UWorld* World = WorldContext->World())
             {
                 World->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor)
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
+                FTickTaskManager::Get().RunTickGroups(World, DeltaTime, false);
             }
         }
     }
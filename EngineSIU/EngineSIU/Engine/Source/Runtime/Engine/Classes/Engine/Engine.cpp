@@ -36,10 +36,10 @@ FWorldContext& UEngine::CreateNewWorldContext(EWorldType InWorldType)
 
 void UEngine::LoadWorld(const FString& FileName) const
 {
-    SceneManager::LoadSceneFromJsonFile(*FileName, *ActiveWorld);
+    SceneManager::LoadSceneFromFile(*FileName, *ActiveWorld);
 }
 
 void UEngine::SaveWorld(const FString& FileName) const
 {
-    SceneManager::SaveSceneToJsonFile(*FileName, *ActiveWorld);
+    SceneManager::SaveSceneToFile(*FileName, *ActiveWorld);
 }
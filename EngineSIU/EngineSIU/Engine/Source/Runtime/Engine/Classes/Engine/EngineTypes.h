@@ -13,3 +13,16 @@ enum Type : uint8
     Quit,
 };
 }
+
+/** Tick을 실행하는 단계. 한 그룹의 Tick이 모두 끝난 뒤 다음 그룹을 실행합니다. */
+enum ETickingGroup : uint8
+{
+    /** 물리 시뮬레이션 전. 이동 컴포넌트처럼 Transform을 바꾸는 Tick */
+    TG_PrePhysics,
+    /** 물리 시뮬레이션 중 */
+    TG_DuringPhysics,
+    /** 모든 이동이 끝난 뒤. 다른 Actor의 최종 위치를 읽는 Tick (Gizmo, Camera 등) */
+    TG_PostUpdateWork,
+
+    TG_MAX,
+};
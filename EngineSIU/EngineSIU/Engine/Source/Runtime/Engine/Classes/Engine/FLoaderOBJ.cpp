@@ -3,211 +3,340 @@
 #include "UObject/ObjectFactory.h"
 #include "Components/Material/Material.h"
 #include "Components/Mesh/StaticMesh.h"
+#include "ObjParser.h"
 
+#include <bit>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 
-bool FLoaderOBJ::ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
+#include "HAL/PlatformFile.h"
+#include "Math/MathUtility.h"
+
+namespace
 {
-    std::ifstream OBJ(ObjFilePath.ToWideString());
-    if (!OBJ)
-    {
-        return false;
-    }
+    /**
+     * Cook된 Static Mesh 파일(.bin)의 구조
+     *
+     * [FCookedMeshHeader][Vertices][Indices][BVHNodes][BVHPackets][Subsets][Materials][Dependencies][Strings]
+     *
+     * 모든 Section은 16바이트 정렬되어 있어서 매핑한 파일에서 그대로 복사할 수 있습니다.
+     * 원본(.obj, .mtl) 파일의 크기, 수정 시각, 내용 Hash를 함께 저장해서 원본이 바뀌면 다시 Cook합니다.
+     */
+    constexpr uint32 CookedMeshMagic = 0x4B434D53; // "SMCK"
 
-    OutObjInfo.FilePath = ObjFilePath.ToWideString().substr(0, ObjFilePath.ToWideString().find_last_of(L"\\/") + 1);
-    OutObjInfo.ObjectName = ObjFilePath.ToWideString();
-    // ObjectName은 wstring 타입이므로, 이를 string으로 변환 (간단한 ASCII 변환의 경우)
-    std::wstring wideName = OutObjInfo.ObjectName.substr(ObjFilePath.ToWideString().find_last_of(L"\\/") + 1);;
-    std::string fileName(wideName.begin(), wideName.end());
+    /** 포맷이 바뀌면 올립니다. 버전이 다른 파일은 다시 Cook합니다. */
+    constexpr uint32 CookedMeshVersion = 2;
 
-    // 마지막 '.'을 찾아 확장자를 제거
-    size_t dotPos = fileName.find_last_of('.');
-    if (dotPos != std::string::npos)
-    {
-        OutObjInfo.DisplayName = fileName.substr(0, dotPos);
-    }
-    else
+    constexpr uint64 CookedSectionAlignment = 16;
+
+    /** Cook된 파일은 원본 옆이 아니라 이 폴더 아래에 원본과 같은 경로로 저장합니다. */
+    constexpr const wchar_t* CookedMeshDirectory = L"Saved/Cooked";
+
+    /** "Contents/Dodge/Dodge.obj" -> "Saved/Cooked/Contents/Dodge/Dodge.obj.bin" */
+    FWString GetCookedMeshPath(const FString& PathFileName)
     {
-        OutObjInfo.DisplayName = fileName;
+        std::filesystem::path CookedPath = std::filesystem::path(CookedMeshDirectory) / std::filesystem::path(PathFileName.ToWideString()).relative_path();
+        CookedPath += L".bin";
+        return CookedPath.lexically_normal().wstring();
     }
 
-    /**
-     * 블렌더 Export 설정
-     *   - General
-     *       Forward Axis:  Y
-     *       Up Axis:       Z
-     *   - Geometry
-     *       ✅ Triangulated Mesh
-     */
-
-    std::string Line;
+    /** Strings Section 안의 문자열, Length는 문자 수 */
+    struct FCookedString
+    {
+        uint32 Offset;
+        uint32 Length;
+    };
 
-    while (std::getline(OBJ, Line))
+    struct FCookedMeshHeader
     {
-        if (Line.empty() || Line[0] == '#')
-            continue;
+        uint32 Magic;
+        uint32 Version;
+        uint32 VertexStride;
+        uint16 CharSize;
+        uint16 WideCharSize;
+        uint64 FileSize;
+
+        uint32 NumVertices;
+        uint32 NumIndices;
+        uint32 NumSubsets;
+        uint32 NumMaterials;
+        uint32 NumDependencies;
+        uint32 StringsSize;
+        uint32 NumBVHNodes;
+        uint32 NumBVHPackets;
+        uint32 NumBVHTriangles;
+
+        uint64 VerticesOffset;
+        uint64 IndicesOffset;
+        uint64 BVHNodesOffset;
+        uint64 BVHPacketsOffset;
+        uint64 SubsetsOffset;
+        uint64 MaterialsOffset;
+        uint64 DependenciesOffset;
+        uint64 StringsOffset;
+
+        FCookedString ObjectName;
+        FCookedString DisplayName;
+
+        FVector BoundingBoxMin;
+        FVector BoundingBoxMax;
+    };
+
+    struct FCookedSubset
+    {
+        FCookedString MaterialName;
+        uint32 IndexStart;
+        uint32 IndexCount;
+        uint32 MaterialIndex;
+    };
 
-        std::istringstream LineStream(Line);
-        std::string Token;
-        LineStream >> Token;
+    struct FCookedMaterial
+    {
+        FCookedString MaterialName;
+
+        uint32 bHasDiffuseTexture;
+        uint32 bHasBumpTexture;
+        uint32 bTransparent;
+
+        FVector Diffuse;
+        FVector Specular;
+        FVector Ambient;
+        FVector Emissive;
+
+        float SpecularScalar;
+        float DensityScalar;
+        float TransparencyScalar;
+        uint32 IlluminanceModel;
+
+        FCookedString DiffuseTextureName;
+        FCookedString DiffuseTexturePath;
+        FCookedString AmbientTextureName;
+        FCookedString AmbientTexturePath;
+        FCookedString SpecularTextureName;
+        FCookedString SpecularTexturePath;
+        FCookedString BumpTextureName;
+        FCookedString BumpTexturePath;
+        FCookedString AlphaTextureName;
+        FCookedString AlphaTexturePath;
+    };
+
+    /** Cook할 때 사용한 원본 파일 */
+    struct FCookedDependency
+    {
+        FCookedString FilePath;
+        uint64 FileSize;
+        uint64 LastWriteTime;
+        uint64 ContentHash;
+    };
+
+    /** 원본 파일 내용의 64비트 Hash. 4개의 Lane을 동시에 섞어서 메모리 대역폭에 가깝게 동작합니다. */
+    uint64 HashFileContent(const char* Data, uint64 Size)
+    {
+        constexpr uint64 Prime1 = 0x9E3779B185EBCA87ull;
+        constexpr uint64 Prime2 = 0xC2B2AE3D27D4EB4Full;
+        constexpr uint64 Prime3 = 0x165667B19E3779F9ull;
 
-        if (Token == "mtllib")
+        uint64 Lanes[4] = { Prime1 + Prime2, Prime2, 0, 0 - Prime1 };
+        uint64 Offset = 0;
+        for (; Offset + 32 <= Size; Offset += 32)
         {
-            LineStream >> Line;
-            OutObjInfo.MatName = Line;
-            continue;
+            for (int32 Lane = 0; Lane < 4; ++Lane)
+            {
+                uint64 Word;
+                memcpy(&Word, Data + Offset + Lane * 8, sizeof(Word));
+                Lanes[Lane] = std::rotl(Lanes[Lane] + Word * Prime2, 31) * Prime1;
+            }
         }
 
-        if (Token == "usemtl")
+        uint64 Hash = std::rotl(Lanes[0], 1) + std::rotl(Lanes[1], 7) + std::rotl(Lanes[2], 12) + std::rotl(Lanes[3], 18) + Size;
+        for (; Offset < Size; ++Offset)
         {
-            LineStream >> Line;
-            FString MatName(Line);
+            Hash = std::rotl(Hash ^ (static_cast<uint8>(Data[Offset]) * Prime3), 11) * Prime1;
+        }
+
+        Hash ^= Hash >> 33;
+        Hash *= Prime2;
+        Hash ^= Hash >> 29;
+        Hash *= Prime3;
+        Hash ^= Hash >> 32;
+        return Hash;
+    }
 
-            if (!OutObjInfo.MaterialSubsets.IsEmpty())
+    /** 메모리에서 Cook된 파일을 만듭니다. */
+    class FCookedMeshWriter
+    {
+    public:
+        /** Data를 정렬된 위치에 추가하고 그 Offset을 반환합니다. */
+        uint64 AddSection(const void* Data, uint64 Size)
+        {
+            const uint64 Offset = (static_cast<uint64>(Buffer.Num()) + CookedSectionAlignment - 1) & ~(CookedSectionAlignment - 1);
+            Buffer.SetNum(static_cast<int32>(Offset + Size));
+            if (Size > 0)
             {
-                FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
-                LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+                memcpy(Buffer.GetData() + Offset, Data, Size);
             }
+            return Offset;
+        }
 
-            FMaterialSubset MaterialSubset;
-            MaterialSubset.MaterialName = MatName;
-            MaterialSubset.IndexStart = OutObjInfo.VertexIndices.Num();
-            MaterialSubset.IndexCount = 0;
-            OutObjInfo.MaterialSubsets.Add(MaterialSubset);
+        template <typename T>
+        uint64 AddSection(const TArray<T>& Items)
+        {
+            return AddSection(Items.GetData(), static_cast<uint64>(Items.Num()) * sizeof(T));
         }
 
-        if (Token == "g" || Token == "o")
+        template <typename CharType>
+        FCookedString AddString(const CharType* Chars, uint32 Length)
         {
-            LineStream >> Line;
-            OutObjInfo.GroupName.Add(Line);
-            OutObjInfo.NumOfGroup++;
+            const FCookedString Result = { static_cast<uint32>(Strings.Num()), Length };
+            const uint32 ByteLength = Length * sizeof(CharType);
+            if (ByteLength > 0)
+            {
+                Strings.SetNum(Strings.Num() + static_cast<int32>(ByteLength));
+                memcpy(Strings.GetData() + Result.Offset, Chars, ByteLength);
+            }
+            return Result;
         }
 
-        if (Token == "v") // Vertex
+        FCookedString AddString(const FString& String) { return AddString(GetData(String), String.Len()); }
+        FCookedString AddString(const FWString& String) { return AddString(String.c_str(), static_cast<uint32>(String.length())); }
+
+        const TArray<uint8>& GetStrings() const { return Strings; }
+
+        TArray<uint8>& GetBuffer() { return Buffer; }
+
+    private:
+        TArray<uint8> Buffer;
+        TArray<uint8> Strings;
+    };
+
+    /** 매핑한 Cook 파일을 범위 검사와 함께 읽습니다. */
+    class FCookedMeshReader
+    {
+    public:
+        explicit FCookedMeshReader(const FMappedFile& InFile)
+            : Data(InFile.GetData())
+            , Size(InFile.GetSize())
         {
-            float X, Y, Z;
-            LineStream >> X >> Y >> Z;
-            OutObjInfo.Vertices.Add(FVector(X, Y * -1.f, Z));
-            continue;
         }
 
-        if (Token == "vn") // Normal
+        /** Offset에서 Count개의 T가 파일 안에 있고 정렬되어 있으면 그 주소를 반환합니다. */
+        template <typename T>
+        const T* GetSection(uint64 Offset, uint64 Count) const
         {
-            float NormalX, NormalY, NormalZ;
-            LineStream >> NormalX >> NormalY >> NormalZ;
-            OutObjInfo.Normals.Add(FVector(NormalX, NormalY * -1, NormalZ));
-            continue;
+            if (Offset % CookedSectionAlignment != 0 || Offset > Size || Count > (Size - Offset) / sizeof(T))
+            {
+                return nullptr;
+            }
+            return reinterpret_cast<const T*>(Data + Offset);
         }
 
-        if (Token == "vt") // Texture
+        void SetStrings(uint64 InOffset, uint64 InSize)
         {
-            float U, V;
-            LineStream >> U >> V;
-            OutObjInfo.UVs.Add(FVector2D(U, 1.f - V));
-            continue;
+            StringsOffset = InOffset;
+            StringsSize = InSize;
         }
 
-        if (Token == "f")
+        bool ReadString(const FCookedString& String, FString& OutString) const
         {
-            TArray<uint32> FaceVertexIndices;  // 이번 페이스의 정점 인덱스
-            TArray<uint32> FaceNormalIndices;  // 이번 페이스의 법선 인덱스
-            TArray<uint32> FaceUVIndices; // 이번 페이스의 텍스처 인덱스
+            return ReadChars(String, OutString.GetContainerPrivate());
+        }
 
-            while (LineStream >> Token)
-            {
-                std::istringstream TokenStream(Token);
-                std::string Part;
-                TArray<std::string> FacePieces;
-
-                uint32 vertexIndex = 0;
-                uint32 textureIndex = UINT32_MAX;
-                uint32 normalIndex = UINT32_MAX;
-
-                // v
-                if (std::getline(TokenStream, Part, '/'))
-                {
-                    if (!Part.empty())
-                    {
-                        vertexIndex = std::stoi(Part) - 1;
-                    }
-                }
-
-                // vt
-                if (std::getline(TokenStream, Part, '/'))
-                {
-                    if (!Part.empty())
-                    {
-                        textureIndex = std::stoi(Part) - 1;
-                    }
-                }
-
-                // vn
-                if (std::getline(TokenStream, Part, '/'))
-                {
-                    if (!Part.empty())
-                    {
-                        normalIndex = std::stoi(Part) - 1;
-                    }
-                }
-
-                FaceVertexIndices.Add(vertexIndex);
-                FaceUVIndices.Add(textureIndex);
-                FaceNormalIndices.Add(normalIndex);
-            }
+        bool ReadString(const FCookedString& String, FWString& OutString) const
+        {
+            return ReadChars(String, OutString);
+        }
 
-            if (FaceVertexIndices.Num() == 3) // 삼각형
+    private:
+        template <typename StringType>
+        bool ReadChars(const FCookedString& String, StringType& OutString) const
+        {
+            const uint64 ByteLength = static_cast<uint64>(String.Length) * sizeof(typename StringType::value_type);
+            if (String.Offset > StringsSize || ByteLength > StringsSize - String.Offset)
             {
-                // 반시계 방향(오른손 좌표계)을 시계 방향(왼손 좌표계)으로 변환: 0-2-1
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[1]);
-
-                OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[1]);
-
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
+                return false;
             }
-            else if (FaceVertexIndices.Num() == 4) // 쿼드
+            OutString.resize(String.Length);
+            if (ByteLength > 0)
             {
-                // 첫 번째 삼각형: 0-2-1
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[1]);
-
-                OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[1]);
-
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
-
-                // 두 번째 삼각형: 0-3-2
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[3]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
-
-                OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[3]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
-
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[3]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
+                memcpy(OutString.data(), Data + StringsOffset + String.Offset, ByteLength);
             }
+            return true;
+        }
+
+        const char* Data;
+        uint64 Size;
+        uint64 StringsOffset = 0;
+        uint64 StringsSize = 0;
+    };
+
+    /** 원본 파일의 현재 상태를 기록합니다. */
+    bool MakeCookedDependency(const FWString& FilePath, FCookedMeshWriter& Writer, FCookedDependency& OutDependency)
+    {
+        FMappedFile File;
+        if (!File.Open(FilePath))
+        {
+            return false;
         }
+
+        OutDependency.FilePath = Writer.AddString(FilePath);
+        OutDependency.FileSize = File.GetSize();
+        OutDependency.LastWriteTime = File.GetLastWriteTime();
+        OutDependency.ContentHash = HashFileContent(File.GetData(), File.GetSize());
+        return true;
+    }
+
+    /** 원본 파일이 Cook한 이후 바뀌지 않았는지 확인합니다. 수정 시각만 바뀐 경우에는 내용 Hash로 비교합니다. */
+    bool IsCookedDependencyUpToDate(const FWString& FilePath, const FCookedDependency& Dependency)
+    {
+        FMappedFile File;
+        if (!File.Open(FilePath) || File.GetSize() != Dependency.FileSize)
+        {
+            return false;
+        }
+        if (File.GetLastWriteTime() == Dependency.LastWriteTime)
+        {
+            return true;
+        }
+        return HashFileContent(File.GetData(), File.GetSize()) == Dependency.ContentHash;
+    }
+}
+
+bool FLoaderOBJ::ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
+{
+    FMappedFile OBJ;
+    if (!OBJ.Open(ObjFilePath.ToWideString()))
+    {
+        return false;
     }
 
-    if (!OutObjInfo.MaterialSubsets.IsEmpty())
+    OutObjInfo.FilePath = ObjFilePath.ToWideString().substr(0, ObjFilePath.ToWideString().find_last_of(L"\\/") + 1);
+    OutObjInfo.ObjectName = ObjFilePath.ToWideString();
+    // ObjectName은 wstring 타입이므로, 이를 string으로 변환 (간단한 ASCII 변환의 경우)
+    std::wstring wideName = OutObjInfo.ObjectName.substr(ObjFilePath.ToWideString().find_last_of(L"\\/") + 1);;
+    std::string fileName(wideName.begin(), wideName.end());
+
+    // 마지막 '.'을 찾아 확장자를 제거
+    size_t dotPos = fileName.find_last_of('.');
+    if (dotPos != std::string::npos)
+    {
+        OutObjInfo.DisplayName = fileName.substr(0, dotPos);
+    }
+    else
     {
-        FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
-        LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+        OutObjInfo.DisplayName = fileName;
     }
 
+    /**
+     * 블렌더 Export 설정
+     *   - General
+     *       Forward Axis:  Y
+     *       Up Axis:       Z
+     *   - Geometry
+     *       ✅ Triangulated Mesh
+     */
+
+    ObjParser::ParseObjText(OBJ.GetData(), OBJ.GetSize(), OutObjInfo);
     return true;
 }
 
@@ -216,6 +345,11 @@ bool FLoaderOBJ::ParseMaterial(FObjInfo& OutObjInfo, OBJ::FStaticMeshRenderData&
     // Subset
     OutFStaticMesh.MaterialSubsets = OutObjInfo.MaterialSubsets;
 
+    // 이름 뒤에 남은 공백이나 CRLF의 '\r'이 있으면 파일을 열 수 없습니다.
+    std::string MtlFileName = *OutObjInfo.MatName;
+    MtlFileName.erase(MtlFileName.find_last_not_of(" \t\r\n") + 1);
+    OutObjInfo.MatName = MtlFileName;
+
     std::ifstream MtlFile(OutObjInfo.FilePath + OutObjInfo.MatName.ToWideString());
     if (!MtlFile.is_open())
     {
@@ -227,6 +361,11 @@ bool FLoaderOBJ::ParseMaterial(FObjInfo& OutObjInfo, OBJ::FStaticMeshRenderData&
 
     while (std::getline(MtlFile, Line))
     {
+        if (!Line.empty() && Line.back() == '\r')
+        {
+            Line.pop_back();
+        }
+
         if (Line.empty() || Line[0] == '#')
             continue;
 
@@ -310,8 +449,6 @@ bool FLoaderOBJ::ParseMaterial(FObjInfo& OutObjInfo, OBJ::FStaticMeshRenderData&
             FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].DiffuseTextureName.ToWideString();
             OutFStaticMesh.Materials[MaterialIndex].DiffuseTexturePath = TexturePath;
             OutFStaticMesh.Materials[MaterialIndex].bHasDiffuseTexture = true;
-
-            CreateTextureFromFile(OutFStaticMesh.Materials[MaterialIndex].DiffuseTexturePath);
         }
 
         if (Token == "map_Bump")
@@ -321,8 +458,6 @@ bool FLoaderOBJ::ParseMaterial(FObjInfo& OutObjInfo, OBJ::FStaticMeshRenderData&
             FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].BumpTextureName.ToWideString();
             OutFStaticMesh.Materials[MaterialIndex].BumpTexturePath = TexturePath;
             OutFStaticMesh.Materials[MaterialIndex].bHasBumpTexture = true;
-
-            CreateTextureFromFile(OutFStaticMesh.Materials[MaterialIndex].BumpTexturePath);
         }
     }
 
@@ -335,33 +470,45 @@ bool FLoaderOBJ::ConvertToStaticMesh(const FObjInfo& RawData, OBJ::FStaticMeshRe
     //OutStaticMesh.PathName = RawData.PathName;
     OutStaticMesh.DisplayName = RawData.DisplayName;
 
-    // 고유 정점을 기반으로 FVertexSimple 배열 생성
-    TMap<std::string, uint32> IndexMap; // 중복 체크용
+    const int32 NumCorners = RawData.VertexIndices.Num();
+
+    // (v, vt, vn) 조합마다 고유 번호를 붙이고, 번호마다 마지막으로 만든 정점을 기억합니다.
+    TArray<uint32> CornerKeyIds;
+    const uint32 NumKeys = ObjParser::WeldVertexKeys(RawData, OutStaticMesh.MaterialSubsets, CornerKeyIds);
+
+    TArray<uint32> KeyVertices;
+    KeyVertices.Init(UINT32_MAX, static_cast<int32>(NumKeys));
 
-    for (int32 i = 0; i < RawData.VertexIndices.Num(); i++)
+    // Face Corner가 속한 Material, 겹치는 Subset이 있으면 앞의 것을 사용합니다.
+    TArray<uint32> CornerMaterials;
+    CornerMaterials.Init(0, NumCorners);
+    for (int32 j = OutStaticMesh.MaterialSubsets.Num() - 1; j >= 0; j--)
+    {
+        const FMaterialSubset& Subset = OutStaticMesh.MaterialSubsets[j];
+        const int32 SubsetEnd = static_cast<int32>(FMath::Min<uint64>(static_cast<uint64>(Subset.IndexStart) + Subset.IndexCount, NumCorners));
+        for (int32 i = static_cast<int32>(FMath::Min<uint32>(Subset.IndexStart, NumCorners)); i < SubsetEnd; i++)
+        {
+            CornerMaterials[i] = Subset.MaterialIndex;
+        }
+    }
+
+    OutStaticMesh.Vertices.Reserve(static_cast<int32>(NumKeys));
+    OutStaticMesh.Indices.Reserve(NumCorners);
+
+    for (int32 i = 0; i < NumCorners; i++)
     {
         const uint32 VertexIndex = RawData.VertexIndices[i];
         const uint32 UVIndex = RawData.UVIndices[i];
         const uint32 NormalIndex = RawData.NormalIndices[i];
 
-        // 키 생성 (v/vt/vn 조합)
-        std::string Key = std::to_string(VertexIndex) + "/" + std::to_string(UVIndex) + "/" + std::to_string(NormalIndex);
-		uint32 MaterialIndex = 0;
-		for (int32 j = 0; j < OutStaticMesh.MaterialSubsets.Num(); j++)
-		{
-			const FMaterialSubset& Subset = OutStaticMesh.MaterialSubsets[j];
-			if (i >= Subset.IndexStart && i < Subset.IndexStart + Subset.IndexCount)
-			{
-				MaterialIndex = Subset.MaterialIndex;
-				break;
-			}
-		}
+        uint32& KeyVertex = KeyVertices[CornerKeyIds[i]];
+        const uint32 MaterialIndex = CornerMaterials[i];
         bool bUseBumpTexture = (OutStaticMesh.Materials.Num() > MaterialIndex && OutStaticMesh.Materials[MaterialIndex].bHasBumpTexture);
 
         uint32 FinalIndex;
-        if (IndexMap.Contains(Key) && !bUseBumpTexture)
+        if (KeyVertex != UINT32_MAX && !bUseBumpTexture)
         {
-            FinalIndex = IndexMap[Key];
+            FinalIndex = KeyVertex;
         }
         else
         {
@@ -403,7 +550,7 @@ bool FLoaderOBJ::ConvertToStaticMesh(const FObjInfo& RawData, OBJ::FStaticMeshRe
 
             FinalIndex = OutStaticMesh.Vertices.Num();
             OutStaticMesh.Vertices.Add(StaticMeshVertex);
-            IndexMap[Key] = FinalIndex;
+            KeyVertex = FinalIndex;
         }
 
         OutStaticMesh.Indices.Add(FinalIndex);
@@ -561,29 +708,44 @@ void FLoaderOBJ::CalculateTangent(FStaticMeshVertex& PivotVertex, const FStaticM
 
 OBJ::FStaticMeshRenderData* FManagerOBJ::LoadObjStaticMeshAsset(const FString& PathFileName)
 {
-    OBJ::FStaticMeshRenderData* NewStaticMesh = new OBJ::FStaticMeshRenderData();
-
     if ( const auto It = ObjStaticMeshMap.Find(PathFileName))
     {
         return *It;
     }
 
-    FWString BinaryPath = (PathFileName + ".bin").ToWideString();
-    if (std::ifstream(BinaryPath).good())
+    TArray<FString> Errors;
+    OBJ::FStaticMeshRenderData* NewStaticMesh = BuildStaticMeshRenderData(PathFileName, Errors);
+    for (const FString& Error : Errors)
     {
-        if (LoadStaticMeshFromBinary(BinaryPath, *NewStaticMesh))
-        {
-            ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
-            return NewStaticMesh;
-        }
+        UE_LOG(NewStaticMesh ? LogLevel::Warning : LogLevel::Error, "%s", *Error);
+    }
+    if (NewStaticMesh == nullptr)
+    {
+        return nullptr;
     }
 
+    return RegisterStaticMeshRenderData(PathFileName, NewStaticMesh);
+}
+
+OBJ::FStaticMeshRenderData* FManagerOBJ::BuildStaticMeshRenderData(const FString& PathFileName, TArray<FString>& OutErrors)
+{
+    OBJ::FStaticMeshRenderData* NewStaticMesh = new OBJ::FStaticMeshRenderData();
+
+    // 원본이 바뀌지 않았으면 Cook된 파일을 사용합니다.
+    const FWString BinaryPath = GetCookedMeshPath(PathFileName);
+    if (LoadStaticMeshFromBinary(BinaryPath, *NewStaticMesh))
+    {
+        return NewStaticMesh;
+    }
+    *NewStaticMesh = OBJ::FStaticMeshRenderData();
+
     // Parse OBJ
     FObjInfo NewObjInfo;
     bool Result = FLoaderOBJ::ParseOBJ(PathFileName, NewObjInfo);
 
     if (!Result)
     {
+        OutErrors.Add(FString::Printf(TEXT("[StaticMesh] Cannot open %s"), *PathFileName));
         delete NewStaticMesh;
         return nullptr;
     }
@@ -595,30 +757,84 @@ OBJ::FStaticMeshRenderData* FManagerOBJ::LoadObjStaticMeshAsset(const FString& P
 
         if (!Result)
         {
+            OutErrors.Add(FString::Printf(TEXT("[StaticMesh] %s: cannot open material library \"%s\""), *PathFileName, *NewObjInfo.MatName));
             delete NewStaticMesh;
             return nullptr;
         }
 
         CombineMaterialIndex(*NewStaticMesh);
-
-        for (int materialIndex = 0; materialIndex < NewStaticMesh->Materials.Num(); materialIndex++) {
-            CreateMaterial(NewStaticMesh->Materials[materialIndex]);
-        }
     }
 
     // Convert FStaticMeshRenderData
     Result = FLoaderOBJ::ConvertToStaticMesh(NewObjInfo, *NewStaticMesh);
     if (!Result)
     {
+        OutErrors.Add(FString::Printf(TEXT("[StaticMesh] %s: cannot convert to a static mesh"), *PathFileName));
         delete NewStaticMesh;
         return nullptr;
     }
 
-    // SaveStaticMeshToBinary(BinaryPath, *NewStaticMesh); // TODO: refactoring 끝나면 활성화하기
-    ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
+    // 피킹 BVH도 Worker Thread에서 빌드해서 Cook된 파일에 함께 저장합니다.
+    NewStaticMesh->TriangleBVH.Build(*NewStaticMesh);
+
+    TArray<FWString> SourceFiles;
+    SourceFiles.Add(PathFileName.ToWideString());
+    if (!NewObjInfo.MatName.IsEmpty())
+    {
+        SourceFiles.Add(NewObjInfo.FilePath + NewObjInfo.MatName.ToWideString());
+    }
+    // Cook에 실패해도 메시는 사용할 수 있고, 다음 실행 때 다시 Cook합니다.
+    if (!SaveStaticMeshToBinary(BinaryPath, *NewStaticMesh, SourceFiles))
+    {
+        OutErrors.Add(FString::Printf(TEXT("[StaticMesh] %s: failed to write cooked mesh %s"), *PathFileName, *FString(BinaryPath)));
+    }
+
     return NewStaticMesh;
 }
 
+OBJ::FStaticMeshRenderData* FManagerOBJ::RegisterStaticMeshRenderData(const FString& PathFileName, OBJ::FStaticMeshRenderData* RenderData)
+{
+    if (RenderData == nullptr)
+    {
+        return nullptr;
+    }
+
+    // 그 사이에 같은 파일이 등록되었으면 새로 만든 것은 버립니다.
+    if (const auto It = ObjStaticMeshMap.Find(PathFileName))
+    {
+        delete RenderData;
+        return *It;
+    }
+
+    TArray<FWString> TexturePaths;
+    GetTexturePaths(*RenderData, TexturePaths);
+    for (const FWString& TexturePath : TexturePaths)
+    {
+        FLoaderOBJ::CreateTextureFromFile(TexturePath);
+    }
+
+    for (int materialIndex = 0; materialIndex < RenderData->Materials.Num(); materialIndex++) {
+        CreateMaterial(RenderData->Materials[materialIndex]);
+    }
+
+    ObjStaticMeshMap.Add(PathFileName, RenderData);
+    return RenderData;
+}
+
+void FManagerOBJ::GetTexturePaths(const OBJ::FStaticMeshRenderData& RenderData, TArray<FWString>& OutTexturePaths)
+{
+    for (const FObjMaterialInfo& Material : RenderData.Materials)
+    {
+        for (const FWString* TexturePath : { &Material.DiffuseTexturePath, &Material.AmbientTexturePath, &Material.SpecularTexturePath, &Material.BumpTexturePath, &Material.AlphaTexturePath })
+        {
+            if (!TexturePath->empty())
+            {
+                OutTexturePaths.AddUnique(*TexturePath);
+            }
+        }
+    }
+}
+
 void FManagerOBJ::CombineMaterialIndex(OBJ::FStaticMeshRenderData& OutFStaticMesh)
 {
     for (int32 i = 0; i < OutFStaticMesh.MaterialSubsets.Num(); i++)
@@ -635,193 +851,218 @@ void FManagerOBJ::CombineMaterialIndex(OBJ::FStaticMeshRenderData& OutFStaticMes
     }
 }
 
-bool FManagerOBJ::SaveStaticMeshToBinary(const FWString& FilePath, const OBJ::FStaticMeshRenderData& StaticMesh)
+bool FManagerOBJ::SaveStaticMeshToBinary(const FWString& FilePath, const OBJ::FStaticMeshRenderData& StaticMesh, const TArray<FWString>& SourceFiles)
 {
-    std::ofstream File(FilePath, std::ios::binary);
-    if (!File.is_open())
+    FCookedMeshWriter Writer;
+
+    FCookedMeshHeader Header = {};
+    Header.Magic = CookedMeshMagic;
+    Header.Version = CookedMeshVersion;
+    Header.VertexStride = sizeof(FStaticMeshVertex);
+    Header.CharSize = sizeof(FString::ElementType);
+    Header.WideCharSize = sizeof(wchar_t);
+    Header.ObjectName = Writer.AddString(StaticMesh.ObjectName);
+    Header.DisplayName = Writer.AddString(StaticMesh.DisplayName);
+    Header.BoundingBoxMin = StaticMesh.BoundingBoxMin;
+    Header.BoundingBoxMax = StaticMesh.BoundingBoxMax;
+
+    // Header는 마지막에 채웁니다.
+    Writer.AddSection(&Header, sizeof(Header));
+
+    // Vertices, Indices
+    Header.NumVertices = StaticMesh.Vertices.Num();
+    Header.VerticesOffset = Writer.AddSection(StaticMesh.Vertices);
+    Header.NumIndices = StaticMesh.Indices.Num();
+    Header.IndicesOffset = Writer.AddSection(StaticMesh.Indices);
+
+    // 피킹 BVH
+    Header.NumBVHNodes = StaticMesh.TriangleBVH.GetNumNodes();
+    Header.BVHNodesOffset = Writer.AddSection(StaticMesh.TriangleBVH.GetNodes());
+    Header.NumBVHPackets = StaticMesh.TriangleBVH.GetPackets().Num();
+    Header.BVHPacketsOffset = Writer.AddSection(StaticMesh.TriangleBVH.GetPackets());
+    Header.NumBVHTriangles = StaticMesh.TriangleBVH.GetNumTriangles();
+
+    // Material Subsets
+    TArray<FCookedSubset> Subsets;
+    for (const FMaterialSubset& Subset : StaticMesh.MaterialSubsets)
     {
-        assert("CAN'T SAVE STATIC MESH BINARY FILE");
-        return false;
+        Subsets.Add({ Writer.AddString(Subset.MaterialName), Subset.IndexStart, Subset.IndexCount, Subset.MaterialIndex });
     }
-
-    // Object Name
-    Serializer::WriteFWString(File, StaticMesh.ObjectName);
-
-    // Display Name
-    Serializer::WriteFString(File, StaticMesh.DisplayName);
-
-    // Vertices
-    uint32 VertexCount = StaticMesh.Vertices.Num();
-    File.write(reinterpret_cast<const char*>(&VertexCount), sizeof(VertexCount));
-    File.write(reinterpret_cast<const char*>(StaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
-
-    // Indices
-    uint32 IndexCount = StaticMesh.Indices.Num();
-    File.write(reinterpret_cast<const char*>(&IndexCount), sizeof(IndexCount));
-    File.write(reinterpret_cast<const char*>(StaticMesh.Indices.GetData()), IndexCount * sizeof(UINT));
+    Header.NumSubsets = Subsets.Num();
+    Header.SubsetsOffset = Writer.AddSection(Subsets);
 
     // Materials
-    uint32 MaterialCount = StaticMesh.Materials.Num();
-    File.write(reinterpret_cast<const char*>(&MaterialCount), sizeof(MaterialCount));
+    TArray<FCookedMaterial> Materials;
     for (const FObjMaterialInfo& Material : StaticMesh.Materials)
     {
-        Serializer::WriteFString(File, Material.MaterialName);
-        File.write(reinterpret_cast<const char*>(&Material.bHasDiffuseTexture), sizeof(Material.bHasDiffuseTexture));
-        File.write(reinterpret_cast<const char*>(&Material.bHasBumpTexture), sizeof(Material.bHasBumpTexture));
-        File.write(reinterpret_cast<const char*>(&Material.bTransparent), sizeof(Material.bTransparent));
-        File.write(reinterpret_cast<const char*>(&Material.Diffuse), sizeof(Material.Diffuse));
-        File.write(reinterpret_cast<const char*>(&Material.Specular), sizeof(Material.Specular));
-        File.write(reinterpret_cast<const char*>(&Material.Ambient), sizeof(Material.Ambient));
-        File.write(reinterpret_cast<const char*>(&Material.Emissive), sizeof(Material.Emissive));
-        File.write(reinterpret_cast<const char*>(&Material.SpecularScalar), sizeof(Material.SpecularScalar));
-        File.write(reinterpret_cast<const char*>(&Material.DensityScalar), sizeof(Material.DensityScalar));
-        File.write(reinterpret_cast<const char*>(&Material.TransparencyScalar), sizeof(Material.TransparencyScalar));
-        File.write(reinterpret_cast<const char*>(&Material.IlluminanceModel), sizeof(Material.IlluminanceModel));
-
-        Serializer::WriteFString(File, Material.DiffuseTextureName);
-        Serializer::WriteFWString(File, Material.DiffuseTexturePath);
-        Serializer::WriteFString(File, Material.AmbientTextureName);
-        Serializer::WriteFWString(File, Material.AmbientTexturePath);
-        Serializer::WriteFString(File, Material.SpecularTextureName);
-        Serializer::WriteFWString(File, Material.SpecularTexturePath);
-        Serializer::WriteFString(File, Material.BumpTextureName);
-        Serializer::WriteFWString(File, Material.BumpTexturePath);
-        Serializer::WriteFString(File, Material.AlphaTextureName);
-        Serializer::WriteFWString(File, Material.AlphaTexturePath);
+        FCookedMaterial Cooked = {};
+        Cooked.MaterialName = Writer.AddString(Material.MaterialName);
+        Cooked.bHasDiffuseTexture = Material.bHasDiffuseTexture;
+        Cooked.bHasBumpTexture = Material.bHasBumpTexture;
+        Cooked.bTransparent = Material.bTransparent;
+        Cooked.Diffuse = Material.Diffuse;
+        Cooked.Specular = Material.Specular;
+        Cooked.Ambient = Material.Ambient;
+        Cooked.Emissive = Material.Emissive;
+        Cooked.SpecularScalar = Material.SpecularScalar;
+        Cooked.DensityScalar = Material.DensityScalar;
+        Cooked.TransparencyScalar = Material.TransparencyScalar;
+        Cooked.IlluminanceModel = Material.IlluminanceModel;
+        Cooked.DiffuseTextureName = Writer.AddString(Material.DiffuseTextureName);
+        Cooked.DiffuseTexturePath = Writer.AddString(Material.DiffuseTexturePath);
+        Cooked.AmbientTextureName = Writer.AddString(Material.AmbientTextureName);
+        Cooked.AmbientTexturePath = Writer.AddString(Material.AmbientTexturePath);
+        Cooked.SpecularTextureName = Writer.AddString(Material.SpecularTextureName);
+        Cooked.SpecularTexturePath = Writer.AddString(Material.SpecularTexturePath);
+        Cooked.BumpTextureName = Writer.AddString(Material.BumpTextureName);
+        Cooked.BumpTexturePath = Writer.AddString(Material.BumpTexturePath);
+        Cooked.AlphaTextureName = Writer.AddString(Material.AlphaTextureName);
+        Cooked.AlphaTexturePath = Writer.AddString(Material.AlphaTexturePath);
+        Materials.Add(Cooked);
     }
+    Header.NumMaterials = Materials.Num();
+    Header.MaterialsOffset = Writer.AddSection(Materials);
 
-    // Material Subsets
-    uint32 SubsetCount = StaticMesh.MaterialSubsets.Num();
-    File.write(reinterpret_cast<const char*>(&SubsetCount), sizeof(SubsetCount));
-    for (const FMaterialSubset& Subset : StaticMesh.MaterialSubsets)
+    // 원본 파일
+    TArray<FCookedDependency> Dependencies;
+    for (const FWString& SourceFile : SourceFiles)
     {
-        Serializer::WriteFString(File, Subset.MaterialName);
-        File.write(reinterpret_cast<const char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
-        File.write(reinterpret_cast<const char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
-        File.write(reinterpret_cast<const char*>(&Subset.MaterialIndex), sizeof(Subset.MaterialIndex));
+        FCookedDependency Dependency;
+        if (!MakeCookedDependency(SourceFile, Writer, Dependency))
+        {
+            return false;
+        }
+        Dependencies.Add(Dependency);
     }
+    Header.NumDependencies = Dependencies.Num();
+    Header.DependenciesOffset = Writer.AddSection(Dependencies);
 
-    // Bounding Box
-    File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMin), sizeof(FVector));
-    File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMax), sizeof(FVector));
+    // Strings는 다른 Section이 모두 문자열을 추가한 뒤에 씁니다.
+    Header.StringsSize = Writer.GetStrings().Num();
+    Header.StringsOffset = Writer.AddSection(Writer.GetStrings());
 
-    File.close();
-    return true;
+    TArray<uint8>& Buffer = Writer.GetBuffer();
+    Header.FileSize = Buffer.Num();
+    memcpy(Buffer.GetData(), &Header, sizeof(Header));
+
+    std::error_code ErrorCode;
+    std::filesystem::create_directories(std::filesystem::path(FilePath).parent_path(), ErrorCode);
+
+    std::ofstream File(std::filesystem::path(FilePath), std::ios::binary | std::ios::trunc);
+    if (!File.is_open())
+    {
+        return false;
+    }
+    File.write(reinterpret_cast<const char*>(Buffer.GetData()), Buffer.Num());
+    return File.good();
 }
 
 bool FManagerOBJ::LoadStaticMeshFromBinary(const FWString& FilePath, OBJ::FStaticMeshRenderData& OutStaticMesh)
 {
-    std::ifstream File(FilePath, std::ios::binary);
-    if (!File.is_open())
+    // 정점과 인덱스는 복사하지 않고 매핑한 파일을 그대로 가리키므로, 매핑은 RenderData가 들고 있습니다.
+    const std::shared_ptr<FMappedFile> File = std::make_shared<FMappedFile>();
+    if (!File->Open(FilePath))
     {
-        assert("CAN'T OPEN STATIC MESH BINARY FILE");
         return false;
     }
 
-    TArray<FWString> Textures;
-
-    // Object Name
-    Serializer::ReadFWString(File, OutStaticMesh.ObjectName);
-
-    //// Path Name
-    //Serializer::ReadFWString(File, OutStaticMesh.PathName);
-
-    // Display Name
-    Serializer::ReadFString(File, OutStaticMesh.DisplayName);
-
-    // Vertices
-    uint32 VertexCount = 0;
-    File.read(reinterpret_cast<char*>(&VertexCount), sizeof(VertexCount));
-    OutStaticMesh.Vertices.SetNum(VertexCount);
-    File.read(reinterpret_cast<char*>(OutStaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
-
-    // Indices
-    uint32 IndexCount = 0;
-    File.read(reinterpret_cast<char*>(&IndexCount), sizeof(IndexCount));
-    OutStaticMesh.Indices.SetNum(IndexCount);
-    File.read(reinterpret_cast<char*>(OutStaticMesh.Indices.GetData()), IndexCount * sizeof(UINT));
+    FCookedMeshReader Reader(*File);
+    const FCookedMeshHeader* Header = Reader.GetSection<FCookedMeshHeader>(0, 1);
+    if (Header == nullptr
+        || Header->Magic != CookedMeshMagic
+        || Header->Version != CookedMeshVersion
+        || Header->VertexStride != sizeof(FStaticMeshVertex)
+        || Header->CharSize != sizeof(FString::ElementType)
+        || Header->WideCharSize != sizeof(wchar_t)
+        || Header->FileSize != File->GetSize())
+    {
+        return false;
+    }
 
-    // Material
-    uint32 MaterialCount = 0;
-    File.read(reinterpret_cast<char*>(&MaterialCount), sizeof(MaterialCount));
-    OutStaticMesh.Materials.SetNum(MaterialCount);
-    for (FObjMaterialInfo& Material : OutStaticMesh.Materials)
+    const FStaticMeshVertex* Vertices = Reader.GetSection<FStaticMeshVertex>(Header->VerticesOffset, Header->NumVertices);
+    const uint32* Indices = Reader.GetSection<uint32>(Header->IndicesOffset, Header->NumIndices);
+    const FStaticMeshBVH::FNode* BVHNodes = Reader.GetSection<FStaticMeshBVH::FNode>(Header->BVHNodesOffset, Header->NumBVHNodes);
+    const FStaticMeshBVH::FTrianglePacket* BVHPackets = Reader.GetSection<FStaticMeshBVH::FTrianglePacket>(Header->BVHPacketsOffset, Header->NumBVHPackets);
+    const FCookedSubset* Subsets = Reader.GetSection<FCookedSubset>(Header->SubsetsOffset, Header->NumSubsets);
+    const FCookedMaterial* Materials = Reader.GetSection<FCookedMaterial>(Header->MaterialsOffset, Header->NumMaterials);
+    const FCookedDependency* Dependencies = Reader.GetSection<FCookedDependency>(Header->DependenciesOffset, Header->NumDependencies);
+    if (!Vertices || !Indices || !BVHNodes || !BVHPackets || !Subsets || !Materials || !Dependencies || !Reader.GetSection<uint8>(Header->StringsOffset, Header->StringsSize))
     {
-        Serializer::ReadFString(File, Material.MaterialName);
-        File.read(reinterpret_cast<char*>(&Material.bHasDiffuseTexture), sizeof(Material.bHasDiffuseTexture));
-        File.read(reinterpret_cast<char*>(&Material.bHasBumpTexture), sizeof(Material.bHasBumpTexture));
-        File.read(reinterpret_cast<char*>(&Material.bTransparent), sizeof(Material.bTransparent));
-        File.read(reinterpret_cast<char*>(&Material.Diffuse), sizeof(Material.Diffuse));
-        File.read(reinterpret_cast<char*>(&Material.Specular), sizeof(Material.Specular));
-        File.read(reinterpret_cast<char*>(&Material.Ambient), sizeof(Material.Ambient));
-        File.read(reinterpret_cast<char*>(&Material.Emissive), sizeof(Material.Emissive));
-        File.read(reinterpret_cast<char*>(&Material.SpecularScalar), sizeof(Material.SpecularScalar));
-        File.read(reinterpret_cast<char*>(&Material.DensityScalar), sizeof(Material.DensityScalar));
-        File.read(reinterpret_cast<char*>(&Material.TransparencyScalar), sizeof(Material.TransparencyScalar));
-        File.read(reinterpret_cast<char*>(&Material.IlluminanceModel), sizeof(Material.IlluminanceModel));
-        Serializer::ReadFString(File, Material.DiffuseTextureName);
-        Serializer::ReadFWString(File, Material.DiffuseTexturePath);
-        Serializer::ReadFString(File, Material.AmbientTextureName);
-        Serializer::ReadFWString(File, Material.AmbientTexturePath);
-        Serializer::ReadFString(File, Material.SpecularTextureName);
-        Serializer::ReadFWString(File, Material.SpecularTexturePath);
-        Serializer::ReadFString(File, Material.BumpTextureName);
-        Serializer::ReadFWString(File, Material.BumpTexturePath);
-        Serializer::ReadFString(File, Material.AlphaTextureName);
-        Serializer::ReadFWString(File, Material.AlphaTexturePath);
+        return false;
+    }
+    Reader.SetStrings(Header->StringsOffset, Header->StringsSize);
 
-        if (!Material.DiffuseTexturePath.empty())
-        {
-            Textures.AddUnique(Material.DiffuseTexturePath);
-        }
-        if (!Material.AmbientTexturePath.empty())
-        {
-            Textures.AddUnique(Material.AmbientTexturePath);
-        }
-        if (!Material.SpecularTexturePath.empty())
-        {
-            Textures.AddUnique(Material.SpecularTexturePath);
-        }
-        if (!Material.BumpTexturePath.empty())
-        {
-            Textures.AddUnique(Material.BumpTexturePath);
-        }
-        if (!Material.AlphaTexturePath.empty())
+    // 원본이 바뀌었으면 다시 Cook 해야 합니다.
+    for (uint32 i = 0; i < Header->NumDependencies; i++)
+    {
+        FWString SourceFile;
+        if (!Reader.ReadString(Dependencies[i].FilePath, SourceFile) || !IsCookedDependencyUpToDate(SourceFile, Dependencies[i]))
         {
-            Textures.AddUnique(Material.AlphaTexturePath);
+            return false;
         }
     }
 
-    // Material Subset
-    uint32 SubsetCount = 0;
-    File.read(reinterpret_cast<char*>(&SubsetCount), sizeof(SubsetCount));
-    OutStaticMesh.MaterialSubsets.SetNum(SubsetCount);
-    for (FMaterialSubset& Subset : OutStaticMesh.MaterialSubsets)
+    bool bValidStrings = Reader.ReadString(Header->ObjectName, OutStaticMesh.ObjectName)
+        && Reader.ReadString(Header->DisplayName, OutStaticMesh.DisplayName);
+
+    OutStaticMesh.MaterialSubsets.SetNum(Header->NumSubsets);
+    for (uint32 i = 0; i < Header->NumSubsets; i++)
     {
-        Serializer::ReadFString(File, Subset.MaterialName);
-        File.read(reinterpret_cast<char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
-        File.read(reinterpret_cast<char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
-        File.read(reinterpret_cast<char*>(&Subset.MaterialIndex), sizeof(Subset.MaterialIndex));
+        FMaterialSubset& Subset = OutStaticMesh.MaterialSubsets[i];
+        bValidStrings &= Reader.ReadString(Subsets[i].MaterialName, Subset.MaterialName);
+        Subset.IndexStart = Subsets[i].IndexStart;
+        Subset.IndexCount = Subsets[i].IndexCount;
+        Subset.MaterialIndex = Subsets[i].MaterialIndex;
     }
 
-    // Bounding Box
-    File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMin), sizeof(FVector));
-    File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMax), sizeof(FVector));
+    OutStaticMesh.Materials.SetNum(Header->NumMaterials);
+    for (uint32 i = 0; i < Header->NumMaterials; i++)
+    {
+        const FCookedMaterial& Cooked = Materials[i];
+        FObjMaterialInfo& Material = OutStaticMesh.Materials[i];
+        bValidStrings &= Reader.ReadString(Cooked.MaterialName, Material.MaterialName);
+        Material.bHasDiffuseTexture = Cooked.bHasDiffuseTexture != 0;
+        Material.bHasBumpTexture = Cooked.bHasBumpTexture != 0;
+        Material.bTransparent = Cooked.bTransparent != 0;
+        Material.Diffuse = Cooked.Diffuse;
+        Material.Specular = Cooked.Specular;
+        Material.Ambient = Cooked.Ambient;
+        Material.Emissive = Cooked.Emissive;
+        Material.SpecularScalar = Cooked.SpecularScalar;
+        Material.DensityScalar = Cooked.DensityScalar;
+        Material.TransparencyScalar = Cooked.TransparencyScalar;
+        Material.IlluminanceModel = Cooked.IlluminanceModel;
+        bValidStrings &= Reader.ReadString(Cooked.DiffuseTextureName, Material.DiffuseTextureName);
+        bValidStrings &= Reader.ReadString(Cooked.DiffuseTexturePath, Material.DiffuseTexturePath);
+        bValidStrings &= Reader.ReadString(Cooked.AmbientTextureName, Material.AmbientTextureName);
+        bValidStrings &= Reader.ReadString(Cooked.AmbientTexturePath, Material.AmbientTexturePath);
+        bValidStrings &= Reader.ReadString(Cooked.SpecularTextureName, Material.SpecularTextureName);
+        bValidStrings &= Reader.ReadString(Cooked.SpecularTexturePath, Material.SpecularTexturePath);
+        bValidStrings &= Reader.ReadString(Cooked.BumpTextureName, Material.BumpTextureName);
+        bValidStrings &= Reader.ReadString(Cooked.BumpTexturePath, Material.BumpTexturePath);
+        bValidStrings &= Reader.ReadString(Cooked.AlphaTextureName, Material.AlphaTextureName);
+        bValidStrings &= Reader.ReadString(Cooked.AlphaTexturePath, Material.AlphaTexturePath);
+    }
 
-    File.close();
+    if (!bValidStrings)
+    {
+        return false;
+    }
 
-    // Texture Load
-    if (Textures.Num() > 0)
+    if (!OutStaticMesh.TriangleBVH.Assign(BVHNodes, static_cast<int32>(Header->NumBVHNodes), BVHPackets, static_cast<int32>(Header->NumBVHPackets), static_cast<int32>(Header->NumBVHTriangles)))
     {
-        for (const FWString& Texture : Textures)
-        {
-            if (FEngineLoop::ResourceManager.GetTexture(Texture) == nullptr)
-            {
-                FEngineLoop::ResourceManager.LoadTextureFromFile(FEngineLoop::GraphicDevice.Device, nullptr, Texture.c_str());
-            }
-        }
+        return false;
     }
 
+    OutStaticMesh.CookedFile = File;
+    OutStaticMesh.CookedVertices = Vertices;
+    OutStaticMesh.NumCookedVertices = Header->NumVertices;
+    OutStaticMesh.CookedIndices = Indices;
+    OutStaticMesh.NumCookedIndices = Header->NumIndices;
+
+    OutStaticMesh.BoundingBoxMin = Header->BoundingBoxMin;
+    OutStaticMesh.BoundingBoxMax = Header->BoundingBoxMax;
+
     return true;
 }
 
@@ -843,8 +1084,21 @@ UMaterial* FManagerOBJ::GetMaterial(FString name)
 
 UStaticMesh* FManagerOBJ::CreateStaticMesh(const FString& filePath)
 {
-    OBJ::FStaticMeshRenderData* StaticMeshRenderData = FManagerOBJ::LoadObjStaticMeshAsset(filePath);
+    return CreateStaticMeshFromRenderData(FManagerOBJ::LoadObjStaticMeshAsset(filePath));
+}
 
+UStaticMesh* FManagerOBJ::PublishStaticMesh(const FString& PathFileName, OBJ::FStaticMeshRenderData* RenderData)
+{
+    if (RenderData == nullptr)
+    {
+        UE_LOG(LogLevel::Error, "[StaticMesh] %s: no render data to publish", *PathFileName);
+        return nullptr;
+    }
+    return CreateStaticMeshFromRenderData(RegisterStaticMeshRenderData(PathFileName, RenderData));
+}
+
+UStaticMesh* FManagerOBJ::CreateStaticMeshFromRenderData(OBJ::FStaticMeshRenderData* StaticMeshRenderData)
+{
     if (StaticMeshRenderData == nullptr) return nullptr;
 
     UStaticMesh* StaticMesh = GetStaticMesh(StaticMeshRenderData->ObjectName);
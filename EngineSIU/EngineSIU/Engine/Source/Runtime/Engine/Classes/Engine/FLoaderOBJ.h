@@ -33,10 +33,28 @@ struct FManagerOBJ
 public:
     static OBJ::FStaticMeshRenderData* LoadObjStaticMeshAsset(const FString& PathFileName);
 
+    /**
+     * Cook된 파일(Saved/Cooked/<경로>.bin) 또는 OBJ 파일에서 RenderData를 만듭니다.
+     * Texture, Material, GPU 리소스는 만들지 않으므로 Worker Thread에서 호출할 수 있습니다.
+     * Console은 Thread-safe 하지 않으므로, 실패한 이유는 OutErrors에 담아서 호출한 쪽이 메인 스레드에서 출력합니다.
+     */
+    static OBJ::FStaticMeshRenderData* BuildStaticMeshRenderData(const FString& PathFileName, TArray<FString>& OutErrors);
+
+    /** RenderData의 Texture와 Material을 만들고 등록합니다. 메인 스레드에서만 호출합니다. RenderData가 nullptr이면 nullptr를 반환합니다. */
+    static OBJ::FStaticMeshRenderData* RegisterStaticMeshRenderData(const FString& PathFileName, OBJ::FStaticMeshRenderData* RenderData);
+
+    /** RenderData가 사용하는 Texture 파일 경로 */
+    static void GetTexturePaths(const OBJ::FStaticMeshRenderData& RenderData, TArray<FWString>& OutTexturePaths);
+
     static void CombineMaterialIndex(OBJ::FStaticMeshRenderData& OutFStaticMesh);
 
-    static bool SaveStaticMeshToBinary(const FWString& FilePath, const OBJ::FStaticMeshRenderData& StaticMesh);
+    /** StaticMesh를 Cook된 파일로 저장합니다. SourceFiles가 바뀌면 LoadStaticMeshFromBinary가 실패해서 다시 Cook합니다. */
+    static bool SaveStaticMeshToBinary(const FWString& FilePath, const OBJ::FStaticMeshRenderData& StaticMesh, const TArray<FWString>& SourceFiles);
 
+    /**
+     * Cook된 파일을 매핑해서 읽습니다. 파일이 없거나, 버전이 다르거나, 원본이 바뀌었으면 false를 반환합니다.
+     * 정점과 인덱스는 복사하지 않고 OutStaticMesh.CookedFile이 매핑을 유지합니다.
+     */
     static bool LoadStaticMeshFromBinary(const FWString& FilePath, OBJ::FStaticMeshRenderData& OutStaticMesh);
 
     static UMaterial* CreateMaterial(FObjMaterialInfo materialInfo);
@@ -49,12 +67,18 @@ public:
 
     static UStaticMesh* CreateStaticMesh(const FString& filePath);
 
+    /** BuildStaticMeshRenderData로 만든 RenderData를 등록하고 UStaticMesh를 만듭니다. 메인 스레드에서만 호출합니다. 실패하면 nullptr를 반환합니다. */
+    static UStaticMesh* PublishStaticMesh(const FString& PathFileName, OBJ::FStaticMeshRenderData* RenderData);
+
     static const TMap<FWString, UStaticMesh*>& GetStaticMeshes() { return StaticMeshMap; }
 
     static UStaticMesh* GetStaticMesh(FWString name);
 
     static int GetStaticMeshNum() { return StaticMeshMap.Num(); }
 
+private:
+    static UStaticMesh* CreateStaticMeshFromRenderData(OBJ::FStaticMeshRenderData* StaticMeshRenderData);
+
 private:
     inline static TMap<FString, OBJ::FStaticMeshRenderData*> ObjStaticMeshMap;
     inline static TMap<FWString, UStaticMesh*> StaticMeshMap;
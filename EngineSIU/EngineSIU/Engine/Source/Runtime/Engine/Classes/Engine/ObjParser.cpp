@@ -0,0 +1,502 @@
+#include "ObjParser.h"
+
+#include <bit>
+#include <charconv>
+#include <cstring>
+
+#include "Async/JobSystem.h"
+#include "Math/MathUtility.h"
+
+namespace
+{
+    /** OBJ 파일을 나눠서 병렬로 파싱할 때, 한 조각(Chunk)의 파싱 결과 */
+    struct FObjChunk
+    {
+        TArray<FVector> Vertices;
+        TArray<FVector> Normals;
+        TArray<FVector2D> UVs;
+
+        TArray<uint32> VertexIndices;
+        TArray<uint32> NormalIndices;
+        TArray<uint32> UVIndices;
+
+        uint32 NumOfGroup = 0;
+        TArray<FString> GroupName;
+
+        /** IndexStart는 이 Chunk의 VertexIndices 기준입니다. IndexCount는 병합할 때 계산합니다. */
+        TArray<FMaterialSubset> MaterialSubsets;
+
+        bool bHasMatName = false;
+        FString MatName;
+    };
+
+    /** 조각 하나의 최소 크기, 이보다 작은 파일은 나누지 않습니다. */
+    constexpr uint64 MinObjChunkSize = 1024 * 1024;
+
+    /** std::istream이 공백으로 취급하는 문자 */
+    bool IsObjSpace(char C)
+    {
+        return C == ' ' || C == '\t' || C == '\r' || C == '\n' || C == '\v' || C == '\f';
+    }
+
+    void SkipObjSpaces(const char*& Cursor, const char* End)
+    {
+        while (Cursor < End && IsObjSpace(*Cursor))
+        {
+            ++Cursor;
+        }
+    }
+
+    /** 공백으로 구분된 다음 단어를 읽습니다. 단어가 없으면 빈 문자열을 반환합니다. */
+    std::string_view ReadObjWord(const char*& Cursor, const char* End)
+    {
+        SkipObjSpaces(Cursor, End);
+        const char* WordBegin = Cursor;
+        while (Cursor < End && !IsObjSpace(*Cursor))
+        {
+            ++Cursor;
+        }
+        return std::string_view(WordBegin, Cursor - WordBegin);
+    }
+
+    /**
+     * `LineStream >> Value`와 같은 규칙으로 float를 읽습니다.
+     * 실패하면 Value를 0으로 만들고, bFailed가 설정된 이후에는 아무것도 읽지 않습니다.
+     */
+    void ReadObjFloat(const char*& Cursor, const char* End, float& Value, bool& bFailed)
+    {
+        Value = 0.0f;
+        if (bFailed)
+        {
+            return;
+        }
+
+        SkipObjSpaces(Cursor, End);
+        const char* NumberBegin = Cursor;
+        if (NumberBegin < End && *NumberBegin == '+')
+        {
+            ++NumberBegin;
+        }
+
+        const std::from_chars_result Result = std::from_chars(NumberBegin, End, Value);
+        if (Result.ec != std::errc())
+        {
+            Value = 0.0f;
+            bFailed = true;
+            return;
+        }
+        Cursor = Result.ptr;
+    }
+
+    /** `std::stoi(Part) - 1`과 같은 값을 반환합니다. 숫자가 아니면 Default를 반환합니다. */
+    uint32 ParseObjIndex(std::string_view Part, uint32 Default)
+    {
+        const char* Begin = Part.data();
+        const char* End = Begin + Part.size();
+        if (Begin < End && *Begin == '+')
+        {
+            ++Begin;
+        }
+
+        int32 Value = 0;
+        if (std::from_chars(Begin, End, Value).ec != std::errc())
+        {
+            return Default;
+        }
+        return static_cast<uint32>(Value - 1);
+    }
+
+    /** [Begin, End) 범위의 줄들을 파싱합니다. 범위는 항상 줄의 시작에서 시작합니다. */
+    void ParseObjChunk(const char* Begin, const char* End, FObjChunk& OutChunk)
+    {
+        const char* LineBegin = Begin;
+        while (LineBegin < End)
+        {
+            const char* LineEnd = static_cast<const char*>(std::memchr(LineBegin, '\n', End - LineBegin));
+            if (LineEnd == nullptr)
+            {
+                LineEnd = End;
+            }
+
+            const char* Cursor = LineBegin;
+            const std::string_view Line(LineBegin, LineEnd - LineBegin);
+            LineBegin = LineEnd + 1;
+
+            if (Line.empty() || Line[0] == '#')
+                continue;
+
+            const std::string_view Token = ReadObjWord(Cursor, LineEnd);
+
+            // 이름이 없으면 기존 파서처럼 줄 전체가 그대로 남습니다.
+            auto ReadName = [&Cursor, LineEnd, &Line]()
+            {
+                const std::string_view Name = ReadObjWord(Cursor, LineEnd);
+                return std::string(Name.empty() ? Line : Name);
+            };
+
+            if (Token == "v") // Vertex
+            {
+                float X, Y, Z;
+                bool bFailed = false;
+                ReadObjFloat(Cursor, LineEnd, X, bFailed);
+                ReadObjFloat(Cursor, LineEnd, Y, bFailed);
+                ReadObjFloat(Cursor, LineEnd, Z, bFailed);
+                OutChunk.Vertices.Add(FVector(X, Y * -1.f, Z));
+            }
+            else if (Token == "vn") // Normal
+            {
+                float NormalX, NormalY, NormalZ;
+                bool bFailed = false;
+                ReadObjFloat(Cursor, LineEnd, NormalX, bFailed);
+                ReadObjFloat(Cursor, LineEnd, NormalY, bFailed);
+                ReadObjFloat(Cursor, LineEnd, NormalZ, bFailed);
+                OutChunk.Normals.Add(FVector(NormalX, NormalY * -1, NormalZ));
+            }
+            else if (Token == "vt") // Texture
+            {
+                float U, V;
+                bool bFailed = false;
+                ReadObjFloat(Cursor, LineEnd, U, bFailed);
+                ReadObjFloat(Cursor, LineEnd, V, bFailed);
+                OutChunk.UVs.Add(FVector2D(U, 1.f - V));
+            }
+            else if (Token == "f")
+            {
+                uint32 FaceVertexIndices[4];  // 이번 페이스의 정점 인덱스
+                uint32 FaceNormalIndices[4];  // 이번 페이스의 법선 인덱스
+                uint32 FaceUVIndices[4]; // 이번 페이스의 텍스처 인덱스
+                int32 NumFaceVertices = 0;
+
+                for (std::string_view Vertex = ReadObjWord(Cursor, LineEnd); !Vertex.empty(); Vertex = ReadObjWord(Cursor, LineEnd))
+                {
+                    // v/vt/vn, 비어 있는 항목은 기본값을 유지합니다.
+                    uint32 Indices[3] = { 0, UINT32_MAX, UINT32_MAX };
+                    size_t PartBegin = 0;
+                    for (int32 PartIndex = 0; PartIndex < 3 && PartBegin < Vertex.size(); ++PartIndex)
+                    {
+                        size_t PartEnd = Vertex.find('/', PartBegin);
+                        if (PartEnd == std::string_view::npos)
+                        {
+                            PartEnd = Vertex.size();
+                        }
+
+                        if (PartEnd > PartBegin)
+                        {
+                            Indices[PartIndex] = ParseObjIndex(Vertex.substr(PartBegin, PartEnd - PartBegin), Indices[PartIndex]);
+                        }
+                        PartBegin = PartEnd + 1;
+                    }
+
+                    if (NumFaceVertices < 4)
+                    {
+                        FaceVertexIndices[NumFaceVertices] = Indices[0];
+                        FaceUVIndices[NumFaceVertices] = Indices[1];
+                        FaceNormalIndices[NumFaceVertices] = Indices[2];
+                    }
+                    ++NumFaceVertices;
+                }
+
+                auto AddTriangle = [&](int32 A, int32 B, int32 C)
+                {
+                    OutChunk.VertexIndices.Add(FaceVertexIndices[A]);
+                    OutChunk.VertexIndices.Add(FaceVertexIndices[B]);
+                    OutChunk.VertexIndices.Add(FaceVertexIndices[C]);
+
+                    OutChunk.UVIndices.Add(FaceUVIndices[A]);
+                    OutChunk.UVIndices.Add(FaceUVIndices[B]);
+                    OutChunk.UVIndices.Add(FaceUVIndices[C]);
+
+                    OutChunk.NormalIndices.Add(FaceNormalIndices[A]);
+                    OutChunk.NormalIndices.Add(FaceNormalIndices[B]);
+                    OutChunk.NormalIndices.Add(FaceNormalIndices[C]);
+                };
+
+                if (NumFaceVertices == 3) // 삼각형
+                {
+                    // 반시계 방향(오른손 좌표계)을 시계 방향(왼손 좌표계)으로 변환: 0-2-1
+                    AddTriangle(0, 2, 1);
+                }
+                else if (NumFaceVertices == 4) // 쿼드
+                {
+                    // 첫 번째 삼각형: 0-2-1, 두 번째 삼각형: 0-3-2
+                    AddTriangle(0, 2, 1);
+                    AddTriangle(0, 3, 2);
+                }
+            }
+            else if (Token == "mtllib")
+            {
+                OutChunk.MatName = ReadName();
+                OutChunk.bHasMatName = true;
+            }
+            else if (Token == "usemtl")
+            {
+                FMaterialSubset MaterialSubset;
+                MaterialSubset.MaterialName = ReadName();
+                MaterialSubset.IndexStart = OutChunk.VertexIndices.Num();
+                MaterialSubset.IndexCount = 0;
+                OutChunk.MaterialSubsets.Add(MaterialSubset);
+            }
+            else if (Token == "g" || Token == "o")
+            {
+                OutChunk.GroupName.Add(ReadName());
+                OutChunk.NumOfGroup++;
+            }
+        }
+    }
+
+    /** 정점 용접(Welding)에 사용하는 v/vt/vn 인덱스 조합 */
+    struct FObjVertexKey
+    {
+        uint32 VertexIndex;
+        uint32 UVIndex;
+        uint32 NormalIndex;
+
+        bool operator==(const FObjVertexKey& Other) const = default;
+    };
+
+    /**
+     * FObjVertexKey마다 고유 번호를 붙이는 Open Addressing 해시 테이블.
+     * 처음 등록된 Key부터 0, 1, 2... 순서로 번호를 붙이므로 결과가 항상 같습니다.
+     */
+    class FObjVertexKeyTable
+    {
+    public:
+        explicit FObjVertexKeyTable(uint32 ExpectedKeys)
+        {
+            Rehash(FMath::Max(std::bit_ceil(ExpectedKeys * 2), 16u));
+            Keys.Reserve(static_cast<int32>(ExpectedKeys));
+        }
+
+        /** Key의 번호를 반환합니다. 처음 보는 Key이면 새 번호를 붙입니다. */
+        uint32 FindOrAdd(const FObjVertexKey& Key)
+        {
+            uint32 SlotIndex = Hash(Key) & SlotMask;
+            while (true)
+            {
+                FSlot& Slot = Slots[SlotIndex];
+                if (Slot.Id == EmptyId)
+                {
+                    break;
+                }
+                if (Slot.Key == Key)
+                {
+                    return Slot.Id;
+                }
+                SlotIndex = (SlotIndex + 1) & SlotMask;
+            }
+
+            const uint32 NewId = static_cast<uint32>(Keys.Num());
+            Slots[SlotIndex] = { Key, NewId };
+            Keys.Add(Key);
+
+            // 부하율을 50% 이하로 유지합니다.
+            if (static_cast<uint32>(Keys.Num()) * 2 > SlotMask + 1)
+            {
+                Rehash((SlotMask + 1) * 2);
+            }
+            return NewId;
+        }
+
+        /** 번호 순서대로 정렬된 Key */
+        const TArray<FObjVertexKey>& GetKeys() const { return Keys; }
+
+    private:
+        struct FSlot
+        {
+            FObjVertexKey Key;
+            uint32 Id;
+        };
+
+        static constexpr uint32 EmptyId = UINT32_MAX;
+
+        static uint32 Hash(const FObjVertexKey& Key)
+        {
+            uint64 H = Key.VertexIndex * 0x9E3779B97F4A7C15ull;
+            H ^= Key.UVIndex * 0xC2B2AE3D27D4EB4Full;
+            H ^= Key.NormalIndex * 0x165667B19E3779F9ull;
+            return static_cast<uint32>(H ^ (H >> 32));
+        }
+
+        void Rehash(uint32 NumSlots)
+        {
+            SlotMask = NumSlots - 1;
+            Slots.Init({ {}, EmptyId }, static_cast<int32>(NumSlots));
+            for (uint32 Id = 0; Id < static_cast<uint32>(Keys.Num()); ++Id)
+            {
+                uint32 SlotIndex = Hash(Keys[Id]) & SlotMask;
+                while (Slots[SlotIndex].Id != EmptyId)
+                {
+                    SlotIndex = (SlotIndex + 1) & SlotMask;
+                }
+                Slots[SlotIndex] = { Keys[Id], Id };
+            }
+        }
+
+        TArray<FSlot> Slots;
+        TArray<FObjVertexKey> Keys;
+        uint32 SlotMask = 0;
+    };
+
+    /** 이 개수보다 많은 Face Corner를 가진 메시만 여러 스레드로 용접합니다. */
+    constexpr int32 MinParallelWeldCorners = 64 * 1024;
+}
+
+void ObjParser::ParseObjText(const char* Data, uint64 Size, FObjInfo& OutObjInfo)
+{
+    // 줄 경계에 맞춰 내용을 여러 조각으로 나누고, 각 조각을 다른 스레드에서 파싱합니다.
+    const char* FileBegin = Data;
+    const char* FileEnd = FileBegin + Size;
+
+    const uint32 MaxChunks = static_cast<uint32>(FJobSystem::Get().GetMaxConcurrency());
+    const uint32 NumChunks = static_cast<uint32>(FMath::Clamp<uint64>(Size / MinObjChunkSize, 1, MaxChunks));
+
+    TArray<const char*> ChunkBegins;
+    ChunkBegins.Add(FileBegin);
+    for (uint32 ChunkIndex = 1; ChunkIndex < NumChunks; ++ChunkIndex)
+    {
+        const char* Split = FMath::Max(FileBegin + Size * ChunkIndex / NumChunks, ChunkBegins[ChunkBegins.Num() - 1]);
+        const char* NewLine = static_cast<const char*>(std::memchr(Split, '\n', FileEnd - Split));
+        ChunkBegins.Add(NewLine ? NewLine + 1 : FileEnd);
+    }
+    ChunkBegins.Add(FileEnd);
+
+    TArray<FObjChunk> Chunks;
+    Chunks.SetNum(NumChunks);
+    if (FileBegin)
+    {
+        FJobSystem::Get().ParallelFor(static_cast<int32>(NumChunks), 1, [&ChunkBegins, &Chunks](int32 Begin, int32 End, int32)
+        {
+            for (int32 ChunkIndex = Begin; ChunkIndex < End; ++ChunkIndex)
+            {
+                ParseObjChunk(ChunkBegins[ChunkIndex], ChunkBegins[ChunkIndex + 1], Chunks[ChunkIndex]);
+            }
+        });
+    }
+
+    // 파일 순서대로 병합합니다.
+    uint32 NumVertices = 0, NumNormals = 0, NumUVs = 0, NumIndices = 0;
+    for (const FObjChunk& Chunk : Chunks)
+    {
+        NumVertices += Chunk.Vertices.Num();
+        NumNormals += Chunk.Normals.Num();
+        NumUVs += Chunk.UVs.Num();
+        NumIndices += Chunk.VertexIndices.Num();
+    }
+    OutObjInfo.Vertices.Reserve(NumVertices);
+    OutObjInfo.Normals.Reserve(NumNormals);
+    OutObjInfo.UVs.Reserve(NumUVs);
+    OutObjInfo.VertexIndices.Reserve(NumIndices);
+    OutObjInfo.UVIndices.Reserve(NumIndices);
+    OutObjInfo.NormalIndices.Reserve(NumIndices);
+
+    for (FObjChunk& Chunk : Chunks)
+    {
+        for (FMaterialSubset& MaterialSubset : Chunk.MaterialSubsets)
+        {
+            MaterialSubset.IndexStart += OutObjInfo.VertexIndices.Num();
+        }
+        OutObjInfo.MaterialSubsets.Append(std::move(Chunk.MaterialSubsets));
+
+        if (Chunk.bHasMatName)
+        {
+            OutObjInfo.MatName = Chunk.MatName;
+        }
+
+        OutObjInfo.GroupName.Append(std::move(Chunk.GroupName));
+        OutObjInfo.NumOfGroup += Chunk.NumOfGroup;
+
+        OutObjInfo.Vertices.Append(std::move(Chunk.Vertices));
+        OutObjInfo.Normals.Append(std::move(Chunk.Normals));
+        OutObjInfo.UVs.Append(std::move(Chunk.UVs));
+        OutObjInfo.VertexIndices.Append(std::move(Chunk.VertexIndices));
+        OutObjInfo.UVIndices.Append(std::move(Chunk.UVIndices));
+        OutObjInfo.NormalIndices.Append(std::move(Chunk.NormalIndices));
+    }
+
+    // 각 Subset은 다음 Subset이 시작하기 전까지의 인덱스를 가집니다.
+    for (int32 SubsetIndex = 0; SubsetIndex < OutObjInfo.MaterialSubsets.Num(); ++SubsetIndex)
+    {
+        FMaterialSubset& Subset = OutObjInfo.MaterialSubsets[SubsetIndex];
+        const uint32 NextStart = SubsetIndex + 1 < OutObjInfo.MaterialSubsets.Num()
+            ? OutObjInfo.MaterialSubsets[SubsetIndex + 1].IndexStart
+            : OutObjInfo.VertexIndices.Num();
+        Subset.IndexCount = NextStart - Subset.IndexStart;
+    }
+}
+
+uint32 ObjParser::WeldVertexKeys(const FObjInfo& RawData, const TArray<FMaterialSubset>& MaterialSubsets, TArray<uint32>& OutKeyIds)
+{
+    const int32 NumCorners = RawData.VertexIndices.Num();
+    OutKeyIds.SetNum(NumCorners);
+
+    auto GetCornerKey = [&RawData](int32 Corner)
+    {
+        return FObjVertexKey{ RawData.VertexIndices[Corner], RawData.UVIndices[Corner], RawData.NormalIndices[Corner] };
+    };
+
+    // 고유 Key 수는 대부분 v, vt, vn 중 가장 많은 것과 비슷합니다.
+    const uint32 EstimatedKeys = FMath::Min(
+        static_cast<uint32>(NumCorners),
+        static_cast<uint32>(FMath::Max(RawData.Vertices.Num(), FMath::Max(RawData.UVs.Num(), RawData.Normals.Num())))
+    );
+
+    TArray<int32> ChunkStarts;
+    ChunkStarts.Add(0);
+    if (NumCorners >= MinParallelWeldCorners)
+    {
+        for (const FMaterialSubset& Subset : MaterialSubsets)
+        {
+            ChunkStarts.Add(FMath::Min(static_cast<int32>(Subset.IndexStart), NumCorners));
+        }
+        ChunkStarts.Sort();
+    }
+    ChunkStarts.Add(NumCorners);
+    ChunkStarts.GetContainerPrivate().erase(std::unique(ChunkStarts.begin(), ChunkStarts.end()), ChunkStarts.end());
+
+    const int32 NumChunks = ChunkStarts.Num() - 1;
+    if (NumChunks <= 1)
+    {
+        FObjVertexKeyTable Table(EstimatedKeys);
+        for (int32 Corner = 0; Corner < NumCorners; ++Corner)
+        {
+            OutKeyIds[Corner] = Table.FindOrAdd(GetCornerKey(Corner));
+        }
+        return static_cast<uint32>(Table.GetKeys().Num());
+    }
+
+    // 1. 조각마다 독립적으로 지역 번호를 붙입니다.
+    TArray<TArray<FObjVertexKey>> ChunkKeys;
+    ChunkKeys.SetNum(NumChunks);
+
+    FJobSystem::Get().ParallelFor(NumChunks, 1, [&](int32 FirstChunk, int32 LastChunk, int32)
+    {
+        for (int32 Chunk = FirstChunk; Chunk < LastChunk; ++Chunk)
+        {
+            const int32 Begin = ChunkStarts[Chunk];
+            const int32 End = ChunkStarts[Chunk + 1];
+            FObjVertexKeyTable Table(FMath::Min(static_cast<uint32>(End - Begin), EstimatedKeys));
+            for (int32 Corner = Begin; Corner < End; ++Corner)
+            {
+                OutKeyIds[Corner] = Table.FindOrAdd(GetCornerKey(Corner));
+            }
+            ChunkKeys[Chunk] = Table.GetKeys();
+        }
+    });
+
+    // 2. 조각 순서대로 지역 번호를 전역 번호로 바꿉니다. 처음 등장한 순서가 그대로 유지됩니다.
+    FObjVertexKeyTable GlobalTable(EstimatedKeys);
+    TArray<uint32> LocalToGlobal;
+    for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+    {
+        LocalToGlobal.SetNum(ChunkKeys[Chunk].Num());
+        for (int32 LocalId = 0; LocalId < ChunkKeys[Chunk].Num(); ++LocalId)
+        {
+            LocalToGlobal[LocalId] = GlobalTable.FindOrAdd(ChunkKeys[Chunk][LocalId]);
+        }
+        for (int32 Corner = ChunkStarts[Chunk]; Corner < ChunkStarts[Chunk + 1]; ++Corner)
+        {
+            OutKeyIds[Corner] = LocalToGlobal[OutKeyIds[Corner]];
+        }
+    }
+    return static_cast<uint32>(GlobalTable.GetKeys().Num());
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include "Define.h"
+
+/**
+ * OBJ 파일 내용을 FObjInfo로 바꾸고 정점을 용접하는 CPU 단계.
+ * 파일, UObject, GPU 리소스를 건드리지 않으므로 Worker Thread의 Job 안이나 헤드리스 테스트에서도 호출할 수 있습니다.
+ */
+namespace ObjParser
+{
+    /**
+     * 메모리에 있는 OBJ 파일 내용을 파싱해서 OutObjInfo의 정점, 인덱스, Material Subset, Group을 채웁니다.
+     * 큰 파일은 줄 경계에 맞춰 나눈 조각을 FJobSystem::ParallelFor로 파싱한 뒤 파일 순서대로 병합합니다.
+     */
+    void ParseObjText(const char* Data, uint64 Size, FObjInfo& OutObjInfo);
+
+    /**
+     * Face Corner마다 (v, vt, vn) 조합의 고유 번호를 구합니다. 번호는 처음 등장한 순서대로 0부터 붙습니다.
+     * 큰 메시는 Material Subset 단위로 나눠서 각 조각 안의 중복을 병렬로 제거한 뒤, 조각의 고유 Key만 순서대로 전역 번호로 바꿉니다.
+     * @return 고유 Key의 개수
+     */
+    uint32 WeldVertexKeys(const FObjInfo& RawData, const TArray<FMaterialSubset>& MaterialSubsets, TArray<uint32>& OutKeyIds);
+}
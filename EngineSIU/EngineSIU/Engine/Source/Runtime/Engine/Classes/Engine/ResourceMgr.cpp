@@ -7,6 +7,7 @@
 #include "D3D11RHI/GraphicDevice.h"
 #include "DirectXTK/Include/DDSTextureLoader.h"
 #include "Engine/FLoaderOBJ.h"
+#include "Async/JobSystem.h"
 
 
 void FResourceMgr::Initialize(FRenderer* renderer, FGraphicsDevice* device)
@@ -24,17 +25,47 @@ void FResourceMgr::Initialize(FRenderer* renderer, FGraphicsDevice* device)
     //FManagerOBJ::LoadObjStaticMeshAsset("Assets//AxisCircleZ.obj");
     // FManagerOBJ::LoadObjStaticMeshAsset("Assets/helloBlender.obj");
 
-    LoadTextureFromFile(device->Device, device->DeviceContext, L"Assets/Texture/ocean_sky.jpg");
-    LoadTextureFromFile(device->Device, device->DeviceContext, L"Assets/Texture/font.png");
+    const wchar_t* TextureFiles[] = {
+        L"Assets/Texture/ocean_sky.jpg",
+        L"Assets/Texture/font.png",
+        L"Assets/Texture/emart.png",
+        L"Assets/Texture/T_Explosion_SubUV.png",
+        L"Assets/Texture/UUID_Font.png",
+        L"Assets/Texture/Wooden Crate_Crate_BaseColor.png",
+        L"Assets/Texture/spotLight.png",
+        L"Assets/Editor/Icon/SpotLight_64x.png",
+        L"Assets/Editor/Icon/PointLight_64x.png",
+    };
+
+    // 디코딩은 Worker Thread에서 하고, GPU 리소스 생성과 등록은 메인 스레드에서 합니다.
+    int32 NumPending = static_cast<int32>(std::size(TextureFiles));
+    for (const wchar_t* TextureFile : TextureFiles)
+    {
+        FJobSystem::Get().Dispatch([this, device, TextureFile, &NumPending]()
+        {
+            auto Image = std::make_shared<FTextureImage>();
+            const HRESULT hr = DecodeTextureFromFile(TextureFile, *Image);
+            FJobSystem::Get().EnqueueMainThread([this, device, Image, hr, &NumPending]()
+            {
+                if (SUCCEEDED(hr))
+                {
+                    CreateTextureFromImage(device->Device, *Image);
+                }
+                --NumPending;
+            });
+        });
+    }
+
     LoadTextureFromDDS(device->Device, device->DeviceContext, L"Assets/Texture/font.dds");
-    LoadTextureFromFile(device->Device, device->DeviceContext, L"Assets/Texture/emart.png");
-    LoadTextureFromFile(device->Device, device->DeviceContext, L"Assets/Texture/T_Explosion_SubUV.png");
-    LoadTextureFromFile(device->Device, device->DeviceContext, L"Assets/Texture/UUID_Font.png");
     LoadTextureFromDDS(device->Device, device->DeviceContext, L"Assets/Texture/UUID_Font.dds");
-    LoadTextureFromFile(device->Device, device->DeviceContext, L"Assets/Texture/Wooden Crate_Crate_BaseColor.png");
-    LoadTextureFromFile(device->Device, device->DeviceContext, L"Assets/Texture/spotLight.png");
-    LoadTextureFromFile(device->Device, device->DeviceContext, L"Assets/Editor/Icon/SpotLight_64x.png");
-    LoadTextureFromFile(device->Device, device->DeviceContext, L"Assets/Editor/Icon/PointLight_64x.png");
+
+    while (NumPending > 0)
+    {
+        if (FJobSystem::Get().ProcessMainThreadTasks() == 0)
+        {
+            FJobSystem::Get().WaitForMainThreadTasks();
+        }
+    }
 }
 
 void FResourceMgr::Release(FRenderer* renderer) {
@@ -72,47 +103,68 @@ std::shared_ptr<FTexture> FResourceMgr::GetTexture(const FWString& name) const
 }
 
 HRESULT FResourceMgr::LoadTextureFromFile(ID3D11Device* device, ID3D11DeviceContext* context, const wchar_t* filename)
+{
+    FTextureImage Image;
+    HRESULT hr = DecodeTextureFromFile(filename, Image);
+    if (FAILED(hr)) return hr;
+
+    return CreateTextureFromImage(device, Image);
+}
+
+HRESULT FResourceMgr::DecodeTextureFromFile(const wchar_t* filename, FTextureImage& OutImage)
 {
     IWICImagingFactory* wicFactory = nullptr;
     IWICBitmapDecoder* decoder = nullptr;
     IWICBitmapFrameDecode* frame = nullptr;
     IWICFormatConverter* converter = nullptr;
 
-    // WIC 팩토리 생성
+    // WIC는 스레드마다 COM 초기화가 필요합니다.
     HRESULT hr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
     if (FAILED(hr)) return hr;
 
     hr = CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&wicFactory));
-    if (FAILED(hr)) return hr;
-
 
     // 이미지 파일 디코딩
-    hr = wicFactory->CreateDecoderFromFilename(filename, nullptr, GENERIC_READ, WICDecodeMetadataCacheOnLoad, &decoder);
-    if (FAILED(hr)) return hr;
+    if (SUCCEEDED(hr))
+        hr = wicFactory->CreateDecoderFromFilename(filename, nullptr, GENERIC_READ, WICDecodeMetadataCacheOnLoad, &decoder);
 
-
-    hr = decoder->GetFrame(0, &frame);
-    if (FAILED(hr)) return hr;
+    if (SUCCEEDED(hr))
+        hr = decoder->GetFrame(0, &frame);
 
     // WIC 포맷 변환기 생성 (픽셀 포맷 변환)
-    hr = wicFactory->CreateFormatConverter(&converter);
-    if (FAILED(hr)) return hr;
-
-    hr = converter->Initialize(frame, GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom);
-    if (FAILED(hr)) return hr;
+    if (SUCCEEDED(hr))
+        hr = wicFactory->CreateFormatConverter(&converter);
 
-    // 이미지 크기 가져오기
-    UINT width, height;
-    frame->GetSize(&width, &height);
+    if (SUCCEEDED(hr))
+        hr = converter->Initialize(frame, GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom);
 
     // 픽셀 데이터 로드
-    BYTE* imageData = new BYTE[width * height * 4];
-    hr = converter->CopyPixels(nullptr, width * 4, width * height * 4, imageData);
-    if (FAILED(hr)) {
-        delete[] imageData;
-        return hr;
+    if (SUCCEEDED(hr))
+    {
+        UINT width, height;
+        frame->GetSize(&width, &height);
+
+        OutImage.FilePath = filename;
+        OutImage.Width = width;
+        OutImage.Height = height;
+        OutImage.Pixels.SetNum(width * height * 4);
+        hr = converter->CopyPixels(nullptr, width * 4, width * height * 4, OutImage.Pixels.GetData());
     }
 
+    // 리소스 해제
+    if (converter) converter->Release();
+    if (frame) frame->Release();
+    if (decoder) decoder->Release();
+    if (wicFactory) wicFactory->Release();
+
+    return hr;
+}
+
+HRESULT FResourceMgr::CreateTextureFromImage(ID3D11Device* device, const FTextureImage& Image)
+{
+    const UINT width = Image.Width;
+    const UINT height = Image.Height;
+
     // DirectX 11 텍스처 생성
     D3D11_TEXTURE2D_DESC textureDesc = {};
     textureDesc.Width = width;
@@ -125,11 +177,10 @@ HRESULT FResourceMgr::LoadTextureFromFile(ID3D11Device* device, ID3D11DeviceCont
     textureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
 
     D3D11_SUBRESOURCE_DATA initData = {};
-    initData.pSysMem = imageData;
+    initData.pSysMem = Image.Pixels.GetData();
     initData.SysMemPitch = width * 4;
     ID3D11Texture2D* Texture2D;
-    hr = device->CreateTexture2D(&textureDesc, &initData, &Texture2D);
-    delete[] imageData;
+    HRESULT hr = device->CreateTexture2D(&textureDesc, &initData, &Texture2D);
     if (FAILED(hr)) return hr;
 
     // Shader Resource View 생성
@@ -141,12 +192,6 @@ HRESULT FResourceMgr::LoadTextureFromFile(ID3D11Device* device, ID3D11DeviceCont
     ID3D11ShaderResourceView* TextureSRV;
     hr = device->CreateShaderResourceView(Texture2D, &srvDesc, &TextureSRV);
 
-    // 리소스 해제
-    wicFactory->Release();
-    decoder->Release();
-    frame->Release();
-    converter->Release();
-
     //샘플러 스테이트 생성
     ID3D11SamplerState* SamplerState;
     D3D11_SAMPLER_DESC samplerDesc = {};
@@ -159,7 +204,7 @@ HRESULT FResourceMgr::LoadTextureFromFile(ID3D11Device* device, ID3D11DeviceCont
     samplerDesc.MaxLOD = D3D11_FLOAT32_MAX;
 
     device->CreateSamplerState(&samplerDesc, &SamplerState);
-    FWString name = FWString(filename);
+    const FWString& name = Image.FilePath;
 
     textureMap[name] = std::make_shared<FTexture>(TextureSRV, Texture2D, SamplerState, name, width, height);
 
@@ -1,10 +1,21 @@
 #pragma once
 #include <memory>
 #include "Texture.h"
+#include "Container/Array.h"
 #include "Container/Map.h"
 
 class FRenderer;
 class FGraphicsDevice;
+
+/** 파일에서 읽어서 RGBA8로 변환한 이미지. GPU 리소스가 없으므로 Worker Thread에서 만들 수 있습니다. */
+struct FTextureImage
+{
+    FWString FilePath;
+    uint32 Width = 0;
+    uint32 Height = 0;
+    TArray<uint8> Pixels;
+};
+
 class FResourceMgr
 {
 
@@ -12,6 +23,13 @@ public:
     void Initialize(FRenderer* renderer, FGraphicsDevice* device);
     void Release(FRenderer* renderer);
     HRESULT LoadTextureFromFile(ID3D11Device* device, ID3D11DeviceContext* context, const wchar_t* filename);
+
+    /** 이미지 파일을 디코딩합니다. textureMap을 건드리지 않으므로 어느 스레드에서나 호출할 수 있습니다. */
+    static HRESULT DecodeTextureFromFile(const wchar_t* filename, FTextureImage& OutImage);
+
+    /** 디코딩한 이미지로 텍스처를 만들어서 등록합니다. 메인 스레드에서만 호출합니다. */
+    HRESULT CreateTextureFromImage(ID3D11Device* device, const FTextureImage& Image);
+
     HRESULT LoadTextureFromDDS(ID3D11Device* device, ID3D11DeviceContext* context, const wchar_t* filename);
 
     std::shared_ptr<FTexture> GetTexture(const FWString& name) const;
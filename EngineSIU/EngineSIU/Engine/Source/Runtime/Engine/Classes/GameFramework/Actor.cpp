@@ -1,65 +1,57 @@
 #include "Actor.h"
+#include "UObject/ObjectDuplication.h"
 #include "World/World.h"
 
 
-UObject* AActor::Duplicate(UObject* InOuter)
+AActor::AActor()
 {
-    ThisClass* NewActor = Cast<ThisClass>(Super::Duplicate(InOuter));
-
-    NewActor->Owner = Owner;
-    NewActor->bTickInEditor = bTickInEditor;
-    // 기본적으로 있던 컴포넌트 제거
-    TSet CopiedComponents = NewActor->OwnedComponents;
-    for (UActorComponent* Components : CopiedComponents)
-    {
-        Components->DestroyComponent();
-    }
-    NewActor->OwnedComponents.Empty();
+    PrimaryActorTick.Target = this;
+}
 
+void AActor::DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator)
+{
+    Super::DuplicateFrom(Source, Duplicator);
 
-    // 부모-자식 관계 저장용 맵
-    TMap<USceneComponent*, USceneComponent*> ParentChildMap;
+    const AActor* SourceActor = static_cast<const AActor*>(Source);
 
-    // 컴포넌트 복제 및 부모-자식 관계 추적
-    TMap<USceneComponent*, USceneComponent*> OriginalToDuplicateMap; // 원본 -> 복제된 컴포넌트 매핑
+    // 선행 Tick은 다른 Actor를 가리키므로 복제하지 않습니다.
+    PrimaryActorTick.TickGroup = SourceActor->PrimaryActorTick.TickGroup;
+    PrimaryActorTick.bCanEverTick = SourceActor->PrimaryActorTick.bCanEverTick;
+    PrimaryActorTick.bRunOnAnyThread = SourceActor->PrimaryActorTick.bRunOnAnyThread;
 
-    for (UActorComponent* Component : OwnedComponents)
+    // 생성자에서 만든 기본 컴포넌트는 클래스가 같은 원본 컴포넌트의 복제본으로 재사용합니다.
+    // 컴포넌트를 가리키는 UPROPERTY는 Duplicator가 원본을 따라 다시 채우므로, 같은 클래스 중 어느 것과 짝지어도 됩니다.
+    TArray<UActorComponent*> DefaultComponents = OwnedComponents.Array();
+    for (UActorComponent* Component : SourceActor->OwnedComponents)
     {
-        UActorComponent* NewComponent = Cast<UActorComponent>(Component->Duplicate(InOuter));
-        NewComponent->OwnerPrivate = NewActor;
-        NewActor->OwnedComponents.Add(NewComponent);
-
-        // RootComponent 설정
-        if (RootComponent == Component)
-        {
-            NewActor->RootComponent = static_cast<USceneComponent*>(NewComponent);
-        }
-
-        // 부모-자식 관계 저장 (USceneComponent만 해당)
-        if (USceneComponent* SceneComp = Cast<USceneComponent>(Component))
+        UActorComponent* NewComponent = nullptr;
+        for (int32 Index = 0; Index < DefaultComponents.Num(); ++Index)
         {
-            OriginalToDuplicateMap.Add(SceneComp, static_cast<USceneComponent*>(NewComponent));
-            if (USceneComponent* ParentComp = SceneComp->GetAttachParent())
+            if (DefaultComponents[Index]->GetClass() == Component->GetClass())
             {
-                ParentChildMap.Add(static_cast<USceneComponent*>(NewComponent), ParentComp);
+                NewComponent = DefaultComponents[Index];
+                DefaultComponents.RemoveAtSwap(Index);
+                break;
             }
         }
 
-        // 컴포넌트 초기화
-        NewComponent->InitializeComponent();
-    }
-
-    // 부모-자식 관계 복원
-    for (const auto& [ChildComp, OriginalParentComp] : ParentChildMap)
-    {
-        // 복제된 부모를 찾아 설정
-        if (USceneComponent** NewParentComp = OriginalToDuplicateMap.Find(OriginalParentComp))
+        if (NewComponent)
+        {
+            Duplicator.DuplicateInto(Component, NewComponent);
+        }
+        else
         {
-            ChildComp->AttachToComponent(*NewParentComp);
+            NewComponent = Duplicator.DuplicateObject(Component, this);
+            NewComponent->OwnerPrivate = this;
+            OwnedComponents.Add(NewComponent);
         }
     }
 
-    return NewActor;
+    // 원본에 없는 기본 컴포넌트 제거
+    for (UActorComponent* Component : DefaultComponents)
+    {
+        Component->DestroyComponent();
+    }
 }
 
 void AActor::BeginPlay()
@@ -75,13 +67,22 @@ void AActor::BeginPlay()
 void AActor::Tick(float DeltaTime)
 {
     // TODO: 임시로 Actor에서 Tick 돌리기
-    // TODO: 나중에 삭제를 Pending으로 하던가 해서 복사비용 줄이기
-    const auto CopyComponents = OwnedComponents;
+    // Tick 중에 컴포넌트가 추가/제거될 수 있으므로 목록을 복사해서 돌립니다.
+    // 여러 스레드에서 Actor를 Tick하므로 복사할 배열은 스레드마다 두고 재사용합니다.
+    static thread_local TArray<UActorComponent*> TickingComponents;
 
-    for (UActorComponent* Comp : CopyComponents)
+    const int32 Begin = TickingComponents.Num();
+    for (UActorComponent* Comp : OwnedComponents)
     {
-        Comp->TickComponent(DeltaTime);
+        TickingComponents.Add(Comp);
     }
+    const int32 End = TickingComponents.Num();
+
+    for (int32 Index = Begin; Index < End; ++Index)
+    {
+        TickingComponents[Index]->TickComponent(DeltaTime);
+    }
+    TickingComponents.SetNum(Begin);
 }
 
 void AActor::Destroyed()
@@ -107,6 +108,13 @@ bool AActor::Destroy()
 {
     if (!IsActorBeingDestroyed())
     {
+        // Worker에서는 World를 수정할 수 없으므로 Tick 그룹이 끝난 뒤 메인 스레드에서 다시 호출합니다.
+        if (FTickTaskManager::IsInParallelTick())
+        {
+            FTickTaskManager::Get().EnqueueCommand([this] { Destroy(); });
+            return true;
+        }
+
         if (UWorld* World = GetWorld())
         {
             World->DestroyActor(this);
@@ -269,3 +277,19 @@ void AActor::SetActorTickInEditor(bool InbInTickInEditor)
 {
     bTickInEditor = InbInTickInEditor;
 }
+
+void AActor::AddTickPrerequisiteActor(AActor* PrerequisiteActor)
+{
+    if (PrerequisiteActor && PrerequisiteActor != this)
+    {
+        PrimaryActorTick.AddPrerequisite(PrerequisiteActor->PrimaryActorTick);
+    }
+}
+
+void AActor::RemoveTickPrerequisiteActor(AActor* PrerequisiteActor)
+{
+    if (PrerequisiteActor)
+    {
+        PrimaryActorTick.RemovePrerequisite(PrerequisiteActor->PrimaryActorTick);
+    }
+}
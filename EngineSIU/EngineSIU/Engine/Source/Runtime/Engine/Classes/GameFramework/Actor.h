@@ -6,6 +6,7 @@
 #include "UObject/Object.h"
 #include "UObject/ObjectFactory.h"
 #include "UObject/ObjectMacros.h"
+#include "World/TickTaskManager.h"
 
 
 class UActorComponent;
@@ -15,14 +16,18 @@ class AActor : public UObject
     DECLARE_CLASS(AActor, UObject)
 
 public:
-    AActor() = default;
+    AActor();
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) override;
 
     /** Actor가 게임에 배치되거나 스폰될 때 호출됩니다. */
     virtual void BeginPlay();
 
-    /** 매 Tick마다 호출됩니다. */
+    /**
+     * 매 Tick마다 호출되며, 소유한 컴포넌트의 TickComponent도 함께 호출합니다.
+     * 다른 Actor와 병렬로 실행될 수 있으므로 다른 Actor를 수정하려면 PrimaryActorTick의 선행 Tick을 지정하거나
+     * bRunOnAnyThread를 false로 설정해야 합니다.
+     */
     virtual void Tick(float DeltaTime);
 
     /** Actor가 제거될 때 호출됩니다. */
@@ -37,7 +42,7 @@ public:
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason);
 
 public:
-    /** 이 Actor를 제거합니다. */
+    /** 이 Actor를 제거합니다. 병렬 Tick 중이면 현재 Tick 그룹이 끝난 뒤에 제거합니다. */
     virtual bool Destroy();
 
     /** 현재 Actor가 제거중인지 여부를 반환합니다. */
@@ -118,17 +123,25 @@ public:
     void SetActorLabel(const FString& NewActorLabel, bool bUUID = true);
 
 private:
-    /** 에디터상에 보이는 Actor의 이름 */
-    UPROPERTY
-    (FString, ActorLabel)
+    /** 에디터상에 보이는 Actor의 이름. 복제된 Actor는 새 Label을 받습니다. */
+    UPROPERTY_WITH_FLAGS
+    (CPF_DuplicateTransient, FString, ActorLabel)
 #endif
 
 public:
     bool IsActorTickInEditor() const { return bTickInEditor; }
     void SetActorTickInEditor(bool InbInTickInEditor);
 
+    /** PrerequisiteActor의 Tick이 끝난 뒤에 이 Actor가 Tick되도록 합니다. */
+    void AddTickPrerequisiteActor(AActor* PrerequisiteActor);
+    void RemoveTickPrerequisiteActor(AActor* PrerequisiteActor);
+
+    /** FTickTaskManager가 실행하는 이 Actor의 Tick. 그룹과 실행 스레드를 설정합니다. */
+    FActorTickFunction PrimaryActorTick;
+
 private:
-    bool bTickInEditor = false;
+    UPROPERTY
+    (bool, bTickInEditor, = false)
 
 };
 
@@ -1,6 +1,7 @@
 #include "Level.h"
 #include "GameFramework/Actor.h"
 #include "UObject/Casts.h"
+#include "UObject/ObjectDuplication.h"
 
 
 void ULevel::InitLevel(UWorld* InOwningWorld)
@@ -26,16 +27,17 @@ void ULevel::Release()
     Actors.Empty();
 }
 
-UObject* ULevel::Duplicate(UObject* InOuter)
+void ULevel::DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator)
 {
-    ThisClass* NewLevel = Cast<ThisClass>(Super::Duplicate(InOuter));
+    Super::DuplicateFrom(Source, Duplicator);
 
-    NewLevel->OwningWorld = OwningWorld;
+    const ULevel* SourceLevel = static_cast<const ULevel*>(Source);
+    OwningWorld = SourceLevel->OwningWorld;
 
-    for (AActor* Actor : Actors)
+    // Actor는 Level이 아니라 World를 Outer로 가집니다.
+    Actors.Reserve(SourceLevel->Actors.Num());
+    for (AActor* Actor : SourceLevel->Actors)
     {
-        NewLevel->Actors.Emplace(static_cast<AActor*>(Actor->Duplicate(InOuter)));
+        Actors.Add(Duplicator.DuplicateObject(Actor, GetOuter()));
     }
-
-    return NewLevel;
 }
@@ -16,7 +16,7 @@ public:
     void InitLevel(UWorld* InOwningWorld);
     void Release();
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) override;
 
     TArray<AActor*> Actors;
     UWorld* OwningWorld;
@@ -3,6 +3,12 @@
 #include <cstdio>
 
 #include "UnrealEd/EditorViewportClient.h"
+#include "Renderer/StaticMeshRenderPass.h"
+#include "HAL/PlatformTime.h"
+#include "Stats/StatsData.h"
+#include "UObject/UObjectAllocator.h"
+#include <algorithm>
+#include <ctime>
 
 
 void StatOverlay::ToggleStat(const std::string& command)
@@ -17,10 +23,48 @@ void StatOverlay::ToggleStat(const std::string& command)
         showMemory = true;
         showRender = true;
     }
+    else if (command == "stat culling")
+    {
+        showCulling = true;
+        showRender = true;
+    }
+    else if (command == "stat draw")
+    {
+        showDraw = true;
+        showRender = true;
+    }
+    else if (command == "stat cycles")
+    {
+        showCycles = true;
+        showRender = true;
+    }
+    else if (command == "stat startfile")
+    {
+        FStatsThreadState::Get().StartTraceCapture();
+        UE_LOG(LogLevel::Display, "Stat trace capture started");
+    }
+    else if (command == "stat stopfile")
+    {
+        char FileName[64];
+        const std::time_t Now = std::time(nullptr);
+        std::strftime(FileName, sizeof(FileName), "Saved/Profiling/StatTrace_%Y%m%d-%H%M%S.json", std::localtime(&Now));
+
+        if (FStatsThreadState::Get().StopTraceCapture(FileName))
+        {
+            UE_LOG(LogLevel::Display, "Stat trace saved: %s", FileName);
+        }
+        else
+        {
+            UE_LOG(LogLevel::Error, "Failed to save stat trace: %s", FileName);
+        }
+    }
     else if (command == "stat none")
     {
         showFPS = false;
         showMemory = false;
+        showCulling = false;
+        showDraw = false;
+        showCycles = false;
         showRender = false;
     }
 }
@@ -65,15 +109,102 @@ void StatOverlay::Render(ID3D11DeviceContext* context, UINT width, UINT height)
 
     if (showMemory)
     {
-        ImGui::Text("Allocated Object Count: %llu", FPlatformMemory::GetAllocationCount<EAT_Object>());
-        ImGui::Text("Allocated Object Memory: %llu B", FPlatformMemory::GetAllocationBytes<EAT_Object>());
+        const FUObjectAllocatorStats& ObjectStats = FUObjectAllocator::Get().GetStats();
+        ImGui::Text("Allocated Object Count: %llu", ObjectStats.NumLiveObjects);
+        ImGui::Text("Allocated Object Memory: %llu B", ObjectStats.LiveBytes);
+        ImGui::Text("Object Pool Slabs: %u (%llu B)", ObjectStats.NumSlabs, ObjectStats.SlabBytes);
+        ImGui::Text("Object Heap Memory: %llu B", FPlatformMemory::GetAllocationBytes<EAT_Object>());
         ImGui::Text("Allocated Container Count: %llu", FPlatformMemory::GetAllocationCount<EAT_Container>());
         ImGui::Text("Allocated Container memory: %llu B", FPlatformMemory::GetAllocationBytes<EAT_Container>());
     }
+
+    if (showCulling)
+    {
+        const FCullingStats& CullingStats = FEngineLoop::Renderer.StaticMeshRenderPass->GetCullingStats();
+        ImGui::Text("Primitive Visible: %u", CullingStats.NumVisible);
+        ImGui::Text("Primitive Culled: %u", CullingStats.NumCulled);
+    }
+
+    if (showDraw)
+    {
+        const FMeshDrawStats& DrawStats = FEngineLoop::Renderer.StaticMeshRenderPass->GetDrawStats();
+        ImGui::Text("Mesh Draw Packets: %u", DrawStats.NumPackets);
+        ImGui::Text("Mesh Draw Calls: %u", DrawStats.NumDraws);
+        ImGui::Text("Mesh Instances: %u", DrawStats.NumInstances);
+        ImGui::Text("Mesh State Changes: %u", DrawStats.NumStateChanges);
+        ImGui::Text("Constant Buffer Uploads: %u", DrawStats.NumConstantBufferUploads);
+    }
+
+    if (showCycles)
+    {
+        RenderCycleStats();
+    }
     ImGui::PopStyleColor();
     ImGui::End();
 }
 
+void StatOverlay::RenderCycleStats() const
+{
+    constexpr uint32 MaxTreeDepth = 5;
+    constexpr int32 MaxSummaries = 12;
+
+    const FStatsThreadState& Stats = FStatsThreadState::Get();
+
+    ImGui::Text("Cycle Stats (Frame %llu, Dropped Events %llu)", Stats.GetNumFrames(), Stats.GetNumDroppedEvents());
+    if (Stats.IsCapturingTrace())
+    {
+        ImGui::SameLine();
+        ImGui::Text("[Capturing]");
+    }
+
+    for (const FStatThreadTree& Tree : Stats.GetLastFrameTrees())
+    {
+        if (Tree.ThreadIndex != Stats.GetMainThreadIndex())
+        {
+            continue;
+        }
+
+        // 루트부터 깊이 우선으로 그립니다. 형제 순서를 유지하려고 자식을 역순으로 쌓습니다.
+        TArray<int32> NodeStack;
+        auto PushChildren = [&Tree, &NodeStack](int32 ParentIndex)
+        {
+            const int32 FirstSlot = NodeStack.Num();
+            for (int32 Child = Tree.Nodes[ParentIndex].FirstChild; Child != INDEX_NONE; Child = Tree.Nodes[Child].NextSibling)
+            {
+                NodeStack.Add(Child);
+            }
+            std::reverse(NodeStack.GetData() + FirstSlot, NodeStack.GetData() + NodeStack.Num());
+        };
+
+        PushChildren(0);
+        while (NodeStack.Num() > 0)
+        {
+            const int32 NodeIndex = NodeStack.Pop();
+            const FStatCallNode& Node = Tree.Nodes[NodeIndex];
+            ImGui::Text("%*s%s  %.3f ms  x%u", Node.Depth * 2, "", *FStatRegistry::GetStatName(Node.StatIndex).ToString(),
+                FPlatformTime::ToMilliseconds(Node.InclusiveCycles), Node.CallCount);
+
+            if (Node.Depth >= MaxTreeDepth)
+            {
+                continue;
+            }
+
+            PushChildren(NodeIndex);
+        }
+    }
+
+    ImGui::Separator();
+    ImGui::Text("%-32s %8s %8s %8s %6s", "Stat", "Min", "Avg", "Max", "Calls");
+
+    TArray<FStatSummary> Summaries;
+    Stats.GetSummaries(Summaries);
+    for (int32 i = 0; i < Summaries.Num() && i < MaxSummaries; ++i)
+    {
+        const FStatSummary& Summary = Summaries[i];
+        ImGui::Text("%-32s %8.3f %8.3f %8.3f %6u", *Summary.Name.ToString(), Summary.MinMs, Summary.AvgMs, Summary.MaxMs, Summary.LastCallCount);
+    }
+}
+
 float StatOverlay::CalculateFPS() const
 {
     static int frameCount = 0;
@@ -248,6 +379,10 @@ void Console::ExecuteCommand(const std::string& command)
         AddLog(LogLevel::Display, " - help: Shows available commands");
         AddLog(LogLevel::Display, " - stat fps: Toggle FPS display");
         AddLog(LogLevel::Display, " - stat memory: Toggle Memory display");
+        AddLog(LogLevel::Display, " - stat culling: Toggle Frustum Culling display");
+        AddLog(LogLevel::Display, " - stat draw: Toggle Static Mesh draw call display");
+        AddLog(LogLevel::Display, " - stat cycles: Toggle QUICK_SCOPE_CYCLE_COUNTER call tree display");
+        AddLog(LogLevel::Display, " - stat startfile / stat stopfile: Capture stats to a Chrome trace JSON");
         AddLog(LogLevel::Display, " - stat none: Hide all stat overlays");
     }
     else if (command.starts_with("stat ")) { // stat 명령어 처리
@@ -265,4 +400,3 @@ void Console::OnResize(HWND hWnd)
     width = clientRect.right - clientRect.left;
     height = clientRect.bottom - clientRect.top;
 }
-
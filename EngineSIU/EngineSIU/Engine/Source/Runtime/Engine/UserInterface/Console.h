@@ -21,6 +21,9 @@ class StatOverlay
 public:
     bool showFPS = false;
     bool showMemory = false;
+    bool showCulling = false;
+    bool showDraw = false;
+    bool showCycles = false;
     bool showRender = false;
 
     void ToggleStat(const std::string& command);
@@ -29,6 +32,9 @@ public:
 private:
     float CalculateFPS() const;
 
+    /** QUICK_SCOPE_CYCLE_COUNTER로 모은 메인 스레드 Call Tree와 Stat별 Min/Avg/Max를 그립니다. */
+    void RenderCycleStats() const;
+
     void DrawTextOverlay(const std::string& text, int x, int y) const;
 };
 
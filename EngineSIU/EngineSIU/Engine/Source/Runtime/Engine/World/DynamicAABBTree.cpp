@@ -0,0 +1,355 @@
+#include "DynamicAABBTree.h"
+
+namespace
+{
+    /** Fat AABB의 여유 공간 비율 (Bounds 크기 대비) */
+    constexpr float FatBoundsRatio = 0.1f;
+
+    /** Fat AABB의 최소 여유 공간 */
+    constexpr float FatBoundsMinMargin = 0.1f;
+}
+
+FDynamicAABBTree::FDynamicAABBTree()
+{
+    Nodes.Reserve(16);
+}
+
+int32 FDynamicAABBTree::CreateProxy(const FBoundingBox& Bounds, void* UserData)
+{
+    const int32 ProxyId = AllocateNode();
+    FNode& Node = Nodes[ProxyId];
+    Node.Bounds = MakeFat(Bounds);
+    Node.UserData = UserData;
+    Node.Height = 0;
+
+    InsertLeaf(ProxyId);
+    ++NumProxies;
+    return ProxyId;
+}
+
+void FDynamicAABBTree::DestroyProxy(int32 ProxyId)
+{
+    assert(0 <= ProxyId && ProxyId < Nodes.Num());
+    assert(Nodes[ProxyId].IsLeaf());
+
+    RemoveLeaf(ProxyId);
+    FreeNode(ProxyId);
+    --NumProxies;
+}
+
+bool FDynamicAABBTree::MoveProxy(int32 ProxyId, const FBoundingBox& Bounds)
+{
+    assert(0 <= ProxyId && ProxyId < Nodes.Num());
+    assert(Nodes[ProxyId].IsLeaf());
+
+    const FBoundingBox& FatBounds = Nodes[ProxyId].Bounds;
+    if (Contains(FatBounds, Bounds))
+    {
+        // Bounds가 크게 줄어든 경우에는 Fat AABB가 너무 커지지 않도록 다시 삽입합니다.
+        const FBoundingBox NewFatBounds = MakeFat(Bounds);
+        const FVector Margin = (NewFatBounds.max - NewFatBounds.min) * 2.0f;
+        const FBoundingBox LargeBounds(NewFatBounds.min - Margin, NewFatBounds.max + Margin);
+        if (Contains(LargeBounds, FatBounds))
+        {
+            return false;
+        }
+    }
+
+    RemoveLeaf(ProxyId);
+    Nodes[ProxyId].Bounds = MakeFat(Bounds);
+    InsertLeaf(ProxyId);
+    return true;
+}
+
+void FDynamicAABBTree::Empty()
+{
+    Nodes.Empty();
+    Root = INDEX_NONE;
+    FreeList = INDEX_NONE;
+    NumProxies = 0;
+}
+
+int32 FDynamicAABBTree::AllocateNode()
+{
+    if (FreeList == INDEX_NONE)
+    {
+        const int32 NodeId = Nodes.Num();
+        Nodes.Add(FNode());
+        return NodeId;
+    }
+
+    const int32 NodeId = FreeList;
+    FreeList = Nodes[NodeId].ParentOrNext;
+    Nodes[NodeId] = FNode();
+    return NodeId;
+}
+
+void FDynamicAABBTree::FreeNode(int32 NodeId)
+{
+    FNode& Node = Nodes[NodeId];
+    Node.UserData = nullptr;
+    Node.Child1 = INDEX_NONE;
+    Node.Child2 = INDEX_NONE;
+    Node.Height = -1;
+    Node.ParentOrNext = FreeList;
+    FreeList = NodeId;
+}
+
+void FDynamicAABBTree::InsertLeaf(int32 LeafId)
+{
+    if (Root == INDEX_NONE)
+    {
+        Root = LeafId;
+        Nodes[Root].ParentOrNext = INDEX_NONE;
+        return;
+    }
+
+    // 표면적 비용이 가장 작아지는 형제 노드를 찾습니다.
+    const FBoundingBox LeafBounds = Nodes[LeafId].Bounds;
+    int32 Index = Root;
+    while (!Nodes[Index].IsLeaf())
+    {
+        const FNode& Node = Nodes[Index];
+        const int32 Child1 = Node.Child1;
+        const int32 Child2 = Node.Child2;
+
+        const float Area = SurfaceArea(Node.Bounds);
+        const float CombinedArea = SurfaceArea(Union(Node.Bounds, LeafBounds));
+
+        // 이 노드와 Leaf를 묶어 새 부모를 만드는 비용
+        const float Cost = 2.0f * CombinedArea;
+
+        // 더 아래로 내려갈 때 조상들이 커지는 비용
+        const float InheritanceCost = 2.0f * (CombinedArea - Area);
+
+        auto DescendCost = [&](int32 Child)
+        {
+            const FBoundingBox ChildUnion = Union(LeafBounds, Nodes[Child].Bounds);
+            if (Nodes[Child].IsLeaf())
+            {
+                return SurfaceArea(ChildUnion) + InheritanceCost;
+            }
+            return SurfaceArea(ChildUnion) - SurfaceArea(Nodes[Child].Bounds) + InheritanceCost;
+        };
+
+        const float Cost1 = DescendCost(Child1);
+        const float Cost2 = DescendCost(Child2);
+
+        if (Cost < Cost1 && Cost < Cost2)
+        {
+            break;
+        }
+
+        Index = Cost1 < Cost2 ? Child1 : Child2;
+    }
+
+    const int32 Sibling = Index;
+
+    // 새 부모를 만들고 Sibling과 Leaf를 자식으로 붙입니다.
+    const int32 OldParent = Nodes[Sibling].ParentOrNext;
+    const int32 NewParent = AllocateNode();
+    {
+        FNode& ParentNode = Nodes[NewParent];
+        ParentNode.ParentOrNext = OldParent;
+        ParentNode.Bounds = Union(LeafBounds, Nodes[Sibling].Bounds);
+        ParentNode.Height = Nodes[Sibling].Height + 1;
+        ParentNode.Child1 = Sibling;
+        ParentNode.Child2 = LeafId;
+    }
+
+    if (OldParent != INDEX_NONE)
+    {
+        if (Nodes[OldParent].Child1 == Sibling)
+        {
+            Nodes[OldParent].Child1 = NewParent;
+        }
+        else
+        {
+            Nodes[OldParent].Child2 = NewParent;
+        }
+    }
+    else
+    {
+        Root = NewParent;
+    }
+    Nodes[Sibling].ParentOrNext = NewParent;
+    Nodes[LeafId].ParentOrNext = NewParent;
+
+    RefitAncestors(NewParent);
+}
+
+void FDynamicAABBTree::RemoveLeaf(int32 LeafId)
+{
+    if (LeafId == Root)
+    {
+        Root = INDEX_NONE;
+        return;
+    }
+
+    const int32 Parent = Nodes[LeafId].ParentOrNext;
+    const int32 GrandParent = Nodes[Parent].ParentOrNext;
+    const int32 Sibling = Nodes[Parent].Child1 == LeafId ? Nodes[Parent].Child2 : Nodes[Parent].Child1;
+
+    if (GrandParent != INDEX_NONE)
+    {
+        // 부모를 없애고 Sibling을 조부모에 연결합니다.
+        if (Nodes[GrandParent].Child1 == Parent)
+        {
+            Nodes[GrandParent].Child1 = Sibling;
+        }
+        else
+        {
+            Nodes[GrandParent].Child2 = Sibling;
+        }
+        Nodes[Sibling].ParentOrNext = GrandParent;
+        FreeNode(Parent);
+
+        RefitAncestors(GrandParent);
+    }
+    else
+    {
+        Root = Sibling;
+        Nodes[Sibling].ParentOrNext = INDEX_NONE;
+        FreeNode(Parent);
+    }
+}
+
+void FDynamicAABBTree::RefitAncestors(int32 NodeId)
+{
+    int32 Index = NodeId;
+    while (Index != INDEX_NONE)
+    {
+        Index = Balance(Index);
+
+        FNode& Node = Nodes[Index];
+        const FNode& Child1 = Nodes[Node.Child1];
+        const FNode& Child2 = Nodes[Node.Child2];
+        Node.Height = 1 + FMath::Max(Child1.Height, Child2.Height);
+        Node.Bounds = Union(Child1.Bounds, Child2.Bounds);
+
+        Index = Node.ParentOrNext;
+    }
+}
+
+int32 FDynamicAABBTree::Balance(int32 NodeId)
+{
+    // A가 불균형한 노드일 때, 더 높은 자식(B 또는 C)을 A의 자리로 올립니다.
+    const int32 IndexA = NodeId;
+    const FNode& NodeA = Nodes[IndexA];
+    if (NodeA.IsLeaf() || NodeA.Height < 2)
+    {
+        return IndexA;
+    }
+
+    const int32 IndexB = NodeA.Child1;
+    const int32 IndexC = NodeA.Child2;
+    const int32 HeightDiff = Nodes[IndexC].Height - Nodes[IndexB].Height;
+
+    auto Rotate = [this, IndexA](int32 IndexUp, int32 IndexDown) -> int32
+    {
+        // IndexUp(자식)을 A의 자리로 올리고, A는 IndexUp의 자식이 됩니다.
+        FNode& A = Nodes[IndexA];
+        FNode& Up = Nodes[IndexUp];
+        const int32 IndexF = Up.Child1;
+        const int32 IndexG = Up.Child2;
+
+        Up.Child1 = IndexA;
+        Up.ParentOrNext = A.ParentOrNext;
+        A.ParentOrNext = IndexUp;
+
+        if (Up.ParentOrNext != INDEX_NONE)
+        {
+            FNode& OldParent = Nodes[Up.ParentOrNext];
+            if (OldParent.Child1 == IndexA)
+            {
+                OldParent.Child1 = IndexUp;
+            }
+            else
+            {
+                OldParent.Child2 = IndexUp;
+            }
+        }
+        else
+        {
+            Root = IndexUp;
+        }
+
+        // F, G 중 높은 쪽은 Up에 남기고, 낮은 쪽은 A로 내려 보냅니다.
+        const int32 KeepIndex = Nodes[IndexF].Height > Nodes[IndexG].Height ? IndexF : IndexG;
+        const int32 MoveIndex = KeepIndex == IndexF ? IndexG : IndexF;
+
+        Up.Child2 = KeepIndex;
+        if (A.Child1 == IndexUp)
+        {
+            A.Child1 = MoveIndex;
+        }
+        else
+        {
+            A.Child2 = MoveIndex;
+        }
+        Nodes[MoveIndex].ParentOrNext = IndexA;
+
+        const FNode& Down = Nodes[IndexDown];
+        const FNode& Moved = Nodes[MoveIndex];
+        A.Bounds = Union(Down.Bounds, Moved.Bounds);
+        A.Height = 1 + FMath::Max(Down.Height, Moved.Height);
+
+        Up.Bounds = Union(A.Bounds, Nodes[KeepIndex].Bounds);
+        Up.Height = 1 + FMath::Max(A.Height, Nodes[KeepIndex].Height);
+        return IndexUp;
+    };
+
+    if (HeightDiff > 1)
+    {
+        return Rotate(IndexC, IndexB);
+    }
+    if (HeightDiff < -1)
+    {
+        return Rotate(IndexB, IndexC);
+    }
+    return IndexA;
+}
+
+FBoundingBox FDynamicAABBTree::Union(const FBoundingBox& A, const FBoundingBox& B)
+{
+    return FBoundingBox(
+        FVector(FMath::Min(A.min.X, B.min.X), FMath::Min(A.min.Y, B.min.Y), FMath::Min(A.min.Z, B.min.Z)),
+        FVector(FMath::Max(A.max.X, B.max.X), FMath::Max(A.max.Y, B.max.Y), FMath::Max(A.max.Z, B.max.Z))
+    );
+}
+
+bool FDynamicAABBTree::Contains(const FBoundingBox& Outer, const FBoundingBox& Inner)
+{
+    return Outer.min.X <= Inner.min.X && Outer.min.Y <= Inner.min.Y && Outer.min.Z <= Inner.min.Z
+        && Inner.max.X <= Outer.max.X && Inner.max.Y <= Outer.max.Y && Inner.max.Z <= Outer.max.Z;
+}
+
+bool FDynamicAABBTree::Overlaps(const FBoundingBox& A, const FBoundingBox& B)
+{
+    return A.min.X <= B.max.X && B.min.X <= A.max.X
+        && A.min.Y <= B.max.Y && B.min.Y <= A.max.Y
+        && A.min.Z <= B.max.Z && B.min.Z <= A.max.Z;
+}
+
+float FDynamicAABBTree::SurfaceArea(const FBoundingBox& Box)
+{
+    const FVector Size = Box.max - Box.min;
+    return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+}
+
+FBoundingBox FDynamicAABBTree::MakeFat(const FBoundingBox& Bounds)
+{
+    const FVector Size = Bounds.max - Bounds.min;
+    const FVector Margin(
+        FMath::Max(Size.X * FatBoundsRatio, FatBoundsMinMargin),
+        FMath::Max(Size.Y * FatBoundsRatio, FatBoundsMinMargin),
+        FMath::Max(Size.Z * FatBoundsRatio, FatBoundsMinMargin)
+    );
+    return FBoundingBox(Bounds.min - Margin, Bounds.max + Margin);
+}
+
+TArray<int32>& FDynamicAABBTree::GetQueryStack() const
+{
+    QueryStack.Empty();
+    return QueryStack;
+}
@@ -0,0 +1,275 @@
+#pragma once
+#include "Define.h"
+#include "CoreMiscDefines.h"
+#include "Renderer/FrustumCulling.h"
+
+/**
+ * 움직이는 오브젝트를 위한 동적 AABB 트리.
+ * 각 Leaf는 실제 Bounds보다 조금 큰(Fat) AABB를 가지고 있어서, 작은 이동은 트리를 수정하지 않고 흡수합니다.
+ * 삽입은 표면적(SAH) 비용이 가장 작은 위치를 찾아 내려가고, 회전으로 높이 균형을 맞춥니다.
+ */
+class FDynamicAABBTree
+{
+public:
+    FDynamicAABBTree();
+
+    /** 새 Proxy를 만들고 ID를 반환합니다. */
+    int32 CreateProxy(const FBoundingBox& Bounds, void* UserData);
+
+    /** Proxy를 트리에서 제거합니다. */
+    void DestroyProxy(int32 ProxyId);
+
+    /**
+     * Proxy의 Bounds를 갱신합니다.
+     * @return Fat AABB를 벗어나서 트리가 재구성되었으면 true
+     */
+    bool MoveProxy(int32 ProxyId, const FBoundingBox& Bounds);
+
+    /** 모든 Proxy를 제거합니다. */
+    void Empty();
+
+    void* GetUserData(int32 ProxyId) const { return Nodes[ProxyId].UserData; }
+    const FBoundingBox& GetFatBounds(int32 ProxyId) const { return Nodes[ProxyId].Bounds; }
+
+    int32 GetNumProxies() const { return NumProxies; }
+    int32 GetHeight() const { return Root == INDEX_NONE ? 0 : Nodes[Root].Height; }
+
+    /**
+     * Fat AABB가 Bounds와 겹치는 모든 Proxy에 대해 Callback(ProxyId)을 호출합니다.
+     * Callback이 false를 반환하면 순회를 중단합니다.
+     */
+    template <typename FuncType>
+    void QueryBox(const FBoundingBox& Bounds, FuncType&& Callback) const;
+
+    /** Fat AABB가 구(Center, Radius)와 겹치는 모든 Proxy에 대해 Callback(ProxyId)을 호출합니다. */
+    template <typename FuncType>
+    void QuerySphere(const FVector& Center, float Radius, FuncType&& Callback) const;
+
+    /** Fat AABB가 Ray(Origin, Direction)와 MaxDistance 안에서 교차하는 모든 Proxy에 대해 Callback(ProxyId)을 호출합니다. */
+    template <typename FuncType>
+    void QueryRay(const FVector& Origin, const FVector& Direction, float MaxDistance, FuncType&& Callback) const;
+
+    /**
+     * Fat AABB가 절두체와 겹치는 모든 Proxy에 대해 Callback(ProxyId, bFullyInside)를 호출합니다.
+     * 절두체에 완전히 포함된 서브트리는 평면 테스트 없이 bFullyInside = true로 전달됩니다.
+     */
+    template <typename FuncType>
+    void QueryFrustum(const FFrustum& Frustum, FuncType&& Callback) const;
+
+private:
+    struct FNode
+    {
+        /** Leaf이면 Fat AABB, 내부 노드이면 두 자식을 감싸는 AABB */
+        FBoundingBox Bounds;
+
+        void* UserData = nullptr;
+
+        /** 사용 중이면 부모 노드, 비어 있으면 다음 빈 노드 */
+        int32 ParentOrNext = INDEX_NONE;
+
+        int32 Child1 = INDEX_NONE;
+        int32 Child2 = INDEX_NONE;
+
+        /** Leaf는 0, 비어 있는 노드는 -1 */
+        int32 Height = -1;
+
+        bool IsLeaf() const { return Child1 == INDEX_NONE; }
+    };
+
+    int32 AllocateNode();
+    void FreeNode(int32 NodeId);
+
+    void InsertLeaf(int32 LeafId);
+    void RemoveLeaf(int32 LeafId);
+
+    /** NodeId를 루트로 하는 서브트리를 회전해 높이 차이를 줄이고, 새 서브트리 루트를 반환합니다. */
+    int32 Balance(int32 NodeId);
+
+    /** 삽입 위치부터 루트까지 AABB와 높이를 다시 계산합니다. */
+    void RefitAncestors(int32 NodeId);
+
+    static FBoundingBox Union(const FBoundingBox& A, const FBoundingBox& B);
+    static bool Contains(const FBoundingBox& Outer, const FBoundingBox& Inner);
+    static bool Overlaps(const FBoundingBox& A, const FBoundingBox& B);
+    static float SurfaceArea(const FBoundingBox& Box);
+    static FBoundingBox MakeFat(const FBoundingBox& Bounds);
+
+    /** 순회에 사용할 스택을 비운 상태로 반환합니다. */
+    TArray<int32>& GetQueryStack() const;
+
+private:
+    TArray<FNode> Nodes;
+
+    int32 Root = INDEX_NONE;
+    int32 FreeList = INDEX_NONE;
+    int32 NumProxies = 0;
+
+    mutable TArray<int32> QueryStack;
+};
+
+
+template <typename FuncType>
+void FDynamicAABBTree::QueryBox(const FBoundingBox& Bounds, FuncType&& Callback) const
+{
+    if (Root == INDEX_NONE)
+    {
+        return;
+    }
+
+    TArray<int32>& Stack = GetQueryStack();
+    Stack.Add(Root);
+    while (Stack.Num() > 0)
+    {
+        const int32 NodeId = Stack.Pop();
+        const FNode& Node = Nodes[NodeId];
+        if (!Overlaps(Node.Bounds, Bounds))
+        {
+            continue;
+        }
+
+        if (Node.IsLeaf())
+        {
+            if (!Callback(NodeId))
+            {
+                return;
+            }
+        }
+        else
+        {
+            Stack.Add(Node.Child1);
+            Stack.Add(Node.Child2);
+        }
+    }
+}
+
+template <typename FuncType>
+void FDynamicAABBTree::QuerySphere(const FVector& Center, float Radius, FuncType&& Callback) const
+{
+    if (Root == INDEX_NONE)
+    {
+        return;
+    }
+
+    const float RadiusSquared = Radius * Radius;
+
+    TArray<int32>& Stack = GetQueryStack();
+    Stack.Add(Root);
+    while (Stack.Num() > 0)
+    {
+        const int32 NodeId = Stack.Pop();
+        const FNode& Node = Nodes[NodeId];
+
+        // 구의 중심에서 AABB까지의 최단 거리
+        const FVector Closest(
+            FMath::Clamp(Center.X, Node.Bounds.min.X, Node.Bounds.max.X),
+            FMath::Clamp(Center.Y, Node.Bounds.min.Y, Node.Bounds.max.Y),
+            FMath::Clamp(Center.Z, Node.Bounds.min.Z, Node.Bounds.max.Z)
+        );
+        if ((Closest - Center).LengthSquared() > RadiusSquared)
+        {
+            continue;
+        }
+
+        if (Node.IsLeaf())
+        {
+            if (!Callback(NodeId))
+            {
+                return;
+            }
+        }
+        else
+        {
+            Stack.Add(Node.Child1);
+            Stack.Add(Node.Child2);
+        }
+    }
+}
+
+template <typename FuncType>
+void FDynamicAABBTree::QueryRay(const FVector& Origin, const FVector& Direction, float MaxDistance, FuncType&& Callback) const
+{
+    if (Root == INDEX_NONE)
+    {
+        return;
+    }
+
+    TArray<int32>& Stack = GetQueryStack();
+    Stack.Add(Root);
+    while (Stack.Num() > 0)
+    {
+        const int32 NodeId = Stack.Pop();
+        const FNode& Node = Nodes[NodeId];
+
+        float HitDistance = 0.0f;
+        if (!Node.Bounds.Intersect(Origin, Direction, HitDistance) || HitDistance > MaxDistance)
+        {
+            continue;
+        }
+
+        if (Node.IsLeaf())
+        {
+            if (!Callback(NodeId))
+            {
+                return;
+            }
+        }
+        else
+        {
+            Stack.Add(Node.Child1);
+            Stack.Add(Node.Child2);
+        }
+    }
+}
+
+template <typename FuncType>
+void FDynamicAABBTree::QueryFrustum(const FFrustum& Frustum, FuncType&& Callback) const
+{
+    if (Root == INDEX_NONE)
+    {
+        return;
+    }
+
+    // 절두체 안에 완전히 들어온 서브트리는 음수 ID로 표시해서 평면 테스트를 건너뜁니다.
+    TArray<int32>& Stack = GetQueryStack();
+    Stack.Add(Root);
+    while (Stack.Num() > 0)
+    {
+        int32 NodeId = Stack.Pop();
+        bool bFullyInside = false;
+        if (NodeId < 0)
+        {
+            NodeId = -NodeId - 1;
+            bFullyInside = true;
+        }
+
+        const FNode& Node = Nodes[NodeId];
+        if (!bFullyInside)
+        {
+            const FCullBounds NodeBounds((Node.Bounds.min + Node.Bounds.max) * 0.5f, (Node.Bounds.max - Node.Bounds.min) * 0.5f);
+            const EFrustumContainment Containment = Frustum.ClassifyBox(NodeBounds);
+            if (Containment == EFrustumContainment::Outside)
+            {
+                continue;
+            }
+            bFullyInside = Containment == EFrustumContainment::Inside;
+        }
+
+        if (Node.IsLeaf())
+        {
+            if (!Callback(NodeId, bFullyInside))
+            {
+                return;
+            }
+        }
+        else if (bFullyInside)
+        {
+            Stack.Add(-Node.Child1 - 1);
+            Stack.Add(-Node.Child2 - 1);
+        }
+        else
+        {
+            Stack.Add(Node.Child1);
+            Stack.Add(Node.Child2);
+        }
+    }
+}
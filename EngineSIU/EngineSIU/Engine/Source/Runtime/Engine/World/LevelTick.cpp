@@ -0,0 +1,40 @@
+#include "TickTaskManager.h"
+
+#include "Level.h"
+#include "World.h"
+#include "GameFramework/Actor.h"
+#include "Stats/Stats.h"
+
+void FActorTickFunction::ExecuteTick(float DeltaTime)
+{
+    // 앞선 그룹에서 Destroy된 Actor는 프레임이 끝날 때까지 메모리에 남아 있지만 Tick하지 않습니다.
+    if (Target && !Target->IsActorBeingDestroyed())
+    {
+        Target->Tick(DeltaTime);
+    }
+}
+
+void FTickTaskManager::RunTickGroups(UWorld* World, float DeltaTime, bool bEditorTick)
+{
+    QUICK_SCOPE_CYCLE_COUNTER(FTickTaskManager_RunTickGroups);
+
+    WorldTicks.Empty();
+    if (ULevel* Level = World->GetActiveLevel())
+    {
+        for (AActor* Actor : Level->Actors)
+        {
+            if (Actor && !Actor->IsActorBeingDestroyed() && (!bEditorTick || Actor->IsActorTickInEditor()))
+            {
+                WorldTicks.Add(&Actor->PrimaryActorTick);
+            }
+        }
+    }
+
+    FPrimitiveSceneIndex& SceneIndex = World->GetPrimitiveSceneIndex();
+    RunTicks(WorldTicks, DeltaTime, [World, &SceneIndex](FTickThreadContext& Context)
+    {
+        // 플래그는 버퍼에 넣을 때 이미 세웠으므로 목록만 옮깁니다.
+        World->PendingTransformUpdates.Append(Context.PendingTransformUpdates);
+        SceneIndex.DirtyPrimitives.Append(Context.DirtyPrimitives);
+    });
+}
@@ -0,0 +1,266 @@
+#include "PrimitiveSceneIndex.h"
+
+#include "TickTaskManager.h"
+#include "BaseGizmos/GizmoBaseComponent.h"
+#include "Components/BillboardComponent.h"
+#include "Components/HeightFogComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/TextComponent.h"
+
+void FPrimitiveSceneIndex::AddPrimitive(UPrimitiveComponent* Primitive)
+{
+    if (Primitive == nullptr || Primitive->ScenePrimitiveIndex != INDEX_NONE)
+    {
+        return;
+    }
+
+    const FCullBounds Bounds = CalculateWorldBounds(Primitive);
+
+    Primitive->ScenePrimitiveIndex = Primitives.Add(Primitive);
+    WorldBounds.Add(Bounds);
+
+    Primitive->ScenePrimitiveType = ClassifyPrimitive(Primitive);
+    Primitive->SceneTypedIndex = TypedPrimitives[static_cast<uint8>(Primitive->ScenePrimitiveType)].Add(Primitive);
+    Primitive->SceneProxyId = Tree.CreateProxy(ToBoundingBox(Bounds), Primitive);
+    Primitive->bSceneBoundsDirty = false;
+}
+
+void FPrimitiveSceneIndex::RemovePrimitive(UPrimitiveComponent* Primitive)
+{
+    if (Primitive == nullptr || Primitive->ScenePrimitiveIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    if (Primitive->bSceneBoundsDirty)
+    {
+        DirtyPrimitives.RemoveSingle(Primitive);
+        Primitive->bSceneBoundsDirty = false;
+    }
+
+    Tree.DestroyProxy(Primitive->SceneProxyId);
+
+    // 마지막 원소를 빈 자리로 옮깁니다.
+    const int32 RemoveIndex = Primitive->ScenePrimitiveIndex;
+    const int32 LastIndex = Primitives.Num() - 1;
+    if (RemoveIndex != LastIndex)
+    {
+        Primitives[LastIndex]->ScenePrimitiveIndex = RemoveIndex;
+    }
+    Primitives.RemoveAtSwap(RemoveIndex);
+    WorldBounds.RemoveAtSwap(RemoveIndex);
+
+    TArray<UPrimitiveComponent*>& Typed = TypedPrimitives[static_cast<uint8>(Primitive->ScenePrimitiveType)];
+    const int32 RemoveTypedIndex = Primitive->SceneTypedIndex;
+    const int32 LastTypedIndex = Typed.Num() - 1;
+    if (RemoveTypedIndex != LastTypedIndex)
+    {
+        Typed[LastTypedIndex]->SceneTypedIndex = RemoveTypedIndex;
+    }
+    Typed.RemoveAtSwap(RemoveTypedIndex);
+
+    Primitive->ScenePrimitiveIndex = INDEX_NONE;
+    Primitive->SceneTypedIndex = INDEX_NONE;
+    Primitive->SceneProxyId = INDEX_NONE;
+}
+
+void FPrimitiveSceneIndex::MarkPrimitiveDirty(UPrimitiveComponent* Primitive)
+{
+    if (Primitive == nullptr || Primitive->ScenePrimitiveIndex == INDEX_NONE || Primitive->bSceneBoundsDirty)
+    {
+        return;
+    }
+
+    Primitive->bSceneBoundsDirty = true;
+    if (FTickThreadContext* Context = FTickTaskManager::GetThreadContext())
+    {
+        Context->DirtyPrimitives.Add(Primitive);
+    }
+    else
+    {
+        DirtyPrimitives.Add(Primitive);
+    }
+}
+
+void FPrimitiveSceneIndex::Update()
+{
+    for (UPrimitiveComponent* Primitive : DirtyPrimitives)
+    {
+        const FCullBounds Bounds = CalculateWorldBounds(Primitive);
+        WorldBounds[Primitive->ScenePrimitiveIndex] = Bounds;
+        Tree.MoveProxy(Primitive->SceneProxyId, ToBoundingBox(Bounds));
+        Primitive->bSceneBoundsDirty = false;
+    }
+    DirtyPrimitives.Empty();
+}
+
+void FPrimitiveSceneIndex::Empty()
+{
+    for (UPrimitiveComponent* Primitive : Primitives)
+    {
+        Primitive->ScenePrimitiveIndex = INDEX_NONE;
+        Primitive->SceneTypedIndex = INDEX_NONE;
+        Primitive->SceneProxyId = INDEX_NONE;
+        Primitive->bSceneBoundsDirty = false;
+    }
+
+    Tree.Empty();
+    Primitives.Empty();
+    WorldBounds.Empty();
+    for (TArray<UPrimitiveComponent*>& Typed : TypedPrimitives)
+    {
+        Typed.Empty();
+    }
+    DirtyPrimitives.Empty();
+}
+
+bool FPrimitiveSceneIndex::GetWorldBounds(const UPrimitiveComponent* Primitive, FCullBounds& OutBounds) const
+{
+    if (Primitive == nullptr || Primitive->ScenePrimitiveIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    OutBounds = Primitive->bSceneBoundsDirty ? CalculateWorldBounds(Primitive) : WorldBounds[Primitive->ScenePrimitiveIndex];
+    return true;
+}
+
+void FPrimitiveSceneIndex::QueryFrustum(const FFrustum& Frustum, TArray<UPrimitiveComponent*>& OutPrimitives)
+{
+    QueryFrustum(Frustum, ~0u, OutPrimitives);
+}
+
+void FPrimitiveSceneIndex::QueryFrustum(const FFrustum& Frustum, EScenePrimitiveType Type, TArray<UPrimitiveComponent*>& OutPrimitives)
+{
+    QueryFrustum(Frustum, 1u << static_cast<uint8>(Type), OutPrimitives);
+}
+
+void FPrimitiveSceneIndex::QueryFrustum(const FFrustum& Frustum, uint32 TypeMask, TArray<UPrimitiveComponent*>& OutPrimitives)
+{
+    Update();
+
+    // 절두체에 완전히 포함된 Leaf는 바로 추가하고, 걸쳐 있는 Leaf는 실제 Bounds로 한 번 더 테스트합니다.
+    CandidateIndices.Empty();
+    CandidateBounds.Empty();
+    Tree.QueryFrustum(Frustum, [this, TypeMask, &OutPrimitives](int32 ProxyId, bool bFullyInside)
+    {
+        UPrimitiveComponent* Primitive = static_cast<UPrimitiveComponent*>(Tree.GetUserData(ProxyId));
+        if (!(TypeMask & (1u << static_cast<uint8>(Primitive->ScenePrimitiveType))))
+        {
+            return true;
+        }
+
+        if (bFullyInside)
+        {
+            OutPrimitives.Add(Primitive);
+        }
+        else
+        {
+            CandidateIndices.Add(Primitive->ScenePrimitiveIndex);
+            CandidateBounds.Add(WorldBounds[Primitive->ScenePrimitiveIndex]);
+        }
+        return true;
+    });
+
+    FrustumCulling::CullAgainstFrustum(CandidateBounds, Frustum, VisibleCandidates);
+    for (const uint32 CandidateIndex : VisibleCandidates)
+    {
+        OutPrimitives.Add(Primitives[CandidateIndices[CandidateIndex]]);
+    }
+}
+
+void FPrimitiveSceneIndex::QueryRay(const FVector& Origin, const FVector& Direction, float MaxDistance, TArray<UPrimitiveComponent*>& OutPrimitives)
+{
+    Update();
+
+    Tree.QueryRay(Origin, Direction, MaxDistance, [this, &Origin, &Direction, MaxDistance, &OutPrimitives](int32 ProxyId)
+    {
+        UPrimitiveComponent* Primitive = static_cast<UPrimitiveComponent*>(Tree.GetUserData(ProxyId));
+        const FBoundingBox Bounds = ToBoundingBox(WorldBounds[Primitive->ScenePrimitiveIndex]);
+
+        float HitDistance = 0.0f;
+        if (Bounds.Intersect(Origin, Direction, HitDistance) && HitDistance <= MaxDistance)
+        {
+            OutPrimitives.Add(Primitive);
+        }
+        return true;
+    });
+}
+
+void FPrimitiveSceneIndex::QuerySphere(const FVector& Center, float Radius, TArray<UPrimitiveComponent*>& OutPrimitives)
+{
+    Update();
+
+    const float RadiusSquared = Radius * Radius;
+    Tree.QuerySphere(Center, Radius, [this, &Center, RadiusSquared, &OutPrimitives](int32 ProxyId)
+    {
+        UPrimitiveComponent* Primitive = static_cast<UPrimitiveComponent*>(Tree.GetUserData(ProxyId));
+        const FCullBounds& Bounds = WorldBounds[Primitive->ScenePrimitiveIndex];
+
+        // 구의 중심에서 박스까지의 거리
+        const FVector Offset = Center - Bounds.Center;
+        const FVector Outside(
+            FMath::Max(FMath::Abs(Offset.X) - Bounds.Extent.X, 0.0f),
+            FMath::Max(FMath::Abs(Offset.Y) - Bounds.Extent.Y, 0.0f),
+            FMath::Max(FMath::Abs(Offset.Z) - Bounds.Extent.Z, 0.0f)
+        );
+        if (Outside.LengthSquared() <= RadiusSquared)
+        {
+            OutPrimitives.Add(Primitive);
+        }
+        return true;
+    });
+}
+
+void FPrimitiveSceneIndex::QueryBox(const FBoundingBox& Box, TArray<UPrimitiveComponent*>& OutPrimitives)
+{
+    Update();
+
+    Tree.QueryBox(Box, [this, &Box, &OutPrimitives](int32 ProxyId)
+    {
+        UPrimitiveComponent* Primitive = static_cast<UPrimitiveComponent*>(Tree.GetUserData(ProxyId));
+        const FBoundingBox Bounds = ToBoundingBox(WorldBounds[Primitive->ScenePrimitiveIndex]);
+
+        if (Bounds.min.X <= Box.max.X && Box.min.X <= Bounds.max.X
+            && Bounds.min.Y <= Box.max.Y && Box.min.Y <= Bounds.max.Y
+            && Bounds.min.Z <= Box.max.Z && Box.min.Z <= Bounds.max.Z)
+        {
+            OutPrimitives.Add(Primitive);
+        }
+        return true;
+    });
+}
+
+EScenePrimitiveType FPrimitiveSceneIndex::ClassifyPrimitive(const UPrimitiveComponent* Primitive)
+{
+    if (Primitive->IsA<UTextComponent>())
+    {
+        return EScenePrimitiveType::Text;
+    }
+    if (Primitive->IsA<UBillboardComponent>())
+    {
+        return EScenePrimitiveType::Billboard;
+    }
+    if (Primitive->IsA<UHeightFogComponent>())
+    {
+        return EScenePrimitiveType::HeightFog;
+    }
+    // Gizmo는 FGizmoRenderPass가 따로 그리므로 Static Mesh로 세지 않습니다.
+    if (Primitive->IsA<UStaticMeshComponent>() && !Primitive->IsA<UGizmoBaseComponent>())
+    {
+        return EScenePrimitiveType::StaticMesh;
+    }
+    return EScenePrimitiveType::Other;
+}
+
+FCullBounds FPrimitiveSceneIndex::CalculateWorldBounds(const UPrimitiveComponent* Primitive)
+{
+    const FBoundingBox LocalBounds = Primitive->GetBoundingBox();
+    return FCullBounds::FromLocalBox(LocalBounds.min, LocalBounds.max, Primitive->GetWorldMatrix());
+}
+
+FBoundingBox FPrimitiveSceneIndex::ToBoundingBox(const FCullBounds& Bounds)
+{
+    return FBoundingBox(Bounds.Center - Bounds.Extent, Bounds.Center + Bounds.Extent);
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include "DynamicAABBTree.h"
+
+class UPrimitiveComponent;
+
+/** 렌더 패스가 자기가 그리는 종류의 Primitive만 바로 찾을 수 있도록, 등록할 때 한 번 분류해 두는 종류 */
+enum class EScenePrimitiveType : uint8
+{
+    /** UStaticMeshComponent (Gizmo 제외) */
+    StaticMesh,
+    /** UBillboardComponent와 UParticleSubUVComponent (Text 제외) */
+    Billboard,
+    Text,
+    HeightFog,
+    Other,
+
+    Count
+};
+
+/**
+ * World에 등록된 UPrimitiveComponent들의 공간 인덱스.
+ * 월드 공간 Bounds를 FDynamicAABBTree에 보관하며, Transform이 바뀐 Primitive만 다음 쿼리 전에 갱신합니다.
+ */
+class FPrimitiveSceneIndex
+{
+    friend class FTickTaskManager;
+
+public:
+    FPrimitiveSceneIndex() = default;
+    ~FPrimitiveSceneIndex() = default;
+
+    FPrimitiveSceneIndex(const FPrimitiveSceneIndex&) = delete;
+    FPrimitiveSceneIndex& operator=(const FPrimitiveSceneIndex&) = delete;
+
+    /** Primitive를 인덱스에 등록합니다. 이미 등록되어 있으면 아무것도 하지 않습니다. */
+    void AddPrimitive(UPrimitiveComponent* Primitive);
+
+    /** Primitive를 인덱스에서 제거합니다. */
+    void RemovePrimitive(UPrimitiveComponent* Primitive);
+
+    /**
+     * Primitive의 Transform 또는 Bounds가 바뀌었음을 알립니다. 실제 갱신은 다음 쿼리 전에 이루어집니다.
+     * 병렬 Tick 중에는 스레드별 버퍼에 모았다가 Tick 그룹이 끝날 때 합칩니다.
+     */
+    void MarkPrimitiveDirty(UPrimitiveComponent* Primitive);
+
+    /** Dirty 상태인 Primitive들의 Bounds를 트리에 반영합니다. */
+    void Update();
+
+    /** 모든 Primitive를 제거합니다. */
+    void Empty();
+
+    /** 등록된 모든 Primitive (순서는 보장되지 않습니다) */
+    const TArray<UPrimitiveComponent*>& GetPrimitives() const { return Primitives; }
+
+    /** 등록된 Type 종류의 Primitive (순서는 보장되지 않습니다). 매 프레임 모든 Primitive를 Cast하지 않고 종류별로 순회할 때 사용합니다. */
+    const TArray<UPrimitiveComponent*>& GetPrimitives(EScenePrimitiveType Type) const { return TypedPrimitives[static_cast<uint8>(Type)]; }
+
+    int32 Num() const { return Primitives.Num(); }
+    int32 Num(EScenePrimitiveType Type) const { return TypedPrimitives[static_cast<uint8>(Type)].Num(); }
+
+    /** Primitive의 월드 공간 Bounds를 반환합니다. 등록되지 않은 Primitive이면 false를 반환합니다. */
+    bool GetWorldBounds(const UPrimitiveComponent* Primitive, FCullBounds& OutBounds) const;
+
+    /** 절두체와 겹치는 Primitive들을 OutPrimitives에 추가합니다. */
+    void QueryFrustum(const FFrustum& Frustum, TArray<UPrimitiveComponent*>& OutPrimitives);
+
+    /** 절두체와 겹치는 Primitive 중 Type 종류만 OutPrimitives에 추가합니다. */
+    void QueryFrustum(const FFrustum& Frustum, EScenePrimitiveType Type, TArray<UPrimitiveComponent*>& OutPrimitives);
+
+    /** Ray와 MaxDistance 안에서 Bounds가 교차하는 Primitive들을 OutPrimitives에 추가합니다. */
+    void QueryRay(const FVector& Origin, const FVector& Direction, float MaxDistance, TArray<UPrimitiveComponent*>& OutPrimitives);
+
+    /** 구와 Bounds가 겹치는 Primitive들을 OutPrimitives에 추가합니다. */
+    void QuerySphere(const FVector& Center, float Radius, TArray<UPrimitiveComponent*>& OutPrimitives);
+
+    /** 박스와 Bounds가 겹치는 Primitive들을 OutPrimitives에 추가합니다. */
+    void QueryBox(const FBoundingBox& Box, TArray<UPrimitiveComponent*>& OutPrimitives);
+
+private:
+    static EScenePrimitiveType ClassifyPrimitive(const UPrimitiveComponent* Primitive);
+
+    /** TypeMask는 EScenePrimitiveType별 비트입니다. */
+    void QueryFrustum(const FFrustum& Frustum, uint32 TypeMask, TArray<UPrimitiveComponent*>& OutPrimitives);
+
+    /** Primitive의 현재 Transform으로 월드 공간 Bounds를 계산합니다. */
+    static FCullBounds CalculateWorldBounds(const UPrimitiveComponent* Primitive);
+
+    static FBoundingBox ToBoundingBox(const FCullBounds& Bounds);
+
+private:
+    FDynamicAABBTree Tree;
+
+    /** 등록된 Primitive, UPrimitiveComponent::ScenePrimitiveIndex로 접근합니다. */
+    TArray<UPrimitiveComponent*> Primitives;
+
+    /** Primitives와 같은 순서의 월드 공간 Bounds */
+    TArray<FCullBounds> WorldBounds;
+
+    /** 종류별 Primitive, UPrimitiveComponent::SceneTypedIndex로 접근합니다. */
+    TArray<UPrimitiveComponent*> TypedPrimitives[static_cast<uint8>(EScenePrimitiveType::Count)];
+
+    /** 다음 쿼리 전에 갱신할 Primitive */
+    TArray<UPrimitiveComponent*> DirtyPrimitives;
+
+    /** QueryFrustum에서 Leaf 후보를 모아 SIMD로 정밀 테스트하기 위한 임시 버퍼 */
+    TArray<int32> CandidateIndices;
+    TArray<FCullBounds> CandidateBounds;
+    TArray<uint32> VisibleCandidates;
+};
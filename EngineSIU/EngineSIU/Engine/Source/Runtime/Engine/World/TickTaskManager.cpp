@@ -0,0 +1,261 @@
+#include "TickTaskManager.h"
+
+#include "Async/JobSystem.h"
+#include "Math/MathUtility.h"
+#include "Stats/Stats.h"
+
+namespace
+{
+    /** 지금 스레드가 실행 중인 병렬 Tick의 버퍼 */
+    thread_local FTickThreadContext* GTickThreadContext = nullptr;
+}
+
+FTickFunction::~FTickFunction()
+{
+    for (FTickFunction* Prerequisite : Prerequisites)
+    {
+        Prerequisite->Dependents.RemoveSingle(this);
+    }
+    for (FTickFunction* Dependent : Dependents)
+    {
+        Dependent->Prerequisites.RemoveSingle(this);
+    }
+}
+
+void FTickFunction::AddPrerequisite(FTickFunction& Prerequisite)
+{
+    if (&Prerequisite == this || Prerequisites.Contains(&Prerequisite))
+    {
+        return;
+    }
+    Prerequisites.Add(&Prerequisite);
+    Prerequisite.Dependents.Add(this);
+}
+
+void FTickFunction::RemovePrerequisite(FTickFunction& Prerequisite)
+{
+    if (Prerequisites.RemoveSingle(&Prerequisite))
+    {
+        Prerequisite.Dependents.RemoveSingle(this);
+    }
+}
+
+FTickTaskManager& FTickTaskManager::Get()
+{
+    static FTickTaskManager Instance;
+    return Instance;
+}
+
+void FTickTaskManager::RunTicks(const TArray<FTickFunction*>& Ticks, float DeltaTime, const std::function<void(FTickThreadContext&)>& MergeThreadContext)
+{
+    QUICK_SCOPE_CYCLE_COUNTER(FTickTaskManager_RunTicks);
+
+    Stats = {};
+
+    const int32 NumAvailableThreads = FJobSystem::Get().GetNumWorkers() + 1;
+    Stats.NumThreads = MaxThreads > 0 ? FMath::Min(MaxThreads, NumAvailableThreads) : NumAvailableThreads;
+    if (ThreadContexts.Num() < Stats.NumThreads)
+    {
+        ThreadContexts.SetNum(Stats.NumThreads);
+    }
+
+    GatherTicks(Ticks);
+
+    for (int32 Group = 0; Group < TG_MAX; ++Group)
+    {
+        for (int32 LayerIndex = 0; LayerIndex < NumLayers[Group]; ++LayerIndex)
+        {
+            FTickLayer& Layer = Layers[Group][LayerIndex];
+            RunParallel(Layer.AnyThread, DeltaTime);
+
+            // 메인 스레드 전용 Tick은 병렬 Tick이 없을 때 실행되므로 World를 바로 수정해도 됩니다.
+            for (FTickFunction* Tick : Layer.MainThread)
+            {
+                Tick->ExecuteTick(DeltaTime);
+            }
+        }
+
+        FlushThreadContexts(MergeThreadContext);
+    }
+}
+
+void FTickTaskManager::EnqueueCommand(std::function<void()> Command)
+{
+    if (FTickThreadContext* Context = GetThreadContext())
+    {
+        Context->Commands.Add(std::move(Command));
+    }
+    else
+    {
+        Command();
+    }
+}
+
+FTickThreadContext* FTickTaskManager::GetThreadContext()
+{
+    return GTickThreadContext;
+}
+
+void FTickTaskManager::GatherTicks(const TArray<FTickFunction*>& Ticks)
+{
+    ++Serial;
+    if (Serial == 0)
+    {
+        Serial = 1;
+    }
+
+    GatheredTicks.Empty();
+    for (FTickFunction* Tick : Ticks)
+    {
+        if (Tick->bCanEverTick)
+        {
+            Tick->GatherSerial = Serial;
+            GatheredTicks.Add(Tick);
+        }
+    }
+
+    for (int32 Group = 0; Group < TG_MAX; ++Group)
+    {
+        for (int32 LayerIndex = 0; LayerIndex < NumLayers[Group]; ++LayerIndex)
+        {
+            Layers[Group][LayerIndex].AnyThread.Empty();
+            Layers[Group][LayerIndex].MainThread.Empty();
+        }
+        NumLayers[Group] = 0;
+    }
+
+    for (FTickFunction* Tick : GatheredTicks)
+    {
+        ResolveTick(*Tick);
+
+        TArray<FTickLayer>& GroupLayers = Layers[Tick->ActualTickGroup];
+        if (GroupLayers.Num() <= Tick->Depth)
+        {
+            GroupLayers.SetNum(Tick->Depth + 1);
+        }
+        int32& NumGroupLayers = NumLayers[Tick->ActualTickGroup];
+        NumGroupLayers = FMath::Max(NumGroupLayers, Tick->Depth + 1);
+
+        FTickLayer& Layer = GroupLayers[Tick->Depth];
+        if (Tick->bRunOnAnyThread)
+        {
+            Layer.AnyThread.Add(Tick);
+        }
+        else
+        {
+            Layer.MainThread.Add(Tick);
+            ++Stats.NumMainThreadTicks;
+        }
+    }
+
+    Stats.NumTicks = GatheredTicks.Num();
+    for (int32 Group = 0; Group < TG_MAX; ++Group)
+    {
+        Stats.NumLayers += NumLayers[Group];
+    }
+}
+
+void FTickTaskManager::ResolveTick(FTickFunction& Tick)
+{
+    if (Tick.ResolveSerial == Serial || Tick.VisitSerial == Serial)
+    {
+        return;
+    }
+
+    Tick.VisitSerial = Serial;
+    Tick.ActualTickGroup = Tick.TickGroup;
+    Tick.Depth = 0;
+
+    // 이번 프레임에 Tick하지 않는 선행 Tick은 기다릴 필요가 없습니다.
+    for (FTickFunction* Prerequisite : Tick.Prerequisites)
+    {
+        if (Prerequisite->GatherSerial != Serial)
+        {
+            continue;
+        }
+
+        ResolveTick(*Prerequisite);
+        if (Prerequisite->ResolveSerial != Serial)
+        {
+            // 아직 방문 중인 Tick이면 순환입니다.
+            continue;
+        }
+
+        if (Prerequisite->ActualTickGroup > Tick.ActualTickGroup)
+        {
+            Tick.ActualTickGroup = Prerequisite->ActualTickGroup;
+            Tick.Depth = 0;
+        }
+        if (Prerequisite->ActualTickGroup == Tick.ActualTickGroup)
+        {
+            Tick.Depth = FMath::Max(Tick.Depth, Prerequisite->Depth + 1);
+        }
+    }
+
+    Tick.ResolveSerial = Serial;
+}
+
+void FTickTaskManager::RunParallel(const TArray<FTickFunction*>& Ticks, float DeltaTime)
+{
+    if (Ticks.Num() == 0)
+    {
+        return;
+    }
+
+    FTickThreadContext* const MainContext = &ThreadContexts[0];
+
+    const int32 NumThreads = Stats.NumThreads;
+    if (NumThreads <= 1 || Ticks.Num() < MinParallelTicks)
+    {
+        FTickThreadContext* const PrevContext = GTickThreadContext;
+        GTickThreadContext = MainContext;
+        for (FTickFunction* Tick : Ticks)
+        {
+            Tick->ExecuteTick(DeltaTime);
+        }
+        GTickThreadContext = PrevContext;
+        return;
+    }
+
+    // ThreadIndex는 NumThreads보다 작으므로 스레드마다 자기 Context에만 씁니다.
+    FJobSystem::Get().ParallelFor(Ticks.Num(), MinTicksPerChunk, [this, &Ticks, DeltaTime](int32 Begin, int32 End, int32 ThreadIndex)
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(FTickTaskManager_TickChunks);
+
+        FTickThreadContext* const PrevContext = GTickThreadContext;
+        GTickThreadContext = &ThreadContexts[ThreadIndex];
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            Ticks[Index]->ExecuteTick(DeltaTime);
+        }
+        GTickThreadContext = PrevContext;
+    }, NumThreads);
+}
+
+void FTickTaskManager::FlushThreadContexts(const std::function<void(FTickThreadContext&)>& MergeThreadContext)
+{
+    QUICK_SCOPE_CYCLE_COUNTER(FTickTaskManager_FlushThreadContexts);
+
+    for (FTickThreadContext& Context : ThreadContexts)
+    {
+        if (MergeThreadContext)
+        {
+            MergeThreadContext(Context);
+        }
+        Context.PendingTransformUpdates.Empty();
+        Context.DirtyPrimitives.Empty();
+    }
+
+    // Destroy가 World의 목록에서 컴포넌트를 빼낼 수 있도록 목록을 먼저 합친 뒤 명령을 실행합니다.
+    for (FTickThreadContext& Context : ThreadContexts)
+    {
+        TArray<std::function<void()>> Commands = std::move(Context.Commands);
+        Context.Commands.Empty();
+
+        for (std::function<void()>& Command : Commands)
+        {
+            Command();
+        }
+        Stats.NumCommands += Commands.Num();
+    }
+}
@@ -0,0 +1,167 @@
+#pragma once
+#include <functional>
+
+#include "Container/Array.h"
+#include "Engine/EngineTypes.h"
+#include "HAL/PlatformType.h"
+
+class AActor;
+class UPrimitiveComponent;
+class USceneComponent;
+class UWorld;
+
+/**
+ * FTickTaskManager가 실행하는 Tick 하나.
+ * 같은 그룹 안에서 선행 Tick이 없는 Tick들은 여러 스레드에서 동시에 실행되므로,
+ * ExecuteTick에서는 자기 자신과 소유한 컴포넌트만 수정해야 합니다.
+ */
+struct FTickFunction
+{
+    FTickFunction() = default;
+    virtual ~FTickFunction();
+
+    FTickFunction(const FTickFunction&) = delete;
+    FTickFunction& operator=(const FTickFunction&) = delete;
+
+    /** 이 Tick이 실행되는 그룹. 선행 Tick이 더 늦은 그룹에 있으면 그 그룹으로 미뤄집니다. */
+    ETickingGroup TickGroup = TG_PrePhysics;
+
+    uint8 bCanEverTick : 1 = true;
+
+    /** false이면 Worker에서 실행하지 않고, 같은 단계의 병렬 Tick이 끝난 뒤 메인 스레드에서 실행합니다. */
+    uint8 bRunOnAnyThread : 1 = true;
+
+    /** Prerequisite가 끝난 뒤에 이 Tick이 실행되도록 합니다. 둘 중 하나가 소멸하면 자동으로 끊어집니다. */
+    void AddPrerequisite(FTickFunction& Prerequisite);
+    void RemovePrerequisite(FTickFunction& Prerequisite);
+
+    virtual void ExecuteTick(float DeltaTime) = 0;
+
+private:
+    friend class FTickTaskManager;
+
+    TArray<FTickFunction*> Prerequisites;
+    TArray<FTickFunction*> Dependents;
+
+    /** 스케줄러가 프레임마다 다시 계산하는 값. GatherSerial이 현재 프레임과 같을 때만 유효합니다. */
+    uint32 GatherSerial = 0;
+    uint32 VisitSerial = 0;
+    uint32 ResolveSerial = 0;
+    ETickingGroup ActualTickGroup = TG_PrePhysics;
+    int32 Depth = 0;
+};
+
+/** AActor::Tick을 실행하는 Tick. 컴포넌트의 TickComponent는 AActor::Tick 안에서 함께 실행됩니다. */
+struct FActorTickFunction : public FTickFunction
+{
+    AActor* Target = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime) override;
+};
+
+/**
+ * 병렬 Tick 중인 스레드가 World 공용 상태 대신 쓰는 버퍼.
+ * Tick 그룹이 끝나면 메인 스레드에서 World에 합치고, 쌓인 명령을 실행합니다.
+ */
+struct FTickThreadContext
+{
+    TArray<USceneComponent*> PendingTransformUpdates;
+    TArray<UPrimitiveComponent*> DirtyPrimitives;
+    TArray<std::function<void()>> Commands;
+};
+
+struct FTickTaskStats
+{
+    int32 NumTicks = 0;
+    int32 NumMainThreadTicks = 0;
+    int32 NumLayers = 0;
+    int32 NumThreads = 0;
+    int32 NumCommands = 0;
+};
+
+/**
+ * World의 Actor들을 Tick 그룹 순서대로 Tick합니다.
+ *
+ * 그룹 안에서는 선행 Tick 관계로 단계(Depth)를 나누고, 한 단계의 Tick들을 FJobSystem의 Worker와 메인 스레드가
+ * 작은 묶음 단위로 나눠 가져가며 실행합니다. 먼저 끝난 스레드가 남은 묶음을 가져가므로 Tick 비용이 고르지 않아도 부하가 분산됩니다.
+ * 병렬 Tick 중의 Spawn/Destroy와 World 공용 목록 변경은 FTickThreadContext에 쌓였다가 그룹 경계에서 메인 스레드가 처리합니다.
+ */
+class FTickTaskManager
+{
+public:
+    static FTickTaskManager& Get();
+
+    FTickTaskManager(const FTickTaskManager&) = delete;
+    FTickTaskManager& operator=(const FTickTaskManager&) = delete;
+
+    /**
+     * World의 Level에 있는 Actor를 Tick합니다. 메인 스레드에서만 호출합니다.
+     * @param bEditorTick true이면 IsActorTickInEditor인 Actor만 Tick합니다.
+     */
+    void RunTickGroups(UWorld* World, float DeltaTime, bool bEditorTick);
+
+    /**
+     * Ticks를 Tick 그룹과 선행 Tick 순서대로 실행합니다. 메인 스레드에서만 호출합니다.
+     * @param MergeThreadContext 그룹이 끝날 때마다 스레드별 버퍼로 호출되어 목록을 World에 합칩니다. 합치지 않은 목록은 버립니다.
+     */
+    void RunTicks(const TArray<FTickFunction*>& Ticks, float DeltaTime, const std::function<void(FTickThreadContext&)>& MergeThreadContext = nullptr);
+
+    /**
+     * 병렬 Tick 중이면 현재 Tick 그룹이 끝난 뒤 메인 스레드에서 실행하고, 아니면 바로 실행합니다.
+     * Worker에서 Actor를 Spawn하거나 World를 바꿔야 할 때 사용합니다.
+     */
+    void EnqueueCommand(std::function<void()> Command);
+
+    /** 지금 스레드가 병렬 Tick을 실행 중이면 그 스레드의 버퍼, 아니면 nullptr */
+    static FTickThreadContext* GetThreadContext();
+
+    static bool IsInParallelTick() { return GetThreadContext() != nullptr; }
+
+    /** Tick에 쓸 최대 스레드 수 (메인 스레드 포함). 0이면 모든 Worker를 사용합니다. */
+    void SetMaxThreads(int32 InMaxThreads) { MaxThreads = InMaxThreads; }
+    int32 GetMaxThreads() const { return MaxThreads; }
+
+    const FTickTaskStats& GetStats() const { return Stats; }
+
+private:
+    FTickTaskManager() = default;
+
+    /** 한 단계의 Tick들. 병렬로 실행할 것과 메인 스레드에서 실행할 것을 나눠 둡니다. */
+    struct FTickLayer
+    {
+        TArray<FTickFunction*> AnyThread;
+        TArray<FTickFunction*> MainThread;
+    };
+
+    void GatherTicks(const TArray<FTickFunction*>& Ticks);
+
+    /** 선행 Tick을 따라가며 실제 그룹과 단계를 정합니다. 순환이 있으면 그 간선은 무시합니다. */
+    void ResolveTick(FTickFunction& Tick);
+
+    void RunParallel(const TArray<FTickFunction*>& Ticks, float DeltaTime);
+
+    /** 스레드별 버퍼를 World에 합치고 쌓인 명령을 실행합니다. */
+    void FlushThreadContexts(const std::function<void(FTickThreadContext&)>& MergeThreadContext);
+
+private:
+    /** 병렬로 나누기에는 너무 적은 Tick 수 */
+    static constexpr int32 MinParallelTicks = 64;
+
+    /** 한 번에 가져가는 Tick 묶음의 최소 크기 */
+    static constexpr int32 MinTicksPerChunk = 16;
+
+    int32 MaxThreads = 0;
+    uint32 Serial = 0;
+
+    /** RunTickGroups가 World에서 모은 Tick */
+    TArray<FTickFunction*> WorldTicks;
+
+    TArray<FTickFunction*> GatheredTicks;
+    TArray<FTickLayer> Layers[TG_MAX];
+    int32 NumLayers[TG_MAX] = {};
+
+    /** 0번은 메인 스레드, 나머지는 Worker 몫입니다. */
+    TArray<FTickThreadContext> ThreadContexts;
+
+    FTickTaskStats Stats;
+};
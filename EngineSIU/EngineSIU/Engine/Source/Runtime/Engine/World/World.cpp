@@ -10,6 +10,9 @@
 #include "Engine/EditorEngine.h"
 #include "Engine/Engine.h"
 #include "UnrealEd/SceneManager.h"
+#include "Stats/Stats.h"
+#include "UObject/ObjectDuplication.h"
+#include "TickTaskManager.h"
 
 class UEditorEngine;
 
@@ -30,15 +33,28 @@ void UWorld::InitializeNewWorld()
 
 }
 
-UObject* UWorld::Duplicate(UObject* InOuter)
+void UWorld::DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator)
 {
-    // TODO: UWorld의 Duplicate는 역할 분리후 만드는것이 좋을듯
-    UWorld* NewWorld = Cast<UWorld>(Super::Duplicate(InOuter));
-    NewWorld->ActiveLevel = Cast<ULevel>(ActiveLevel->Duplicate(NewWorld));
-    NewWorld->ActiveLevel->InitLevel(NewWorld);
-    
-    
-    return NewWorld;
+    Super::DuplicateFrom(Source, Duplicator);
+
+    const UWorld* SourceWorld = static_cast<const UWorld*>(Source);
+
+    // Level, Actor, 컴포넌트 수만큼 Duplicator의 표와 등록 목록을 한 번에 늘립니다.
+    int32 NumObjects = 1;
+    for (const AActor* Actor : SourceWorld->ActiveLevel->Actors)
+    {
+        NumObjects += 1 + Actor->GetComponents().Num();
+    }
+    Duplicator.Reserve(NumObjects);
+
+    ActiveLevel = Duplicator.DuplicateObject(SourceWorld->ActiveLevel, this);
+}
+
+void UWorld::PostDuplicate()
+{
+    Super::PostDuplicate();
+
+    ActiveLevel->InitLevel(this);
 }
 
 void UWorld::Tick(float DeltaTime)
@@ -70,6 +86,13 @@ void UWorld::Release()
         GUObjectArray.MarkRemoveObject(ActiveLevel);
         ActiveLevel = nullptr;
     }
+    PrimitiveSceneIndex.Empty();
+
+    for (USceneComponent* Component : PendingTransformUpdates)
+    {
+        Component->bPendingTransformUpdate = false;
+    }
+    PendingTransformUpdates.Empty();
     
     GUObjectArray.ProcessPendingDestroyObjects();
 }
@@ -86,6 +109,9 @@ AActor* UWorld::SpawnActor(UClass* InClass, FName InActorName)
     // TODO: SpawnParams에서 이름 가져오거나, 필요시 여기서 자동 생성
     // if (SpawnParams.Name != NAME_None) ActorName = SpawnParams.Name;
     
+    // Worker에서는 UObject를 만들 수 없으므로 FTickTaskManager::EnqueueCommand로 Tick 그룹이 끝난 뒤에 Spawn해야 합니다.
+    assert(!FTickTaskManager::IsInParallelTick());
+
     if (InClass->IsChildOf<AActor>())
     {
         AActor* NewActor = Cast<AActor>(FObjectFactory::ConstructObject(InClass, this, InActorName));
@@ -94,6 +120,15 @@ AActor* UWorld::SpawnActor(UClass* InClass, FName InActorName)
         // Actor->InitializeComponents();
         ActiveLevel->Actors.Add(NewActor);
         PendingBeginPlayActors.Add(NewActor);
+
+        // Actor 생성자에서 추가된 Primitive는 이 시점에 World를 알 수 있으므로 여기서 등록합니다.
+        for (UActorComponent* Component : NewActor->GetComponents())
+        {
+            if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component))
+            {
+                PrimitiveSceneIndex.AddPrimitive(Primitive);
+            }
+        }
         return NewActor;
     }
     
@@ -112,6 +147,12 @@ bool UWorld::DestroyActor(AActor* ThisActor)
     {
         return true;
     }
+
+    if (FTickTaskManager::IsInParallelTick())
+    {
+        FTickTaskManager::Get().EnqueueCommand([ThisActor] { ThisActor->Destroy(); });
+        return true;
+    }
     
     // UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
     //
@@ -133,12 +174,63 @@ bool UWorld::DestroyActor(AActor* ThisActor)
 
     // World에서 제거
     ActiveLevel->Actors.Remove(ThisActor);
+    PendingBeginPlayActors.Remove(ThisActor);
 
     // 제거 대기열에 추가
     GUObjectArray.MarkRemoveObject(ThisActor);
     return true;
 }
 
+void UWorld::UpdateComponentTransforms()
+{
+    QUICK_SCOPE_CYCLE_COUNTER(UWorld_UpdateComponentTransforms);
+
+    for (USceneComponent* Component : PendingTransformUpdates)
+    {
+        Component->bPendingTransformUpdate = false;
+
+        // 조회 함수에서 이미 갱신되었을 수 있습니다.
+        if (!Component->bWorldTransformDirty)
+        {
+            continue;
+        }
+
+        // 등록된 뒤에 부모가 Dirty가 되었다면 Dirty 영역의 최상위부터 갱신합니다.
+        USceneComponent* Top = Component;
+        while (Top->AttachParent && Top->AttachParent->bWorldTransformDirty)
+        {
+            Top = Top->AttachParent;
+        }
+        Top->UpdateWorldTransformSubtree();
+    }
+    PendingTransformUpdates.Empty();
+}
+
+void UWorld::AddPendingTransformUpdate(USceneComponent* InComponent)
+{
+    if (!InComponent->bPendingTransformUpdate)
+    {
+        InComponent->bPendingTransformUpdate = true;
+        if (FTickThreadContext* Context = FTickTaskManager::GetThreadContext())
+        {
+            Context->PendingTransformUpdates.Add(InComponent);
+        }
+        else
+        {
+            PendingTransformUpdates.Add(InComponent);
+        }
+    }
+}
+
+void UWorld::RemovePendingTransformUpdate(USceneComponent* InComponent)
+{
+    if (InComponent->bPendingTransformUpdate)
+    {
+        InComponent->bPendingTransformUpdate = false;
+        PendingTransformUpdates.Remove(InComponent);
+    }
+}
+
 UWorld* UWorld::GetWorld() const
 {
     return const_cast<UWorld*>(this);
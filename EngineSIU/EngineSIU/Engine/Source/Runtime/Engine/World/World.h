@@ -5,6 +5,7 @@
 #include "UObject/ObjectMacros.h"
 #include "WorldType.h"
 #include "Level.h"
+#include "PrimitiveSceneIndex.h"
 
 class FObjectFactory;
 class AActor;
@@ -15,6 +16,8 @@ class UWorld : public UObject
 {
     DECLARE_CLASS(UWorld, UObject)
 
+    friend class FTickTaskManager;
+
 public:
     UWorld() = default;
 
@@ -22,7 +25,8 @@ public:
 
     void InitializeNewWorld();
 
-    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) override;
+    virtual void PostDuplicate() override;
 
     void Tick(float DeltaTime);
     void BeginPlay();
@@ -45,12 +49,22 @@ public:
         requires std::derived_from<T, AActor>
     T* SpawnActor();
 
-    /** World에 존재하는 Actor를 제거합니다. */
+    /** World에 존재하는 Actor를 제거합니다. 병렬 Tick 중이면 현재 Tick 그룹이 끝난 뒤에 제거합니다. */
     bool DestroyActor(AActor* ThisActor);
 
     virtual UWorld* GetWorld() const override;
     ULevel* GetActiveLevel() const { return ActiveLevel; }
 
+    /** World에 등록된 Primitive들의 공간 인덱스 */
+    FPrimitiveSceneIndex& GetPrimitiveSceneIndex() { return PrimitiveSceneIndex; }
+
+    /** 월드 Transform이 Dirty가 된 컴포넌트의 캐시를 부모에서 자식 순서로 한 번에 갱신합니다. */
+    void UpdateComponentTransforms();
+
+    /** USceneComponent::OnTransformChanged에서 호출됩니다. 병렬 Tick 중에는 스레드별 버퍼에 모았다가 Tick 그룹이 끝날 때 합칩니다. */
+    void AddPendingTransformUpdate(USceneComponent* InComponent);
+    void RemovePendingTransformUpdate(USceneComponent* InComponent);
+
     template <typename T>
         requires std::derived_from<T, AActor>
     T* DuplicateActor(T* InActor);
@@ -66,6 +80,11 @@ private:
     /** Actor가 Spawn되었고, 아직 BeginPlay가 호출되지 않은 Actor들 */
     TArray<AActor*> PendingBeginPlayActors;
 
+    FPrimitiveSceneIndex PrimitiveSceneIndex;
+
+    /** 월드 Transform을 다시 계산해야 하는 Dirty 영역의 최상위 컴포넌트들 */
+    TArray<USceneComponent*> PendingTransformUpdates;
+
 };
 
 
@@ -22,6 +22,10 @@ ATransformGizmo::ATransformGizmo()
     FManagerOBJ::CreateStaticMesh("Assets/GizmoScaleY.obj");
     FManagerOBJ::CreateStaticMesh("Assets/GizmoScaleZ.obj");
 
+    // 선택된 Actor가 이번 프레임에 움직인 뒤의 위치를 따라가고, 에디터 상태를 읽으므로 메인 스레드에서 실행합니다.
+    PrimaryActorTick.TickGroup = TG_PostUpdateWork;
+    PrimaryActorTick.bRunOnAnyThread = false;
+
     SetRootComponent(
         AddComponent<USceneComponent>()
     );
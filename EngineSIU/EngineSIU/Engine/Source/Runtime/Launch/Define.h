@@ -1,6 +1,8 @@
 #pragma once
+#include <cfloat>
 #include <cmath>
 #include <algorithm>
+#include <memory>
 #include "Core/Container/String.h"
 #include "Core/Container/Array.h"
 #include "UObject/NameTypes.h"
@@ -11,10 +13,17 @@
 #include "Math/Matrix.h"
 
 
+#if defined(_WIN32)
 #define _TCHAR_DEFINED
 #include <d3d11.h>
+#else
+// 헤드리스 빌드(Tests/CMakeLists.txt)에서는 D3D 리소스를 포인터로만 들고 있으므로 선언만 합니다.
+struct ID3D11Buffer;
+using UINT = unsigned int;
+#endif
 
 #include <Math/Color.h>
+#include "Components/Mesh/StaticMeshBVH.h"
 
 struct FStaticMeshVertex
 {
@@ -108,6 +117,8 @@ struct FObjMaterialInfo
     FWString AlphaTexturePath;
 };
 
+class FMappedFile;
+
 // Cooked Data
 namespace OBJ
 {
@@ -116,17 +127,33 @@ namespace OBJ
         FWString ObjectName;
         FString DisplayName;
 
+        /** OBJ에서 변환한 정점과 인덱스. Cook된 파일에서 읽었으면 비어 있으므로 GetVertexData / GetIndexData로 읽습니다. */
         TArray<FStaticMeshVertex> Vertices;
         TArray<UINT> Indices;
 
-        ID3D11Buffer* VertexBuffer;
-        ID3D11Buffer* IndexBuffer;
+        /** Cook된 파일에서 읽었으면 복사하지 않고 매핑한 파일 안의 정점과 인덱스를 가리킵니다. */
+        std::shared_ptr<const FMappedFile> CookedFile;
+        const FStaticMeshVertex* CookedVertices = nullptr;
+        const UINT* CookedIndices = nullptr;
+        uint32 NumCookedVertices = 0;
+        uint32 NumCookedIndices = 0;
+
+        const FStaticMeshVertex* GetVertexData() const { return CookedFile ? CookedVertices : Vertices.GetData(); }
+        uint32 GetNumVertices() const { return CookedFile ? NumCookedVertices : static_cast<uint32>(Vertices.Num()); }
+        const UINT* GetIndexData() const { return CookedFile ? CookedIndices : Indices.GetData(); }
+        uint32 GetNumIndices() const { return CookedFile ? NumCookedIndices : static_cast<uint32>(Indices.Num()); }
+
+        ID3D11Buffer* VertexBuffer = nullptr;
+        ID3D11Buffer* IndexBuffer = nullptr;
 
         TArray<FObjMaterialInfo> Materials;
         TArray<FMaterialSubset> MaterialSubsets;
 
         FVector BoundingBoxMin;
         FVector BoundingBoxMax;
+
+        /** 피킹에 사용하는 삼각형 BVH (메시 로컬 공간). Cook된 파일에 함께 저장합니다. */
+        FStaticMeshBVH TriangleBVH;
     };
 }
 
@@ -271,7 +298,6 @@ struct FPrimitiveCounts
     int pad1;
 };
 
-#define MAX_LIGHTS 16
 enum ELightType {
     POINT_LIGHT = 1,
     SPOT_LIGHT = 2
@@ -379,14 +405,24 @@ struct FSpotLightInfo
     FVector2D  pad4; 
 };
 
-#define NUM_POINT_LIGHT         4
-#define NUM_SPOT_LIGHT          4
+/**
+ * 점광원과 스포트라이트는 개수 제한 없이 Structured Buffer(t10, t11)로 올리고,
+ * 픽셀마다 사용할 Light 목록은 클러스터 버퍼(t12, t13)에서 찾습니다. 뒤쪽 값은 FLightClusterShaderParams와 같습니다.
+ */
 struct FLighting
 {
     FAmbientLightInfo AmbientLight;
     FDirectionalLightInfo DirectionalLight;
-    FPointLightInfo PointLights[NUM_POINT_LIGHT];
-    FSpotLightInfo SpotLights[NUM_SPOT_LIGHT];
+
+    uint32 NumPointLights;
+    uint32 NumSpotLights;
+    uint32 NumClustersX;
+    uint32 NumClustersY;
+
+    uint32 NumClustersZ;
+    float ClusterDepthScale;
+    float ClusterDepthBias;
+    uint32 bClusterLogDepth;
 };
 
 
@@ -431,11 +467,6 @@ struct FLitUnlitConstants {
     FVector pad;
 };
 
-struct FSubMeshConstants {
-    float isSelectedSubMesh;
-    FVector pad;
-};
-
 struct FTextureConstants {
     float UOffset;
     float VOffset;
@@ -13,6 +13,8 @@
 #include "Engine/EditorEngine.h"
 #include "Renderer/StaticMeshRenderPass.h"
 #include "World/World.h"
+#include "Async/JobSystem.h"
+#include "Stats/StatsData.h"
 
 
 extern LRESULT ImGui_ImplWin32_WndProcHandler(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
@@ -142,20 +144,50 @@ void FEngineLoop::Tick()
 
         float DeltaTime = elapsedTime / 1000.f;
 
-        GEngine->Tick(DeltaTime);
-        LevelEditor->Tick(DeltaTime);
-        Render();
-        UIMgr->BeginFrame();
-        UnrealEditor->Render();
+        {
+            QUICK_SCOPE_CYCLE_COUNTER(FEngineLoop_Frame);
+
+            {
+                // Worker Thread에서 끝난 작업의 결과를 반영합니다.
+                QUICK_SCOPE_CYCLE_COUNTER(FEngineLoop_MainThreadTasks);
+                FJobSystem::Get().ProcessMainThreadTasks();
+            }
+
+            {
+                QUICK_SCOPE_CYCLE_COUNTER(FEngineLoop_Tick);
+                GEngine->Tick(DeltaTime);
+                LevelEditor->Tick(DeltaTime);
+            }
+
+            {
+                QUICK_SCOPE_CYCLE_COUNTER(FEngineLoop_Render);
+                Render();
+            }
+
+            {
+                QUICK_SCOPE_CYCLE_COUNTER(FEngineLoop_UI);
+                UIMgr->BeginFrame();
+                UnrealEditor->Render();
 
-        Console::GetInstance().Draw();
+                Console::GetInstance().Draw();
+
+                UIMgr->EndFrame();
+            }
 
-        UIMgr->EndFrame();
+            // Pending 처리된 오브젝트 제거
+            GUObjectArray.ProcessPendingDestroyObjects();
 
-        // Pending 처리된 오브젝트 제거
-        GUObjectArray.ProcessPendingDestroyObjects();
+            {
+                QUICK_SCOPE_CYCLE_COUNTER(FEngineLoop_Present);
+                GraphicDevice.SwapBuffer();
+            }
+
+            // 이전 프레임들에 요청한 UUID 읽기 중 GPU 복사가 끝난 것의 결과를 전달합니다.
+            GraphicDevice.TickUUIDReadback();
+        }
 
-        GraphicDevice.SwapBuffer();
+        // 모든 스레드의 Stat 이벤트를 모아 이번 프레임의 Call Tree를 만듭니다.
+        FStatsThreadState::Get().AdvanceFrame();
 
 #if _DEBUG
         if (bIsEnableShaderHotReload)
@@ -182,6 +214,7 @@ float FEngineLoop::GetAspectRatio(IDXGISwapChain* swapChain) const
 
 void FEngineLoop::Exit()
 {
+    FJobSystem::Get().Shutdown();
     LevelEditor->Release();
     UIMgr->Shutdown();
     delete UIMgr;
@@ -1,16 +1,52 @@
 #include "Core/HAL/PlatformType.h"
 #include "EngineLoop.h"
+#include "Async/JobSystem.h"
+#include "Engine/AssetManager.h"
 
 FEngineLoop GEngineLoop;
 
+/**
+ * 창과 GPU 없이 Contents/의 모든 Asset을 로드하고 시간을 출력합니다.
+ * 사용법: EngineSIU.exe -WarmupAssets
+ */
+static int32 RunHeadlessAssetWarmup()
+{
+    // 콘솔에서 실행한 경우 그 콘솔에 출력합니다.
+    if (AttachConsole(ATTACH_PARENT_PROCESS))
+    {
+        FILE* Stream;
+        freopen_s(&Stream, "CONOUT$", "w", stdout);
+    }
+
+    const FAssetWarmupReport Report = UAssetManager::RunHeadlessWarmup("Contents/");
+    FJobSystem::Get().Shutdown();
+
+    int32 NumFailed = 0;
+    for (const FAssetLoadRecord& Asset : Report.Assets)
+    {
+        printf("%-60s %10.2f ms%s\n", *Asset.AssetPath, Asset.CPUTimeMs, Asset.bSucceeded ? "" : "  FAILED");
+        NumFailed += Asset.bSucceeded ? 0 : 1;
+    }
+    printf("%d assets, %d workers\n", Report.Assets.Num(), Report.NumWorkers);
+    printf("Wall: %.2f ms, CPU (sum): %.2f ms, Speedup: %.2fx\n",
+        Report.WallTimeMs, Report.TotalCPUTimeMs, Report.WallTimeMs > 0.0 ? Report.TotalCPUTimeMs / Report.WallTimeMs : 0.0);
+    fflush(stdout);
+
+    return NumFailed == 0 ? 0 : 1;
+}
+
 
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nShowCmd)
 {
     // 사용 안하는 파라미터들
     UNREFERENCED_PARAMETER(hPrevInstance);
-    UNREFERENCED_PARAMETER(lpCmdLine);
     UNREFERENCED_PARAMETER(nShowCmd);
 
+    if (lpCmdLine && strstr(lpCmdLine, "-WarmupAssets"))
+    {
+        return RunHeadlessAssetWarmup();
+    }
+
     GEngineLoop.Init(hInstance);
     GEngineLoop.Tick();
     GEngineLoop.Exit();
@@ -0,0 +1,55 @@
+#include "BillboardDrawList.h"
+
+void FBillboardDrawList::Reset()
+{
+    Items.Empty();
+    Batches.Empty();
+    BatchIndices.Empty();
+}
+
+void FBillboardDrawList::AddBillboard(ID3D11ShaderResourceView* TextureSRV, ID3D11SamplerState* SamplerState, const FBillboardInstanceData& Instance)
+{
+    // 같은 Texture의 Billboard가 연달아 들어오는 경우가 많으므로, 직전 항목과 같으면 Map을 찾지 않습니다.
+    uint32 BatchIndex;
+    if (!Items.IsEmpty() && Batches[Items[Items.Num() - 1].BatchIndex].TextureSRV == TextureSRV)
+    {
+        BatchIndex = Items[Items.Num() - 1].BatchIndex;
+    }
+    else if (const uint32* Found = BatchIndices.Find(TextureSRV))
+    {
+        BatchIndex = *Found;
+    }
+    else
+    {
+        FBillboardDrawBatch Batch;
+        Batch.TextureSRV = TextureSRV;
+        Batch.SamplerState = SamplerState;
+        BatchIndex = static_cast<uint32>(Batches.Add(Batch));
+        BatchIndices.Add(TextureSRV, BatchIndex);
+    }
+
+    ++Batches[BatchIndex].NumInstances;
+    Items.Add({ Instance, BatchIndex });
+}
+
+void FBillboardDrawList::BuildBatches(TArray<FBillboardInstanceData>& OutInstances, TArray<FBillboardDrawBatch>& OutBatches) const
+{
+    OutBatches = Batches;
+
+    uint32 FirstInstance = 0;
+    for (FBillboardDrawBatch& Batch : OutBatches)
+    {
+        Batch.FirstInstance = FirstInstance;
+        FirstInstance += Batch.NumInstances;
+        // 아래에서 Instance를 채우는 위치로 다시 셉니다.
+        Batch.NumInstances = 0;
+    }
+
+    OutInstances.SetNum(Items.Num());
+    for (const FDrawItem& Item : Items)
+    {
+        FBillboardDrawBatch& Batch = OutBatches[Item.BatchIndex];
+        OutInstances[Batch.FirstInstance + Batch.NumInstances] = Item.Instance;
+        ++Batch.NumInstances;
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "Define.h"
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Math/Vector.h"
+#include "Math/Vector4.h"
+
+struct ID3D11ShaderResourceView;
+struct ID3D11SamplerState;
+
+/**
+ * Instance Vertex Buffer에 그대로 복사되는 Billboard 하나의 데이터.
+ * VertexBillboardInstanceShader.hlsl의 INSTANCE_* 입력과 배치가 같아야 합니다.
+ */
+struct FBillboardInstanceData
+{
+    /** 사각형 중심의 월드 위치 */
+    FVector Position;
+
+    /** 카메라 오른쪽, 위쪽 방향으로의 반 크기. 공유 Quad가 [-1, 1] 범위라서 Scale을 그대로 씁니다. */
+    FVector2D Size;
+
+    /** Texture UV = Quad UV * UVScale + UVOffset */
+    FVector2D UVOffset;
+    FVector2D UVScale;
+
+    FVector4 UUIDColor;
+};
+
+/** 같은 Texture를 쓰는 Billboard들을 그리는 DrawIndexedInstanced 호출 하나. Instance 범위는 [FirstInstance, FirstInstance + NumInstances)입니다. */
+struct FBillboardDrawBatch
+{
+    ID3D11ShaderResourceView* TextureSRV = nullptr;
+    ID3D11SamplerState* SamplerState = nullptr;
+    uint32 FirstInstance = 0;
+    uint32 NumInstances = 0;
+};
+
+/**
+ * Billboard Pass가 한 프레임에 그릴 Billboard 목록.
+ * 추가할 때 Texture별 Batch 번호를 정해 두고, BuildBatches에서 Texture별로 이어지도록 Instance를 옮겨 담습니다.
+ * 묶는 작업은 CPU에서만 이루어지고, GPU 제출은 FBillboardRenderPass가 담당합니다.
+ */
+class FBillboardDrawList
+{
+public:
+    void Reset();
+
+    void AddBillboard(ID3D11ShaderResourceView* TextureSRV, ID3D11SamplerState* SamplerState, const FBillboardInstanceData& Instance);
+
+    /**
+     * Texture를 처음 추가한 순서대로 Batch를 만들고, 각 Batch 범위에 해당 Texture의 Instance를 추가한 순서대로 채웁니다.
+     * Texture마다 Batch가 정확히 하나 만들어집니다.
+     */
+    void BuildBatches(TArray<FBillboardInstanceData>& OutInstances, TArray<FBillboardDrawBatch>& OutBatches) const;
+
+    int32 Num() const { return Items.Num(); }
+    int32 NumBatches() const { return Batches.Num(); }
+
+private:
+    struct FDrawItem
+    {
+        FBillboardInstanceData Instance;
+        uint32 BatchIndex;
+    };
+
+    TArray<FDrawItem> Items;
+
+    /** Texture별 Batch. NumInstances는 해당 Texture로 추가된 Billboard 수입니다. */
+    TArray<FBillboardDrawBatch> Batches;
+    TMap<const ID3D11ShaderResourceView*, uint32> BatchIndices;
+};
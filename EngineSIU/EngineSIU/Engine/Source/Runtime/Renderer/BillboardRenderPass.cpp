@@ -6,14 +6,12 @@
 
 #include "RendererHelpers.h"
 
-#include "UObject/UObjectIterator.h"
 #include "UObject/Casts.h"
 
 #include "UnrealEd/EditorViewportClient.h"
 #include "PropertyEditor/ShowFlags.h"
 
 #include "Components/BillboardComponent.h"
-#include "Components/ParticleSubUVComponent.h"
 #include "Components/TextComponent.h"
 #include "Engine/EditorEngine.h"
 
@@ -28,13 +26,21 @@ FBillboardRenderPass::FBillboardRenderPass()
     , VertexShader(nullptr)
     , PixelShader(nullptr)
     , InputLayout(nullptr)
+    , InstanceVertexShader(nullptr)
+    , InstanceInputLayout(nullptr)
     , Stride(0)
+    , BillboardInstanceBuffer(nullptr)
+    , BillboardInstanceBufferCapacity(0)
+    , TextVertexBuffer(nullptr)
+    , TextVertexBufferCapacity(0)
 {
 }
 
 FBillboardRenderPass::~FBillboardRenderPass()
 {
     ReleaseShader();
+    FDXDBufferManager::SafeRelease(BillboardInstanceBuffer);
+    FDXDBufferManager::SafeRelease(TextVertexBuffer);
 }
 
 void FBillboardRenderPass::Initialize(FDXDBufferManager* InBufferManager, FGraphicsDevice* InGraphics, FDXDShaderManager* InShaderManager)
@@ -47,14 +53,53 @@ void FBillboardRenderPass::Initialize(FDXDBufferManager* InBufferManager, FGraph
 
 void FBillboardRenderPass::PrepareRender()
 {
-    BillboardObjs.Empty();
-    for (const auto iter : TObjectRange<UBillboardComponent>())
+    BillboardDrawList.Reset();
+    BillboardInstances.Empty();
+    BillboardBatches.Empty();
+    TextObjs.Empty();
+    if (!GEngine->ActiveWorld)
     {
-        if (iter->GetWorld() == GEngine->ActiveWorld)
+        return;
+    }
+
+    // Billboard는 별도의 Bounds가 없으므로 공간 쿼리 없이 World에 종류별로 등록된 목록을 그대로 사용합니다.
+    const FPrimitiveSceneIndex& SceneIndex = GEngine->ActiveWorld->GetPrimitiveSceneIndex();
+    for (UPrimitiveComponent* Primitive : SceneIndex.GetPrimitives(EScenePrimitiveType::Text))
+    {
+        UTextComponent* TextComp = static_cast<UTextComponent*>(Primitive);
+        if (TextComp->Texture && !TextComp->GetText().empty())
+        {
+            TextObjs.Add(TextComp);
+        }
+    }
+
+    for (UPrimitiveComponent* Primitive : SceneIndex.GetPrimitives(EScenePrimitiveType::Billboard))
+    {
+        UBillboardComponent* BillboardComp = static_cast<UBillboardComponent*>(Primitive);
+        if (!BillboardComp->Texture)
         {
-            BillboardObjs.Add(iter);
+            continue;
         }
+
+        // 방향은 Vertex Shader가 카메라에서 구하므로, 뷰와 무관한 값만 모읍니다.
+        const FVector Scale = BillboardComp->GetRelativeScale3D();
+        FBillboardInstanceData Instance;
+        Instance.Position = BillboardComp->GetBillboardLocation();
+        Instance.Size = FVector2D(Scale.X, Scale.Y);
+        Instance.UVOffset = BillboardComp->GetUVOffset();
+        Instance.UVScale = BillboardComp->GetUVScale();
+        Instance.UUIDColor = BillboardComp->EncodeUUID() / 255.0f;
+
+        BillboardDrawList.AddBillboard(BillboardComp->Texture->TextureSRV, BillboardComp->Texture->SamplerState, Instance);
     }
+
+    BillboardDrawList.BuildBatches(BillboardInstances, BillboardBatches);
+
+    // 같은 폰트 Texture를 쓰는 Text가 이어지도록 정렬해서 Texture마다 Draw 한 번으로 그립니다.
+    TextObjs.Sort([](const UTextComponent* A, const UTextComponent* B)
+    {
+        return A->Texture->TextureSRV < B->Texture->TextureSRV;
+    });
 }
 
 void FBillboardRenderPass::PrepareTextureShader() const
@@ -63,13 +108,13 @@ void FBillboardRenderPass::PrepareTextureShader() const
     Graphics->DeviceContext->PSSetShader(PixelShader, nullptr, 0);
     Graphics->DeviceContext->IASetInputLayout(InputLayout);
 
-    BufferManager->BindConstantBuffer(TEXT("FPerObjectConstantBuffer"), 0, EShaderStage::Vertex);
+    BufferManager->BindConstantBuffer<FPerObjectConstantBuffer>(0, EShaderStage::Vertex);
 }
 
 void FBillboardRenderPass::PrepareSubUVConstant() const
 {
-    BufferManager->BindConstantBuffer(TEXT("FSubUVConstant"), 1, EShaderStage::Vertex);
-    BufferManager->BindConstantBuffer(TEXT("FSubUVConstant"), 1, EShaderStage::Pixel);
+    BufferManager->BindConstantBuffer<FSubUVConstant>(1, EShaderStage::Vertex);
+    BufferManager->BindConstantBuffer<FSubUVConstant>(1, EShaderStage::Pixel);
 }
 
 void FBillboardRenderPass::UpdateSubUVConstant(FVector2D uvOffset, FVector2D uvScale) const
@@ -78,7 +123,7 @@ void FBillboardRenderPass::UpdateSubUVConstant(FVector2D uvOffset, FVector2D uvS
     data.uvOffset = uvOffset;
     data.uvScale = uvScale;
 
-    BufferManager->UpdateConstantBuffer(TEXT("FSubUVConstant"), data);
+    BufferManager->UpdateConstantBuffer(data);
 }
 
 void FBillboardRenderPass::UpdatePerObjectConstant(const FMatrix& Model, const FMatrix& View, const FMatrix& Projection, const FVector4& UUIDColor, bool Selected) const
@@ -87,26 +132,181 @@ void FBillboardRenderPass::UpdatePerObjectConstant(const FMatrix& Model, const F
     FMatrix NormalMatrix = RendererHelpers::CalculateNormalMatrix(Model);
     FPerObjectConstantBuffer data(MVP, NormalMatrix, UUIDColor, Selected);
 
-    BufferManager->UpdateConstantBuffer(TEXT("FPerObjectConstantBuffer"), data);
+    BufferManager->UpdateConstantBuffer(data);
 }
 
-void FBillboardRenderPass::RenderTexturePrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, ID3D11Buffer* pIndexBuffer, UINT numIndices, ID3D11ShaderResourceView* TextureSRV, ID3D11SamplerState* SamplerState) const
+void FBillboardRenderPass::RenderBillboardBatches(const std::shared_ptr<FEditorViewportClient>& Viewport)
 {
-    SetupVertexBuffer(pVertexBuffer, numVertices);
+    const uint32 NumInstances = static_cast<uint32>(BillboardInstances.Num());
+    if (NumInstances == 0 || !ReserveBillboardInstanceBuffer(NumInstances))
+    {
+        return;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE Mapped;
+    if (FAILED(Graphics->DeviceContext->Map(BillboardInstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+    {
+        return;
+    }
+    memcpy(Mapped.pData, BillboardInstances.GetData(), sizeof(FBillboardInstanceData) * NumInstances);
+    Graphics->DeviceContext->Unmap(BillboardInstanceBuffer, 0);
+
+    Graphics->DeviceContext->VSSetShader(InstanceVertexShader, nullptr, 0);
+    Graphics->DeviceContext->PSSetShader(PixelShader, nullptr, 0);
+    Graphics->DeviceContext->IASetInputLayout(InstanceInputLayout);
+
+    FCameraConstantBuffer CameraData(Viewport->GetViewMatrix(), Viewport->GetProjectionMatrix(), Viewport->ViewTransformPerspective.GetLocation(), 0);
+    BufferManager->UpdateConstantBuffer(CameraData);
+    BufferManager->BindConstantBuffer<FCameraConstantBuffer>(0, EShaderStage::Vertex);
+
+    // UV는 Vertex Shader에서 Instance 값으로 계산하므로 Pixel Shader의 SubUV 변환은 항등으로 둡니다.
+    UpdateSubUVConstant(FVector2D(), FVector2D(1, 1));
+
+    FVertexInfo VertexInfo;
+    FIndexInfo IndexInfo;
+    BufferManager->GetQuadBuffer(VertexInfo, IndexInfo);
+
+    ID3D11Buffer* VertexBuffers[2] = { VertexInfo.VertexBuffer, BillboardInstanceBuffer };
+    const UINT Strides[2] = { Stride, sizeof(FBillboardInstanceData) };
+    const UINT Offsets[2] = { 0, 0 };
+    Graphics->DeviceContext->IASetVertexBuffers(0, 2, VertexBuffers, Strides, Offsets);
+    Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, DXGI_FORMAT_R16_UINT, 0);
+    Graphics->DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+    for (const FBillboardDrawBatch& Batch : BillboardBatches)
+    {
+        Graphics->DeviceContext->PSSetShaderResources(0, 1, &Batch.TextureSRV);
+        Graphics->DeviceContext->PSSetSamplers(0, 1, &Batch.SamplerState);
+        Graphics->DeviceContext->DrawIndexedInstanced(IndexInfo.NumIndices, Batch.NumInstances, 0, 0, Batch.FirstInstance);
+    }
+}
+
+bool FBillboardRenderPass::ReserveBillboardInstanceBuffer(uint32 NumInstances)
+{
+    if (BillboardInstanceBuffer && NumInstances <= BillboardInstanceBufferCapacity)
+    {
+        return true;
+    }
+
+    uint32 NewCapacity = FMath::Max(BillboardInstanceBufferCapacity * 2, 256u);
+    while (NewCapacity < NumInstances)
+    {
+        NewCapacity *= 2;
+    }
+
+    D3D11_BUFFER_DESC Desc = {};
+    Desc.ByteWidth = sizeof(FBillboardInstanceData) * NewCapacity;
+    Desc.Usage = D3D11_USAGE_DYNAMIC;
+    Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    ID3D11Buffer* NewBuffer = nullptr;
+    if (FAILED(Graphics->Device->CreateBuffer(&Desc, nullptr, &NewBuffer)))
+    {
+        UE_LOG(LogLevel::Error, TEXT("Failed to create billboard instance buffer (%u instances)"), NewCapacity);
+        return false;
+    }
+
+    FDXDBufferManager::SafeRelease(BillboardInstanceBuffer);
+    BillboardInstanceBuffer = NewBuffer;
+    BillboardInstanceBufferCapacity = NewCapacity;
+    return true;
+}
+
+void FBillboardRenderPass::RenderTextBatch(const std::shared_ptr<FEditorViewportClient>& Viewport)
+{
+    TextVertices.Empty();
+    TextBatches.Empty();
+
+    // 정점을 Viewport마다 다시 만들므로, 활성 Viewport가 아니라 지금 그리는 Viewport의 카메라를 바라보게 합니다.
+    const FMatrix& ViewMatrix = Viewport->GetViewMatrix();
+    for (UTextComponent* TextComp : TextObjs)
+    {
+        const FGlyphAtlas& Atlas = GetGlyphAtlas(static_cast<int32>(TextComp->GetColumnCount()), static_cast<int32>(TextComp->GetRowCount()));
+        const TArray<FTextGlyphQuad>& Quads = TextLayoutCache.FindOrLayout(TextComp->GetText(), Atlas, TextComp->GetQuadWidth(), TextComp->GetQuadHeight());
+        if (Quads.IsEmpty())
+        {
+            continue;
+        }
+
+        const uint32 FirstVertex = static_cast<uint32>(TextVertices.Num());
+        TextLayout::AppendQuadVertices(Quads, TextComp->CreateBillboardMatrix(ViewMatrix), TextVertices);
+
+        ID3D11ShaderResourceView* TextureSRV = TextComp->Texture->TextureSRV;
+        if (TextBatches.IsEmpty() || TextBatches[TextBatches.Num() - 1].TextureSRV != TextureSRV)
+        {
+            TextBatches.Add({ TextureSRV, TextComp->Texture->SamplerState, FirstVertex, 0 });
+        }
+        TextBatches[TextBatches.Num() - 1].NumVertices += static_cast<uint32>(TextVertices.Num()) - FirstVertex;
+    }
+
+    const uint32 NumVertices = static_cast<uint32>(TextVertices.Num());
+    if (NumVertices == 0 || !ReserveTextVertexBuffer(NumVertices))
+    {
+        return;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE Mapped;
+    if (FAILED(Graphics->DeviceContext->Map(TextVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+    {
+        return;
+    }
+    memcpy(Mapped.pData, TextVertices.GetData(), sizeof(FVertexTexture) * NumVertices);
+    Graphics->DeviceContext->Unmap(TextVertexBuffer, 0);
 
-    Graphics->DeviceContext->IASetIndexBuffer(pIndexBuffer, DXGI_FORMAT_R16_UINT, 0);
-    Graphics->DeviceContext->PSSetShaderResources(0, 1, &TextureSRV);
-    Graphics->DeviceContext->PSSetSamplers(0, 1, &SamplerState);
-    Graphics->DeviceContext->DrawIndexed(numIndices, 0, 0);
+    // 정점이 이미 월드 공간에 있으므로 Model 없이 View, Projection만 적용합니다.
+    UpdatePerObjectConstant(FMatrix::Identity, ViewMatrix, Viewport->GetProjectionMatrix(), FVector4(0, 0, 0, 0), false);
+    UpdateSubUVConstant(FVector2D(), FVector2D(1, 1));
+
+    SetupVertexBuffer(TextVertexBuffer, NumVertices);
+    for (const FTextDrawBatch& Batch : TextBatches)
+    {
+        Graphics->DeviceContext->PSSetShaderResources(0, 1, &Batch.TextureSRV);
+        Graphics->DeviceContext->PSSetSamplers(0, 1, &Batch.SamplerState);
+        Graphics->DeviceContext->Draw(Batch.NumVertices, Batch.FirstVertex);
+    }
 }
 
-void FBillboardRenderPass::RenderTextPrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, ID3D11ShaderResourceView* TextureSRV, ID3D11SamplerState* SamplerState) const
+bool FBillboardRenderPass::ReserveTextVertexBuffer(uint32 NumVertices)
 {
-    SetupVertexBuffer(pVertexBuffer, numVertices);
+    if (TextVertexBuffer && NumVertices <= TextVertexBufferCapacity)
+    {
+        return true;
+    }
 
-    Graphics->DeviceContext->PSSetShaderResources(0, 1, &TextureSRV);
-    Graphics->DeviceContext->PSSetSamplers(0, 1, &SamplerState);
-    Graphics->DeviceContext->Draw(numVertices, 0);
+    uint32 NewCapacity = FMath::Max(TextVertexBufferCapacity * 2, 1536u);
+    while (NewCapacity < NumVertices)
+    {
+        NewCapacity *= 2;
+    }
+
+    D3D11_BUFFER_DESC Desc = {};
+    Desc.ByteWidth = sizeof(FVertexTexture) * NewCapacity;
+    Desc.Usage = D3D11_USAGE_DYNAMIC;
+    Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    ID3D11Buffer* NewBuffer = nullptr;
+    if (FAILED(Graphics->Device->CreateBuffer(&Desc, nullptr, &NewBuffer)))
+    {
+        UE_LOG(LogLevel::Error, TEXT("Failed to create text vertex buffer (%u vertices)"), NewCapacity);
+        return false;
+    }
+
+    FDXDBufferManager::SafeRelease(TextVertexBuffer);
+    TextVertexBuffer = NewBuffer;
+    TextVertexBufferCapacity = NewCapacity;
+    return true;
+}
+
+const FGlyphAtlas& FBillboardRenderPass::GetGlyphAtlas(int32 ColumnCount, int32 RowCount)
+{
+    const uint64 Key = (static_cast<uint64>(static_cast<uint32>(ColumnCount)) << 32) | static_cast<uint32>(RowCount);
+    if (const FGlyphAtlas* Found = GlyphAtlases.Find(Key))
+    {
+        return *Found;
+    }
+    return GlyphAtlases.Emplace(Key, FGlyphAtlas(ColumnCount, RowCount));
 }
 
 void FBillboardRenderPass::CreateShader()
@@ -117,14 +317,28 @@ void FBillboardRenderPass::CreateShader()
         {"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0}
     };
 
+    // 공유 Quad(Slot 0) + FBillboardInstanceData(Slot 1)
+    D3D11_INPUT_ELEMENT_DESC InstanceLayoutDesc[] = {
+        {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"INSTANCE_POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 1, offsetof(FBillboardInstanceData, Position), D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_SIZE", 0, DXGI_FORMAT_R32G32_FLOAT, 1, offsetof(FBillboardInstanceData, Size), D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_UV_OFFSET", 0, DXGI_FORMAT_R32G32_FLOAT, 1, offsetof(FBillboardInstanceData, UVOffset), D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_UV_SCALE", 0, DXGI_FORMAT_R32G32_FLOAT, 1, offsetof(FBillboardInstanceData, UVScale), D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_UUID", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, offsetof(FBillboardInstanceData, UUIDColor), D3D11_INPUT_PER_INSTANCE_DATA, 1},
+    };
+
     Stride = sizeof(FVertexTexture);
 
     HRESULT hr = ShaderManager->AddVertexShaderAndInputLayout(L"VertexBillboardShader", L"Shaders/VertexBillboardShader.hlsl", "main", TextureLayoutDesc, ARRAYSIZE(TextureLayoutDesc));
 
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"VertexBillboardInstanceShader", L"Shaders/VertexBillboardInstanceShader.hlsl", "main", InstanceLayoutDesc, ARRAYSIZE(InstanceLayoutDesc));
+
     hr = ShaderManager->AddPixelShader(L"PixelBillboardShader", L"Shaders/PixelBillboardShader.hlsl", "main");
 
     ReloadShader();
     InputLayout = ShaderManager->GetInputLayoutByKey(L"VertexBillboardShader");
+    InstanceInputLayout = ShaderManager->GetInputLayoutByKey(L"VertexBillboardInstanceShader");
 }
 
 void FBillboardRenderPass::ReleaseShader()
@@ -132,59 +346,20 @@ void FBillboardRenderPass::ReleaseShader()
     FDXDBufferManager::SafeRelease(InputLayout);
     FDXDBufferManager::SafeRelease(PixelShader);
     FDXDBufferManager::SafeRelease(VertexShader);
+    FDXDBufferManager::SafeRelease(InstanceInputLayout);
+    FDXDBufferManager::SafeRelease(InstanceVertexShader);
 }
 
 void FBillboardRenderPass::Render(const std::shared_ptr<FEditorViewportClient>& Viewport)
 {
     if (!(Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_BillboardText))) return;
 
-    PrepareTextureShader();
-
     PrepareSubUVConstant();
 
-    FVertexInfo VertexInfo;
-    FIndexInfo IndexInfo;
-
-    BufferManager->GetQuadBuffer(VertexInfo, IndexInfo);
-
-    // 각 Billboard에 대해 렌더링 처리
-    for (auto BillboardComp : BillboardObjs)
-    {
-        FMatrix Model = BillboardComp->CreateBillboardMatrix();
-        FVector4 UUIDColor = BillboardComp->EncodeUUID() / 255.0f;
-
-        bool Selected = (BillboardComp == Viewport->GetPickedGizmoComponent());
-
-        UpdatePerObjectConstant(Model, Viewport->GetViewMatrix(), Viewport->GetProjectionMatrix(), UUIDColor, Selected);
+    RenderBillboardBatches(Viewport);
 
-        if (UParticleSubUVComponent* SubUVParticle = Cast<UParticleSubUVComponent>(BillboardComp))
-        {
-            UpdateSubUVConstant(SubUVParticle->GetUVOffset(), SubUVParticle->GetUVScale());
-
-            RenderTexturePrimitive(VertexInfo.VertexBuffer, VertexInfo.NumVertices, IndexInfo.IndexBuffer,
-                IndexInfo.NumIndices, SubUVParticle->Texture->TextureSRV, SubUVParticle->Texture->SamplerState);
-        }
-        else if (UTextComponent* TextComp = Cast<UTextComponent>(BillboardComp))
-        {
-            FBufferInfo Buffers;
-            float Height = TextComp->Texture->Height;
-            float Width = TextComp->Texture->Width;
-            BufferManager->CreateUnicodeTextBuffer(TextComp->GetText(), Buffers, Width, Height, TextComp->GetColumnCount(), TextComp->GetRowCount());
-
-            UpdateSubUVConstant(FVector2D(), FVector2D(1, 1));
-
-            RenderTextPrimitive(Buffers.VertexInfo.VertexBuffer, Buffers.VertexInfo.NumVertices, TextComp->Texture->TextureSRV, TextComp->Texture->SamplerState);
-
-        }
-        else
-        {
-            UpdateSubUVConstant(FVector2D(BillboardComp->finalIndexU, BillboardComp->finalIndexV), FVector2D(1, 1));
-
-            RenderTexturePrimitive(VertexInfo.VertexBuffer, VertexInfo.NumVertices,
-                IndexInfo.IndexBuffer, IndexInfo.NumIndices, BillboardComp->Texture->TextureSRV,
-                BillboardComp->Texture->SamplerState);
-        }
-    }
+    PrepareTextureShader();
+    RenderTextBatch(Viewport);
 }
 void FBillboardRenderPass::SetupVertexBuffer(ID3D11Buffer* pVertexBuffer, UINT numVertices) const
 {
@@ -195,11 +370,15 @@ void FBillboardRenderPass::SetupVertexBuffer(ID3D11Buffer* pVertexBuffer, UINT n
 
 void FBillboardRenderPass::ClearRenderArr()
 {
-    BillboardObjs.Empty();
+    BillboardDrawList.Reset();
+    BillboardInstances.Empty();
+    BillboardBatches.Empty();
+    TextObjs.Empty();
 }
 
 void FBillboardRenderPass::ReloadShader()
 {
     VertexShader = ShaderManager->GetVertexShaderByKey(L"VertexBillboardShader");
+    InstanceVertexShader = ShaderManager->GetVertexShaderByKey(L"VertexBillboardInstanceShader");
     PixelShader = ShaderManager->GetPixelShaderByKey(L"PixelBillboardShader");
 }
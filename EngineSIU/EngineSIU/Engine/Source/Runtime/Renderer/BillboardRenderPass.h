@@ -3,10 +3,14 @@
 #include "IRenderPass.h"
 #include "EngineBaseTypes.h"
 #include "Container/Set.h"
+#include "Container/Map.h"
+#include "BillboardDrawList.h"
+#include "TextLayout.h"
 
 #include "Define.h"
 
 class UBillboardComponent;
+class UTextComponent;
 class FDXDBufferManager;
 class FGraphicsDevice;
 class FDXDShaderManager;
@@ -35,20 +39,60 @@ public:
 
     // 상수 버퍼 업데이트 함수
     void UpdateSubUVConstant(FVector2D uvOffset, FVector2D uvScale) const;
-    
-    // Primitive 드로우 함수
-    void RenderTexturePrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices,
-        ID3D11Buffer* pIndexBuffer, UINT numIndices,
-        ID3D11ShaderResourceView* _TextureSRV, ID3D11SamplerState* _SamplerState) const;
-
-    void RenderTextPrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices,
-        ID3D11ShaderResourceView* _TextureSRV, ID3D11SamplerState* _SamplerState) const;
 
     void CreateShader();
     void ReleaseShader();
 
+    const FTextLayoutCache& GetTextLayoutCache() const { return TextLayoutCache; }
+
 private:
-    TArray<UBillboardComponent*> BillboardObjs;
+    /** Billboard Instance를 Instance Buffer에 올리고, Texture마다 공유 Quad를 DrawIndexedInstanced로 한 번씩 그립니다. */
+    void RenderBillboardBatches(const std::shared_ptr<FEditorViewportClient>& Viewport);
+
+    /** Billboard Instance Buffer가 NumInstances개를 담을 수 있도록 필요하면 다시 만듭니다. */
+    bool ReserveBillboardInstanceBuffer(uint32 NumInstances);
+
+    /** 모든 Text 컴포넌트의 글자를 월드 공간 정점으로 모아 Text Vertex Buffer에 올리고, 폰트 Texture마다 한 번씩 그립니다. */
+    void RenderTextBatch(const std::shared_ptr<FEditorViewportClient>& Viewport);
+
+    /** Text Vertex Buffer가 NumVertices개를 담을 수 있도록 필요하면 다시 만듭니다. */
+    bool ReserveTextVertexBuffer(uint32 NumVertices);
+
+    /** ColumnCount x RowCount 격자 Atlas의 글자 표. 처음 요청할 때 만듭니다. */
+    const FGlyphAtlas& GetGlyphAtlas(int32 ColumnCount, int32 RowCount);
+
+private:
+    /** 같은 폰트 Texture를 쓰는 Text 정점 범위. Draw 한 번으로 그립니다. */
+    struct FTextDrawBatch
+    {
+        ID3D11ShaderResourceView* TextureSRV;
+        ID3D11SamplerState* SamplerState;
+        uint32 FirstVertex;
+        uint32 NumVertices;
+    };
+
+    /** Text를 제외한 Billboard. PrepareRender에서 Texture별로 묶어 BillboardInstances와 BillboardBatches를 만듭니다. */
+    FBillboardDrawList BillboardDrawList;
+    TArray<FBillboardInstanceData> BillboardInstances;
+    TArray<FBillboardDrawBatch> BillboardBatches;
+
+    /** 모든 Billboard의 Instance 데이터를 담는 Dynamic Vertex Buffer (Input Slot 1) */
+    ID3D11Buffer* BillboardInstanceBuffer;
+    uint32 BillboardInstanceBufferCapacity;
+
+    /** 폰트 Texture 순서로 정렬된 Text 컴포넌트 */
+    TArray<UTextComponent*> TextObjs;
+
+    TMap<uint64, FGlyphAtlas> GlyphAtlases;
+    FTextLayoutCache TextLayoutCache;
+
+    /** 매 프레임 다시 채우는 Text 정점과 Draw 범위. 할당은 프레임 사이에 재사용합니다. */
+    TArray<FVertexTexture> TextVertices;
+    TArray<FTextDrawBatch> TextBatches;
+
+    /** 모든 Text의 정점을 담는 Dynamic Vertex Buffer */
+    ID3D11Buffer* TextVertexBuffer;
+    uint32 TextVertexBufferCapacity;
 
     ID3D11VertexShader* VertexShader;
     
@@ -56,6 +100,11 @@ private:
     
     ID3D11InputLayout* InputLayout;
 
+    /** 카메라를 바라보는 방향을 Vertex Shader에서 계산하는 Billboard Instancing 셰이더 */
+    ID3D11VertexShader* InstanceVertexShader;
+
+    ID3D11InputLayout* InstanceInputLayout;
+
     uint32 Stride;
 
     FDXDBufferManager* BufferManager;
@@ -142,8 +142,8 @@ void FDepthBufferDebugPass::UpdateScreenConstant(const D3D11_VIEWPORT& viewport)
     sc.UVScale = { viewport.Width / sw, viewport.Height / sh };
     sc.Padding = { 0.0f, 0.0f };
 
-    BufferManager->UpdateConstantBuffer(TEXT("FScreenConstants"), sc);
-    BufferManager->BindConstantBuffer(TEXT("FScreenConstants"), 0, EShaderStage::Pixel);
+    BufferManager->UpdateConstantBuffer(sc);
+    BufferManager->BindConstantBuffer<FScreenConstants>(0, EShaderStage::Pixel);
 }
 
 void FDepthBufferDebugPass::RenderDepthBuffer(const std::shared_ptr<FEditorViewportClient>& ActiveViewport)
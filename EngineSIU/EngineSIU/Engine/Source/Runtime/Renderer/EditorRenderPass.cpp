@@ -90,8 +90,8 @@ void FEditorRenderPass::PrepareRender()
     UINT offset = 0;
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &SpotLightArrowVertexBuffer.VertexBuffer, &Stride, &offset);
     Graphics->DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
-    BufferManager->BindConstantBuffer(TEXT("FSpotLightArrowConstantBuffer"), 0, EShaderStage::Vertex);
-    BufferManager->BindConstantBuffer(TEXT("FSpotLightArrowConstantBuffer"), 0, EShaderStage::Pixel);
+    BufferManager->BindConstantBuffer<FSpotLightArrowConstantBuffer>(0, EShaderStage::Vertex);
+    BufferManager->BindConstantBuffer<FSpotLightArrowConstantBuffer>(0, EShaderStage::Pixel);
 }
 
 void FEditorRenderPass::Render(const std::shared_ptr<FEditorViewportClient>& Viewport)
@@ -150,8 +150,7 @@ void FEditorRenderPass::CreateBuffer()
 
     SpotLightArrowVertexBuffer = VertexInfo;
 
-    UINT SpotLightArrowConstantsBufferSize = sizeof(FSpotLightArrowConstantBuffer);
-    BufferManager->CreateBufferGeneric<FSpotLightArrowConstantBuffer>("FSpotLightArrowConstantBuffer", nullptr, SpotLightArrowConstantsBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
+    BufferManager->CreateConstantBuffer<FSpotLightArrowConstantBuffer>();
 
 }
 
@@ -159,5 +158,5 @@ void FEditorRenderPass::UpdateConstantBuffer(const FMatrix& Model, const FMatrix
 {
     FSpotLightArrowConstantBuffer Data(Model, View, Projection, color);
     
-    BufferManager->UpdateConstantBuffer(TEXT("FSpotLightArrowConstantBuffer"), Data);
+    BufferManager->UpdateConstantBuffer(Data);
 }
@@ -6,7 +6,8 @@
 #include "Define.h"
 #include "Engine/Classes/GameFramework/Actor.h"
 #include <wchar.h>
-#include <UObject/UObjectIterator.h>
+#include <UObject/Casts.h>
+#include <World/World.h>
 #include <Engine/Engine.h>
 #include "PropertyEditor/ShowFlags.h"
 
@@ -124,12 +125,14 @@ void FFogRenderPass::CreateSceneSrv()
 
 void FFogRenderPass::PrepareRender()
 {
-    for (const auto iter : TObjectRange<UHeightFogComponent>())
+    if (!GEngine->ActiveWorld)
     {
-        if (iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            FogComponents.Add(iter);
-        }
+        return;
+    }
+
+    for (UPrimitiveComponent* Primitive : GEngine->ActiveWorld->GetPrimitiveSceneIndex().GetPrimitives(EScenePrimitiveType::HeightFog))
+    {
+        FogComponents.Add(static_cast<UHeightFogComponent*>(Primitive));
     }
 }
 
@@ -252,8 +255,8 @@ void FFogRenderPass::UpdateScreenConstant(const D3D11_VIEWPORT& viewport)
     sc.UVScale = { viewport.Width / sw, viewport.Height / sh };
     sc.Padding = { 0.0f, 0.0f };
 
-    BufferManager->UpdateConstantBuffer(TEXT("FScreenConstants"), sc);
-    BufferManager->BindConstantBuffer(TEXT("FScreenConstants"), 0, EShaderStage::Pixel);
+    BufferManager->UpdateConstantBuffer(sc);
+    BufferManager->BindConstantBuffer<FScreenConstants>(0, EShaderStage::Pixel);
 }
 
 void FFogRenderPass::UpdateFogConstant(const std::shared_ptr<FEditorViewportClient>& ActiveViewport, UHeightFogComponent* Fog)
@@ -277,10 +280,9 @@ void FFogRenderPass::UpdateFogConstant(const std::shared_ptr<FEditorViewportClie
         Constants.CameraFar = ActiveViewport->farPlane;
     }
     //상수버퍼 업데이트
-    BufferManager->UpdateConstantBuffer(TEXT("FFogConstants"), Constants);
+    BufferManager->UpdateConstantBuffer(Constants);
     //상수버퍼 바인딩
-    ID3D11Buffer* FogConstantBuffer = BufferManager->GetConstantBuffer(TEXT("FFogConstants"));
-    BufferManager->BindConstantBuffer(TEXT("FFogConstants"), 1, EShaderStage::Pixel);
+    BufferManager->BindConstantBuffer<FFogConstants>(1, EShaderStage::Pixel);
 }
 
 void FFogRenderPass::CreateBlendState()
@@ -0,0 +1,172 @@
+#include "FrustumCulling.h"
+
+#include <bit>
+
+#include "Math/MathSSE.h"
+#include "Math/Matrix.h"
+#include "Math/MathUtility.h"
+
+namespace
+{
+    /** (X, Y, Z)가 단위 벡터가 되도록 평면을 정규화합니다. */
+    FVector4 NormalizePlane(float X, float Y, float Z, float W)
+    {
+        const float Length = FMath::Sqrt(X * X + Y * Y + Z * Z);
+        if (Length <= SMALL_NUMBER)
+        {
+            return FVector4(X, Y, Z, W);
+        }
+        const float InvLength = 1.0f / Length;
+        return FVector4(X * InvLength, Y * InvLength, Z * InvLength, W * InvLength);
+    }
+}
+
+FCullBounds FCullBounds::FromLocalBox(const FVector& LocalMin, const FVector& LocalMax, const FMatrix& World)
+{
+    const FVector LocalCenter = (LocalMin + LocalMax) * 0.5f;
+    const FVector LocalExtent = (LocalMax - LocalMin) * 0.5f;
+
+    // 회전/스케일이 적용된 박스를 감싸는 AABB의 반경은 |M| * Extent 입니다.
+    FVector WorldExtent;
+    WorldExtent.X = FMath::Abs(World.M[0][0]) * LocalExtent.X + FMath::Abs(World.M[1][0]) * LocalExtent.Y + FMath::Abs(World.M[2][0]) * LocalExtent.Z;
+    WorldExtent.Y = FMath::Abs(World.M[0][1]) * LocalExtent.X + FMath::Abs(World.M[1][1]) * LocalExtent.Y + FMath::Abs(World.M[2][1]) * LocalExtent.Z;
+    WorldExtent.Z = FMath::Abs(World.M[0][2]) * LocalExtent.X + FMath::Abs(World.M[1][2]) * LocalExtent.Y + FMath::Abs(World.M[2][2]) * LocalExtent.Z;
+
+    return FCullBounds(World.TransformPosition(LocalCenter), WorldExtent);
+}
+
+FFrustum::FFrustum(const FMatrix& ViewProjection)
+{
+    // 행벡터 규약에서 Clip = P * VP 이므로, 각 평면은 VP의 열(Column) 조합으로 얻어집니다.
+    const auto& M = ViewProjection.M;
+
+    // w + x >= 0
+    Planes[Plane_Left] = NormalizePlane(M[0][3] + M[0][0], M[1][3] + M[1][0], M[2][3] + M[2][0], M[3][3] + M[3][0]);
+    // w - x >= 0
+    Planes[Plane_Right] = NormalizePlane(M[0][3] - M[0][0], M[1][3] - M[1][0], M[2][3] - M[2][0], M[3][3] - M[3][0]);
+    // w + y >= 0
+    Planes[Plane_Bottom] = NormalizePlane(M[0][3] + M[0][1], M[1][3] + M[1][1], M[2][3] + M[2][1], M[3][3] + M[3][1]);
+    // w - y >= 0
+    Planes[Plane_Top] = NormalizePlane(M[0][3] - M[0][1], M[1][3] - M[1][1], M[2][3] - M[2][1], M[3][3] - M[3][1]);
+    // z >= 0 (D3D 깊이 범위)
+    Planes[Plane_Near] = NormalizePlane(M[0][2], M[1][2], M[2][2], M[3][2]);
+    // w - z >= 0
+    Planes[Plane_Far] = NormalizePlane(M[0][3] - M[0][2], M[1][3] - M[1][2], M[2][3] - M[2][2], M[3][3] - M[3][2]);
+}
+
+bool FFrustum::IntersectsBox(const FCullBounds& Bounds) const
+{
+    for (const FVector4& Plane : Planes)
+    {
+        const float Distance = Plane.X * Bounds.Center.X + Plane.Y * Bounds.Center.Y + Plane.Z * Bounds.Center.Z + Plane.W;
+        const float Radius = FMath::Abs(Plane.X) * Bounds.Extent.X + FMath::Abs(Plane.Y) * Bounds.Extent.Y + FMath::Abs(Plane.Z) * Bounds.Extent.Z;
+        if (Distance + Radius < 0.0f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+EFrustumContainment FFrustum::ClassifyBox(const FCullBounds& Bounds) const
+{
+    EFrustumContainment Result = EFrustumContainment::Inside;
+    for (const FVector4& Plane : Planes)
+    {
+        const float Distance = Plane.X * Bounds.Center.X + Plane.Y * Bounds.Center.Y + Plane.Z * Bounds.Center.Z + Plane.W;
+        const float Radius = FMath::Abs(Plane.X) * Bounds.Extent.X + FMath::Abs(Plane.Y) * Bounds.Extent.Y + FMath::Abs(Plane.Z) * Bounds.Extent.Z;
+        if (Distance + Radius < 0.0f)
+        {
+            return EFrustumContainment::Outside;
+        }
+        if (Distance - Radius < 0.0f)
+        {
+            Result = EFrustumContainment::Intersect;
+        }
+    }
+    return Result;
+}
+
+uint32 FrustumCulling::CullAgainstFrustum(const FCullBounds* Bounds, uint32 NumBounds, const FFrustum& Frustum, TArray<uint32>& OutVisibleIndices)
+{
+    OutVisibleIndices.Empty();
+    if (Bounds == nullptr || NumBounds == 0)
+    {
+        return 0;
+    }
+    OutVisibleIndices.Reserve(static_cast<int32>(NumBounds));
+
+    // 평면 성분을 미리 4개씩 복제해 둡니다.
+    VectorRegister4Float PlaneX[FFrustum::Plane_Count];
+    VectorRegister4Float PlaneY[FFrustum::Plane_Count];
+    VectorRegister4Float PlaneZ[FFrustum::Plane_Count];
+    VectorRegister4Float PlaneW[FFrustum::Plane_Count];
+    VectorRegister4Float AbsPlaneX[FFrustum::Plane_Count];
+    VectorRegister4Float AbsPlaneY[FFrustum::Plane_Count];
+    VectorRegister4Float AbsPlaneZ[FFrustum::Plane_Count];
+    for (int PlaneIndex = 0; PlaneIndex < FFrustum::Plane_Count; ++PlaneIndex)
+    {
+        const FVector4& Plane = Frustum.Planes[PlaneIndex];
+        PlaneX[PlaneIndex] = _mm_set1_ps(Plane.X);
+        PlaneY[PlaneIndex] = _mm_set1_ps(Plane.Y);
+        PlaneZ[PlaneIndex] = _mm_set1_ps(Plane.Z);
+        PlaneW[PlaneIndex] = _mm_set1_ps(Plane.W);
+        AbsPlaneX[PlaneIndex] = _mm_set1_ps(FMath::Abs(Plane.X));
+        AbsPlaneY[PlaneIndex] = _mm_set1_ps(FMath::Abs(Plane.Y));
+        AbsPlaneZ[PlaneIndex] = _mm_set1_ps(FMath::Abs(Plane.Z));
+    }
+
+    const VectorRegister4Float Zero = _mm_setzero_ps();
+
+    // 4개씩 SoA로 묶어서 테스트합니다.
+    uint32 Index = 0;
+    for (; Index + 4 <= NumBounds; Index += 4)
+    {
+        const FCullBounds& B0 = Bounds[Index + 0];
+        const FCullBounds& B1 = Bounds[Index + 1];
+        const FCullBounds& B2 = Bounds[Index + 2];
+        const FCullBounds& B3 = Bounds[Index + 3];
+
+        const VectorRegister4Float CenterX = _mm_setr_ps(B0.Center.X, B1.Center.X, B2.Center.X, B3.Center.X);
+        const VectorRegister4Float CenterY = _mm_setr_ps(B0.Center.Y, B1.Center.Y, B2.Center.Y, B3.Center.Y);
+        const VectorRegister4Float CenterZ = _mm_setr_ps(B0.Center.Z, B1.Center.Z, B2.Center.Z, B3.Center.Z);
+        const VectorRegister4Float ExtentX = _mm_setr_ps(B0.Extent.X, B1.Extent.X, B2.Extent.X, B3.Extent.X);
+        const VectorRegister4Float ExtentY = _mm_setr_ps(B0.Extent.Y, B1.Extent.Y, B2.Extent.Y, B3.Extent.Y);
+        const VectorRegister4Float ExtentZ = _mm_setr_ps(B0.Extent.Z, B1.Extent.Z, B2.Extent.Z, B3.Extent.Z);
+
+        VectorRegister4Float InsideMask = _mm_cmpeq_ps(Zero, Zero);
+        for (int PlaneIndex = 0; PlaneIndex < FFrustum::Plane_Count; ++PlaneIndex)
+        {
+            // Distance = Dot(N, C) + W
+            VectorRegister4Float Distance = _mm_add_ps(_mm_mul_ps(PlaneX[PlaneIndex], CenterX), PlaneW[PlaneIndex]);
+            Distance = _mm_add_ps(Distance, _mm_mul_ps(PlaneY[PlaneIndex], CenterY));
+            Distance = _mm_add_ps(Distance, _mm_mul_ps(PlaneZ[PlaneIndex], CenterZ));
+
+            // Radius = Dot(|N|, E)
+            VectorRegister4Float Radius = _mm_mul_ps(AbsPlaneX[PlaneIndex], ExtentX);
+            Radius = _mm_add_ps(Radius, _mm_mul_ps(AbsPlaneY[PlaneIndex], ExtentY));
+            Radius = _mm_add_ps(Radius, _mm_mul_ps(AbsPlaneZ[PlaneIndex], ExtentZ));
+
+            InsideMask = _mm_and_ps(InsideMask, _mm_cmpge_ps(_mm_add_ps(Distance, Radius), Zero));
+        }
+
+        int VisibleBits = _mm_movemask_ps(InsideMask);
+        while (VisibleBits != 0)
+        {
+            const uint32 Lane = static_cast<uint32>(std::countr_zero(static_cast<uint32>(VisibleBits)));
+            OutVisibleIndices.Add(Index + Lane);
+            VisibleBits &= VisibleBits - 1;
+        }
+    }
+
+    // 남은 원소는 스칼라로 처리합니다.
+    for (; Index < NumBounds; ++Index)
+    {
+        if (Frustum.IntersectsBox(Bounds[Index]))
+        {
+            OutVisibleIndices.Add(Index);
+        }
+    }
+
+    return static_cast<uint32>(OutVisibleIndices.Num());
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "Container/Array.h"
+#include "Math/Vector.h"
+#include "Math/Vector4.h"
+
+struct FMatrix;
+
+/**
+ * 컬링에 사용하는 월드 공간 AABB.
+ * 평면 테스트를 단순하게 하기 위해 Min/Max 대신 중심과 반경(Extent)으로 저장합니다.
+ */
+struct FCullBounds
+{
+    FVector Center;
+    FVector Extent;
+
+    FCullBounds() = default;
+    FCullBounds(const FVector& InCenter, const FVector& InExtent)
+        : Center(InCenter), Extent(InExtent)
+    {
+    }
+
+    /** 로컬 AABB(LocalMin, LocalMax)를 World 행렬로 변환했을 때 이를 감싸는 월드 AABB를 구합니다. */
+    static FCullBounds FromLocalBox(const FVector& LocalMin, const FVector& LocalMax, const FMatrix& World);
+};
+
+/** 절두체와 박스의 포함 관계 */
+enum class EFrustumContainment : uint8
+{
+    Outside,
+    Intersect,
+    Inside,
+};
+
+/**
+ * View * Projection 행렬에서 추출한 6개의 절두체 평면.
+ * 각 평면은 (X, Y, Z) = 안쪽을 향하는 단위 법선, W = 거리이며, Dot(N, P) + W >= 0 이면 평면 안쪽입니다.
+ */
+struct FFrustum
+{
+    enum EPlane : uint8
+    {
+        Plane_Left,
+        Plane_Right,
+        Plane_Bottom,
+        Plane_Top,
+        Plane_Near,
+        Plane_Far,
+        Plane_Count
+    };
+
+    FVector4 Planes[Plane_Count];
+
+    FFrustum() = default;
+
+    /** 행벡터(v * M), 왼손 좌표계, 깊이 범위 0~1 (D3D) 기준의 ViewProjection 행렬로부터 평면을 추출합니다. */
+    explicit FFrustum(const FMatrix& ViewProjection);
+
+    /** Bounds가 절두체와 겹치거나 내부에 있으면 true를 반환합니다. */
+    bool IntersectsBox(const FCullBounds& Bounds) const;
+
+    /** Bounds가 절두체 밖에 있는지, 걸쳐 있는지, 완전히 안에 있는지 판별합니다. */
+    EFrustumContainment ClassifyBox(const FCullBounds& Bounds) const;
+};
+
+/** 한 번의 컬링 결과에 대한 통계 */
+struct FCullingStats
+{
+    uint32 NumVisible = 0;
+    uint32 NumCulled = 0;
+};
+
+namespace FrustumCulling
+{
+    /**
+     * Bounds 배열을 Frustum에 대해 컬링하고, 보이는 원소의 인덱스를 오름차순으로 OutVisibleIndices에 채웁니다.
+     * SSE로 4개의 박스를 한 번에 테스트합니다.
+     * @return 보이는 원소의 개수
+     */
+    uint32 CullAgainstFrustum(const FCullBounds* Bounds, uint32 NumBounds, const FFrustum& Frustum, TArray<uint32>& OutVisibleIndices);
+
+    inline uint32 CullAgainstFrustum(const TArray<FCullBounds>& Bounds, const FFrustum& Frustum, TArray<uint32>& OutVisibleIndices)
+    {
+        return CullAgainstFrustum(Bounds.GetData(), static_cast<uint32>(Bounds.Num()), Frustum, OutVisibleIndices);
+    }
+}
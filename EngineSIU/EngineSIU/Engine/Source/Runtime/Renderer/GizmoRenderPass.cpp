@@ -53,6 +53,10 @@ void FGizmoRenderPass::Initialize(FDXDBufferManager* InBufferManager, FGraphicsD
     BufferManager = InBufferManager;
     Graphics = InGraphics;
     ShaderManager = InShaderManager;
+
+    VSConstantBuffers = FConstantBufferBindList::Make<FPerObjectConstantBuffer, FCameraConstantBuffer>(0, EShaderStage::Vertex);
+    PSConstantBuffers = FConstantBufferBindList::Make<FPerObjectConstantBuffer, FMaterialConstants, FLitUnlitConstants>(0, EShaderStage::Pixel);
+
     CreateShader();
 }
 
@@ -103,19 +107,8 @@ void FGizmoRenderPass::PrepareRenderState() const
     Graphics->DeviceContext->PSSetShader(PixelShader, nullptr, 0);
     Graphics->DeviceContext->IASetInputLayout(InputLayout);
 
-    // 상수 버퍼 바인딩 예시
-    ID3D11Buffer* PerObjectBuffer = BufferManager->GetConstantBuffer(TEXT("FPerObjectConstantBuffer"));
-    ID3D11Buffer* CameraConstantBuffer = BufferManager->GetConstantBuffer(TEXT("FCameraConstantBuffer"));
-    Graphics->DeviceContext->VSSetConstantBuffers(0, 1, &PerObjectBuffer);
-    Graphics->DeviceContext->VSSetConstantBuffers(1, 1, &CameraConstantBuffer);
-
-    TArray<FString> PSBufferKeys = {
-                                  TEXT("FPerObjectConstantBuffer"),
-                                   TEXT("FMaterialConstants"),
-                                  TEXT("FLitUnlitConstants")
-    };
-
-    BufferManager->BindConstantBuffers(PSBufferKeys, 0, EShaderStage::Pixel);
+    BufferManager->BindConstantBuffers(VSConstantBuffers);
+    BufferManager->BindConstantBuffers(PSConstantBuffers);
 }
 
 void FGizmoRenderPass::PrepareRender()
@@ -209,8 +202,8 @@ void FGizmoRenderPass::RenderGizmoComponent(UGizmoBaseComponent* GizmoComp, cons
 
     FCameraConstantBuffer CameraData(Viewport->View, Viewport->Projection);
 
-    BufferManager->UpdateConstantBuffer(TEXT("FPerObjectConstantBuffer"), Data);
-    BufferManager->UpdateConstantBuffer(TEXT("FCameraConstantBuffer"), CameraData);
+    BufferManager->UpdateConstantBuffer(Data);
+    BufferManager->UpdateConstantBuffer(CameraData);
 
     // Gizmo가 렌더링할 StaticMesh가 없으면 렌더링하지 않음
     if (!GizmoComp->GetStaticMesh())
@@ -232,7 +225,7 @@ void FGizmoRenderPass::RenderGizmoComponent(UGizmoBaseComponent* GizmoComp, cons
 
     if (RenderData->MaterialSubsets.Num() == 0)
     {
-        Graphics->DeviceContext->DrawIndexed(RenderData->Indices.Num(), 0, 0);
+        Graphics->DeviceContext->DrawIndexed(RenderData->GetNumIndices(), 0, 0);
     }
     else
     {
@@ -240,9 +233,6 @@ void FGizmoRenderPass::RenderGizmoComponent(UGizmoBaseComponent* GizmoComp, cons
         {
             int materialIndex = RenderData->MaterialSubsets[subMeshIndex].MaterialIndex;
 
-            FSubMeshConstants SubMeshData = FSubMeshConstants(false);
-            BufferManager->UpdateConstantBuffer(TEXT("FSubMeshConstants"), SubMeshData);
-
             TArray<FStaticMaterial*>Materials = GizmoComp->GetStaticMesh()->GetMaterials();
             TArray<UMaterial*>OverrideMaterials = GizmoComp->GetOverrideMaterials();
 
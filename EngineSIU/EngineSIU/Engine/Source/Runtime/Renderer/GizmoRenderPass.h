@@ -4,6 +4,7 @@
 #include "IRenderPass.h"
 #include "EngineBaseTypes.h"
 #include "Container/Set.h"
+#include "D3D11RHI/DXDBufferManager.h"
 
 class UGizmoBaseComponent;
 
@@ -48,6 +49,11 @@ private:
     ID3D11InputLayout* InputLayout;
 
     uint32 Stride;
+
+    /** Initialize에서 한 번 만들어 두는 상수 버퍼 바인딩 목록 */
+    FConstantBufferBindList VSConstantBuffers;
+    FConstantBufferBindList PSConstantBuffers;
+
     // 수집된 Gizmo 객체 배열
     //TArray<UGizmoBaseComponent*> GizmoObjs;
 };
@@ -0,0 +1,319 @@
+#include "LightClustering.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "Math/MathSSE.h"
+#include "Math/MathUtility.h"
+
+
+namespace
+{
+    /** 열/행 번호의 NDC 경계 */
+    float GetTileNdc(uint32 Index, uint32 NumTiles)
+    {
+        return -1.0f + 2.0f * static_cast<float>(Index) / static_cast<float>(NumTiles);
+    }
+
+    /**
+     * NDC 좌표 Ndc와 View 공간 깊이 ViewZ로 View 공간 좌표 한 축을 구합니다.
+     * Clip = V * P, W = ViewZ * P[2][3] + P[3][3] 이므로 원근/직교 투영 모두 같은 식을 씁니다.
+     */
+    float NdcToView(const FMatrix& Projection, int Axis, float Ndc, float ViewZ)
+    {
+        const float W = ViewZ * Projection.M[2][3] + Projection.M[3][3];
+        return (Ndc * W - ViewZ * Projection.M[2][Axis] - Projection.M[3][Axis]) / Projection.M[Axis][Axis];
+    }
+
+    /** 타일 [Ndc0, Ndc1] x 깊이 [MinZ, MaxZ]를 감싸는 View 공간 범위 */
+    void GetTileRange(const FMatrix& Projection, int Axis, float Ndc0, float Ndc1, float MinZ, float MaxZ, float& OutMin, float& OutMax)
+    {
+        const float A = NdcToView(Projection, Axis, Ndc0, MinZ);
+        const float B = NdcToView(Projection, Axis, Ndc0, MaxZ);
+        const float C = NdcToView(Projection, Axis, Ndc1, MinZ);
+        const float D = NdcToView(Projection, Axis, Ndc1, MaxZ);
+        OutMin = FMath::Min(FMath::Min(A, B), FMath::Min(C, D));
+        OutMax = FMath::Max(FMath::Max(A, B), FMath::Max(C, D));
+    }
+}
+
+void FLightClusterGrid::SetView(const FMatrix& InView, const FMatrix& InProjection, float InNearZ, float InFarZ, bool bInPerspective)
+{
+    View = InView;
+    Projection = InProjection;
+    NearZ = InNearZ;
+    FarZ = FMath::Max(InFarZ, InNearZ * 2.0f);
+    bPerspective = bInPerspective;
+}
+
+uint32 FLightClusterGrid::GetSliceIndex(float ViewZ) const
+{
+    const float Depth = ShaderParams.bLogDepth ? FMath::Loge(FMath::Max(ViewZ, 1e-6f)) : ViewZ;
+    const int32 Slice = static_cast<int32>(std::floor(Depth * ShaderParams.DepthScale + ShaderParams.DepthBias));
+    return static_cast<uint32>(FMath::Clamp(Slice, 0, static_cast<int32>(NumClustersZ) - 1));
+}
+
+void FLightClusterGrid::BuildClusterBounds(float ClusterFarZ)
+{
+    ShaderParams.NumClustersX = NumClustersX;
+    ShaderParams.NumClustersY = NumClustersY;
+    ShaderParams.NumClustersZ = NumClustersZ;
+    ShaderParams.bLogDepth = bPerspective ? 1 : 0;
+
+    // 원근 투영은 깊이에 따라 클러스터가 커지므로 Slice를 지수적으로 나눠 클러스터의 모양을 비슷하게 유지합니다.
+    if (bPerspective)
+    {
+        const float LogRatio = FMath::Loge(ClusterFarZ / NearZ);
+        ShaderParams.DepthScale = static_cast<float>(NumClustersZ) / LogRatio;
+        ShaderParams.DepthBias = -ShaderParams.DepthScale * FMath::Loge(NearZ);
+        for (uint32 Slice = 0; Slice < NumClustersZ; ++Slice)
+        {
+            SliceMinZ[Slice] = NearZ * std::pow(ClusterFarZ / NearZ, static_cast<float>(Slice) / NumClustersZ);
+        }
+    }
+    else
+    {
+        ShaderParams.DepthScale = static_cast<float>(NumClustersZ) / (ClusterFarZ - NearZ);
+        ShaderParams.DepthBias = -NearZ * ShaderParams.DepthScale;
+        for (uint32 Slice = 0; Slice < NumClustersZ; ++Slice)
+        {
+            SliceMinZ[Slice] = NearZ + (ClusterFarZ - NearZ) * static_cast<float>(Slice) / NumClustersZ;
+        }
+    }
+    for (uint32 Slice = 0; Slice + 1 < NumClustersZ; ++Slice)
+    {
+        SliceMaxZ[Slice] = SliceMinZ[Slice + 1];
+    }
+    SliceMaxZ[NumClustersZ - 1] = ClusterFarZ;
+
+    for (uint32 Slice = 0; Slice < NumClustersZ; ++Slice)
+    {
+        const float MinZ = SliceMinZ[Slice];
+        const float MaxZ = SliceMaxZ[Slice];
+
+        for (uint32 X = 0; X < NumClustersX; ++X)
+        {
+            float MinX, MaxX;
+            GetTileRange(Projection, 0, GetTileNdc(X, NumClustersX), GetTileNdc(X + 1, NumClustersX), MinZ, MaxZ, MinX, MaxX);
+            ColumnMinX[Slice][X] = MinX;
+            ColumnMaxX[Slice][X] = MaxX;
+            ColumnCenterX[Slice][X] = (MinX + MaxX) * 0.5f;
+            ColumnExtentX[Slice][X] = (MaxX - MinX) * 0.5f;
+        }
+
+        for (uint32 Y = 0; Y < RowStride; ++Y)
+        {
+            float MinY = 0.0f, MaxY = 0.0f;
+            if (Y < NumClustersY)
+            {
+                GetTileRange(Projection, 1, GetTileNdc(Y, NumClustersY), GetTileNdc(Y + 1, NumClustersY), MinZ, MaxZ, MinY, MaxY);
+            }
+            RowMinY[Slice][Y] = MinY;
+            RowMaxY[Slice][Y] = MaxY;
+            RowCenterY[Slice][Y] = (MinY + MaxY) * 0.5f;
+            RowExtentY[Slice][Y] = (MaxY - MinY) * 0.5f;
+        }
+    }
+}
+
+void FLightClusterGrid::AssignLights(const FClusterPointLight* PointLights, uint32 NumPointLights, const FClusterSpotLight* SpotLights, uint32 NumSpotLights)
+{
+    // FLightCluster가 종류별 개수를 16비트로 저장하므로 그 이상은 배정하지 않습니다.
+    NumPointLights = FMath::Min(NumPointLights, 0xFFFFu);
+    NumSpotLights = FMath::Min(NumSpotLights, 0xFFFFu);
+    const uint32 NumLights = NumPointLights + NumSpotLights;
+
+    Stats = {};
+
+    // Light를 View 공간으로 옮기면서 Light가 닿는 가장 먼 깊이를 구합니다.
+    ViewSpheres.SetNum(static_cast<int32>(NumLights));
+    ViewSpotDirections.SetNum(static_cast<int32>(NumSpotLights));
+
+    float MaxLightZ = 0.0f;
+    for (uint32 LightIndex = 0; LightIndex < NumPointLights; ++LightIndex)
+    {
+        const FClusterPointLight& Light = PointLights[LightIndex];
+        const FVector ViewPosition = View.TransformPosition(Light.Position);
+        ViewSpheres[LightIndex] = FVector4(ViewPosition, Light.Radius);
+        MaxLightZ = FMath::Max(MaxLightZ, ViewPosition.Z + Light.Radius);
+    }
+    for (uint32 LightIndex = 0; LightIndex < NumSpotLights; ++LightIndex)
+    {
+        const FClusterSpotLight& Light = SpotLights[LightIndex];
+        const FVector ViewPosition = View.TransformPosition(Light.Position);
+        ViewSpheres[NumPointLights + LightIndex] = FVector4(ViewPosition, Light.Radius);
+        ViewSpotDirections[LightIndex] = FMatrix::TransformVector(Light.Direction, View).GetSafeNormal();
+        MaxLightZ = FMath::Max(MaxLightZ, ViewPosition.Z + Light.Radius);
+    }
+
+    // 어떤 Light도 닿지 않는 깊이까지 Slice를 나눌 필요는 없습니다. 그보다 먼 픽셀은 마지막 Slice를 사용합니다.
+    BuildClusterBounds(FMath::Clamp(MaxLightZ, NearZ * 2.0f, FarZ));
+
+    PointCounts.SetNum(NumClusters);
+    SpotCounts.SetNum(NumClusters);
+    std::fill_n(PointCounts.GetData(), NumClusters, 0u);
+    std::fill_n(SpotCounts.GetData(), NumClusters, 0u);
+
+    Hits.Empty();
+    LightHitEnds.SetNum(static_cast<int32>(NumLights));
+    for (uint32 LightIndex = 0; LightIndex < NumLights; ++LightIndex)
+    {
+        if (LightIndex < NumPointLights)
+        {
+            AssignSphere(ViewSpheres[LightIndex], nullptr, FVector::ZeroVector, PointCounts.GetData());
+        }
+        else
+        {
+            const uint32 SpotIndex = LightIndex - NumPointLights;
+            AssignSphere(ViewSpheres[LightIndex], &SpotLights[SpotIndex], ViewSpotDirections[SpotIndex], SpotCounts.GetData());
+        }
+        LightHitEnds[LightIndex] = static_cast<uint32>(Hits.Num());
+    }
+
+    // 누적 합으로 클러스터별 목록의 시작 위치를 정합니다.
+    Clusters.SetNum(NumClusters);
+    uint32 Offset = 0;
+    for (uint32 ClusterIndex = 0; ClusterIndex < NumClusters; ++ClusterIndex)
+    {
+        const uint32 NumPoint = PointCounts[ClusterIndex];
+        const uint32 NumSpot = SpotCounts[ClusterIndex];
+        Clusters[ClusterIndex] = { Offset, NumPoint | (NumSpot << 16) };
+
+        // 이후에는 각 종류의 다음 쓰기 위치로 사용합니다.
+        PointCounts[ClusterIndex] = Offset;
+        SpotCounts[ClusterIndex] = Offset + NumPoint;
+        Offset += NumPoint + NumSpot;
+
+        if (NumPoint + NumSpot > 0)
+        {
+            ++Stats.NumOccupiedClusters;
+            Stats.MaxLightsPerCluster = FMath::Max(Stats.MaxLightsPerCluster, NumPoint + NumSpot);
+        }
+    }
+    Stats.NumAssignments = Offset;
+
+    // Light 순서대로 채우므로 클러스터 안의 인덱스는 오름차순입니다.
+    LightIndices.SetNum(static_cast<int32>(Offset));
+    uint32 HitIndex = 0;
+    for (uint32 LightIndex = 0; LightIndex < NumLights; ++LightIndex)
+    {
+        const bool bPointLight = LightIndex < NumPointLights;
+        TArray<uint32>& Cursors = bPointLight ? PointCounts : SpotCounts;
+        const uint32 TypeIndex = bPointLight ? LightIndex : LightIndex - NumPointLights;
+        for (; HitIndex < LightHitEnds[LightIndex]; ++HitIndex)
+        {
+            LightIndices[Cursors[Hits[HitIndex]]++] = TypeIndex;
+        }
+    }
+}
+
+void FLightClusterGrid::AssignSphere(const FVector4& ViewSphere, const FClusterSpotLight* Spot, const FVector& ViewDirection, uint32* ClusterCounts)
+{
+    const float Radius = ViewSphere.W;
+    if (ViewSphere.Z + Radius < SliceMinZ[0] || ViewSphere.Z - Radius > SliceMaxZ[NumClustersZ - 1])
+    {
+        return;
+    }
+
+    // 경계에서의 부동소수점 오차를 고려해 한 Slice씩 넓게 잡고, 실제 판정은 아래의 거리 테스트가 합니다.
+    const uint32 FirstSlice = FMath::Max(GetSliceIndex(ViewSphere.Z - Radius), 1u) - 1;
+    const uint32 LastSlice = FMath::Min(GetSliceIndex(ViewSphere.Z + Radius) + 1, NumClustersZ - 1);
+
+    const float RadiusSq = Radius * Radius;
+    const VectorRegister4Float Zero = _mm_setzero_ps();
+    const VectorRegister4Float CenterX = _mm_set1_ps(ViewSphere.X);
+    const VectorRegister4Float CenterY = _mm_set1_ps(ViewSphere.Y);
+
+    alignas(16) float DistSqX[NumClustersX];
+    alignas(16) float DistSqY[RowStride];
+
+    for (uint32 Slice = FirstSlice; Slice <= LastSlice; ++Slice)
+    {
+        const float DistZ = FMath::Max(FMath::Max(SliceMinZ[Slice] - ViewSphere.Z, ViewSphere.Z - SliceMaxZ[Slice]), 0.0f);
+        const float SliceRemainSq = RadiusSq - DistZ * DistZ;
+        if (SliceRemainSq < 0.0f)
+        {
+            continue;
+        }
+
+        // 구 중심에서 각 열/행 범위까지의 거리 제곱
+        for (uint32 X = 0; X < NumClustersX; X += 4)
+        {
+            const VectorRegister4Float MinX = _mm_load_ps(&ColumnMinX[Slice][X]);
+            const VectorRegister4Float MaxX = _mm_load_ps(&ColumnMaxX[Slice][X]);
+            const VectorRegister4Float Dist = _mm_max_ps(_mm_max_ps(_mm_sub_ps(MinX, CenterX), _mm_sub_ps(CenterX, MaxX)), Zero);
+            _mm_store_ps(&DistSqX[X], _mm_mul_ps(Dist, Dist));
+        }
+        for (uint32 Y = 0; Y < RowStride; Y += 4)
+        {
+            const VectorRegister4Float MinY = _mm_load_ps(&RowMinY[Slice][Y]);
+            const VectorRegister4Float MaxY = _mm_load_ps(&RowMaxY[Slice][Y]);
+            const VectorRegister4Float Dist = _mm_max_ps(_mm_max_ps(_mm_sub_ps(MinY, CenterY), _mm_sub_ps(CenterY, MaxY)), Zero);
+            _mm_store_ps(&DistSqY[Y], _mm_mul_ps(Dist, Dist));
+        }
+
+        const float SliceCenterZ = (SliceMinZ[Slice] + SliceMaxZ[Slice]) * 0.5f;
+        const float SliceExtentZ = (SliceMaxZ[Slice] - SliceMinZ[Slice]) * 0.5f;
+
+        for (uint32 Y = 0; Y < NumClustersY; ++Y)
+        {
+            const float RowRemainSq = SliceRemainSq - DistSqY[Y];
+            if (RowRemainSq < 0.0f)
+            {
+                continue;
+            }
+            const VectorRegister4Float RowRemain = _mm_set1_ps(RowRemainSq);
+
+            for (uint32 X = 0; X < NumClustersX; X += 4)
+            {
+                int HitBits = _mm_movemask_ps(_mm_cmple_ps(_mm_load_ps(&DistSqX[X]), RowRemain));
+                if (HitBits == 0)
+                {
+                    continue;
+                }
+
+                if (Spot)
+                {
+                    // 클러스터 AABB를 감싸는 구와 원뿔의 교차 테스트.
+                    // 구 중심에서 원뿔 축까지의 각도 방향 거리, 원뿔 끝 너머, 꼭짓점 뒤쪽 중 하나라도 구 반지름보다 멀면 제외합니다.
+                    const VectorRegister4Float ToCenterX = _mm_sub_ps(_mm_load_ps(&ColumnCenterX[Slice][X]), CenterX);
+                    const VectorRegister4Float ToCenterY = _mm_set1_ps(RowCenterY[Slice][Y] - ViewSphere.Y);
+                    const VectorRegister4Float ToCenterZ = _mm_set1_ps(SliceCenterZ - ViewSphere.Z);
+
+                    const VectorRegister4Float ExtentX = _mm_load_ps(&ColumnExtentX[Slice][X]);
+                    const float ExtentYZSq = RowExtentY[Slice][Y] * RowExtentY[Slice][Y] + SliceExtentZ * SliceExtentZ;
+                    const VectorRegister4Float SphereRadius = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(ExtentX, ExtentX), _mm_set1_ps(ExtentYZSq)));
+
+                    VectorRegister4Float LengthSq = _mm_mul_ps(ToCenterX, ToCenterX);
+                    LengthSq = _mm_add_ps(LengthSq, _mm_mul_ps(ToCenterY, ToCenterY));
+                    LengthSq = _mm_add_ps(LengthSq, _mm_mul_ps(ToCenterZ, ToCenterZ));
+
+                    VectorRegister4Float AxisLength = _mm_mul_ps(ToCenterX, _mm_set1_ps(ViewDirection.X));
+                    AxisLength = _mm_add_ps(AxisLength, _mm_mul_ps(ToCenterY, _mm_set1_ps(ViewDirection.Y)));
+                    AxisLength = _mm_add_ps(AxisLength, _mm_mul_ps(ToCenterZ, _mm_set1_ps(ViewDirection.Z)));
+
+                    const VectorRegister4Float PerpLength = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(LengthSq, _mm_mul_ps(AxisLength, AxisLength)), Zero));
+                    const VectorRegister4Float ClosestDistance = _mm_sub_ps(
+                        _mm_mul_ps(PerpLength, _mm_set1_ps(Spot->CosConeAngle)),
+                        _mm_mul_ps(AxisLength, _mm_set1_ps(Spot->SinConeAngle))
+                    );
+
+                    VectorRegister4Float CullMask = _mm_cmpgt_ps(ClosestDistance, SphereRadius);
+                    CullMask = _mm_or_ps(CullMask, _mm_cmpgt_ps(AxisLength, _mm_add_ps(SphereRadius, _mm_set1_ps(Radius))));
+                    CullMask = _mm_or_ps(CullMask, _mm_cmplt_ps(AxisLength, _mm_sub_ps(Zero, SphereRadius)));
+                    HitBits &= ~_mm_movemask_ps(CullMask);
+                }
+
+                while (HitBits != 0)
+                {
+                    const uint32 Lane = static_cast<uint32>(std::countr_zero(static_cast<uint32>(HitBits)));
+                    const uint32 ClusterIndex = GetClusterIndex(X + Lane, Y, Slice);
+                    Hits.Add(ClusterIndex);
+                    ++ClusterCounts[ClusterIndex];
+                    HitBits &= HitBits - 1;
+                }
+            }
+        }
+    }
+}
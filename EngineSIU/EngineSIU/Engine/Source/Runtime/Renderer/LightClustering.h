@@ -0,0 +1,156 @@
+#pragma once
+#include "Container/Array.h"
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+#include "Math/Vector4.h"
+
+/** 클러스터에 배정할 점광원. 월드 공간 위치와 감쇠 반경으로 만든 구를 경계로 사용합니다. */
+struct FClusterPointLight
+{
+    FVector Position;
+    float Radius;
+};
+
+/**
+ * 클러스터에 배정할 스포트라이트.
+ * 꼭짓점 Position에서 Direction(단위 벡터)으로 Radius만큼 뻗은, 반각의 cos/sin이 CosConeAngle/SinConeAngle인 원뿔입니다.
+ * 반각은 90도까지 지원합니다.
+ */
+struct FClusterSpotLight
+{
+    FVector Position;
+    float Radius;
+    FVector Direction;
+    float CosConeAngle;
+    float SinConeAngle;
+};
+
+/**
+ * 클러스터 하나의 Light 목록 위치. HLSL의 uint2와 같은 레이아웃으로 GPU에 올립니다.
+ * 목록은 LightIndices[Offset]부터 점광원 인덱스 NumPoint개, 이어서 스포트라이트 인덱스 NumSpot개가 들어 있습니다.
+ */
+struct FLightCluster
+{
+    uint32 Offset;
+    /** NumPoint | (NumSpot << 16) */
+    uint32 PackedCounts;
+
+    uint32 GetNumPointLights() const { return PackedCounts & 0xFFFF; }
+    uint32 GetNumSpotLights() const { return PackedCounts >> 16; }
+};
+
+/**
+ * 셰이더가 픽셀의 클러스터를 찾는 데 필요한 값.
+ * Slice = floor(D * DepthScale + DepthBias)이며, D는 bLogDepth이면 log(ViewZ), 아니면 ViewZ입니다.
+ */
+struct FLightClusterShaderParams
+{
+    uint32 NumClustersX;
+    uint32 NumClustersY;
+    uint32 NumClustersZ;
+    float DepthScale;
+    float DepthBias;
+    uint32 bLogDepth;
+};
+
+/** 한 번의 배정 결과에 대한 통계 */
+struct FLightClusterStats
+{
+    uint32 NumAssignments = 0;
+    uint32 NumOccupiedClusters = 0;
+    uint32 MaxLightsPerCluster = 0;
+};
+
+/**
+ * View Frustum을 화면 X/Y 타일과 깊이 Slice로 나눈 3D 클러스터에 Light를 배정합니다 (Clustered Forward Shading).
+ *
+ * 원근 투영에서는 Slice를 깊이에 대해 지수적으로, 직교 투영에서는 균등하게 나눕니다.
+ * 클러스터의 View 공간 AABB는 X 범위가 (열, Slice), Y 범위가 (행, Slice)에만 의존하므로
+ * 구-AABB 거리를 열/행/Slice 성분으로 분리해서 한 행의 열 4개씩 SSE로 테스트합니다.
+ * 결과는 클러스터마다 FLightCluster 하나와, 이를 이어 붙인 Light 인덱스 목록입니다.
+ */
+class FLightClusterGrid
+{
+public:
+    static constexpr uint32 NumClustersX = 16;
+    static constexpr uint32 NumClustersY = 9;
+    static constexpr uint32 NumClustersZ = 24;
+    static constexpr uint32 NumClusters = NumClustersX * NumClustersY * NumClustersZ;
+
+    static_assert(NumClustersX % 4 == 0, "열은 SSE 레인 수의 배수여야 합니다.");
+
+    /**
+     * 클러스터를 나눌 View를 설정합니다. 행벡터, 왼손 좌표계, 깊이 범위 0~1 기준의 행렬입니다.
+     * 깊이 방향 끝은 FarZ와 Light가 닿는 가장 먼 깊이 중 가까운 쪽으로 AssignLights가 정합니다.
+     */
+    void SetView(const FMatrix& InView, const FMatrix& InProjection, float InNearZ, float InFarZ, bool bInPerspective);
+
+    void AssignLights(const FClusterPointLight* PointLights, uint32 NumPointLights, const FClusterSpotLight* SpotLights, uint32 NumSpotLights);
+
+    void AssignLights(const TArray<FClusterPointLight>& PointLights, const TArray<FClusterSpotLight>& SpotLights)
+    {
+        AssignLights(PointLights.GetData(), static_cast<uint32>(PointLights.Num()), SpotLights.GetData(), static_cast<uint32>(SpotLights.Num()));
+    }
+
+    /** NumClusters개. 인덱스는 (Slice * NumClustersY + Y) * NumClustersX + X이며 Y는 화면 아래쪽이 0입니다. */
+    const TArray<FLightCluster>& GetClusters() const { return Clusters; }
+    const TArray<uint32>& GetLightIndices() const { return LightIndices; }
+    const FLightClusterShaderParams& GetShaderParams() const { return ShaderParams; }
+    const FLightClusterStats& GetStats() const { return Stats; }
+
+    static uint32 GetClusterIndex(uint32 X, uint32 Y, uint32 Slice) { return (Slice * NumClustersY + Y) * NumClustersX + X; }
+
+    /** View 공간 깊이가 속하는 Slice. 범위 밖은 양 끝 Slice로 자릅니다. */
+    uint32 GetSliceIndex(float ViewZ) const;
+
+private:
+    /** SSE로 한 번에 읽도록 4의 배수로 맞춘 행 수. NumClustersY 이후의 행은 계산만 하고 사용하지 않습니다. */
+    static constexpr uint32 RowStride = (NumClustersY + 3) & ~3u;
+
+    /** NearZ ~ ClusterFarZ 사이의 Slice 경계와 각 Slice의 열/행 AABB 범위를 계산합니다. */
+    void BuildClusterBounds(float ClusterFarZ);
+
+    /**
+     * 구와 겹치는 클러스터를 Hits에 추가하고 ClusterCounts의 해당 칸을 하나씩 늘립니다.
+     * Spot이 있으면 원뿔 밖의 클러스터는 제외합니다.
+     */
+    void AssignSphere(const FVector4& ViewSphere, const FClusterSpotLight* Spot, const FVector& ViewDirection, uint32* ClusterCounts);
+
+private:
+    FMatrix View = FMatrix::Identity;
+    FMatrix Projection = FMatrix::Identity;
+    float NearZ = 0.1f;
+    float FarZ = 1000.0f;
+    bool bPerspective = true;
+
+    FLightClusterShaderParams ShaderParams = {};
+
+    /** Slice별 깊이 범위 */
+    float SliceMinZ[NumClustersZ];
+    float SliceMaxZ[NumClustersZ];
+
+    /** Slice별 열/행의 View 공간 AABB 범위와 중심, 반폭 (SoA) */
+    alignas(16) float ColumnMinX[NumClustersZ][NumClustersX];
+    alignas(16) float ColumnMaxX[NumClustersZ][NumClustersX];
+    alignas(16) float ColumnCenterX[NumClustersZ][NumClustersX];
+    alignas(16) float ColumnExtentX[NumClustersZ][NumClustersX];
+    alignas(16) float RowMinY[NumClustersZ][RowStride];
+    alignas(16) float RowMaxY[NumClustersZ][RowStride];
+    alignas(16) float RowCenterY[NumClustersZ][RowStride];
+    alignas(16) float RowExtentY[NumClustersZ][RowStride];
+
+    /** 배정 중에 쓰는 View 공간 Light (X, Y, Z, Radius)와 Spot 방향 */
+    TArray<FVector4> ViewSpheres;
+    TArray<FVector> ViewSpotDirections;
+
+    /** Light 순서대로 이어 붙인, 각 Light가 닿는 클러스터 인덱스와 Light별 끝 위치 */
+    TArray<uint32> Hits;
+    TArray<uint32> LightHitEnds;
+
+    TArray<uint32> PointCounts;
+    TArray<uint32> SpotCounts;
+
+    TArray<FLightCluster> Clusters;
+    TArray<uint32> LightIndices;
+    FLightClusterStats Stats;
+};
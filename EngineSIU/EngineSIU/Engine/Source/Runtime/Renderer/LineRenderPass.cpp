@@ -69,9 +69,9 @@ void FLineRenderPass::PrepareLineShader() const
     Graphics->DeviceContext->VSSetShader(VertexLineShader, nullptr, 0);
     Graphics->DeviceContext->PSSetShader(PixelLineShader, nullptr, 0);
 
-    BufferManager->BindConstantBuffer(TEXT("FPerObjectConstantBuffer"), 0, EShaderStage::Vertex);
-    BufferManager->BindConstantBuffer(TEXT("FPerObjectConstantBuffer"), 0, EShaderStage::Pixel);
-    BufferManager->BindConstantBuffer(TEXT("FCameraConstantBuffer"), 2, EShaderStage::Pixel);
+    BufferManager->BindConstantBuffer<FPerObjectConstantBuffer>(0, EShaderStage::Vertex);
+    BufferManager->BindConstantBuffer<FPerObjectConstantBuffer>(0, EShaderStage::Pixel);
+    BufferManager->BindConstantBuffer<FCameraConstantBuffer>(2, EShaderStage::Pixel);
 
     FEngineLoop::PrimitiveDrawBatch.PrepareLineResources();
 }
@@ -102,9 +102,9 @@ void FLineRenderPass::ProcessLineRendering(const std::shared_ptr<FEditorViewport
     FMatrix NormalMatrix = RendererHelpers::CalculateNormalMatrix(FMatrix::Identity);
     FPerObjectConstantBuffer Data(MVP, NormalMatrix, FVector4(0, 0, 0, 0), false);
     FCameraConstantBuffer CameraData(Viewport->View, Viewport->Projection, Viewport->ViewTransformPerspective.GetLocation());
-    BufferManager->UpdateConstantBuffer(TEXT("FPerObjectConstantBuffer"), Data);
+    BufferManager->UpdateConstantBuffer(Data);
 
-    BufferManager->UpdateConstantBuffer(TEXT("FCameraConstantBuffer"), CameraData);
+    BufferManager->UpdateConstantBuffer(CameraData);
     FLinePrimitiveBatchArgs BatchArgs;
     FEngineLoop::PrimitiveDrawBatch.PrepareBatch(BatchArgs);
     DrawLineBatch(BatchArgs);
@@ -0,0 +1,170 @@
+#include "MeshDrawCommandList.h"
+
+void FMeshDrawCommandList::Reset()
+{
+    Objects.Empty();
+    Packets.Empty();
+    MaterialIds.Empty();
+    MeshIds.Empty();
+}
+
+uint32 FMeshDrawCommandList::AddObject(const FMatrix& Model, const FVector4& UUIDColor, bool bSelected)
+{
+    FMeshDrawObject Object;
+    Object.Model = Model;
+    Object.NormalMatrix = FMatrix::Transpose(FMatrix::Inverse(Model));
+    Object.UUIDColor = UUIDColor;
+    Object.bSelected = bSelected;
+    return static_cast<uint32>(Objects.Add(Object));
+}
+
+void FMeshDrawCommandList::AddPacket(uint32 ObjectIndex, OBJ::FStaticMeshRenderData* RenderData, uint32 SubsetIndex, const FObjMaterialInfo* Material, uint32 IndexStart, uint32 IndexCount, bool bSelectedSubMesh)
+{
+    FMeshDrawPacket Packet;
+    Packet.RenderData = RenderData;
+    Packet.Material = Material;
+    Packet.IndexStart = IndexStart;
+    Packet.IndexCount = IndexCount;
+    Packet.ObjectIndex = ObjectIndex;
+    Packet.bSelectedSubMesh = bSelectedSubMesh;
+
+    // Material이 없는 Packet은 0번을 사용해서 Material을 바꾸는 Packet보다 먼저 그립니다.
+    const uint32 MaterialId = Material ? GetSortId(MaterialIds, Material) + 1 : 0;
+    const uint32 MeshId = GetSortId(MeshIds, RenderData);
+    Packet.SortKey = MakeSortKey(MaterialId, MeshId, SubsetIndex, ObjectIndex);
+
+    Packets.Add(Packet);
+}
+
+void FMeshDrawCommandList::Sort()
+{
+    MeshDrawSort::RadixSortPackets(Packets, SortScratch);
+}
+
+void FMeshDrawCommandList::BuildBatches(TArray<FMeshInstanceData>& OutInstances, TArray<FMeshDrawBatch>& OutBatches) const
+{
+    OutInstances.SetNum(Packets.Num());
+    OutBatches.Empty();
+
+    int32 CurrentBatch = INDEX_NONE;
+    for (int32 PacketIndex = 0; PacketIndex < Packets.Num(); ++PacketIndex)
+    {
+        const FMeshDrawPacket& Packet = Packets[PacketIndex];
+        const FMeshDrawObject& Object = Objects[Packet.ObjectIndex];
+
+        FMeshInstanceData& Instance = OutInstances[PacketIndex];
+        Instance.World = Object.Model;
+        Instance.NormalMatrix = Object.NormalMatrix;
+        Instance.UUIDColor = Object.UUIDColor;
+        Instance.bSelected = Object.bSelected ? 1 : 0;
+        Instance.bSelectedSubMesh = Packet.bSelectedSubMesh ? 1 : 0;
+        Instance.Pad[0] = Instance.Pad[1] = 0;
+
+        // SortKey의 Subset 비트는 잘릴 수 있으므로 실제 Index 범위로 비교합니다.
+        if (CurrentBatch != INDEX_NONE)
+        {
+            FMeshDrawBatch& Current = OutBatches[CurrentBatch];
+            if (Current.RenderData == Packet.RenderData
+                && Current.Material == Packet.Material
+                && Current.IndexStart == Packet.IndexStart
+                && Current.IndexCount == Packet.IndexCount)
+            {
+                ++Current.NumInstances;
+                continue;
+            }
+        }
+
+        FMeshDrawBatch Batch;
+        Batch.RenderData = Packet.RenderData;
+        Batch.Material = Packet.Material;
+        Batch.IndexStart = Packet.IndexStart;
+        Batch.IndexCount = Packet.IndexCount;
+        Batch.FirstInstance = static_cast<uint32>(PacketIndex);
+        Batch.NumInstances = 1;
+        CurrentBatch = OutBatches.Add(Batch);
+    }
+}
+
+uint64 FMeshDrawCommandList::MakeSortKey(uint32 MaterialId, uint32 MeshId, uint32 SubsetIndex, uint32 ObjectIndex)
+{
+    // 범위를 넘는 값은 잘라냅니다. 정렬 순서만 흐트러질 뿐 결과 이미지는 같습니다.
+    constexpr uint64 MaterialMask = (1ull << MaterialIdBits) - 1;
+    constexpr uint64 MeshMask = (1ull << MeshIdBits) - 1;
+    constexpr uint64 SubsetMask = (1ull << SubsetIndexBits) - 1;
+    constexpr uint64 ObjectMask = (1ull << ObjectIndexBits) - 1;
+
+    return ((MaterialId & MaterialMask) << (MeshIdBits + SubsetIndexBits + ObjectIndexBits))
+        | ((MeshId & MeshMask) << (SubsetIndexBits + ObjectIndexBits))
+        | ((SubsetIndex & SubsetMask) << ObjectIndexBits)
+        | (ObjectIndex & ObjectMask);
+}
+
+uint32 FMeshDrawCommandList::GetSortId(TMap<const void*, uint32>& Ids, const void* Key)
+{
+    if (const uint32* Found = Ids.Find(Key))
+    {
+        return *Found;
+    }
+
+    const uint32 NewId = static_cast<uint32>(Ids.Num());
+    Ids.Add(Key, NewId);
+    return NewId;
+}
+
+void MeshDrawSort::RadixSortPackets(TArray<FMeshDrawPacket>& Packets, TArray<FMeshDrawPacket>& Scratch)
+{
+    const int32 NumPackets = Packets.Num();
+    if (NumPackets < 2)
+    {
+        return;
+    }
+
+    // 모든 바이트의 히스토그램을 한 번에 셉니다.
+    uint32 Counts[8][256] = {};
+    for (const FMeshDrawPacket& Packet : Packets)
+    {
+        const uint64 Key = Packet.SortKey;
+        for (int32 Byte = 0; Byte < 8; ++Byte)
+        {
+            ++Counts[Byte][(Key >> (Byte * 8)) & 0xFF];
+        }
+    }
+
+    Scratch.SetNum(NumPackets);
+    FMeshDrawPacket* Source = Packets.GetData();
+    FMeshDrawPacket* Dest = Scratch.GetData();
+
+    for (int32 Byte = 0; Byte < 8; ++Byte)
+    {
+        uint32* ByteCounts = Counts[Byte];
+
+        // 모든 키가 이 바이트에서 같은 값이면 순서가 바뀌지 않습니다.
+        const uint32 FirstDigit = (Source[0].SortKey >> (Byte * 8)) & 0xFF;
+        if (ByteCounts[FirstDigit] == static_cast<uint32>(NumPackets))
+        {
+            continue;
+        }
+
+        uint32 Offset = 0;
+        for (uint32 Digit = 0; Digit < 256; ++Digit)
+        {
+            const uint32 Count = ByteCounts[Digit];
+            ByteCounts[Digit] = Offset;
+            Offset += Count;
+        }
+
+        for (int32 i = 0; i < NumPackets; ++i)
+        {
+            const uint32 Digit = (Source[i].SortKey >> (Byte * 8)) & 0xFF;
+            Dest[ByteCounts[Digit]++] = Source[i];
+        }
+
+        std::swap(Source, Dest);
+    }
+
+    // 홀수 번 흩뿌렸으면 결과가 Scratch에 있습니다.
+    if (Source != Packets.GetData())
+    {
+        std::swap(Packets, Scratch);
+    }
+}
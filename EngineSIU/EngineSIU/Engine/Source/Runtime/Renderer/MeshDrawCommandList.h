@@ -0,0 +1,128 @@
+#pragma once
+#include "Define.h"
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "CoreMiscDefines.h"
+#include "Math/Matrix.h"
+#include "Math/Vector4.h"
+
+/** 컴포넌트의 Subset 하나에 해당하는 그리기 단위. 정렬 후 같은 Subset을 그리는 Packet끼리 Instancing으로 묶입니다. */
+struct FMeshDrawPacket
+{
+    /** 상위 비트부터 Material, Mesh, Subset, Object 순서로 정렬되도록 만든 키 */
+    uint64 SortKey = 0;
+
+    OBJ::FStaticMeshRenderData* RenderData = nullptr;
+
+    /** nullptr이면 Material을 바꾸지 않고 그립니다. (Subset이 없는 Mesh) */
+    const FObjMaterialInfo* Material = nullptr;
+
+    uint32 IndexStart = 0;
+    uint32 IndexCount = 0;
+
+    /** FMeshDrawCommandList::GetDrawObject로 찾는 Transform 등의 오브젝트 데이터 */
+    uint32 ObjectIndex = 0;
+
+    bool bSelectedSubMesh = false;
+};
+
+/** 같은 컴포넌트에서 나온 Packet들이 공유하는 Per-Object 데이터 */
+struct FMeshDrawObject
+{
+    FMatrix Model;
+    FMatrix NormalMatrix;
+    FVector4 UUIDColor;
+    bool bSelected = false;
+};
+
+/**
+ * Instance Vertex Buffer에 그대로 복사되는 Instance 하나의 데이터.
+ * StaticMeshVertexShader.hlsl의 INSTANCE_* 입력과 배치가 같아야 합니다.
+ */
+struct FMeshInstanceData
+{
+    FMatrix World;
+    FMatrix NormalMatrix;
+    FVector4 UUIDColor;
+    uint32 bSelected;
+    uint32 bSelectedSubMesh;
+    uint32 Pad[2];
+};
+
+/** 하나의 DrawIndexedInstanced 호출. Instance 데이터는 [FirstInstance, FirstInstance + NumInstances) 범위에 있습니다. */
+struct FMeshDrawBatch
+{
+    OBJ::FStaticMeshRenderData* RenderData = nullptr;
+    const FObjMaterialInfo* Material = nullptr;
+    uint32 IndexStart = 0;
+    uint32 IndexCount = 0;
+    uint32 FirstInstance = 0;
+    uint32 NumInstances = 0;
+};
+
+/** 한 프레임 동안 Draw Packet을 제출하며 센 통계 */
+struct FMeshDrawStats
+{
+    uint32 NumPackets = 0;
+    uint32 NumDraws = 0;
+    uint32 NumInstances = 0;
+    /** Vertex/Index Buffer 또는 Material(Texture 포함)을 바꾼 횟수 */
+    uint32 NumStateChanges = 0;
+    uint32 NumConstantBufferUploads = 0;
+};
+
+/**
+ * Static Mesh Pass가 한 뷰에서 그릴 Draw Packet 목록.
+ * Packet 생성과 정렬은 CPU에서만 이루어지고, GPU 제출은 FStaticMeshRenderPass가 담당합니다.
+ */
+class FMeshDrawCommandList
+{
+public:
+    static constexpr uint32 MaterialIdBits = 16;
+    static constexpr uint32 MeshIdBits = 16;
+    static constexpr uint32 SubsetIndexBits = 8;
+    static constexpr uint32 ObjectIndexBits = 24;
+
+    void Reset();
+
+    /** 오브젝트 데이터를 추가하고 Packet에서 사용할 인덱스를 반환합니다. */
+    uint32 AddObject(const FMatrix& Model, const FVector4& UUIDColor, bool bSelected);
+
+    void AddPacket(uint32 ObjectIndex, OBJ::FStaticMeshRenderData* RenderData, uint32 SubsetIndex, const FObjMaterialInfo* Material, uint32 IndexStart, uint32 IndexCount, bool bSelectedSubMesh);
+
+    /** SortKey 오름차순으로 Packet을 정렬합니다. 키가 같으면 추가한 순서를 유지합니다. */
+    void Sort();
+
+    /**
+     * 정렬된 Packet을 순서대로 Instance 데이터로 만들고, 연속해서 같은 Mesh, Material, Index 범위를 그리는 Packet을 하나의 Batch로 묶습니다.
+     * Sort 이후에 호출해야 Batch가 최소가 됩니다.
+     */
+    void BuildBatches(TArray<FMeshInstanceData>& OutInstances, TArray<FMeshDrawBatch>& OutBatches) const;
+
+    const TArray<FMeshDrawPacket>& GetPackets() const { return Packets; }
+    const FMeshDrawObject& GetDrawObject(uint32 ObjectIndex) const { return Objects[ObjectIndex]; }
+    int32 NumObjects() const { return Objects.Num(); }
+
+    static uint64 MakeSortKey(uint32 MaterialId, uint32 MeshId, uint32 SubsetIndex, uint32 ObjectIndex);
+
+private:
+    /** 이번 프레임에 처음 본 순서대로 0부터 번호를 붙입니다. */
+    static uint32 GetSortId(TMap<const void*, uint32>& Ids, const void* Key);
+
+private:
+    TArray<FMeshDrawObject> Objects;
+    TArray<FMeshDrawPacket> Packets;
+    TArray<FMeshDrawPacket> SortScratch;
+
+    TMap<const void*, uint32> MaterialIds;
+    TMap<const void*, uint32> MeshIds;
+};
+
+namespace MeshDrawSort
+{
+    /**
+     * SortKey 기준 LSD Radix Sort (8비트씩 8번). 모든 키에서 같은 바이트는 건너뜁니다.
+     * 정렬 결과는 Packets에 남고, Scratch는 임시 버퍼로만 사용합니다.
+     */
+    void RadixSortPackets(TArray<FMeshDrawPacket>& Packets, TArray<FMeshDrawPacket>& Scratch);
+}
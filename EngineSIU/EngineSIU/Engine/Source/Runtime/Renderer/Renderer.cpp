@@ -1,5 +1,6 @@
 
 #include "Renderer.h"
+#include "Stats/Stats.h"
 #include "World/World.h"
 #include "Engine/EditorEngine.h"
 #include "UnrealEd/EditorViewportClient.h"
@@ -66,38 +67,16 @@ void FRenderer::ChangeViewMode(EViewModeIndex evi)
 //------------------------------------------------------------------------------
 void FRenderer::CreateConstantBuffers()
 {
-    UINT perObjectBufferSize = sizeof(FPerObjectConstantBuffer);
-    BufferManager->CreateBufferGeneric<FPerObjectConstantBuffer>("FPerObjectConstantBuffer", nullptr, perObjectBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
-
-    UINT cameraConstantBufferSize = sizeof(FCameraConstantBuffer);
-    BufferManager->CreateBufferGeneric<FCameraConstantBuffer>("FCameraConstantBuffer", nullptr, cameraConstantBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
-
-    UINT subUVBufferSize = sizeof(FSubUVConstant);
-    BufferManager->CreateBufferGeneric<FSubUVConstant>("FSubUVConstant", nullptr, subUVBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
-
-    UINT materialBufferSize = sizeof(FMaterialConstants);
-    BufferManager->CreateBufferGeneric<FMaterialConstants>("FMaterialConstants", nullptr, materialBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
-
-    UINT subMeshBufferSize = sizeof(FSubMeshConstants);
-    BufferManager->CreateBufferGeneric<FSubMeshConstants>("FSubMeshConstants", nullptr, subMeshBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
-
-    UINT textureBufferSize = sizeof(FTextureConstants);
-    BufferManager->CreateBufferGeneric<FTextureConstants>("FTextureConstants", nullptr, textureBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
-
-    UINT lightingBufferSize = sizeof(FLighting);
-    BufferManager->CreateBufferGeneric<FLighting>("FLightBuffer", nullptr, lightingBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
-
-    UINT litUnlitBufferSize = sizeof(FLitUnlitConstants);
-    BufferManager->CreateBufferGeneric<FLitUnlitConstants>("FLitUnlitConstants", nullptr, litUnlitBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
-
-    UINT ScreenConstantsBufferSize = sizeof(FScreenConstants);
-    BufferManager->CreateBufferGeneric<FScreenConstants>("FScreenConstants", nullptr, ScreenConstantsBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
-
-    UINT FogConstantBufferSize = sizeof(FFogConstants);
-    BufferManager->CreateBufferGeneric<FFogConstants>("FFogConstants", nullptr, FogConstantBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
-
-    UINT RenderNormalBufferSize = sizeof(FRenderNormalConstants);
-    BufferManager->CreateBufferGeneric<FRenderNormalConstants>("FRenderNormalConstants", nullptr, RenderNormalBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
+    BufferManager->CreateConstantBuffer<FPerObjectConstantBuffer>();
+    BufferManager->CreateConstantBuffer<FCameraConstantBuffer>();
+    BufferManager->CreateConstantBuffer<FSubUVConstant>();
+    BufferManager->CreateConstantBuffer<FMaterialConstants>();
+    BufferManager->CreateConstantBuffer<FTextureConstants>();
+    BufferManager->CreateConstantBuffer<FLighting>();
+    BufferManager->CreateConstantBuffer<FLitUnlitConstants>();
+    BufferManager->CreateConstantBuffer<FScreenConstants>();
+    BufferManager->CreateConstantBuffer<FFogConstants>();
+    BufferManager->CreateConstantBuffer<FRenderNormalConstants>();
 }
 
 void FRenderer::ReleaseConstantBuffer()
@@ -146,26 +125,44 @@ void FRenderer::Render(const std::shared_ptr<FEditorViewportClient>& ActiveViewp
 
     //ChangeViewMode(ActiveViewport->GetViewMode());
 
-    UpdateLightBufferPass->Render(ActiveViewport);
-    StaticMeshRenderPass->Render(ActiveViewport);
-    BillboardRenderPass->Render(ActiveViewport);
-    
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(RenderPass_UpdateLightBuffer);
+        UpdateLightBufferPass->Render(ActiveViewport);
+    }
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(RenderPass_StaticMesh);
+        StaticMeshRenderPass->Render(ActiveViewport);
+    }
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(RenderPass_Billboard);
+        BillboardRenderPass->Render(ActiveViewport);
+    }
 
     if (IsSceneDepth)
     {
+        QUICK_SCOPE_CYCLE_COUNTER(RenderPass_DepthBufferDebug);
         DepthBufferDebugPass->RenderDepthBuffer(ActiveViewport);
     }
 
     if (!IsSceneDepth)
     {
+        QUICK_SCOPE_CYCLE_COUNTER(RenderPass_Fog);
         DepthBufferDebugPass->UpdateDepthBufferSRV();
         
         FogRenderPass->RenderFog(ActiveViewport, DepthBufferDebugPass->GetDepthSRV());
     }
-    LineRenderPass->Render(ActiveViewport);
-    GizmoRenderPass->Render(ActiveViewport);
-
-    EditorRenderPass->Render(ActiveViewport);
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(RenderPass_Line);
+        LineRenderPass->Render(ActiveViewport);
+    }
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(RenderPass_Gizmo);
+        GizmoRenderPass->Render(ActiveViewport);
+    }
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(RenderPass_Editor);
+        EditorRenderPass->Render(ActiveViewport);
+    }
 
     ClearRenderArr();
 }
@@ -54,8 +54,11 @@ public:
 public:
     template<typename T>
     ID3D11Buffer* CreateImmutableVertexBuffer(const FString& key, const TArray<T>& Vertices);
+    template<typename T>
+    ID3D11Buffer* CreateImmutableVertexBuffer(const FString& key, const T* Vertices, uint32 NumVertices);
 
     ID3D11Buffer* CreateImmutableIndexBuffer(const FString& key, const TArray<uint32>& indices);
+    ID3D11Buffer* CreateImmutableIndexBuffer(const FString& key, const uint32* Indices, uint32 NumIndices);
 
     // 상수 버퍼 생성/해제
     void CreateConstantBuffers();
@@ -88,9 +91,24 @@ inline ID3D11Buffer* FRenderer::CreateImmutableVertexBuffer(const FString& key,
     return VertexBufferInfo.VertexBuffer;
 }
 
+template<typename T>
+inline ID3D11Buffer* FRenderer::CreateImmutableVertexBuffer(const FString& key, const T* Vertices, uint32 NumVertices)
+{
+    FVertexInfo VertexBufferInfo;
+    BufferManager->CreateVertexBuffer(key, Vertices, NumVertices, VertexBufferInfo);
+    return VertexBufferInfo.VertexBuffer;
+}
+
 inline ID3D11Buffer* FRenderer::CreateImmutableIndexBuffer(const FString& key, const TArray<uint32>& indices)
 {
     FIndexInfo IndexInfo;
     BufferManager->CreateIndexBuffer(key, indices, IndexInfo);
     return IndexInfo.IndexBuffer;
 }
+
+inline ID3D11Buffer* FRenderer::CreateImmutableIndexBuffer(const FString& key, const uint32* Indices, uint32 NumIndices)
+{
+    FIndexInfo IndexInfo;
+    BufferManager->CreateIndexBuffer(key, Indices, NumIndices, IndexInfo);
+    return IndexInfo.IndexBuffer;
+}
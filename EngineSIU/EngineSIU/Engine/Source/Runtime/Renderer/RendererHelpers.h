@@ -52,7 +52,7 @@ namespace MaterialUtils {
             Graphics->DeviceContext->PSSetSamplers(1, 1, nullSampler);
         }
 
-        BufferManager->UpdateConstantBuffer(TEXT("FMaterialConstants"), data);
+        BufferManager->UpdateConstantBuffer(data);
 
     }
 }
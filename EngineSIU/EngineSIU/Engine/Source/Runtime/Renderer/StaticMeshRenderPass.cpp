@@ -6,7 +6,6 @@
 #include "RendererHelpers.h"
 #include "Math/JungleMath.h"
 
-#include "UObject/UObjectIterator.h"
 #include "UObject/Casts.h"
 
 #include "D3D11RHI/DXDBufferManager.h"
@@ -28,6 +27,8 @@ FStaticMeshRenderPass::FStaticMeshRenderPass()
     , PixelShader(nullptr)
     , InputLayout(nullptr)
     , Stride(0)
+    , InstanceBuffer(nullptr)
+    , InstanceBufferCapacity(0)
     , BufferManager(nullptr)
     , Graphics(nullptr)
     , ShaderManager(nullptr)
@@ -37,6 +38,7 @@ FStaticMeshRenderPass::FStaticMeshRenderPass()
 FStaticMeshRenderPass::~FStaticMeshRenderPass()
 {
     ReleaseShader();
+    FDXDBufferManager::SafeRelease(InstanceBuffer);
     if (ShaderManager)
     {
         delete ShaderManager;
@@ -53,6 +55,17 @@ void FStaticMeshRenderPass::CreateShader()
         {"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
         {"COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
         {"MATERIAL_INDEX", 0, DXGI_FORMAT_R32_UINT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        // FMeshInstanceData
+        {"INSTANCE_WORLD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_WORLD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_WORLD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_WORLD", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_NORMAL", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_NORMAL", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_NORMAL", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_NORMAL", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_UUID", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_FLAGS", 0, DXGI_FORMAT_R32G32_UINT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
     };
 
     D3D11_INPUT_ELEMENT_DESC TextureLayoutDesc[] = {
@@ -110,17 +123,32 @@ void FStaticMeshRenderPass::Initialize(FDXDBufferManager* InBufferManager, FGrap
     Graphics = InGraphics;
     ShaderManager = InShaderManager;
 
+    // Transform, UUID, 선택 여부는 Instance Buffer로 전달하므로 b0(FPerObjectConstantBuffer)는 사용하지 않습니다.
+    VSConstantBuffers = FConstantBufferBindList::Make<
+        FCameraConstantBuffer, FLighting, FMaterialConstants
+    >(1, EShaderStage::Vertex);
+
+    // 선택된 서브메시도 Instance Buffer(flags.y)로 전달합니다.
+    PSConstantBuffers = FConstantBufferBindList::Make<
+        FCameraConstantBuffer, FLighting, FMaterialConstants, FLitUnlitConstants,
+        FTextureConstants, FRenderNormalConstants
+    >(1, EShaderStage::Pixel);
+
     CreateShader();
 }
 
 void FStaticMeshRenderPass::PrepareRender()
 {
-    for (const auto iter : TObjectRange<UStaticMeshComponent>())
+    // 통계는 모든 뷰포트를 합산하므로 프레임이 시작할 때 넘깁니다.
+    LastFrameDrawStats = DrawStats;
+    DrawStats = FMeshDrawStats();
+
+    // 그릴 컴포넌트는 Render에서 뷰포트마다 World의 공간 인덱스로 찾습니다.
+    // 여기서는 이번 프레임에 움직인 컴포넌트의 월드 Transform과 Primitive의 Bounds만 미리 반영해 둡니다.
+    if (UWorld* World = GEngine->ActiveWorld)
     {
-        if (!Cast<UGizmoBaseComponent>(iter) && iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            StaticMeshObjs.Add(iter);
-        }
+        World->UpdateComponentTransforms();
+        World->GetPrimitiveSceneIndex().Update();
     }
 }
 
@@ -130,84 +158,22 @@ void FStaticMeshRenderPass::PrepareRenderState() const
     Graphics->DeviceContext->PSSetShader(PixelShader, nullptr, 0);
     Graphics->DeviceContext->IASetInputLayout(InputLayout);
 
-    // 상수 버퍼 바인딩 예시
-    // ID3D11Buffer* PerObjectBuffer = BufferManager->GetConstantBuffer(TEXT("FPerObjectConstantBuffer"));
-    // ID3D11Buffer* CameraConstantBuffer = BufferManager->GetConstantBuffer(TEXT("FCameraConstantBuffer"));
-    // Graphics->DeviceContext->VSSetConstantBuffers(0, 1, &PerObjectBuffer);
-    // Graphics->DeviceContext->VSSetConstantBuffers(1, 1, &CameraConstantBuffer);
-
-    TArray<FString> VSBufferKeys = {TEXT("FPerObjectConstantBuffer"),
-                                  TEXT("FCameraConstantBuffer"),
-                                  TEXT("FLightBuffer"),
-                                    TEXT("FMaterialConstants")
-    };
-    BufferManager->BindConstantBuffers(VSBufferKeys, 0, EShaderStage::Vertex);
-
-    TArray<FString> PSBufferKeys = {
-                                  TEXT("FCameraConstantBuffer"),
-                                  TEXT("FLightBuffer"),
-                                  TEXT("FMaterialConstants"),
-                                  TEXT("FLitUnlitConstants"),
-                                  TEXT("FSubMeshConstants"),
-                                  TEXT("FTextureConstants"),
-                                  TEXT("FRenderNormalConstants")
-    };
-
-    BufferManager->BindConstantBuffers(PSBufferKeys, 1, EShaderStage::Pixel);
-}
-
-void FStaticMeshRenderPass::UpdatePerObjectConstant(const FMatrix& Model, const FMatrix& View, const FMatrix& Projection, const FVector4& UUIDColor, bool Selected) const
-{
-    FMatrix NormalMatrix = RendererHelpers::CalculateNormalMatrix(Model);
-    FPerObjectConstantBuffer Data(Model, NormalMatrix, UUIDColor, Selected);
-    BufferManager->UpdateConstantBuffer(TEXT("FPerObjectConstantBuffer"), Data);
-   
+    BufferManager->BindConstantBuffers(VSConstantBuffers);
+    BufferManager->BindConstantBuffers(PSConstantBuffers);
 }
 
 void FStaticMeshRenderPass::UpdateLitUnlitConstant(int isLit) const
 {
     FLitUnlitConstants Data;
     Data.isLit = isLit;
-    BufferManager->UpdateConstantBuffer(TEXT("FLitUnlitConstants"), Data);
+    BufferManager->UpdateConstantBuffer(Data);
 }
 
 void FStaticMeshRenderPass::UpdateRenderNormalConstant(bool bRenderNormal) const
 {
     FRenderNormalConstants Data = FRenderNormalConstants(false, FVector(0.f, 0.f, 0.f));
     Data.bRenderNormal = bRenderNormal;
-    BufferManager->UpdateConstantBuffer(TEXT("FRenderNormalConstants"), Data);
-}
-
-
-void FStaticMeshRenderPass::RenderPrimitive(OBJ::FStaticMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex) const
-{
-    UINT offset = 0;
-    Graphics->DeviceContext->IASetVertexBuffers(0, 1, &RenderData->VertexBuffer, &Stride, &offset);
-    if (RenderData->IndexBuffer)
-        Graphics->DeviceContext->IASetIndexBuffer(RenderData->IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-
-    if (RenderData->MaterialSubsets.Num() == 0) {
-        Graphics->DeviceContext->DrawIndexed(RenderData->Indices.Num(), 0, 0);
-        return;
-    }
-
-    for (int subMeshIndex = 0; subMeshIndex < RenderData->MaterialSubsets.Num(); subMeshIndex++) {
-
-        int materialIndex = RenderData->MaterialSubsets[subMeshIndex].MaterialIndex;
-
-        FSubMeshConstants SubMeshData = (subMeshIndex == SelectedSubMeshIndex) ? FSubMeshConstants(true) : FSubMeshConstants(false);
-
-        BufferManager->UpdateConstantBuffer(TEXT("FSubMeshConstants"), SubMeshData);
-
-        if (OverrideMaterials[materialIndex] != nullptr)
-            MaterialUtils::UpdateMaterial(BufferManager, Graphics, OverrideMaterials[materialIndex]->GetMaterialInfo());
-        else
-            MaterialUtils::UpdateMaterial(BufferManager, Graphics, Materials[materialIndex]->Material->GetMaterialInfo());
-
-        uint64 startIndex = RenderData->MaterialSubsets[subMeshIndex].IndexStart;
-        uint64 indexCount = RenderData->MaterialSubsets[subMeshIndex].IndexCount;
-        Graphics->DeviceContext->DrawIndexed(indexCount, startIndex, 0);
-    }
+    BufferManager->UpdateConstantBuffer(Data);
 }
 
 
@@ -232,34 +198,166 @@ void FStaticMeshRenderPass::Render(const std::shared_ptr<FEditorViewportClient>&
 
     PrepareRenderState();
 
-    for (UStaticMeshComponent* Comp : StaticMeshObjs) {
-        if (!Comp || !Comp->GetStaticMesh()) continue;
-        
-        FMatrix Model = Comp->GetWorldMatrix();
-        FVector4 UUIDColor = Comp->EncodeUUID() / 255.0f;
-        UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
-        bool Selected = (Engine && Engine->GetSelectedActor() == Comp->GetOwner());
+    UWorld* World = GEngine->ActiveWorld;
+    if (!World) return;
 
-        UpdatePerObjectConstant(Model, Viewport->GetViewMatrix(), Viewport->GetProjectionMatrix(), UUIDColor, Selected);
-        FCameraConstantBuffer CameraData(Viewport->GetViewMatrix(), Viewport->GetProjectionMatrix(), Viewport->ViewTransformPerspective.GetLocation(), 0);
-        BufferManager->UpdateConstantBuffer(TEXT("FCameraConstantBuffer"), CameraData);
+    FPrimitiveSceneIndex& SceneIndex = World->GetPrimitiveSceneIndex();
 
-        OBJ::FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData();
+    const FFrustum ViewFrustum(Viewport->GetViewMatrix() * Viewport->GetProjectionMatrix());
+    VisiblePrimitives.Empty();
+    SceneIndex.QueryFrustum(ViewFrustum, EScenePrimitiveType::StaticMesh, VisiblePrimitives);
+    CullingStats.NumVisible = VisiblePrimitives.Num();
+    CullingStats.NumCulled = SceneIndex.Num(EScenePrimitiveType::StaticMesh) - CullingStats.NumVisible;
+
+    // 카메라는 뷰마다 한 번만 올립니다.
+    FCameraConstantBuffer CameraData(Viewport->GetViewMatrix(), Viewport->GetProjectionMatrix(), Viewport->ViewTransformPerspective.GetLocation(), 0);
+    BufferManager->UpdateConstantBuffer(CameraData);
+    ++DrawStats.NumConstantBufferUploads;
 
+    BuildDrawPackets(Viewport);
+    DrawCommands.Sort();
+    SubmitDrawPackets();
+}
+
+void FStaticMeshRenderPass::BuildDrawPackets(const std::shared_ptr<FEditorViewportClient>& Viewport)
+{
+    DrawCommands.Reset();
+
+    UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
+    AActor* SelectedActor = Engine ? Engine->GetSelectedActor() : nullptr;
+    const bool bShowAABB = Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_AABB);
+
+    for (UPrimitiveComponent* Primitive : VisiblePrimitives)
+    {
+        // QueryFrustum에서 Gizmo가 아닌 Static Mesh만 골랐습니다.
+        UStaticMeshComponent* Comp = static_cast<UStaticMeshComponent*>(Primitive);
+        if (!Comp->GetStaticMesh()) continue;
+
+        OBJ::FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData();
         if (RenderData == nullptr) continue;
 
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+        const FMatrix Model = Comp->GetWorldMatrix();
+        const uint32 ObjectIndex = DrawCommands.AddObject(Model, Comp->EncodeUUID() / 255.0f, SelectedActor == Comp->GetOwner());
+
+        if (RenderData->MaterialSubsets.Num() == 0)
+        {
+            DrawCommands.AddPacket(ObjectIndex, RenderData, 0, nullptr, 0, RenderData->GetNumIndices(), false);
+        }
+        else
+        {
+            const TArray<FStaticMaterial*>& Materials = Comp->GetStaticMesh()->GetMaterials();
+            const TArray<UMaterial*>& OverrideMaterials = Comp->GetOverrideMaterials();
+            const int32 SelectedSubMeshIndex = Comp->GetselectedSubMeshIndex();
+
+            for (int32 SubMeshIndex = 0; SubMeshIndex < RenderData->MaterialSubsets.Num(); ++SubMeshIndex)
+            {
+                const FMaterialSubset& Subset = RenderData->MaterialSubsets[SubMeshIndex];
+                UMaterial* Material = OverrideMaterials[Subset.MaterialIndex];
+                if (Material == nullptr)
+                {
+                    Material = Materials[Subset.MaterialIndex]->Material;
+                }
+
+                DrawCommands.AddPacket(ObjectIndex, RenderData, SubMeshIndex, &Material->GetMaterialInfo(), Subset.IndexStart, Subset.IndexCount, SubMeshIndex == SelectedSubMeshIndex);
+            }
+        }
 
-        if (Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_AABB))
+        if (bShowAABB)
         {
             FEngineLoop::PrimitiveDrawBatch.AddAABBToBatch(Comp->GetBoundingBox(), Comp->GetWorldLocation(), Model);
         }
     }
 }
 
+void FStaticMeshRenderPass::SubmitDrawPackets()
+{
+    DrawCommands.BuildBatches(InstanceData, DrawBatches);
+    DrawStats.NumPackets += DrawCommands.GetPackets().Num();
+
+    const uint32 NumInstances = static_cast<uint32>(InstanceData.Num());
+    if (NumInstances == 0 || !ReserveInstanceBuffer(NumInstances))
+    {
+        return;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE Mapped;
+    if (FAILED(Graphics->DeviceContext->Map(InstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+    {
+        return;
+    }
+    memcpy(Mapped.pData, InstanceData.GetData(), sizeof(FMeshInstanceData) * NumInstances);
+    Graphics->DeviceContext->Unmap(InstanceBuffer, 0);
+
+    const OBJ::FStaticMeshRenderData* BoundRenderData = nullptr;
+    const FObjMaterialInfo* BoundMaterial = nullptr;
+
+    for (const FMeshDrawBatch& Batch : DrawBatches)
+    {
+        if (Batch.RenderData != BoundRenderData)
+        {
+            ID3D11Buffer* VertexBuffers[2] = { Batch.RenderData->VertexBuffer, InstanceBuffer };
+            const UINT Strides[2] = { Stride, sizeof(FMeshInstanceData) };
+            const UINT Offsets[2] = { 0, 0 };
+            Graphics->DeviceContext->IASetVertexBuffers(0, 2, VertexBuffers, Strides, Offsets);
+            if (Batch.RenderData->IndexBuffer)
+            {
+                Graphics->DeviceContext->IASetIndexBuffer(Batch.RenderData->IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+            }
+            BoundRenderData = Batch.RenderData;
+            ++DrawStats.NumStateChanges;
+        }
+
+        if (Batch.Material && Batch.Material != BoundMaterial)
+        {
+            MaterialUtils::UpdateMaterial(BufferManager, Graphics, *Batch.Material);
+            BoundMaterial = Batch.Material;
+            ++DrawStats.NumStateChanges;
+            ++DrawStats.NumConstantBufferUploads;
+        }
+
+        // Per-Instance 입력은 StartInstanceLocation만큼 밀려서 읽히므로 Batch마다 상수 버퍼를 바꿀 필요가 없습니다.
+        Graphics->DeviceContext->DrawIndexedInstanced(Batch.IndexCount, Batch.NumInstances, Batch.IndexStart, 0, Batch.FirstInstance);
+        ++DrawStats.NumDraws;
+        DrawStats.NumInstances += Batch.NumInstances;
+    }
+}
+
+bool FStaticMeshRenderPass::ReserveInstanceBuffer(uint32 NumInstances)
+{
+    if (InstanceBuffer && NumInstances <= InstanceBufferCapacity)
+    {
+        return true;
+    }
+
+    uint32 NewCapacity = FMath::Max(InstanceBufferCapacity * 2, 256u);
+    while (NewCapacity < NumInstances)
+    {
+        NewCapacity *= 2;
+    }
+
+    D3D11_BUFFER_DESC Desc = {};
+    Desc.ByteWidth = sizeof(FMeshInstanceData) * NewCapacity;
+    Desc.Usage = D3D11_USAGE_DYNAMIC;
+    Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    ID3D11Buffer* NewBuffer = nullptr;
+    if (FAILED(Graphics->Device->CreateBuffer(&Desc, nullptr, &NewBuffer)))
+    {
+        UE_LOG(LogLevel::Error, TEXT("Failed to create static mesh instance buffer (%u instances)"), NewCapacity);
+        return false;
+    }
+
+    FDXDBufferManager::SafeRelease(InstanceBuffer);
+    InstanceBuffer = NewBuffer;
+    InstanceBufferCapacity = NewCapacity;
+    return true;
+}
+
 void FStaticMeshRenderPass::ClearRenderArr()
 {
-    StaticMeshObjs.Empty();
+    VisiblePrimitives.Empty();
+    DrawCommands.Reset();
 }
 
 void FStaticMeshRenderPass::UpdateShadersByViewMode(EViewModeIndex evi)
@@ -3,6 +3,9 @@
 #include "EngineBaseTypes.h"
 #include "Container/Set.h"
 #include "Define.h"
+#include "FrustumCulling.h"
+#include "D3D11RHI/DXDBufferManager.h"
+#include "MeshDrawCommandList.h"
 
 class DXDShaderManager;
 
@@ -14,6 +17,8 @@ class FEditorViewportClient;
 
 class UStaticMeshComponent;
 
+class UPrimitiveComponent;
+
 struct FStaticMaterial;
 
 struct FShaderPipeline;
@@ -36,14 +41,10 @@ public:
 
     void PrepareRenderState() const;
     
-    void UpdatePerObjectConstant(const FMatrix& Model, const FMatrix& View, const FMatrix& Projection, const FVector4& UUIDColor, bool Selected) const;
-  
     void UpdateLitUnlitConstant(int isLit) const;
 
     void UpdateRenderNormalConstant(bool bRenderNormal) const;
 
-    void RenderPrimitive(OBJ::FStaticMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex) const;
-    
     void RenderPrimitive(ID3D11Buffer* pBuffer, UINT numVertices) const;
 
     void RenderPrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, ID3D11Buffer* pIndexBuffer, UINT numIndices) const;
@@ -53,8 +54,40 @@ public:
     void ReleaseShader();
 
     void ChangeViewMode(EViewModeIndex evi) const;
+
+    /** 마지막으로 렌더링한 뷰포트의 컬링 결과 (World에 등록된 모든 Primitive 기준) */
+    const FCullingStats& GetCullingStats() const { return CullingStats; }
+
+    /** 마지막 프레임의 Draw, State 변경, 상수 버퍼 업로드 횟수 (모든 뷰포트 합계) */
+    const FMeshDrawStats& GetDrawStats() const { return LastFrameDrawStats; }
+
 private:
-    TArray<UStaticMeshComponent*> StaticMeshObjs;
+    /** 보이는 컴포넌트의 Subset마다 Draw Packet을 만듭니다. */
+    void BuildDrawPackets(const std::shared_ptr<FEditorViewportClient>& Viewport);
+
+    /** 정렬된 Packet을 Batch로 묶어 Instance Buffer에 올리고, 직전 Batch와 다른 상태만 바꾸면서 제출합니다. */
+    void SubmitDrawPackets();
+
+    /** Instance Buffer가 NumInstances개를 담을 수 있도록 필요하면 다시 만듭니다. */
+    bool ReserveInstanceBuffer(uint32 NumInstances);
+
+private:
+    /** 현재 뷰포트의 절두체와 겹치는 Primitive (World의 공간 인덱스에서 쿼리) */
+    TArray<UPrimitiveComponent*> VisiblePrimitives;
+
+    FCullingStats CullingStats;
+
+    FMeshDrawCommandList DrawCommands;
+
+    TArray<FMeshInstanceData> InstanceData;
+    TArray<FMeshDrawBatch> DrawBatches;
+
+    /** 모든 Batch의 Instance 데이터를 담는 Dynamic Vertex Buffer (Input Slot 1) */
+    ID3D11Buffer* InstanceBuffer;
+    uint32 InstanceBufferCapacity;
+
+    FMeshDrawStats DrawStats;
+    FMeshDrawStats LastFrameDrawStats;
 
     ID3D11VertexShader* VertexShader;
     
@@ -64,6 +97,10 @@ private:
     
     uint32 Stride;
 
+    /** Initialize에서 한 번 만들어 두는 상수 버퍼 바인딩 목록 */
+    FConstantBufferBindList VSConstantBuffers;
+    FConstantBufferBindList PSConstantBuffers;
+
     FDXDBufferManager* BufferManager;
     
     FGraphicsDevice* Graphics;
@@ -0,0 +1,231 @@
+#include "TextLayout.h"
+
+#include <cassert>
+
+FGlyphAtlas::FGlyphAtlas(int32 InColumnCount, int32 InRowCount)
+    : ColumnCount(InColumnCount)
+    , RowCount(InRowCount)
+{
+    if (ColumnCount <= 0 || RowCount <= 0)
+    {
+        ColumnCount = RowCount = 0;
+        return;
+    }
+
+    CellUVSize = FVector2D(1.0f / static_cast<float>(ColumnCount), 1.0f / static_cast<float>(RowCount));
+
+    CellUVs.SetNum(ColumnCount * RowCount);
+    for (int32 Row = 0; Row < RowCount; ++Row)
+    {
+        for (int32 Column = 0; Column < ColumnCount; ++Column)
+        {
+            CellUVs[Row * ColumnCount + Column] = FVector2D(Column * CellUVSize.X, Row * CellUVSize.Y);
+        }
+    }
+
+    for (int32& Cell : AsciiCells)
+    {
+        Cell = INDEX_NONE;
+    }
+    for (int32 Index = 0; Index < 10; ++Index)
+    {
+        AsciiCells['0' + Index] = DigitStartCell + Index;
+    }
+    for (int32 Index = 0; Index < 26; ++Index)
+    {
+        AsciiCells['A' + Index] = UpperStartCell + Index;
+        AsciiCells['a' + Index] = LowerStartCell + Index;
+    }
+}
+
+int32 FGlyphAtlas::GetCellIndex(wchar_t Character) const
+{
+    const uint32 Code = static_cast<uint32>(Character);
+
+    int32 Cell = INDEX_NONE;
+    if (Code < 128)
+    {
+        Cell = AsciiCells[Code];
+    }
+    else if (Code >= static_cast<uint32>(L'가') && Code <= static_cast<uint32>(L'힣'))
+    {
+        Cell = HangulStartCell + static_cast<int32>(Code - static_cast<uint32>(L'가'));
+    }
+
+    return Cell < CellUVs.Num() ? Cell : INDEX_NONE;
+}
+
+bool FGlyphAtlas::FindGlyph(wchar_t Character, FVector2D& OutUVMin, FVector2D& OutUVMax) const
+{
+    const int32 Cell = GetCellIndex(Character);
+    if (Cell == INDEX_NONE)
+    {
+        return false;
+    }
+
+    OutUVMin = CellUVs[Cell];
+    OutUVMax = OutUVMin + CellUVSize;
+    return true;
+}
+
+void TextLayout::LayoutText(const FWString& Text, const FGlyphAtlas& Atlas, float QuadWidth, float QuadHeight, TArray<FTextGlyphQuad>& OutQuads)
+{
+    OutQuads.Empty();
+    OutQuads.Reserve(static_cast<int32>(Text.size()));
+
+    // UTextComponent::CheckRayIntersection의 글자 사각형과 같은 위치에 놓아야 Picking이 맞습니다.
+    const float HalfWidth = QuadWidth * 0.5f;
+    const float HalfHeight = QuadHeight * 0.5f;
+    const float CenterOffset = QuadWidth * static_cast<float>(Text.size()) * 0.5f;
+
+    for (size_t Index = 0; Index < Text.size(); ++Index)
+    {
+        FTextGlyphQuad Quad;
+        if (!Atlas.FindGlyph(Text[Index], Quad.UVMin, Quad.UVMax))
+        {
+            continue;
+        }
+
+        const float CenterX = QuadWidth * static_cast<float>(Index) - CenterOffset;
+        Quad.PositionMin = FVector2D(CenterX - HalfWidth, -HalfHeight);
+        Quad.PositionMax = FVector2D(CenterX + HalfWidth, HalfHeight);
+        OutQuads.Add(Quad);
+    }
+}
+
+void TextLayout::AppendQuadVertices(const TArray<FTextGlyphQuad>& Quads, const FMatrix& Model, TArray<FVertexTexture>& OutVertices)
+{
+    // 글자는 모두 로컬 Z = 0 평면에 있으므로 Model의 X, Y 축과 원점만으로 변환합니다.
+    const FVector AxisX(Model.M[0][0], Model.M[0][1], Model.M[0][2]);
+    const FVector AxisY(Model.M[1][0], Model.M[1][1], Model.M[1][2]);
+    const FVector Origin(Model.M[3][0], Model.M[3][1], Model.M[3][2]);
+
+    const int32 FirstVertex = OutVertices.Num();
+    OutVertices.SetNum(FirstVertex + Quads.Num() * 6);
+    FVertexTexture* Vertex = OutVertices.GetData() + FirstVertex;
+
+    auto MakeVertex = [&](float X, float Y, float U, float V)
+    {
+        const FVector Position = Origin + AxisX * X + AxisY * Y;
+        return FVertexTexture{ Position.X, Position.Y, Position.Z, U, V };
+    };
+
+    for (const FTextGlyphQuad& Quad : Quads)
+    {
+        const FVertexTexture LeftUp = MakeVertex(Quad.PositionMin.X, Quad.PositionMax.Y, Quad.UVMin.X, Quad.UVMin.Y);
+        const FVertexTexture RightUp = MakeVertex(Quad.PositionMax.X, Quad.PositionMax.Y, Quad.UVMax.X, Quad.UVMin.Y);
+        const FVertexTexture LeftDown = MakeVertex(Quad.PositionMin.X, Quad.PositionMin.Y, Quad.UVMin.X, Quad.UVMax.Y);
+        const FVertexTexture RightDown = MakeVertex(Quad.PositionMax.X, Quad.PositionMin.Y, Quad.UVMax.X, Quad.UVMax.Y);
+
+        *Vertex++ = LeftUp;
+        *Vertex++ = RightUp;
+        *Vertex++ = LeftDown;
+        *Vertex++ = RightUp;
+        *Vertex++ = RightDown;
+        *Vertex++ = LeftDown;
+    }
+}
+
+FTextLayoutCache::FTextLayoutCache(int32 InCapacity)
+    : Capacity(InCapacity > 0 ? InCapacity : 1)
+{
+}
+
+const TArray<FTextGlyphQuad>& FTextLayoutCache::FindOrLayout(const FWString& Text, const FGlyphAtlas& Atlas, float QuadWidth, float QuadHeight)
+{
+    int32 Index;
+    if (const int32* Found = EntryIndices.Find(Text))
+    {
+        Index = *Found;
+        Unlink(Index);
+
+        FEntry& Entry = Entries[Index];
+        if (Entry.ColumnCount == Atlas.GetColumnCount() && Entry.RowCount == Atlas.GetRowCount()
+            && Entry.QuadWidth == QuadWidth && Entry.QuadHeight == QuadHeight)
+        {
+            ++Stats.NumHits;
+            LinkFront(Index);
+            return Entry.Quads;
+        }
+    }
+    else if (Entries.Num() < Capacity)
+    {
+        Index = Entries.Add(FEntry());
+        Entries[Index].Text = Text;
+        EntryIndices.Add(Text, Index);
+    }
+    else
+    {
+        // 가장 오래 쓰이지 않은 항목의 자리를 재사용합니다. Quads의 할당도 그대로 다시 씁니다.
+        Index = Tail;
+        Unlink(Index);
+        EntryIndices.Remove(Entries[Index].Text);
+        ++Stats.NumEvictions;
+
+        Entries[Index].Text = Text;
+        EntryIndices.Add(Text, Index);
+    }
+
+    ++Stats.NumMisses;
+
+    FEntry& Entry = Entries[Index];
+    Entry.ColumnCount = Atlas.GetColumnCount();
+    Entry.RowCount = Atlas.GetRowCount();
+    Entry.QuadWidth = QuadWidth;
+    Entry.QuadHeight = QuadHeight;
+    TextLayout::LayoutText(Text, Atlas, QuadWidth, QuadHeight, Entry.Quads);
+
+    LinkFront(Index);
+    return Entry.Quads;
+}
+
+void FTextLayoutCache::Empty()
+{
+    Entries.Empty();
+    EntryIndices.Empty();
+    Head = Tail = INDEX_NONE;
+}
+
+void FTextLayoutCache::Unlink(int32 Index)
+{
+    FEntry& Entry = Entries[Index];
+    if (Entry.Prev != INDEX_NONE)
+    {
+        Entries[Entry.Prev].Next = Entry.Next;
+    }
+    else
+    {
+        assert(Head == Index);
+        Head = Entry.Next;
+    }
+
+    if (Entry.Next != INDEX_NONE)
+    {
+        Entries[Entry.Next].Prev = Entry.Prev;
+    }
+    else
+    {
+        assert(Tail == Index);
+        Tail = Entry.Prev;
+    }
+
+    Entry.Prev = Entry.Next = INDEX_NONE;
+}
+
+void FTextLayoutCache::LinkFront(int32 Index)
+{
+    FEntry& Entry = Entries[Index];
+    Entry.Prev = INDEX_NONE;
+    Entry.Next = Head;
+
+    if (Head != INDEX_NONE)
+    {
+        Entries[Head].Prev = Index;
+    }
+    Head = Index;
+
+    if (Tail == INDEX_NONE)
+    {
+        Tail = Index;
+    }
+}
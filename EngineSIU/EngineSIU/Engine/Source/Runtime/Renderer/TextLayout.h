@@ -0,0 +1,136 @@
+#pragma once
+#include "Define.h"
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "CoreMiscDefines.h"
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+
+/** 로컬 평면(X 오른쪽, Y 위)에 놓인 글자 하나의 사각형과 Atlas UV 범위 */
+struct FTextGlyphQuad
+{
+    FVector2D PositionMin;
+    FVector2D PositionMax;
+
+    /** UVMin은 왼쪽 위, UVMax는 오른쪽 아래 모서리입니다. */
+    FVector2D UVMin;
+    FVector2D UVMax;
+};
+
+/**
+ * 격자 형태 폰트 Atlas(Assets/Texture/font.png)의 글자 -> 셀 UV 표.
+ *
+ * 셀은 왼쪽 위부터 행 우선으로 번호가 매겨지며, 0번은 공백, 1~10번은 숫자, 11~36번은 대문자,
+ * 37~62번은 소문자, 63번부터는 '가'~'힣' 순서입니다.
+ * 셀마다 UV를 미리 계산해 두므로 글자 하나를 찾을 때 나눗셈 없이 표만 읽습니다.
+ */
+class FGlyphAtlas
+{
+public:
+    static constexpr int32 DigitStartCell = 1;
+    static constexpr int32 UpperStartCell = 11;
+    static constexpr int32 LowerStartCell = 37;
+    static constexpr int32 HangulStartCell = 63;
+
+    FGlyphAtlas() = default;
+    FGlyphAtlas(int32 InColumnCount, int32 InRowCount);
+
+    /** 글자가 들어 있는 셀 번호. 그릴 것이 없는 공백이나 Atlas에 없는 글자는 INDEX_NONE입니다. */
+    int32 GetCellIndex(wchar_t Character) const;
+
+    /** 글자의 UV 범위를 찾습니다. 그릴 것이 없는 글자면 false를 반환합니다. */
+    bool FindGlyph(wchar_t Character, FVector2D& OutUVMin, FVector2D& OutUVMax) const;
+
+    int32 GetColumnCount() const { return ColumnCount; }
+    int32 GetRowCount() const { return RowCount; }
+    bool IsValid() const { return !CellUVs.IsEmpty(); }
+
+private:
+    int32 ColumnCount = 0;
+    int32 RowCount = 0;
+
+    /** 셀 하나의 UV 크기 (1 / ColumnCount, 1 / RowCount) */
+    FVector2D CellUVSize;
+
+    /** 셀 번호 -> 왼쪽 위 UV */
+    TArray<FVector2D> CellUVs;
+
+    /** ASCII 글자 -> 셀 번호 */
+    int32 AsciiCells[128] = {};
+};
+
+namespace TextLayout
+{
+    /**
+     * Text를 글자당 QuadWidth x QuadHeight 크기의 사각형으로 한 줄에 배치합니다.
+     * 줄 전체가 로컬 원점을 기준으로 가로 정렬되며, 공백과 Atlas에 없는 글자는 자리만 차지하고 사각형을 만들지 않습니다.
+     * OutQuads는 비운 뒤에 채웁니다.
+     */
+    void LayoutText(const FWString& Text, const FGlyphAtlas& Atlas, float QuadWidth, float QuadHeight, TArray<FTextGlyphQuad>& OutQuads);
+
+    /** 글자 사각형마다 삼각형 두 개(정점 6개)를 Model로 변환해서 OutVertices 뒤에 붙입니다. */
+    void AppendQuadVertices(const TArray<FTextGlyphQuad>& Quads, const FMatrix& Model, TArray<FVertexTexture>& OutVertices);
+}
+
+/** 한 번의 캐시 사용에 대한 통계 */
+struct FTextLayoutCacheStats
+{
+    uint32 NumHits = 0;
+    uint32 NumMisses = 0;
+    uint32 NumEvictions = 0;
+};
+
+/**
+ * 문자열별 TextLayout::LayoutText 결과를 최대 Capacity개까지 보관하는 LRU 캐시.
+ * UUID 라벨처럼 내용이 바뀌지 않는 문자열은 매 프레임 글자를 다시 찾지 않고,
+ * 계속 바뀌는 문자열은 가장 오래 쓰이지 않은 항목을 밀어내므로 메모리가 늘어나지 않습니다.
+ */
+class FTextLayoutCache
+{
+public:
+    explicit FTextLayoutCache(int32 InCapacity = 1024);
+
+    /**
+     * Text의 배치 결과를 반환합니다. 없거나 다른 Atlas, 크기로 배치된 결과면 새로 배치합니다.
+     * 반환한 참조는 다음 FindOrLayout 호출 전까지만 유효합니다.
+     */
+    const TArray<FTextGlyphQuad>& FindOrLayout(const FWString& Text, const FGlyphAtlas& Atlas, float QuadWidth, float QuadHeight);
+
+    void Empty();
+
+    int32 Num() const { return EntryIndices.Num(); }
+    int32 GetCapacity() const { return Capacity; }
+
+    const FTextLayoutCacheStats& GetStats() const { return Stats; }
+    void ResetStats() { Stats = FTextLayoutCacheStats(); }
+
+private:
+    struct FEntry
+    {
+        FWString Text;
+        TArray<FTextGlyphQuad> Quads;
+        int32 ColumnCount = 0;
+        int32 RowCount = 0;
+        float QuadWidth = 0.f;
+        float QuadHeight = 0.f;
+
+        /** 최근에 쓰인 순서로 이은 목록. Head가 가장 최근입니다. */
+        int32 Prev = INDEX_NONE;
+        int32 Next = INDEX_NONE;
+    };
+
+    void Unlink(int32 Index);
+    void LinkFront(int32 Index);
+
+private:
+    int32 Capacity;
+
+    TArray<FEntry> Entries;
+    TMap<FWString, int32> EntryIndices;
+
+    int32 Head = INDEX_NONE;
+    int32 Tail = INDEX_NONE;
+
+    FTextLayoutCacheStats Stats;
+};
@@ -11,6 +11,9 @@
 #include "Components/Light/SpotLightComponent.h"
 #include "Engine/EditorEngine.h"
 #include "GameFramework/Actor.h"
+#include "Math/MathUtility.h"
+#include "Stats/Stats.h"
+#include "UnrealEd/EditorViewportClient.h"
 
 #include "UObject/UObjectIterator.h"
 
@@ -26,6 +29,10 @@ FUpdateLightBufferPass::FUpdateLightBufferPass()
 
 FUpdateLightBufferPass::~FUpdateLightBufferPass()
 {
+    ReleaseStructuredBuffer(PointLightBuffer);
+    ReleaseStructuredBuffer(SpotLightBuffer);
+    ReleaseStructuredBuffer(ClusterBuffer);
+    ReleaseStructuredBuffer(LightIndexBuffer);
 }
 
 void FUpdateLightBufferPass::Initialize(FDXDBufferManager* InBufferManager, FGraphicsDevice* InGraphics, FDXDShaderManager* InShaderManager)
@@ -46,13 +53,42 @@ void FUpdateLightBufferPass::PrepareRender()
             {
                 this->AmbientLight = AmbientLight;
             }
-            if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(iter))
+            if (UPointLightComponent* Light = Cast<UPointLightComponent>(iter))
             {
-                PointLights.Add(PointLight);
+                FPointLightInfo PointLight = {};
+                PointLight.Position = Light->GetWorldLocation();
+                FLinearColor DiffuseColor = Light->GetDiffuseColor();
+                PointLight.DiffuseColor = FVector(DiffuseColor.R, DiffuseColor.G, DiffuseColor.B);
+                FLinearColor SpecularColor = Light->GetSpecularColor();
+                PointLight.SpecularColor = FVector(SpecularColor.R, SpecularColor.G, SpecularColor.B);
+                PointLight.Intensity = Light->GetIntensity();
+                PointLight.m_fAttRadius = Light->GetAttenuationRadius();
+                PointLight.m_fAttenuation = Light->GetAttenuation();
+
+                PointLightInfos.Add(PointLight);
+                ClusterPointLights.Add({ PointLight.Position, PointLight.m_fAttRadius });
             }
-            else if (USpotLightComponent* SpotLight = Cast<USpotLightComponent>(iter))
+            else if (USpotLightComponent* Light = Cast<USpotLightComponent>(iter))
             {
-                SpotLights.Add(SpotLight);
+                FSpotLightInfo SpotLight = {};
+                SpotLight.Position = Light->GetWorldLocation();
+                SpotLight.Direction = Light->GetForwardVector();
+                FLinearColor DiffuseColor = Light->GetDiffuseColor();
+                SpotLight.DiffuseColor = FVector(DiffuseColor.R, DiffuseColor.G, DiffuseColor.B);
+                FLinearColor SpecularColor = Light->GetSpecularColor();
+                SpotLight.SpecularColor = FVector(SpecularColor.R, SpecularColor.G, SpecularColor.B);
+                SpotLight.Intensity = Light->GetIntensity();
+                SpotLight.m_fAttRadius = Light->GetAttenuationRadius();
+                SpotLight.m_fFalloff = Light->GetFalloff();
+                SpotLight.m_fAttenuation = Light->GetAttenuation();
+                SpotLight.InnerConeAngle = Light->GetInnerConeAngle();
+                SpotLight.OuterConeAngle = Light->GetOuterConeAngle();
+
+                SpotLightInfos.Add(SpotLight);
+
+                // Lambert/Blinn-Phong의 Spot 감쇠는 pow(saturate(cos), Falloff)라서 광원 앞쪽 반구 전체를 비추므로
+                // 반각 90도 원뿔로 배정합니다. Gouraud가 쓰는 OuterConeAngle은 이 안에 들어갑니다.
+                ClusterSpotLights.Add({ SpotLight.Position, SpotLight.m_fAttRadius, SpotLight.Direction.GetSafeNormal(), 0.0f, 1.0f });
             }
         }
     }
@@ -73,62 +109,118 @@ void FUpdateLightBufferPass::Render(const std::shared_ptr<FEditorViewportClient>
     DirectionalLight.Color = FVector(1.0f, 1.0f, 0.95f);         // 약간 따뜻한 백색광
     DirectionalLight.Intensity = 1.5f;
     LightBufferData.DirectionalLight = DirectionalLight;
-    
-    int pointLightIndex = 0;
-    for (auto Light : PointLights)
+
     {
-        if (pointLightIndex < MAX_LIGHTS)
-        {
-            FPointLightInfo PointLight = {};
-            PointLight.Position = Light->GetWorldLocation();
-            FLinearColor DiffuseColor = Light->GetDiffuseColor();
-            PointLight.DiffuseColor = FVector(DiffuseColor.R, DiffuseColor.G, DiffuseColor.B);
-            FLinearColor SpecularColor = Light->GetSpecularColor();
-            PointLight.SpecularColor = FVector(SpecularColor.R, SpecularColor.G, SpecularColor.B);
-            PointLight.Intensity = Light->GetIntensity();
-            PointLight.m_fAttRadius = Light->GetAttenuationRadius();
-            PointLight.m_fAttenuation = Light->GetAttenuation();
-
-            LightBufferData.PointLights[pointLightIndex] = PointLight;
-            ++pointLightIndex;
-        }
+        QUICK_SCOPE_CYCLE_COUNTER(LightCluster_Assign);
+        ClusterGrid.SetView(Viewport->GetViewMatrix(), Viewport->GetProjectionMatrix(), Viewport->nearPlane, Viewport->farPlane, Viewport->IsPerspective());
+        ClusterGrid.AssignLights(ClusterPointLights, ClusterSpotLights);
     }
 
-    int spotLightIndex = 0;
-    for (auto Light : SpotLights)
+    const FLightClusterShaderParams& ClusterParams = ClusterGrid.GetShaderParams();
+    LightBufferData.NumPointLights = static_cast<uint32>(PointLightInfos.Num());
+    LightBufferData.NumSpotLights = static_cast<uint32>(SpotLightInfos.Num());
+    LightBufferData.NumClustersX = ClusterParams.NumClustersX;
+    LightBufferData.NumClustersY = ClusterParams.NumClustersY;
+    LightBufferData.NumClustersZ = ClusterParams.NumClustersZ;
+    LightBufferData.ClusterDepthScale = ClusterParams.DepthScale;
+    LightBufferData.ClusterDepthBias = ClusterParams.DepthBias;
+    LightBufferData.bClusterLogDepth = ClusterParams.bLogDepth;
+
+    const TArray<FLightCluster>& Clusters = ClusterGrid.GetClusters();
+    const TArray<uint32>& LightIndices = ClusterGrid.GetLightIndices();
+    const bool bUploaded =
+        UpdateStructuredBuffer(PointLightBuffer, PointLightInfos.GetData(), sizeof(FPointLightInfo), LightBufferData.NumPointLights) &&
+        UpdateStructuredBuffer(SpotLightBuffer, SpotLightInfos.GetData(), sizeof(FSpotLightInfo), LightBufferData.NumSpotLights) &&
+        UpdateStructuredBuffer(ClusterBuffer, Clusters.GetData(), sizeof(FLightCluster), static_cast<uint32>(Clusters.Num())) &&
+        UpdateStructuredBuffer(LightIndexBuffer, LightIndices.GetData(), sizeof(uint32), static_cast<uint32>(LightIndices.Num()));
+    if (!bUploaded)
+    {
+        // 버퍼가 없으면 셰이더가 Light 목록을 읽을 수 없으므로 점광원과 스포트라이트를 끕니다.
+        LightBufferData.NumPointLights = 0;
+        LightBufferData.NumSpotLights = 0;
+    }
+
+    // Gouraud는 정점 셰이더에서, 나머지 Lighting Model은 픽셀 셰이더에서 Light 목록을 읽습니다.
+    ID3D11ShaderResourceView* LightSRVs[] = { PointLightBuffer.SRV, SpotLightBuffer.SRV, ClusterBuffer.SRV, LightIndexBuffer.SRV };
+    Graphics->DeviceContext->VSSetShaderResources(LightSRVStartSlot, ARRAYSIZE(LightSRVs), LightSRVs);
+    Graphics->DeviceContext->PSSetShaderResources(LightSRVStartSlot, ARRAYSIZE(LightSRVs), LightSRVs);
+
+    BufferManager->UpdateConstantBuffer(LightBufferData);
+}
+
+void FUpdateLightBufferPass::ClearRenderArr()
+{
+    PointLightInfos.Empty();
+    SpotLightInfos.Empty();
+    ClusterPointLights.Empty();
+    ClusterSpotLights.Empty();
+}
+
+bool FUpdateLightBufferPass::UpdateStructuredBuffer(FLightStructuredBuffer& Buffer, const void* Data, uint32 Stride, uint32 NumElements) const
+{
+    if (!Buffer.Buffer || NumElements > Buffer.Capacity)
     {
-        if (spotLightIndex < MAX_LIGHTS)
+        uint32 NewCapacity = FMath::Max(Buffer.Capacity * 2, 64u);
+        while (NewCapacity < NumElements)
+        {
+            NewCapacity *= 2;
+        }
+
+        D3D11_BUFFER_DESC Desc = {};
+        Desc.ByteWidth = Stride * NewCapacity;
+        Desc.Usage = D3D11_USAGE_DYNAMIC;
+        Desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+        Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        Desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+        Desc.StructureByteStride = Stride;
+
+        ID3D11Buffer* NewBuffer = nullptr;
+        if (FAILED(Graphics->Device->CreateBuffer(&Desc, nullptr, &NewBuffer)))
+        {
+            UE_LOG(LogLevel::Error, TEXT("Failed to create light structured buffer (%u elements)"), NewCapacity);
+            return false;
+        }
+
+        D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc = {};
+        SRVDesc.Format = DXGI_FORMAT_UNKNOWN;
+        SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+        SRVDesc.Buffer.ElementOffset = 0;
+        SRVDesc.Buffer.NumElements = NewCapacity;
+
+        ID3D11ShaderResourceView* NewSRV = nullptr;
+        if (FAILED(Graphics->Device->CreateShaderResourceView(NewBuffer, &SRVDesc, &NewSRV)))
         {
-            FSpotLightInfo SpotLight = {};
-            SpotLight.Position = Light->GetWorldLocation();
-            SpotLight.Direction = Light->GetForwardVector();
-            FLinearColor DiffuseColor = Light->GetDiffuseColor();
-            SpotLight.DiffuseColor = FVector(DiffuseColor.R, DiffuseColor.G, DiffuseColor.B);
-            FLinearColor SpecularColor = Light->GetSpecularColor();
-            SpotLight.SpecularColor = FVector(SpecularColor.R, SpecularColor.G, SpecularColor.B);
-            SpotLight.Intensity = Light->GetIntensity();
-            SpotLight.m_fAttRadius = Light->GetAttenuationRadius();
-            SpotLight.m_fFalloff = Light->GetFalloff();
-            SpotLight.m_fAttenuation = Light->GetAttenuation();
-            SpotLight.InnerConeAngle = Light->GetInnerConeAngle();
-            SpotLight.OuterConeAngle = Light->GetOuterConeAngle();
-            
-            //// 월드 변환 행렬 계산 (스케일 1로 가정)
-            //FMatrix Model = JungleMath::CreateModelMatrix(Light->GetWorldLocation(), Light->GetWorldRotation(), { 1, 1, 1 });
-            //FEngineLoop::PrimitiveDrawBatch.AddConeToBatch(Light->GetWorldLocation(), 100, Light->GetRange(), 140, {1,1,1,1}, Model);
-            //FEngineLoop::PrimitiveDrawBatch.AddOBBToBatch(Light->GetBoundingBox(), Light->GetWorldLocation(), Model);
-            LightBufferData.SpotLights[spotLightIndex] = SpotLight;
-
-            spotLightIndex++;
+            UE_LOG(LogLevel::Error, TEXT("Failed to create light structured buffer SRV"));
+            NewBuffer->Release();
+            return false;
         }
+
+        ReleaseStructuredBuffer(Buffer);
+        Buffer.Buffer = NewBuffer;
+        Buffer.SRV = NewSRV;
+        Buffer.Capacity = NewCapacity;
+    }
+
+    if (NumElements == 0)
+    {
+        return true;
     }
-    BufferManager->UpdateConstantBuffer(TEXT("FLightBuffer"), LightBufferData);
+
+    D3D11_MAPPED_SUBRESOURCE Mapped;
+    if (FAILED(Graphics->DeviceContext->Map(Buffer.Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+    {
+        return false;
+    }
+    memcpy(Mapped.pData, Data, static_cast<size_t>(Stride) * NumElements);
+    Graphics->DeviceContext->Unmap(Buffer.Buffer, 0);
+    return true;
 }
 
-void FUpdateLightBufferPass::ClearRenderArr()
+void FUpdateLightBufferPass::ReleaseStructuredBuffer(FLightStructuredBuffer& Buffer)
 {
-    PointLights.Empty();
-    SpotLights.Empty();
+    FDXDBufferManager::SafeRelease(Buffer.SRV);
+    FDXDBufferManager::SafeRelease(Buffer.Buffer);
+    Buffer.Capacity = 0;
 }
 
 void FUpdateLightBufferPass::UpdateLightBuffer(const FLighting& Light) const
@@ -4,13 +4,15 @@
 #include "EngineBaseTypes.h"
 #include "Container/Set.h"
 #include "Define.h"
+#include "LightClustering.h"
+
+struct ID3D11Buffer;
+struct ID3D11ShaderResourceView;
 
 class FDXDShaderManager;
 class UWorld;
 class FEditorViewportClient;
 
-class UPointLightComponent;
-class USpotLightComponent;
 class UAmbientLightComponent;
 
 class FUpdateLightBufferPass : public IRenderPass
@@ -27,10 +29,37 @@ public:
     [[maybe_unused]]
     void UpdateLightBuffer(const FLighting& Light) const;
 
+private:
+    /** Light 목록을 올리는 Structured Buffer의 시작 Slot. UberLit.hlsl의 t10 ~ t13과 같아야 합니다. */
+    static constexpr uint32 LightSRVStartSlot = 10;
+
+    /** 크기가 모자라면 두 배씩 키워 다시 만드는 Dynamic Structured Buffer와 SRV */
+    struct FLightStructuredBuffer
+    {
+        ID3D11Buffer* Buffer = nullptr;
+        ID3D11ShaderResourceView* SRV = nullptr;
+        uint32 Capacity = 0;
+    };
+
+    /** 원소 NumElements개를 Buffer에 올립니다. 비어 있어도 SRV가 유효하도록 최소 1개 크기로 만듭니다. */
+    bool UpdateStructuredBuffer(FLightStructuredBuffer& Buffer, const void* Data, uint32 Stride, uint32 NumElements) const;
+    static void ReleaseStructuredBuffer(FLightStructuredBuffer& Buffer);
+
 private:
     UAmbientLightComponent* AmbientLight;
-    TArray<USpotLightComponent*> SpotLights;
-    TArray<UPointLightComponent*> PointLights;
+
+    /** PrepareRender에서 모은 Light. GPU에 올릴 값과 클러스터 배정에 쓸 경계가 같은 순서로 들어 있습니다. */
+    TArray<FPointLightInfo> PointLightInfos;
+    TArray<FSpotLightInfo> SpotLightInfos;
+    TArray<FClusterPointLight> ClusterPointLights;
+    TArray<FClusterSpotLight> ClusterSpotLights;
+
+    FLightClusterGrid ClusterGrid;
+
+    FLightStructuredBuffer PointLightBuffer;
+    FLightStructuredBuffer SpotLightBuffer;
+    FLightStructuredBuffer ClusterBuffer;
+    FLightStructuredBuffer LightIndexBuffer;
 
     FDXDBufferManager* BufferManager;
     FGraphicsDevice* Graphics;
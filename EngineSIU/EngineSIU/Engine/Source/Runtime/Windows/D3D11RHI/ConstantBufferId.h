@@ -0,0 +1,17 @@
+#pragma once
+#include <atomic>
+#include "HAL/PlatformType.h"
+
+/**
+ * 상수 버퍼 구조체 타입마다 정해지는 번호. FDXDBufferManager는 이 번호를 배열 인덱스로 사용하므로 문자열 Hash 없이 버퍼를 찾습니다.
+ * 번호는 프로그램 시작 시 정적 초기화에서 한 번 정해지고, 조회는 전역 변수 하나를 읽는 것과 같습니다. (함수 안 static 변수처럼 매번 초기화 여부를 검사하지 않습니다.)
+ * 번호가 정해지기 전일 수 있으므로 다른 전역 변수의 초기화 중에는 사용하지 않습니다.
+ */
+class FConstantBufferId
+{
+    inline static std::atomic<uint32> NextId = 0;
+
+public:
+    template <typename T>
+    inline static const uint32 Value = NextId.fetch_add(1, std::memory_order_relaxed);
+};
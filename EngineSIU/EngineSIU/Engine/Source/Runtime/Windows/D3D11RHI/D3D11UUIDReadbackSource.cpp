@@ -0,0 +1,127 @@
+#include "D3D11UUIDReadbackSource.h"
+#include "GraphicDevice.h"
+#include <cstring>
+#include "Math/MathUtility.h"
+
+
+void FD3D11UUIDReadbackSource::Initialize(FGraphicsDevice* InGraphicDevice)
+{
+    GraphicDevice = InGraphicDevice;
+}
+
+void FD3D11UUIDReadbackSource::Release()
+{
+    for (FStagingSlot& StagingSlot : Slots)
+    {
+        if (StagingSlot.Texture)
+        {
+            StagingSlot.Texture->Release();
+        }
+        StagingSlot = {};
+    }
+    GraphicDevice = nullptr;
+}
+
+void FD3D11UUIDReadbackSource::GetSurfaceSize(uint32& OutWidth, uint32& OutHeight) const
+{
+    // 창 크기가 바뀌면 UUID 버퍼도 다시 만들어지므로 매번 FGraphicsDevice에서 가져옵니다.
+    const bool bHasSurface = GraphicDevice && GraphicDevice->UUIDFrameBuffer;
+    OutWidth = bHasSurface ? GraphicDevice->screenWidth : 0;
+    OutHeight = bHasSurface ? GraphicDevice->screenHeight : 0;
+}
+
+bool FD3D11UUIDReadbackSource::EnqueueCopy(uint32 Slot, const FUUIDReadbackRect& Rect)
+{
+    FStagingSlot& StagingSlot = Slots[Slot];
+    if (!ReserveStaging(StagingSlot, Rect.GetWidth(), Rect.GetHeight()))
+    {
+        return false;
+    }
+
+    D3D11_BOX SrcBox;
+    SrcBox.left = static_cast<UINT>(Rect.Left);
+    SrcBox.right = static_cast<UINT>(Rect.Right);
+    SrcBox.top = static_cast<UINT>(Rect.Top);
+    SrcBox.bottom = static_cast<UINT>(Rect.Bottom);
+    SrcBox.front = 0;
+    SrcBox.back = 1;
+
+    GraphicDevice->DeviceContext->CopySubresourceRegion(StagingSlot.Texture, 0, 0, 0, 0, GraphicDevice->UUIDFrameBuffer, 0, &SrcBox);
+    return true;
+}
+
+bool FD3D11UUIDReadbackSource::TryRead(uint32 Slot, const FUUIDReadbackRect& Rect, bool bWait, TArray<uint32>& OutUUIDs)
+{
+    FStagingSlot& StagingSlot = Slots[Slot];
+    if (!StagingSlot.Texture)
+    {
+        return false;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE Mapped = {};
+    const HRESULT hr = GraphicDevice->DeviceContext->Map(StagingSlot.Texture, 0, D3D11_MAP_READ, bWait ? 0 : D3D11_MAP_FLAG_DO_NOT_WAIT, &Mapped);
+    if (FAILED(hr))
+    {
+        // DXGI_ERROR_WAS_STILL_DRAWING: GPU가 아직 복사를 끝내지 않았습니다.
+        return false;
+    }
+
+    const uint32 Width = Rect.GetWidth();
+    const uint32 Height = Rect.GetHeight();
+    OutUUIDs.SetNum(Width * Height);
+
+    // R8G8B8A8이므로 한 픽셀을 little-endian uint32로 읽으면 DecodeUUIDColor와 같은 값이 됩니다.
+    uint32* Dest = OutUUIDs.GetData();
+    for (uint32 Row = 0; Row < Height; ++Row)
+    {
+        const uint8* RowData = static_cast<const uint8*>(Mapped.pData) + Row * Mapped.RowPitch;
+        std::memcpy(Dest + Row * Width, RowData, Width * sizeof(uint32));
+    }
+
+    GraphicDevice->DeviceContext->Unmap(StagingSlot.Texture, 0);
+    return true;
+}
+
+bool FD3D11UUIDReadbackSource::ReserveStaging(FStagingSlot& StagingSlot, uint32 Width, uint32 Height) const
+{
+    if (!GraphicDevice || !GraphicDevice->UUIDFrameBuffer)
+    {
+        return false;
+    }
+
+    if (StagingSlot.Texture && StagingSlot.Width >= Width && StagingSlot.Height >= Height)
+    {
+        return true;
+    }
+
+    if (StagingSlot.Texture)
+    {
+        StagingSlot.Texture->Release();
+        StagingSlot.Texture = nullptr;
+    }
+
+    // 클릭 한 번마다 다시 만들지 않도록 한 번 키운 크기는 줄이지 않습니다.
+    const uint32 NewWidth = FMath::Max(Width, StagingSlot.Width);
+    const uint32 NewHeight = FMath::Max(Height, StagingSlot.Height);
+
+    D3D11_TEXTURE2D_DESC StagingDesc = {};
+    StagingDesc.Width = NewWidth;
+    StagingDesc.Height = NewHeight;
+    StagingDesc.MipLevels = 1;
+    StagingDesc.ArraySize = 1;
+    StagingDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM; // UUID 버퍼 포맷과 동일
+    StagingDesc.SampleDesc.Count = 1;
+    StagingDesc.Usage = D3D11_USAGE_STAGING;
+    StagingDesc.BindFlags = 0;
+    StagingDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+    if (FAILED(GraphicDevice->Device->CreateTexture2D(&StagingDesc, nullptr, &StagingSlot.Texture)))
+    {
+        StagingSlot = {};
+        return false;
+    }
+
+    StagingSlot.Width = NewWidth;
+    StagingSlot.Height = NewHeight;
+    return true;
+}
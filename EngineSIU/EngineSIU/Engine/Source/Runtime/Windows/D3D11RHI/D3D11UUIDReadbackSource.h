@@ -0,0 +1,41 @@
+#pragma once
+#define _TCHAR_DEFINED
+#include <d3d11.h>
+
+#include "UUIDReadbackQueue.h"
+
+class FGraphicsDevice;
+
+/**
+ * FGraphicsDevice의 UUID 버퍼를 Staging 텍스처 링으로 읽어 옵니다.
+ * Staging 텍스처는 슬롯마다 하나씩 만들어 두고 재사용하며, 지금까지 요청된 가장 큰 영역에 맞춰 키웁니다.
+ * 읽을 때는 D3D11_MAP_FLAG_DO_NOT_WAIT로 Map해서 GPU가 복사를 끝내지 않았으면 기다리지 않습니다.
+ */
+class FD3D11UUIDReadbackSource : public IUUIDReadbackSource
+{
+public:
+    static constexpr uint32 NumSlots = 3;
+
+    void Initialize(FGraphicsDevice* InGraphicDevice);
+    void Release();
+
+    virtual uint32 GetNumSlots() const override { return NumSlots; }
+    virtual void GetSurfaceSize(uint32& OutWidth, uint32& OutHeight) const override;
+    virtual bool EnqueueCopy(uint32 Slot, const FUUIDReadbackRect& Rect) override;
+    virtual bool TryRead(uint32 Slot, const FUUIDReadbackRect& Rect, bool bWait, TArray<uint32>& OutUUIDs) override;
+
+private:
+    struct FStagingSlot
+    {
+        ID3D11Texture2D* Texture = nullptr;
+        uint32 Width = 0;
+        uint32 Height = 0;
+    };
+
+    /** Slot의 Staging 텍스처가 Width x Height보다 작으면 다시 만듭니다. */
+    bool ReserveStaging(FStagingSlot& StagingSlot, uint32 Width, uint32 Height) const;
+
+private:
+    FGraphicsDevice* GraphicDevice = nullptr;
+    FStagingSlot Slots[NumSlots];
+};
@@ -7,6 +7,7 @@
 #include "Container/Array.h"
 #include "Container/Map.h"
 #include "Engine/Texture.h"
+#include "ConstantBufferId.h"
 #include "GraphicDevice.h"
 #include "UserInterface/Console.h"
 
@@ -16,6 +17,24 @@ enum class EShaderStage
     Vertex,
     Pixel
 };
+/** 한 Stage의 연속된 Slot에 묶어서 바인딩할 상수 버퍼 목록. Pass를 초기화할 때 한 번 만듭니다. */
+struct FConstantBufferBindList
+{
+    template <typename... TBuffers>
+    static FConstantBufferBindList Make(UINT InStartSlot, EShaderStage InStage)
+    {
+        FConstantBufferBindList BindList;
+        BindList.StartSlot = InStartSlot;
+        BindList.Stage = InStage;
+        (BindList.BufferIds.Add(FConstantBufferId::Value<TBuffers>), ...);
+        return BindList;
+    }
+
+    UINT StartSlot = 0;
+    EShaderStage Stage = EShaderStage::Vertex;
+    TArray<uint32> BufferIds;
+};
+
 struct QuadVertex
 {
     float Position[3];
@@ -35,10 +54,15 @@ public:
     HRESULT CreateVertexBuffer(const FString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo);
     template<typename T>
     HRESULT CreateVertexBuffer(const FWString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo);
+    /** 배열 대신 메모리(예: 매핑한 파일)에서 바로 버퍼를 만듭니다. */
+    template<typename T>
+    HRESULT CreateVertexBuffer(const FString& KeyName, const T* Vertices, uint32 NumVertices, FVertexInfo& OutVertexInfo);
 
     template<typename T>
     HRESULT CreateIndexBuffer(const FString& KeyName, const TArray<T>& indices, FIndexInfo& OutIndexInfo);
     template<typename T>
+    HRESULT CreateIndexBuffer(const FString& KeyName, const T* Indices, uint32 NumIndices, FIndexInfo& OutIndexInfo);
+    template<typename T>
     HRESULT CreateIndexBuffer(const FWString& KeyName, const TArray<T>& indices, FIndexInfo& OutIndexInfo);
 
     template<typename T>
@@ -46,31 +70,30 @@ public:
 
     // 템플릿 헬퍼 함수: 내부에서 버퍼 생성 로직 통합
     template<typename T>
-    HRESULT CreateVertexBufferInternal(const FString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo,
+    HRESULT CreateVertexBufferInternal(const FString& KeyName, const T* Vertices, uint32 NumVertices, FVertexInfo& OutVertexInfo,
         D3D11_USAGE usage, UINT cpuAccessFlags);
 
     template<typename T>
     HRESULT CreateVertexBufferInternal(const FWString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo,
         D3D11_USAGE usage, UINT cpuAccessFlags);
 
-    HRESULT CreateUnicodeTextBuffer(const FWString& Text, FBufferInfo& OutBufferInfo, float BitmapWidth, float BitmapHeight, float ColCount, float RowCount);
-
-    void SetStartUV(wchar_t hangul, FVector2D& UVOffset);
-    
     void ReleaseBuffers();
     void ReleaseConstantBuffer();
 
+    /** 구조체 T 크기의 Dynamic 상수 버퍼를 만들고 T의 번호로 등록합니다. */
     template<typename T>
-    HRESULT CreateBufferGeneric(const FString& KeyName, T* data, UINT byteWidth, UINT bindFlags, D3D11_USAGE usage, UINT cpuAccessFlags);
+    HRESULT CreateConstantBuffer();
 
     template<typename T>
-    void UpdateConstantBuffer(const FString& key, const T& data) const;
+    void UpdateConstantBuffer(const T& data) const;
 
     template<typename T>
     void UpdateDynamicVertexBuffer(const FString& KeyName, const TArray<T>& vertices) const;
 
-    void BindConstantBuffers(const TArray<FString>& Keys, UINT StartSlot, EShaderStage Stage) const;
-    void BindConstantBuffer(const FString& Key, UINT StartSlot, EShaderStage Stage) const;
+    void BindConstantBuffers(const FConstantBufferBindList& BindList) const;
+
+    template<typename T>
+    void BindConstantBuffer(UINT StartSlot, EShaderStage Stage) const;
 
     template<typename T>
     static void SafeRelease(T*& comObject);
@@ -80,7 +103,8 @@ public:
     FIndexInfo GetIndexBuffer(const FString& InName) const;
     FVertexInfo GetTextVertexBuffer(const FWString& InName) const;
     FIndexInfo GetTextIndexBuffer(const FWString& InName) const;
-    ID3D11Buffer* GetConstantBuffer(const FString& InName) const;
+    template<typename T>
+    ID3D11Buffer* GetConstantBuffer() const;
 
     void GetQuadBuffer(FVertexInfo& OutVertexInfo, FIndexInfo& OutIndexInfo);
     void GetTextBuffer(const FWString& Text, FVertexInfo& OutVertexInfo, FIndexInfo& OutIndexInfo);
@@ -94,9 +118,9 @@ private:
 
     TMap<FString, FVertexInfo> VertexBufferPool;
     TMap<FString, FIndexInfo> IndexBufferPool;
-    TMap<FString, ID3D11Buffer*> ConstantBufferPool;
+    /** FConstantBufferId로 접근하는 상수 버퍼 */
+    TArray<ID3D11Buffer*> ConstantBuffers;
 
-    TMap<FWString, FBufferInfo> TextAtlasBufferPool;
     TMap<FWString, FVertexInfo> TextAtlasVertexBufferPool;
     TMap<FWString, FIndexInfo> TextAtlasIndexBufferPool;
 };
@@ -104,7 +128,7 @@ private:
 // 템플릿 함수 구현부
 
 template<typename T>
-HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo,
+HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FString& KeyName, const T* Vertices, uint32 NumVertices, FVertexInfo& OutVertexInfo,
     D3D11_USAGE usage, UINT cpuAccessFlags)
 {
     if (!KeyName.IsEmpty() && VertexBufferPool.Contains(KeyName))
@@ -115,19 +139,19 @@ HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FString& KeyName, co
     uint32_t Stride = sizeof(T);
     D3D11_BUFFER_DESC bufferDesc = {};
     bufferDesc.Usage = usage;
-    bufferDesc.ByteWidth = Stride * vertices.Num();
+    bufferDesc.ByteWidth = Stride * NumVertices;
     bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
     bufferDesc.CPUAccessFlags = cpuAccessFlags;
 
     D3D11_SUBRESOURCE_DATA initData = {};
-    initData.pSysMem = vertices.GetData();
+    initData.pSysMem = Vertices;
 
     ID3D11Buffer* NewBuffer = nullptr;
     HRESULT hr = DXDevice->CreateBuffer(&bufferDesc, &initData, &NewBuffer);
     if (FAILED(hr))
         return hr;
 
-    OutVertexInfo.NumVertices = static_cast<uint32>(vertices.Num());
+    OutVertexInfo.NumVertices = NumVertices;
     OutVertexInfo.VertexBuffer = NewBuffer;
     OutVertexInfo.Stride = Stride;
     VertexBufferPool.Add(KeyName, OutVertexInfo);
@@ -136,6 +160,12 @@ HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FString& KeyName, co
 }
 template<typename T>
 HRESULT FDXDBufferManager::CreateIndexBuffer(const FString& KeyName, const TArray<T>& indices, FIndexInfo& OutIndexInfo)
+{
+    return CreateIndexBuffer(KeyName, indices.GetData(), static_cast<uint32>(indices.Num()), OutIndexInfo);
+}
+
+template<typename T>
+HRESULT FDXDBufferManager::CreateIndexBuffer(const FString& KeyName, const T* Indices, uint32 NumIndices, FIndexInfo& OutIndexInfo)
 {
     if (!KeyName.IsEmpty() && IndexBufferPool.Contains(KeyName))
     {
@@ -145,20 +175,20 @@ HRESULT FDXDBufferManager::CreateIndexBuffer(const FString& KeyName, const TArra
 
     D3D11_BUFFER_DESC indexBufferDesc = {};
     indexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-    indexBufferDesc.ByteWidth = indices.Num() * sizeof(uint32);
+    indexBufferDesc.ByteWidth = NumIndices * sizeof(uint32);
     indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
 
     D3D11_SUBRESOURCE_DATA indexInitData = {};
-    indexInitData.pSysMem = indices.GetData();
+    indexInitData.pSysMem = Indices;
 
     ID3D11Buffer* NewBuffer = nullptr;
     HRESULT hr = DXDevice->CreateBuffer(&indexBufferDesc, &indexInitData, &NewBuffer);
     if (FAILED(hr))
         return hr;
 
-    OutIndexInfo.NumIndices = static_cast<uint32>(indices.Num());
+    OutIndexInfo.NumIndices = NumIndices;
     OutIndexInfo.IndexBuffer = NewBuffer;
-    IndexBufferPool.Add(KeyName, FIndexInfo(static_cast<uint32>(indices.Num()), NewBuffer));
+    IndexBufferPool.Add(KeyName, FIndexInfo(NumIndices, NewBuffer));
 
 
     return S_OK;
@@ -167,7 +197,13 @@ HRESULT FDXDBufferManager::CreateIndexBuffer(const FString& KeyName, const TArra
 template<typename T>
 HRESULT FDXDBufferManager::CreateVertexBuffer(const FString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo)
 {
-    return CreateVertexBufferInternal(KeyName, vertices, OutVertexInfo, D3D11_USAGE_DEFAULT, 0);
+    return CreateVertexBufferInternal(KeyName, vertices.GetData(), static_cast<uint32>(vertices.Num()), OutVertexInfo, D3D11_USAGE_DEFAULT, 0);
+}
+
+template<typename T>
+HRESULT FDXDBufferManager::CreateVertexBuffer(const FString& KeyName, const T* Vertices, uint32 NumVertices, FVertexInfo& OutVertexInfo)
+{
+    return CreateVertexBufferInternal(KeyName, Vertices, NumVertices, OutVertexInfo, D3D11_USAGE_DEFAULT, 0);
 }
 
 
@@ -244,42 +280,50 @@ HRESULT FDXDBufferManager::CreateVertexBuffer(const FWString& KeyName, const TAr
 template<typename T>
 HRESULT FDXDBufferManager::CreateDynamicVertexBuffer(const FString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo)
 {
-    return CreateVertexBufferInternal(KeyName, vertices, OutVertexInfo, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
+    return CreateVertexBufferInternal(KeyName, vertices.GetData(), static_cast<uint32>(vertices.Num()), OutVertexInfo, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
 }
 
 template<typename T>
-HRESULT FDXDBufferManager::CreateBufferGeneric(const FString& KeyName, T* data, UINT byteWidth, UINT bindFlags, D3D11_USAGE usage, UINT cpuAccessFlags)
+HRESULT FDXDBufferManager::CreateConstantBuffer()
 {
-    byteWidth = Align16(byteWidth);
-
     D3D11_BUFFER_DESC desc = {};
-    desc.ByteWidth = byteWidth;
-    desc.Usage = usage;
-    desc.BindFlags = bindFlags;
-    desc.CPUAccessFlags = cpuAccessFlags;
-
-    D3D11_SUBRESOURCE_DATA initData = {};
-    initData.pSysMem = data;
+    desc.ByteWidth = Align16(sizeof(T));
+    desc.Usage = D3D11_USAGE_DYNAMIC;
+    desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
 
     ID3D11Buffer* buffer = nullptr;
-    HRESULT hr = DXDevice->CreateBuffer(&desc, data ? &initData : nullptr, &buffer);
+    HRESULT hr = DXDevice->CreateBuffer(&desc, nullptr, &buffer);
     if (FAILED(hr))
     {
         UE_LOG(LogLevel::Error, TEXT("Error Create Constant Buffer!"));
         return hr;
     }
 
-    ConstantBufferPool.Add(KeyName, buffer);
+    const uint32 Id = FConstantBufferId::Value<T>;
+    if (static_cast<int32>(Id) >= ConstantBuffers.Num())
+    {
+        ConstantBuffers.SetNum(Id + 1);
+    }
+    SafeRelease(ConstantBuffers[Id]);
+    ConstantBuffers[Id] = buffer;
     return S_OK;
 }
 
 template<typename T>
-void FDXDBufferManager::UpdateConstantBuffer(const FString& key, const T& data) const
+ID3D11Buffer* FDXDBufferManager::GetConstantBuffer() const
+{
+    const uint32 Id = FConstantBufferId::Value<T>;
+    return static_cast<int32>(Id) < ConstantBuffers.Num() ? ConstantBuffers[Id] : nullptr;
+}
+
+template<typename T>
+void FDXDBufferManager::UpdateConstantBuffer(const T& data) const
 {
-    ID3D11Buffer* buffer = GetConstantBuffer(key);
+    ID3D11Buffer* buffer = GetConstantBuffer<T>();
     if (!buffer)
     {
-        UE_LOG(LogLevel::Error, TEXT("UpdateConstantBuffer 호출: 키 %s에 해당하는 buffer가 없습니다."), *key);
+        UE_LOG(LogLevel::Error, TEXT("UpdateConstantBuffer 호출: 해당하는 buffer가 없습니다."));
         return;
     }
 
@@ -295,6 +339,16 @@ void FDXDBufferManager::UpdateConstantBuffer(const FString& key, const T& data)
     DXDeviceContext->Unmap(buffer, 0);
 }
 
+template<typename T>
+void FDXDBufferManager::BindConstantBuffer(UINT StartSlot, EShaderStage Stage) const
+{
+    ID3D11Buffer* Buffer = GetConstantBuffer<T>();
+    if (Stage == EShaderStage::Vertex)
+        DXDeviceContext->VSSetConstantBuffers(StartSlot, 1, &Buffer);
+    else if (Stage == EShaderStage::Pixel)
+        DXDeviceContext->PSSetConstantBuffers(StartSlot, 1, &Buffer);
+}
+
 template<typename T>
 void FDXDBufferManager::UpdateDynamicVertexBuffer(const FString& KeyName, const TArray<T>& vertices) const
 {
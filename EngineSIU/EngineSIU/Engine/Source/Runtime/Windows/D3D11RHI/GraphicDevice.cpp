@@ -1,9 +1,11 @@
 #include "GraphicDevice.h"
 #include <cwchar>
 #include <Components/HeightFogComponent.h>
-#include <UObject/UObjectIterator.h>
+#include <UObject/Casts.h>
+#include <World/World.h>
 #include <Engine/Engine.h>
 #include "PropertyEditor/ShowFlags.h"
+#include "Math/MathUtility.h"
 
 void FGraphicsDevice::Initialize(HWND hWindow)
 {
@@ -14,6 +16,9 @@ void FGraphicsDevice::Initialize(HWND hWindow)
     CreateRasterizerState();
     CreateAlphaBlendState();
     CurrentRasterizer = RasterizerStateSOLID;
+
+    UUIDReadbackSource.Initialize(this);
+    UUIDReadbackQueue.SetSource(&UUIDReadbackSource);
 }
 
 void FGraphicsDevice::CreateDeviceAndSwapChain(HWND hWindow)
@@ -323,6 +328,9 @@ void FGraphicsDevice::ReleaseDepthStencilResources()
 
 void FGraphicsDevice::Release()
 {
+    UUIDReadbackQueue.SetSource(nullptr);
+    UUIDReadbackSource.Release();
+
     ReleaseRasterizerState();
     DeviceContext->OMSetRenderTargets(0, nullptr, nullptr);
 
@@ -340,15 +348,8 @@ void FGraphicsDevice::Prepare(const std::shared_ptr<FEditorViewportClient>& Acti
 {
     Prepare();
     //TODO: 다른 곳으로 빼자
-    TArray<UHeightFogComponent*> Fogs;
-    for (const auto iter : TObjectRange<UHeightFogComponent>())
-    {
-        if (iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            Fogs.Add(iter);
-        }
-    }
-    if ((ActiveViewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_Fog)) && Fogs.Num() > 0)
+    const bool bHasFog = GEngine->ActiveWorld && GEngine->ActiveWorld->GetPrimitiveSceneIndex().Num(EScenePrimitiveType::HeightFog) > 0;
+    if ((ActiveViewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_Fog)) && bHasFog)
         PrepareTexture();
 }
 
@@ -356,7 +357,7 @@ void FGraphicsDevice::Prepare() const
 {
     DeviceContext->ClearRenderTargetView(FrameBufferRTV, ClearColor);
     DeviceContext->ClearRenderTargetView(SceneColorRTV, ClearColor);                                         // 렌더 타겟 뷰에 저장된 이전 프레임 데이터를 삭제
-    DeviceContext->ClearRenderTargetView(UUIDFrameBufferRTV, ClearColor);                                     // 렌더 타겟 뷰에 저장된 이전 프레임 데이터를 삭제
+    DeviceContext->ClearRenderTargetView(UUIDFrameBufferRTV, UUIDClearColor);                                 // 렌더 타겟 뷰에 저장된 이전 프레임 데이터를 삭제
     
     DeviceContext->ClearDepthStencilView(DepthStencilView, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0); // 깊이 버퍼 초기화 추가
 
@@ -445,7 +446,7 @@ void FGraphicsDevice::CreateAlphaBlendState()
 {
     D3D11_BLEND_DESC blendDesc = {};
     blendDesc.AlphaToCoverageEnable = FALSE;
-    blendDesc.IndependentBlendEnable = FALSE;
+    blendDesc.IndependentBlendEnable = TRUE;
     blendDesc.RenderTarget[0].BlendEnable = TRUE;
     blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
     blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
@@ -455,6 +456,10 @@ void FGraphicsDevice::CreateAlphaBlendState()
     blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
     blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
 
+    // UUID 버퍼는 알파 채널에 UUID의 상위 바이트가 들어가므로 블렌딩 없이 그대로 씁니다.
+    blendDesc.RenderTarget[1].BlendEnable = FALSE;
+    blendDesc.RenderTarget[1].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+
     HRESULT hr = Device->CreateBlendState(&blendDesc, &AlphaBlendState);
     if (FAILED(hr))
     {
@@ -509,87 +514,20 @@ void FGraphicsDevice::CreateRTV(ID3D11Texture2D*& OutTexture, ID3D11RenderTarget
     Device->CreateRenderTargetView(OutTexture, &FogRTVDesc, &OutRTV);
 }
 
-uint32 FGraphicsDevice::GetPixelUUID(POINT pt) const
+uint32 FGraphicsDevice::RequestPixelUUID(POINT pt, FOnPixelUUIDResolved OnResolved)
 {
-    // pt.x 값 제한하기
-    if (pt.x < 0)
-    {
-        pt.x = 0;
-    }
-    else if (pt.x > screenWidth)
-    {
-        pt.x = screenWidth;
-    }
-
-    // pt.y 값 제한하기
-    if (pt.y < 0)
-    {
-        pt.y = 0;
-    }
-    else if (pt.y > screenHeight)
-    {
-        pt.y = screenHeight;
-    }
-
-    // 1. Staging 텍스처 생성 (1x1 픽셀)
-    D3D11_TEXTURE2D_DESC stagingDesc = {};
-    stagingDesc.Width = 1; // 픽셀 1개만 복사
-    stagingDesc.Height = 1;
-    stagingDesc.MipLevels = 1;
-    stagingDesc.ArraySize = 1;
-    stagingDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM; // 원본 텍스처 포맷과 동일
-    stagingDesc.SampleDesc.Count = 1;
-    stagingDesc.Usage = D3D11_USAGE_STAGING;
-    stagingDesc.BindFlags = 0;
-    stagingDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
-
-    ID3D11Texture2D* stagingTexture = nullptr;
-    Device->CreateTexture2D(&stagingDesc, nullptr, &stagingTexture);
-
-    // 2. 복사할 영역 정의 (D3D11_BOX)
-    D3D11_BOX srcBox;
-    srcBox.left = static_cast<UINT>(pt.x);
-    srcBox.right = srcBox.left + 1; // 1픽셀 너비
-    srcBox.top = static_cast<UINT>(pt.y);
-    srcBox.bottom = srcBox.top + 1; // 1픽셀 높이
-    srcBox.front = 0;
-    srcBox.back = 1;
-    FVector4 UUIDColor{1, 1, 1, 1};
-
-    if (stagingTexture == nullptr)
-        return DecodeUUIDColor(UUIDColor);
-
-    // 3. 특정 좌표만 복사
-    DeviceContext->CopySubresourceRegion(
-        stagingTexture,  // 대상 텍스처
-        0,               // 대상 서브리소스
-        0, 0, 0,         // 대상 좌표 (x, y, z)
-        UUIDFrameBuffer, // 원본 텍스처
-        0,               // 원본 서브리소스
-        &srcBox          // 복사 영역
-    );
-
-    // 4. 데이터 매핑
-    D3D11_MAPPED_SUBRESOURCE mapped = {};
-    DeviceContext->Map(stagingTexture, 0, D3D11_MAP_READ, 0, &mapped);
-
-    // 5. 픽셀 데이터 추출 (1x1 텍스처이므로 offset = 0)
-    const BYTE* pixelData = static_cast<const BYTE*>(mapped.pData);
-
-    if (pixelData)
-    {
-        UUIDColor.X = static_cast<float>(pixelData[0]); // R
-        UUIDColor.Y = static_cast<float>(pixelData[1]); // G
-        UUIDColor.Z = static_cast<float>(pixelData[2]); // B
-        UUIDColor.W = static_cast<float>(pixelData[3]); // A
-    }
-
-    // 6. 매핑 해제 및 정리
-    DeviceContext->Unmap(stagingTexture, 0);
-    if (stagingTexture) stagingTexture->Release();
-    stagingTexture = nullptr;
+    return UUIDReadbackQueue.RequestPixel(pt.x, pt.y, std::move(OnResolved));
+}
 
-    return DecodeUUIDColor(UUIDColor);
+uint32 FGraphicsDevice::RequestRectUUIDs(const RECT& Rect, FOnRectUUIDsResolved OnResolved)
+{
+    // 드래그 방향과 관계없이 왼쪽 위에서 오른쪽 아래로 정규화합니다.
+    FUUIDReadbackRect ReadbackRect;
+    ReadbackRect.Left = FMath::Min(Rect.left, Rect.right);
+    ReadbackRect.Top = FMath::Min(Rect.top, Rect.bottom);
+    ReadbackRect.Right = FMath::Max(Rect.left, Rect.right) + 1;
+    ReadbackRect.Bottom = FMath::Max(Rect.top, Rect.bottom) + 1;
+    return UUIDReadbackQueue.RequestRect(ReadbackRect, std::move(OnResolved));
 }
 
 uint32 FGraphicsDevice::DecodeUUIDColor(FVector4 UUIDColor) const
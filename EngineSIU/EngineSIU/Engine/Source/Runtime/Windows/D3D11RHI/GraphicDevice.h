@@ -10,6 +10,8 @@
 
 #include "Core/HAL/PlatformType.h"
 #include "Core/Math/Vector4.h"
+#include "D3D11UUIDReadbackSource.h"
+#include "UUIDReadbackQueue.h"
 
 class FEditorViewportClient;
 
@@ -37,6 +39,7 @@ public:
     ID3D11DepthStencilView* DepthStencilView = nullptr;  // 깊이/스텐실 뷰
     ID3D11DepthStencilState* DepthStencilState = nullptr;
     FLOAT ClearColor[4] = { 0.025f, 0.025f, 0.025f, 1.0f }; // 화면을 초기화(clear) 할 때 사용할 색상(RGBA)
+    FLOAT UUIDClearColor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };      // 아무것도 그려지지 않은 픽셀은 FUUIDReadbackQueue::InvalidUUID로 읽힙니다.
 
     ID3D11DepthStencilState* DepthStateDisable = nullptr;
 
@@ -64,9 +67,25 @@ public:
 
     void CreateRTV(ID3D11Texture2D*& OutTexture, ID3D11RenderTargetView*& OutRTV);
 
-    uint32 GetPixelUUID(POINT pt) const;
+    /**
+     * 클라이언트 좌표 pt 픽셀의 UUID를 요청합니다. GPU를 기다리지 않으며, 한두 프레임 뒤 TickUUIDReadback에서 OnResolved가 호출됩니다.
+     * @return Cancel에 쓸 요청 ID
+     */
+    uint32 RequestPixelUUID(POINT pt, FOnPixelUUIDResolved OnResolved);
+
+    /** 클라이언트 좌표의 두 꼭짓점 픽셀을 포함하는 영역에 그려진 UUID 집합을 요청합니다 (Marquee 선택). */
+    uint32 RequestRectUUIDs(const RECT& Rect, FOnRectUUIDsResolved OnResolved);
+
+    void CancelUUIDRequest(uint32 RequestId) { UUIDReadbackQueue.Cancel(RequestId); }
+
+    /** 프레임마다 Present 뒤에 호출합니다. 복사가 끝난 UUID 요청의 결과를 전달합니다. */
+    void TickUUIDReadback() { UUIDReadbackQueue.Tick(); }
+
     uint32 DecodeUUIDColor(FVector4 UUIDColor) const;
 private:
     ID3D11RasterizerState* CurrentRasterizer = nullptr;
+
+    FD3D11UUIDReadbackSource UUIDReadbackSource;
+    FUUIDReadbackQueue UUIDReadbackQueue;
 };
 
@@ -0,0 +1,221 @@
+#include "UUIDReadbackQueue.h"
+#include "Math/MathUtility.h"
+
+
+void FUUIDReadbackQueue::SetSource(IUUIDReadbackSource* InSource)
+{
+    Reset();
+    Source = InSource;
+}
+
+uint32 FUUIDReadbackQueue::RequestPixel(int32 X, int32 Y, FOnPixelUUIDResolved OnResolved)
+{
+    FRequest Request;
+    Request.Rect = { X, Y, X + 1, Y + 1 };
+    Request.bIsPixel = true;
+    Request.OnPixelResolved = std::move(OnResolved);
+    return AddRequest(std::move(Request));
+}
+
+uint32 FUUIDReadbackQueue::RequestRect(const FUUIDReadbackRect& Rect, FOnRectUUIDsResolved OnResolved)
+{
+    FRequest Request;
+    Request.Rect = Rect;
+    Request.OnRectResolved = std::move(OnResolved);
+    return AddRequest(std::move(Request));
+}
+
+void FUUIDReadbackQueue::Cancel(uint32 RequestId)
+{
+    // 이미 복사를 건 요청은 슬롯이 비워질 때까지 남겨 두고 결과만 버립니다.
+    for (FRequest& Request : InFlight)
+    {
+        if (Request.Id == RequestId)
+        {
+            Request.bCanceled = true;
+            return;
+        }
+    }
+
+    for (int32 Index = 0; Index < Queued.Num(); ++Index)
+    {
+        if (Queued[Index].Id == RequestId)
+        {
+            Queued.RemoveAt(Index);
+            return;
+        }
+    }
+}
+
+void FUUIDReadbackQueue::Tick()
+{
+    ++FrameNumber;
+
+    if (!Source)
+    {
+        return;
+    }
+
+    // 복사는 건 순서대로 끝나므로 맨 앞이 아직이면 뒤도 기다리지 않습니다.
+    while (InFlight.Num() > 0)
+    {
+        const FRequest& Front = InFlight[0];
+        const bool bWait = Front.Slot != INDEX_NONE && FrameNumber - Front.IssuedFrame >= MaxLatencyFrames;
+        if (!TryResolveFront(bWait))
+        {
+            break;
+        }
+    }
+
+    while (Queued.Num() > 0 && TryIssue(Queued[0]))
+    {
+        InFlight.Add(std::move(Queued[0]));
+        Queued.RemoveAt(0);
+    }
+}
+
+void FUUIDReadbackQueue::Flush()
+{
+    if (!Source)
+    {
+        Reset();
+        return;
+    }
+
+    while (GetNumPending() > 0)
+    {
+        while (InFlight.Num() > 0)
+        {
+            TryResolveFront(true);
+        }
+
+        while (Queued.Num() > 0 && TryIssue(Queued[0]))
+        {
+            InFlight.Add(std::move(Queued[0]));
+            Queued.RemoveAt(0);
+        }
+    }
+}
+
+void FUUIDReadbackQueue::Reset()
+{
+    InFlight.Empty();
+    Queued.Empty();
+    BusySlotMask = 0;
+}
+
+uint32 FUUIDReadbackQueue::AddRequest(FRequest&& Request)
+{
+    Request.Id = NextRequestId++;
+    if (NextRequestId == 0)
+    {
+        NextRequestId = 1;
+    }
+
+    const uint32 RequestId = Request.Id;
+
+    // 앞선 요청이 대기 중이면 순서를 지키기 위해 뒤에 줄을 세웁니다.
+    if (Source && Queued.Num() == 0 && TryIssue(Request))
+    {
+        InFlight.Add(std::move(Request));
+    }
+    else
+    {
+        Queued.Add(std::move(Request));
+    }
+    return RequestId;
+}
+
+bool FUUIDReadbackQueue::TryIssue(FRequest& Request)
+{
+    uint32 SurfaceWidth = 0;
+    uint32 SurfaceHeight = 0;
+    Source->GetSurfaceSize(SurfaceWidth, SurfaceHeight);
+
+    FUUIDReadbackRect& Rect = Request.Rect;
+    Rect.Left = FMath::Max(Rect.Left, 0);
+    Rect.Top = FMath::Max(Rect.Top, 0);
+    Rect.Right = FMath::Min(Rect.Right, static_cast<int32>(SurfaceWidth));
+    Rect.Bottom = FMath::Min(Rect.Bottom, static_cast<int32>(SurfaceHeight));
+
+    Request.IssuedFrame = FrameNumber;
+
+    // 버퍼 밖의 요청은 복사 없이 다음 Tick에 빈 결과로 처리합니다.
+    const uint32 NumSlots = FMath::Min(Source->GetNumSlots(), MaxSlots);
+    if (Rect.IsEmpty() || NumSlots == 0)
+    {
+        Request.Slot = INDEX_NONE;
+        return true;
+    }
+
+    for (uint32 Slot = 0; Slot < NumSlots; ++Slot)
+    {
+        const uint32 SlotBit = 1u << Slot;
+        if (BusySlotMask & SlotBit)
+        {
+            continue;
+        }
+
+        if (!Source->EnqueueCopy(Slot, Rect))
+        {
+            // 복사를 걸 수 없는 요청은 빈 결과로 처리합니다.
+            Request.Slot = INDEX_NONE;
+            return true;
+        }
+
+        BusySlotMask |= SlotBit;
+        Request.Slot = static_cast<int32>(Slot);
+        return true;
+    }
+    return false;
+}
+
+bool FUUIDReadbackQueue::TryResolveFront(bool bWait)
+{
+    FRequest& Front = InFlight[0];
+
+    ReadBuffer.Empty();
+    if (Front.Slot != INDEX_NONE)
+    {
+        if (!Source->TryRead(Front.Slot, Front.Rect, bWait, ReadBuffer))
+        {
+            if (!bWait)
+            {
+                return false;
+            }
+
+            // 기다렸는데도 읽지 못했다면 장치 오류이므로 빈 결과로 처리합니다.
+            ReadBuffer.Empty();
+        }
+        BusySlotMask &= ~(1u << Front.Slot);
+    }
+
+    // Delegate 안에서 새 요청을 넣을 수 있도록 먼저 꺼냅니다.
+    const FRequest Request = std::move(Front);
+    InFlight.RemoveAt(0);
+
+    if (!Request.bCanceled)
+    {
+        Resolve(Request, ReadBuffer);
+    }
+    return true;
+}
+
+void FUUIDReadbackQueue::Resolve(const FRequest& Request, const TArray<uint32>& UUIDs) const
+{
+    if (Request.bIsPixel)
+    {
+        Request.OnPixelResolved.ExecuteIfBound(UUIDs.Num() > 0 ? UUIDs[0] : InvalidUUID);
+        return;
+    }
+
+    TSet<uint32> UniqueUUIDs;
+    for (const uint32 UUID : UUIDs)
+    {
+        if (UUID != InvalidUUID)
+        {
+            UniqueUUIDs.Add(UUID);
+        }
+    }
+    Request.OnRectResolved.ExecuteIfBound(UniqueUUIDs);
+}
@@ -0,0 +1,128 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/Set.h"
+#include "CoreMiscDefines.h"
+#include "Delegates/DelegateCombination.h"
+#include "HAL/PlatformType.h"
+
+/** UUID 버퍼의 픽셀 영역. Right, Bottom은 포함하지 않습니다. */
+struct FUUIDReadbackRect
+{
+    int32 Left = 0;
+    int32 Top = 0;
+    int32 Right = 0;
+    int32 Bottom = 0;
+
+    int32 GetWidth() const { return Right - Left; }
+    int32 GetHeight() const { return Bottom - Top; }
+    bool IsEmpty() const { return Right <= Left || Bottom <= Top; }
+};
+
+/**
+ * UUID 버퍼를 CPU로 읽어 오는 방법을 FUUIDReadbackQueue로부터 분리한 인터페이스.
+ * 슬롯마다 복사본 하나를 담을 수 있으며, 복사를 요청한 뒤 GPU가 끝냈을 때 TryRead로 꺼냅니다.
+ */
+class IUUIDReadbackSource
+{
+public:
+    virtual ~IUUIDReadbackSource() = default;
+
+    virtual uint32 GetNumSlots() const = 0;
+
+    /** 현재 UUID 버퍼의 크기. 요청 영역은 이 크기로 잘립니다. */
+    virtual void GetSurfaceSize(uint32& OutWidth, uint32& OutHeight) const = 0;
+
+    /** UUID 버퍼의 Rect 영역을 Slot에 복사하도록 요청합니다. Rect는 항상 버퍼 안쪽입니다. */
+    virtual bool EnqueueCopy(uint32 Slot, const FUUIDReadbackRect& Rect) = 0;
+
+    /**
+     * Slot에 복사된 영역을 행 우선 순서로 디코딩해서 OutUUIDs에 채웁니다.
+     * bWait가 false이고 GPU가 아직 복사를 끝내지 않았으면 기다리지 않고 false를 반환합니다.
+     */
+    virtual bool TryRead(uint32 Slot, const FUUIDReadbackRect& Rect, bool bWait, TArray<uint32>& OutUUIDs) = 0;
+};
+
+DECLARE_DELEGATE_OneParam(FOnPixelUUIDResolved, uint32);
+DECLARE_DELEGATE_OneParam(FOnRectUUIDsResolved, const TSet<uint32>&);
+
+/**
+ * UUID 버퍼 읽기 요청을 모아 두었다가, 프레임이 몇 번 지난 뒤 GPU를 기다리지 않고 결과를 Delegate로 돌려줍니다.
+ *
+ * 빈 슬롯이 있으면 요청 즉시 복사를 걸어 지금 화면에 보이는 프레임을 읽고, 없으면 대기열에 넣었다가
+ * Tick에서 슬롯이 비는 대로 복사합니다. 결과는 요청한 순서대로 Tick 안에서만 전달합니다.
+ */
+class FUUIDReadbackQueue
+{
+public:
+    static constexpr uint32 InvalidUUID = 0xFFFFFFFF;
+
+    /** Source의 슬롯 중 사용할 최대 개수 */
+    static constexpr uint32 MaxSlots = 32;
+
+    /** 복사를 건 뒤 이 프레임 수가 지나도 끝나지 않으면 한 번은 기다려서 읽습니다. */
+    static constexpr uint32 MaxLatencyFrames = 4;
+
+    void SetSource(IUUIDReadbackSource* InSource);
+    IUUIDReadbackSource* GetSource() const { return Source; }
+
+    /** (X, Y) 픽셀의 UUID를 요청합니다. 버퍼 밖이거나 아무것도 그려지지 않았으면 InvalidUUID가 전달됩니다. */
+    uint32 RequestPixel(int32 X, int32 Y, FOnPixelUUIDResolved OnResolved);
+
+    /** Rect 영역에 그려진 UUID 집합을 요청합니다. InvalidUUID는 포함하지 않습니다. */
+    uint32 RequestRect(const FUUIDReadbackRect& Rect, FOnRectUUIDsResolved OnResolved);
+
+    /** 아직 결과를 전달하지 않은 요청의 Delegate를 호출하지 않도록 합니다. */
+    void Cancel(uint32 RequestId);
+
+    /** 프레임마다 한 번 호출합니다. 끝난 복사본을 읽어 결과를 전달하고, 빈 슬롯에 대기 중인 요청을 복사합니다. */
+    void Tick();
+
+    /** 남은 요청을 모두 기다려서 처리합니다. */
+    void Flush();
+
+    /** 남은 요청을 결과 없이 모두 버립니다. */
+    void Reset();
+
+    int32 GetNumPending() const { return InFlight.Num() + Queued.Num(); }
+
+private:
+    struct FRequest
+    {
+        uint32 Id = 0;
+        FUUIDReadbackRect Rect;
+        bool bIsPixel = false;
+        bool bCanceled = false;
+        FOnPixelUUIDResolved OnPixelResolved;
+        FOnRectUUIDsResolved OnRectResolved;
+
+        /** 복사가 걸린 슬롯. 영역이 버퍼 밖이면 INDEX_NONE */
+        int32 Slot = INDEX_NONE;
+        uint64 IssuedFrame = 0;
+    };
+
+    uint32 AddRequest(FRequest&& Request);
+
+    /** 영역을 버퍼 크기로 자른 뒤 빈 슬롯에 복사를 겁니다. 빈 슬롯이 없으면 false */
+    bool TryIssue(FRequest& Request);
+
+    /** InFlight의 맨 앞 요청을 읽어 결과를 전달합니다. 복사가 아직 끝나지 않았으면 false */
+    bool TryResolveFront(bool bWait);
+
+    void Resolve(const FRequest& Request, const TArray<uint32>& UUIDs) const;
+
+private:
+    IUUIDReadbackSource* Source = nullptr;
+
+    /** 복사를 건 순서대로의 요청 */
+    TArray<FRequest> InFlight;
+
+    /** 슬롯을 기다리는 요청 */
+    TArray<FRequest> Queued;
+
+    /** 복사본을 담고 있는 슬롯의 비트 */
+    uint32 BusySlotMask = 0;
+    TArray<uint32> ReadBuffer;
+
+    uint32 NextRequestId = 1;
+    uint64 FrameNumber = 0;
+};
@@ -6,14 +6,6 @@ Texture2D BumpTexture : register(t1);
 SamplerState Sampler : register(s0);
 SamplerState BumpSampler : register(s1);
 
-cbuffer MatrixConstants : register(b0)
-{
-    row_major float4x4 Model;
-    row_major float4x4 MInverseTranspose;
-    float4 UUID;
-    bool isSelected;
-    float3 MatrixPad0;
-};
 cbuffer CameraConstants : register(b1)
 {
     row_major float4x4 View;
@@ -46,19 +38,13 @@ cbuffer FlagConstants : register(b4)
     float3 flagPad0;
 }
 
-cbuffer SubMeshConstants : register(b5)
-{
-    bool IsSelectedSubMesh;
-    float3 SubMeshPad0;
-}
-
-cbuffer TextureConstants : register(b6)
+cbuffer TextureConstants : register(b5)
 {
     float2 UVOffset;
     float2 TexturePad0;
 }
 
-cbuffer RenderNormalConstants : register(b7)
+cbuffer RenderNormalConstants : register(b6)
 {
     bool IsRenderNormal;
     float3 RenderNormalPad0;
@@ -76,6 +62,8 @@ struct PS_INPUT
     float normalFlag : TEXCOORD1; // 노멀 유효 플래그
     float2 texcoord : TEXCOORD2; // UV 좌표
     int materialIndex : MATERIAL_INDEX; // 머티리얼 인덱스
+    nointerpolation float4 uuid : TEXCOORD3; // 피킹용 UUID 색상
+    nointerpolation uint2 flags : TEXCOORD4; // x: 선택된 액터, y: 선택된 서브메시
 };
 
 struct PS_OUTPUT
@@ -91,7 +79,7 @@ PS_OUTPUT mainPS(PS_INPUT input)
 {
     
     PS_OUTPUT output;
-    output.UUID = UUID;
+    output.UUID = input.uuid;
 
     float3 Normal;
     
@@ -189,10 +177,15 @@ PS_OUTPUT mainPS(PS_INPUT input)
     
     output.color = Uber_PS(uberPsInput);
 #endif
-    if (isSelected)
+    if (input.flags.x != 0)
     {
         output.color += float4(0.02, 0.02, 0.02, 1);
     }
+    // 디테일 패널에서 고른 서브메시는 액터 전체보다 더 밝게 표시합니다.
+    if (input.flags.y != 0)
+    {
+        output.color += float4(0.1, 0.1, 0.1, 0);
+    }
     
     return output;
 }
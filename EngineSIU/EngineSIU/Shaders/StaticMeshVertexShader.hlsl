@@ -1,15 +1,7 @@
 // StaticMeshVertexShader.hlsl
 #include <Common.hlsl>
 
-// MatrixBuffer: 변환 행렬 관리
-cbuffer MatrixConstants : register(b0)
-{
-    row_major float4x4 Model;
-    row_major float4x4 MInverseTranspose;
-    float4 UUID;
-    bool isSelected;
-    float3 MatrixPad0;
-};
+// Transform, UUID, 선택 여부는 Instance Buffer(FMeshInstanceData)로 받습니다.
 cbuffer CameraConstants : register(b1)
 {
     row_major float4x4 View;
@@ -28,6 +20,18 @@ struct VS_INPUT
     float2 texcoord : TEXCOORD;
     float4 color : COLOR; // 버텍스 색상
     int materialIndex : MATERIAL_INDEX;
+
+    // Per-Instance 데이터 (행 단위)
+    float4 world0 : INSTANCE_WORLD0;
+    float4 world1 : INSTANCE_WORLD1;
+    float4 world2 : INSTANCE_WORLD2;
+    float4 world3 : INSTANCE_WORLD3;
+    float4 normal0 : INSTANCE_NORMAL0;
+    float4 normal1 : INSTANCE_NORMAL1;
+    float4 normal2 : INSTANCE_NORMAL2;
+    float4 normal3 : INSTANCE_NORMAL3;
+    float4 uuid : INSTANCE_UUID;
+    uint2 flags : INSTANCE_FLAGS; // x: 선택된 액터, y: 선택된 서브메시
 };
 
 struct PS_INPUT
@@ -40,12 +44,17 @@ struct PS_INPUT
     float normalFlag : TEXCOORD1; // 노멀 유효 플래그 (1.0 또는 0.0)
     float2 texcoord : TEXCOORD2; // UV 좌표
     int materialIndex : MATERIAL_INDEX; // 머티리얼 인덱스
+    nointerpolation float4 uuid : TEXCOORD3; // 피킹용 UUID 색상
+    nointerpolation uint2 flags : TEXCOORD4; // x: 선택된 액터, y: 선택된 서브메시
 };
 
 PS_INPUT mainVS(VS_INPUT input)
 {
     PS_INPUT output;
 
+    float4x4 Model = float4x4(input.world0, input.world1, input.world2, input.world3);
+    float4x4 MInverseTranspose = float4x4(input.normal0, input.normal1, input.normal2, input.normal3);
+
     float4 worldPosition = mul(float4(input.position, 1), Model);
     float3 worldNormal = normalize(mul(input.normal, (float3x3) MInverseTranspose));
     float4 viewPosition = mul(worldPosition, View);
@@ -57,6 +66,8 @@ PS_INPUT mainVS(VS_INPUT input)
     output.normalFlag = length(worldNormal) > 0.001f ? 1.0f : 0.0f;
     output.texcoord = input.texcoord;
     output.materialIndex = input.materialIndex;
+    output.uuid = input.uuid;
+    output.flags = input.flags;
 
     VertexInput lightInput;
     lightInput.worldPos = worldPosition.xyz;
@@ -2,10 +2,6 @@
 
 #include <Common.hlsl>
 
-#define MAX_LIGHTS                  16
-#define NUM_POINT_LIGHT              4
-#define NUM_SPOT_LIGHT               4
-
 #define LIGHTING_MODEL_GOURAUD       1
 #define LIGHTING_MODEL_LAMBERT       2
 #define LIGHTING_MODEL_BLINNPHONG    3
@@ -63,15 +59,84 @@ cbuffer Lighting : register(b2)
 {
     AmbientLightInfo AmbientLight;
     DirectionalLightInfo DirectionalLight;
-    PointLightInfo PointLights[NUM_POINT_LIGHT];
-    SpotLightInfo SpotLights[NUM_SPOT_LIGHT];
+
+    uint NumPointLights;
+    uint NumSpotLights;
+    uint NumClustersX;
+    uint NumClustersY;
+
+    uint NumClustersZ;
+    float ClusterDepthScale;
+    float ClusterDepthBias;
+    uint bClusterLogDepth;
 };
 
+// 점광원과 스포트라이트 전체, 그리고 클러스터마다 영향을 주는 Light 목록 (FUpdateLightBufferPass에서 채움)
+StructuredBuffer<PointLightInfo> PointLights : register(t10);
+StructuredBuffer<SpotLightInfo> SpotLights : register(t11);
+StructuredBuffer<uint2> LightClusters : register(t12); // x: LightIndices 시작 위치, y: 점광원 수 | (스포트라이트 수 << 16)
+StructuredBuffer<uint> LightIndices : register(t13);
+
 cbuffer MaterialConstants : register(b3)
 {
     FMaterial Material;
 }
 
+//---------------------------------------------------------------------------
+// 클러스터 Light 목록
+//---------------------------------------------------------------------------
+struct LightList
+{
+    uint Offset;
+    uint NumPoint;
+    uint NumSpot;
+    bool bAllLights; // 클러스터 밖이라 PointLights, SpotLights 전체를 순회합니다.
+};
+
+// 월드 위치가 속한 클러스터의 Light 목록을 찾습니다.
+// 클러스터는 View Frustum 안만 나누므로, Frustum 밖의 위치(화면 밖이나 Near 앞에 있는 Gouraud의 정점 등)를
+// 가장자리 클러스터로 대신하면 그 위치에 닿는 Light를 놓칩니다. 이런 위치는 모든 Light를 순회합니다.
+// 마지막 Slice는 가장 먼 Light가 닿는 깊이까지이므로, 그 너머(Far 안쪽)는 마지막 Slice를 그대로 씁니다.
+LightList GetLightList(float3 WorldPos)
+{
+    LightList List;
+
+    float4 ViewPos = mul(float4(WorldPos, 1.0f), View);
+    float4 ClipPos = mul(ViewPos, Projection);
+
+    if (ClipPos.w <= 1e-6f || any(abs(ClipPos.xy) > ClipPos.w) || ClipPos.z < 0.0f || ClipPos.z > ClipPos.w)
+    {
+        List.Offset = 0;
+        List.NumPoint = NumPointLights;
+        List.NumSpot = NumSpotLights;
+        List.bAllLights = true;
+        return List;
+    }
+
+    float2 Ndc = ClipPos.xy / ClipPos.w;
+    uint X = min((uint)((Ndc.x * 0.5f + 0.5f) * NumClustersX), NumClustersX - 1);
+    uint Y = min((uint)((Ndc.y * 0.5f + 0.5f) * NumClustersY), NumClustersY - 1);
+    float Depth = bClusterLogDepth ? log(max(ViewPos.z, 1e-6f)) : ViewPos.z;
+    uint Slice = (uint)clamp(floor(Depth * ClusterDepthScale + ClusterDepthBias), 0.0f, (float)(NumClustersZ - 1));
+
+    uint2 Cluster = LightClusters[(Slice * NumClustersY + Y) * NumClustersX + X];
+    List.Offset = Cluster.x;
+    List.NumPoint = Cluster.y & 0xFFFF;
+    List.NumSpot = Cluster.y >> 16;
+    List.bAllLights = false;
+    return List;
+}
+
+uint GetPointLightIndex(LightList List, uint i)
+{
+    return List.bAllLights ? i : LightIndices[List.Offset + i];
+}
+
+uint GetSpotLightIndex(LightList List, uint i)
+{
+    return List.bAllLights ? i : LightIndices[List.Offset + List.NumPoint + i];
+}
+
 //---------------------------------------------------------------------------
 // 조명 함수들
 //---------------------------------------------------------------------------
@@ -213,16 +278,18 @@ float4 Uber_VS(VertexInput input)
     // Ambient
     lighting += CalculateAmbientLight().rgb;
 
+    LightList lights = GetLightList(input.worldPos);
+
     // Point Lights
-    for (int i=0; i<NUM_POINT_LIGHT; ++i)
+    for (uint i=0; i<lights.NumPoint; ++i)
     {
-        lighting += CalculatePointLight(PointLights[i], input.worldPos, input.normalWS).rgb;
+        lighting += CalculatePointLight(PointLights[GetPointLightIndex(lights, i)], input.worldPos, input.normalWS).rgb;
     }
 
     // Spot Lights
-    for (int i=0; i<NUM_SPOT_LIGHT; ++i)
+    for (uint i=0; i<lights.NumSpot; ++i)
     {
-        lighting += saturate(CalculateSpotLight(SpotLights[i], input.worldPos, input.normalWS).rgb);
+        lighting += saturate(CalculateSpotLight(SpotLights[GetSpotLightIndex(lights, i)], input.worldPos, input.normalWS).rgb);
     }
     
     // Directional Light
@@ -259,40 +326,43 @@ float4 Uber_PS(PixelInput Input)
     // Lambert : Ambient + Diffuse
     float3 lighting = ambient + directionalDiffuse;
 
+    LightList lights = GetLightList(Input.worldPos);
+
     // PointLights (diffuse)
-    for (int i=0; i<NUM_POINT_LIGHT; i++)
+    for (uint i=0; i<lights.NumPoint; i++)
     {
-        float3 toPoint = PointLights[i].Position - Input.worldPos;
+        PointLightInfo light = PointLights[GetPointLightIndex(lights, i)];
+        float3 toPoint = light.Position - Input.worldPos;
         float dist = length(toPoint);
 
-        if (dist > PointLights[i].m_fAttRadius)
+        if (dist > light.m_fAttRadius)
             continue;
 
         float3 L = normalize(toPoint);
         float diff = saturate(dot(normal, L));
 
         // 간단한 감쇠 : 1/(1 + att * dist^2)
-        float attenuation = 1.0 / (1.0 + PointLights[i].m_fAttenuation * dist * dist);
-        lighting += PointLights[i].DiffuseColor * PointLights[i].Intensity * Material.DiffuseColor.rgb * diff * attenuation;
+        float attenuation = 1.0 / (1.0 + light.m_fAttenuation * dist * dist);
+        lighting += light.DiffuseColor * light.Intensity * Material.DiffuseColor.rgb * diff * attenuation;
     }
 
     // SpotLights (diffuse)
-    [unroll]
-    for (int i=0; i<NUM_SPOT_LIGHT; i++)
+    for (uint i=0; i<lights.NumSpot; i++)
     {
-        float3 toSpot = SpotLights[i].Position - Input.worldPos;
+        SpotLightInfo light = SpotLights[GetSpotLightIndex(lights, i)];
+        float3 toSpot = light.Position - Input.worldPos;
         float dist = length(toSpot);
 
-        if (dist > SpotLights[i].m_fAttRadius)
+        if (dist > light.m_fAttRadius)
             continue;
 
         float3 L = normalize(toSpot);
         float diff = saturate(dot(normal, L));
 
         // Spot Factor : 각도에 따른 Falloff
-        float spotFactor = pow(saturate(dot(-L, normalize(SpotLights[i].Direction))), SpotLights[i].m_fFalloff);
-        float attenuation = 1.0 / (1.0 + SpotLights[i].m_fAttenuation * dist * dist);
-        lighting += SpotLights[i].DiffuseColor * SpotLights[i].Intensity * Material.DiffuseColor.rgb * diff * attenuation * spotFactor;
+        float spotFactor = pow(saturate(dot(-L, normalize(light.Direction))), light.m_fFalloff);
+        float attenuation = 1.0 / (1.0 + light.m_fAttenuation * dist * dist);
+        lighting += light.DiffuseColor * light.Intensity * Material.DiffuseColor.rgb * diff * attenuation * spotFactor;
     }
     
     finalColor = baseColor * lighting + emissive;
@@ -310,43 +380,45 @@ float4 Uber_PS(PixelInput Input)
     
     float3 lighting = ambient + directionalDiffuse + specularDir;
     
+    LightList lights = GetLightList(Input.worldPos);
+
     // PointLights (diffuse + specular)
-    [unroll]
-    for (int i = 0; i < NUM_POINT_LIGHT; i++)
+    for (uint i = 0; i < lights.NumPoint; i++)
     {
-        float3 toLight = PointLights[i].Position - Input.worldPos;
+        PointLightInfo light = PointLights[GetPointLightIndex(lights, i)];
+        float3 toLight = light.Position - Input.worldPos;
         float dist = length(toLight);
-        if (dist > PointLights[i].m_fAttRadius)
+        if (dist > light.m_fAttRadius)
             continue;
         float3 L = normalize(toLight);
         float diff = saturate(dot(normal, L));
-        float attenuation = 1.0 / (1.0 + PointLights[i].m_fAttenuation * dist * dist);
-        float3 diffuseP = PointLights[i].DiffuseColor * PointLights[i].Intensity * Material.DiffuseColor.rgb * diff * attenuation;
+        float attenuation = 1.0 / (1.0 + light.m_fAttenuation * dist * dist);
+        float3 diffuseP = light.DiffuseColor * light.Intensity * Material.DiffuseColor.rgb * diff * attenuation;
         
         float3 halfVec = normalize(L + viewDir);
         float specP = pow(saturate(dot(normal, halfVec)), 32.0);
-        float3 specularP = PointLights[i].SpecularColor * PointLights[i].Intensity * Material.SpecularColor.rgb * specP * Material.SpecularScalar * attenuation;
+        float3 specularP = light.SpecularColor * light.Intensity * Material.SpecularColor.rgb * specP * Material.SpecularScalar * attenuation;
         
         lighting += diffuseP + specularP;
     }
     
     // SpotLights (diffuse + specular)
-    [unroll]
-    for (int i = 0; i < NUM_SPOT_LIGHT; i++)
+    for (uint i = 0; i < lights.NumSpot; i++)
     {
-        float3 toLight = SpotLights[i].Position - Input.worldPos;
+        SpotLightInfo light = SpotLights[GetSpotLightIndex(lights, i)];
+        float3 toLight = light.Position - Input.worldPos;
         float dist = length(toLight);
-        if (dist > SpotLights[i].m_fAttRadius)
+        if (dist > light.m_fAttRadius)
             continue;
         float3 L = normalize(toLight);
         float diff = saturate(dot(normal, L));
-        float spotFactor = pow(saturate(dot(-L, normalize(SpotLights[i].Direction))), SpotLights[i].m_fFalloff);
-        float attenuation = 1.0 / (1.0 + SpotLights[i].m_fAttenuation * dist * dist);
-        float3 diffuseS = SpotLights[i].DiffuseColor * SpotLights[i].Intensity * Material.DiffuseColor.rgb * diff * attenuation * spotFactor;
+        float spotFactor = pow(saturate(dot(-L, normalize(light.Direction))), light.m_fFalloff);
+        float attenuation = 1.0 / (1.0 + light.m_fAttenuation * dist * dist);
+        float3 diffuseS = light.DiffuseColor * light.Intensity * Material.DiffuseColor.rgb * diff * attenuation * spotFactor;
         
         float3 halfVec = normalize(L + viewDir);
         float specS = pow(saturate(dot(normal, halfVec)), 32.0);
-        float3 specularS = SpotLights[i].SpecularColor * SpotLights[i].Intensity * Material.SpecularColor.rgb * specS * Material.SpecularScalar * attenuation * spotFactor;
+        float3 specularS = light.SpecularColor * light.Intensity * Material.SpecularColor.rgb * specS * Material.SpecularScalar * attenuation * spotFactor;
         
         lighting += diffuseS + specularS;
     }
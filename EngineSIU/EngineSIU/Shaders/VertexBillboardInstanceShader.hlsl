@@ -0,0 +1,46 @@
+cbuffer CameraConstants : register(b0)
+{
+    row_major float4x4 View;
+    row_major float4x4 Projection;
+    float3 CameraPosition;
+    float pad;
+};
+
+struct VSInput
+{
+    float3 position : POSITION;
+    float2 texCoord : TEXCOORD;
+
+    // FBillboardInstanceData
+    float3 instancePosition : INSTANCE_POSITION;
+    float2 instanceSize : INSTANCE_SIZE;
+    float2 instanceUVOffset : INSTANCE_UV_OFFSET;
+    float2 instanceUVScale : INSTANCE_UV_SCALE;
+    float4 instanceUUID : INSTANCE_UUID;
+};
+
+struct PSInput
+{
+    float4 position : SV_POSITION;
+    float2 texCoord : TEXCOORD;
+    float4 uuid : UUID;
+};
+
+PSInput main(VSInput input)
+{
+    PSInput output;
+
+    // View 행렬의 회전 부분 열이 카메라의 오른쪽, 위쪽 방향이므로 Quad를 그 평면에 펼쳐 항상 카메라를 바라보게 합니다.
+    float3 cameraRight = float3(View._11, View._21, View._31);
+    float3 cameraUp = float3(View._12, View._22, View._32);
+
+    float3 worldPos = input.instancePosition
+        + cameraRight * (input.position.x * input.instanceSize.x)
+        + cameraUp * (input.position.y * input.instanceSize.y);
+
+    output.position = mul(mul(float4(worldPos, 1.0f), View), Projection);
+    output.texCoord = input.texCoord * input.instanceUVScale + input.instanceUVOffset;
+    output.uuid = input.instanceUUID;
+
+    return output;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+
+/**
+ * 헤드리스 벤치마크 실행 파일에서 사용하는 시간 측정 도구.
+ * 벤치마크는 CTest에 등록하지 않으며, 빌드 디렉터리에서 직접 실행합니다.
+ */
+namespace BenchHarness
+{
+    /** Argv[Index]를 정수로 읽습니다. 없으면 Default를 반환합니다. */
+    inline int GetIntArgument(int Argc, char** Argv, int Index, int Default)
+    {
+        return Argc > Index ? std::atoi(Argv[Index]) : Default;
+    }
+
+    /** Function을 NumRuns번 실행하고 가장 빠른 한 번의 시간(밀리초)을 반환합니다. */
+    template <typename FunctionType>
+    double MeasureBestMs(int NumRuns, FunctionType&& Function)
+    {
+        double BestMs = 0.0;
+        for (int Run = 0; Run < NumRuns; ++Run)
+        {
+            const auto Start = std::chrono::steady_clock::now();
+            Function();
+            const double Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+            if (Run == 0 || Ms < BestMs)
+            {
+                BestMs = Ms;
+            }
+        }
+        return BestMs;
+    }
+}
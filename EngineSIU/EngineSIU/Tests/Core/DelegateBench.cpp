@@ -0,0 +1,111 @@
+#include "BenchHarness.h"
+#include <functional>
+#include <unordered_map>
+#include "Delegates/DelegateCombination.h"
+
+
+/**
+ * TDelegate/TMulticastDelegate와 이전 구현 방식의 비교.
+ *   - Bind + Execute: 람다를 std::function으로 한 번 더 감싸던 이전 BindLambda와 비교합니다.
+ *   - Broadcast: Handle을 Key로 하는 해시 맵을 Broadcast마다 복사해서 순회하던 이전 방식과 비교합니다.
+ * 인자로 반복 횟수를 넘길 수 있습니다.
+ */
+namespace
+{
+    DECLARE_DELEGATE_OneParam(FBenchmarkDelegate, int32);
+    DECLARE_MULTICAST_DELEGATE_OneParam(FBenchmarkMulticastDelegate, int32);
+    using FStdFunction = std::function<void(int32)>;
+
+    struct FBenchmarkTarget
+    {
+        uint64 Sum = 0;
+
+        void Add(int32 Value) { Sum += Value; }
+    };
+}
+
+
+int main(int Argc, char** Argv)
+{
+    const int32 NumIterations = BenchHarness::GetIntArgument(Argc, Argv, 1, 1000000);
+    constexpr int32 NumListeners = 16;
+
+    uint64 StdSum = 0;
+    uint64 DelegateSum = 0;
+
+    const double StdBindMs = BenchHarness::MeasureBestMs(1, [&]
+    {
+        for (int32 Index = 0; Index < NumIterations; ++Index)
+        {
+            FStdFunction Inner = [&StdSum, Index](int32 Value) { StdSum += Value + Index; };
+            FStdFunction Func = [Inner](int32 Value) { Inner(Value); };
+            Func(1);
+        }
+    });
+
+    const double DelegateBindMs = BenchHarness::MeasureBestMs(1, [&]
+    {
+        for (int32 Index = 0; Index < NumIterations; ++Index)
+        {
+            FBenchmarkDelegate Delegate;
+            Delegate.BindLambda([&DelegateSum, Index](int32 Value) { DelegateSum += Value + Index; });
+            Delegate.Execute(1);
+        }
+    });
+
+    FBenchmarkTarget Target;
+    const double RawBindMs = BenchHarness::MeasureBestMs(1, [&]
+    {
+        for (int32 Index = 0; Index < NumIterations; ++Index)
+        {
+            FBenchmarkDelegate Delegate;
+            Delegate.BindRaw(&Target, &FBenchmarkTarget::Add);
+            Delegate.Execute(1);
+        }
+    });
+
+    std::unordered_map<uint64, FStdFunction> StdListeners;
+    FBenchmarkMulticastDelegate Multicast;
+    for (int32 Listener = 0; Listener < NumListeners; ++Listener)
+    {
+        StdListeners.emplace(Listener + 1, [&StdSum, Listener](int32 Value) { StdSum += Value ^ Listener; });
+        Multicast.AddLambda([&DelegateSum, Listener](int32 Value) { DelegateSum += Value ^ Listener; });
+    }
+
+    const double StdBroadcastMs = BenchHarness::MeasureBestMs(1, [&]
+    {
+        for (int32 Index = 0; Index < NumIterations; ++Index)
+        {
+            const std::unordered_map<uint64, FStdFunction> CopyListeners = StdListeners;
+            for (const auto& [Handle, Func] : CopyListeners)
+            {
+                Func(Index);
+            }
+        }
+    });
+
+    const double DelegateBroadcastMs = BenchHarness::MeasureBestMs(1, [&]
+    {
+        for (int32 Index = 0; Index < NumIterations; ++Index)
+        {
+            Multicast.Broadcast(Index);
+        }
+    });
+
+    const auto PrintRow = [](const char* Phase, double OldMs, double NewMs)
+    {
+        std::printf("  %-18s %12.3f %12.3f %8.2fx\n", Phase, OldMs, NewMs, NewMs > 0.0 ? OldMs / NewMs : 0.0);
+    };
+    std::printf("Delegate, %d iterations, %d listeners\n", NumIterations, NumListeners);
+    std::printf("  %-18s %12s %12s %9s\n", "phase", "old ms", "new ms", "speedup");
+    PrintRow("bind lambda", StdBindMs, DelegateBindMs);
+    std::printf("  %-18s %12s %12.3f\n", "bind raw member", "-", RawBindMs);
+    PrintRow("broadcast", StdBroadcastMs, DelegateBroadcastMs);
+
+    if (StdSum != DelegateSum || Target.Sum != static_cast<uint64>(NumIterations))
+    {
+        std::printf("Results differ between the two paths\n");
+        return 1;
+    }
+    return 0;
+}
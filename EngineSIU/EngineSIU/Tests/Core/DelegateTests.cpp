@@ -0,0 +1,365 @@
+#include "TestHarness.h"
+#include <array>
+#include <memory>
+#include <vector>
+#include "Delegates/DelegateCombination.h"
+
+
+namespace
+{
+    DECLARE_DELEGATE_OneParam(FIntDelegate, int32);
+    DECLARE_MULTICAST_DELEGATE_OneParam(FIntMulticastDelegate, int32);
+    using FIntRetDelegate = TDelegate<int32(int32)>;
+
+    /** 살아 있는 개수와 복사/이동 횟수를 세는 호출 대상. Padding으로 크기를 정해 버퍼와 힙 저장을 고릅니다. */
+    struct FCounters
+    {
+        int32 Alive = 0;
+        int32 Copies = 0;
+        int32 Moves = 0;
+    };
+
+    template <size_t PaddingSize>
+    struct TCountedFunctor
+    {
+        FCounters* Counters;
+        int32* Sum;
+        char Padding[PaddingSize] = {};
+
+        TCountedFunctor(FCounters* InCounters, int32* InSum) : Counters(InCounters), Sum(InSum) { ++Counters->Alive; }
+        TCountedFunctor(const TCountedFunctor& Other) : Counters(Other.Counters), Sum(Other.Sum) { ++Counters->Alive; ++Counters->Copies; }
+        TCountedFunctor(TCountedFunctor&& Other) noexcept : Counters(Other.Counters), Sum(Other.Sum) { ++Counters->Alive; ++Counters->Moves; }
+        ~TCountedFunctor() { --Counters->Alive; }
+
+        void operator()(int32 Value) const { *Sum += Value; }
+    };
+
+    using FSmallFunctor = TCountedFunctor<8>;
+    using FLargeFunctor = TCountedFunctor<128>;
+
+    struct FThrowingMoveFunctor
+    {
+        FThrowingMoveFunctor() = default;
+        FThrowingMoveFunctor(const FThrowingMoveFunctor&) = default;
+        FThrowingMoveFunctor(FThrowingMoveFunctor&&) noexcept(false) {}
+        void operator()(int32) const {}
+    };
+
+    struct FTarget
+    {
+        int32 Sum = 0;
+        void Add(int32 Value) { Sum += Value; }
+    };
+
+    int32 GStaticSum = 0;
+    void AddStatic(int32 Value) { GStaticSum += Value; }
+}
+
+
+TEST_CASE(SmallCallablesAreStoredInline)
+{
+    int32 Sum = 0;
+    int32* SumPtr = &Sum;
+    const auto TwoPointers = [SumPtr, &Sum](int32 Value) { *SumPtr += Value + Sum; };
+    const auto LargeCapture = [Padding = std::array<char, 128>{}](int32) { (void)Padding; };
+
+    static_assert(DelegatePrivate::IsStoredInline<DelegatePrivate::TMemberFunctionCaller<FTarget, decltype(&FTarget::Add)>>);
+    static_assert(DelegatePrivate::IsTriviallyStored<DelegatePrivate::TMemberFunctionCaller<FTarget, decltype(&FTarget::Add)>>);
+    static_assert(DelegatePrivate::IsTriviallyStored<void (*)(int32)>);
+    static_assert(DelegatePrivate::IsTriviallyStored<decltype(TwoPointers)>);
+    static_assert(DelegatePrivate::IsStoredInline<FSmallFunctor>);
+    static_assert(!DelegatePrivate::IsTriviallyStored<FSmallFunctor>);
+    static_assert(DelegatePrivate::IsStoredInline<std::unique_ptr<int32>>);
+
+    // 버퍼보다 크거나, 예외를 던질 수 있는 이동 생성자를 가진 대상은 힙에 저장합니다.
+    static_assert(!DelegatePrivate::IsStoredInline<decltype(LargeCapture)>);
+    static_assert(!DelegatePrivate::IsStoredInline<FLargeFunctor>);
+    static_assert(!DelegatePrivate::IsStoredInline<FThrowingMoveFunctor>);
+
+    FTarget Target;
+    FIntDelegate Delegate;
+    CHECK(!Delegate.IsBound());
+    CHECK(!Delegate.ExecuteIfBound(1));
+
+    Delegate.BindRaw(&Target, &FTarget::Add);
+    CHECK(Delegate.ExecuteIfBound(3));
+    CHECK(Target.Sum == 3);
+
+    Delegate.BindStatic(&AddStatic);
+    Delegate.Execute(4);
+    CHECK(GStaticSum == 4);
+
+    Delegate.BindLambda(LargeCapture);
+    Delegate.Execute(1);
+    Delegate.BindLambda(FThrowingMoveFunctor());
+    Delegate.Execute(1);
+    Delegate.UnBind();
+    CHECK(!Delegate.IsBound());
+
+    FIntRetDelegate RetDelegate;
+    RetDelegate.BindLambda([](int32 Value) { return Value * 2; });
+    CHECK(RetDelegate.Execute(21) == 42);
+}
+
+TEST_CASE(InlineFunctorsAreCopiedAndMovedInPlace)
+{
+    FCounters Counters;
+    int32 Sum = 0;
+    {
+        FIntDelegate Delegate;
+        Delegate.BindLambda(FSmallFunctor(&Counters, &Sum));
+        CHECK(Counters.Alive == 1);
+
+        // 복사본은 자기 버퍼에 새 호출 대상을 만듭니다.
+        FIntDelegate Copy = Delegate;
+        CHECK(Counters.Alive == 2 && Counters.Copies == 1);
+
+        // 이동하면 버퍼 사이에서 대상을 옮기고 원본은 비웁니다.
+        const int32 MovesBefore = Counters.Moves;
+        FIntDelegate Moved = std::move(Delegate);
+        CHECK(!Delegate.IsBound());
+        CHECK(Counters.Moves == MovesBefore + 1 && Counters.Alive == 2);
+
+        Copy.Execute(1);
+        Moved.Execute(2);
+        CHECK(Sum == 3);
+
+        // 대입은 기존 대상을 먼저 없앱니다.
+        Copy = Moved;
+        CHECK(Counters.Alive == 2);
+        Copy = std::move(Moved);
+        CHECK(Counters.Alive == 1 && !Moved.IsBound());
+        Copy.Execute(4);
+        CHECK(Sum == 7);
+    }
+    CHECK(Counters.Alive == 0);
+}
+
+TEST_CASE(HeapFunctorsAreCopiedButMovedByPointer)
+{
+    FCounters Counters;
+    int32 Sum = 0;
+    {
+        FIntDelegate Delegate;
+        Delegate.BindLambda(FLargeFunctor(&Counters, &Sum));
+        CHECK(Counters.Alive == 1);
+
+        FIntDelegate Copy = Delegate;
+        CHECK(Counters.Alive == 2 && Counters.Copies == 1);
+
+        // 힙에 있는 대상은 포인터만 넘기므로 이동 생성자가 불리지 않습니다.
+        const int32 MovesBefore = Counters.Moves;
+        FIntDelegate Moved = std::move(Delegate);
+        CHECK(!Delegate.IsBound());
+        CHECK(Counters.Moves == MovesBefore && Counters.Alive == 2);
+
+        Copy.Execute(1);
+        Moved.Execute(2);
+        CHECK(Sum == 3);
+
+        Moved = Copy;
+        CHECK(Counters.Alive == 2 && Counters.Copies == 2);
+        Copy.UnBind();
+        CHECK(Counters.Alive == 1);
+        Moved.Execute(4);
+        CHECK(Sum == 7);
+    }
+    CHECK(Counters.Alive == 0);
+}
+
+TEST_CASE(CopiesOfMutableLambdasKeepSeparateState)
+{
+    std::vector<int32> Seen;
+    FIntDelegate Small;
+    Small.BindLambda([&Seen, Count = 0](int32) mutable { Seen.push_back(++Count); });
+
+    FIntDelegate Large;
+    Large.BindLambda([&Seen, Count = 100, Padding = std::array<char, 128>{}](int32) mutable { (void)Padding; Seen.push_back(++Count); });
+
+    Small.Execute(0);
+    Large.Execute(0);
+    FIntDelegate SmallCopy = Small;
+    FIntDelegate LargeCopy = Large;
+    Small.Execute(0);
+    SmallCopy.Execute(0);
+    Large.Execute(0);
+    LargeCopy.Execute(0);
+
+    CHECK(Seen == std::vector<int32>({ 1, 101, 2, 2, 102, 102 }));
+}
+
+TEST_CASE(MoveOnlyLambdasCanBeBoundAndMoved)
+{
+    int32 Sum = 0;
+    FIntDelegate Delegate;
+    Delegate.BindLambda([&Sum, Owned = std::make_unique<int32>(5)](int32 Value) { Sum += *Owned + Value; });
+
+    FIntDelegate Moved = std::move(Delegate);
+    CHECK(!Delegate.IsBound());
+    Moved.Execute(1);
+    CHECK(Sum == 6);
+
+    FIntMulticastDelegate Multicast;
+    Multicast.Add(std::move(Moved));
+    Multicast.Broadcast(2);
+    CHECK(Sum == 13);
+}
+
+TEST_CASE(BroadcastCallsListenersInAddOrder)
+{
+    std::vector<int32> Calls;
+    FIntMulticastDelegate Multicast;
+    CHECK(!Multicast.IsBound());
+
+    FTarget Target;
+    const FDelegateHandle Handles[4] = {
+        Multicast.AddLambda([&Calls](int32 Value) { Calls.push_back(Value); }),
+        Multicast.AddRaw(&Target, &FTarget::Add),
+        Multicast.AddLambda([&Calls, Padding = std::array<char, 128>{}](int32 Value) { (void)Padding; Calls.push_back(Value * 10); }),
+        Multicast.AddStatic(&AddStatic)
+    };
+    CHECK(Multicast.IsBound());
+    CHECK(Handles[0] < Handles[1] && Handles[1] < Handles[2] && Handles[2] < Handles[3]);
+
+    GStaticSum = 0;
+    Multicast.Broadcast(2);
+    CHECK(Calls == std::vector<int32>({ 2, 20 }));
+    CHECK(Target.Sum == 2 && GStaticSum == 2);
+
+    CHECK(Multicast.Remove(Handles[1]));
+    CHECK(!Multicast.Remove(Handles[1]));
+    CHECK(!Multicast.Remove(FDelegateHandle::CreateHandle()));
+    Multicast.Broadcast(3);
+    CHECK(Target.Sum == 2 && GStaticSum == 5);
+
+    Multicast.Clear();
+    CHECK(!Multicast.IsBound());
+    Multicast.Broadcast(4);
+    CHECK(Calls.size() == 4);
+}
+
+TEST_CASE(RemoveDuringBroadcastSkipsOnlyListenersNotYetCalled)
+{
+    std::vector<int32> Calls;
+    FIntMulticastDelegate Multicast;
+    std::vector<FDelegateHandle> Handles;
+
+    // 1번 Listener가 자기 자신과 0번, 3번을 지웁니다.
+    Handles.push_back(Multicast.AddLambda([&Calls](int32) { Calls.push_back(0); }));
+    Handles.push_back(Multicast.AddLambda([&](int32)
+    {
+        Calls.push_back(1);
+        CHECK(Multicast.Remove(Handles[1]));
+        CHECK(Multicast.Remove(Handles[0]));
+        CHECK(Multicast.Remove(Handles[3]));
+        CHECK(!Multicast.Remove(Handles[3]));
+    }));
+    Handles.push_back(Multicast.AddLambda([&Calls](int32) { Calls.push_back(2); }));
+    Handles.push_back(Multicast.AddLambda([&Calls](int32) { Calls.push_back(3); }));
+    Handles.push_back(Multicast.AddLambda([&Calls](int32) { Calls.push_back(4); }));
+
+    Multicast.Broadcast(0);
+    CHECK(Calls == std::vector<int32>({ 0, 1, 2, 4 }));
+
+    Calls.clear();
+    Multicast.Broadcast(0);
+    CHECK(Calls == std::vector<int32>({ 2, 4 }));
+
+    // 정리된 뒤에도 Handle로 남은 Listener를 찾을 수 있습니다.
+    CHECK(Multicast.Remove(Handles[4]));
+    CHECK(!Multicast.Remove(Handles[0]));
+    Calls.clear();
+    Multicast.Broadcast(0);
+    CHECK(Calls == std::vector<int32>({ 2 }));
+}
+
+TEST_CASE(AddDuringBroadcastRunsFromTheNextBroadcast)
+{
+    std::vector<int32> Calls;
+    FIntMulticastDelegate Multicast;
+    std::vector<FDelegateHandle> Added;
+
+    Multicast.AddLambda([&](int32 Value)
+    {
+        Calls.push_back(Value);
+        if (Value == 1)
+        {
+            Added.push_back(Multicast.AddLambda([&Calls](int32 Inner) { Calls.push_back(Inner * 100); }));
+            Added.push_back(Multicast.AddLambda([&Calls](int32 Inner) { Calls.push_back(-Inner); }));
+            CHECK(Multicast.Remove(Added[1]));
+        }
+    });
+
+    Multicast.Broadcast(1);
+    CHECK(Calls == std::vector<int32>({ 1 }));
+
+    Multicast.Broadcast(2);
+    CHECK(Calls == std::vector<int32>({ 1, 2, 200 }));
+    CHECK(!Multicast.Remove(Added[1]));
+    CHECK(Multicast.Remove(Added[0]));
+}
+
+TEST_CASE(NestedBroadcastDefersCleanupToTheOutermost)
+{
+    std::vector<int32> Calls;
+    FIntMulticastDelegate Multicast;
+    std::vector<FDelegateHandle> Handles;
+
+    Multicast.AddLambda([&](int32 Depth)
+    {
+        Calls.push_back(Depth);
+        if (Depth == 0)
+        {
+            CHECK(Multicast.Remove(Handles[0]));
+            Multicast.Broadcast(1);
+        }
+    });
+    Handles.push_back(Multicast.AddLambda([&Calls](int32 Depth) { Calls.push_back(10 + Depth); }));
+    Multicast.AddLambda([&Calls](int32 Depth) { Calls.push_back(20 + Depth); });
+
+    Multicast.Broadcast(0);
+    CHECK(Calls == std::vector<int32>({ 0, 1, 21, 20 }));
+
+    // Broadcast 중의 Clear는 남은 Listener 호출도 막습니다.
+    Calls.clear();
+    FIntMulticastDelegate Clearing;
+    Clearing.AddLambda([&](int32) { Calls.push_back(0); Clearing.Clear(); });
+    Clearing.AddLambda([&Calls](int32) { Calls.push_back(1); });
+    Clearing.Broadcast(0);
+    CHECK(Calls == std::vector<int32>({ 0 }));
+    CHECK(!Clearing.IsBound());
+}
+
+TEST_CASE(ListenersSurviveArrayGrowth)
+{
+    FCounters Counters;
+    int32 Sum = 0;
+    {
+        FIntMulticastDelegate Multicast;
+        std::vector<FDelegateHandle> Handles;
+        for (int32 Index = 0; Index < 100; ++Index)
+        {
+            if (Index & 1)
+            {
+                Handles.push_back(Multicast.AddLambda(FLargeFunctor(&Counters, &Sum)));
+            }
+            else
+            {
+                Handles.push_back(Multicast.AddLambda(FSmallFunctor(&Counters, &Sum)));
+            }
+        }
+        CHECK(Counters.Alive == 100);
+
+        Multicast.Broadcast(1);
+        CHECK(Sum == 100);
+
+        for (int32 Index = 0; Index < 100; Index += 3)
+        {
+            CHECK(Multicast.Remove(Handles[Index]));
+        }
+        CHECK(Counters.Alive == 66);
+        Multicast.Broadcast(1);
+        CHECK(Sum == 166);
+    }
+    CHECK(Counters.Alive == 0);
+}
@@ -0,0 +1,137 @@
+#include "BenchHarness.h"
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <unordered_map>
+#include "Container/Array.h"
+#include "Container/FlatHashTable.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+
+
+/**
+ * TFlatHashMap과 std::unordered_map 비교. 같은 Key로 넣기, 찾기(있는 Key와 없는 Key), 순회, 절반 지우기 시간을 잽니다.
+ *   - uint64: UObject*처럼 16바이트 간격의 포인터 Key
+ *   - FString: 에셋 경로처럼 공통 접두사가 붙은 문자열 Key
+ */
+namespace
+{
+    struct FMapBenchmarkResult
+    {
+        double InsertMs = 0.0;
+        double FindMs = 0.0;
+        double IterateMs = 0.0;
+        double EraseMs = 0.0;
+        uint64 Checksum = 0;
+    };
+
+    template <typename MapType, typename KeyType>
+    FMapBenchmarkResult RunMapBenchmark(const TArray<KeyType>& Keys, const TArray<KeyType>& MissKeys)
+    {
+        FMapBenchmarkResult Result;
+        MapType Map;
+
+        Result.InsertMs = BenchHarness::MeasureBestMs(1, [&]
+        {
+            for (int32 Index = 0; Index < Keys.Num(); ++Index)
+            {
+                Map.emplace(Keys[Index], static_cast<uint64>(Index));
+            }
+        });
+
+        Result.FindMs = BenchHarness::MeasureBestMs(1, [&]
+        {
+            for (const KeyType& Key : Keys)
+            {
+                auto It = Map.find(Key);
+                Result.Checksum += It != Map.end() ? It->second : 0;
+            }
+            for (const KeyType& Key : MissKeys)
+            {
+                Result.Checksum += Map.find(Key) != Map.end() ? 1 : 0;
+            }
+        });
+
+        Result.IterateMs = BenchHarness::MeasureBestMs(1, [&]
+        {
+            for (const auto& Pair : Map)
+            {
+                Result.Checksum += Pair.second;
+            }
+        });
+
+        Result.EraseMs = BenchHarness::MeasureBestMs(1, [&]
+        {
+            for (int32 Index = 0; Index < Keys.Num(); Index += 2)
+            {
+                Result.Checksum += Map.erase(Keys[Index]);
+            }
+        });
+
+        return Result;
+    }
+
+    /** 결과가 다르면 false를 반환합니다. */
+    bool PrintResults(const char* Label, const FMapBenchmarkResult& Std, const FMapBenchmarkResult& Flat)
+    {
+        const auto PrintRow = [Label](const char* Phase, double StdMs, double FlatMs)
+        {
+            std::printf("  %-8s %-8s %10.3f %10.3f %7.2fx\n", Label, Phase, StdMs, FlatMs, FlatMs > 0.0 ? StdMs / FlatMs : 0.0);
+        };
+        PrintRow("insert", Std.InsertMs, Flat.InsertMs);
+        PrintRow("find", Std.FindMs, Flat.FindMs);
+        PrintRow("iterate", Std.IterateMs, Flat.IterateMs);
+        PrintRow("erase", Std.EraseMs, Flat.EraseMs);
+        if (Std.Checksum != Flat.Checksum)
+        {
+            std::printf("  %s results differ between the two maps\n", Label);
+            return false;
+        }
+        return true;
+    }
+}
+
+
+int main(int Argc, char** Argv)
+{
+    const int32 NumKeys = BenchHarness::GetIntArgument(Argc, Argv, 1, 100000);
+
+    TArray<uint64> PointerKeys;
+    TArray<uint64> MissPointerKeys;
+    TArray<FString> StringKeys;
+    TArray<FString> MissStringKeys;
+    PointerKeys.Reserve(NumKeys);
+    MissPointerKeys.Reserve(NumKeys);
+    StringKeys.Reserve(NumKeys);
+    MissStringKeys.Reserve(NumKeys);
+
+    std::mt19937 Random(1234);
+    for (int32 Index = 0; Index < NumKeys; ++Index)
+    {
+        PointerKeys.Add(0x10000000ull + Index * 32ull);
+        MissPointerKeys.Add(0x10000000ull + Index * 32ull + 16ull);
+        StringKeys.Add(FString::Printf(TEXT("Contents/Mesh/Key_%d"), Index));
+        MissStringKeys.Add(FString::Printf(TEXT("Contents/Mesh/Miss_%d"), Index));
+    }
+    std::shuffle(PointerKeys.begin(), PointerKeys.end(), Random);
+    std::shuffle(StringKeys.begin(), StringKeys.end(), Random);
+
+    using FStdPointerMap = std::unordered_map<uint64, uint64, std::hash<uint64>, std::equal_to<uint64>, FDefaultAllocator<std::pair<const uint64, uint64>>>;
+    using FFlatPointerMap = TFlatHashMap<uint64, uint64>;
+    using FStdStringMap = std::unordered_map<FString, uint64, std::hash<FString>, std::equal_to<FString>, FDefaultAllocator<std::pair<const FString, uint64>>>;
+    using FFlatStringMap = TFlatHashMap<FString, uint64>;
+
+    std::printf("Hash map, %d keys (TMap/TSet use %s)\n", NumKeys, USE_FLAT_HASH_CONTAINERS ? "TFlatHashMap" : "std::unordered_map");
+    std::printf("  %-8s %-8s %10s %10s %8s\n", "key", "phase", "std ms", "flat ms", "speedup");
+
+    bool bMatches = PrintResults("uint64",
+        RunMapBenchmark<FStdPointerMap>(PointerKeys, MissPointerKeys),
+        RunMapBenchmark<FFlatPointerMap>(PointerKeys, MissPointerKeys)
+    );
+    bMatches &= PrintResults("FString",
+        RunMapBenchmark<FStdStringMap>(StringKeys, MissStringKeys),
+        RunMapBenchmark<FFlatStringMap>(StringKeys, MissStringKeys)
+    );
+
+    return bMatches ? 0 : 1;
+}
@@ -0,0 +1,196 @@
+#include "TestHarness.h"
+#include <cstring>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include "Container/FlatHashTable.h"
+
+
+namespace
+{
+    /** 살아 있는 개수를 세서, 테이블이 옮기거나 지운 요소를 빠짐없이 소멸시키는지 확인합니다. */
+    struct FTracked
+    {
+        static inline int32 NumAlive = 0;
+
+        int32 Value = 0;
+
+        FTracked(int32 InValue = 0) : Value(InValue) { ++NumAlive; }
+        FTracked(const FTracked& Other) : Value(Other.Value) { ++NumAlive; }
+        FTracked(FTracked&& Other) noexcept : Value(Other.Value) { ++NumAlive; }
+        FTracked& operator=(const FTracked&) = default;
+        ~FTracked() { --NumAlive; }
+    };
+
+    /** 돌려받은 메모리를 0xDD로 덮어서, 테이블이 커진 뒤 옛 슬롯을 읽으면 값이 달라지게 하는 할당자 */
+    template <typename T>
+    struct TPoisoningAllocator
+    {
+        using value_type = T;
+
+        TPoisoningAllocator() = default;
+        template <typename U>
+        TPoisoningAllocator(const TPoisoningAllocator<U>&) {}
+
+        T* allocate(size_t Count) { return std::allocator<T>{}.allocate(Count); }
+
+        void deallocate(T* Pointer, size_t Count)
+        {
+            std::memset(static_cast<void*>(Pointer), 0xDD, Count * sizeof(T));
+            std::allocator<T>{}.deallocate(Pointer, Count);
+        }
+
+        template <typename U>
+        bool operator==(const TPoisoningAllocator<U>&) const { return true; }
+    };
+
+    using FPoisonedMap = TFlatHashMap<int32, int32, std::hash<int32>, std::equal_to<int32>, TPoisoningAllocator<std::pair<const int32, int32>>>;
+}
+
+
+TEST_CASE(MapMatchesUnorderedMap)
+{
+    std::mt19937 Random(7);
+    for (const uint32 KeyRange : { 64u, 5000u })
+    {
+        {
+            TFlatHashMap<uint64, FTracked> Map;
+            std::unordered_map<uint64, int32> Expected;
+            for (int32 Op = 0; Op < 100000; ++Op)
+            {
+                const uint64 Key = Random() % KeyRange;
+                const uint32 Action = Random() % 10;
+                if (Action < 5)
+                {
+                    const auto Result = Map.try_emplace(Key, Op);
+                    const auto ExpectedResult = Expected.emplace(Key, Op);
+                    CHECK(Result.second == ExpectedResult.second);
+                    CHECK(Result.first->second.Value == ExpectedResult.first->second);
+                }
+                else if (Action < 8)
+                {
+                    CHECK(Map.erase(Key) == Expected.erase(Key));
+                }
+                else
+                {
+                    const auto Found = Map.find(Key);
+                    const auto ExpectedFound = Expected.find(Key);
+                    CHECK((Found == Map.end()) == (ExpectedFound == Expected.end()));
+                    if (ExpectedFound != Expected.end())
+                    {
+                        CHECK(Found->second.Value == ExpectedFound->second);
+                    }
+                }
+            }
+
+            CHECK(Map.size() == Expected.size());
+            size_t NumVisited = 0;
+            for (const auto& [Key, Value] : Map)
+            {
+                ++NumVisited;
+                CHECK(Expected.at(Key) == Value.Value);
+            }
+            CHECK(NumVisited == Expected.size());
+
+            // 순회하면서 지우기
+            for (auto It = Map.begin(); It != Map.end();)
+            {
+                Expected.erase(It->first);
+                It = Map.erase(It);
+            }
+            CHECK(Map.size() == 0);
+            CHECK(Expected.empty());
+        }
+        CHECK(FTracked::NumAlive == 0);
+    }
+}
+
+TEST_CASE(CopyMoveAndClearKeepElementsAlive)
+{
+    {
+        TFlatHashMap<uint64, FTracked> Map;
+        for (int32 Index = 0; Index < 100; ++Index)
+        {
+            Map[Index] = FTracked(Index);
+        }
+
+        TFlatHashMap<uint64, FTracked> Copy = Map;
+        CHECK(Copy.size() == 100);
+        CHECK(Copy.at(42).Value == 42);
+
+        TFlatHashMap<uint64, FTracked> Moved = std::move(Copy);
+        CHECK(Moved.size() == 100);
+        CHECK(Copy.size() == 0);
+
+        Map.clear();
+        CHECK(Map.size() == 0);
+        CHECK(FTracked::NumAlive == 100);
+
+        // clear 후에도 슬롯을 다시 쓸 수 있어야 합니다.
+        Map[7] = FTracked(7);
+        CHECK(Map.at(7).Value == 7);
+    }
+    CHECK(FTracked::NumAlive == 0);
+}
+
+TEST_CASE(SetMatchesUnorderedSet)
+{
+    std::mt19937 Random(3);
+    TFlatHashSet<uint32> Set;
+    std::unordered_set<uint32> Expected;
+    for (int32 Op = 0; Op < 100000; ++Op)
+    {
+        const uint32 Key = Random() % 3000;
+        if (Random() % 3 != 0)
+        {
+            CHECK(Set.insert(Key).second == Expected.insert(Key).second);
+        }
+        else
+        {
+            CHECK(Set.erase(Key) == Expected.erase(Key));
+        }
+    }
+    CHECK(Set.size() == Expected.size());
+    for (const uint32 Key : Expected)
+    {
+        CHECK(Set.contains(Key));
+    }
+}
+
+TEST_CASE(KeyFromTheMapSurvivesGrowth)
+{
+    // 새 Key가 Map 안의 Value를 가리킵니다. 삽입하면서 테이블이 커지면 그 Value가 다른 슬롯으로 옮겨집니다.
+    FPoisonedMap Map;
+    Map[0] = 1;
+    for (int32 Index = 1; Index < 1000; ++Index)
+    {
+        const int32& NextKey = Map.find(Index - 1)->second;
+        Map[NextKey] = Index + 1;
+    }
+
+    CHECK(Map.size() == 1000);
+    for (int32 Index = 0; Index < 1000; ++Index)
+    {
+        const auto Found = Map.find(Index);
+        CHECK(Found != Map.end() && Found->second == Index + 1);
+    }
+}
+
+TEST_CASE(ValueFromTheMapSurvivesGrowth)
+{
+    // try_emplace의 Value 인자가 Map 안의 요소를 가리키는 경우
+    FPoisonedMap Map;
+    Map.try_emplace(0, 42);
+    for (int32 Index = 1; Index < 1000; ++Index)
+    {
+        Map.try_emplace(Index, Map.find(Index - 1)->second);
+    }
+
+    CHECK(Map.size() == 1000);
+    for (int32 Index = 0; Index < 1000; ++Index)
+    {
+        const auto Found = Map.find(Index);
+        CHECK(Found != Map.end() && Found->second == 42);
+    }
+}
@@ -0,0 +1,110 @@
+#include "TestHarness.h"
+#include <atomic>
+#include <set>
+#include <vector>
+#include "Async/JobSystem.h"
+
+
+TEST_CASE(ParallelForVisitsEveryIndexOnce)
+{
+    for (const int32 Num : { 0, 1, 7, 100, 4096, 100003 })
+    {
+        std::vector<std::atomic<int32>> Visits(Num);
+        FJobSystem::Get().ParallelFor(Num, 16, [&Visits](int32 Begin, int32 End, int32)
+        {
+            for (int32 Index = Begin; Index < End; ++Index)
+            {
+                Visits[Index].fetch_add(1);
+            }
+        });
+
+        bool bAllOnce = true;
+        for (const std::atomic<int32>& Count : Visits)
+        {
+            bAllOnce &= Count.load() == 1;
+        }
+        CHECK(bAllOnce);
+    }
+}
+
+TEST_CASE(ParallelForBatchesRespectMinimumSize)
+{
+    constexpr int32 Num = 1000;
+    constexpr int32 MinBatchSize = 64;
+
+    std::atomic<int32> NumSmallBatches = 0;
+    FJobSystem::Get().ParallelFor(Num, MinBatchSize, [&NumSmallBatches](int32 Begin, int32 End, int32)
+    {
+        // 마지막 묶음만 MinBatchSize보다 작을 수 있습니다.
+        if (End - Begin < MinBatchSize && End != Num)
+        {
+            NumSmallBatches.fetch_add(1);
+        }
+    });
+    CHECK(NumSmallBatches.load() == 0);
+}
+
+TEST_CASE(ParallelForThreadIndicesAreWithinConcurrency)
+{
+    for (const int32 MaxConcurrency : { 0, 1, 2 })
+    {
+        const int32 Limit = MaxConcurrency > 0 ? MaxConcurrency : FJobSystem::Get().GetMaxConcurrency();
+
+        std::mutex Mutex;
+        std::set<int32> ThreadIndices;
+        FJobSystem::Get().ParallelFor(50000, 1, [&](int32, int32, int32 ThreadIndex)
+        {
+            std::lock_guard Lock(Mutex);
+            ThreadIndices.insert(ThreadIndex);
+        }, MaxConcurrency);
+
+        CHECK(!ThreadIndices.empty());
+        CHECK(*ThreadIndices.begin() >= 0);
+        CHECK(*ThreadIndices.rbegin() < Limit);
+    }
+}
+
+TEST_CASE(ParallelForCanBeCalledFromWorkerJob)
+{
+    // 모든 Worker가 ParallelFor를 호출하는 Job을 실행 중이어도, 호출한 스레드가 묶음을 직접 실행하므로 끝나야 합니다.
+    const int32 NumJobs = FJobSystem::Get().GetNumWorkers() * 2;
+    std::atomic<int64> Sum = 0;
+    std::atomic<int32> NumDone = 0;
+    for (int32 Job = 0; Job < NumJobs; ++Job)
+    {
+        FJobSystem::Get().Dispatch([&Sum, &NumDone]
+        {
+            FJobSystem::Get().ParallelFor(10000, 8, [&Sum](int32 Begin, int32 End, int32)
+            {
+                int64 Partial = 0;
+                for (int32 Index = Begin; Index < End; ++Index)
+                {
+                    Partial += Index;
+                }
+                Sum.fetch_add(Partial);
+            });
+            NumDone.fetch_add(1);
+        });
+    }
+
+    while (NumDone.load() < NumJobs)
+    {
+        std::this_thread::yield();
+    }
+    CHECK(Sum.load() == static_cast<int64>(NumJobs) * (10000LL * 9999 / 2));
+}
+
+TEST_CASE(ShutdownStopsWorkers)
+{
+    // 엔진처럼 종료 전에 Worker를 멈춥니다. 이후의 ParallelFor는 호출한 스레드에서만 실행됩니다.
+    FJobSystem::Get().Shutdown();
+    CHECK(FJobSystem::Get().GetNumWorkers() == 0);
+
+    int32 NumCalls = 0;
+    FJobSystem::Get().ParallelFor(1000, 1, [&NumCalls](int32 Begin, int32 End, int32 ThreadIndex)
+    {
+        CHECK(Begin == 0 && End == 1000 && ThreadIndex == 0);
+        ++NumCalls;
+    });
+    CHECK(NumCalls == 1);
+}
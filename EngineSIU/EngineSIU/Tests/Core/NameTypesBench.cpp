@@ -0,0 +1,78 @@
+#include "BenchHarness.h"
+#include <thread>
+#include <vector>
+#include "UObject/NameTypes.h"
+
+
+/**
+ * 여러 스레드가 동시에 FName을 만드는 경합 벤치마크. 스레드마다 100000개를 만들며,
+ * 절반은 스레드끼리 겹치는 5000가지 이름 중 하나, 나머지 절반은 스레드마다 새로운 이름입니다.
+ * 인자로 스레드 수 목록의 최댓값을 넘길 수 있습니다.
+ */
+int main(int Argc, char** Argv)
+{
+    constexpr int32 NamesPerThread = 100000;
+    constexpr int32 NumSharedNames = 5000;
+
+    const int32 MaxThreads = BenchHarness::GetIntArgument(Argc, Argv, 1, 8);
+
+    std::printf("FName creation, %d names per thread\n", NamesPerThread);
+    std::printf("  %8s %10s %14s %12s\n", "threads", "ms", "FNames/s", "new entries");
+
+    bool bEntriesMatch = true;
+    int32 Run = 0;
+    for (int32 NumThreads = 1; NumThreads <= MaxThreads; NumThreads *= 2, ++Run)
+    {
+        const FNamePoolStats StatsBefore = FName::GetPoolStats();
+
+        // 실행할 때마다 새 이름이 만들어지도록 접두사에 실행 번호를 붙입니다.
+        const double ElapsedMs = BenchHarness::MeasureBestMs(1, [Run, NumThreads]
+        {
+            std::vector<std::thread> Threads;
+            for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+            {
+                Threads.emplace_back([Run, ThreadIndex]
+                {
+                    char Buffer[64];
+                    for (int32 i = 0; i < NamesPerThread; ++i)
+                    {
+                        if (i & 1)
+                        {
+                            std::snprintf(Buffer, sizeof(Buffer), "NameBench%d_Shared_%d", Run, i % NumSharedNames);
+                        }
+                        else
+                        {
+                            std::snprintf(Buffer, sizeof(Buffer), "NameBench%d_T%d_%d", Run, ThreadIndex, i);
+                        }
+                        FName Name(Buffer);
+                    }
+                });
+            }
+            for (std::thread& Thread : Threads)
+            {
+                Thread.join();
+            }
+        });
+
+        // 홀수 i만 공유 이름을 쓰므로 공유 이름은 NumSharedNames / 2가지입니다.
+        const int32 NumConstructed = NumThreads * NamesPerThread;
+        const uint32 NumNewEntries = FName::GetPoolStats().NumEntries - StatsBefore.NumEntries;
+        bEntriesMatch &= NumNewEntries == static_cast<uint32>(NumConstructed / 2 + NumSharedNames / 2);
+
+        std::printf("  %8d %10.3f %14.0f %12u\n", NumThreads, ElapsedMs, ElapsedMs > 0.0 ? NumConstructed * 1000.0 / ElapsedMs : 0.0, NumNewEntries);
+    }
+
+    const FNamePoolStats Stats = FName::GetPoolStats();
+    std::printf("Pool: %u names, %.1f B/name in arena, %.1f B/name in hash index\n",
+        Stats.NumEntries,
+        static_cast<double>(Stats.EntryBytes) / Stats.NumEntries,
+        static_cast<double>(Stats.IndexBytes) / Stats.NumEntries
+    );
+
+    if (!bEntriesMatch)
+    {
+        std::printf("Unexpected number of new pool entries\n");
+        return 1;
+    }
+    return 0;
+}
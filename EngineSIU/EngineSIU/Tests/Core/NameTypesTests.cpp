@@ -0,0 +1,247 @@
+#include "TestHarness.h"
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Container/String.h"
+#include "UObject/NameTypes.h"
+
+
+namespace
+{
+    /** 다른 테스트가 만든 이름과 겹치지 않도록 Prefix를 붙인 이름을 만듭니다. */
+    std::string MakeName(const char* Prefix, int32 Index)
+    {
+        char Buffer[64];
+        std::snprintf(Buffer, sizeof(Buffer), "%s_%d", Prefix, Index);
+        return Buffer;
+    }
+
+    /** Index 비트마다 한 글자씩 대소문자를 바꿉니다. 영문자만 바꾸므로 대소문자를 무시하면 모두 같은 이름입니다. */
+    std::string MakeCaseVariant(std::string Name, int32 Variant)
+    {
+        int32 Bit = 0;
+        for (char& Char : Name)
+        {
+            if (Char >= 'a' && Char <= 'z' && (Variant >> Bit++ & 1))
+            {
+                Char = static_cast<char>(Char - 'a' + 'A');
+            }
+        }
+        return Name;
+    }
+
+    void RunThreads(int32 NumThreads, const std::function<void(int32)>& Body)
+    {
+        std::vector<std::thread> Threads;
+        for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+        {
+            Threads.emplace_back(Body, ThreadIndex);
+        }
+        for (std::thread& Thread : Threads)
+        {
+            Thread.join();
+        }
+    }
+}
+
+
+TEST_CASE(NoneIsEntryZero)
+{
+    const FName Default;
+    CHECK(Default == NAME_None);
+    CHECK(FName(NAME_None) == NAME_None);
+    CHECK(Default.GetDisplayIndex() == 0 && Default.GetComparisonIndex() == 0);
+    CHECK(Default.ToStringView() == "None");
+
+    // "None" 문자열은 미리 등록된 0번 Entry를 그대로 씁니다.
+    const FName FromString("None");
+    CHECK(FromString == NAME_None);
+    CHECK(FromString.GetDisplayIndex() == 0);
+
+    // 대소문자만 다르면 표시용 Entry는 따로 생기지만 비교하면 None입니다.
+    const FName Lower("none");
+    CHECK(Lower == NAME_None);
+    CHECK(Lower.GetDisplayIndex() != 0);
+    CHECK(Lower.ToStringView() == "none");
+
+    // 빈 문자열은 None이 아닙니다.
+    CHECK(FName("") != NAME_None);
+    CHECK(FName("").ToStringView().empty());
+}
+
+TEST_CASE(TooLongNamesBecomeNone)
+{
+    const std::string Long(NAME_SIZE, 'a');
+    CHECK(FName(Long.c_str()) == NAME_None);
+
+    const std::string Longest(NAME_SIZE - 1, 'b');
+    const FName Name(Longest.c_str());
+    CHECK(Name != NAME_None);
+    CHECK(Name.ToStringView() == Longest);
+}
+
+TEST_CASE(SameStringGivesSameIndices)
+{
+    const FName A("NameTypesTests_Same");
+    const FName B("NameTypesTests_Same");
+    CHECK(A == B);
+    CHECK(A.GetDisplayIndex() == B.GetDisplayIndex());
+    CHECK(A.GetComparisonIndex() == B.GetComparisonIndex());
+    CHECK(A.GetComparisonIndex() == A.GetDisplayIndex());
+    CHECK(A.ToStringView().data() == B.ToStringView().data());
+    CHECK(A.ToString() == FString(TEXT("NameTypesTests_Same")));
+
+    // 문자열 종류와 관계없이 같은 Entry를 찾습니다.
+    CHECK(FName(L"NameTypesTests_Same").GetDisplayIndex() == A.GetDisplayIndex());
+    CHECK(FName(FString(TEXT("NameTypesTests_Same"))).GetDisplayIndex() == A.GetDisplayIndex());
+
+    CHECK(FName("NameTypesTests_Other") != A);
+}
+
+TEST_CASE(ComparisonIgnoresCaseButDisplayKeepsIt)
+{
+    const FNamePoolStats Before = FName::GetPoolStats();
+
+    const FName First("NameTypesTests_Case");
+    const FName Upper("NAMETYPESTESTS_CASE");
+    const FName Lower("nametypestests_case");
+    CHECK(First == Upper && Upper == Lower);
+    CHECK(First.GetComparisonIndex() == Upper.GetComparisonIndex());
+    CHECK(First.GetComparisonIndex() == Lower.GetComparisonIndex());
+    CHECK(std::hash<FName>()(First) == std::hash<FName>()(Upper));
+
+    // 비교 Id는 처음 등록된 표기의 Entry이고, 표시 문자열은 만든 그대로입니다.
+    CHECK(Upper.GetComparisonIndex() == First.GetDisplayIndex());
+    CHECK(Upper.GetDisplayIndex() != First.GetDisplayIndex());
+    CHECK(Upper.ToStringView() == "NAMETYPESTESTS_CASE");
+    CHECK(Lower.ToStringView() == "nametypestests_case");
+
+    // 표기마다 Entry가 하나씩 생기고, 이미 있는 표기는 다시 만들지 않습니다.
+    FName Again("NAMETYPESTESTS_CASE");
+    CHECK(Again.GetDisplayIndex() == Upper.GetDisplayIndex());
+    CHECK(FName::GetPoolStats().NumEntries - Before.NumEntries == 3);
+}
+
+TEST_CASE(ConcurrentStoreOfSameStringsAgreesOnIndices)
+{
+    constexpr int32 NumThreads = 8;
+    constexpr int32 NumNames = 5000;
+
+    const FNamePoolStats Before = FName::GetPoolStats();
+
+    // 모든 스레드가 같은 이름들을 서로 다른 순서로 동시에 만듭니다.
+    std::vector<std::vector<FName>> Results(NumThreads, std::vector<FName>(NumNames));
+    RunThreads(NumThreads, [&Results](int32 ThreadIndex)
+    {
+        for (int32 Step = 0; Step < NumNames; ++Step)
+        {
+            const int32 Index = (Step * 7 + ThreadIndex * 613) % NumNames;
+            Results[ThreadIndex][Index] = FName(MakeName("NameTypesTests_Shared", Index).c_str());
+        }
+    });
+
+    bool bSameIndices = true;
+    bool bRoundTrips = true;
+    for (int32 Index = 0; Index < NumNames; ++Index)
+    {
+        const FName& Expected = Results[0][Index];
+        for (int32 ThreadIndex = 1; ThreadIndex < NumThreads; ++ThreadIndex)
+        {
+            const FName& Name = Results[ThreadIndex][Index];
+            bSameIndices &= Name.GetDisplayIndex() == Expected.GetDisplayIndex();
+            bSameIndices &= Name.GetComparisonIndex() == Expected.GetComparisonIndex();
+        }
+        bRoundTrips &= Expected.ToStringView() == MakeName("NameTypesTests_Shared", Index);
+    }
+    CHECK(bSameIndices);
+    CHECK(bRoundTrips);
+
+    // 같은 문자열은 스레드 수와 관계없이 한 번만 저장됩니다.
+    CHECK(FName::GetPoolStats().NumEntries - Before.NumEntries == NumNames);
+}
+
+TEST_CASE(ConcurrentStoreOfCaseVariantsSharesComparisonIndex)
+{
+    constexpr int32 NumThreads = 8;
+    constexpr int32 NumNames = 2000;
+
+    const FNamePoolStats Before = FName::GetPoolStats();
+
+    // 스레드마다 다른 표기로 같은 이름을 만들어 비교 Entry 등록이 경합하게 합니다.
+    std::vector<std::vector<FName>> Results(NumThreads, std::vector<FName>(NumNames));
+    RunThreads(NumThreads, [&Results](int32 ThreadIndex)
+    {
+        for (int32 Index = 0; Index < NumNames; ++Index)
+        {
+            Results[ThreadIndex][Index] = FName(MakeCaseVariant(MakeName("nametypestests_variant", Index), ThreadIndex).c_str());
+        }
+    });
+
+    bool bSameComparison = true;
+    bool bComparisonIsAVariant = true;
+    bool bDistinctDisplay = true;
+    for (int32 Index = 0; Index < NumNames; ++Index)
+    {
+        const uint32 ComparisonIndex = Results[0][Index].GetComparisonIndex();
+        bool bFoundOwner = false;
+        for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+        {
+            const FName& Name = Results[ThreadIndex][Index];
+            bSameComparison &= Name.GetComparisonIndex() == ComparisonIndex && Name == Results[0][Index];
+            bFoundOwner |= Name.GetDisplayIndex() == ComparisonIndex;
+            bDistinctDisplay &= Name.ToStringView() == MakeCaseVariant(MakeName("nametypestests_variant", Index), ThreadIndex);
+            for (int32 Other = 0; Other < ThreadIndex; ++Other)
+            {
+                bDistinctDisplay &= Name.GetDisplayIndex() != Results[Other][Index].GetDisplayIndex();
+            }
+        }
+        bComparisonIsAVariant &= bFoundOwner;
+    }
+    CHECK(bSameComparison);
+    CHECK(bComparisonIsAVariant);
+    CHECK(bDistinctDisplay);
+    CHECK(FName::GetPoolStats().NumEntries - Before.NumEntries == NumThreads * NumNames);
+}
+
+TEST_CASE(ConcurrentStoreOfDifferentStringsKeepsEveryEntry)
+{
+    constexpr int32 NumThreads = 8;
+    constexpr int32 NamesPerThread = 20000;
+
+    const FNamePoolStats Before = FName::GetPoolStats();
+
+    // Hash Index와 Arena가 여러 번 커지도록 스레드마다 새 이름을 많이 만듭니다.
+    std::vector<std::vector<FName>> Results(NumThreads, std::vector<FName>(NamesPerThread));
+    RunThreads(NumThreads, [&Results](int32 ThreadIndex)
+    {
+        char Prefix[32];
+        std::snprintf(Prefix, sizeof(Prefix), "NameTypesTests_T%d", ThreadIndex);
+        for (int32 Index = 0; Index < NamesPerThread; ++Index)
+        {
+            Results[ThreadIndex][Index] = FName(MakeName(Prefix, Index).c_str());
+        }
+    });
+
+    const FNamePoolStats After = FName::GetPoolStats();
+    CHECK(After.NumEntries - Before.NumEntries == NumThreads * NamesPerThread);
+    CHECK(After.EntryBytes > Before.EntryBytes && After.ArenaBytes >= After.EntryBytes);
+
+    // 다 만든 뒤에 다시 찾아도 같은 Entry이고, 문자열도 그대로입니다.
+    bool bStable = true;
+    for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+    {
+        char Prefix[32];
+        std::snprintf(Prefix, sizeof(Prefix), "NameTypesTests_T%d", ThreadIndex);
+        for (int32 Index = 0; Index < NamesPerThread; ++Index)
+        {
+            const std::string Expected = MakeName(Prefix, Index);
+            const FName& Name = Results[ThreadIndex][Index];
+            bStable &= Name.ToStringView() == Expected;
+            bStable &= FName(Expected.c_str()).GetDisplayIndex() == Name.GetDisplayIndex();
+        }
+    }
+    CHECK(bStable);
+    CHECK(FName::GetPoolStats().NumEntries == After.NumEntries);
+}
@@ -0,0 +1,312 @@
+#include "TestHarness.h"
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include "JSON/json.hpp"
+#include "HAL/PlatformTime.h"
+#include "Stats/StatsData.h"
+
+
+namespace
+{
+    void Spin(int Microseconds)
+    {
+        const auto Start = std::chrono::steady_clock::now();
+        while (std::chrono::steady_clock::now() - Start < std::chrono::microseconds(Microseconds))
+        {
+        }
+    }
+
+    void Leaf()
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(TestLeaf);
+        Spin(20);
+    }
+
+    void Recurse(int Depth)
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(TestRecurse);
+        Spin(10);
+        if (Depth > 0)
+        {
+            Recurse(Depth - 1);
+        }
+    }
+
+    void RunFrame()
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(TestFrame);
+        {
+            QUICK_SCOPE_CYCLE_COUNTER(TestTick);
+            Leaf();
+            Leaf();
+        }
+        {
+            QUICK_SCOPE_CYCLE_COUNTER(TestRender);
+            Leaf();
+            Recurse(2);
+        }
+    }
+
+    const FStatThreadTree* FindMainThreadTree()
+    {
+        const FStatsThreadState& State = FStatsThreadState::Get();
+        for (const FStatThreadTree& Tree : State.GetLastFrameTrees())
+        {
+            if (Tree.ThreadIndex == State.GetMainThreadIndex())
+            {
+                return &Tree;
+            }
+        }
+        return nullptr;
+    }
+
+    int32 FindChild(const FStatThreadTree& Tree, int32 Parent, const char* StatName)
+    {
+        for (int32 Child = Tree.Nodes[Parent].FirstChild; Child != INDEX_NONE; Child = Tree.Nodes[Child].NextSibling)
+        {
+            if (FStatRegistry::GetStatName(Tree.Nodes[Child].StatIndex) == FName(StatName))
+            {
+                return Child;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    const FStatSummary* FindSummary(const TArray<FStatSummary>& Summaries, const char* StatName)
+    {
+        for (const FStatSummary& Summary : Summaries)
+        {
+            if (Summary.Name == FName(StatName))
+            {
+                return &Summary;
+            }
+        }
+        return nullptr;
+    }
+}
+
+
+TEST_CASE(StatRegistryReturnsSameIndexForSameName)
+{
+    const uint32 First = FStatRegistry::Register(FName("TestRegistry"));
+    const uint32 Second = FStatRegistry::Register(FName("TestRegistry"));
+    CHECK(First == Second);
+    CHECK(FStatRegistry::GetStatName(First) == FName("TestRegistry"));
+    CHECK(FStatRegistry::Register(FName("TestRegistryOther")) != First);
+}
+
+TEST_CASE(NestedScopesBuildCallTree)
+{
+    FStatsThreadState& State = FStatsThreadState::Get();
+    State.AdvanceFrame();
+
+    RunFrame();
+    State.AdvanceFrame();
+
+    const FStatThreadTree* Tree = FindMainThreadTree();
+    CHECK(Tree != nullptr);
+    if (!Tree)
+    {
+        return;
+    }
+
+    const int32 Frame = FindChild(*Tree, 0, "TestFrame");
+    CHECK(Frame != INDEX_NONE);
+    if (Frame == INDEX_NONE)
+    {
+        return;
+    }
+    CHECK(Tree->Nodes[Frame].Depth == 1);
+    CHECK(Tree->Nodes[Frame].CallCount == 1);
+
+    const int32 Tick = FindChild(*Tree, Frame, "TestTick");
+    const int32 Render = FindChild(*Tree, Frame, "TestRender");
+    CHECK(Tick != INDEX_NONE && Render != INDEX_NONE);
+    if (Tick == INDEX_NONE || Render == INDEX_NONE)
+    {
+        return;
+    }
+
+    // 같은 부모 아래에서 두 번 호출된 Leaf는 노드 하나로 합쳐집니다.
+    const int32 TickLeaf = FindChild(*Tree, Tick, "TestLeaf");
+    CHECK(TickLeaf != INDEX_NONE && Tree->Nodes[TickLeaf].CallCount == 2);
+    CHECK(FindChild(*Tree, Render, "TestLeaf") != INDEX_NONE);
+
+    // 재귀 호출은 깊이마다 자식 노드가 생깁니다.
+    int32 RecurseNode = FindChild(*Tree, Render, "TestRecurse");
+    int32 RecurseDepth = 0;
+    while (RecurseNode != INDEX_NONE)
+    {
+        ++RecurseDepth;
+        RecurseNode = FindChild(*Tree, RecurseNode, "TestRecurse");
+    }
+    CHECK(RecurseDepth == 3);
+
+    // 부모의 시간은 자식 시간의 합보다 작을 수 없습니다.
+    CHECK(Tree->Nodes[Frame].InclusiveCycles >= Tree->Nodes[Tick].InclusiveCycles + Tree->Nodes[Render].InclusiveCycles);
+    CHECK(Tree->Nodes[Tick].InclusiveCycles >= Tree->Nodes[TickLeaf].InclusiveCycles);
+}
+
+TEST_CASE(RecursiveStatIsCountedOncePerFrame)
+{
+    FStatsThreadState& State = FStatsThreadState::Get();
+    State.AdvanceFrame();
+
+    RunFrame();
+    State.AdvanceFrame();
+
+    TArray<FStatSummary> Summaries;
+    State.GetSummaries(Summaries);
+
+    const FStatSummary* Frame = FindSummary(Summaries, "TestFrame");
+    const FStatSummary* Render = FindSummary(Summaries, "TestRender");
+    const FStatSummary* Recursion = FindSummary(Summaries, "TestRecurse");
+    CHECK(Frame && Render && Recursion);
+    if (!Frame || !Render || !Recursion)
+    {
+        return;
+    }
+
+    CHECK(Recursion->LastCallCount == 3);
+    // 안쪽 재귀 호출의 시간을 다시 더하면 Render보다 길어집니다.
+    CHECK(Recursion->LastMs <= Render->LastMs);
+    CHECK(Render->LastMs <= Frame->LastMs);
+    CHECK(Frame->MinMs <= Frame->AvgMs && Frame->AvgMs <= Frame->MaxMs);
+}
+
+TEST_CASE(OpenScopeCarriesOverFrameBoundary)
+{
+    FStatsThreadState& State = FStatsThreadState::Get();
+    State.AdvanceFrame();
+
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(TestLongScope);
+        Spin(200);
+        State.AdvanceFrame();
+
+        // 끝나지 않은 Scope도 프레임 경계까지의 시간이 기록됩니다.
+        const FStatThreadTree* Tree = FindMainThreadTree();
+        CHECK(Tree != nullptr);
+        if (Tree)
+        {
+            const int32 Node = FindChild(*Tree, 0, "TestLongScope");
+            CHECK(Node != INDEX_NONE);
+            CHECK(Node != INDEX_NONE && Tree->Nodes[Node].CallCount == 0);
+            CHECK(Node != INDEX_NONE && FPlatformTime::ToMilliseconds(Tree->Nodes[Node].InclusiveCycles) >= 0.2);
+        }
+
+        Leaf();
+        Spin(100);
+    }
+    State.AdvanceFrame();
+
+    // 다음 프레임에는 같은 Scope 아래에 이어서 기록됩니다.
+    const FStatThreadTree* Tree = FindMainThreadTree();
+    CHECK(Tree != nullptr);
+    if (Tree)
+    {
+        const int32 Node = FindChild(*Tree, 0, "TestLongScope");
+        CHECK(Node != INDEX_NONE);
+        CHECK(Node != INDEX_NONE && Tree->Nodes[Node].CallCount == 1);
+        CHECK(Node != INDEX_NONE && FindChild(*Tree, Node, "TestLeaf") != INDEX_NONE);
+    }
+}
+
+TEST_CASE(WorkerThreadsGetTheirOwnTree)
+{
+    FStatsThreadState& State = FStatsThreadState::Get();
+    State.AdvanceFrame();
+
+    std::thread Worker([]
+    {
+        for (int Index = 0; Index < 4; ++Index)
+        {
+            QUICK_SCOPE_CYCLE_COUNTER(TestWorkerJob);
+            Leaf();
+        }
+    });
+    Worker.join();
+    State.AdvanceFrame();
+
+    bool bFoundWorkerTree = false;
+    for (const FStatThreadTree& Tree : State.GetLastFrameTrees())
+    {
+        const int32 Job = FindChild(Tree, 0, "TestWorkerJob");
+        if (Job != INDEX_NONE)
+        {
+            bFoundWorkerTree = true;
+            CHECK(Tree.ThreadIndex != State.GetMainThreadIndex());
+            CHECK(Tree.Nodes[Job].CallCount == 4);
+        }
+    }
+    CHECK(bFoundWorkerTree);
+}
+
+TEST_CASE(TraceExportIsValidChromeTraceJson)
+{
+    FStatsThreadState& State = FStatsThreadState::Get();
+    State.AdvanceFrame();
+
+    State.StartTraceCapture();
+    constexpr int NumFrames = 3;
+    for (int Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        RunFrame();
+        State.AdvanceFrame();
+    }
+    CHECK(State.IsCapturingTrace());
+
+    const nlohmann::json Trace = nlohmann::json::parse(State.ExportTraceJson(), nullptr, false);
+    CHECK(!Trace.is_discarded());
+    if (Trace.is_discarded())
+    {
+        return;
+    }
+
+    CHECK(Trace["displayTimeUnit"] == "ms");
+    CHECK(Trace["traceEvents"].is_array());
+
+    int NumFrameEvents = 0;
+    int NumLeafEvents = 0;
+    bool bHasMainThreadName = false;
+    for (const nlohmann::json& Event : Trace["traceEvents"])
+    {
+        if (Event["ph"] == "M")
+        {
+            bHasMainThreadName |= Event["args"]["name"].get<std::string>().rfind("MainThread", 0) == 0;
+            continue;
+        }
+
+        CHECK(Event["ph"] == "X");
+        CHECK(Event["ts"].get<double>() >= 0.0);
+        CHECK(Event["dur"].get<double>() >= 0.0);
+
+        const std::string Name = Event["name"].get<std::string>();
+        NumFrameEvents += Name == "TestFrame";
+        NumLeafEvents += Name == "TestLeaf";
+    }
+
+    CHECK(bHasMainThreadName);
+    CHECK(NumFrameEvents == NumFrames);
+    CHECK(NumLeafEvents == NumFrames * 3);
+}
+
+TEST_CASE(TraceCaptureWritesFile)
+{
+    FStatsThreadState& State = FStatsThreadState::Get();
+    State.StartTraceCapture();
+    RunFrame();
+    State.AdvanceFrame();
+
+    const std::string Path = (std::filesystem::temp_directory_path() / "EngineSIUStatsTests" / "Trace.json").string();
+    CHECK(State.StopTraceCapture(FString(Path)));
+    CHECK(!State.IsCapturingTrace());
+
+    std::ifstream File(Path);
+    CHECK(File.is_open());
+    CHECK(!nlohmann::json::parse(File, nullptr, false).is_discarded());
+}
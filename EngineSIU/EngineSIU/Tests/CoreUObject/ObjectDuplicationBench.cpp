@@ -0,0 +1,157 @@
+#include "BenchHarness.h"
+#include "UObject/ObjectDuplication.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/ObjectMacros.h"
+
+
+namespace
+{
+    class UBenchComponent : public UObject
+    {
+        DECLARE_CLASS(UBenchComponent, UObject)
+
+    public:
+        UBenchComponent() = default;
+
+        UPROPERTY
+        (FVector, RelativeLocation)
+
+        UPROPERTY
+        (FRotator, RelativeRotation)
+
+        UPROPERTY
+        (FVector, RelativeScale3D, = FVector(1.0f, 1.0f, 1.0f))
+
+        UPROPERTY
+        (UObject*, AttachParent, = nullptr)
+    };
+
+    /** AStaticMeshActor처럼 생성자에서 Root를 만들고, 나머지 컴포넌트는 DuplicateFrom에서 함께 복제합니다. */
+    class UBenchActor : public UObject
+    {
+        DECLARE_CLASS(UBenchActor, UObject)
+
+    public:
+        UBenchActor()
+        {
+            Root = FObjectFactory::ConstructObject<UBenchComponent>(this);
+            Components.Add(Root);
+        }
+
+        virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) override
+        {
+            const UBenchActor* SourceActor = static_cast<const UBenchActor*>(Source);
+            Duplicator.DuplicateInto(SourceActor->Root, Root);
+            for (UObject* Component : SourceActor->Components)
+            {
+                Duplicator.DuplicateObject(Component, this);
+            }
+        }
+
+        UPROPERTY
+        (UBenchComponent*, Root, = nullptr)
+
+        UPROPERTY
+        (TArray<UObject*>, Components)
+    };
+
+    class UBenchWorld : public UObject
+    {
+        DECLARE_CLASS(UBenchWorld, UObject)
+
+    public:
+        UBenchWorld() = default;
+
+        virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) override
+        {
+            const TArray<UObject*>& SourceActors = static_cast<const UBenchWorld*>(Source)->Actors;
+            Duplicator.Reserve(SourceActors.Num() * 3);
+            for (UObject* Actor : SourceActors)
+            {
+                Duplicator.DuplicateObject(Actor, this);
+            }
+        }
+
+        UPROPERTY
+        (TArray<UObject*>, Actors)
+    };
+
+    void DestroyWorld(UBenchWorld* World)
+    {
+        for (UObject* Actor : World->Actors)
+        {
+            for (UObject* Component : static_cast<UBenchActor*>(Actor)->Components)
+            {
+                GUObjectArray.MarkRemoveObject(Component);
+            }
+            GUObjectArray.MarkRemoveObject(Actor);
+        }
+        GUObjectArray.MarkRemoveObject(World);
+        GUObjectArray.ProcessPendingDestroyObjects();
+    }
+}
+
+
+/**
+ * PIE에 들어갈 때처럼 World 전체를 복제합니다. 콘솔의 "dup bench"가 에디터 World로 재던 것을
+ * UWorld, AStaticMeshActor와 같은 모양의 테스트 클래스로 옮겼습니다. Actor마다 생성자가 만든 Root와 거기 붙은 자식 컴포넌트가 있습니다.
+ * 인자로 Actor 수를 넘길 수 있습니다.
+ */
+int main(int Argc, char** Argv)
+{
+    const int32 NumActors = BenchHarness::GetIntArgument(Argc, Argv, 1, 20000);
+    constexpr int32 NumRuns = 5;
+
+    UBenchWorld* SourceWorld = FObjectFactory::ConstructObject<UBenchWorld>(nullptr);
+    for (int32 Index = 0; Index < NumActors; ++Index)
+    {
+        UBenchActor* Actor = FObjectFactory::ConstructObject<UBenchActor>(SourceWorld);
+        Actor->Root->RelativeLocation = FVector(static_cast<float>(Index % 100), static_cast<float>(Index / 100), 0.0f);
+
+        UBenchComponent* Child = FObjectFactory::ConstructObject<UBenchComponent>(Actor);
+        Child->AttachParent = Actor->Root;
+        Actor->Components.Add(Child);
+
+        SourceWorld->Actors.Add(Actor);
+    }
+
+    // 복제한 World를 지우는 시간은 빼야 하므로 MeasureBestMs 대신 복제만 잽니다.
+    int32 NumObjects = 0;
+    bool bValid = true;
+    double MinMs = 0.0;
+    double TotalMs = 0.0;
+    for (int32 Run = 0; Run < NumRuns; ++Run)
+    {
+        const int32 NumObjectsBefore = GUObjectArray.GetObjectItemArrayUnsafe().Num();
+        const auto Start = std::chrono::steady_clock::now();
+        UBenchWorld* NewWorld = static_cast<UBenchWorld*>(SourceWorld->Duplicate(nullptr));
+        const double Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+        NumObjects = GUObjectArray.GetObjectItemArrayUnsafe().Num() - NumObjectsBefore;
+
+        MinMs = Run == 0 || Ms < MinMs ? Ms : MinMs;
+        TotalMs += Ms;
+
+        // 복제된 Actor의 컴포넌트가 원본이 아니라 새 컴포넌트를 가리키는지 확인합니다.
+        for (UObject* Object : NewWorld->Actors)
+        {
+            const UBenchActor* Actor = static_cast<UBenchActor*>(Object);
+            bValid &= Actor->Components.Num() == 2 && Actor->Components[0] == Actor->Root
+                && Actor->Root->GetOuter() == Actor && Actor->Components[1]->GetOuter() == Actor
+                && static_cast<UBenchComponent*>(Actor->Components[1])->AttachParent == Actor->Root;
+        }
+
+        DestroyWorld(NewWorld);
+    }
+
+    DestroyWorld(SourceWorld);
+
+    std::printf("World duplication, %d actors, %d objects per world, %d runs\n", NumActors, NumObjects, NumRuns);
+    std::printf("  min %.3f ms, avg %.3f ms (%.0f objects/s)\n", MinMs, TotalMs / NumRuns, MinMs > 0.0 ? NumObjects * 1000.0 / MinMs : 0.0);
+
+    if (!bValid)
+    {
+        std::printf("Duplicated actors still reference the source components\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,294 @@
+#include "TestHarness.h"
+#include <vector>
+#include "UObject/ObjectDuplication.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/ObjectMacros.h"
+
+
+namespace
+{
+    /** PostDuplicate가 불린 순서 */
+    std::vector<UObject*> GPostDuplicateOrder;
+
+    /** 복제하지 않는 Object. Static Mesh 같은 Asset 역할입니다. */
+    class UDupTestAsset : public UObject
+    {
+        DECLARE_CLASS(UDupTestAsset, UObject)
+
+    public:
+        UDupTestAsset() = default;
+    };
+
+    class UDupTestComponent : public UObject
+    {
+        DECLARE_CLASS(UDupTestComponent, UObject)
+
+    public:
+        UDupTestComponent() = default;
+
+        virtual void PostDuplicate() override
+        {
+            GPostDuplicateOrder.push_back(this);
+        }
+
+        UPROPERTY
+        (FVector, Location)
+
+        UPROPERTY
+        (UObject*, AttachParent, = nullptr)
+
+        UPROPERTY
+        (UObject*, Asset, = nullptr)
+
+        UPROPERTY_WITH_FLAGS
+        (CPF_DuplicateTransient, int32, CachedIndex, = -1)
+    };
+
+    /**
+     * AActor처럼 생성자에서 Root를 만들고, 나머지 컴포넌트는 DuplicateFrom에서 함께 복제합니다.
+     * 복제할 때 생성자가 만든 Root는 DuplicateInto로 재사용합니다.
+     */
+    class UDupTestActor : public UObject
+    {
+        DECLARE_CLASS(UDupTestActor, UObject)
+
+    public:
+        UDupTestActor()
+        {
+            Root = FObjectFactory::ConstructObject<UDupTestComponent>(this);
+            Components.Add(Root);
+        }
+
+        UDupTestComponent* AddComponent()
+        {
+            UDupTestComponent* Component = FObjectFactory::ConstructObject<UDupTestComponent>(this);
+            Component->AttachParent = Root;
+            Components.Add(Component);
+            return Component;
+        }
+
+        virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) override
+        {
+            const UDupTestActor* SourceActor = static_cast<const UDupTestActor*>(Source);
+            Duplicator.DuplicateInto(SourceActor->Root, Root);
+            for (UObject* Component : SourceActor->Components)
+            {
+                Duplicator.DuplicateObject(Component, this);
+            }
+        }
+
+        virtual void PostDuplicate() override
+        {
+            GPostDuplicateOrder.push_back(this);
+
+            // 모든 참조가 채워지고 Object가 등록된 뒤에 불립니다.
+            bReferencesReadyInPostDuplicate = Components.Num() > 0 && Components[0] == Root;
+            for (UObject* Component : Components)
+            {
+                bReferencesReadyInPostDuplicate &= Component->GetOuter() == this
+                    && (static_cast<UDupTestComponent*>(Component)->AttachParent != nullptr) == (Component != Root)
+                    && UDupTestComponent::StaticClass()->GetClassObjects().Contains(Component);
+            }
+            bReferencesReadyInPostDuplicate &= GetClass()->GetClassObjects().Contains(this);
+        }
+
+        UPROPERTY
+        (UDupTestComponent*, Root, = nullptr)
+
+        UPROPERTY
+        (TArray<UObject*>, Components)
+
+        UPROPERTY
+        (UObject*, Partner, = nullptr)
+
+        bool bReferencesReadyInPostDuplicate = false;
+    };
+
+    /** ULevel처럼 Actor 목록을 가지고, 복제할 때 Actor를 함께 복제합니다. */
+    class UDupTestWorld : public UObject
+    {
+        DECLARE_CLASS(UDupTestWorld, UObject)
+
+    public:
+        UDupTestWorld() = default;
+
+        virtual void DuplicateFrom(const UObject* Source, FObjectDuplicator& Duplicator) override
+        {
+            for (UObject* Actor : static_cast<const UDupTestWorld*>(Source)->Actors)
+            {
+                Duplicator.DuplicateObject(Actor, this);
+            }
+        }
+
+        virtual void PostDuplicate() override
+        {
+            GPostDuplicateOrder.push_back(this);
+        }
+
+        UPROPERTY
+        (TArray<UObject*>, Actors)
+    };
+
+    /** 각 Actor는 Root와 자식 컴포넌트 하나를 가지며, 두 번째 Actor부터는 앞 Actor를 Partner로 가리킵니다. */
+    UDupTestWorld* MakeWorld(int32 NumActors, UDupTestAsset* Asset)
+    {
+        UDupTestWorld* World = FObjectFactory::ConstructObject<UDupTestWorld>(nullptr);
+        for (int32 Index = 0; Index < NumActors; ++Index)
+        {
+            UDupTestActor* Actor = FObjectFactory::ConstructObject<UDupTestActor>(World);
+            Actor->Root->Location = FVector(static_cast<float>(Index), 0.0f, 0.0f);
+            Actor->Root->CachedIndex = Index;
+
+            UDupTestComponent* Child = Actor->AddComponent();
+            Child->Asset = Asset;
+            Child->Location = FVector(0.0f, static_cast<float>(Index), 0.0f);
+
+            Actor->Partner = Index > 0 ? World->Actors[Index - 1] : nullptr;
+            World->Actors.Add(Actor);
+        }
+        return World;
+    }
+
+    void DestroyWorld(UDupTestWorld* World)
+    {
+        for (UObject* Actor : World->Actors)
+        {
+            for (UObject* Component : static_cast<UDupTestActor*>(Actor)->Components)
+            {
+                GUObjectArray.MarkRemoveObject(Component);
+            }
+            GUObjectArray.MarkRemoveObject(Actor);
+        }
+        GUObjectArray.MarkRemoveObject(World);
+        GUObjectArray.ProcessPendingDestroyObjects();
+    }
+}
+
+
+TEST_CASE(ReferencesBetweenDuplicatedObjectsPointToTheCopies)
+{
+    UDupTestAsset* Asset = FObjectFactory::ConstructObject<UDupTestAsset>(nullptr);
+    UDupTestWorld* Source = MakeWorld(3, Asset);
+
+    const int32 NumComponentsBefore = UDupTestComponent::StaticClass()->GetClassObjects().Num();
+    UDupTestWorld* Copy = static_cast<UDupTestWorld*>(Source->Duplicate(nullptr));
+
+    // 생성자가 만든 Root를 재사용하므로 컴포넌트는 Actor마다 두 개씩만 늘어납니다.
+    CHECK(UDupTestComponent::StaticClass()->GetClassObjects().Num() == NumComponentsBefore + 6);
+    CHECK(Copy != Source && Copy->Actors.Num() == 3);
+
+    bool bRemapped = true;
+    for (int32 Index = 0; Index < Copy->Actors.Num(); ++Index)
+    {
+        UDupTestActor* SourceActor = static_cast<UDupTestActor*>(Source->Actors[Index]);
+        UDupTestActor* Actor = static_cast<UDupTestActor*>(Copy->Actors[Index]);
+        bRemapped &= Actor != SourceActor && Actor->GetOuter() == Copy && Actor->GetClass() == UDupTestActor::StaticClass();
+        bRemapped &= Actor->Partner == (Index > 0 ? Copy->Actors[Index - 1] : nullptr);
+
+        // Components[0]은 생성자가 만든 Root이고, 그 값은 원본 Root에서 복사됩니다.
+        bRemapped &= Actor->Components.Num() == 2 && Actor->Components[0] == Actor->Root && Actor->Root->GetOuter() == Actor;
+        bRemapped &= Actor->Root->Location == SourceActor->Root->Location;
+
+        UDupTestComponent* Child = static_cast<UDupTestComponent*>(Actor->Components[1]);
+        bRemapped &= Child != SourceActor->Components[1] && Child->GetOuter() == Actor && Child->AttachParent == Actor->Root;
+        bRemapped &= Child->Location == static_cast<UDupTestComponent*>(SourceActor->Components[1])->Location;
+    }
+    CHECK(bRemapped);
+
+    // 원본은 바뀌지 않습니다.
+    CHECK(static_cast<UDupTestActor*>(Source->Actors[1])->Partner == Source->Actors[0]);
+
+    DestroyWorld(Copy);
+    DestroyWorld(Source);
+    GUObjectArray.MarkRemoveObject(Asset);
+    GUObjectArray.ProcessPendingDestroyObjects();
+}
+
+TEST_CASE(ReferencesOutsideTheDuplicatedObjectsAreLeftAlone)
+{
+    UDupTestAsset* Asset = FObjectFactory::ConstructObject<UDupTestAsset>(nullptr);
+    UDupTestWorld* Source = MakeWorld(2, Asset);
+    UDupTestWorld* OtherWorld = MakeWorld(1, nullptr);
+    static_cast<UDupTestActor*>(Source->Actors[0])->Partner = OtherWorld->Actors[0];
+
+    UDupTestWorld* Copy = static_cast<UDupTestWorld*>(Source->Duplicate(nullptr));
+    UDupTestActor* First = static_cast<UDupTestActor*>(Copy->Actors[0]);
+    UDupTestActor* Second = static_cast<UDupTestActor*>(Copy->Actors[1]);
+
+    // 복제하지 않은 Asset과 다른 World의 Actor는 원래 Object를 가리킵니다.
+    CHECK(static_cast<UDupTestComponent*>(First->Components[1])->Asset == Asset);
+    CHECK(static_cast<UDupTestComponent*>(Second->Components[1])->Asset == Asset);
+    CHECK(First->Partner == OtherWorld->Actors[0]);
+    CHECK(Second->Partner == First);
+    CHECK(First->Root->AttachParent == nullptr);
+
+    // CPF_DuplicateTransient인 값은 복사하지 않습니다.
+    CHECK(static_cast<UDupTestActor*>(Source->Actors[1])->Root->CachedIndex == 1);
+    CHECK(Second->Root->CachedIndex == -1);
+
+    // 다른 Outer 아래에 복제하면 원본 이름을 쓰고, 같은 Outer 아래에서는 새 이름을 붙입니다.
+    CHECK(First->GetFName() == Source->Actors[0]->GetFName());
+    UObject* SameOuterCopy = Source->Actors[0]->Duplicate(Source);
+    CHECK(SameOuterCopy->GetOuter() == Source && SameOuterCopy->GetFName() != Source->Actors[0]->GetFName());
+    CHECK(static_cast<UDupTestActor*>(SameOuterCopy)->Partner == OtherWorld->Actors[0]);
+
+    for (UObject* Component : static_cast<UDupTestActor*>(SameOuterCopy)->Components)
+    {
+        GUObjectArray.MarkRemoveObject(Component);
+    }
+    GUObjectArray.MarkRemoveObject(SameOuterCopy);
+    DestroyWorld(Copy);
+    DestroyWorld(OtherWorld);
+    DestroyWorld(Source);
+    GUObjectArray.MarkRemoveObject(Asset);
+    GUObjectArray.ProcessPendingDestroyObjects();
+}
+
+TEST_CASE(PostDuplicateRunsInDuplicationOrderAfterEveryReferenceIsFilled)
+{
+    UDupTestWorld* Source = MakeWorld(2, nullptr);
+
+    GPostDuplicateOrder.clear();
+    UDupTestWorld* Copy = static_cast<UDupTestWorld*>(Source->Duplicate(nullptr));
+
+    // World, 그 World의 Actor, Actor의 Root와 컴포넌트 순서로 복제했으므로 PostDuplicate도 그 순서입니다.
+    UDupTestActor* First = static_cast<UDupTestActor*>(Copy->Actors[0]);
+    UDupTestActor* Second = static_cast<UDupTestActor*>(Copy->Actors[1]);
+    const std::vector<UObject*> Expected = {
+        Copy,
+        First, First->Root, First->Components[1],
+        Second, Second->Root, Second->Components[1],
+    };
+    CHECK(GPostDuplicateOrder == Expected);
+    CHECK(First->bReferencesReadyInPostDuplicate && Second->bReferencesReadyInPostDuplicate);
+
+    DestroyWorld(Copy);
+    DestroyWorld(Source);
+}
+
+TEST_CASE(EachSourceIsDuplicatedOnce)
+{
+    UDupTestAsset* Asset = FObjectFactory::ConstructObject<UDupTestAsset>(nullptr);
+    UDupTestAsset* Other = FObjectFactory::ConstructObject<UDupTestAsset>(nullptr);
+
+    FObjectDuplicator Duplicator(2);
+    UDupTestAsset* Copy = Duplicator.DuplicateObject(Asset, nullptr);
+    CHECK(Copy != nullptr && Copy != Asset);
+    CHECK(Duplicator.DuplicateObject(Asset, nullptr) == Copy);
+    CHECK(Duplicator.DuplicateObject<UDupTestAsset>(nullptr, nullptr) == nullptr);
+    UDupTestAsset* OtherCopy = Duplicator.DuplicateObject(Other, nullptr);
+    CHECK(OtherCopy != Copy);
+
+    // Finish 전에는 등록되지 않고, Finish에서 한 번에 등록합니다.
+    const TArray<UObject*>& Assets = UDupTestAsset::StaticClass()->GetClassObjects();
+    CHECK(!Assets.Contains(Copy) && !Assets.Contains(OtherCopy));
+    Duplicator.Finish();
+    CHECK(Assets.Contains(Copy) && Assets.Contains(OtherCopy));
+    CHECK(GUObjectArray.GetObjectItemArrayUnsafe().Contains(Copy));
+
+    for (UObject* Object : { static_cast<UObject*>(Asset), static_cast<UObject*>(Other), static_cast<UObject*>(Copy), static_cast<UObject*>(OtherCopy) })
+    {
+        GUObjectArray.MarkRemoveObject(Object);
+    }
+    GUObjectArray.ProcessPendingDestroyObjects();
+}
@@ -0,0 +1,326 @@
+#include "TestHarness.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/ObjectMacros.h"
+#include "Serialization/MemoryArchive.h"
+
+
+namespace
+{
+    /**
+     * 지원하는 값 타입을 고루 가진 테스트 클래스.
+     * NotAProperty가 Plain Old Data Property 사이에 있으므로 CopyProperties의 memcpy 구간이 나뉩니다.
+     */
+    class UPropertyTestObject : public UObject
+    {
+        DECLARE_CLASS(UPropertyTestObject, UObject)
+
+    public:
+        UPropertyTestObject() = default;
+
+        UPROPERTY
+        (bool, bEnabled, = true)
+
+        UPROPERTY
+        (int32, Count, = 3)
+
+        int32 NotAProperty = 0;
+
+        UPROPERTY
+        (float, Scale, = 1.5f)
+
+        UPROPERTY
+        (uint64, Id, = 0)
+
+        UPROPERTY
+        (FVector, Location)
+
+        UPROPERTY
+        (FRotator, Rotation)
+
+        UPROPERTY
+        (FString, Label, = TEXT("Default"))
+
+        UPROPERTY
+        (FWString, WideLabel)
+
+        UPROPERTY
+        (TArray<FString>, Tags)
+
+        UPROPERTY
+        (TArray<int32>, Values)
+
+        UPROPERTY_WITH_FLAGS
+        (CPF_DuplicateTransient, FString, TransientLabel)
+
+        UPROPERTY_WITH_FLAGS
+        (CPF_DuplicateTransient, int32, TransientCount, = 0)
+    };
+
+    /** 부모의 Property 뒤에 자기 Property와 다른 Object 참조를 더한 클래스 */
+    class UPropertyTestChild : public UPropertyTestObject
+    {
+        DECLARE_CLASS(UPropertyTestChild, UPropertyTestObject)
+
+    public:
+        UPropertyTestChild() = default;
+
+        UPROPERTY
+        (double, Extra, = 0.0)
+
+        UPROPERTY
+        (UObject*, Target, = nullptr)
+
+        UPROPERTY
+        (TArray<UObject*>, Targets)
+    };
+
+    /** 기본값과 모두 다른 값으로 채웁니다. 실수는 텍스트로 옮겨도 정확히 남는 값만 씁니다. */
+    void FillValues(UPropertyTestObject& Object)
+    {
+        Object.bEnabled = false;
+        Object.Count = -42;
+        Object.NotAProperty = 7;
+        Object.Scale = 0.25f;
+        Object.Id = 18000000000000000000ull;
+        Object.Location = FVector(1.5f, -2.25f, 100.125f);
+        Object.Rotation = FRotator(10.5f, -90.0f, 45.25f);
+        Object.Label = TEXT("Hello, \"World\"");
+        Object.WideLabel = L"Wide";
+        Object.Tags = { TEXT("A"), TEXT("quote\"d"), TEXT("comma,and\\slash"), TEXT("") };
+        Object.Values = { 1, -2, 3 };
+        Object.TransientLabel = TEXT("Transient");
+        Object.TransientCount = 9;
+    }
+
+    /** 모든 Property가 같은지 Identical로 비교합니다. */
+    bool AllPropertiesIdentical(const UClass* Class, const UObject* A, const UObject* B)
+    {
+        for (const FProperty* Prop : Class->GetAllProperties())
+        {
+            if (!Prop->Identical(Prop->ContainerPtrToValuePtr(A), Prop->ContainerPtrToValuePtr(B)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    T* ConstructTestObject()
+    {
+        return FObjectFactory::ConstructObject<T>(nullptr);
+    }
+
+    void DestroyTestObjects(std::initializer_list<UObject*> Objects)
+    {
+        for (UObject* Object : Objects)
+        {
+            GUObjectArray.MarkRemoveObject(Object);
+        }
+        GUObjectArray.ProcessPendingDestroyObjects();
+    }
+}
+
+
+TEST_CASE(PropertiesAreListedParentFirst)
+{
+    const TArray<FProperty*>& Properties = UPropertyTestChild::StaticClass()->GetAllProperties();
+    CHECK(Properties.Num() == 15 && FString(Properties[0]->Name) == TEXT("bEnabled") && FString(Properties[12]->Name) == TEXT("Extra"));
+    CHECK(UPropertyTestObject::StaticClass()->GetProperties().Num() == 12);
+    CHECK(UPropertyTestChild::StaticClass()->GetProperties().Num() == 3);
+
+    CHECK(UPropertyTestChild::StaticClass()->FindPropertyByName(TEXT("Label")) != nullptr);
+    CHECK(UPropertyTestChild::StaticClass()->FindPropertyByName(TEXT("NotAProperty")) == nullptr);
+    CHECK(UPropertyTestObject::StaticClass()->FindPropertyByName(TEXT("Extra")) == nullptr);
+
+    const FProperty* Targets = UPropertyTestChild::StaticClass()->FindPropertyByName(TEXT("Targets"));
+    CHECK(Targets && Targets->HasAnyFlags(CPF_ObjectReference) && Targets->Type == EPropertyType::Array);
+    const FProperty* Scale = UPropertyTestChild::StaticClass()->FindPropertyByName(TEXT("Scale"));
+    CHECK(Scale && Scale->HasAnyFlags(CPF_IsPlainOldData) && Scale->Type == EPropertyType::Float);
+}
+
+TEST_CASE(ExportImportRoundTripRestoresEveryValue)
+{
+    UPropertyTestChild* Source = ConstructTestObject<UPropertyTestChild>();
+    UPropertyTestChild* Dest = ConstructTestObject<UPropertyTestChild>();
+    FillValues(*Source);
+    Source->Extra = -0.5;
+    Source->Target = Dest;
+    Source->Targets = { Dest, nullptr };
+
+    UClass* Class = UPropertyTestChild::StaticClass();
+    TMap<FString, FString> Exported;
+    Class->ExportProperties(Source, Exported);
+
+    // 다른 Object를 가리키는 Property는 텍스트로 쓰지 않습니다.
+    CHECK(Exported.Num() == 13);
+    CHECK(Exported.Contains(TEXT("Tags")) && Exported.Contains(TEXT("TransientLabel")));
+    CHECK(!Exported.Contains(TEXT("Target")) && !Exported.Contains(TEXT("Targets")));
+    CHECK(Exported.Contains(TEXT("Values")) && Exported[TEXT("Values")] == TEXT("(\"1\",\"-2\",\"3\")"));
+
+    Class->ImportProperties(Exported, Dest);
+    CHECK(Dest->bEnabled == false && Dest->Count == -42 && Dest->Scale == 0.25f && Dest->Id == Source->Id);
+    CHECK(Dest->Location == Source->Location);
+    CHECK(Dest->Label == Source->Label && Dest->WideLabel == Source->WideLabel);
+    CHECK(Dest->Tags.Num() == 4 && Dest->Tags[1] == TEXT("quote\"d") && Dest->Tags[2] == TEXT("comma,and\\slash") && Dest->Tags[3] == TEXT(""));
+    CHECK(Dest->TransientLabel == TEXT("Transient") && Dest->TransientCount == 9 && Dest->Extra == -0.5);
+    CHECK(Dest->Target == nullptr && Dest->Targets.Num() == 0);
+    CHECK(Dest->NotAProperty == 0);
+
+    // 참조를 맞춰 주면 모든 Property가 같습니다.
+    Dest->Target = Source->Target;
+    Dest->Targets = Source->Targets;
+    CHECK(AllPropertiesIdentical(Class, Source, Dest));
+
+    DestroyTestObjects({ Source, Dest });
+}
+
+TEST_CASE(InvalidTextLeavesValuesUnchanged)
+{
+    UPropertyTestObject* Object = ConstructTestObject<UPropertyTestObject>();
+    FillValues(*Object);
+
+    UClass* Class = UPropertyTestObject::StaticClass();
+    TMap<FString, FString> Before;
+    Class->ExportProperties(Object, Before);
+
+    TMap<FString, FString> Invalid;
+    Invalid.Add(TEXT("Count"), TEXT("12abc"));
+    Invalid.Add(TEXT("Scale"), TEXT(""));
+    Invalid.Add(TEXT("Id"), TEXT("x1"));
+    Invalid.Add(TEXT("Location"), TEXT("X=1.0 Y=2.0"));
+    Invalid.Add(TEXT("Tags"), TEXT("(\"A\",\"B\""));
+    Invalid.Add(TEXT("Values"), TEXT("(\"1\",\"two\")"));
+    Invalid.Add(TEXT("Unknown"), TEXT("1"));
+    Class->ImportProperties(Invalid, Object);
+
+    TMap<FString, FString> After;
+    Class->ExportProperties(Object, After);
+    bool bUnchanged = After.Num() == Before.Num();
+    for (const auto& [Name, Text] : Before)
+    {
+        bUnchanged &= After.Contains(Name) && After[Name] == Text;
+    }
+    CHECK(bUnchanged);
+
+    // Property 하나씩도 형식이 맞지 않으면 false를 반환합니다.
+    const FProperty* Count = Class->FindPropertyByName(TEXT("Count"));
+    void* CountValue = Count->ContainerPtrToValuePtr(Object);
+    CHECK(!Count->ImportText(TEXT("1.5"), CountValue));
+    CHECK(Count->ImportText(TEXT(" 17 "), CountValue) && Object->Count == 17);
+
+    const FProperty* Tags = Class->FindPropertyByName(TEXT("Tags"));
+    CHECK(!Tags->ImportText(TEXT("\"A\""), Tags->ContainerPtrToValuePtr(Object)));
+    CHECK(!Tags->ImportText(TEXT("(\"A\" ,\"B\")"), Tags->ContainerPtrToValuePtr(Object)));
+    CHECK(Tags->ImportText(TEXT("()"), Tags->ContainerPtrToValuePtr(Object)) && Object->Tags.Num() == 0);
+
+    DestroyTestObjects({ Object });
+}
+
+TEST_CASE(CopyPropertiesSkipsReferencesAndDuplicateTransient)
+{
+    UPropertyTestChild* Source = ConstructTestObject<UPropertyTestChild>();
+    UPropertyTestChild* Dest = ConstructTestObject<UPropertyTestChild>();
+    UPropertyTestChild* Other = ConstructTestObject<UPropertyTestChild>();
+    FillValues(*Source);
+    Source->Extra = 2.0;
+    Source->Target = Other;
+    Source->Targets = { Other };
+
+    UClass* Class = UPropertyTestChild::StaticClass();
+    Class->CopyProperties(Dest, Source);
+
+    CHECK(Dest->bEnabled == false && Dest->Count == -42 && Dest->Scale == 0.25f && Dest->Id == Source->Id);
+    CHECK(Dest->Location == Source->Location && Dest->Extra == 2.0);
+    CHECK(Dest->Label == Source->Label && Dest->WideLabel == Source->WideLabel);
+    CHECK(Dest->Tags.Num() == 4 && Dest->Values.Num() == 3 && Dest->Values[1] == -2);
+
+    // Property가 아닌 멤버는 memcpy 구간 사이에 있어도 건드리지 않습니다.
+    CHECK(Dest->NotAProperty == 0);
+
+    // CPF_DuplicateTransient와 다른 Object 참조는 복사하지 않습니다.
+    CHECK(Dest->TransientLabel == TEXT("") && Dest->TransientCount == 0);
+    CHECK(Dest->Target == nullptr && Dest->Targets.Num() == 0);
+
+    // 참조는 CopyObjectReferences가 ObjectMap에 따라 바꿔서 복사합니다.
+    TMap<UObject*, UObject*> ObjectMap;
+    ObjectMap.Add(Other, Dest);
+    Class->CopyObjectReferences(Dest, Source, ObjectMap);
+    CHECK(Dest->Target == Dest && Dest->Targets.Num() == 1 && Dest->Targets[0] == Dest);
+
+    ObjectMap.Empty();
+    Class->CopyObjectReferences(Dest, Source, ObjectMap);
+    CHECK(Dest->Target == Other && Dest->Targets[0] == Other);
+
+    // 부모 클래스로 복사하면 자식의 Property는 두고 부모의 Property만 복사합니다.
+    UPropertyTestChild* ParentCopy = ConstructTestObject<UPropertyTestChild>();
+    UPropertyTestObject::StaticClass()->CopyProperties(ParentCopy, Source);
+    CHECK(ParentCopy->Count == -42 && ParentCopy->Label == Source->Label && ParentCopy->Extra == 0.0);
+
+    DestroyTestObjects({ Source, Dest, Other, ParentCopy });
+}
+
+TEST_CASE(SerializeBinRoundTripRestoresEveryValue)
+{
+    UPropertyTestObject* Source = ConstructTestObject<UPropertyTestObject>();
+    UPropertyTestObject* Dest = ConstructTestObject<UPropertyTestObject>();
+    FillValues(*Source);
+
+    UClass* Class = UPropertyTestObject::StaticClass();
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+    Class->SerializeBin(Writer, Source);
+    CHECK(Bytes.Num() > 0);
+
+    CHECK(!AllPropertiesIdentical(Class, Source, Dest));
+    FMemoryReader Reader(Bytes);
+    FArchive& ReaderArchive = Reader;
+    Class->SerializeBin(ReaderArchive, Dest);
+    CHECK(ReaderArchive.Tell() == Bytes.Num());
+
+    // 텍스트와 달리 CPF_DuplicateTransient와 Property가 아닌 멤버를 빼면 전부 옮겨집니다.
+    CHECK(AllPropertiesIdentical(Class, Source, Dest));
+    CHECK(Dest->TransientLabel == TEXT("Transient") && Dest->Rotation == Source->Rotation);
+    CHECK(Dest->NotAProperty == 0);
+
+    DestroyTestObjects({ Source, Dest });
+}
+
+TEST_CASE(IdenticalComparesValuesOfEachType)
+{
+    UPropertyTestObject* A = ConstructTestObject<UPropertyTestObject>();
+    UPropertyTestObject* B = ConstructTestObject<UPropertyTestObject>();
+    UClass* Class = UPropertyTestObject::StaticClass();
+    CHECK(AllPropertiesIdentical(Class, A, B));
+
+    const auto IsIdentical = [Class, A, B](const char* Name)
+    {
+        const FProperty* Prop = Class->FindPropertyByName(Name);
+        return Prop->Identical(Prop->ContainerPtrToValuePtr(A), Prop->ContainerPtrToValuePtr(B));
+    };
+
+    // Property가 아닌 멤버는 비교하지 않습니다.
+    A->NotAProperty = 1;
+    CHECK(AllPropertiesIdentical(Class, A, B));
+
+    A->Scale = 2.0f;
+    CHECK(!IsIdentical("Scale") && IsIdentical("Count"));
+
+    A->Label = TEXT("Other");
+    CHECK(!IsIdentical("Label"));
+    B->Label = TEXT("Other");
+    CHECK(IsIdentical("Label"));
+
+    A->Values = { 1, 2 };
+    B->Values = { 1, 2, 3 };
+    CHECK(!IsIdentical("Values"));
+    B->Values = { 1, 3 };
+    CHECK(!IsIdentical("Values"));
+    B->Values = { 1, 2 };
+    CHECK(IsIdentical("Values"));
+
+    A->Location = FVector(0.0f, 0.0f, 1.0f);
+    CHECK(!IsIdentical("Location"));
+
+    DestroyTestObjects({ A, B });
+}
@@ -0,0 +1,138 @@
+#include "BenchHarness.h"
+#include <algorithm>
+#include <new>
+#include <random>
+#include "UObject/ObjectFactory.h"
+#include "UObject/ObjectMacros.h"
+#include "UObject/UObjectAllocator.h"
+
+
+/**
+ * UObject 생성과 제거. Actor 하나에 Component 하나를 붙이던 이전 콘솔 벤치마크처럼,
+ * 크기가 다른 두 클래스의 Object를 번갈아 FObjectFactory로 만들고 GUObjectArray로 지웁니다.
+ * 같은 크기 순서로 FUObjectAllocator와 operator new를 직접 호출한 시간도 비교합니다.
+ * 인자로 Object 수를 넘길 수 있습니다.
+ */
+namespace
+{
+    class UBenchActor : public UObject
+    {
+        DECLARE_CLASS(UBenchActor, UObject)
+
+    public:
+        UBenchActor() = default;
+
+        uint8 Payload[400] = {};
+    };
+
+    class UBenchComponent : public UObject
+    {
+        DECLARE_CLASS(UBenchComponent, UObject)
+
+    public:
+        UBenchComponent() = default;
+
+        uint8 Payload[200] = {};
+    };
+}
+
+
+int main(int Argc, char** Argv)
+{
+    const int32 NumObjects = BenchHarness::GetIntArgument(Argc, Argv, 1, 100000);
+    constexpr int32 NumRuns = 5;
+
+    const FUObjectAllocatorStats StartStats = FUObjectAllocator::Get().GetStats();
+
+    TArray<UObject*> Objects;
+    Objects.Reserve(NumObjects);
+
+    const double ConstructMs = BenchHarness::MeasureBestMs(NumRuns, [&]
+    {
+        // 가장 빠른 한 번만 남기므로, 이전 실행의 Object는 시간 밖에서 지웁니다.
+        for (UObject* Object : Objects)
+        {
+            GUObjectArray.MarkRemoveObject(Object);
+        }
+        GUObjectArray.ProcessPendingDestroyObjects();
+        Objects.Empty();
+
+        for (int32 Index = 0; Index < NumObjects; ++Index)
+        {
+            UClass* Class = (Index & 1) ? UBenchComponent::StaticClass() : UBenchActor::StaticClass();
+            Objects.Add(FObjectFactory::ConstructObject(Class, nullptr));
+        }
+    });
+
+    const FUObjectAllocatorStats PeakStats = FUObjectAllocator::Get().GetStats();
+
+    const double DestroyMs = BenchHarness::MeasureBestMs(1, [&]
+    {
+        for (UObject* Object : Objects)
+        {
+            GUObjectArray.MarkRemoveObject(Object);
+        }
+        GUObjectArray.ProcessPendingDestroyObjects();
+    });
+    Objects.Empty();
+
+    // 같은 크기 순서로 할당하고, 섞은 순서로 해제합니다.
+    TArray<size_t> Sizes;
+    for (int32 Index = 0; Index < NumObjects; ++Index)
+    {
+        Sizes.Add((Index & 1) ? sizeof(UBenchComponent) : sizeof(UBenchActor));
+    }
+    TArray<int32> FreeOrder;
+    for (int32 Index = 0; Index < NumObjects; ++Index)
+    {
+        FreeOrder.Add(Index);
+    }
+    std::shuffle(FreeOrder.begin(), FreeOrder.end(), std::mt19937(1234));
+
+    TArray<void*> Blocks;
+    Blocks.SetNum(NumObjects);
+    const double PoolMs = BenchHarness::MeasureBestMs(NumRuns, [&]
+    {
+        for (int32 Index = 0; Index < NumObjects; ++Index)
+        {
+            Blocks[Index] = FUObjectAllocator::Get().Allocate(Sizes[Index], FUObjectAllocator::MaxAlignment);
+        }
+        for (const int32 Index : FreeOrder)
+        {
+            FUObjectAllocator::Get().Free(Blocks[Index], Sizes[Index]);
+        }
+    });
+    const double NewMs = BenchHarness::MeasureBestMs(NumRuns, [&]
+    {
+        for (int32 Index = 0; Index < NumObjects; ++Index)
+        {
+            Blocks[Index] = ::operator new(Sizes[Index], std::align_val_t{FUObjectAllocator::MaxAlignment});
+        }
+        for (const int32 Index : FreeOrder)
+        {
+            ::operator delete(Blocks[Index], Sizes[Index], std::align_val_t{FUObjectAllocator::MaxAlignment});
+        }
+    });
+
+    const auto PerSecond = [NumObjects](double Ms) { return Ms > 0.0 ? NumObjects * 1000.0 / Ms : 0.0; };
+    std::printf("UObject, %d objects (%zu and %zu bytes)\n", NumObjects, sizeof(UBenchActor), sizeof(UBenchComponent));
+    std::printf("  %-24s %10s %14s\n", "phase", "ms", "objects/s");
+    std::printf("  %-24s %10.3f %14.0f\n", "construct", ConstructMs, PerSecond(ConstructMs));
+    std::printf("  %-24s %10.3f %14.0f\n", "destroy", DestroyMs, PerSecond(DestroyMs));
+    std::printf("  %-24s %10.3f %14.0f\n", "alloc + free (pool)", PoolMs, PerSecond(PoolMs));
+    std::printf("  %-24s %10.3f %14.0f\n", "alloc + free (new)", NewMs, PerSecond(NewMs));
+    std::printf("Pool at peak: %llu live objects, %.1f MB live, %u slabs (%.1f MB)\n",
+        static_cast<unsigned long long>(PeakStats.NumLiveObjects),
+        PeakStats.LiveBytes / (1024.0 * 1024.0),
+        PeakStats.NumSlabs,
+        PeakStats.SlabBytes / (1024.0 * 1024.0)
+    );
+
+    const FUObjectAllocatorStats EndStats = FUObjectAllocator::Get().GetStats();
+    if (EndStats.NumLiveObjects != StartStats.NumLiveObjects || EndStats.LiveBytes != StartStats.LiveBytes)
+    {
+        std::printf("Objects were not returned to the pool\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,244 @@
+#include "TestHarness.h"
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include "HAL/PlatformMemory.h"
+#include "UObject/ObjectMacros.h"
+#include "UObject/UObjectAllocator.h"
+
+
+namespace
+{
+    /**
+     * Allocator는 프로세스 하나에 하나뿐이고 해제된 Slot은 Free List에 남으므로,
+     * 테스트마다 다른 테스트가 쓰지 않는 Size-Class를 골라 통계의 변화량만 비교합니다.
+     */
+    FUObjectAllocator& Allocator()
+    {
+        return FUObjectAllocator::Get();
+    }
+
+    bool IsAligned(const void* Ptr)
+    {
+        return reinterpret_cast<uintptr_t>(Ptr) % FUObjectAllocator::MaxAlignment == 0;
+    }
+
+    class UAlignedTestObject : public UObject
+    {
+        DECLARE_CLASS(UAlignedTestObject, UObject)
+
+    public:
+        UAlignedTestObject() = default;
+
+        alignas(16) float Values[4] = {};
+        uint8 Tail = 0;
+    };
+
+    class ULargeTestObject : public UObject
+    {
+        DECLARE_CLASS(ULargeTestObject, UObject)
+
+    public:
+        ULargeTestObject() = default;
+
+        uint8 Payload[FUObjectAllocator::MaxPooledSize] = {};
+    };
+}
+
+
+TEST_CASE(FreedSlotsAreReusedFirst)
+{
+    constexpr size_t Size = 48;
+    void* A = Allocator().Allocate(Size, 16);
+    void* B = Allocator().Allocate(Size, 16);
+    void* C = Allocator().Allocate(Size, 16);
+    CHECK(A != B && B != C && A != C);
+
+    // 마지막에 해제한 Slot부터 다시 나눠 줍니다.
+    Allocator().Free(B, Size);
+    Allocator().Free(C, Size);
+    CHECK(Allocator().Allocate(Size, 16) == C);
+    CHECK(Allocator().Allocate(Size, 16) == B);
+
+    // 같은 Size-Class로 올림되는 크기끼리는 Slot을 같이 씁니다.
+    Allocator().Free(A, Size);
+    void* SameClass = Allocator().Allocate(Size - 15, 8);
+    CHECK(SameClass == A);
+
+    // 다른 Size-Class는 이 Free List를 건드리지 않습니다.
+    Allocator().Free(SameClass, Size - 15);
+    void* OtherClass = Allocator().Allocate(Size + 16, 16);
+    CHECK(OtherClass != A);
+    CHECK(Allocator().Allocate(Size, 16) == A);
+
+    Allocator().Free(OtherClass, Size + 16);
+    Allocator().Free(A, Size);
+    Allocator().Free(B, Size);
+    Allocator().Free(C, Size);
+}
+
+TEST_CASE(SlotsFillSlabsWithoutOverlapping)
+{
+    constexpr size_t Size = 1040;
+    constexpr int32 SlotsPerSlab = static_cast<int32>(FUObjectAllocator::SlabSize / Size);
+    constexpr int32 NumAllocations = SlotsPerSlab * 3 + 1;
+
+    const FUObjectAllocatorStats Before = Allocator().GetStats();
+    const uint64 PlatformBytesBefore = FPlatformMemory::GetAllocationBytes<EAT_Object>();
+
+    std::set<uintptr_t> Addresses;
+    TArray<void*> Slots;
+    bool bAllAligned = true;
+    for (int32 Index = 0; Index < NumAllocations; ++Index)
+    {
+        void* Ptr = Allocator().Allocate(Size, 16);
+        std::memset(Ptr, Index & 0xFF, Size);
+        bAllAligned &= IsAligned(Ptr);
+        Addresses.insert(reinterpret_cast<uintptr_t>(Ptr));
+        Slots.Add(Ptr);
+    }
+    CHECK(bAllAligned);
+    CHECK(static_cast<int32>(Addresses.size()) == NumAllocations);
+
+    // 정렬한 주소 사이의 간격이 Slot 크기보다 작으면 겹친 것입니다.
+    bool bNoOverlap = true;
+    uintptr_t Previous = 0;
+    for (const uintptr_t Address : Addresses)
+    {
+        bNoOverlap &= Previous == 0 || Address - Previous >= Size;
+        Previous = Address;
+    }
+    CHECK(bNoOverlap);
+
+    // 앞에서 쓴 값이 뒤의 Slot에 덮이지 않았습니다.
+    bool bIntact = true;
+    for (int32 Index = 0; Index < NumAllocations; ++Index)
+    {
+        const uint8* Bytes = static_cast<const uint8*>(Slots[Index]);
+        bIntact &= Bytes[0] == (Index & 0xFF) && Bytes[Size - 1] == (Index & 0xFF);
+    }
+    CHECK(bIntact);
+
+    const FUObjectAllocatorStats After = Allocator().GetStats();
+    CHECK(After.NumSlabs - Before.NumSlabs == 4);
+    CHECK(After.SlabBytes - Before.SlabBytes == 4 * FUObjectAllocator::SlabSize);
+    CHECK(FPlatformMemory::GetAllocationBytes<EAT_Object>() - PlatformBytesBefore == 4 * FUObjectAllocator::SlabSize);
+
+    // 모두 해제해도 Slab은 돌려주지 않고, 다시 할당하면 새 Slab 없이 채웁니다.
+    for (void* Ptr : Slots)
+    {
+        Allocator().Free(Ptr, Size);
+    }
+    CHECK(Allocator().GetStats().NumSlabs == After.NumSlabs);
+    for (int32 Index = 0; Index < NumAllocations; ++Index)
+    {
+        Slots[Index] = Allocator().Allocate(Size, 16);
+        CHECK(Addresses.contains(reinterpret_cast<uintptr_t>(Slots[Index])));
+    }
+    CHECK(Allocator().GetStats().NumSlabs == After.NumSlabs);
+    for (void* Ptr : Slots)
+    {
+        Allocator().Free(Ptr, Size);
+    }
+}
+
+TEST_CASE(LargeObjectsBypassThePools)
+{
+    constexpr size_t Size = FUObjectAllocator::MaxPooledSize + 24;
+    constexpr size_t RoundedSize = FUObjectAllocator::MaxPooledSize + 32;
+
+    const FUObjectAllocatorStats Before = Allocator().GetStats();
+    const uint64 PlatformBytesBefore = FPlatformMemory::GetAllocationBytes<EAT_Object>();
+
+    void* Ptr = Allocator().Allocate(Size, 16);
+    CHECK(Ptr != nullptr && IsAligned(Ptr));
+    std::memset(Ptr, 0xAB, Size);
+
+    const FUObjectAllocatorStats During = Allocator().GetStats();
+    CHECK(During.NumLargeObjects == Before.NumLargeObjects + 1);
+    CHECK(During.NumLiveObjects == Before.NumLiveObjects + 1);
+    CHECK(During.LiveBytes == Before.LiveBytes + Size);
+    CHECK(During.NumSlabs == Before.NumSlabs);
+    CHECK(FPlatformMemory::GetAllocationBytes<EAT_Object>() - PlatformBytesBefore == RoundedSize);
+
+    Allocator().Free(Ptr, Size);
+    const FUObjectAllocatorStats After = Allocator().GetStats();
+    CHECK(After.NumLargeObjects == Before.NumLargeObjects);
+    CHECK(After.NumLiveObjects == Before.NumLiveObjects);
+    CHECK(After.LiveBytes == Before.LiveBytes);
+    CHECK(FPlatformMemory::GetAllocationBytes<EAT_Object>() == PlatformBytesBefore);
+
+    // MaxPooledSize까지는 Pool에서 나눠 줍니다.
+    void* Pooled = Allocator().Allocate(FUObjectAllocator::MaxPooledSize, 16);
+    CHECK(Allocator().GetStats().NumLargeObjects == Before.NumLargeObjects);
+    Allocator().Free(Pooled, FUObjectAllocator::MaxPooledSize);
+}
+
+TEST_CASE(StatsTrackSlotSizedLiveBytesAndTotals)
+{
+    const FUObjectAllocatorStats Before = Allocator().GetStats();
+
+    // 크기는 Slot 크기로 올림해서 셉니다.
+    void* A = Allocator().Allocate(100, 8);
+    void* B = Allocator().Allocate(112, 16);
+    void* C = Allocator().Allocate(1, 1);
+
+    const FUObjectAllocatorStats During = Allocator().GetStats();
+    CHECK(During.NumLiveObjects == Before.NumLiveObjects + 3);
+    CHECK(During.LiveBytes == Before.LiveBytes + 112 + 112 + 16);
+    CHECK(During.TotalAllocations == Before.TotalAllocations + 3);
+    CHECK(During.TotalFrees == Before.TotalFrees);
+
+    Allocator().Free(A, 100);
+    Allocator().Free(nullptr, 100);
+    const FUObjectAllocatorStats AfterOne = Allocator().GetStats();
+    CHECK(AfterOne.NumLiveObjects == Before.NumLiveObjects + 2);
+    CHECK(AfterOne.LiveBytes == Before.LiveBytes + 112 + 16);
+    CHECK(AfterOne.TotalFrees == Before.TotalFrees + 1);
+
+    Allocator().Free(B, 112);
+    Allocator().Free(C, 1);
+    const FUObjectAllocatorStats After = Allocator().GetStats();
+    CHECK(After.NumLiveObjects == Before.NumLiveObjects);
+    CHECK(After.LiveBytes == Before.LiveBytes);
+    CHECK(After.TotalAllocations == Before.TotalAllocations + 3);
+    CHECK(After.TotalFrees == Before.TotalFrees + 3);
+}
+
+TEST_CASE(EverySizeClassIs16ByteAligned)
+{
+    bool bAllAligned = true;
+    for (size_t Size = 1; Size <= FUObjectAllocator::MaxPooledSize + 64; Size += 7)
+    {
+        void* Ptr = Allocator().Allocate(Size, 16);
+        bAllAligned &= IsAligned(Ptr);
+        Allocator().Free(Ptr, Size);
+    }
+    CHECK(bAllAligned);
+}
+
+TEST_CASE(UObjectsComeFromTheAllocator)
+{
+    static_assert(alignof(UAlignedTestObject) == 16);
+
+    const FUObjectAllocatorStats Before = Allocator().GetStats();
+
+    // ClassCTOR와 operator new 모두 Allocator를 거치고, delete는 동적 타입의 크기로 돌려줍니다.
+    UObject* FromClass = UAlignedTestObject::StaticClass()->ClassCTOR();
+    UObject* FromNew = new UAlignedTestObject;
+    UObject* Large = ULargeTestObject::StaticClass()->ClassCTOR();
+    CHECK(IsAligned(FromClass) && IsAligned(FromNew) && IsAligned(Large));
+    CHECK(IsAligned(static_cast<UAlignedTestObject*>(FromClass)->Values));
+
+    const FUObjectAllocatorStats During = Allocator().GetStats();
+    CHECK(During.NumLiveObjects == Before.NumLiveObjects + 3);
+    CHECK(During.NumLargeObjects == Before.NumLargeObjects + 1);
+
+    delete FromClass;
+    delete FromNew;
+    delete Large;
+    const FUObjectAllocatorStats After = Allocator().GetStats();
+    CHECK(After.NumLiveObjects == Before.NumLiveObjects);
+    CHECK(After.NumLargeObjects == Before.NumLargeObjects);
+    CHECK(After.LiveBytes == Before.LiveBytes);
+}
@@ -0,0 +1,177 @@
+#include "BenchHarness.h"
+#include "Container/Map.h"
+#include "Container/Set.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/ObjectMacros.h"
+#include "UObject/UObjectIterator.h"
+
+
+/**
+ * Object 순회와 IsA. 엔진의 Component 계층과 같은 모양의 클래스 세 개에 Object를 나눠 만들고 비교합니다.
+ *   - 순회: 클래스별 TSet에서 후보를 TArray에 모으던 이전 TObjectIterator와 TObjectRange
+ *   - IsA: Super를 따라 올라가던 이전 IsChildOf와 클래스 트리 구간 비교
+ * 인자로 Object 수를 넘길 수 있습니다.
+ */
+namespace
+{
+    class UBenchSceneComponent : public UObject
+    {
+        DECLARE_CLASS(UBenchSceneComponent, UObject)
+
+    public:
+        UBenchSceneComponent() = default;
+    };
+
+    class UBenchPrimitiveComponent : public UBenchSceneComponent
+    {
+        DECLARE_CLASS(UBenchPrimitiveComponent, UBenchSceneComponent)
+
+    public:
+        UBenchPrimitiveComponent() = default;
+    };
+
+    class UBenchMeshComponent : public UBenchPrimitiveComponent
+    {
+        DECLARE_CLASS(UBenchMeshComponent, UBenchPrimitiveComponent)
+
+    public:
+        UBenchMeshComponent() = default;
+    };
+
+    class UBenchStaticMeshComponent : public UBenchMeshComponent
+    {
+        DECLARE_CLASS(UBenchStaticMeshComponent, UBenchMeshComponent)
+
+    public:
+        UBenchStaticMeshComponent() = default;
+    };
+}
+
+
+int main(int Argc, char** Argv)
+{
+    const int32 NumObjects = BenchHarness::GetIntArgument(Argc, Argv, 1, 100000);
+    constexpr int32 NumRuns = 20;
+
+    // 한 클래스 목록에 몰리지 않도록 세 클래스에 나눠서 만듭니다.
+    TArray<UObject*> Objects;
+    Objects.Reserve(NumObjects);
+    for (int32 i = 0; i < NumObjects; ++i)
+    {
+        switch (i % 3)
+        {
+        case 0: Objects.Add(FObjectFactory::ConstructObject<UBenchSceneComponent>(nullptr)); break;
+        case 1: Objects.Add(FObjectFactory::ConstructObject<UBenchPrimitiveComponent>(nullptr)); break;
+        default: Objects.Add(FObjectFactory::ConstructObject<UBenchStaticMeshComponent>(nullptr)); break;
+        }
+    }
+
+    // 이전 FUObjectHashTables처럼 클래스별 TSet을 만들어 둡니다.
+    TMap<UClass*, TSet<UClass*>> ClassToChildListMap;
+    TMap<UClass*, TSet<UObject*>> ClassToObjectListMap;
+    for (UObject* Object : GUObjectArray.GetObjectItemArrayUnsafe())
+    {
+        UClass* Class = Object->GetClass();
+        ClassToObjectListMap.FindOrAdd(Class).Add(Object);
+        for (UClass* SuperClass = Class->GetSuperClass(); SuperClass; Class = SuperClass, SuperClass = SuperClass->GetSuperClass())
+        {
+            ClassToChildListMap.FindOrAdd(SuperClass).Add(Class);
+        }
+    }
+
+    uint64 SnapshotChecksum = 0;
+    const double SnapshotMs = BenchHarness::MeasureBestMs(NumRuns, [&]
+    {
+        TArray<UClass*> ClassesToSearch;
+        ClassesToSearch.Add(UBenchSceneComponent::StaticClass());
+        for (int32 SearchIndex = 0; SearchIndex < ClassesToSearch.Num(); ++SearchIndex)
+        {
+            if (const TSet<UClass*>* ChildSet = ClassToChildListMap.Find(ClassesToSearch[SearchIndex]))
+            {
+                for (UClass* ChildClass : *ChildSet)
+                {
+                    ClassesToSearch.Add(ChildClass);
+                }
+            }
+        }
+
+        TArray<UObject*> Snapshot;
+        for (UClass* SearchClass : ClassesToSearch)
+        {
+            if (const TSet<UObject*>* ObjectSet = ClassToObjectListMap.Find(SearchClass))
+            {
+                for (UObject* Object : *ObjectSet)
+                {
+                    Snapshot.Add(Object);
+                }
+            }
+        }
+
+        SnapshotChecksum = 0;
+        for (UObject* Object : Snapshot)
+        {
+            SnapshotChecksum += Object->GetUUID();
+        }
+    });
+
+    uint64 RangeChecksum = 0;
+    const double RangeMs = BenchHarness::MeasureBestMs(NumRuns, [&]
+    {
+        RangeChecksum = 0;
+        for (UBenchSceneComponent* Component : TObjectRange<UBenchSceneComponent>())
+        {
+            RangeChecksum += Component->GetUUID();
+        }
+    });
+
+    // 이전 IsChildOf처럼 Super를 따라 올라가며 비교합니다.
+    const UClass* MeshClass = UBenchMeshComponent::StaticClass();
+    int32 NumSuperWalkHits = 0;
+    const double SuperWalkMs = BenchHarness::MeasureBestMs(NumRuns, [&]
+    {
+        NumSuperWalkHits = 0;
+        for (UObject* Object : Objects)
+        {
+            for (const UClass* Class = Object->GetClass(); Class; Class = Class->GetSuperClass())
+            {
+                if (Class == MeshClass)
+                {
+                    ++NumSuperWalkHits;
+                    break;
+                }
+            }
+        }
+    });
+
+    int32 NumIsAHits = 0;
+    const double IsAMs = BenchHarness::MeasureBestMs(NumRuns, [&]
+    {
+        NumIsAHits = 0;
+        for (UObject* Object : Objects)
+        {
+            NumIsAHits += Object->IsA(MeshClass) ? 1 : 0;
+        }
+    });
+
+    for (UObject* Object : Objects)
+    {
+        GUObjectArray.MarkRemoveObject(Object);
+    }
+    GUObjectArray.ProcessPendingDestroyObjects();
+
+    const auto PrintRow = [](const char* Phase, double OldMs, double NewMs)
+    {
+        std::printf("  %-10s %10.3f %10.3f %8.2fx\n", Phase, OldMs, NewMs, NewMs > 0.0 ? OldMs / NewMs : 0.0);
+    };
+    std::printf("Object iteration, %d objects\n", NumObjects);
+    std::printf("  %-10s %10s %10s %9s\n", "phase", "old ms", "new ms", "speedup");
+    PrintRow("iterate", SnapshotMs, RangeMs);
+    PrintRow("IsA", SuperWalkMs, IsAMs);
+
+    if (SnapshotChecksum != RangeChecksum || NumSuperWalkHits != NumIsAHits)
+    {
+        std::printf("Results differ between the two paths\n");
+        return 1;
+    }
+    return 0;
+}
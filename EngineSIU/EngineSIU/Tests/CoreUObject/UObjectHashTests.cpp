@@ -0,0 +1,281 @@
+#include "TestHarness.h"
+#include <algorithm>
+#include <set>
+#include "UObject/ObjectFactory.h"
+#include "UObject/ObjectMacros.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+
+
+namespace
+{
+    //   UHashTestBase
+    //   ├─ UHashTestLeft
+    //   │   └─ UHashTestLeftChild
+    //   └─ UHashTestRight
+    class UHashTestBase : public UObject
+    {
+        DECLARE_CLASS(UHashTestBase, UObject)
+
+    public:
+        UHashTestBase() = default;
+    };
+
+    class UHashTestLeft : public UHashTestBase
+    {
+        DECLARE_CLASS(UHashTestLeft, UHashTestBase)
+
+    public:
+        UHashTestLeft() = default;
+    };
+
+    class UHashTestLeftChild : public UHashTestLeft
+    {
+        DECLARE_CLASS(UHashTestLeftChild, UHashTestLeft)
+
+    public:
+        UHashTestLeftChild() = default;
+    };
+
+    class UHashTestRight : public UHashTestBase
+    {
+        DECLARE_CLASS(UHashTestRight, UHashTestBase)
+
+    public:
+        UHashTestRight() = default;
+    };
+
+    /** 클래스 트리 구간을 쓰지 않고 Super를 따라 올라가며 확인합니다. */
+    bool IsChildOfBySuperWalk(const UClass* Class, const UClass* SomeBase)
+    {
+        for (; Class; Class = Class->GetSuperClass())
+        {
+            if (Class == SomeBase)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** 모든 클래스 쌍에서 IsChildOf가 Super 체인과 같고, 각 클래스의 구간이 정확히 자기와 파생 클래스인지 확인합니다. */
+    bool IsClassTreeConsistent()
+    {
+        const TArray<UClass*>& ClassTree = UClass::GetClassesInTreeOrder();
+        bool bConsistent = true;
+        for (int32 BaseIndex = 0; BaseIndex < ClassTree.Num(); ++BaseIndex)
+        {
+            const UClass* Base = ClassTree[BaseIndex];
+            bConsistent &= Base->GetClassTreeIndex() == static_cast<uint32>(BaseIndex);
+
+            uint32 NumDerived = 0;
+            for (int32 Index = 0; Index < ClassTree.Num(); ++Index)
+            {
+                const bool bExpected = IsChildOfBySuperWalk(ClassTree[Index], Base);
+                bConsistent &= ClassTree[Index]->IsChildOf(Base) == bExpected;
+
+                const bool bInInterval = Index >= BaseIndex && Index <= BaseIndex + static_cast<int32>(Base->GetNumDerivedClasses());
+                bConsistent &= bInInterval == bExpected;
+                NumDerived += bExpected && Index != BaseIndex ? 1 : 0;
+            }
+            bConsistent &= NumDerived == Base->GetNumDerivedClasses();
+            bConsistent &= !Base->IsChildOf(nullptr);
+        }
+        return bConsistent;
+    }
+
+    /** 클래스별 목록에서 각 Object가 자기 InternalIndex 자리에 있는지 확인합니다. */
+    bool AreInternalIndicesValid(const UClass* Class)
+    {
+        const TArray<UObject*>& ClassObjects = Class->GetClassObjects();
+        bool bValid = true;
+        for (int32 Index = 0; Index < ClassObjects.Num(); ++Index)
+        {
+            bValid &= ClassObjects[Index]->GetClass() == Class;
+            bValid &= ClassObjects[Index]->GetInternalIndex() == static_cast<uint32>(Index);
+        }
+        return bValid;
+    }
+
+    template <typename T>
+    std::set<UObject*> CollectRange(bool bIncludeDerivedClasses = true)
+    {
+        std::set<UObject*> Result;
+        for (T* Object : TObjectRange<T>(bIncludeDerivedClasses))
+        {
+            Result.insert(Object);
+        }
+        return Result;
+    }
+
+    void DestroyObjects(const TArray<UObject*>& Objects)
+    {
+        for (UObject* Object : Objects)
+        {
+            GUObjectArray.MarkRemoveObject(Object);
+        }
+        GUObjectArray.ProcessPendingDestroyObjects();
+    }
+}
+
+
+TEST_CASE(IsChildOfMatchesSuperChainForEveryClass)
+{
+    CHECK(IsClassTreeConsistent());
+
+    CHECK(UHashTestLeftChild::StaticClass()->IsChildOf<UHashTestBase>());
+    CHECK(UHashTestLeftChild::StaticClass()->IsChildOf<UObject>());
+    CHECK(!UHashTestLeftChild::StaticClass()->IsChildOf<UHashTestRight>());
+    CHECK(!UHashTestBase::StaticClass()->IsChildOf<UHashTestLeft>());
+    CHECK(UClass::StaticClass()->IsChildOf<UObject>());
+
+    UObject* Object = FObjectFactory::ConstructObject<UHashTestLeftChild>(nullptr);
+    CHECK(Object->IsA<UHashTestLeft>() && Object->IsA<UHashTestBase>() && Object->IsA<UObject>());
+    CHECK(!Object->IsA<UHashTestRight>());
+    CHECK(!Object->IsA(nullptr));
+    DestroyObjects({ Object });
+}
+
+TEST_CASE(ClassTreeIntervalsAreRebuiltAfterLateRegistration)
+{
+    UHashTestBase* Existing = FObjectFactory::ConstructObject<UHashTestLeftChild>(nullptr);
+    const uint32 NumBaseDerivedBefore = UHashTestBase::StaticClass()->GetNumDerivedClasses();
+    const int32 NumClassesBefore = UClass::GetClassesInTreeOrder().Num();
+
+    // 정적 초기화가 끝난 뒤에 가운데 클래스 아래와 새 루트에 클래스를 추가합니다.
+    const auto Construct = []() -> UObject*
+    {
+        void* RawMemory = FUObjectAllocator::Get().Allocate(sizeof(UHashTestLeft), alignof(UHashTestLeft));
+        return ::new (RawMemory) UHashTestLeft;
+    };
+    static UClass LateChild{ "UHashTestLateChild", sizeof(UHashTestLeft), alignof(UHashTestLeft), UHashTestLeft::StaticClass(), Construct };
+    static UClass LateGrandChild{ "UHashTestLateGrandChild", sizeof(UHashTestLeft), alignof(UHashTestLeft), &LateChild, Construct };
+    static UClass LateRoot{ "UHashTestLateRoot", sizeof(UHashTestLeft), alignof(UHashTestLeft), nullptr, Construct };
+
+    CHECK(UClass::GetClassesInTreeOrder().Num() == NumClassesBefore + 3);
+    CHECK(UHashTestBase::StaticClass()->GetNumDerivedClasses() == NumBaseDerivedBefore + 2);
+    CHECK(IsClassTreeConsistent());
+
+    CHECK(LateGrandChild.IsChildOf(UHashTestLeft::StaticClass()));
+    CHECK(LateGrandChild.IsChildOf(UHashTestBase::StaticClass()));
+    CHECK(!LateGrandChild.IsChildOf(UHashTestLeftChild::StaticClass()));
+    CHECK(LateGrandChild.IsChildOf(UObject::StaticClass()));
+    CHECK(!LateRoot.IsChildOf(UObject::StaticClass()));
+    CHECK(!UObject::StaticClass()->IsChildOf(&LateRoot));
+
+    // 새 클래스의 Object도 기존 클래스의 구간 순회에 들어가고, 전부터 있던 Object는 그대로 보입니다.
+    UObject* LateObject = FObjectFactory::ConstructObject(&LateGrandChild, nullptr);
+    CHECK(LateObject->IsA<UHashTestLeft>());
+    CHECK(!LateObject->IsA<UHashTestRight>());
+    const std::set<UObject*> LeftObjects = CollectRange<UHashTestLeft>();
+    CHECK(LeftObjects.contains(LateObject) && LeftObjects.contains(Existing));
+    CHECK(!CollectRange<UHashTestLeft>(false).contains(LateObject));
+
+    TArray<UClass*> Children;
+    GetChildOfClass(UHashTestLeft::StaticClass(), Children);
+    CHECK(Children.Num() == 4);
+    CHECK(Children.Contains(&LateChild) && Children.Contains(&LateGrandChild) && Children.Contains(UHashTestLeftChild::StaticClass()));
+
+    DestroyObjects({ Existing, LateObject });
+}
+
+TEST_CASE(RemoveSwapsTheLastObjectIntoTheHole)
+{
+    UClass* Class = UHashTestRight::StaticClass();
+    const int32 NumBefore = Class->GetClassObjects().Num();
+
+    TArray<UObject*> Objects;
+    for (int32 Index = 0; Index < 10; ++Index)
+    {
+        Objects.Add(FObjectFactory::ConstructObject<UHashTestRight>(nullptr));
+    }
+    CHECK(Class->GetClassObjects().Num() == NumBefore + 10);
+    CHECK(AreInternalIndicesValid(Class));
+
+    // 가운데를 지우면 마지막 Object가 그 자리로 옮겨 오고 InternalIndex도 바뀝니다.
+    UObject* Middle = Objects[4];
+    UObject* Last = Objects[9];
+    const uint32 MiddleIndex = Middle->GetInternalIndex();
+    RemoveFromClassMap(Middle);
+    CHECK(Middle->GetInternalIndex() == static_cast<uint32>(INDEX_NONE));
+    CHECK(Last->GetInternalIndex() == MiddleIndex);
+    CHECK(Class->GetClassObjects()[MiddleIndex] == Last);
+    CHECK(AreInternalIndicesValid(Class));
+
+    // 이미 지운 Object를 다시 지워도 다른 Object는 그대로입니다.
+    RemoveFromClassMap(Middle);
+    CHECK(Class->GetClassObjects().Num() == NumBefore + 9);
+    CHECK(AreInternalIndicesValid(Class));
+
+    // 마지막 Object는 자기 자신과 바꿉니다.
+    UObject* Tail = Class->GetClassObjects()[Class->GetClassObjects().Num() - 1];
+    RemoveFromClassMap(Tail);
+    CHECK(Tail->GetInternalIndex() == static_cast<uint32>(INDEX_NONE));
+    CHECK(AreInternalIndicesValid(Class));
+
+    // 나머지는 앞에서부터 지웁니다.
+    for (UObject* Object : Objects)
+    {
+        RemoveFromClassMap(Object);
+        CHECK(AreInternalIndicesValid(Class));
+    }
+    CHECK(Class->GetClassObjects().Num() == NumBefore);
+
+    // 클래스 목록에서 이미 빠졌으므로 MarkRemoveObject는 메모리만 정리합니다.
+    DestroyObjects(Objects);
+    CHECK(Class->GetClassObjects().Num() == NumBefore);
+}
+
+TEST_CASE(ObjectRangeVisitsEachObjectOfTheIntervalOnce)
+{
+    TArray<UObject*> Objects;
+    for (int32 Index = 0; Index < 40; ++Index)
+    {
+        switch (Index % 4)
+        {
+        case 0: Objects.Add(FObjectFactory::ConstructObject<UHashTestBase>(nullptr)); break;
+        case 1: Objects.Add(FObjectFactory::ConstructObject<UHashTestLeft>(nullptr)); break;
+        case 2: Objects.Add(FObjectFactory::ConstructObject<UHashTestLeftChild>(nullptr)); break;
+        default: Objects.Add(FObjectFactory::ConstructObject<UHashTestRight>(nullptr)); break;
+        }
+    }
+
+    // 순회 결과는 Super 체인으로 고른 Object와 같고, 중복이 없습니다.
+    int32 NumVisited = 0;
+    std::set<UObject*> Visited;
+    for (UHashTestLeft* Object : TObjectRange<UHashTestLeft>())
+    {
+        ++NumVisited;
+        Visited.insert(Object);
+    }
+    std::set<UObject*> Expected;
+    for (UObject* Object : GUObjectArray.GetObjectItemArrayUnsafe())
+    {
+        if (IsChildOfBySuperWalk(Object->GetClass(), UHashTestLeft::StaticClass()))
+        {
+            Expected.insert(Object);
+        }
+    }
+    CHECK(NumVisited == static_cast<int32>(Visited.size()));
+    CHECK(Visited == Expected);
+
+    TArray<UObject*> Found;
+    GetObjectsOfClass(UHashTestLeft::StaticClass(), Found, true);
+    CHECK(std::set<UObject*>(Found.begin(), Found.end()) == Expected);
+    Found.Empty();
+    GetObjectsOfClass(UHashTestLeft::StaticClass(), Found, false);
+    CHECK(std::set<UObject*>(Found.begin(), Found.end()) == CollectRange<UHashTestLeft>(false));
+    CHECK(std::all_of(Found.begin(), Found.end(), [](const UObject* Object) { return Object->GetClass() == UHashTestLeft::StaticClass(); }));
+
+    // 순회 중에 지금 Object를 지워도 나머지를 건너뛰지 않습니다.
+    const std::set<UObject*> BaseObjects = CollectRange<UHashTestBase>();
+    std::set<UObject*> Removed;
+    for (UHashTestBase* Object : TObjectRange<UHashTestBase>())
+    {
+        Removed.insert(Object);
+        GUObjectArray.MarkRemoveObject(Object);
+    }
+    CHECK(Removed == BaseObjects);
+    CHECK(CollectRange<UHashTestBase>().empty());
+    GUObjectArray.ProcessPendingDestroyObjects();
+}
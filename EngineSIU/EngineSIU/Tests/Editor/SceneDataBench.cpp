@@ -0,0 +1,214 @@
+#include "BenchHarness.h"
+#include <cerrno>
+#include <cstdlib>
+#include "UnrealEd/SceneData.h"
+
+using namespace NS_SceneManagerData;
+
+
+namespace
+{
+    /**
+     * FClassPropertyCodec 대신 "UBenchComponent"의 Transform과 몇 가지 값만 아는 Codec.
+     * 에디터 Scene에서 대부분의 Property가 바이너리로 저장되는 것과 비슷하게 만듭니다.
+     */
+    class FBenchPropertyCodec : public IScenePropertyCodec
+    {
+    public:
+        enum : uint8
+        {
+            Float = 1,
+            Bool = 2,
+            Vector = 3,
+        };
+
+        virtual uint8 FindPropertyType(const FString& ComponentClass, const FString& PropertyName) const override
+        {
+            if (ComponentClass != TEXT("UBenchComponent"))
+            {
+                return 0;
+            }
+            if (PropertyName == TEXT("RelativeLocation") || PropertyName == TEXT("RelativeRotation") || PropertyName == TEXT("RelativeScale3D")) return Vector;
+            if (PropertyName == TEXT("Intensity")) return Float;
+            if (PropertyName == TEXT("bVisible")) return Bool;
+            return 0;
+        }
+
+        virtual int32 GetValueSize(uint8 Type) const override
+        {
+            switch (Type)
+            {
+            case Float:  return sizeof(float);
+            case Bool:   return sizeof(bool);
+            case Vector: return sizeof(float) * 3;
+            default:     return 0;
+            }
+        }
+
+        virtual bool ImportText(uint8 Type, const FString& Text, void* OutValue) const override
+        {
+            const char* Begin = *Text;
+            char* End = nullptr;
+            errno = 0;
+            switch (Type)
+            {
+            case Float:
+                *static_cast<float*>(OutValue) = std::strtof(Begin, &End);
+                break;
+            case Bool:
+                *static_cast<bool*>(OutValue) = Text == TEXT("True");
+                return Text == TEXT("True") || Text == TEXT("False");
+            case Vector:
+            {
+                float* Components = static_cast<float*>(OutValue);
+                const char* Cursor = Begin;
+                for (int32 Index = 0; Index < 3; ++Index)
+                {
+                    Components[Index] = std::strtof(Cursor, &End);
+                    if (End == Cursor || (Index < 2 && *End != ','))
+                    {
+                        return false;
+                    }
+                    Cursor = End + (Index < 2 ? 1 : 0);
+                }
+                break;
+            }
+            default:
+                return false;
+            }
+            return errno == 0 && End != Begin && *End == '\0';
+        }
+
+        virtual void ExportText(uint8 Type, const void* Value, FString& OutText) const override
+        {
+            switch (Type)
+            {
+            case Float:
+                OutText = FString::Printf(TEXT("%g"), *static_cast<const float*>(Value));
+                break;
+            case Bool:
+                OutText = *static_cast<const bool*>(Value) ? TEXT("True") : TEXT("False");
+                break;
+            case Vector:
+            {
+                const float* Components = static_cast<const float*>(Value);
+                OutText = FString::Printf(TEXT("%g,%g,%g"), Components[0], Components[1], Components[2]);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        virtual bool IsValidValue(uint8 Type, const void* Value) const override
+        {
+            return Type != Bool || *static_cast<const uint8*>(Value) <= 1;
+        }
+    };
+
+    FString ExportValue(const FBenchPropertyCodec& Codec, uint8 Type, const void* Value)
+    {
+        FString Text;
+        Codec.ExportText(Type, Value, Text);
+        return Text;
+    }
+
+    /** Actor마다 Codec이 아는 Root 하나와 문자열로만 저장되는 Mesh 컴포넌트 하나를 가진 Scene. */
+    FSceneData MakeScene(const FBenchPropertyCodec& Codec, int32 NumActors)
+    {
+        FSceneData Scene;
+        Scene.Version = 1;
+        Scene.NextUUID = NumActors * 2;
+        Scene.Actors.Reserve(NumActors);
+        for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex)
+        {
+            FActorSaveData& Actor = Scene.Actors[Scene.Actors.Add(FActorSaveData())];
+            Actor.ActorID = FString::Printf(TEXT("AStaticMeshActor_%d"), ActorIndex);
+            Actor.ActorClass = TEXT("AStaticMeshActor");
+            Actor.ActorLabel = FString::Printf(TEXT("Cube %d"), ActorIndex);
+            Actor.RootComponentID = FString::Printf(TEXT("UBenchComponent_%d"), ActorIndex);
+
+            FComponentSaveData& Root = Actor.Components[Actor.Components.Add(FComponentSaveData())];
+            Root.ComponentID = Actor.RootComponentID;
+            Root.ComponentClass = TEXT("UBenchComponent");
+            const float Location[3] = { static_cast<float>(ActorIndex % 100) * 1.5f, static_cast<float>(ActorIndex / 100) * 1.5f, 0.25f };
+            const float Rotation[3] = { 0.0f, static_cast<float>(ActorIndex % 360), 0.0f };
+            const float Scale[3] = { 1.0f, 1.0f, 1.0f };
+            const float Intensity = static_cast<float>(ActorIndex % 17) / 3.0f;
+            const bool bVisible = ActorIndex % 4 != 0;
+            Root.Properties.Add(TEXT("RelativeLocation"), ExportValue(Codec, FBenchPropertyCodec::Vector, Location));
+            Root.Properties.Add(TEXT("RelativeRotation"), ExportValue(Codec, FBenchPropertyCodec::Vector, Rotation));
+            Root.Properties.Add(TEXT("RelativeScale3D"), ExportValue(Codec, FBenchPropertyCodec::Vector, Scale));
+            Root.Properties.Add(TEXT("Intensity"), ExportValue(Codec, FBenchPropertyCodec::Float, &Intensity));
+            Root.Properties.Add(TEXT("bVisible"), ExportValue(Codec, FBenchPropertyCodec::Bool, &bVisible));
+
+            FComponentSaveData& Mesh = Actor.Components[Actor.Components.Add(FComponentSaveData())];
+            Mesh.ComponentID = FString::Printf(TEXT("UStaticMeshComponent_%d"), ActorIndex);
+            Mesh.ComponentClass = TEXT("UStaticMeshComponent");
+            Mesh.Properties.Add(TEXT("StaticMeshPath"), TEXT("Contents/Mesh/Cube.obj"));
+            Mesh.Properties.Add(TEXT("AttachParent"), Actor.RootComponentID);
+        }
+        return Scene;
+    }
+}
+
+
+/**
+ * 같은 Scene을 Json과 바이너리로 쓰고 읽는 시간을 비교합니다.
+ * 콘솔의 "scene roundtrip"이 에디터 World로 재던 것을 World 없이 FSceneDataSerializer와 테스트용 Codec으로 잽니다.
+ * 인자로 Actor 수를 넘길 수 있습니다.
+ */
+int main(int Argc, char** Argv)
+{
+    const int32 NumActors = BenchHarness::GetIntArgument(Argc, Argv, 1, 20000);
+    constexpr int32 NumRuns = 5;
+
+    const FBenchPropertyCodec Codec;
+    const FSceneData Scene = MakeScene(Codec, NumActors);
+
+    FString JsonString;
+    const double JsonWriteMs = BenchHarness::MeasureBestMs(NumRuns, [&]
+    {
+        FSceneDataSerializer::SceneDataToJson(Scene, JsonString);
+    });
+
+    FSceneData FromJson;
+    bool bJsonRead = true;
+    const double JsonReadMs = BenchHarness::MeasureBestMs(NumRuns, [&]
+    {
+        FromJson = FSceneData();
+        bJsonRead &= FSceneDataSerializer::JsonToSceneData(JsonString, FromJson);
+    });
+
+    TArray<uint8> Binary;
+    const double BinaryWriteMs = BenchHarness::MeasureBestMs(NumRuns, [&]
+    {
+        Binary.Empty();
+        FSceneDataSerializer::SerializeToBinary(Scene, Codec, Binary);
+    });
+
+    FSceneData FromBinary;
+    bool bBinaryRead = true;
+    const double BinaryReadMs = BenchHarness::MeasureBestMs(NumRuns, [&]
+    {
+        FromBinary = FSceneData();
+        bBinaryRead &= FSceneDataSerializer::DeserializeFromBinary(Binary.GetData(), Binary.Num(), Codec, FromBinary);
+    });
+
+    const bool bJsonMatches = bJsonRead && FSceneDataSerializer::AreSceneDataEqual(Scene, FromJson);
+    const bool bBinaryMatches = bBinaryRead && FSceneDataSerializer::AreSceneDataEqual(Scene, FromBinary);
+
+    std::printf("Scene round trip, %d actors, %d components, best of %d runs\n", NumActors, NumActors * 2, NumRuns);
+    std::printf("  %8s %12s %12s %12s %8s\n", "format", "bytes", "write ms", "read ms", "match");
+    std::printf("  %8s %12d %12.3f %12.3f %8s\n", "json", JsonString.Len(), JsonWriteMs, JsonReadMs, bJsonMatches ? "yes" : "no");
+    std::printf("  %8s %12d %12.3f %12.3f %8s\n", "binary", Binary.Num(), BinaryWriteMs, BinaryReadMs, bBinaryMatches ? "yes" : "no");
+    std::printf("  binary speedup: write %.2fx, read %.2fx\n",
+        BinaryWriteMs > 0.0 ? JsonWriteMs / BinaryWriteMs : 0.0, BinaryReadMs > 0.0 ? JsonReadMs / BinaryReadMs : 0.0);
+
+    if (!bJsonMatches || !bBinaryMatches)
+    {
+        std::printf("Scene read back differs from the original\n");
+        return 1;
+    }
+    return 0;
+}
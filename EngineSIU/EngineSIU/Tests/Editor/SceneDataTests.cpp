@@ -0,0 +1,313 @@
+#include "TestHarness.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include "UnrealEd/SceneData.h"
+
+using namespace NS_SceneManagerData;
+
+
+namespace
+{
+    /**
+     * UClass 대신 "UTestComponent"의 Property 네 개만 아는 Codec.
+     * 문자열 형식은 엔진 Property와 다르지만, ExportText가 만든 문자열만 바이너리로 저장된다는 규칙은 같습니다.
+     */
+    class FTestPropertyCodec : public IScenePropertyCodec
+    {
+    public:
+        enum : uint8
+        {
+            Float = 1,
+            Int32 = 2,
+            Bool = 3,
+            Vector = 4,
+        };
+
+        virtual uint8 FindPropertyType(const FString& ComponentClass, const FString& PropertyName) const override
+        {
+            if (ComponentClass != TEXT("UTestComponent"))
+            {
+                return 0;
+            }
+            if (PropertyName == TEXT("Speed")) return Float;
+            if (PropertyName == TEXT("Count")) return Int32;
+            if (PropertyName == TEXT("bActive")) return Bool;
+            if (PropertyName == TEXT("RelativeLocation")) return Vector;
+            return 0;
+        }
+
+        virtual int32 GetValueSize(uint8 Type) const override
+        {
+            switch (Type)
+            {
+            case Float:  return sizeof(float);
+            case Int32:  return sizeof(int32);
+            case Bool:   return sizeof(bool);
+            case Vector: return sizeof(float) * 3;
+            default:     return 0;
+            }
+        }
+
+        virtual bool ImportText(uint8 Type, const FString& Text, void* OutValue) const override
+        {
+            const char* Begin = *Text;
+            char* End = nullptr;
+            errno = 0;
+            switch (Type)
+            {
+            case Float:
+                *static_cast<float*>(OutValue) = std::strtof(Begin, &End);
+                break;
+            case Int32:
+                *static_cast<int32*>(OutValue) = static_cast<int32>(std::strtol(Begin, &End, 10));
+                break;
+            case Bool:
+                *static_cast<bool*>(OutValue) = Text == TEXT("True");
+                return Text == TEXT("True") || Text == TEXT("False");
+            case Vector:
+            {
+                float* Components = static_cast<float*>(OutValue);
+                const char* Cursor = Begin;
+                for (int32 Index = 0; Index < 3; ++Index)
+                {
+                    Components[Index] = std::strtof(Cursor, &End);
+                    if (End == Cursor || (Index < 2 && *End != ','))
+                    {
+                        return false;
+                    }
+                    Cursor = End + (Index < 2 ? 1 : 0);
+                }
+                break;
+            }
+            default:
+                return false;
+            }
+            return errno == 0 && End != Begin && *End == '\0';
+        }
+
+        virtual void ExportText(uint8 Type, const void* Value, FString& OutText) const override
+        {
+            switch (Type)
+            {
+            case Float:
+                OutText = FString::Printf(TEXT("%g"), *static_cast<const float*>(Value));
+                break;
+            case Int32:
+                OutText = FString::Printf(TEXT("%d"), *static_cast<const int32*>(Value));
+                break;
+            case Bool:
+                OutText = *static_cast<const bool*>(Value) ? TEXT("True") : TEXT("False");
+                break;
+            case Vector:
+            {
+                const float* Components = static_cast<const float*>(Value);
+                OutText = FString::Printf(TEXT("%g,%g,%g"), Components[0], Components[1], Components[2]);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        virtual bool IsValidValue(uint8 Type, const void* Value) const override
+        {
+            return Type != Bool || *static_cast<const uint8*>(Value) <= 1;
+        }
+    };
+
+    /** 어떤 타입도 모르는 Codec. 바이너리 값이 있는 파일은 읽지 못해야 합니다. */
+    class FEmptyPropertyCodec : public IScenePropertyCodec
+    {
+    public:
+        virtual uint8 FindPropertyType(const FString&, const FString&) const override { return 0; }
+        virtual int32 GetValueSize(uint8) const override { return 0; }
+        virtual bool ImportText(uint8, const FString&, void*) const override { return false; }
+        virtual void ExportText(uint8, const void*, FString&) const override {}
+    };
+
+    FString ExportValue(const FTestPropertyCodec& Codec, uint8 Type, const void* Value)
+    {
+        FString Text;
+        Codec.ExportText(Type, Value, Text);
+        return Text;
+    }
+
+    /**
+     * 무작위 Scene. UTestComponent의 값은 대부분 Codec이 만든 문자열이라 바이너리로 저장되고,
+     * 일부는 Codec 형식이 아니거나 다시 만들면 달라지는 문자열이라 그대로 문자열로 저장됩니다.
+     */
+    FSceneData MakeScene(const FTestPropertyCodec& Codec, int32 NumActors, uint32 Seed)
+    {
+        std::mt19937 Random(Seed);
+        const TCHAR* ComponentClasses[] = { TEXT("USceneComponent"), TEXT("UStaticMeshComponent"), TEXT("UTestComponent"), TEXT("UTestComponent") };
+
+        FSceneData Scene;
+        Scene.Version = 1;
+        Scene.NextUUID = 1234;
+        for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex)
+        {
+            FActorSaveData& Actor = Scene.Actors[Scene.Actors.Add(FActorSaveData())];
+            Actor.ActorID = FString::Printf(TEXT("AActor_%d"), ActorIndex);
+            Actor.ActorClass = ActorIndex % 3 ? TEXT("AStaticMeshActor") : TEXT("APointLight");
+            Actor.ActorLabel = ActorIndex % 5 ? FString::Printf(TEXT("Label %d"), ActorIndex) : FString();
+            Actor.RootComponentID = FString::Printf(TEXT("Root_%d"), ActorIndex);
+
+            const int32 NumComponents = static_cast<int32>(Random() % 4);
+            for (int32 ComponentIndex = 0; ComponentIndex < NumComponents; ++ComponentIndex)
+            {
+                FComponentSaveData& Component = Actor.Components[Actor.Components.Add(FComponentSaveData())];
+                Component.ComponentID = FString::Printf(TEXT("Comp_%d_%d"), ActorIndex, ComponentIndex);
+                Component.ComponentClass = ComponentClasses[Random() % 4];
+
+                if (Component.ComponentClass == TEXT("UTestComponent"))
+                {
+                    const float Location[3] = { static_cast<float>(Random()) / 7.f, 1.f, -2.5f };
+                    const float Speed = static_cast<float>(Random()) / 3.f;
+                    const bool bActive = Random() % 2 == 0;
+                    const int32 Count = static_cast<int32>(Random());
+                    Component.Properties.Add(TEXT("RelativeLocation"), Random() % 8 ? ExportValue(Codec, FTestPropertyCodec::Vector, Location) : FString(TEXT("1, 2, 3")));
+                    Component.Properties.Add(TEXT("Speed"), Random() % 8 ? ExportValue(Codec, FTestPropertyCodec::Float, &Speed) : FString(TEXT("1.50")));
+                    Component.Properties.Add(TEXT("bActive"), ExportValue(Codec, FTestPropertyCodec::Bool, &bActive));
+                    Component.Properties.Add(TEXT("Count"), Random() % 5 ? ExportValue(Codec, FTestPropertyCodec::Int32, &Count) : FString(TEXT("12abc")));
+                }
+                else
+                {
+                    Component.Properties.Add(TEXT("RelativeLocation"), FString::Printf(TEXT("X=%f Y=%f Z=%f"), static_cast<float>(Random()), 1.f, 2.f));
+                    Component.Properties.Add(TEXT("RelativeRotation"), TEXT("P=0 Y=0 R=0"));
+                }
+                if (Random() % 2)
+                {
+                    Component.Properties.Add(TEXT("StaticMeshPath"), TEXT("Contents/Mesh/Cube.obj"));
+                }
+                if (Random() % 3 == 0)
+                {
+                    Component.Properties.Add(TEXT("Text"), FString());
+                }
+            }
+        }
+        return Scene;
+    }
+}
+
+
+TEST_CASE(JsonAndBinaryRoundTripsMatch)
+{
+    const FTestPropertyCodec Codec;
+    for (const int32 NumActors : { 0, 1, 10, 1000, 5000 })
+    {
+        const FSceneData Scene = MakeScene(Codec, NumActors, NumActors + 7);
+
+        FString Json;
+        CHECK(FSceneDataSerializer::SceneDataToJson(Scene, Json));
+        FSceneData FromJson;
+        CHECK(FSceneDataSerializer::JsonToSceneData(Json, FromJson));
+        CHECK(FSceneDataSerializer::AreSceneDataEqual(Scene, FromJson));
+
+        TArray<uint8> Binary;
+        FSceneDataSerializer::SerializeToBinary(Scene, Codec, Binary);
+        FSceneData FromBinary;
+        CHECK(FSceneDataSerializer::DeserializeFromBinary(Binary.GetData(), Binary.Num(), Codec, FromBinary));
+        CHECK(FSceneDataSerializer::AreSceneDataEqual(Scene, FromBinary));
+
+        // 바이너리는 파일 앞 4바이트로 구분합니다.
+        uint32 Magic = 0;
+        std::memcpy(&Magic, Binary.GetData(), sizeof(Magic));
+        CHECK(Magic == FSceneDataSerializer::BinarySceneMagic);
+
+        if (NumActors >= 1000)
+        {
+            CHECK(Binary.Num() < Json.Len());
+        }
+    }
+}
+
+TEST_CASE(TextThatDoesNotRoundTripIsKeptAsIs)
+{
+    const FTestPropertyCodec Codec;
+    FSceneData Scene;
+    FActorSaveData& Actor = Scene.Actors[Scene.Actors.Add(FActorSaveData())];
+    FComponentSaveData& Component = Actor.Components[Actor.Components.Add(FComponentSaveData())];
+    Component.ComponentClass = TEXT("UTestComponent");
+    // 읽을 수는 있지만 다시 쓰면 "1.5"가 되는 값, 읽을 수 없는 값, 타입을 모르는 값
+    Component.Properties.Add(TEXT("Speed"), TEXT("1.50"));
+    Component.Properties.Add(TEXT("Count"), TEXT("12abc"));
+    Component.Properties.Add(TEXT("bActive"), TEXT("yes"));
+    Component.Properties.Add(TEXT("Unknown"), TEXT("0.25"));
+
+    TArray<uint8> Binary;
+    FSceneDataSerializer::SerializeToBinary(Scene, Codec, Binary);
+    FSceneData FromBinary;
+    CHECK(FSceneDataSerializer::DeserializeFromBinary(Binary.GetData(), Binary.Num(), Codec, FromBinary));
+    CHECK(FSceneDataSerializer::AreSceneDataEqual(Scene, FromBinary));
+    CHECK(*FromBinary.Actors[0].Components[0].Properties.Find(TEXT("Speed")) == TEXT("1.50"));
+}
+
+TEST_CASE(DifferentScenesAreNotEqual)
+{
+    const FTestPropertyCodec Codec;
+    const FSceneData Scene = MakeScene(Codec, 20, 3);
+
+    FSceneData Changed = Scene;
+    Changed.Actors[0].ActorLabel = TEXT("Changed");
+    CHECK(!FSceneDataSerializer::AreSceneDataEqual(Scene, Changed));
+
+    Changed = Scene;
+    Changed.NextUUID += 1;
+    CHECK(!FSceneDataSerializer::AreSceneDataEqual(Scene, Changed));
+
+    // Property는 추가한 순서와 상관없이 이름과 값으로 비교합니다.
+    FSceneData Forward;
+    Forward.Actors.Add(FActorSaveData());
+    Forward.Actors[0].Components.Add(FComponentSaveData());
+    FSceneData Backward = Forward;
+    Forward.Actors[0].Components[0].Properties.Add(TEXT("A"), TEXT("10"));
+    Forward.Actors[0].Components[0].Properties.Add(TEXT("B"), TEXT("20"));
+    Backward.Actors[0].Components[0].Properties.Add(TEXT("B"), TEXT("20"));
+    Backward.Actors[0].Components[0].Properties.Add(TEXT("A"), TEXT("10"));
+    CHECK(FSceneDataSerializer::AreSceneDataEqual(Forward, Backward));
+
+    Backward.Actors[0].Components[0].Properties.Add(TEXT("A"), TEXT("30"));
+    CHECK(!FSceneDataSerializer::AreSceneDataEqual(Forward, Backward));
+}
+
+TEST_CASE(CorruptedBinaryFailsWithoutCrashing)
+{
+    const FTestPropertyCodec Codec;
+    const FSceneData Scene = MakeScene(Codec, 200, 11);
+    TArray<uint8> Binary;
+    FSceneDataSerializer::SerializeToBinary(Scene, Codec, Binary);
+
+    FSceneData Result;
+    FString Error;
+    CHECK(!FSceneDataSerializer::DeserializeFromBinary(Binary.GetData(), 8, Codec, Result, &Error));
+    CHECK(Error.Len() > 0);
+
+    TArray<uint8> WrongMagic = Binary;
+    WrongMagic[0] ^= 0xFF;
+    CHECK(!FSceneDataSerializer::DeserializeFromBinary(WrongMagic.GetData(), WrongMagic.Num(), Codec, Result));
+
+    // 바이너리 값의 타입을 모르는 Codec으로는 읽을 수 없습니다.
+    CHECK(!FSceneDataSerializer::DeserializeFromBinary(Binary.GetData(), Binary.Num(), FEmptyPropertyCodec(), Result));
+
+    // 잘리거나 바뀐 데이터는 실패하거나, 성공하더라도 메모리 밖을 읽지 않아야 합니다.
+    std::mt19937 Random(5);
+    for (int32 Trial = 0; Trial < 400; ++Trial)
+    {
+        TArray<uint8> Corrupted = Binary;
+        if (Trial % 2 == 0)
+        {
+            Corrupted.SetNum(static_cast<int32>(Random() % Corrupted.Num()));
+        }
+        else
+        {
+            for (int32 Flip = 0; Flip < 4; ++Flip)
+            {
+                Corrupted[static_cast<int32>(Random() % Corrupted.Num())] ^= static_cast<uint8>(1 + Random() % 255);
+            }
+        }
+        FSceneData Ignored;
+        FSceneDataSerializer::DeserializeFromBinary(Corrupted.GetData(), Corrupted.Num(), Codec, Ignored);
+    }
+}
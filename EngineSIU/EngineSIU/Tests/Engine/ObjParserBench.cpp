@@ -0,0 +1,88 @@
+#include "BenchHarness.h"
+#include "ObjReferenceParser.h"
+#include "Engine/ObjParser.h"
+#include "Async/JobSystem.h"
+#include "Container/Map.h"
+
+
+/**
+ * Contents 아래의 .obj 파일(또는 인자로 넘긴 파일)을 기존 istringstream 파서와 ObjParser로 각각 파싱해서 MB/s를 비교합니다.
+ * 파일 읽기 시간은 빼고 메모리에 올린 내용의 파싱 시간만 잽니다.
+ * 이어서 ConvertToStaticMesh의 정점 용접을 기존 "v/vt/vn" 문자열 Key 방식과 ObjParser::WeldVertexKeys로 비교합니다.
+ */
+int main(int Argc, char** Argv)
+{
+    std::vector<std::filesystem::path> Files;
+    for (int Index = 1; Index < Argc; ++Index)
+    {
+        Files.push_back(Argv[Index]);
+    }
+    if (Files.empty())
+    {
+        Files = ObjReferenceParser::FindObjFiles(ENGINE_CONTENTS_DIR);
+    }
+
+    std::printf("OBJ parse, %d threads\n", FJobSystem::Get().GetMaxConcurrency());
+    std::printf("  %-28s %9s %14s %14s %8s\n", "file", "MB", "reference MB/s", "ObjParser MB/s", "speedup");
+
+    std::vector<std::string> Texts;
+    for (const std::filesystem::path& File : Files)
+    {
+        const std::string& Text = Texts.emplace_back(ObjReferenceParser::ReadFile(File));
+        const double SizeMB = static_cast<double>(Text.size()) / (1024.0 * 1024.0);
+        const int NumRuns = SizeMB > 10.0 ? 3 : 10;
+
+        const double ReferenceMs = BenchHarness::MeasureBestMs(NumRuns, [&Text]
+        {
+            FObjInfo ObjInfo;
+            ObjReferenceParser::ParseObjText(Text, ObjInfo);
+        });
+        const double ParserMs = BenchHarness::MeasureBestMs(NumRuns, [&Text]
+        {
+            FObjInfo ObjInfo;
+            ObjParser::ParseObjText(Text.data(), Text.size(), ObjInfo);
+        });
+
+        std::printf("  %-28s %9.2f %14.1f %14.1f %7.1fx\n", File.filename().string().c_str(), SizeMB,
+            SizeMB / (ReferenceMs / 1000.0), SizeMB / (ParserMs / 1000.0), ReferenceMs / ParserMs);
+    }
+
+    std::printf("OBJ weld\n");
+    std::printf("  %-28s %9s %14s %14s %8s\n", "file", "corners", "string key ms", "WeldVertex ms", "speedup");
+
+    for (size_t FileIndex = 0; FileIndex < Files.size(); ++FileIndex)
+    {
+        FObjInfo RawData;
+        ObjParser::ParseObjText(Texts[FileIndex].data(), Texts[FileIndex].size(), RawData);
+        const int32 NumCorners = RawData.VertexIndices.Num();
+        const int NumRuns = NumCorners > 1000000 ? 3 : 10;
+
+        uint32 NumReferenceKeys = 0;
+        const double ReferenceMs = BenchHarness::MeasureBestMs(NumRuns, [&]
+        {
+            TMap<std::string, uint32> IndexMap;
+            for (int32 Corner = 0; Corner < NumCorners; ++Corner)
+            {
+                std::string Key = std::to_string(RawData.VertexIndices[Corner]) + "/" + std::to_string(RawData.UVIndices[Corner]) + "/" + std::to_string(RawData.NormalIndices[Corner]);
+                if (!IndexMap.Contains(Key))
+                {
+                    IndexMap.Add(Key, IndexMap.Num());
+                }
+            }
+            NumReferenceKeys = IndexMap.Num();
+        });
+
+        uint32 NumKeys = 0;
+        TArray<uint32> KeyIds;
+        const double WeldMs = BenchHarness::MeasureBestMs(NumRuns, [&]
+        {
+            NumKeys = ObjParser::WeldVertexKeys(RawData, RawData.MaterialSubsets, KeyIds);
+        });
+
+        std::printf("  %-28s %9d %14.3f %14.3f %7.1fx%s\n", Files[FileIndex].filename().string().c_str(), NumCorners,
+            ReferenceMs, WeldMs, ReferenceMs / WeldMs, NumKeys == NumReferenceKeys ? "" : "  (key count mismatch)");
+    }
+
+    FJobSystem::Get().Shutdown();
+    return 0;
+}
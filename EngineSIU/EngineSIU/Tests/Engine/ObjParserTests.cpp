@@ -0,0 +1,210 @@
+#include "TestHarness.h"
+#include <cstring>
+#include <map>
+#include <random>
+#include <tuple>
+#include "ObjReferenceParser.h"
+#include "Engine/ObjParser.h"
+
+
+namespace
+{
+    template <typename T>
+    bool AreArraysEqual(const TArray<T>& A, const TArray<T>& B)
+    {
+        return A.Num() == B.Num() && (A.Num() == 0 || std::memcmp(A.GetData(), B.GetData(), sizeof(T) * A.Num()) == 0);
+    }
+
+    bool AreObjInfosEqual(const FObjInfo& A, const FObjInfo& B)
+    {
+        if (!AreArraysEqual(A.Vertices, B.Vertices) || !AreArraysEqual(A.Normals, B.Normals) || !AreArraysEqual(A.UVs, B.UVs)
+            || !AreArraysEqual(A.VertexIndices, B.VertexIndices) || !AreArraysEqual(A.UVIndices, B.UVIndices) || !AreArraysEqual(A.NormalIndices, B.NormalIndices))
+        {
+            return false;
+        }
+        if (A.MatName != B.MatName || A.NumOfGroup != B.NumOfGroup || A.GroupName.Num() != B.GroupName.Num() || A.MaterialSubsets.Num() != B.MaterialSubsets.Num())
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < A.GroupName.Num(); ++Index)
+        {
+            if (A.GroupName[Index] != B.GroupName[Index])
+            {
+                return false;
+            }
+        }
+        for (int32 Index = 0; Index < A.MaterialSubsets.Num(); ++Index)
+        {
+            const FMaterialSubset& SubsetA = A.MaterialSubsets[Index];
+            const FMaterialSubset& SubsetB = B.MaterialSubsets[Index];
+            if (SubsetA.IndexStart != SubsetB.IndexStart || SubsetA.IndexCount != SubsetB.IndexCount || SubsetA.MaterialName != SubsetB.MaterialName)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ParsesLikeReference(const std::string& Text)
+    {
+        FObjInfo Expected;
+        ObjReferenceParser::ParseObjText(Text, Expected);
+
+        FObjInfo Actual;
+        ObjParser::ParseObjText(Text.data(), Text.size(), Actual);
+        return AreObjInfosEqual(Expected, Actual);
+    }
+
+    /** 여러 조각으로 나뉠 만큼 큰 OBJ 텍스트. Material과 Group이 조각 경계를 넘나들도록 섞습니다. */
+    std::string MakeLargeObjText(uint32 Seed, int32 NumFaces)
+    {
+        std::mt19937 Random(Seed);
+        std::uniform_real_distribution<float> Coordinate(-100.f, 100.f);
+
+        std::string Text = "mtllib large.mtl\r\n";
+        const int32 NumPositions = NumFaces / 2 + 3;
+        char Line[128];
+        for (int32 Index = 0; Index < NumPositions; ++Index)
+        {
+            std::snprintf(Line, sizeof(Line), "v %.6f %.6f %.6f\n", Coordinate(Random), Coordinate(Random), Coordinate(Random));
+            Text += Line;
+            std::snprintf(Line, sizeof(Line), "vt %.5f %.5f\n", Coordinate(Random) / 100.f, Coordinate(Random) / 100.f);
+            Text += Line;
+            std::snprintf(Line, sizeof(Line), "vn %.4f %.4f %.4f\n", Coordinate(Random) / 100.f, Coordinate(Random) / 100.f, Coordinate(Random) / 100.f);
+            Text += Line;
+        }
+
+        std::uniform_int_distribution<int32> Position(1, NumPositions);
+        for (int32 Face = 0; Face < NumFaces; ++Face)
+        {
+            if (Face % 5000 == 0)
+            {
+                std::snprintf(Line, sizeof(Line), "g Group%d\nusemtl Material%d\n", Face / 5000, Face / 5000 % 3);
+                Text += Line;
+            }
+            if (Face % 7 == 0)
+            {
+                std::snprintf(Line, sizeof(Line), "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n",
+                    Position(Random), Position(Random), Position(Random), Position(Random), Position(Random), Position(Random),
+                    Position(Random), Position(Random), Position(Random), Position(Random), Position(Random), Position(Random));
+            }
+            else
+            {
+                std::snprintf(Line, sizeof(Line), "f %d/%d/%d %d/%d/%d %d/%d/%d\n",
+                    Position(Random), Position(Random), Position(Random), Position(Random), Position(Random), Position(Random),
+                    Position(Random), Position(Random), Position(Random));
+            }
+            Text += Line;
+        }
+        return Text;
+    }
+}
+
+
+TEST_CASE(ShippedMeshesParseLikeReference)
+{
+    const std::vector<std::filesystem::path> Files = ObjReferenceParser::FindObjFiles(ENGINE_CONTENTS_DIR);
+    CHECK(!Files.empty());
+
+    for (const std::filesystem::path& File : Files)
+    {
+        const bool bEqual = ParsesLikeReference(ObjReferenceParser::ReadFile(File));
+        if (!bEqual)
+        {
+            std::printf("  mismatch: %s\n", File.string().c_str());
+        }
+        CHECK(bEqual);
+    }
+}
+
+TEST_CASE(EdgeCasesParseLikeReference)
+{
+    const char* const Cases[] = {
+        "",
+        "\n\n\n",
+        "# comment only",
+        // 마지막 줄에 개행이 없는 파일
+        "v 1 2 3\nv 4 5 6\nv 7 8 9\nf 1 2 3",
+        // CRLF, 탭, 여러 칸 공백
+        "mtllib box.mtl\r\nv 1 2 3\r\nv\t4  5\t6\r\nv 7 8 9\r\nvt 0.5 0.25\r\nvn 0 0 1\r\nusemtl Red\r\nf 1/1/1 2/1/1 3/1/1\r\n",
+        // v//vn, v/vt, v만 있는 Corner와 쿼드, 5각형(무시됨)
+        "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nvt 0 0\nvn 0 0 1\nf 1//1 2//1 3//1\nf 1/1 2/1 3/1 4/1\nf 1 2 3 4 1\n",
+        // 이름 없는 g / o / usemtl은 줄 전체가 이름이 됩니다.
+        "g\no\nusemtl\nv 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\ng Named\nusemtl Second\nf 3 2 1\n",
+        // 지수 표기와 부호
+        "v 1e2 -2.5E-1 +3\nv -0 .5 5.\nv 1 1 1\nf +1 +2 +3\n",
+        // 숫자가 아닌 좌표는 0이 되고 같은 줄의 나머지도 0입니다.
+        "v 1 abc 3\nvt x 1\nvn 1 2\n",
+        // Material을 여러 번 바꾸고 면이 없는 Subset
+        "v 0 0 0\nv 1 0 0\nv 0 1 0\nusemtl A\nusemtl B\nf 1 2 3\nusemtl A\nf 1 2 3\nf 2 3 1\n",
+        // 여러 mtllib은 마지막 것이 남습니다.
+        "mtllib first.mtl\nmtllib second.mtl\n",
+    };
+
+    for (const char* Case : Cases)
+    {
+        const bool bEqual = ParsesLikeReference(Case);
+        if (!bEqual)
+        {
+            std::printf("  mismatch:\n%s\n", Case);
+        }
+        CHECK(bEqual);
+    }
+}
+
+TEST_CASE(ChunkedParseMatchesReference)
+{
+    // 조각 최소 크기(1MB)보다 몇 배 큰 파일이라 여러 조각으로 나눠 파싱됩니다.
+    for (const uint32 Seed : { 1u, 2u })
+    {
+        const std::string Text = MakeLargeObjText(Seed, 120000);
+        CHECK(Text.size() > 4 * 1024 * 1024);
+        CHECK(ParsesLikeReference(Text));
+
+        // 조각 경계가 CRLF의 \r과 \n 사이에 떨어져도 같은 결과여야 합니다.
+        std::string CrLfText;
+        CrLfText.reserve(Text.size() + Text.size() / 16);
+        for (const char C : Text)
+        {
+            if (C == '\n')
+            {
+                CrLfText += '\r';
+            }
+            CrLfText += C;
+        }
+        CHECK(ParsesLikeReference(CrLfText));
+    }
+}
+
+TEST_CASE(WeldAssignsIdsInFirstSeenOrder)
+{
+    // 작은 메시는 한 번에, 큰 메시(64K Corner 이상)는 Subset 단위로 나눠 용접합니다.
+    for (const int32 NumFaces : { 10, 1000, 60000 })
+    {
+        const std::string Text = MakeLargeObjText(static_cast<uint32>(NumFaces), NumFaces);
+        FObjInfo RawData;
+        ObjParser::ParseObjText(Text.data(), Text.size(), RawData);
+
+        // 좌표 범위가 작아야 중복 Key가 생기므로 인덱스를 좁힙니다.
+        for (int32 Corner = 0; Corner < RawData.VertexIndices.Num(); ++Corner)
+        {
+            RawData.VertexIndices[Corner] %= 50;
+            RawData.UVIndices[Corner] %= 7;
+            RawData.NormalIndices[Corner] = Corner % 11 == 0 ? UINT32_MAX : RawData.NormalIndices[Corner] % 5;
+        }
+
+        TArray<uint32> KeyIds;
+        const uint32 NumKeys = ObjParser::WeldVertexKeys(RawData, RawData.MaterialSubsets, KeyIds);
+
+        std::map<std::tuple<uint32, uint32, uint32>, uint32> ExpectedIds;
+        bool bAllMatch = KeyIds.Num() == RawData.VertexIndices.Num();
+        for (int32 Corner = 0; Corner < RawData.VertexIndices.Num() && bAllMatch; ++Corner)
+        {
+            const auto Key = std::make_tuple(RawData.VertexIndices[Corner], RawData.UVIndices[Corner], RawData.NormalIndices[Corner]);
+            const auto [It, bInserted] = ExpectedIds.emplace(Key, static_cast<uint32>(ExpectedIds.size()));
+            bAllMatch = KeyIds[Corner] == It->second;
+        }
+        CHECK(bAllMatch);
+        CHECK(NumKeys == ExpectedIds.size());
+    }
+}
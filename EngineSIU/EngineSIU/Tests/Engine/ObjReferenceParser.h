@@ -0,0 +1,178 @@
+#pragma once
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Define.h"
+
+
+/**
+ * 병렬 파서로 바꾸기 전의 FLoaderOBJ::ParseOBJ 본문 (std::istringstream으로 한 줄씩 읽는 방식).
+ * ObjParser::ParseObjText의 결과를 비교하는 기준으로만 사용합니다.
+ * 원본은 읽기에 실패한 좌표가 초기화되지 않은 값이었으므로, 여기서는 0으로 초기화합니다.
+ */
+namespace ObjReferenceParser
+{
+    inline void ParseObjText(const std::string& Text, FObjInfo& OutObjInfo)
+    {
+        std::istringstream OBJ(Text);
+        std::string Line;
+
+        while (std::getline(OBJ, Line))
+        {
+            if (Line.empty() || Line[0] == '#')
+                continue;
+
+            std::istringstream LineStream(Line);
+            std::string Token;
+            LineStream >> Token;
+
+            if (Token == "mtllib")
+            {
+                LineStream >> Line;
+                OutObjInfo.MatName = Line;
+                continue;
+            }
+
+            if (Token == "usemtl")
+            {
+                LineStream >> Line;
+                FString MatName(Line);
+
+                if (!OutObjInfo.MaterialSubsets.IsEmpty())
+                {
+                    FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
+                    LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+                }
+
+                FMaterialSubset MaterialSubset;
+                MaterialSubset.MaterialName = MatName;
+                MaterialSubset.IndexStart = OutObjInfo.VertexIndices.Num();
+                MaterialSubset.IndexCount = 0;
+                OutObjInfo.MaterialSubsets.Add(MaterialSubset);
+            }
+
+            if (Token == "g" || Token == "o")
+            {
+                LineStream >> Line;
+                OutObjInfo.GroupName.Add(Line);
+                OutObjInfo.NumOfGroup++;
+            }
+
+            if (Token == "v")
+            {
+                float X = 0.f, Y = 0.f, Z = 0.f;
+                LineStream >> X >> Y >> Z;
+                OutObjInfo.Vertices.Add(FVector(X, Y * -1.f, Z));
+                continue;
+            }
+
+            if (Token == "vn")
+            {
+                float NormalX = 0.f, NormalY = 0.f, NormalZ = 0.f;
+                LineStream >> NormalX >> NormalY >> NormalZ;
+                OutObjInfo.Normals.Add(FVector(NormalX, NormalY * -1, NormalZ));
+                continue;
+            }
+
+            if (Token == "vt")
+            {
+                float U = 0.f, V = 0.f;
+                LineStream >> U >> V;
+                OutObjInfo.UVs.Add(FVector2D(U, 1.f - V));
+                continue;
+            }
+
+            if (Token == "f")
+            {
+                TArray<uint32> FaceVertexIndices;
+                TArray<uint32> FaceNormalIndices;
+                TArray<uint32> FaceUVIndices;
+
+                while (LineStream >> Token)
+                {
+                    std::istringstream TokenStream(Token);
+                    std::string Part;
+
+                    uint32 VertexIndex = 0;
+                    uint32 TextureIndex = UINT32_MAX;
+                    uint32 NormalIndex = UINT32_MAX;
+
+                    if (std::getline(TokenStream, Part, '/') && !Part.empty())
+                    {
+                        VertexIndex = std::stoi(Part) - 1;
+                    }
+                    if (std::getline(TokenStream, Part, '/') && !Part.empty())
+                    {
+                        TextureIndex = std::stoi(Part) - 1;
+                    }
+                    if (std::getline(TokenStream, Part, '/') && !Part.empty())
+                    {
+                        NormalIndex = std::stoi(Part) - 1;
+                    }
+
+                    FaceVertexIndices.Add(VertexIndex);
+                    FaceUVIndices.Add(TextureIndex);
+                    FaceNormalIndices.Add(NormalIndex);
+                }
+
+                auto AddTriangle = [&](int32 A, int32 B, int32 C)
+                {
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[A]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[B]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[C]);
+
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[A]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[B]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[C]);
+
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[A]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[B]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[C]);
+                };
+
+                if (FaceVertexIndices.Num() == 3)
+                {
+                    AddTriangle(0, 2, 1);
+                }
+                else if (FaceVertexIndices.Num() == 4)
+                {
+                    AddTriangle(0, 2, 1);
+                    AddTriangle(0, 3, 2);
+                }
+            }
+        }
+
+        if (!OutObjInfo.MaterialSubsets.IsEmpty())
+        {
+            FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
+            LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+        }
+    }
+
+    inline std::string ReadFile(const std::filesystem::path& FilePath)
+    {
+        std::ifstream File(FilePath, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+    }
+
+    /** Directory 아래의 모든 .obj 파일 (이름 순) */
+    inline std::vector<std::filesystem::path> FindObjFiles(const std::filesystem::path& Directory)
+    {
+        std::vector<std::filesystem::path> Files;
+        if (std::filesystem::exists(Directory))
+        {
+            for (const std::filesystem::directory_entry& Entry : std::filesystem::recursive_directory_iterator(Directory))
+            {
+                if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+                {
+                    Files.push_back(Entry.path());
+                }
+            }
+        }
+        std::sort(Files.begin(), Files.end());
+        return Files;
+    }
+}
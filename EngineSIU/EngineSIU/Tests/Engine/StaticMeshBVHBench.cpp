@@ -0,0 +1,94 @@
+#include "BenchHarness.h"
+#include "ObjReferenceParser.h"
+#include "StaticMeshTestUtils.h"
+#include "Async/JobSystem.h"
+#include "Components/Mesh/StaticMeshBVH.h"
+#include "Engine/ObjParser.h"
+
+
+/**
+ * Contents 아래의 .obj 파일(또는 인자로 넘긴 파일)로 피킹 Raycast를 비교합니다.
+ *   - build:  FStaticMeshBVH::Build 시간
+ *   - assign: Cook된 파일에서 읽은 노드로 FStaticMeshBVH::Assign 하는 시간 (.bin 캐시를 읽을 때)
+ *   - brute / bvh: Ray 하나당 모든 삼각형 테스트와 BVH 순회 시간
+ */
+int main(int Argc, char** Argv)
+{
+    std::vector<std::filesystem::path> Files;
+    for (int Index = 1; Index < Argc; ++Index)
+    {
+        Files.push_back(Argv[Index]);
+    }
+    if (Files.empty())
+    {
+        Files = ObjReferenceParser::FindObjFiles(ENGINE_CONTENTS_DIR);
+    }
+
+    constexpr int32 NumRays = 1000;
+    int32 NumMismatchedFiles = 0;
+
+    std::printf("Static mesh raycast, %d rays per mesh\n", NumRays);
+    std::printf("  %-24s %9s %9s %10s %10s %12s %12s %8s\n", "file", "triangles", "nodes", "build ms", "assign ms", "brute us/ray", "bvh us/ray", "speedup");
+
+    for (const std::filesystem::path& File : Files)
+    {
+        const std::string Text = ObjReferenceParser::ReadFile(File);
+        FObjInfo ObjInfo;
+        ObjParser::ParseObjText(Text.data(), Text.size(), ObjInfo);
+
+        OBJ::FStaticMeshRenderData RenderData;
+        StaticMeshTestUtils::MakeRenderData(ObjInfo, RenderData);
+
+        FStaticMeshBVH BVH;
+        const double BuildMs = BenchHarness::MeasureBestMs(5, [&]
+        {
+            BVH.Build(RenderData);
+        });
+
+        FStaticMeshBVH Loaded;
+        const double AssignMs = BenchHarness::MeasureBestMs(5, [&]
+        {
+            Loaded.Assign(BVH.GetNodes().GetData(), BVH.GetNumNodes(), BVH.GetPackets().GetData(), BVH.GetPackets().Num(), BVH.GetNumTriangles());
+        });
+
+        FVector BoundsMin, BoundsMax;
+        StaticMeshTestUtils::ComputeBounds(RenderData, BoundsMin, BoundsMax);
+
+        std::vector<FVector> Origins(NumRays), Directions(NumRays);
+        std::mt19937 Random(1);
+        for (int32 Ray = 0; Ray < NumRays; ++Ray)
+        {
+            StaticMeshTestUtils::MakeRandomRay(Random, BoundsMin, BoundsMax, Origins[Ray], Directions[Ray]);
+        }
+
+        int32 BruteHits = 0;
+        const double BruteMs = BenchHarness::MeasureBestMs(3, [&]
+        {
+            BruteHits = 0;
+            for (int32 Ray = 0; Ray < NumRays; ++Ray)
+            {
+                float Distance;
+                BruteHits += StaticMeshTestUtils::BruteForceIntersectRay(RenderData, Origins[Ray], Directions[Ray], Distance);
+            }
+        });
+
+        int32 BVHHits = 0;
+        const double BVHMs = BenchHarness::MeasureBestMs(10, [&]
+        {
+            BVHHits = 0;
+            for (int32 Ray = 0; Ray < NumRays; ++Ray)
+            {
+                float Distance;
+                BVHHits += Loaded.IntersectRay(Origins[Ray], Directions[Ray], Distance);
+            }
+        });
+
+        NumMismatchedFiles += BruteHits != BVHHits;
+        std::printf("  %-24s %9d %9d %10.3f %10.3f %12.2f %12.2f %7.1fx%s\n", File.filename().string().c_str(),
+            BVH.GetNumTriangles(), BVH.GetNumNodes(), BuildMs, AssignMs,
+            BruteMs * 1000.0 / NumRays, BVHMs * 1000.0 / NumRays, BruteMs / BVHMs, BruteHits == BVHHits ? "" : "  (hit count mismatch)");
+    }
+
+    FJobSystem::Get().Shutdown();
+    return NumMismatchedFiles == 0 ? 0 : 1;
+}
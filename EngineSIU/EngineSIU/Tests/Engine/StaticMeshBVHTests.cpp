@@ -0,0 +1,229 @@
+#include "TestHarness.h"
+#include "ObjReferenceParser.h"
+#include "StaticMeshTestUtils.h"
+#include "Components/Mesh/StaticMeshBVH.h"
+#include "Engine/ObjParser.h"
+
+
+namespace
+{
+    /** BVH와 모든 삼각형을 테스트한 결과가 같은 Ray의 비율을 확인합니다. 교차 수와 가장 가까운 거리를 모두 비교합니다. */
+    int32 CountMismatchedRays(const OBJ::FStaticMeshRenderData& RenderData, const FStaticMeshBVH& BVH, uint32 Seed, int32 NumRays)
+    {
+        FVector BoundsMin, BoundsMax;
+        StaticMeshTestUtils::ComputeBounds(RenderData, BoundsMin, BoundsMax);
+
+        std::mt19937 Random(Seed);
+        int32 NumMismatches = 0;
+        for (int32 Ray = 0; Ray < NumRays; ++Ray)
+        {
+            FVector Origin, Direction;
+            StaticMeshTestUtils::MakeRandomRay(Random, BoundsMin, BoundsMax, Origin, Direction);
+
+            float ExpectedDistance = -1.f;
+            const int32 ExpectedHits = StaticMeshTestUtils::BruteForceIntersectRay(RenderData, Origin, Direction, ExpectedDistance);
+
+            float Distance = -1.f;
+            const int32 NumHits = BVH.IntersectRay(Origin, Direction, Distance);
+
+            if (NumHits != ExpectedHits || (NumHits > 0 && std::fabs(Distance - ExpectedDistance) > 1e-4f * std::fmax(1.f, ExpectedDistance)))
+            {
+                ++NumMismatches;
+            }
+        }
+        return NumMismatches;
+    }
+
+    /** 서로 겹치는 임의의 삼각형. 한 Ray가 여러 삼각형과 교차합니다. */
+    void MakeTriangleSoup(uint32 Seed, int32 NumTriangles, bool bIndexed, OBJ::FStaticMeshRenderData& OutRenderData)
+    {
+        std::mt19937 Random(Seed);
+        std::uniform_real_distribution<float> Center(-50.f, 50.f);
+        std::uniform_real_distribution<float> Offset(-5.f, 5.f);
+
+        for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+        {
+            const FVector TriangleCenter(Center(Random), Center(Random), Center(Random));
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                FStaticMeshVertex Vertex = {};
+                Vertex.X = TriangleCenter.X + Offset(Random);
+                Vertex.Y = TriangleCenter.Y + Offset(Random);
+                Vertex.Z = TriangleCenter.Z + Offset(Random);
+                const int32 VertexIndex = OutRenderData.Vertices.Add(Vertex);
+                if (bIndexed)
+                {
+                    OutRenderData.Indices.Add(VertexIndex);
+                }
+            }
+        }
+    }
+}
+
+
+TEST_CASE(TriangleSoupMatchesBruteForce)
+{
+    for (const bool bIndexed : { true, false })
+    {
+        // Leaf 하나보다 작은 메시부터 수천 개의 노드가 생기는 메시까지
+        for (const int32 NumTriangles : { 1, 3, 7, 100, 5000 })
+        {
+            OBJ::FStaticMeshRenderData RenderData;
+            MakeTriangleSoup(static_cast<uint32>(NumTriangles), NumTriangles, bIndexed, RenderData);
+
+            FStaticMeshBVH BVH;
+            BVH.Build(RenderData);
+            CHECK(BVH.GetNumTriangles() == NumTriangles);
+            CHECK(CountMismatchedRays(RenderData, BVH, 42, 500) == 0);
+        }
+    }
+}
+
+TEST_CASE(DegenerateTrianglesDoNotBreakTheBuild)
+{
+    // 모든 Centroid가 한 점에 모이면 SAH로 나눌 수 없어서 개수로 반씩 나눕니다.
+    OBJ::FStaticMeshRenderData RenderData;
+    for (int32 Triangle = 0; Triangle < 1000; ++Triangle)
+    {
+        const float Size = 1.f + static_cast<float>(Triangle % 10);
+        for (const FVector& Position : { FVector(-Size, 0.f, -Size), FVector(Size, 0.f, -Size), FVector(0.f, 0.f, 2.f * Size) })
+        {
+            FStaticMeshVertex Vertex = {};
+            Vertex.X = Position.X;
+            Vertex.Y = Position.Y;
+            Vertex.Z = Position.Z;
+            RenderData.Indices.Add(RenderData.Vertices.Add(Vertex));
+        }
+    }
+
+    FStaticMeshBVH BVH;
+    BVH.Build(RenderData);
+    CHECK(!BVH.IsEmpty());
+
+    float Distance = -1.f;
+    CHECK(BVH.IntersectRay(FVector(0.f, -10.f, 0.f), FVector(0.f, 1.f, 0.f), Distance) == 1000);
+    CHECK_NEAR(Distance, 10.f, 1e-4f);
+    CHECK(CountMismatchedRays(RenderData, BVH, 7, 200) == 0);
+}
+
+TEST_CASE(ShippedMeshesMatchBruteForce)
+{
+    const std::vector<std::filesystem::path> Files = ObjReferenceParser::FindObjFiles(ENGINE_CONTENTS_DIR);
+    CHECK(!Files.empty());
+
+    for (const std::filesystem::path& File : Files)
+    {
+        const std::string Text = ObjReferenceParser::ReadFile(File);
+        FObjInfo ObjInfo;
+        ObjParser::ParseObjText(Text.data(), Text.size(), ObjInfo);
+
+        OBJ::FStaticMeshRenderData RenderData;
+        StaticMeshTestUtils::MakeRenderData(ObjInfo, RenderData);
+
+        FStaticMeshBVH BVH;
+        BVH.Build(RenderData);
+
+        const int32 NumMismatches = CountMismatchedRays(RenderData, BVH, 1, 200);
+        if (NumMismatches != 0)
+        {
+            std::printf("  %s: %d mismatched rays\n", File.filename().string().c_str(), NumMismatches);
+        }
+        CHECK(NumMismatches == 0);
+    }
+}
+
+TEST_CASE(AssignRestoresCookedTree)
+{
+    OBJ::FStaticMeshRenderData RenderData;
+    MakeTriangleSoup(3, 2000, true, RenderData);
+
+    FStaticMeshBVH Built;
+    Built.Build(RenderData);
+
+    const TArray<FStaticMeshBVH::FNode>& Nodes = Built.GetNodes();
+    const TArray<FStaticMeshBVH::FTrianglePacket>& Packets = Built.GetPackets();
+
+    FStaticMeshBVH Loaded;
+    CHECK(Loaded.Assign(Nodes.GetData(), Nodes.Num(), Packets.GetData(), Packets.Num(), Built.GetNumTriangles()));
+    CHECK(Loaded.GetNumNodes() == Built.GetNumNodes());
+    CHECK(Loaded.GetNumTriangles() == Built.GetNumTriangles());
+    CHECK(CountMismatchedRays(RenderData, Loaded, 11, 300) == 0);
+
+    // 빈 메시도 그대로 저장하고 읽을 수 있습니다.
+    FStaticMeshBVH Empty;
+    CHECK(Empty.Assign(nullptr, 0, nullptr, 0, 0));
+    CHECK(Empty.IsEmpty());
+    float Distance = -1.f;
+    CHECK(Empty.IntersectRay(FVector(0.f, 0.f, 0.f), FVector(1.f, 0.f, 0.f), Distance) == 0);
+}
+
+TEST_CASE(AssignRejectsMalformedTrees)
+{
+    OBJ::FStaticMeshRenderData RenderData;
+    MakeTriangleSoup(5, 300, true, RenderData);
+
+    FStaticMeshBVH Built;
+    Built.Build(RenderData);
+    const TArray<FStaticMeshBVH::FTrianglePacket>& Packets = Built.GetPackets();
+
+    int32 FirstInterior = -1;
+    int32 FirstLeaf = -1;
+    for (int32 NodeIndex = 0; NodeIndex < Built.GetNumNodes(); ++NodeIndex)
+    {
+        int32& Found = Built.GetNodes()[NodeIndex].IsLeaf() ? FirstLeaf : FirstInterior;
+        Found = Found < 0 ? NodeIndex : Found;
+    }
+    CHECK(FirstInterior == 0 && FirstLeaf > 0);
+
+    auto AssignModified = [&](auto&& Modify)
+    {
+        TArray<FStaticMeshBVH::FNode> Nodes = Built.GetNodes();
+        Modify(Nodes);
+
+        FStaticMeshBVH Loaded;
+        const bool bAssigned = Loaded.Assign(Nodes.GetData(), Nodes.Num(), Packets.GetData(), Packets.Num(), Built.GetNumTriangles());
+        CHECK(bAssigned || Loaded.IsEmpty());
+        return bAssigned;
+    };
+
+    CHECK(AssignModified([](TArray<FStaticMeshBVH::FNode>&) {}));
+
+    // 자식이 범위를 벗어남
+    CHECK(!AssignModified([](TArray<FStaticMeshBVH::FNode>& Nodes) { Nodes[0].LeftOrFirstPacket = Nodes.Num() - 1; }));
+    // 자식이 자기 자신을 가리켜 순환
+    CHECK(!AssignModified([](TArray<FStaticMeshBVH::FNode>& Nodes) { Nodes[0].LeftOrFirstPacket = 0; }));
+    // 두 노드가 같은 자식을 공유
+    CHECK(!AssignModified([](TArray<FStaticMeshBVH::FNode>& Nodes)
+    {
+        const uint32 LeftChild = Nodes[0].LeftOrFirstPacket;
+        Nodes[LeftChild].NumPackets = 0;
+        Nodes[LeftChild].LeftOrFirstPacket = LeftChild + 1;
+    }));
+    // Leaf의 Packet 범위가 배열을 넘어감
+    CHECK(!AssignModified([&](TArray<FStaticMeshBVH::FNode>& Nodes)
+    {
+        Nodes[FirstLeaf].LeftOrFirstPacket = static_cast<uint32>(Packets.Num());
+    }));
+    CHECK(!AssignModified([&](TArray<FStaticMeshBVH::FNode>& Nodes)
+    {
+        Nodes[FirstLeaf].NumPackets = UINT32_MAX;
+    }));
+
+    // 내부 노드를 한 줄로 이어 붙여서 깊이가 MaxBuildDepth를 넘으면 순회 스택을 넘으므로 거부합니다.
+    auto AssignChain = [&](int32 NumInteriorNodes)
+    {
+        TArray<FStaticMeshBVH::FNode> Chain;
+        Chain.SetNum(NumInteriorNodes * 2 + 1);
+        for (int32 NodeIndex = 0; NodeIndex < Chain.Num(); ++NodeIndex)
+        {
+            const bool bInterior = NodeIndex % 2 == 0 && NodeIndex / 2 < NumInteriorNodes;
+            Chain[NodeIndex].LeftOrFirstPacket = bInterior ? static_cast<uint32>(NodeIndex + 1) : 0;
+            Chain[NodeIndex].NumPackets = bInterior ? 0 : 1;
+        }
+
+        FStaticMeshBVH Loaded;
+        return Loaded.Assign(Chain.GetData(), Chain.Num(), Packets.GetData(), Packets.Num(), Built.GetNumTriangles());
+    };
+    CHECK(AssignChain(FStaticMeshBVH::MaxBuildDepth));
+    CHECK(!AssignChain(FStaticMeshBVH::MaxBuildDepth + 1));
+}
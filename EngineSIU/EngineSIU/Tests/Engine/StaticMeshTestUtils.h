@@ -0,0 +1,134 @@
+#pragma once
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include "Define.h"
+
+
+/**
+ * StaticMesh 테스트와 벤치마크에서 같이 사용하는 도구.
+ * FLoaderOBJ::ConvertToStaticMesh는 Texture와 UObject가 필요해서 헤드리스 빌드에 없으므로, Face Corner마다 정점을 하나씩 만드는 단순한 변환을 사용합니다.
+ */
+namespace StaticMeshTestUtils
+{
+    inline void MakeRenderData(const FObjInfo& ObjInfo, OBJ::FStaticMeshRenderData& OutRenderData)
+    {
+        OutRenderData.Vertices.Reserve(ObjInfo.VertexIndices.Num());
+        OutRenderData.Indices.Reserve(ObjInfo.VertexIndices.Num());
+        for (int32 Corner = 0; Corner < ObjInfo.VertexIndices.Num(); ++Corner)
+        {
+            const FVector& Position = ObjInfo.Vertices[ObjInfo.VertexIndices[Corner]];
+            FStaticMeshVertex Vertex = {};
+            Vertex.X = Position.X;
+            Vertex.Y = Position.Y;
+            Vertex.Z = Position.Z;
+            OutRenderData.Indices.Add(OutRenderData.Vertices.Add(Vertex));
+        }
+    }
+
+    /** UPrimitiveComponent::IntersectRayTriangle과 같은 계산 */
+    inline bool IntersectRayTriangle(const FVector& RayOrigin, const FVector& RayDirection, const FVector& V0, const FVector& V1, const FVector& V2, float& OutDistance)
+    {
+        constexpr float Epsilon = 1e-6f;
+        const FVector Edge1 = V1 - V0;
+        const FVector Edge2 = V2 - V0;
+        const FVector H = RayDirection.Cross(Edge2);
+        const float A = Edge1.Dot(H);
+        if (std::fabs(A) < Epsilon)
+        {
+            return false;
+        }
+
+        const float F = 1.0f / A;
+        const FVector S = RayOrigin - V0;
+        const float U = F * S.Dot(H);
+        if (U < 0.0f || U > 1.0f)
+        {
+            return false;
+        }
+
+        const FVector Q = S.Cross(Edge1);
+        const float V = F * RayDirection.Dot(Q);
+        if (V < 0.0f || U + V > 1.0f)
+        {
+            return false;
+        }
+
+        const float T = F * Edge2.Dot(Q);
+        if (T > Epsilon)
+        {
+            OutDistance = T;
+            return true;
+        }
+        return false;
+    }
+
+    /** BVH 이전의 UStaticMeshComponent::CheckRayIntersection처럼 모든 삼각형을 (0, 2, 1) 순서로 테스트합니다. */
+    inline int32 BruteForceIntersectRay(const OBJ::FStaticMeshRenderData& RenderData, const FVector& RayOrigin, const FVector& RayDirection, float& OutNearestDistance)
+    {
+        auto GetPosition = [&RenderData](uint32 VertexIndex)
+        {
+            const FStaticMeshVertex& Vertex = RenderData.Vertices[VertexIndex];
+            return FVector(Vertex.X, Vertex.Y, Vertex.Z);
+        };
+
+        const bool bIndexed = RenderData.Indices.Num() > 0;
+        const int32 NumTriangles = (bIndexed ? RenderData.Indices.Num() : RenderData.Vertices.Num()) / 3;
+
+        int32 NumHits = 0;
+        float NearestDistance = FLT_MAX;
+        for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+        {
+            FVector V0, V1, V2;
+            if (bIndexed)
+            {
+                V0 = GetPosition(RenderData.Indices[Triangle * 3]);
+                V1 = GetPosition(RenderData.Indices[Triangle * 3 + 2]);
+                V2 = GetPosition(RenderData.Indices[Triangle * 3 + 1]);
+            }
+            else
+            {
+                V0 = GetPosition(Triangle * 3);
+                V1 = GetPosition(Triangle * 3 + 1);
+                V2 = GetPosition(Triangle * 3 + 2);
+            }
+
+            float Distance;
+            if (IntersectRayTriangle(RayOrigin, RayDirection, V0, V1, V2, Distance))
+            {
+                ++NumHits;
+                NearestDistance = std::fmin(NearestDistance, Distance);
+            }
+        }
+
+        if (NumHits > 0)
+        {
+            OutNearestDistance = NearestDistance;
+        }
+        return NumHits;
+    }
+
+    /** 메시 Bounding Box 주변에서 시작해서 Box 안의 임의의 점을 향하는 Ray */
+    inline void MakeRandomRay(std::mt19937& Random, const FVector& BoundsMin, const FVector& BoundsMax, FVector& OutOrigin, FVector& OutDirection)
+    {
+        std::uniform_real_distribution<float> Unit(0.f, 1.f);
+        const FVector Size = BoundsMax - BoundsMin;
+        const FVector Center = (BoundsMin + BoundsMax) * 0.5f;
+
+        OutOrigin = Center + FVector((Unit(Random) - 0.5f) * Size.X, (Unit(Random) - 0.5f) * Size.Y, (Unit(Random) - 0.5f) * Size.Z) * 3.f;
+        const FVector Target = BoundsMin + FVector(Unit(Random) * Size.X, Unit(Random) * Size.Y, Unit(Random) * Size.Z);
+        OutDirection = (Target - OutOrigin).GetSafeNormal();
+    }
+
+    inline void ComputeBounds(const OBJ::FStaticMeshRenderData& RenderData, FVector& OutMin, FVector& OutMax)
+    {
+        OutMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+        OutMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (const FStaticMeshVertex& Vertex : RenderData.Vertices)
+        {
+            const FVector Position(Vertex.X, Vertex.Y, Vertex.Z);
+            OutMin = OutMin.ComponentMin(Position);
+            OutMax = OutMax.ComponentMax(Position);
+        }
+    }
+}
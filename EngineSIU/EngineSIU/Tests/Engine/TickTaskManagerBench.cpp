@@ -0,0 +1,124 @@
+#include "BenchHarness.h"
+#include <memory>
+#include "Async/JobSystem.h"
+#include "Math/MathUtility.h"
+#include "Math/Vector.h"
+#include "World/TickTaskManager.h"
+
+
+namespace
+{
+    /**
+     * UProjectileMovementComponent::TickComponent와 같은 계산을 하는 Tick.
+     * SetRelativeLocation처럼 병렬 Tick 중에는 Transform 갱신을 스레드별 버퍼에 넣습니다.
+     */
+    struct FProjectileTick : public FTickFunction
+    {
+        virtual void ExecuteTick(float DeltaTime) override
+        {
+            Velocity.Z += Gravity * DeltaTime;
+            if (Velocity.Length() > MaxSpeed)
+            {
+                Velocity = Velocity.GetSafeNormal() * MaxSpeed;
+            }
+            Location = Location + Velocity * DeltaTime;
+
+            if (FTickThreadContext* Context = FTickTaskManager::GetThreadContext())
+            {
+                Context->PendingTransformUpdates.Add(nullptr);
+            }
+        }
+
+        FVector Location = FVector::ZeroVector;
+        FVector Velocity = FVector::ZeroVector;
+        float MaxSpeed = 200.0f;
+        float Gravity = -9.8f;
+    };
+}
+
+
+/**
+ * 발사체 Tick을 스레드 수를 바꿔 가며 실행하고 한 프레임의 시간을 잽니다.
+ * 콘솔의 "tick bench"가 World에 Actor를 만들어 재던 것을 World 없이 FTickTaskManager::RunTicks로 잽니다.
+ * 인자로 발사체 수를 넘길 수 있습니다.
+ */
+int main(int Argc, char** Argv)
+{
+    const int32 NumProjectiles = BenchHarness::GetIntArgument(Argc, Argv, 1, 50000);
+    constexpr int32 NumFrames = 30;
+    constexpr float DeltaTime = 1.0f / 60.0f;
+
+    TArray<std::unique_ptr<FProjectileTick>> Projectiles;
+    TArray<FTickFunction*> Ticks;
+    for (int32 Index = 0; Index < NumProjectiles; ++Index)
+    {
+        Projectiles.Add(std::make_unique<FProjectileTick>());
+        Ticks.Add(Projectiles[Index].get());
+    }
+
+    const auto ResetProjectiles = [&Projectiles]
+    {
+        for (int32 Index = 0; Index < Projectiles.Num(); ++Index)
+        {
+            Projectiles[Index]->Location = FVector::ZeroVector;
+            Projectiles[Index]->Velocity = FVector(100.0f, static_cast<float>(Index % 7), 0.0f);
+        }
+    };
+
+    FTickTaskManager& TickTaskManager = FTickTaskManager::Get();
+    TArray<USceneComponent*> PendingTransformUpdates;
+    const auto MergeThreadContext = [&PendingTransformUpdates](FTickThreadContext& Context)
+    {
+        PendingTransformUpdates.Append(Context.PendingTransformUpdates);
+    };
+
+    std::printf("Tick, %d projectiles, %d frames\n", NumProjectiles, NumFrames);
+    std::printf("  %8s %12s %9s\n", "threads", "ms/frame", "speedup");
+
+    const int32 NumAvailableThreads = FJobSystem::Get().GetNumWorkers() + 1;
+    double SingleThreadMs = 0.0;
+    double SingleThreadChecksum = 0.0;
+    bool bResultsMatch = true;
+    for (int32 NumThreads = 1; ; NumThreads = FMath::Min(NumThreads * 2, NumAvailableThreads))
+    {
+        TickTaskManager.SetMaxThreads(NumThreads);
+
+        // Transform 캐시 갱신은 Tick과 별개로 메인 스레드에서 하므로 측정에서 뺍니다.
+        const double FrameMs = BenchHarness::MeasureBestMs(5, [&]
+        {
+            ResetProjectiles();
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                TickTaskManager.RunTicks(Ticks, DeltaTime, MergeThreadContext);
+                PendingTransformUpdates.Empty();
+            }
+        }) / NumFrames;
+
+        double Checksum = 0.0;
+        for (const std::unique_ptr<FProjectileTick>& Projectile : Projectiles)
+        {
+            Checksum += Projectile->Location.X + Projectile->Location.Y + Projectile->Location.Z;
+        }
+
+        if (NumThreads == 1)
+        {
+            SingleThreadMs = FrameMs;
+            SingleThreadChecksum = Checksum;
+        }
+        bResultsMatch &= Checksum == SingleThreadChecksum;
+        std::printf("  %8d %12.3f %8.2fx\n", NumThreads, FrameMs, FrameMs > 0.0 ? SingleThreadMs / FrameMs : 0.0);
+
+        if (NumThreads == NumAvailableThreads)
+        {
+            break;
+        }
+    }
+    TickTaskManager.SetMaxThreads(0);
+
+    if (!bResultsMatch)
+    {
+        std::printf("Results differ between thread counts\n");
+        return 1;
+    }
+    return 0;
+}
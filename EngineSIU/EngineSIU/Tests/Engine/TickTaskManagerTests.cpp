@@ -0,0 +1,320 @@
+#include "TestHarness.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include "World/TickTaskManager.h"
+
+
+namespace
+{
+    /**
+     * 실행 순서와 실행한 스레드를 기록하는 Tick.
+     * 같은 단계의 Tick은 여러 스레드에서 동시에 실행되므로, 순서는 모든 Tick이 함께 쓰는 Clock에서 받습니다.
+     */
+    struct FRecordingTick : public FTickFunction
+    {
+        explicit FRecordingTick(std::atomic<int32>& InClock, ETickingGroup InTickGroup = TG_PrePhysics)
+            : Clock(InClock)
+        {
+            TickGroup = InTickGroup;
+        }
+
+        virtual void ExecuteTick(float DeltaTime) override
+        {
+            Order = Clock.fetch_add(1);
+            ThreadId = std::this_thread::get_id();
+            bInParallelTick = FTickTaskManager::IsInParallelTick();
+            ++NumTicks;
+            if (OnTick)
+            {
+                OnTick();
+            }
+        }
+
+        std::atomic<int32>& Clock;
+        std::function<void()> OnTick;
+
+        int32 Order = -1;
+        int32 NumTicks = 0;
+        std::thread::id ThreadId;
+        bool bInParallelTick = false;
+    };
+
+    /** 병렬 경로를 타도록 MinParallelTicks보다 많은 Tick을 만듭니다. */
+    TArray<std::unique_ptr<FRecordingTick>> MakeTicks(std::atomic<int32>& Clock, int32 Num, ETickingGroup TickGroup = TG_PrePhysics)
+    {
+        TArray<std::unique_ptr<FRecordingTick>> Ticks;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Ticks.Add(std::make_unique<FRecordingTick>(Clock, TickGroup));
+        }
+        return Ticks;
+    }
+
+    void AppendTicks(TArray<FTickFunction*>& OutTicks, const TArray<std::unique_ptr<FRecordingTick>>& Ticks)
+    {
+        for (const std::unique_ptr<FRecordingTick>& Tick : Ticks)
+        {
+            OutTicks.Add(Tick.get());
+        }
+    }
+
+    int32 MaxOrder(const TArray<std::unique_ptr<FRecordingTick>>& Ticks)
+    {
+        int32 Result = -1;
+        for (const std::unique_ptr<FRecordingTick>& Tick : Ticks)
+        {
+            Result = Tick->Order > Result ? Tick->Order : Result;
+        }
+        return Result;
+    }
+
+    int32 MinOrder(const TArray<std::unique_ptr<FRecordingTick>>& Ticks)
+    {
+        int32 Result = INT32_MAX;
+        for (const std::unique_ptr<FRecordingTick>& Tick : Ticks)
+        {
+            Result = Tick->Order < Result ? Tick->Order : Result;
+        }
+        return Result;
+    }
+}
+
+
+TEST_CASE(PrerequisitesSplitAGroupIntoLayers)
+{
+    std::atomic<int32> Clock = 0;
+    TArray<std::unique_ptr<FRecordingTick>> Fillers = MakeTicks(Clock, 200);
+    FRecordingTick A(Clock), B(Clock), C(Clock), D(Clock);
+    B.AddPrerequisite(A);
+    C.AddPrerequisite(B);
+    D.AddPrerequisite(A);
+
+    // 넣는 순서와 관계없이 선행 Tick이 먼저 실행됩니다.
+    TArray<FTickFunction*> Ticks = { &C, &D, &B };
+    AppendTicks(Ticks, Fillers);
+    Ticks.Add(&A);
+
+    FTickTaskManager& Manager = FTickTaskManager::Get();
+    Manager.SetMaxThreads(0);
+    Manager.RunTicks(Ticks, 1.0f / 60.0f);
+
+    CHECK(A.Order < B.Order && B.Order < C.Order);
+    CHECK(A.Order < D.Order);
+    CHECK(MaxOrder(Fillers) < B.Order && MaxOrder(Fillers) < D.Order);
+    CHECK(A.NumTicks == 1 && B.NumTicks == 1 && C.NumTicks == 1 && D.NumTicks == 1);
+    CHECK(Manager.GetStats().NumTicks == 204);
+    CHECK(Manager.GetStats().NumLayers == 3);
+
+    // 선행 관계를 끊으면 같은 단계에 들어갑니다.
+    C.RemovePrerequisite(B);
+    Manager.RunTicks(Ticks, 1.0f / 60.0f);
+    CHECK(Manager.GetStats().NumLayers == 2);
+}
+
+TEST_CASE(PrerequisiteCyclesAndSkippedTicksAreIgnored)
+{
+    std::atomic<int32> Clock = 0;
+    FRecordingTick CycleA(Clock), CycleB(Clock);
+    CycleA.AddPrerequisite(CycleB);
+    CycleB.AddPrerequisite(CycleA);
+
+    // 이번 프레임에 Tick하지 않는 선행 Tick은 기다리지 않습니다.
+    FRecordingTick NotGathered(Clock), Disabled(Clock);
+    Disabled.bCanEverTick = false;
+    FRecordingTick WaitsForNotGathered(Clock), WaitsForDisabled(Clock);
+    WaitsForNotGathered.AddPrerequisite(NotGathered);
+    WaitsForDisabled.AddPrerequisite(Disabled);
+
+    // 소멸한 선행 Tick은 자동으로 끊어집니다.
+    FRecordingTick WaitsForDestroyed(Clock);
+    {
+        FRecordingTick Destroyed(Clock);
+        WaitsForDestroyed.AddPrerequisite(Destroyed);
+    }
+
+    const TArray<FTickFunction*> Ticks = { &CycleA, &CycleB, &Disabled, &WaitsForNotGathered, &WaitsForDisabled, &WaitsForDestroyed };
+    FTickTaskManager& Manager = FTickTaskManager::Get();
+    Manager.RunTicks(Ticks, 1.0f / 60.0f);
+
+    CHECK(CycleA.NumTicks == 1 && CycleB.NumTicks == 1);
+    CHECK(NotGathered.NumTicks == 0 && Disabled.NumTicks == 0);
+    CHECK(WaitsForNotGathered.NumTicks == 1 && WaitsForDisabled.NumTicks == 1 && WaitsForDestroyed.NumTicks == 1);
+    CHECK(Manager.GetStats().NumTicks == 5);
+
+    // 순환 중 하나만 다른 쪽을 기다리므로 단계는 둘입니다.
+    CHECK(Manager.GetStats().NumLayers == 2);
+}
+
+TEST_CASE(TickGroupsRunInOrder)
+{
+    std::atomic<int32> Clock = 0;
+    TArray<std::unique_ptr<FRecordingTick>> PostUpdateWork = MakeTicks(Clock, 100, TG_PostUpdateWork);
+    TArray<std::unique_ptr<FRecordingTick>> DuringPhysics = MakeTicks(Clock, 100, TG_DuringPhysics);
+    TArray<std::unique_ptr<FRecordingTick>> PrePhysics = MakeTicks(Clock, 100, TG_PrePhysics);
+
+    // 선행 Tick이 더 늦은 그룹에 있으면 그 그룹의 다음 단계로 미뤄집니다.
+    FRecordingTick Deferred(Clock, TG_PrePhysics);
+    Deferred.AddPrerequisite(*PostUpdateWork[0]);
+
+    TArray<FTickFunction*> Ticks = { &Deferred };
+    AppendTicks(Ticks, PostUpdateWork);
+    AppendTicks(Ticks, DuringPhysics);
+    AppendTicks(Ticks, PrePhysics);
+
+    FTickTaskManager& Manager = FTickTaskManager::Get();
+    Manager.RunTicks(Ticks, 1.0f / 60.0f);
+
+    CHECK(MaxOrder(PrePhysics) < MinOrder(DuringPhysics));
+    CHECK(MaxOrder(DuringPhysics) < MinOrder(PostUpdateWork));
+    CHECK(MaxOrder(PostUpdateWork) < Deferred.Order);
+    CHECK(Manager.GetStats().NumLayers == 4);
+}
+
+TEST_CASE(MainThreadTicksRunOnTheCallingThreadAfterTheParallelTicks)
+{
+    std::atomic<int32> Clock = 0;
+    TArray<std::unique_ptr<FRecordingTick>> AnyThread = MakeTicks(Clock, 256);
+    TArray<std::unique_ptr<FRecordingTick>> MainThread = MakeTicks(Clock, 8);
+    for (const std::unique_ptr<FRecordingTick>& Tick : MainThread)
+    {
+        Tick->bRunOnAnyThread = false;
+    }
+
+    TArray<FTickFunction*> Ticks;
+    AppendTicks(Ticks, MainThread);
+    AppendTicks(Ticks, AnyThread);
+
+    FTickTaskManager& Manager = FTickTaskManager::Get();
+    for (const int32 MaxThreads : { 1, 0 })
+    {
+        Manager.SetMaxThreads(MaxThreads);
+        Manager.RunTicks(Ticks, 1.0f / 60.0f);
+
+        bool bMainOnCallingThread = true;
+        for (const std::unique_ptr<FRecordingTick>& Tick : MainThread)
+        {
+            bMainOnCallingThread &= Tick->ThreadId == std::this_thread::get_id() && !Tick->bInParallelTick;
+        }
+        CHECK(bMainOnCallingThread);
+
+        // 스레드를 하나로 제한하면 병렬 Tick도 호출한 스레드에서 실행하지만, 병렬 Tick의 버퍼는 그대로 씁니다.
+        bool bAnyInParallelTick = true;
+        bool bAnyOnCallingThread = true;
+        for (const std::unique_ptr<FRecordingTick>& Tick : AnyThread)
+        {
+            bAnyInParallelTick &= Tick->bInParallelTick;
+            bAnyOnCallingThread &= Tick->ThreadId == std::this_thread::get_id();
+        }
+        CHECK(bAnyInParallelTick);
+        CHECK(MaxThreads != 1 || bAnyOnCallingThread);
+
+        // 같은 단계의 병렬 Tick이 모두 끝난 뒤에 실행합니다.
+        CHECK(MaxOrder(AnyThread) < MinOrder(MainThread));
+        CHECK(Manager.GetStats().NumMainThreadTicks == 8);
+        CHECK(Manager.GetStats().NumLayers == 1);
+    }
+}
+
+TEST_CASE(CommandsFromParallelTicksRunAtTheGroupBoundary)
+{
+    std::atomic<int32> Clock = 0;
+    TArray<std::unique_ptr<FRecordingTick>> PrePhysics = MakeTicks(Clock, 200, TG_PrePhysics);
+    TArray<std::unique_ptr<FRecordingTick>> DuringPhysics = MakeTicks(Clock, 100, TG_DuringPhysics);
+
+    // AActor::Destroy처럼 병렬 Tick 중의 Destroy는 명령으로 미뤄지고, 그 뒤 그룹의 Tick은 건너뜁니다.
+    bool bVictimDestroyed = false;
+    int32 DestroyOrder = -1;
+    PrePhysics[0]->OnTick = [&]
+    {
+        CHECK(FTickTaskManager::IsInParallelTick());
+        FTickTaskManager::Get().EnqueueCommand([&]
+        {
+            CHECK(!FTickTaskManager::IsInParallelTick());
+            bVictimDestroyed = true;
+            DestroyOrder = Clock.fetch_add(1);
+        });
+        CHECK(!bVictimDestroyed);
+    };
+
+    FRecordingTick VictimSameGroup(Clock, TG_PrePhysics);
+    FRecordingTick VictimLaterGroup(Clock, TG_DuringPhysics);
+    int32 NumLaterGroupUpdates = 0;
+    VictimSameGroup.OnTick = [&] { CHECK(!bVictimDestroyed); };
+    VictimLaterGroup.OnTick = [&]
+    {
+        if (!bVictimDestroyed)
+        {
+            ++NumLaterGroupUpdates;
+        }
+    };
+
+    TArray<FTickFunction*> Ticks = { &VictimLaterGroup, &VictimSameGroup };
+    AppendTicks(Ticks, PrePhysics);
+    AppendTicks(Ticks, DuringPhysics);
+
+    FTickTaskManager& Manager = FTickTaskManager::Get();
+    Manager.RunTicks(Ticks, 1.0f / 60.0f);
+
+    CHECK(bVictimDestroyed);
+    CHECK(MaxOrder(PrePhysics) < DestroyOrder && VictimSameGroup.Order < DestroyOrder);
+    CHECK(DestroyOrder < MinOrder(DuringPhysics) && DestroyOrder < VictimLaterGroup.Order);
+    CHECK(VictimLaterGroup.NumTicks == 1 && NumLaterGroupUpdates == 0);
+    CHECK(Manager.GetStats().NumCommands == 1);
+
+    // 병렬 Tick 밖에서는 바로 실행합니다.
+    bool bRanImmediately = false;
+    Manager.EnqueueCommand([&bRanImmediately] { bRanImmediately = true; });
+    CHECK(bRanImmediately);
+}
+
+TEST_CASE(ThreadContextsAreMergedAtEveryGroupBoundary)
+{
+    std::atomic<int32> Clock = 0;
+    TArray<std::unique_ptr<FRecordingTick>> PrePhysics = MakeTicks(Clock, 150, TG_PrePhysics);
+    TArray<std::unique_ptr<FRecordingTick>> PostUpdateWork = MakeTicks(Clock, 70, TG_PostUpdateWork);
+    for (TArray<std::unique_ptr<FRecordingTick>>* Group : { &PrePhysics, &PostUpdateWork })
+    {
+        for (const std::unique_ptr<FRecordingTick>& Tick : *Group)
+        {
+            Tick->OnTick = []
+            {
+                FTickThreadContext* Context = FTickTaskManager::GetThreadContext();
+                Context->PendingTransformUpdates.Add(nullptr);
+                Context->DirtyPrimitives.Add(nullptr);
+            };
+        }
+    }
+
+    TArray<FTickFunction*> Ticks;
+    AppendTicks(Ticks, PrePhysics);
+    AppendTicks(Ticks, PostUpdateWork);
+
+    TArray<int32> MergedPerGroup;
+    int32 NumMergedDirtyPrimitives = 0;
+    FTickTaskManager& Manager = FTickTaskManager::Get();
+    Manager.RunTicks(Ticks, 1.0f / 60.0f, [&](FTickThreadContext& Context)
+    {
+        if (MergedPerGroup.Num() == 0 || Clock.load() != MergedPerGroup[MergedPerGroup.Num() - 1])
+        {
+            MergedPerGroup.Add(Clock.load());
+        }
+        NumMergedDirtyPrimitives += Context.DirtyPrimitives.Num();
+        CHECK(Context.PendingTransformUpdates.Num() == Context.DirtyPrimitives.Num());
+    });
+
+    // 각 그룹이 끝났을 때 그 그룹까지의 Tick이 모두 실행되어 있습니다.
+    CHECK(MergedPerGroup.Num() == 2 && MergedPerGroup[0] == 150 && MergedPerGroup[1] == 220);
+    CHECK(NumMergedDirtyPrimitives == 220);
+
+    // 합치지 않은 목록은 다음 프레임으로 넘어가지 않습니다.
+    Manager.RunTicks(Ticks, 1.0f / 60.0f);
+    NumMergedDirtyPrimitives = 0;
+    Manager.RunTicks({}, 1.0f / 60.0f, [&](FTickThreadContext& Context)
+    {
+        NumMergedDirtyPrimitives += Context.DirtyPrimitives.Num();
+    });
+    CHECK(NumMergedDirtyPrimitives == 0);
+}
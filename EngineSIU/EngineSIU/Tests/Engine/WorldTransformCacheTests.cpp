@@ -0,0 +1,158 @@
+#include "TestHarness.h"
+#include <random>
+#include <vector>
+#include "Components/WorldTransformCache.h"
+#include "Math/Quat.h"
+
+
+namespace
+{
+    /** 캐시를 도입하기 전 USceneComponent처럼 매번 부모 방향으로 재귀하며 계산하는 기준 구현 */
+    struct FReferenceNode
+    {
+        FVector RelativeLocation;
+        FRotator RelativeRotation;
+        FVector RelativeScale3D;
+        const FReferenceNode* Parent = nullptr;
+
+        FMatrix GetScaleMatrix() const
+        {
+            const FMatrix ScaleMat = FMatrix::GetScaleMatrix(RelativeScale3D);
+            return Parent ? ScaleMat * Parent->GetScaleMatrix() : ScaleMat;
+        }
+
+        FMatrix GetRotationMatrix() const
+        {
+            const FMatrix RotationMat = FMatrix::GetRotationMatrix(RelativeRotation);
+            return Parent ? RotationMat * Parent->GetRotationMatrix() : RotationMat;
+        }
+
+        FMatrix GetTranslationMatrix() const
+        {
+            const FMatrix TranslationMat = FMatrix::GetTranslationMatrix(RelativeLocation);
+            return Parent ? TranslationMat * Parent->GetTranslationMatrix() : TranslationMat;
+        }
+
+        FMatrix GetWorldMatrix() const
+        {
+            FMatrix ScaleMat = FMatrix::GetScaleMatrix(RelativeScale3D);
+            FMatrix RTMat = FMatrix::GetRotationMatrix(RelativeRotation) * FMatrix::GetTranslationMatrix(RelativeLocation);
+            if (Parent)
+            {
+                ScaleMat = ScaleMat * Parent->GetScaleMatrix();
+                RTMat = RTMat * (Parent->GetRotationMatrix() * Parent->GetTranslationMatrix());
+            }
+            return ScaleMat * RTMat;
+        }
+
+        FVector GetWorldLocation() const { return Parent ? Parent->GetWorldLocation() + RelativeLocation : RelativeLocation; }
+        FVector GetWorldScale3D() const { return Parent ? Parent->GetWorldScale3D() * RelativeScale3D : RelativeScale3D; }
+        FRotator GetWorldRotation() const
+        {
+            return Parent ? FRotator(Parent->GetWorldRotation().ToQuaternion() * RelativeRotation.ToQuaternion()) : RelativeRotation;
+        }
+    };
+
+    float MaxDifference(const FMatrix& A, const FMatrix& B)
+    {
+        float Difference = 0.f;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Column = 0; Column < 4; ++Column)
+            {
+                Difference = std::fmax(Difference, std::fabs(A.M[Row][Column] - B.M[Row][Column]));
+            }
+        }
+        return Difference;
+    }
+
+    void RandomizeNode(std::mt19937& Random, FReferenceNode& Node)
+    {
+        std::uniform_real_distribution<float> Location(-100.f, 100.f);
+        std::uniform_real_distribution<float> Angle(-180.f, 180.f);
+        std::uniform_real_distribution<float> Scale(0.25f, 3.f);
+        Node.RelativeLocation = FVector(Location(Random), Location(Random), Location(Random));
+        Node.RelativeRotation = FRotator(Angle(Random), Angle(Random), Angle(Random));
+        Node.RelativeScale3D = FVector(Scale(Random), Scale(Random), Scale(Random));
+    }
+
+    /** 부모부터 차례로 캐시를 갱신합니다. USceneComponent::ConditionalUpdateWorldTransform과 같은 순서입니다. */
+    void UpdateChain(const std::vector<FReferenceNode>& Nodes, std::vector<FWorldTransformCache>& Caches)
+    {
+        for (size_t Index = 0; Index < Nodes.size(); ++Index)
+        {
+            const FReferenceNode& Node = Nodes[Index];
+            Caches[Index].Update(Index > 0 ? &Caches[Index - 1] : nullptr, Node.RelativeLocation, Node.RelativeRotation, Node.RelativeScale3D);
+        }
+    }
+
+    /** 행렬 원소는 위치 값(최대 수백)에 비례하는 오차를 허용합니다. */
+    void CheckMatchesReference(const FReferenceNode& Node, const FWorldTransformCache& Cache)
+    {
+        CHECK(MaxDifference(Cache.WorldMatrix, Node.GetWorldMatrix()) <= 1e-3f);
+        CHECK(MaxDifference(Cache.WorldRotationMatrix, Node.GetRotationMatrix()) <= 1e-5f);
+        CHECK(Cache.WorldLocation == Node.GetWorldLocation());
+        CHECK(Cache.WorldScale3D == Node.GetWorldScale3D());
+
+        const FRotator Expected = Node.GetWorldRotation();
+        CHECK(Cache.WorldRotation.Pitch == Expected.Pitch && Cache.WorldRotation.Yaw == Expected.Yaw && Cache.WorldRotation.Roll == Expected.Roll);
+    }
+}
+
+
+TEST_CASE(CachedTransformsMatchRecursiveComposition)
+{
+    std::mt19937 Random(12);
+    for (int32 Depth = 1; Depth <= 6; ++Depth)
+    {
+        for (int32 Trial = 0; Trial < 50; ++Trial)
+        {
+            std::vector<FReferenceNode> Nodes(Depth);
+            for (int32 Index = 0; Index < Depth; ++Index)
+            {
+                RandomizeNode(Random, Nodes[Index]);
+                Nodes[Index].Parent = Index > 0 ? &Nodes[Index - 1] : nullptr;
+            }
+
+            std::vector<FWorldTransformCache> Caches(Depth);
+            UpdateChain(Nodes, Caches);
+            for (int32 Index = 0; Index < Depth; ++Index)
+            {
+                CheckMatchesReference(Nodes[Index], Caches[Index]);
+            }
+        }
+    }
+}
+
+TEST_CASE(RootCacheIsRelativeTransform)
+{
+    FWorldTransformCache Cache;
+    Cache.Update(nullptr, FVector(1.f, 2.f, 3.f), FRotator(0.f, 0.f, 0.f), FVector(1.f, 1.f, 1.f));
+    CHECK(MaxDifference(Cache.WorldMatrix, FMatrix::GetTranslationMatrix(FVector(1.f, 2.f, 3.f))) == 0.f);
+    CHECK(MaxDifference(Cache.WorldRotationMatrix, FMatrix::Identity) == 0.f);
+    CHECK(Cache.WorldLocation == FVector(1.f, 2.f, 3.f));
+}
+
+TEST_CASE(ParentChangeIsVisibleAfterRecomputingTheSubtree)
+{
+    // 부모의 Relative 값이 바뀐 뒤 부모에서 자식 순서로 다시 계산하면 처음부터 계산한 값과 같아야 합니다.
+    std::mt19937 Random(5);
+    std::vector<FReferenceNode> Nodes(4);
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        RandomizeNode(Random, Nodes[Index]);
+        Nodes[Index].Parent = Index > 0 ? &Nodes[Index - 1] : nullptr;
+    }
+
+    std::vector<FWorldTransformCache> Caches(4);
+    UpdateChain(Nodes, Caches);
+    const FMatrix LeafBefore = Caches[3].WorldMatrix;
+
+    RandomizeNode(Random, Nodes[1]);
+    UpdateChain(Nodes, Caches);
+    CHECK(MaxDifference(LeafBefore, Caches[3].WorldMatrix) > 1e-2f);
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        CheckMatchesReference(Nodes[Index], Caches[Index]);
+    }
+}
@@ -0,0 +1,163 @@
+#include "TestHarness.h"
+#include <cstdint>
+#include <random>
+#include "Renderer/BillboardDrawList.h"
+
+
+namespace
+{
+    /** 테스트는 Texture를 읽지 않으므로 번호로 만든 가짜 포인터를 씁니다. */
+    ID3D11ShaderResourceView* MakeTexture(uintptr_t Id)
+    {
+        return reinterpret_cast<ID3D11ShaderResourceView*>(Id * 16);
+    }
+
+    ID3D11SamplerState* MakeSampler(uintptr_t Id)
+    {
+        return reinterpret_cast<ID3D11SamplerState*>(Id * 16);
+    }
+
+    /** 추가한 순서를 Position.X에 넣어 두고, 옮겨 담은 뒤의 순서를 확인합니다. */
+    FBillboardInstanceData MakeInstance(int32 Order)
+    {
+        FBillboardInstanceData Instance = {};
+        Instance.Position = FVector(static_cast<float>(Order), 0.f, 0.f);
+        return Instance;
+    }
+}
+
+
+TEST_CASE(EmptyListBuildsNothing)
+{
+    FBillboardDrawList List;
+    TArray<FBillboardInstanceData> Instances;
+    TArray<FBillboardDrawBatch> Batches;
+    List.BuildBatches(Instances, Batches);
+    CHECK(Instances.IsEmpty());
+    CHECK(Batches.IsEmpty());
+}
+
+TEST_CASE(InstancesAreGroupedByTextureInFirstSeenOrder)
+{
+    // A B A C B A  ->  [A: 0 2 5] [B: 1 4] [C: 3]
+    FBillboardDrawList List;
+    const uintptr_t TextureIds[] = { 1, 2, 1, 3, 2, 1 };
+    for (int32 Order = 0; Order < 6; ++Order)
+    {
+        List.AddBillboard(MakeTexture(TextureIds[Order]), MakeSampler(TextureIds[Order]), MakeInstance(Order));
+    }
+    CHECK(List.Num() == 6);
+    CHECK(List.NumBatches() == 3);
+
+    TArray<FBillboardInstanceData> Instances;
+    TArray<FBillboardDrawBatch> Batches;
+    List.BuildBatches(Instances, Batches);
+    CHECK(Instances.Num() == 6);
+    CHECK(Batches.Num() == 3);
+    CHECK(Batches[0].TextureSRV == MakeTexture(1) && Batches[0].FirstInstance == 0 && Batches[0].NumInstances == 3);
+    CHECK(Batches[1].TextureSRV == MakeTexture(2) && Batches[1].FirstInstance == 3 && Batches[1].NumInstances == 2);
+    CHECK(Batches[2].TextureSRV == MakeTexture(3) && Batches[2].FirstInstance == 5 && Batches[2].NumInstances == 1);
+    CHECK(Batches[1].SamplerState == MakeSampler(2));
+
+    const float ExpectedOrder[] = { 0, 2, 5, 1, 4, 3 };
+    for (int32 Index = 0; Index < 6; ++Index)
+    {
+        CHECK(Instances[Index].Position.X == ExpectedOrder[Index]);
+    }
+
+    // 출력 배열에 이전 내용이 있어도 덮어쓰고, 여러 번 만들어도 같은 결과입니다.
+    Instances.Add(MakeInstance(100));
+    List.BuildBatches(Instances, Batches);
+    CHECK(Instances.Num() == 6);
+    CHECK(Batches.Num() == 3 && Batches[0].NumInstances == 3);
+    CHECK(Instances[5].Position.X == 3.f);
+
+    List.Reset();
+    CHECK(List.Num() == 0);
+    CHECK(List.NumBatches() == 0);
+    List.BuildBatches(Instances, Batches);
+    CHECK(Instances.IsEmpty() && Batches.IsEmpty());
+}
+
+TEST_CASE(EveryInstanceIsPackedOnceIntoItsTextureBatch)
+{
+    std::mt19937 Random(7);
+    FBillboardDrawList List;
+    TArray<FBillboardInstanceData> Instances;
+    TArray<FBillboardDrawBatch> Batches;
+    for (int32 Trial = 0; Trial < 50; ++Trial)
+    {
+        List.Reset();
+        const int32 NumBillboards = static_cast<int32>(Random() % 500);
+        const uint32 NumTextures = 1 + Random() % 9;
+        TArray<uintptr_t> TextureIds;
+        for (int32 Order = 0; Order < NumBillboards; ++Order)
+        {
+            const uintptr_t TextureId = 1 + Random() % NumTextures;
+            TextureIds.Add(TextureId);
+            List.AddBillboard(MakeTexture(TextureId), nullptr, MakeInstance(Order));
+        }
+
+        List.BuildBatches(Instances, Batches);
+        CHECK(Instances.Num() == NumBillboards);
+
+        // Batch 범위는 빈틈없이 이어지고, 각 범위 안에서는 추가한 순서를 지킵니다.
+        TArray<int32> NumSeen;
+        NumSeen.SetNum(NumBillboards);
+        uint32 NextInstance = 0;
+        for (const FBillboardDrawBatch& Batch : Batches)
+        {
+            CHECK(Batch.FirstInstance == NextInstance);
+            CHECK(Batch.NumInstances > 0);
+            NextInstance += Batch.NumInstances;
+
+            int32 PreviousOrder = -1;
+            for (uint32 Index = Batch.FirstInstance; Index < Batch.FirstInstance + Batch.NumInstances; ++Index)
+            {
+                const int32 Order = static_cast<int32>(Instances[Index].Position.X);
+                CHECK(MakeTexture(TextureIds[Order]) == Batch.TextureSRV);
+                CHECK(Order > PreviousOrder);
+                PreviousOrder = Order;
+                ++NumSeen[Order];
+            }
+        }
+        CHECK(NextInstance == static_cast<uint32>(NumBillboards));
+        for (int32 Order = 0; Order < NumBillboards; ++Order)
+        {
+            CHECK(NumSeen[Order] == 1);
+        }
+
+        // Texture마다 Batch는 하나입니다.
+        for (int32 A = 0; A < Batches.Num(); ++A)
+        {
+            for (int32 B = A + 1; B < Batches.Num(); ++B)
+            {
+                CHECK(Batches[A].TextureSRV != Batches[B].TextureSRV);
+            }
+        }
+    }
+}
+
+TEST_CASE(InstanceDataIsCopiedUnchanged)
+{
+    FBillboardInstanceData Instance;
+    Instance.Position = FVector(1.f, 2.f, 3.f);
+    Instance.Size = FVector2D(4.f, 5.f);
+    Instance.UVOffset = FVector2D(0.25f, 0.5f);
+    Instance.UVScale = FVector2D(0.125f, 0.25f);
+    Instance.UUIDColor = FVector4(0.1f, 0.2f, 0.3f, 1.f);
+
+    FBillboardDrawList List;
+    List.AddBillboard(MakeTexture(2), nullptr, MakeInstance(0));
+    List.AddBillboard(MakeTexture(1), nullptr, Instance);
+
+    TArray<FBillboardInstanceData> Instances;
+    TArray<FBillboardDrawBatch> Batches;
+    List.BuildBatches(Instances, Batches);
+    const FBillboardInstanceData& Packed = Instances[Batches[1].FirstInstance];
+    CHECK(Packed.Position.X == 1.f && Packed.Position.Y == 2.f && Packed.Position.Z == 3.f);
+    CHECK(Packed.Size.X == 4.f && Packed.Size.Y == 5.f);
+    CHECK(Packed.UVOffset.X == 0.25f && Packed.UVOffset.Y == 0.5f);
+    CHECK(Packed.UVScale.X == 0.125f && Packed.UVScale.Y == 0.25f);
+    CHECK(Packed.UUIDColor.X == 0.1f && Packed.UUIDColor.W == 1.f);
+}
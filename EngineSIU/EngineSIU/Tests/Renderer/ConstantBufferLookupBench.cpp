@@ -0,0 +1,123 @@
+#include "BenchHarness.h"
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "D3D11RHI/ConstantBufferId.h"
+
+
+/**
+ * 상수 버퍼 조회 비교. D3D 장치 없이 ID3D11Buffer* 대신 가짜 포인터를 찾습니다.
+ *   - string: 이전 FDXDBufferManager처럼 매번 TArray<FString> Key 목록을 만들고 TMap<FString, ...>에서 찾기
+ *   - indexed: FConstantBufferBindList처럼 FConstantBufferId 번호로 배열에서 찾기
+ * 한 번의 반복은 StaticMeshRenderPass의 Draw 하나와 같이 Pixel Shader 버퍼 7개를 바인딩하고 버퍼 하나를 갱신합니다.
+ */
+namespace
+{
+    struct FPerObjectConstantBuffer {};
+    struct FCameraConstantBuffer {};
+    struct FSubUVConstant {};
+    struct FMaterialConstants {};
+    struct FTextureConstants {};
+    struct FLighting {};
+    struct FLitUnlitConstants {};
+    struct FScreenConstants {};
+    struct FFogConstants {};
+    struct FRenderNormalConstants {};
+    struct FUnusedConstants {};
+
+    struct FFakeBuffer
+    {
+        int32 Slot;
+    };
+
+    template <typename... TBuffers>
+    TArray<uint32> MakeBufferIds()
+    {
+        TArray<uint32> BufferIds;
+        (BufferIds.Add(FConstantBufferId::Value<TBuffers>), ...);
+        return BufferIds;
+    }
+}
+
+
+int main(int Argc, char** Argv)
+{
+    const int32 NumDraws = BenchHarness::GetIntArgument(Argc, Argv, 1, 200000);
+
+    const TArray<uint32> AllIds = MakeBufferIds<
+        FPerObjectConstantBuffer, FCameraConstantBuffer, FSubUVConstant, FMaterialConstants, FTextureConstants,
+        FLighting, FLitUnlitConstants, FScreenConstants, FFogConstants, FRenderNormalConstants
+    >();
+    const TArray<FString> AllKeys = {
+        TEXT("FPerObjectConstantBuffer"), TEXT("FCameraConstantBuffer"), TEXT("FSubUVConstant"), TEXT("FMaterialConstants"), TEXT("FTextureConstants"),
+        TEXT("FLightBuffer"), TEXT("FLitUnlitConstants"), TEXT("FScreenConstants"), TEXT("FFogConstants"), TEXT("FRenderNormalConstants")
+    };
+
+    FFakeBuffer Buffers[10];
+    TMap<FString, FFakeBuffer*> BufferPool;
+    TArray<FFakeBuffer*> BuffersById;
+    for (int32 Index = 0; Index < AllIds.Num(); ++Index)
+    {
+        Buffers[Index].Slot = Index;
+        BufferPool.Add(AllKeys[Index], &Buffers[Index]);
+        if (static_cast<int32>(AllIds[Index]) >= BuffersById.Num())
+        {
+            BuffersById.SetNum(AllIds[Index] + 1);
+        }
+        BuffersById[AllIds[Index]] = &Buffers[Index];
+    }
+
+    // 등록하지 않은 타입은 nullptr를 찾아야 합니다.
+    const uint32 UnusedId = FConstantBufferId::Value<FUnusedConstants>;
+    if (static_cast<int32>(UnusedId) < BuffersById.Num() && BuffersById[UnusedId] != nullptr)
+    {
+        return 1;
+    }
+
+    int64 StringChecksum = 0;
+    const double StringMs = BenchHarness::MeasureBestMs(5, [&]
+    {
+        StringChecksum = 0;
+        for (int32 Draw = 0; Draw < NumDraws; ++Draw)
+        {
+            const TArray<FString> PSBufferKeys = {
+                TEXT("FCameraConstantBuffer"), TEXT("FLightBuffer"), TEXT("FMaterialConstants"), TEXT("FLitUnlitConstants"),
+                TEXT("FSubUVConstant"), TEXT("FTextureConstants"), TEXT("FRenderNormalConstants")
+            };
+            for (const FString& Key : PSBufferKeys)
+            {
+                FFakeBuffer* const* Found = BufferPool.Find(Key);
+                StringChecksum += Found ? (*Found)->Slot : -1;
+            }
+            FFakeBuffer* const* Updated = BufferPool.Find(TEXT("FPerObjectConstantBuffer"));
+            StringChecksum += Updated ? (*Updated)->Slot : -1;
+        }
+    });
+
+    const TArray<uint32> PSBufferIds = MakeBufferIds<
+        FCameraConstantBuffer, FLighting, FMaterialConstants, FLitUnlitConstants,
+        FSubUVConstant, FTextureConstants, FRenderNormalConstants
+    >();
+    int64 IndexedChecksum = 0;
+    const double IndexedMs = BenchHarness::MeasureBestMs(5, [&]
+    {
+        IndexedChecksum = 0;
+        for (int32 Draw = 0; Draw < NumDraws; ++Draw)
+        {
+            for (const uint32 Id : PSBufferIds)
+            {
+                FFakeBuffer* Found = static_cast<int32>(Id) < BuffersById.Num() ? BuffersById[Id] : nullptr;
+                IndexedChecksum += Found ? Found->Slot : -1;
+            }
+            const uint32 UpdatedId = FConstantBufferId::Value<FPerObjectConstantBuffer>;
+            FFakeBuffer* Updated = static_cast<int32>(UpdatedId) < BuffersById.Num() ? BuffersById[UpdatedId] : nullptr;
+            IndexedChecksum += Updated ? Updated->Slot : -1;
+        }
+    });
+
+    std::printf("Constant buffer lookup, %d draws (7 binds + 1 update each)\n", NumDraws);
+    std::printf("  string keys : %8.3f ms  (%7.2f ns/draw)\n", StringMs, StringMs * 1e6 / NumDraws);
+    std::printf("  indexed     : %8.3f ms  (%7.2f ns/draw, x%.1f)\n", IndexedMs, IndexedMs * 1e6 / NumDraws, StringMs / IndexedMs);
+
+    return StringChecksum == IndexedChecksum ? 0 : 1;
+}
@@ -0,0 +1,56 @@
+#include "BenchHarness.h"
+#include "TestMath.h"
+#include <random>
+#include "Renderer/FrustumCulling.h"
+
+
+int main(int Argc, char** Argv)
+{
+    const int32 NumBounds = BenchHarness::GetIntArgument(Argc, Argv, 1, 1000000);
+
+    std::mt19937 Random(1234);
+    std::uniform_real_distribution<float> Position(-300.f, 300.f);
+    std::uniform_real_distribution<float> Extent(0.1f, 20.f);
+
+    TArray<FCullBounds> Bounds;
+    Bounds.Reserve(NumBounds);
+    for (int32 Index = 0; Index < NumBounds; ++Index)
+    {
+        Bounds.Add(FCullBounds(
+            FVector(Position(Random), Position(Random), Position(Random)),
+            FVector(Extent(Random), Extent(Random), Extent(Random))
+        ));
+    }
+
+    const FMatrix View = TestMath::MakeLookAtLH(FVector(-200.f, 50.f, 30.f), FVector(0.f, 0.f, 0.f), FVector(0.f, 0.f, 1.f));
+    const FMatrix Projection = TestMath::MakePerspectiveLH(1.0f, 16.f / 9.f, 0.1f, 500.f);
+    const FFrustum Frustum(View * Projection);
+
+    TArray<uint32> VisibleIndices;
+    uint32 NumVisible = 0;
+
+    const double SimdMs = BenchHarness::MeasureBestMs(10, [&]
+    {
+        NumVisible = FrustumCulling::CullAgainstFrustum(Bounds, Frustum, VisibleIndices);
+    });
+
+    uint32 NumVisibleScalar = 0;
+    const double ScalarMs = BenchHarness::MeasureBestMs(10, [&]
+    {
+        VisibleIndices.Empty();
+        for (int32 Index = 0; Index < Bounds.Num(); ++Index)
+        {
+            if (Frustum.IntersectsBox(Bounds[Index]))
+            {
+                VisibleIndices.Add(static_cast<uint32>(Index));
+            }
+        }
+        NumVisibleScalar = static_cast<uint32>(VisibleIndices.Num());
+    });
+
+    std::printf("Frustum culling, %d boxes (%u visible)\n", NumBounds, NumVisible);
+    std::printf("  scalar IntersectsBox : %8.3f ms  (%6.2f ns/box)\n", ScalarMs, ScalarMs * 1e6 / NumBounds);
+    std::printf("  CullAgainstFrustum   : %8.3f ms  (%6.2f ns/box, x%.2f)\n", SimdMs, SimdMs * 1e6 / NumBounds, ScalarMs / SimdMs);
+
+    return NumVisible == NumVisibleScalar ? 0 : 1;
+}
@@ -0,0 +1,216 @@
+#include "TestHarness.h"
+#include "TestMath.h"
+#include <cfloat>
+#include <random>
+#include "Renderer/FrustumCulling.h"
+
+
+namespace
+{
+    struct FTestCamera
+    {
+        FVector Eye;
+        FVector Target;
+        FMatrix ViewProjection;
+    };
+
+    constexpr float FarZ = 500.f;
+
+    FTestCamera MakeCamera(const FVector& Eye, const FVector& Target)
+    {
+        const FMatrix View = TestMath::MakeLookAtLH(Eye, Target, FVector(0.f, 0.f, 1.f));
+        const FMatrix Projection = TestMath::MakePerspectiveLH(1.0f, 16.f / 9.f, 0.1f, FarZ);
+        return { Eye, Target, View * Projection };
+    }
+
+    TArray<FCullBounds> MakeRandomBounds(std::mt19937& Random, int32 Num)
+    {
+        std::uniform_real_distribution<float> Position(-300.f, 300.f);
+        std::uniform_real_distribution<float> Extent(0.1f, 20.f);
+
+        TArray<FCullBounds> Bounds;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Bounds.Add(FCullBounds(
+                FVector(Position(Random), Position(Random), Position(Random)),
+                FVector(Extent(Random), Extent(Random), Extent(Random))
+            ));
+        }
+        return Bounds;
+    }
+
+    /** 평면마다 법선 방향으로 가장 먼 꼭짓점(P-vertex)을 찾는 방식으로 따로 계산한 기준값 */
+    float MinSignedDistanceOfPositiveVertex(const FFrustum& Frustum, const FCullBounds& Bounds)
+    {
+        float MinDistance = FLT_MAX;
+        for (const FVector4& Plane : Frustum.Planes)
+        {
+            const FVector PositiveVertex(
+                Bounds.Center.X + (Plane.X >= 0.f ? Bounds.Extent.X : -Bounds.Extent.X),
+                Bounds.Center.Y + (Plane.Y >= 0.f ? Bounds.Extent.Y : -Bounds.Extent.Y),
+                Bounds.Center.Z + (Plane.Z >= 0.f ? Bounds.Extent.Z : -Bounds.Extent.Z)
+            );
+            const float Distance = Plane.X * PositiveVertex.X + Plane.Y * PositiveVertex.Y + Plane.Z * PositiveVertex.Z + Plane.W;
+            MinDistance = std::min(MinDistance, Distance);
+        }
+        return MinDistance;
+    }
+
+    /**
+     * Clip 공간에서 절두체 안쪽에 있는지.
+     * Far 평면 근처는 Z / W가 1에 가까워 평면 거리와 오차가 크므로, 경계에서 1% 안쪽만 안으로 봅니다.
+     * 원근 투영에서 W는 View 공간 깊이입니다.
+     */
+    bool IsInsideClipSpace(const FMatrix& ViewProjection, const FVector& Point)
+    {
+        const FVector4 Clip = ViewProjection.TransformFVector4(FVector4(Point.X, Point.Y, Point.Z, 1.f));
+        const float Limit = Clip.W * 0.99f;
+        return Clip.W > 0.f
+            && std::abs(Clip.X) <= Limit
+            && std::abs(Clip.Y) <= Limit
+            && Clip.Z >= 0.f && Clip.W <= FarZ * 0.99f;
+    }
+}
+
+
+TEST_CASE(SimdCullingMatchesBruteForce)
+{
+    std::mt19937 Random(1234);
+    const FTestCamera Cameras[] = {
+        MakeCamera(FVector(0.f, 0.f, 0.f), FVector(1.f, 0.f, 0.f)),
+        MakeCamera(FVector(-200.f, 50.f, 30.f), FVector(0.f, 0.f, 0.f)),
+        MakeCamera(FVector(100.f, 100.f, 250.f), FVector(90.f, 80.f, 0.f)),
+    };
+
+    // 4개 단위로 처리하고 남는 원소도 확인하기 위해 4의 배수가 아닌 개수를 사용합니다.
+    const TArray<FCullBounds> Bounds = MakeRandomBounds(Random, 10003);
+
+    for (const FTestCamera& Camera : Cameras)
+    {
+        const FFrustum Frustum(Camera.ViewProjection);
+
+        TArray<uint32> VisibleIndices;
+        const uint32 NumVisible = FrustumCulling::CullAgainstFrustum(Bounds, Frustum, VisibleIndices);
+        CHECK(NumVisible == static_cast<uint32>(VisibleIndices.Num()));
+        CHECK(NumVisible > 0 && NumVisible < static_cast<uint32>(Bounds.Num()));
+
+        int32 Cursor = 0;
+        for (int32 Index = 0; Index < Bounds.Num(); ++Index)
+        {
+            const bool bVisible = Cursor < VisibleIndices.Num() && VisibleIndices[Cursor] == static_cast<uint32>(Index);
+            if (bVisible)
+            {
+                ++Cursor;
+            }
+
+            // 계산 순서가 다르므로 평면에 거의 닿은 박스는 비교하지 않습니다.
+            const float Distance = MinSignedDistanceOfPositiveVertex(Frustum, Bounds[Index]);
+            if (std::abs(Distance) > 1e-3f)
+            {
+                CHECK(bVisible == (Distance >= 0.f));
+            }
+            CHECK(bVisible == Frustum.IntersectsBox(Bounds[Index]));
+        }
+
+        // 결과 인덱스는 오름차순이고 중복이 없습니다.
+        CHECK(Cursor == VisibleIndices.Num());
+    }
+}
+
+TEST_CASE(CullingAgreesWithClipSpaceForSmallBoxes)
+{
+    std::mt19937 Random(99);
+    std::uniform_real_distribution<float> Position(-300.f, 300.f);
+
+    const FTestCamera Camera = MakeCamera(FVector(-100.f, -40.f, 20.f), FVector(50.f, 30.f, 0.f));
+    const FFrustum Frustum(Camera.ViewProjection);
+
+    int32 NumInside = 0;
+    for (int32 Index = 0; Index < 20000; ++Index)
+    {
+        const FVector Point(Position(Random), Position(Random), Position(Random));
+        const FCullBounds Bounds(Point, FVector(0.001f, 0.001f, 0.001f));
+
+        if (IsInsideClipSpace(Camera.ViewProjection, Point))
+        {
+            ++NumInside;
+            CHECK(Frustum.IntersectsBox(Bounds));
+            CHECK(Frustum.ClassifyBox(Bounds) != EFrustumContainment::Outside);
+        }
+    }
+    CHECK(NumInside > 0);
+}
+
+TEST_CASE(BoxesBehindOrBeyondCameraAreCulled)
+{
+    const FTestCamera Camera = MakeCamera(FVector(0.f, 0.f, 0.f), FVector(1.f, 0.f, 0.f));
+    const FFrustum Frustum(Camera.ViewProjection);
+
+    TArray<FCullBounds> Bounds;
+    Bounds.Add(FCullBounds(FVector(50.f, 0.f, 0.f), FVector(1.f, 1.f, 1.f)));    // 정면
+    Bounds.Add(FCullBounds(FVector(-50.f, 0.f, 0.f), FVector(1.f, 1.f, 1.f)));   // 뒤쪽
+    Bounds.Add(FCullBounds(FVector(1000.f, 0.f, 0.f), FVector(1.f, 1.f, 1.f)));  // Far 평면 너머
+    Bounds.Add(FCullBounds(FVector(50.f, 500.f, 0.f), FVector(1.f, 1.f, 1.f)));  // 옆쪽
+    Bounds.Add(FCullBounds(FVector(-50.f, 0.f, 0.f), FVector(60.f, 1.f, 1.f)));  // 카메라를 감싸는 박스
+
+    TArray<uint32> VisibleIndices;
+    CHECK(FrustumCulling::CullAgainstFrustum(Bounds, Frustum, VisibleIndices) == 2);
+    CHECK(VisibleIndices.Num() == 2 && VisibleIndices[0] == 0 && VisibleIndices[1] == 4);
+
+    CHECK(Frustum.ClassifyBox(Bounds[0]) == EFrustumContainment::Inside);
+    CHECK(Frustum.ClassifyBox(Bounds[1]) == EFrustumContainment::Outside);
+    CHECK(Frustum.ClassifyBox(Bounds[4]) == EFrustumContainment::Intersect);
+}
+
+TEST_CASE(FromLocalBoxContainsTransformedCorners)
+{
+    std::mt19937 Random(7);
+    std::uniform_real_distribution<float> Angle(-180.f, 180.f);
+    std::uniform_real_distribution<float> Scale(0.2f, 4.f);
+    std::uniform_real_distribution<float> Offset(-100.f, 100.f);
+
+    const FVector LocalMin(-1.f, -2.f, -0.5f);
+    const FVector LocalMax(3.f, 1.f, 2.f);
+
+    for (int32 Iteration = 0; Iteration < 200; ++Iteration)
+    {
+        const FMatrix World = FMatrix::CreateScaleMatrix(Scale(Random), Scale(Random), Scale(Random))
+            * FMatrix::CreateRotationMatrix(Angle(Random), Angle(Random), Angle(Random))
+            * FMatrix::CreateTranslationMatrix(FVector(Offset(Random), Offset(Random), Offset(Random)));
+
+        const FCullBounds Bounds = FCullBounds::FromLocalBox(LocalMin, LocalMax, World);
+
+        FVector WorldMin(FLT_MAX, FLT_MAX, FLT_MAX);
+        FVector WorldMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (int32 Corner = 0; Corner < 8; ++Corner)
+        {
+            const FVector Local(
+                (Corner & 1) ? LocalMax.X : LocalMin.X,
+                (Corner & 2) ? LocalMax.Y : LocalMin.Y,
+                (Corner & 4) ? LocalMax.Z : LocalMin.Z
+            );
+            const FVector Point = World.TransformPosition(Local);
+            WorldMin = FVector(std::min(WorldMin.X, Point.X), std::min(WorldMin.Y, Point.Y), std::min(WorldMin.Z, Point.Z));
+            WorldMax = FVector(std::max(WorldMax.X, Point.X), std::max(WorldMax.Y, Point.Y), std::max(WorldMax.Z, Point.Z));
+        }
+
+        // 꼭짓점을 모두 감싸면서 가장 작은 AABB여야 합니다.
+        constexpr float Tolerance = 1e-3f;
+        CHECK_NEAR(Bounds.Center.X - Bounds.Extent.X, WorldMin.X, Tolerance);
+        CHECK_NEAR(Bounds.Center.Y - Bounds.Extent.Y, WorldMin.Y, Tolerance);
+        CHECK_NEAR(Bounds.Center.Z - Bounds.Extent.Z, WorldMin.Z, Tolerance);
+        CHECK_NEAR(Bounds.Center.X + Bounds.Extent.X, WorldMax.X, Tolerance);
+        CHECK_NEAR(Bounds.Center.Y + Bounds.Extent.Y, WorldMax.Y, Tolerance);
+        CHECK_NEAR(Bounds.Center.Z + Bounds.Extent.Z, WorldMax.Z, Tolerance);
+    }
+}
+
+TEST_CASE(EmptyInputReturnsNoIndices)
+{
+    const FFrustum Frustum(MakeCamera(FVector(0.f, 0.f, 0.f), FVector(1.f, 0.f, 0.f)).ViewProjection);
+
+    TArray<uint32> VisibleIndices;
+    VisibleIndices.Add(42);
+    CHECK(FrustumCulling::CullAgainstFrustum(nullptr, 0, Frustum, VisibleIndices) == 0);
+    CHECK(VisibleIndices.IsEmpty());
+}
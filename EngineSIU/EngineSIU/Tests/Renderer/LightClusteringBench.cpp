@@ -0,0 +1,74 @@
+#include "BenchHarness.h"
+#include "TestMath.h"
+#include <random>
+#include "Math/MathUtility.h"
+#include "Renderer/LightClustering.h"
+
+
+/**
+ * 절반은 점광원, 절반은 반각 45도 스포트라이트인 Light를 카메라 앞 200까지의 절두체 안에 고르게 뿌리고,
+ * FLightClusterGrid::AssignLights 한 번의 시간을 잽니다. 인자로 Light 수를 넘기면 그 수만 측정합니다.
+ */
+int main(int Argc, char** Argv)
+{
+    constexpr float NearZ = 0.1f;
+    constexpr float FarZ = 1000.0f;
+    constexpr float MaxLightDepth = 200.0f;
+
+    const FMatrix View = TestMath::MakeLookAtLH(FVector::ZeroVector, FVector(1.0f, 0.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f));
+    const FMatrix Projection = TestMath::MakePerspectiveLH(60.0f * (PI / 180.0f), 16.0f / 9.0f, NearZ, FarZ);
+    const FMatrix InvView = FMatrix::Inverse(View);
+    const float TanHalfFovX = 1.0f / Projection.M[0][0];
+    const float TanHalfFovY = 1.0f / Projection.M[1][1];
+
+    FLightClusterGrid Grid;
+    Grid.SetView(View, Projection, NearZ, FarZ, true);
+
+    const int32 RequestedLights = BenchHarness::GetIntArgument(Argc, Argv, 1, 0);
+    TArray<int32> LightCounts = { 1000, 5000, 10000 };
+    if (RequestedLights > 0)
+    {
+        LightCounts = { RequestedLights };
+    }
+
+    std::mt19937 Random(1234);
+    std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+
+    std::printf("Light cluster assignment, %u clusters\n", FLightClusterGrid::NumClusters);
+    std::printf("  %8s %10s %12s %10s %12s\n", "lights", "ms", "assignments", "occupied", "max/cluster");
+    for (const int32 NumLights : LightCounts)
+    {
+        TArray<FClusterPointLight> PointLights;
+        TArray<FClusterSpotLight> SpotLights;
+        for (int32 Index = 0; Index < NumLights; ++Index)
+        {
+            const float Depth = NearZ + Unit(Random) * MaxLightDepth;
+            const FVector ViewPosition(
+                (Unit(Random) * 2.0f - 1.0f) * Depth * TanHalfFovX,
+                (Unit(Random) * 2.0f - 1.0f) * Depth * TanHalfFovY,
+                Depth
+            );
+            const FVector Position = InvView.TransformPosition(ViewPosition);
+            const float Radius = 2.0f + Unit(Random) * 8.0f;
+            if (Index & 1)
+            {
+                const FVector Direction = FVector(Unit(Random) - 0.5f, Unit(Random) - 0.5f, Unit(Random) - 0.5f).GetSafeNormal();
+                SpotLights.Add({ Position, Radius, Direction, 0.7071f, 0.7071f });
+            }
+            else
+            {
+                PointLights.Add({ Position, Radius });
+            }
+        }
+
+        const double AssignMs = BenchHarness::MeasureBestMs(20, [&]
+        {
+            Grid.AssignLights(PointLights, SpotLights);
+        });
+
+        const FLightClusterStats& Stats = Grid.GetStats();
+        std::printf("  %8d %10.3f %12u %10u %12u\n", NumLights, AssignMs, Stats.NumAssignments, Stats.NumOccupiedClusters, Stats.MaxLightsPerCluster);
+    }
+
+    return 0;
+}
@@ -0,0 +1,334 @@
+#include "TestHarness.h"
+#include "TestMath.h"
+#include <algorithm>
+#include <cfloat>
+#include <random>
+#include <vector>
+#include "Math/MathUtility.h"
+#include "Renderer/LightClustering.h"
+
+
+namespace
+{
+    constexpr float NearZ = 0.1f;
+    constexpr float FarZ = 1000.f;
+
+    struct FTestView
+    {
+        FMatrix View;
+        FMatrix Projection;
+        bool bPerspective;
+    };
+
+    FTestView MakePerspectiveView()
+    {
+        return {
+            TestMath::MakeLookAtLH(FVector(-20.f, 10.f, 5.f), FVector(30.f, -5.f, 0.f), FVector(0.f, 0.f, 1.f)),
+            TestMath::MakePerspectiveLH(1.0f, 16.f / 9.f, NearZ, FarZ),
+            true
+        };
+    }
+
+    FTestView MakeOrthographicView()
+    {
+        return {
+            TestMath::MakeLookAtLH(FVector(-20.f, 10.f, 5.f), FVector(30.f, -5.f, 0.f), FVector(0.f, 0.f, 1.f)),
+            TestMath::MakeOrthographicLH(160.f, 90.f, NearZ, FarZ),
+            false
+        };
+    }
+
+    /** View 공간 절두체 안, MaxDepth까지의 임의의 월드 위치 */
+    FVector MakeRandomPosition(std::mt19937& Random, const FTestView& TestView, float MaxDepth)
+    {
+        std::uniform_real_distribution<float> Unit(0.f, 1.f);
+        const float Depth = NearZ + Unit(Random) * MaxDepth;
+        const float HalfWidth = TestView.bPerspective ? Depth / TestView.Projection.M[0][0] : 1.f / TestView.Projection.M[0][0];
+        const float HalfHeight = TestView.bPerspective ? Depth / TestView.Projection.M[1][1] : 1.f / TestView.Projection.M[1][1];
+
+        // 절두체 밖에서 걸치는 Light도 나오도록 조금 넓게 뿌립니다.
+        const FVector ViewPosition((Unit(Random) * 2.4f - 1.2f) * HalfWidth, (Unit(Random) * 2.4f - 1.2f) * HalfHeight, Depth);
+        return FMatrix::Inverse(TestView.View).TransformPosition(ViewPosition);
+    }
+
+    /** 클러스터마다 Light 종류별로 배정된 Light 인덱스를 표시한 표. [Cluster][Light] */
+    std::vector<std::vector<bool>> CollectAssignments(const FLightClusterGrid& Grid, uint32 NumLights, bool bSpot)
+    {
+        std::vector<std::vector<bool>> Assigned(FLightClusterGrid::NumClusters, std::vector<bool>(NumLights, false));
+        for (uint32 ClusterIndex = 0; ClusterIndex < FLightClusterGrid::NumClusters; ++ClusterIndex)
+        {
+            const FLightCluster& Cluster = Grid.GetClusters()[ClusterIndex];
+            const uint32 First = Cluster.Offset + (bSpot ? Cluster.GetNumPointLights() : 0);
+            const uint32 Num = bSpot ? Cluster.GetNumSpotLights() : Cluster.GetNumPointLights();
+            for (uint32 Index = First; Index < First + Num; ++Index)
+            {
+                Assigned[ClusterIndex][Grid.GetLightIndices()[Index]] = true;
+            }
+        }
+        return Assigned;
+    }
+
+    /** 셰이더처럼 Shader Params의 Slice 식을 거꾸로 풀어 얻은 Slice의 깊이 경계 */
+    float GetSliceBoundary(const FLightClusterShaderParams& Params, uint32 Slice)
+    {
+        const float Depth = (static_cast<float>(Slice) - Params.DepthBias) / Params.DepthScale;
+        return Params.bLogDepth ? std::exp(Depth) : Depth;
+    }
+
+    /** NDC 좌표와 깊이로 구한 View 공간 좌표 한 축 */
+    float NdcToView(const FMatrix& Projection, int Axis, float Ndc, float ViewZ)
+    {
+        const float W = ViewZ * Projection.M[2][3] + Projection.M[3][3];
+        return (Ndc * W - ViewZ * Projection.M[2][Axis] - Projection.M[3][Axis]) / Projection.M[Axis][Axis];
+    }
+
+    /** 클러스터의 여덟 꼭짓점을 감싸는 View 공간 AABB */
+    void GetReferenceClusterBounds(const FTestView& TestView, const FLightClusterShaderParams& Params, uint32 X, uint32 Y, uint32 Slice, FVector& OutMin, FVector& OutMax)
+    {
+        OutMin = FVector(FLT_MAX, FLT_MAX, GetSliceBoundary(Params, Slice));
+        OutMax = FVector(-FLT_MAX, -FLT_MAX, GetSliceBoundary(Params, Slice + 1));
+        for (const float ViewZ : { OutMin.Z, OutMax.Z })
+        {
+            for (const uint32 Column : { X, X + 1 })
+            {
+                const float ViewX = NdcToView(TestView.Projection, 0, -1.f + 2.f * Column / FLightClusterGrid::NumClustersX, ViewZ);
+                OutMin.X = std::min(OutMin.X, ViewX);
+                OutMax.X = std::max(OutMax.X, ViewX);
+            }
+            for (const uint32 Row : { Y, Y + 1 })
+            {
+                const float ViewY = NdcToView(TestView.Projection, 1, -1.f + 2.f * Row / FLightClusterGrid::NumClustersY, ViewZ);
+                OutMin.Y = std::min(OutMin.Y, ViewY);
+                OutMax.Y = std::max(OutMax.Y, ViewY);
+            }
+        }
+    }
+
+    float GetDistanceSquared(const FVector& Point, const FVector& Min, const FVector& Max)
+    {
+        const float DX = std::max({ Min.X - Point.X, Point.X - Max.X, 0.f });
+        const float DY = std::max({ Min.Y - Point.Y, Point.Y - Max.Y, 0.f });
+        const float DZ = std::max({ Min.Z - Point.Z, Point.Z - Max.Z, 0.f });
+        return DX * DX + DY * DY + DZ * DZ;
+    }
+
+    /**
+     * 모든 클러스터와 구를 하나씩 비교하는 기준값과 배정 결과를 비교합니다.
+     * 경계에 걸친 경우의 오차를 허용하려고 반지름을 0.1% 줄여도 닿으면 반드시 배정되어야 하고, 0.1% 늘려도 닿지 않으면 배정되면 안 됩니다.
+     * 스포트라이트는 원뿔 밖의 클러스터를 빼므로, 배정된 클러스터가 구와 닿는지만 확인합니다.
+     */
+    void CheckAgainstBruteForce(const FLightClusterGrid& Grid, const FTestView& TestView, const TArray<FVector>& Positions, const TArray<float>& Radii, bool bSpot)
+    {
+        const std::vector<std::vector<bool>> Assigned = CollectAssignments(Grid, Positions.Num(), bSpot);
+        for (int32 LightIndex = 0; LightIndex < Positions.Num(); ++LightIndex)
+        {
+            const FVector ViewPosition = TestView.View.TransformPosition(Positions[LightIndex]);
+            const float InnerSq = (Radii[LightIndex] * 0.999f) * (Radii[LightIndex] * 0.999f);
+            const float OuterSq = (Radii[LightIndex] * 1.001f) * (Radii[LightIndex] * 1.001f);
+            for (uint32 Slice = 0; Slice < FLightClusterGrid::NumClustersZ; ++Slice)
+            {
+                for (uint32 Y = 0; Y < FLightClusterGrid::NumClustersY; ++Y)
+                {
+                    for (uint32 X = 0; X < FLightClusterGrid::NumClustersX; ++X)
+                    {
+                        FVector Min, Max;
+                        GetReferenceClusterBounds(TestView, Grid.GetShaderParams(), X, Y, Slice, Min, Max);
+                        const float DistanceSq = GetDistanceSquared(ViewPosition, Min, Max);
+                        const bool bAssigned = Assigned[FLightClusterGrid::GetClusterIndex(X, Y, Slice)][LightIndex];
+                        if (!bSpot && DistanceSq <= InnerSq)
+                        {
+                            CHECK(bAssigned);
+                        }
+                        if (DistanceSq > OuterSq)
+                        {
+                            CHECK(!bAssigned);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /** 셰이더처럼 View 공간 위치가 속한 클러스터를 찾습니다. 화면 밖이거나 Near 앞이면 false입니다. */
+    bool FindCluster(const FLightClusterGrid& Grid, const FTestView& TestView, const FVector& ViewPosition, uint32& OutClusterIndex)
+    {
+        const FVector4 Clip = TestView.Projection.TransformFVector4(FVector4(ViewPosition, 1.f));
+        if (ViewPosition.Z < NearZ || Clip.W <= 0.f)
+        {
+            return false;
+        }
+        const float NdcX = Clip.X / Clip.W;
+        const float NdcY = Clip.Y / Clip.W;
+        if (std::abs(NdcX) >= 1.f || std::abs(NdcY) >= 1.f)
+        {
+            return false;
+        }
+        const uint32 X = std::min(static_cast<uint32>((NdcX * 0.5f + 0.5f) * FLightClusterGrid::NumClustersX), FLightClusterGrid::NumClustersX - 1);
+        const uint32 Y = std::min(static_cast<uint32>((NdcY * 0.5f + 0.5f) * FLightClusterGrid::NumClustersY), FLightClusterGrid::NumClustersY - 1);
+        OutClusterIndex = FLightClusterGrid::GetClusterIndex(X, Y, Grid.GetSliceIndex(ViewPosition.Z));
+        return true;
+    }
+
+    /** 클러스터 목록이 빈틈없이 이어지고, 종류마다 인덱스가 오름차순인지 확인합니다. */
+    void CheckClusterLayout(const FLightClusterGrid& Grid, uint32 NumPointLights, uint32 NumSpotLights)
+    {
+        uint32 Offset = 0;
+        uint32 NumOccupied = 0;
+        uint32 MaxLights = 0;
+        for (const FLightCluster& Cluster : Grid.GetClusters())
+        {
+            CHECK(Cluster.Offset == Offset);
+            const uint32 NumPoint = Cluster.GetNumPointLights();
+            const uint32 NumSpot = Cluster.GetNumSpotLights();
+            for (uint32 Index = 0; Index < NumPoint; ++Index)
+            {
+                CHECK(Grid.GetLightIndices()[Offset + Index] < NumPointLights);
+                CHECK(Index == 0 || Grid.GetLightIndices()[Offset + Index - 1] < Grid.GetLightIndices()[Offset + Index]);
+            }
+            for (uint32 Index = NumPoint; Index < NumPoint + NumSpot; ++Index)
+            {
+                CHECK(Grid.GetLightIndices()[Offset + Index] < NumSpotLights);
+                CHECK(Index == NumPoint || Grid.GetLightIndices()[Offset + Index - 1] < Grid.GetLightIndices()[Offset + Index]);
+            }
+            Offset += NumPoint + NumSpot;
+            NumOccupied += NumPoint + NumSpot > 0 ? 1 : 0;
+            MaxLights = std::max(MaxLights, NumPoint + NumSpot);
+        }
+        CHECK(Offset == static_cast<uint32>(Grid.GetLightIndices().Num()));
+        CHECK(Grid.GetStats().NumAssignments == Offset);
+        CHECK(Grid.GetStats().NumOccupiedClusters == NumOccupied);
+        CHECK(Grid.GetStats().MaxLightsPerCluster == MaxLights);
+    }
+}
+
+
+TEST_CASE(PointLightsMatchBruteForce)
+{
+    std::mt19937 Random(1234);
+    std::uniform_real_distribution<float> Radius(1.f, 30.f);
+    for (const FTestView& TestView : { MakePerspectiveView(), MakeOrthographicView() })
+    {
+        TArray<FClusterPointLight> PointLights;
+        TArray<FVector> Positions;
+        TArray<float> Radii;
+        for (int32 Index = 0; Index < 200; ++Index)
+        {
+            PointLights.Add({ MakeRandomPosition(Random, TestView, 150.f), Radius(Random) });
+            Positions.Add(PointLights[Index].Position);
+            Radii.Add(PointLights[Index].Radius);
+        }
+
+        FLightClusterGrid Grid;
+        Grid.SetView(TestView.View, TestView.Projection, NearZ, FarZ, TestView.bPerspective);
+        Grid.AssignLights(PointLights, {});
+
+        CHECK(Grid.GetClusters().Num() == static_cast<int32>(FLightClusterGrid::NumClusters));
+        CheckClusterLayout(Grid, PointLights.Num(), 0);
+        CheckAgainstBruteForce(Grid, TestView, Positions, Radii, false);
+    }
+}
+
+TEST_CASE(SpotLightsCoverTheirConeAndStayInsideTheirSphere)
+{
+    std::mt19937 Random(42);
+    std::uniform_real_distribution<float> Unit(0.f, 1.f);
+    for (const FTestView& TestView : { MakePerspectiveView(), MakeOrthographicView() })
+    {
+        TArray<FClusterSpotLight> SpotLights;
+        TArray<FVector> Positions;
+        TArray<float> Radii;
+        for (int32 Index = 0; Index < 100; ++Index)
+        {
+            // 반각 5 ~ 90도
+            const float HalfAngle = (5.f + Unit(Random) * 85.f) * (PI / 180.f);
+            const FVector Direction = FVector(Unit(Random) - 0.5f, Unit(Random) - 0.5f, Unit(Random) - 0.5f).GetSafeNormal();
+            SpotLights.Add({ MakeRandomPosition(Random, TestView, 150.f), 5.f + Unit(Random) * 25.f, Direction, std::cos(HalfAngle), std::sin(HalfAngle) });
+            Positions.Add(SpotLights[Index].Position);
+            Radii.Add(SpotLights[Index].Radius);
+        }
+
+        FLightClusterGrid Grid;
+        Grid.SetView(TestView.View, TestView.Projection, NearZ, FarZ, TestView.bPerspective);
+        Grid.AssignLights({}, SpotLights);
+        CheckClusterLayout(Grid, 0, SpotLights.Num());
+
+        // 원뿔 테스트는 보수적이지만, 감싸는 구 밖의 클러스터에 배정되면 안 됩니다.
+        CheckAgainstBruteForce(Grid, TestView, Positions, Radii, true);
+
+        // 원뿔 안의 점이 속한 클러스터에는 반드시 배정되어 있어야 합니다.
+        const std::vector<std::vector<bool>> Assigned = CollectAssignments(Grid, SpotLights.Num(), true);
+        for (int32 LightIndex = 0; LightIndex < SpotLights.Num(); ++LightIndex)
+        {
+            const FClusterSpotLight& Spot = SpotLights[LightIndex];
+            const FVector ViewApex = TestView.View.TransformPosition(Spot.Position);
+            const FVector ViewAxis = FMatrix::TransformVector(Spot.Direction, TestView.View).GetSafeNormal();
+            for (int32 Sample = 0; Sample < 500; ++Sample)
+            {
+                const FVector Offset = FVector(Unit(Random) * 2.f - 1.f, Unit(Random) * 2.f - 1.f, Unit(Random) * 2.f - 1.f) * Spot.Radius;
+                const float Length = Offset.Length();
+                if (Length >= Spot.Radius * 0.99f || Length < KINDA_SMALL_NUMBER || Offset.Dot(ViewAxis) < Length * Spot.CosConeAngle * 1.01f)
+                {
+                    continue;
+                }
+
+                uint32 ClusterIndex;
+                if (FindCluster(Grid, TestView, ViewApex + Offset, ClusterIndex))
+                {
+                    CHECK(Assigned[ClusterIndex][LightIndex]);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE(LightsOutsideTheViewAreNotAssigned)
+{
+    const FTestView TestView = MakePerspectiveView();
+    const FMatrix InvView = FMatrix::Inverse(TestView.View);
+
+    // 카메라 뒤, Near 앞, 화면 옆
+    TArray<FClusterPointLight> PointLights;
+    PointLights.Add({ InvView.TransformPosition(FVector(0.f, 0.f, -20.f)), 5.f });
+    PointLights.Add({ InvView.TransformPosition(FVector(0.f, 0.f, -1.f)), 0.5f });
+    PointLights.Add({ InvView.TransformPosition(FVector(200.f, 0.f, 50.f)), 5.f });
+
+    FLightClusterGrid Grid;
+    Grid.SetView(TestView.View, TestView.Projection, NearZ, FarZ, true);
+    Grid.AssignLights(PointLights, {});
+    CHECK(Grid.GetStats().NumAssignments == 0);
+    CHECK(Grid.GetLightIndices().Num() == 0);
+
+    // Light가 하나도 없어도 클러스터는 모두 만듭니다.
+    Grid.AssignLights({}, {});
+    CHECK(Grid.GetClusters().Num() == static_cast<int32>(FLightClusterGrid::NumClusters));
+    CHECK(Grid.GetStats().NumOccupiedClusters == 0);
+}
+
+TEST_CASE(SliceIndexFollowsShaderParams)
+{
+    const FTestView TestView = MakePerspectiveView();
+    TArray<FClusterPointLight> PointLights;
+    PointLights.Add({ FMatrix::Inverse(TestView.View).TransformPosition(FVector(0.f, 0.f, 90.f)), 10.f });
+
+    FLightClusterGrid Grid;
+    Grid.SetView(TestView.View, TestView.Projection, NearZ, FarZ, true);
+    Grid.AssignLights(PointLights, {});
+
+    // 가장 먼 Light가 닿는 깊이(100)까지만 나누고, 그 너머는 마지막 Slice입니다.
+    const FLightClusterShaderParams& Params = Grid.GetShaderParams();
+    CHECK(Params.bLogDepth == 1);
+    CHECK_NEAR(GetSliceBoundary(Params, 0), NearZ, 1e-4f);
+    CHECK_NEAR(GetSliceBoundary(Params, FLightClusterGrid::NumClustersZ), 100.f, 1e-2f);
+    CHECK(Grid.GetSliceIndex(NearZ * 0.5f) == 0);
+    CHECK(Grid.GetSliceIndex(500.f) == FLightClusterGrid::NumClustersZ - 1);
+
+    uint32 PreviousSlice = 0;
+    for (float ViewZ = NearZ; ViewZ < 100.f; ViewZ *= 1.05f)
+    {
+        const uint32 Slice = Grid.GetSliceIndex(ViewZ);
+        CHECK(Slice >= PreviousSlice);
+        CHECK(GetSliceBoundary(Params, Slice) <= ViewZ * 1.0001f);
+        CHECK(GetSliceBoundary(Params, Slice + 1) >= ViewZ * 0.9999f);
+        PreviousSlice = Slice;
+    }
+}
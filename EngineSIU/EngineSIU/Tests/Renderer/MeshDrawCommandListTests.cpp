@@ -0,0 +1,216 @@
+#include "TestHarness.h"
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+#include "Renderer/MeshDrawCommandList.h"
+
+
+namespace
+{
+    /** Packet의 IndexStart에 추가한 순서를 넣어 두고, std::stable_sort 결과와 순서를 비교합니다. */
+    bool MatchesStableSort(const TArray<FMeshDrawPacket>& Unsorted, const TArray<FMeshDrawPacket>& Sorted)
+    {
+        std::vector<FMeshDrawPacket> Expected(Unsorted.begin(), Unsorted.end());
+        std::stable_sort(Expected.begin(), Expected.end(), [](const FMeshDrawPacket& A, const FMeshDrawPacket& B)
+        {
+            return A.SortKey < B.SortKey;
+        });
+
+        if (static_cast<int32>(Expected.size()) != Sorted.Num())
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < Sorted.Num(); ++Index)
+        {
+            if (Expected[Index].IndexStart != Sorted[Index].IndexStart || Expected[Index].SortKey != Sorted[Index].SortKey)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+
+TEST_CASE(SortKeyOrdersByMaterialMeshSubsetObject)
+{
+    const uint64 Key = FMeshDrawCommandList::MakeSortKey(3, 2, 1, 0);
+
+    // 상위 필드가 크면 하위 필드와 상관없이 뒤에 옵니다.
+    CHECK(Key < FMeshDrawCommandList::MakeSortKey(4, 0, 0, 0));
+    CHECK(Key < FMeshDrawCommandList::MakeSortKey(3, 3, 0, 0));
+    CHECK(Key < FMeshDrawCommandList::MakeSortKey(3, 2, 2, 0));
+    CHECK(Key < FMeshDrawCommandList::MakeSortKey(3, 2, 1, 1));
+    CHECK(FMeshDrawCommandList::MakeSortKey(3, 1, 255, (1u << FMeshDrawCommandList::ObjectIndexBits) - 1) < Key);
+
+    // 범위를 넘는 값은 다른 필드를 침범하지 않고 잘립니다.
+    CHECK(FMeshDrawCommandList::MakeSortKey(0, 0, 1u << FMeshDrawCommandList::SubsetIndexBits, 0) == 0);
+    CHECK(FMeshDrawCommandList::MakeSortKey(0, 0, 0, 1u << FMeshDrawCommandList::ObjectIndexBits) == 0);
+    CHECK(FMeshDrawCommandList::MakeSortKey(1u << FMeshDrawCommandList::MaterialIdBits, 1u << FMeshDrawCommandList::MeshIdBits, 0, 0) == 0);
+}
+
+TEST_CASE(RadixSortMatchesStableSort)
+{
+    std::mt19937 Random(7);
+    TArray<FMeshDrawPacket> Scratch;
+
+    for (const int32 NumPackets : { 0, 1, 2, 17, 256, 5000 })
+    {
+        // 0: 임의의 64비트 키, 1: 하위 바이트만 다른 키(건너뛰는 바이트가 많음), 2: 모두 같은 키(순서 유지)
+        for (int32 KeyMode = 0; KeyMode < 3; ++KeyMode)
+        {
+            TArray<FMeshDrawPacket> Packets;
+            for (int32 Index = 0; Index < NumPackets; ++Index)
+            {
+                FMeshDrawPacket Packet;
+                Packet.IndexStart = static_cast<uint32>(Index);
+                Packet.SortKey = KeyMode == 0 ? (static_cast<uint64>(Random()) << 32 | Random())
+                    : KeyMode == 1 ? (0xABCDull << 48 | (Random() & 0x3FF))
+                    : 42;
+                Packets.Add(Packet);
+            }
+
+            const TArray<FMeshDrawPacket> Unsorted = Packets;
+            MeshDrawSort::RadixSortPackets(Packets, Scratch);
+            CHECK(MatchesStableSort(Unsorted, Packets));
+        }
+    }
+}
+
+TEST_CASE(SortGroupsPacketsByMaterialThenMesh)
+{
+    std::mt19937 Random(11);
+    OBJ::FStaticMeshRenderData Meshes[16];
+    FObjMaterialInfo Materials[32];
+
+    FMeshDrawCommandList DrawCommands;
+    constexpr int32 NumPackets = 5000;
+    for (int32 Index = 0; Index < NumPackets; ++Index)
+    {
+        const uint32 ObjectIndex = DrawCommands.AddObject(FMatrix::Identity, FVector4(0.f, 0.f, 0.f, 0.f), false);
+        // 33번째 값은 Material이 없는 Packet입니다.
+        const int32 MaterialIndex = static_cast<int32>(Random() % 33);
+        const FObjMaterialInfo* Material = MaterialIndex == 32 ? nullptr : &Materials[MaterialIndex];
+        DrawCommands.AddPacket(ObjectIndex, &Meshes[Random() % 16], 0, Material, static_cast<uint32>(Index), 3, false);
+    }
+
+    const TArray<FMeshDrawPacket> Unsorted = DrawCommands.GetPackets();
+    DrawCommands.Sort();
+    const TArray<FMeshDrawPacket>& Packets = DrawCommands.GetPackets();
+    CHECK(MatchesStableSort(Unsorted, Packets));
+
+    // Material이 없는 Packet이 먼저 오고, Material마다 한 번씩만 바뀌며, 같은 Material 안에서 Mesh도 한 번씩만 바뀝니다.
+    bool bSeenMaterial = false;
+    int32 NumMaterialChanges = 0;
+    int32 NumMeshChanges = 0;
+    for (int32 Index = 0; Index < Packets.Num(); ++Index)
+    {
+        const FMeshDrawPacket& Packet = Packets[Index];
+        CHECK(Packet.Material != nullptr || !bSeenMaterial);
+        bSeenMaterial |= Packet.Material != nullptr;
+
+        if (Index == 0 || Packet.Material != Packets[Index - 1].Material)
+        {
+            ++NumMaterialChanges;
+            ++NumMeshChanges;
+        }
+        else if (Packet.RenderData != Packets[Index - 1].RenderData)
+        {
+            ++NumMeshChanges;
+        }
+    }
+    CHECK(NumMaterialChanges == 33);
+    CHECK(NumMeshChanges <= 33 * 16);
+
+    // Reset 후에는 Material과 Mesh 번호를 처음부터 다시 붙입니다.
+    DrawCommands.Reset();
+    CHECK(DrawCommands.GetPackets().Num() == 0);
+    CHECK(DrawCommands.NumObjects() == 0);
+    const uint32 ObjectIndex = DrawCommands.AddObject(FMatrix::Identity, FVector4(0.f, 0.f, 0.f, 0.f), false);
+    DrawCommands.AddPacket(ObjectIndex, &Meshes[5], 0, &Materials[9], 0, 3, false);
+    CHECK(DrawCommands.GetPackets()[0].SortKey == FMeshDrawCommandList::MakeSortKey(1, 0, 0, 0));
+}
+
+TEST_CASE(BuildBatchesMergesRepeatedSubsets)
+{
+    std::mt19937 Random(3);
+    OBJ::FStaticMeshRenderData Meshes[4];
+    FObjMaterialInfo Materials[6];
+
+    FMeshDrawCommandList DrawCommands;
+    TArray<FMeshInstanceData> Instances;
+    TArray<FMeshDrawBatch> Batches;
+
+    for (const int32 NumComponents : { 0, 1, 50, 2000 })
+    {
+        DrawCommands.Reset();
+        int32 NumPackets = 0;
+        for (int32 Component = 0; Component < NumComponents; ++Component)
+        {
+            // Instance 데이터가 올바른 Object에서 왔는지 확인할 수 있도록 Transform과 UUID에 같은 번호를 넣습니다.
+            FMatrix Model = FMatrix::Identity;
+            Model.M[3][0] = static_cast<float>(Component);
+            const uint32 ObjectIndex = DrawCommands.AddObject(Model, FVector4(static_cast<float>(Component), 0.f, 0.f, 1.f), Component % 7 == 0);
+
+            // Mesh N은 Subset이 N + 1개이고, Subset마다 Material 두 개 중 하나를 사용합니다.
+            const int32 MeshIndex = static_cast<int32>(Random() % 4);
+            for (int32 Subset = 0; Subset <= MeshIndex; ++Subset)
+            {
+                const FObjMaterialInfo* Material = &Materials[(MeshIndex + Subset + Random() % 2) % 6];
+                DrawCommands.AddPacket(ObjectIndex, &Meshes[MeshIndex], Subset, Material, Subset * 100, 100, Subset == 1);
+                ++NumPackets;
+            }
+        }
+
+        DrawCommands.Sort();
+        DrawCommands.BuildBatches(Instances, Batches);
+        CHECK(Instances.Num() == NumPackets);
+
+        const TArray<FMeshDrawPacket>& Packets = DrawCommands.GetPackets();
+        uint32 NextInstance = 0;
+        for (int32 BatchIndex = 0; BatchIndex < Batches.Num(); ++BatchIndex)
+        {
+            const FMeshDrawBatch& Batch = Batches[BatchIndex];
+            CHECK(Batch.FirstInstance == NextInstance);
+            CHECK(Batch.NumInstances > 0);
+            NextInstance += Batch.NumInstances;
+
+            for (uint32 Instance = Batch.FirstInstance; Instance < Batch.FirstInstance + Batch.NumInstances; ++Instance)
+            {
+                const FMeshDrawPacket& Packet = Packets[Instance];
+                CHECK(Packet.RenderData == Batch.RenderData);
+                CHECK(Packet.Material == Batch.Material);
+                CHECK(Packet.IndexStart == Batch.IndexStart && Packet.IndexCount == Batch.IndexCount);
+
+                const FMeshInstanceData& Data = Instances[Instance];
+                const FMeshDrawObject& Object = DrawCommands.GetDrawObject(Packet.ObjectIndex);
+                CHECK(Data.World.M[3][0] == Data.UUIDColor.X);
+                CHECK(Data.UUIDColor.X == Object.UUIDColor.X);
+                CHECK(Data.bSelected == (Object.bSelected ? 1u : 0u));
+                CHECK(Data.bSelectedSubMesh == (Packet.bSelectedSubMesh ? 1u : 0u));
+            }
+
+            // 이웃한 Batch는 같은 범위를 그리면 안 됩니다. (하나로 합쳐졌어야 함)
+            if (BatchIndex > 0)
+            {
+                const FMeshDrawBatch& Previous = Batches[BatchIndex - 1];
+                CHECK(Previous.RenderData != Batch.RenderData || Previous.Material != Batch.Material || Previous.IndexStart != Batch.IndexStart);
+            }
+        }
+        CHECK(NextInstance == static_cast<uint32>(NumPackets));
+
+        // (Mesh, Subset, Material) 조합 수보다 Batch가 많으면 정렬 후에도 같은 조합이 흩어져 있다는 뜻입니다.
+        CHECK(Batches.Num() <= (1 + 2 + 3 + 4) * 2);
+    }
+}
+
+TEST_CASE(InstanceDataMatchesShaderLayout)
+{
+    // StaticMeshVertexShader.hlsl: INSTANCE_WORLD0~3, INSTANCE_NORMAL0~3, INSTANCE_UUID, INSTANCE_FLAGS(uint2) + 패딩
+    CHECK(sizeof(FMeshInstanceData) == 16 * 4 + 16 * 4 + 16 + 16);
+    CHECK(offsetof(FMeshInstanceData, NormalMatrix) == 64);
+    CHECK(offsetof(FMeshInstanceData, UUIDColor) == 128);
+    CHECK(offsetof(FMeshInstanceData, bSelected) == 144);
+    CHECK(offsetof(FMeshInstanceData, bSelectedSubMesh) == 148);
+}
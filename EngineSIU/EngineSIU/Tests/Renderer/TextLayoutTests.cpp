@@ -0,0 +1,178 @@
+#include "TestHarness.h"
+#include <string>
+#include "Renderer/TextLayout.h"
+
+
+namespace
+{
+    constexpr int32 AtlasCells = 106;
+
+    /** 배치 코드를 나누기 전 FDXDBufferManager::CreateUnicodeTextBuffer, SetStartUV와 같은 셀 계산 */
+    void GetReferenceCell(wchar_t Character, float& OutU, float& OutV)
+    {
+        int32 StartCell = 0;
+        int32 Offset = -1;
+        if (Character >= L'A' && Character <= L'Z') { StartCell = 11; Offset = Character - L'A'; }
+        else if (Character >= L'a' && Character <= L'z') { StartCell = 37; Offset = Character - L'a'; }
+        else if (Character >= L'0' && Character <= L'9') { StartCell = 1; Offset = Character - L'0'; }
+        else if (Character >= L'가' && Character <= L'힣') { StartCell = 63; Offset = Character - L'가'; }
+        OutU = static_cast<float>((Offset + StartCell) % AtlasCells);
+        OutV = static_cast<float>((Offset + StartCell) / AtlasCells);
+    }
+
+    /** 이전 CreateUnicodeTextBuffer처럼 글자당 2 x 2 사각형을 원점 기준으로 가로 정렬한 정점 */
+    void BuildReferenceVertices(const FWString& Text, TArray<FVertexTexture>& OutVertices)
+    {
+        const float CenterOffset = 2.0f * static_cast<float>(Text.size()) / 2.0f;
+        const float CellSize = 1.0f / AtlasCells;
+        for (int32 Index = 0; Index < static_cast<int32>(Text.size()); ++Index)
+        {
+            if (Text[Index] == L' ')
+            {
+                continue;
+            }
+
+            FVertexTexture LeftUp = { -1, 1, 0, 0, 0 };
+            FVertexTexture RightUp = { 1, 1, 0, CellSize, 0 };
+            FVertexTexture LeftDown = { -1, -1, 0, 0, CellSize };
+            FVertexTexture RightDown = { 1, -1, 0, CellSize, CellSize };
+
+            float U, V;
+            GetReferenceCell(Text[Index], U, V);
+            const float X = 2.0f * static_cast<float>(Index) - CenterOffset;
+            for (FVertexTexture* Vertex : { &LeftUp, &RightUp, &LeftDown, &RightDown })
+            {
+                Vertex->x += X;
+                Vertex->u += CellSize * U;
+                Vertex->v += CellSize * V;
+            }
+            for (const FVertexTexture& Vertex : { LeftUp, RightUp, LeftDown, RightUp, RightDown, LeftDown })
+            {
+                OutVertices.Add(Vertex);
+            }
+        }
+    }
+
+    bool AreVerticesNear(const FVertexTexture& A, const FVertexTexture& B)
+    {
+        constexpr float Tolerance = 1e-5f;
+        return std::abs(A.x - B.x) <= Tolerance && std::abs(A.y - B.y) <= Tolerance && std::abs(A.z - B.z) <= Tolerance
+            && std::abs(A.u - B.u) <= Tolerance && std::abs(A.v - B.v) <= Tolerance;
+    }
+}
+
+
+TEST_CASE(GlyphAtlasFindsCells)
+{
+    const FGlyphAtlas Atlas(AtlasCells, AtlasCells);
+    CHECK(Atlas.GetCellIndex(L' ') == INDEX_NONE);
+    CHECK(Atlas.GetCellIndex(L'!') == INDEX_NONE);
+    CHECK(Atlas.GetCellIndex(L'é') == INDEX_NONE);
+    CHECK(Atlas.GetCellIndex(L'0') == FGlyphAtlas::DigitStartCell);
+    CHECK(Atlas.GetCellIndex(L'A') == FGlyphAtlas::UpperStartCell);
+    CHECK(Atlas.GetCellIndex(L'z') == FGlyphAtlas::LowerStartCell + 25);
+    CHECK(Atlas.GetCellIndex(L'가') == FGlyphAtlas::HangulStartCell);
+    CHECK(Atlas.GetCellIndex(L'힣') == FGlyphAtlas::HangulStartCell + (L'힣' - L'가'));
+
+    // Atlas 밖의 셀과 빈 Atlas
+    CHECK(FGlyphAtlas(10, 10).GetCellIndex(L'힣') == INDEX_NONE);
+    CHECK(FGlyphAtlas().GetCellIndex(L'A') == INDEX_NONE);
+}
+
+TEST_CASE(LayoutMatchesPreviousTextBuffer)
+{
+    const FGlyphAtlas Atlas(AtlasCells, AtlasCells);
+    for (const FWString& Text : { FWString(L"안녕하세요 Jungle 1"), FWString(L"1234567"), FWString(L"A"), FWString(L""), FWString(L"  x  "), FWString(L"힣가Zz09") })
+    {
+        TArray<FTextGlyphQuad> Quads;
+        TextLayout::LayoutText(Text, Atlas, 2.f, 2.f, Quads);
+        TArray<FVertexTexture> Vertices;
+        TextLayout::AppendQuadVertices(Quads, FMatrix::Identity, Vertices);
+
+        TArray<FVertexTexture> Expected;
+        BuildReferenceVertices(Text, Expected);
+        CHECK(Vertices.Num() == Expected.Num());
+        for (int32 Index = 0; Index < Vertices.Num() && Index < Expected.Num(); ++Index)
+        {
+            CHECK(AreVerticesNear(Vertices[Index], Expected[Index]));
+        }
+    }
+}
+
+TEST_CASE(QuadVerticesAreTransformedAndAppended)
+{
+    const FGlyphAtlas Atlas(AtlasCells, AtlasCells);
+    TArray<FTextGlyphQuad> Quads;
+    TextLayout::LayoutText(L"AB", Atlas, 4.f, 1.f, Quads);
+    CHECK(Quads.Num() == 2);
+    // 이전 방식처럼 글자 중심이 QuadWidth * (Index - Num / 2)에 놓입니다.
+    CHECK_NEAR(Quads[0].PositionMin.X, -6.f, 1e-5f);
+    CHECK_NEAR(Quads[1].PositionMax.X, 2.f, 1e-5f);
+    CHECK_NEAR(Quads[0].PositionMax.Y, 0.5f, 1e-5f);
+
+    // 로컬 X축을 월드 Y축, 로컬 Y축을 월드 Z축으로 보내고 (10, 20, 30)으로 옮기는 Model
+    FMatrix Model = FMatrix::Identity;
+    Model.M[0][0] = 0.f;
+    Model.M[0][1] = 1.f;
+    Model.M[1][1] = 0.f;
+    Model.M[1][2] = 1.f;
+    Model.M[3][0] = 10.f;
+    Model.M[3][1] = 20.f;
+    Model.M[3][2] = 30.f;
+
+    // 이미 있는 정점은 그대로 두고 뒤에 붙입니다.
+    TArray<FVertexTexture> Vertices;
+    Vertices.Add({ 1, 2, 3, 0, 0 });
+    TextLayout::AppendQuadVertices(Quads, Model, Vertices);
+    CHECK(Vertices.Num() == 1 + 2 * 6);
+    CHECK(Vertices[0].x == 1 && Vertices[0].y == 2 && Vertices[0].z == 3);
+
+    // 첫 글자의 왼쪽 위 (-6, 0.5)
+    CHECK_NEAR(Vertices[1].x, 10.f, 1e-5f);
+    CHECK_NEAR(Vertices[1].y, 14.f, 1e-5f);
+    CHECK_NEAR(Vertices[1].z, 30.5f, 1e-5f);
+}
+
+TEST_CASE(LayoutCacheEvictsLeastRecentlyUsed)
+{
+    const FGlyphAtlas Atlas(AtlasCells, AtlasCells);
+    FTextLayoutCache Cache(3);
+
+    const TArray<FTextGlyphQuad>* First = &Cache.FindOrLayout(L"a", Atlas, 2.f, 2.f);
+    CHECK(First->Num() == 1);
+    CHECK(Cache.GetStats().NumMisses == 1);
+    CHECK(&Cache.FindOrLayout(L"a", Atlas, 2.f, 2.f) == First);
+    CHECK(Cache.GetStats().NumHits == 1);
+
+    Cache.FindOrLayout(L"bb", Atlas, 2.f, 2.f);
+    Cache.FindOrLayout(L"ccc", Atlas, 2.f, 2.f);
+    // "a"를 다시 쓰면 가장 오래 쓰이지 않은 항목은 "bb"가 됩니다.
+    Cache.FindOrLayout(L"a", Atlas, 2.f, 2.f);
+    CHECK(Cache.FindOrLayout(L"dddd", Atlas, 2.f, 2.f).Num() == 4);
+    CHECK(Cache.Num() == 3);
+    CHECK(Cache.GetStats().NumEvictions == 1);
+
+    const uint32 NumMisses = Cache.GetStats().NumMisses;
+    Cache.FindOrLayout(L"a", Atlas, 2.f, 2.f);
+    Cache.FindOrLayout(L"ccc", Atlas, 2.f, 2.f);
+    CHECK(Cache.GetStats().NumMisses == NumMisses);
+    Cache.FindOrLayout(L"bb", Atlas, 2.f, 2.f);
+    CHECK(Cache.GetStats().NumMisses == NumMisses + 1);
+
+    // 크기나 Atlas가 다르면 같은 문자열이라도 다시 배치합니다.
+    Cache.FindOrLayout(L"a", Atlas, 3.f, 2.f);
+    CHECK(Cache.GetStats().NumMisses == NumMisses + 2);
+    CHECK(Cache.Num() == 3);
+    const FGlyphAtlas SmallAtlas(6, 6);
+    CHECK(Cache.FindOrLayout(L"a", SmallAtlas, 3.f, 2.f).Num() == 0);
+
+    // 계속 바뀌는 문자열을 넣어도 Capacity를 넘지 않습니다.
+    for (int32 Index = 0; Index < 10000; ++Index)
+    {
+        Cache.FindOrLayout(std::to_wstring(Index % 7), Atlas, 2.f, 2.f);
+    }
+    CHECK(Cache.Num() == 3);
+
+    Cache.Empty();
+    CHECK(Cache.Num() == 0);
+}
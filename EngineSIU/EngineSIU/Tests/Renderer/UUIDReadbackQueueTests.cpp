@@ -0,0 +1,278 @@
+#include "TestHarness.h"
+#include <vector>
+#include "D3D11RHI/UUIDReadbackQueue.h"
+
+
+namespace
+{
+    /**
+     * GPU 대신 메모리의 UUID 버퍼를 복사하는 Source.
+     * 복사한 뒤 ReadyAfterReads번의 기다리지 않는 읽기가 실패해야 결과가 준비됩니다.
+     */
+    class FFakeReadbackSource : public IUUIDReadbackSource
+    {
+    public:
+        static constexpr uint32 Width = 64;
+        static constexpr uint32 Height = 32;
+
+        uint32 NumSlots = 2;
+        int32 ReadyAfterReads = 2;
+
+        int32 NumCopies = 0;
+        int32 NumWaits = 0;
+        /** Source의 약속을 어긴 호출 수. (버퍼 밖 복사, 사용 중인 슬롯에 복사, 비어 있는 슬롯 읽기) */
+        int32 NumContractViolations = 0;
+
+        std::vector<uint32> Surface = std::vector<uint32>(Width * Height, FUUIDReadbackQueue::InvalidUUID);
+
+        void Fill(const FUUIDReadbackRect& Rect, uint32 UUID)
+        {
+            for (int32 Y = Rect.Top; Y < Rect.Bottom; ++Y)
+            {
+                for (int32 X = Rect.Left; X < Rect.Right; ++X)
+                {
+                    Surface[Y * Width + X] = UUID;
+                }
+            }
+        }
+
+        virtual uint32 GetNumSlots() const override { return NumSlots; }
+
+        virtual void GetSurfaceSize(uint32& OutWidth, uint32& OutHeight) const override
+        {
+            OutWidth = Width;
+            OutHeight = Height;
+        }
+
+        virtual bool EnqueueCopy(uint32 Slot, const FUUIDReadbackRect& Rect) override
+        {
+            FSlot& Target = Slots[Slot];
+            if (Target.bBusy || Rect.IsEmpty() || Rect.Left < 0 || Rect.Top < 0 || Rect.Right > static_cast<int32>(Width) || Rect.Bottom > static_cast<int32>(Height))
+            {
+                ++NumContractViolations;
+            }
+
+            Target.bBusy = true;
+            Target.RemainingReads = ReadyAfterReads;
+            Target.Data.clear();
+            for (int32 Y = Rect.Top; Y < Rect.Bottom; ++Y)
+            {
+                for (int32 X = Rect.Left; X < Rect.Right; ++X)
+                {
+                    Target.Data.push_back(Surface[Y * Width + X]);
+                }
+            }
+            ++NumCopies;
+            return true;
+        }
+
+        virtual bool TryRead(uint32 Slot, const FUUIDReadbackRect& Rect, bool bWait, TArray<uint32>& OutUUIDs) override
+        {
+            FSlot& Source = Slots[Slot];
+            if (!Source.bBusy)
+            {
+                ++NumContractViolations;
+            }
+            if (Source.RemainingReads-- > 0 && !bWait)
+            {
+                return false;
+            }
+            NumWaits += bWait ? 1 : 0;
+
+            OutUUIDs.SetNum(static_cast<int32>(Source.Data.size()));
+            for (size_t Index = 0; Index < Source.Data.size(); ++Index)
+            {
+                OutUUIDs[static_cast<int32>(Index)] = Source.Data[Index];
+            }
+            Source.bBusy = false;
+            return true;
+        }
+
+    private:
+        struct FSlot
+        {
+            bool bBusy = false;
+            int32 RemainingReads = 0;
+            std::vector<uint32> Data;
+        };
+        FSlot Slots[FUUIDReadbackQueue::MaxSlots];
+    };
+
+    /** 결과를 (요청 태그, UUID) 순서대로 기록하는 픽셀 요청 */
+    struct FPixelResults
+    {
+        std::vector<int32> Tags;
+        std::vector<uint32> UUIDs;
+
+        uint32 Request(FUUIDReadbackQueue& Queue, int32 X, int32 Y, int32 Tag)
+        {
+            FOnPixelUUIDResolved OnResolved;
+            OnResolved.BindLambda([this, Tag](uint32 UUID)
+            {
+                Tags.push_back(Tag);
+                UUIDs.push_back(UUID);
+            });
+            return Queue.RequestPixel(X, Y, std::move(OnResolved));
+        }
+    };
+
+    int32 TickUntilIdle(FUUIDReadbackQueue& Queue, int32 MaxTicks)
+    {
+        int32 NumTicks = 0;
+        while (Queue.GetNumPending() > 0 && NumTicks < MaxTicks)
+        {
+            Queue.Tick();
+            ++NumTicks;
+        }
+        return NumTicks;
+    }
+}
+
+
+TEST_CASE(PixelRequestsResolveInOrder)
+{
+    FFakeReadbackSource Source;
+    Source.Fill({ 10, 10, 20, 20 }, 42);
+    Source.Fill({ 30, 15, 31, 16 }, 7);
+    // 맨 앞 요청만 읽기를 시도하므로, 한 번 실패하고 준비되면 MaxLatencyFrames 안에 모두 기다리지 않고 끝납니다.
+    Source.ReadyAfterReads = 1;
+
+    FUUIDReadbackQueue Queue;
+    Queue.SetSource(&Source);
+
+    FPixelResults Results;
+    Results.Request(Queue, 12, 12, 0);
+    Results.Request(Queue, 30, 15, 1);
+    Results.Request(Queue, 0, 0, 2);
+    // 버퍼 밖의 요청은 복사 없이 InvalidUUID로 끝납니다.
+    Results.Request(Queue, -5, 3, 3);
+    Results.Request(Queue, 100, 100, 4);
+
+    // 슬롯이 두 개이므로 요청 즉시 두 개만 복사하고 나머지는 기다립니다.
+    CHECK(Source.NumCopies == 2);
+    CHECK(Results.Tags.empty());
+
+    TickUntilIdle(Queue, 20);
+    CHECK(Queue.GetNumPending() == 0);
+    CHECK(Results.Tags == std::vector<int32>({ 0, 1, 2, 3, 4 }));
+    CHECK(Results.UUIDs == std::vector<uint32>({ 42, 7, FUUIDReadbackQueue::InvalidUUID, FUUIDReadbackQueue::InvalidUUID, FUUIDReadbackQueue::InvalidUUID }));
+    CHECK(Source.NumCopies == 3);
+    CHECK(Source.NumWaits == 0);
+    CHECK(Source.NumContractViolations == 0);
+}
+
+TEST_CASE(RectRequestReturnsUniqueUUIDs)
+{
+    FFakeReadbackSource Source;
+    Source.Fill({ 10, 10, 20, 20 }, 42);
+    Source.Fill({ 30, 15, 31, 16 }, 7);
+    Source.Fill({ 50, 0, 60, 10 }, 99);
+
+    FUUIDReadbackQueue Queue;
+    Queue.SetSource(&Source);
+
+    TSet<uint32> Resolved;
+    bool bResolved = false;
+    FOnRectUUIDsResolved OnResolved;
+    OnResolved.BindLambda([&](const TSet<uint32>& UUIDs)
+    {
+        Resolved = UUIDs;
+        bResolved = true;
+    });
+    // 버퍼 밖으로 나간 부분은 잘립니다.
+    Queue.RequestRect({ -5, 5, 40, 100 }, std::move(OnResolved));
+
+    TickUntilIdle(Queue, 20);
+    CHECK(bResolved);
+    CHECK(Resolved.Num() == 2);
+    CHECK(Resolved.Contains(42) && Resolved.Contains(7));
+    CHECK(!Resolved.Contains(FUUIDReadbackQueue::InvalidUUID));
+    CHECK(Source.NumContractViolations == 0);
+}
+
+TEST_CASE(CanceledRequestsAreNotDelivered)
+{
+    FFakeReadbackSource Source;
+    FUUIDReadbackQueue Queue;
+    Queue.SetSource(&Source);
+
+    FPixelResults Results;
+    const uint32 InFlightId = Results.Request(Queue, 1, 1, 0);
+    Results.Request(Queue, 2, 2, 1);
+    const uint32 QueuedId = Results.Request(Queue, 3, 3, 2);
+    Queue.Cancel(InFlightId);
+    Queue.Cancel(QueuedId);
+
+    TickUntilIdle(Queue, 20);
+    CHECK(Results.Tags == std::vector<int32>({ 1 }));
+    // 취소된 대기 요청은 복사하지 않습니다.
+    CHECK(Source.NumCopies == 2);
+    CHECK(Source.NumContractViolations == 0);
+}
+
+TEST_CASE(SlowCopiesAreWaitedForAfterMaxLatency)
+{
+    FFakeReadbackSource Source;
+    Source.Fill({ 10, 10, 20, 20 }, 42);
+    Source.ReadyAfterReads = 1000;
+
+    FUUIDReadbackQueue Queue;
+    Queue.SetSource(&Source);
+
+    FPixelResults Results;
+    Results.Request(Queue, 12, 12, 0);
+    const int32 NumTicks = TickUntilIdle(Queue, 100);
+    CHECK(NumTicks == static_cast<int32>(FUUIDReadbackQueue::MaxLatencyFrames));
+    CHECK(Source.NumWaits == 1);
+    CHECK(Results.UUIDs == std::vector<uint32>({ 42 }));
+}
+
+TEST_CASE(FlushResolvesQueuedRequests)
+{
+    FFakeReadbackSource Source;
+    Source.Fill({ 10, 10, 20, 20 }, 42);
+    Source.ReadyAfterReads = 3;
+
+    FUUIDReadbackQueue Queue;
+    Queue.SetSource(&Source);
+
+    FPixelResults Results;
+    for (int32 Index = 0; Index < 7; ++Index)
+    {
+        Results.Request(Queue, 12 + Index, 12, Index);
+    }
+    Queue.Flush();
+    CHECK(Queue.GetNumPending() == 0);
+    CHECK(Results.Tags == std::vector<int32>({ 0, 1, 2, 3, 4, 5, 6 }));
+    CHECK(Source.NumContractViolations == 0);
+
+    // Reset은 결과 없이 모두 버립니다.
+    Results.Request(Queue, 12, 12, 7);
+    Queue.Reset();
+    TickUntilIdle(Queue, 20);
+    CHECK(Results.Tags.size() == 7);
+}
+
+TEST_CASE(RequestFromCallbackIsServed)
+{
+    FFakeReadbackSource Source;
+    Source.Fill({ 10, 10, 20, 20 }, 42);
+    Source.Fill({ 30, 15, 31, 16 }, 7);
+    Source.ReadyAfterReads = 0;
+
+    FUUIDReadbackQueue Queue;
+    Queue.SetSource(&Source);
+
+    FPixelResults Results;
+    FOnPixelUUIDResolved OnResolved;
+    OnResolved.BindLambda([&](uint32 UUID)
+    {
+        Results.UUIDs.push_back(UUID);
+        Results.Request(Queue, 30, 15, 1);
+    });
+    Queue.RequestPixel(12, 12, std::move(OnResolved));
+
+    TickUntilIdle(Queue, 20);
+    CHECK(Results.UUIDs == std::vector<uint32>({ 42, 7 }));
+    CHECK(Source.NumContractViolations == 0);
+}
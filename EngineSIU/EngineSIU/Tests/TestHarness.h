@@ -0,0 +1,47 @@
+#pragma once
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+
+/**
+ * 헤드리스 테스트 빌드용 최소 테스트 러너.
+ * TEST_CASE로 등록한 함수를 TestMain.cpp의 main이 등록 순서대로 실행하고, CHECK가 하나라도 실패하면 1을 반환합니다.
+ * 실행 인자로 이름의 일부를 넘기면 그 이름을 포함한 테스트만 실행합니다.
+ */
+namespace TestHarness
+{
+    struct FTestCase
+    {
+        const char* Name;
+        void (*Function)();
+    };
+
+    std::vector<FTestCase>& GetTestCases();
+
+    void ReportFailure(const char* File, int Line, const char* Expression);
+
+    struct FRegistrar
+    {
+        FRegistrar(const char* Name, void (*Function)())
+        {
+            GetTestCases().push_back({ Name, Function });
+        }
+    };
+}
+
+#define TEST_CASE(Name) \
+    static void Name(); \
+    static TestHarness::FRegistrar Name##_Registrar(#Name, &Name); \
+    static void Name()
+
+#define CHECK(Expression) \
+    do \
+    { \
+        if (!(Expression)) \
+        { \
+            TestHarness::ReportFailure(__FILE__, __LINE__, #Expression); \
+        } \
+    } while (0)
+
+#define CHECK_NEAR(A, B, Tolerance) CHECK(std::abs((A) - (B)) <= (Tolerance))
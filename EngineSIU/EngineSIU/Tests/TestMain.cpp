@@ -0,0 +1,41 @@
+#include "TestHarness.h"
+#include <cstring>
+
+namespace
+{
+    int NumFailures = 0;
+}
+
+std::vector<TestHarness::FTestCase>& TestHarness::GetTestCases()
+{
+    static std::vector<FTestCase> TestCases;
+    return TestCases;
+}
+
+void TestHarness::ReportFailure(const char* File, int Line, const char* Expression)
+{
+    ++NumFailures;
+    std::printf("%s(%d): CHECK(%s) failed\n", File, Line, Expression);
+}
+
+int main(int Argc, char** Argv)
+{
+    const char* Filter = Argc > 1 ? Argv[1] : nullptr;
+
+    int NumRun = 0;
+    for (const TestHarness::FTestCase& TestCase : TestHarness::GetTestCases())
+    {
+        if (Filter && !std::strstr(TestCase.Name, Filter))
+        {
+            continue;
+        }
+
+        const int FailuresBefore = NumFailures;
+        TestCase.Function();
+        std::printf("[%s] %s\n", NumFailures == FailuresBefore ? "  OK  " : " FAIL ", TestCase.Name);
+        ++NumRun;
+    }
+
+    std::printf("%d test(s), %d failure(s)\n", NumRun, NumFailures);
+    return NumFailures == 0 ? 0 : 1;
+}
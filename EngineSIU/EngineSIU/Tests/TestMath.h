@@ -0,0 +1,54 @@
+#pragma once
+#include <cmath>
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+
+
+/**
+ * 테스트에서 카메라 행렬을 만들 때 사용합니다.
+ * JungleMath는 DirectXMath를 사용하므로 헤드리스 빌드에서는 같은 규약(행벡터, 왼손 좌표계, 깊이 0~1)으로 직접 계산합니다.
+ */
+namespace TestMath
+{
+    inline FMatrix MakeLookAtLH(const FVector& Eye, const FVector& Target, const FVector& WorldUp)
+    {
+        const FVector Forward = (Target - Eye).GetSafeNormal();
+        const FVector Right = WorldUp.Cross(Forward).GetSafeNormal();
+        const FVector Up = Forward.Cross(Right);
+
+        FMatrix View = FMatrix::Identity;
+        View.M[0][0] = Right.X;   View.M[0][1] = Up.X;   View.M[0][2] = Forward.X;
+        View.M[1][0] = Right.Y;   View.M[1][1] = Up.Y;   View.M[1][2] = Forward.Y;
+        View.M[2][0] = Right.Z;   View.M[2][1] = Up.Z;   View.M[2][2] = Forward.Z;
+        View.M[3][0] = -Right.Dot(Eye);
+        View.M[3][1] = -Up.Dot(Eye);
+        View.M[3][2] = -Forward.Dot(Eye);
+        return View;
+    }
+
+    inline FMatrix MakePerspectiveLH(float FovYRadians, float AspectRatio, float NearZ, float FarZ)
+    {
+        const float YScale = 1.0f / std::tan(FovYRadians * 0.5f);
+        const float XScale = YScale / AspectRatio;
+        const float Range = FarZ / (FarZ - NearZ);
+
+        FMatrix Projection = {};
+        Projection.M[0][0] = XScale;
+        Projection.M[1][1] = YScale;
+        Projection.M[2][2] = Range;
+        Projection.M[2][3] = 1.0f;
+        Projection.M[3][2] = -NearZ * Range;
+        return Projection;
+    }
+
+    inline FMatrix MakeOrthographicLH(float Width, float Height, float NearZ, float FarZ)
+    {
+        FMatrix Projection = {};
+        Projection.M[0][0] = 2.0f / Width;
+        Projection.M[1][1] = 2.0f / Height;
+        Projection.M[2][2] = 1.0f / (FarZ - NearZ);
+        Projection.M[3][2] = -NearZ / (FarZ - NearZ);
+        Projection.M[3][3] = 1.0f;
+        return Projection;
+    }
+}